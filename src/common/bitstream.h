@@ -26,6 +26,7 @@
 #define COMMON_BITSTREAM_H
 
 #include "common/types.h"
+#include "common/util.h"
 #include "common/error.h"
 #include "common/stream.h"
 
@@ -61,6 +62,15 @@ public:
 	/** Add a bit to the value x, making it an n-bit value. */
 	virtual void addBit(uint32 &x, uint32 n) = 0;
 
+	/** Return the next n bits, like getBits(), without consuming them.
+	 *
+	 *  Bits past the end of the stream are read as 0.
+	 */
+	virtual uint32 peekBits(uint8 n) = 0;
+
+	/** Does the stream hand out its bits MSB first? */
+	virtual bool isMSBFirst() const = 0;
+
 protected:
 	BitStream() {
 	}
@@ -125,6 +135,25 @@ private:
 			_value <<= 64 - valueBits;
 		}
 
+	/** Peek at the next bits by reading them, and go back afterwards. */
+	uint32 peekBitsSlow(uint8 n, int32 position) {
+		const uint64 value   = _value;
+		const uint8  inValue = _inValue;
+
+		const uint8 count = MIN<uint32>(n, size() - MIN(size(), pos()));
+
+		uint32 v = (count > 0) ? getBits(count) : 0;
+		if (isMSB2LSB)
+			v <<= n - count;
+
+		_stream->seek(position);
+
+		_value   = value;
+		_inValue = inValue;
+
+		return v;
+	}
+
 public:
 	/** Create a bit stream using this input data stream and optionally delete it on destruction. */
 	BitStreamImpl(SeekableReadStream *stream, bool disposeAfterUse = false) :
@@ -201,6 +230,57 @@ public:
 			x = (x & ~(1 << n)) | (getBit() << n);
 	}
 
+	/** Return the next n bits, without consuming them. */
+	uint32 peekBits(uint8 n) {
+		if (n > 32)
+			throw Exception("Too many bits requested to be read");
+
+		if (n == 0)
+			return 0;
+
+		// Fast path: all bits are still in the current value
+		if ((_inValue != 0) && ((uint32) (valueBits - _inValue) >= n)) {
+			if (isMSB2LSB)
+				return (uint32) (_value >> (64 - n));
+
+			return (uint32) (_value & (0xFFFFFFFFULL >> (32 - n)));
+		}
+
+		// Otherwise read ahead, and go back afterwards
+		const int32 position = _stream->pos();
+
+		if (valueBits == 64)
+			return peekBitsSlow(n, position);
+
+		uint64 bits  = _value;
+		uint32 count = (_inValue == 0) ? 0 : (valueBits - _inValue);
+
+		while ((count < n) && ((_stream->size() - _stream->pos()) >= (valueBits / 8))) {
+			const uint64 data = readData();
+
+			if (isMSB2LSB)
+				bits |= (data << (64 - valueBits)) >> count;
+			else
+				bits |= data << count;
+
+			count += valueBits;
+		}
+
+		_stream->seek(position);
+
+		if (count == 0)
+			return 0;
+
+		if (isMSB2LSB)
+			return (uint32) (bits >> (64 - n));
+
+		return (uint32) (bits & (0xFFFFFFFFULL >> (32 - n)));
+	}
+
+	bool isMSBFirst() const {
+		return isMSB2LSB;
+	}
+
 	/** Rewind the bit stream back to the start. */
 	void rewind() {
 		_stream->seek(0);
@@ -211,8 +291,24 @@ public:
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		while (n > 0) {
+			// Check if we need the next value
+			if (_inValue == 0)
+				readValue();
+
+			// Skip as many bits as we can out of the current value
+			const uint32 count = MIN<uint32>(n, valueBits - _inValue);
+
+			if (count >= 64)
+				_value = 0;
+			else if (isMSB2LSB)
+				_value <<= count;
+			else
+				_value >>= count;
+
+			_inValue = (_inValue + count) % valueBits;
+			n -= count;
+		}
 	}
 
 	/** Return the stream position in bits. */
@@ -268,6 +364,215 @@ typedef BitStreamImpl<64, false, true > BitStream64BEMSB;
 /** 64-bit big-endian data, LSB to MSB. */
 typedef BitStreamImpl<64, false, false> BitStream64BELSB;
 
+
+/**
+ * A bit stream reading directly out of a contiguous block of memory.
+ *
+ * Unlike BitStreamImpl, this is not a BitStream: none of its methods are
+ * virtual. Code that knows the type of the stream, like a codec's inner
+ * loop, or a template taking the stream type as a parameter, can have the
+ * calls inlined completely.
+ *
+ * The data is buffered in a 64-bit cache, refilled a whole valueBits-wide
+ * value at a time. The layout parameters are the same as BitStreamImpl's,
+ * but only values of 8, 16 and 32 bits are supported.
+ */
+template<int valueBits, bool isLE, bool isMSB2LSB>
+class MemoryBitStreamImpl {
+private:
+	static const uint32 kValueBytes = valueBits / 8;
+
+	const byte *_data; ///< The input data.
+	uint32 _dataSize;  ///< The size of the input data, in whole values.
+
+	uint32 _next;      ///< Offset of the next value to read into the cache.
+
+	uint64 _cache;     ///< The cached bits, starting at the MSB or LSB.
+	uint32 _cacheBits; ///< Number of bits in the cache.
+
+	uint32 _pos;       ///< Stream position in bits.
+
+	/** Read the data value at this offset. */
+	inline uint64 readData(uint32 offset) const {
+		const byte *data = _data + offset;
+
+		if (valueBits ==  8)
+			return *data;
+
+		if (isLE) {
+			if (valueBits == 16)
+				return READ_LE_UINT16(data);
+			if (valueBits == 32)
+				return READ_LE_UINT32(data);
+		} else {
+			if (valueBits == 16)
+				return READ_BE_UINT16(data);
+			if (valueBits == 32)
+				return READ_BE_UINT32(data);
+		}
+
+		return 0;
+	}
+
+	/** Fill the cache with as many whole values as fit. Past the end, fill in 0s. */
+	inline void refill() {
+		while (_cacheBits <= (uint32) (64 - valueBits)) {
+			const uint64 value = (_next < _dataSize) ? readData(_next) : 0;
+
+			if (isMSB2LSB)
+				_cache |= (value << (64 - valueBits)) >> _cacheBits;
+			else
+				_cache |= value << _cacheBits;
+
+			_next      += kValueBytes;
+			_cacheBits += valueBits;
+		}
+	}
+
+	/** Remove n bits, n <= _cacheBits and n < 64, from the cache. */
+	inline void consume(uint32 n) {
+		if (isMSB2LSB)
+			_cache <<= n;
+		else
+			_cache >>= n;
+
+		_cacheBits -= n;
+		_pos       += n;
+	}
+
+	inline void checkSize(uint32 n) const {
+		if ((size() - _pos) < n)
+			throw Exception("MemoryBitStream: End of bit stream reached");
+	}
+
+public:
+	/** Create a bit stream reading out of this data. The data is not copied. */
+	MemoryBitStreamImpl(const byte *data, uint32 size) : _data(data),
+		_dataSize(size & ~(kValueBytes - 1)), _next(0), _cache(0), _cacheBits(0), _pos(0) {
+
+		if ((valueBits != 8) && (valueBits != 16) && (valueBits != 32))
+			throw Exception("MemoryBitStream: Invalid memory layout %d, %d, %d", valueBits, isLE, isMSB2LSB);
+	}
+
+	/** Read a bit from the bit stream. */
+	inline uint32 getBit() {
+		return getBits(1);
+	}
+
+	/** Read a multi-bit value from the bit stream. */
+	inline uint32 getBits(uint8 n) {
+		checkSize(n);
+
+		const uint32 v = peekBits(n);
+		consume(n);
+
+		return v;
+	}
+
+	/** Add a bit to the value x, making it an n-bit value. */
+	inline void addBit(uint32 &x, uint32 n) {
+		if (isMSB2LSB)
+			x = (x << 1) | getBit();
+		else
+			x = (x & ~(1 << n)) | (getBit() << n);
+	}
+
+	/** Return the next n bits, like getBits(), without consuming them.
+	 *
+	 *  Bits past the end of the stream are read as 0.
+	 */
+	inline uint32 peekBits(uint8 n) {
+		if (n > 32)
+			throw Exception("Too many bits requested to be read");
+
+		if (_cacheBits < n)
+			refill();
+
+		if (n == 0)
+			return 0;
+
+		if (isMSB2LSB)
+			return (uint32) (_cache >> (64 - n));
+
+		return (uint32) (_cache & (0xFFFFFFFFULL >> (32 - n)));
+	}
+
+	/** Skip the specified amount of bits. */
+	void skip(uint32 n) {
+		checkSize(n);
+
+		if (n < _cacheBits) {
+			consume(n);
+			return;
+		}
+
+		// Drop the cache, and continue from the start of the next value
+		n    -= _cacheBits;
+		_pos += _cacheBits;
+
+		_cache     = 0;
+		_cacheBits = 0;
+
+		_next += (n / valueBits) * kValueBytes;
+		_pos  += (n / valueBits) * valueBits;
+
+		refill();
+		consume(n % valueBits);
+	}
+
+	/** Does the stream hand out its bits MSB first? */
+	static bool isMSBFirst() {
+		return isMSB2LSB;
+	}
+
+	/** Rewind the bit stream back to the start. */
+	void rewind() {
+		_next      = 0;
+		_cache     = 0;
+		_cacheBits = 0;
+		_pos       = 0;
+	}
+
+	/** Return the stream position in bits. */
+	uint32 pos() const {
+		return _pos;
+	}
+
+	/** Return the stream size in bits. */
+	uint32 size() const {
+		return _dataSize * 8;
+	}
+
+	bool eos() const {
+		return _pos >= size();
+	}
+};
+
+// typedefs for various memory layouts.
+
+/** 8-bit data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<8, false, true > MemoryBitStream8MSB;
+/** 8-bit data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<8, false, false> MemoryBitStream8LSB;
+
+/** 16-bit little-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<16, true , true > MemoryBitStream16LEMSB;
+/** 16-bit little-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<16, true , false> MemoryBitStream16LELSB;
+/** 16-bit big-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<16, false, true > MemoryBitStream16BEMSB;
+/** 16-bit big-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<16, false, false> MemoryBitStream16BELSB;
+
+/** 32-bit little-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<32, true , true > MemoryBitStream32LEMSB;
+/** 32-bit little-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<32, true , false> MemoryBitStream32LELSB;
+/** 32-bit big-endian data in memory, MSB to LSB. */
+typedef MemoryBitStreamImpl<32, false, true > MemoryBitStream32BEMSB;
+/** 32-bit big-endian data in memory, LSB to MSB. */
+typedef MemoryBitStreamImpl<32, false, false> MemoryBitStream32BELSB;
+
 } // End of namespace Common
 
 #endif // COMMON_BITSTREAM_H
@@ -273,6 +273,13 @@ bool ConfigManager::isInGame() const {
 	return _domainGame && _domainDefaultGame && _domainGameTemp;
 }
 
+UString ConfigManager::getGameID() const {
+	if (!_domainGame)
+		return "";
+
+	return _domainGame->getName();
+}
+
 bool ConfigManager::hasKey(const UString &key) const {
 	// Look up the key in order of priority
 	return hasKey(_domainCommandline, key) || // First command line
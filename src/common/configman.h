@@ -51,6 +51,8 @@ public:
 
 	/** Set the config file to use. */
 	void setConfigFile(const UString &file = "");
+	/** Return the config file in use. */
+	UString getConfigFile() const;
 
 	/** Clear everything except the command line options. */
 	void clear();
@@ -82,6 +84,8 @@ public:
 
 	/** Are we currently in a game? */
 	bool isInGame() const;
+	/** Return the ID of the current game domain, or "" if we're not in a game. */
+	UString getGameID() const;
 
 	bool hasKey(const UString &key) const;
 	bool getKey(const UString &key, UString &value) const;
@@ -131,8 +135,6 @@ private:
 	ConfigDomain *_domainCommandline; ///< Command line domain.
 	ConfigDomain *_domainGameTemp;    ///< Temporary game settings domain.
 
-	UString getConfigFile() const;
-
 	static UString getDefaultConfigFile();
 
 	UString createGameID(const UString &path);
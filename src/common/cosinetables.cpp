@@ -19,8257 +19,80 @@
  */
 
 /** @file common/cosinetables.cpp
- *  Static cosine tables.
+ *  Cosine tables.
  */
 
 #include <cassert>
+#include <cstddef>
 
+#include "common/maths.h"
+#include "common/mutex.h"
 #include "common/cosinetables.h"
 
 namespace Common {
 
-static const float cosTable16[8] = {
-	 1.000000,  0.923880,  0.707107,  0.382683,  0.000000,  0.382683,  0.707107,  0.923880
-};
+/** All cosine tables, generated when they're first needed. */
+class CosineTables {
+public:
+	CosineTables() {
+		for (int i = 0; i < 17; i++) {
+			_data  [i] = 0;
+			_tables[i] = 0;
+		}
+	}
 
-static const float cosTable32[16] = {
-	 1.000000,  0.980785,  0.923880,  0.831470,  0.707107,  0.555570,  0.382683,  0.195090,
-	 0.000000,  0.195090,  0.382683,  0.555570,  0.707107,  0.831470,  0.923880,  0.980785
-};
+	~CosineTables() {
+		for (int i = 0; i < 17; i++)
+			delete[] _data[i];
+	}
 
-static const float cosTable64[32] = {
-	 1.000000,  0.995185,  0.980785,  0.956940,  0.923880,  0.881921,  0.831470,  0.773010,
-	 0.707107,  0.634393,  0.555570,  0.471397,  0.382683,  0.290285,  0.195090,  0.098017,
-	 0.000000,  0.098017,  0.195090,  0.290285,  0.382683,  0.471397,  0.555570,  0.634393,
-	 0.707107,  0.773010,  0.831470,  0.881921,  0.923880,  0.956940,  0.980785,  0.995185
-};
+	const float *get(int bits) {
+		StackLock lock(_mutex);
 
-static const float cosTable128[64] = {
-	 1.000000,  0.998795,  0.995185,  0.989177,  0.980785,  0.970031,  0.956940,  0.941544,
-	 0.923880,  0.903989,  0.881921,  0.857729,  0.831470,  0.803208,  0.773010,  0.740951,
-	 0.707107,  0.671559,  0.634393,  0.595699,  0.555570,  0.514103,  0.471397,  0.427555,
-	 0.382683,  0.336890,  0.290285,  0.242980,  0.195090,  0.146730,  0.098017,  0.049068,
-	 0.000000,  0.049068,  0.098017,  0.146730,  0.195090,  0.242980,  0.290285,  0.336890,
-	 0.382683,  0.427555,  0.471397,  0.514103,  0.555570,  0.595699,  0.634393,  0.671559,
-	 0.707107,  0.740951,  0.773010,  0.803208,  0.831470,  0.857729,  0.881921,  0.903989,
-	 0.923880,  0.941544,  0.956940,  0.970031,  0.980785,  0.989177,  0.995185,  0.998795
-};
+		if (!_tables[bits])
+			generate(bits);
 
-static const float cosTable256[128] = {
-	 1.000000,  0.999699,  0.998795,  0.997290,  0.995185,  0.992480,  0.989177,  0.985278,
-	 0.980785,  0.975702,  0.970031,  0.963776,  0.956940,  0.949528,  0.941544,  0.932993,
-	 0.923880,  0.914210,  0.903989,  0.893224,  0.881921,  0.870087,  0.857729,  0.844854,
-	 0.831470,  0.817585,  0.803208,  0.788346,  0.773010,  0.757209,  0.740951,  0.724247,
-	 0.707107,  0.689541,  0.671559,  0.653173,  0.634393,  0.615232,  0.595699,  0.575808,
-	 0.555570,  0.534998,  0.514103,  0.492898,  0.471397,  0.449611,  0.427555,  0.405241,
-	 0.382683,  0.359895,  0.336890,  0.313682,  0.290285,  0.266713,  0.242980,  0.219101,
-	 0.195090,  0.170962,  0.146730,  0.122411,  0.098017,  0.073565,  0.049068,  0.024541,
-	 0.000000,  0.024541,  0.049068,  0.073565,  0.098017,  0.122411,  0.146730,  0.170962,
-	 0.195090,  0.219101,  0.242980,  0.266713,  0.290285,  0.313682,  0.336890,  0.359895,
-	 0.382683,  0.405241,  0.427555,  0.449611,  0.471397,  0.492898,  0.514103,  0.534998,
-	 0.555570,  0.575808,  0.595699,  0.615232,  0.634393,  0.653173,  0.671559,  0.689541,
-	 0.707107,  0.724247,  0.740951,  0.757209,  0.773010,  0.788346,  0.803208,  0.817585,
-	 0.831470,  0.844854,  0.857729,  0.870087,  0.881921,  0.893224,  0.903989,  0.914210,
-	 0.923880,  0.932993,  0.941544,  0.949528,  0.956940,  0.963776,  0.970031,  0.975702,
-	 0.980785,  0.985278,  0.989177,  0.992480,  0.995185,  0.997290,  0.998795,  0.999699
-};
+		return _tables[bits];
+	}
 
-static const float cosTable512[256] = {
-	 1.000000,  0.999925,  0.999699,  0.999322,  0.998795,  0.998118,  0.997290,  0.996313,
-	 0.995185,  0.993907,  0.992480,  0.990903,  0.989177,  0.987301,  0.985278,  0.983105,
-	 0.980785,  0.978317,  0.975702,  0.972940,  0.970031,  0.966976,  0.963776,  0.960431,
-	 0.956940,  0.953306,  0.949528,  0.945607,  0.941544,  0.937339,  0.932993,  0.928506,
-	 0.923880,  0.919114,  0.914210,  0.909168,  0.903989,  0.898674,  0.893224,  0.887640,
-	 0.881921,  0.876070,  0.870087,  0.863973,  0.857729,  0.851355,  0.844854,  0.838225,
-	 0.831470,  0.824589,  0.817585,  0.810457,  0.803208,  0.795837,  0.788346,  0.780737,
-	 0.773010,  0.765167,  0.757209,  0.749136,  0.740951,  0.732654,  0.724247,  0.715731,
-	 0.707107,  0.698376,  0.689541,  0.680601,  0.671559,  0.662416,  0.653173,  0.643832,
-	 0.634393,  0.624860,  0.615232,  0.605511,  0.595699,  0.585798,  0.575808,  0.565732,
-	 0.555570,  0.545325,  0.534998,  0.524590,  0.514103,  0.503538,  0.492898,  0.482184,
-	 0.471397,  0.460539,  0.449611,  0.438616,  0.427555,  0.416430,  0.405241,  0.393992,
-	 0.382683,  0.371317,  0.359895,  0.348419,  0.336890,  0.325310,  0.313682,  0.302006,
-	 0.290285,  0.278520,  0.266713,  0.254866,  0.242980,  0.231058,  0.219101,  0.207111,
-	 0.195090,  0.183040,  0.170962,  0.158858,  0.146730,  0.134581,  0.122411,  0.110222,
-	 0.098017,  0.085797,  0.073565,  0.061321,  0.049068,  0.036807,  0.024541,  0.012272,
-	 0.000000,  0.012272,  0.024541,  0.036807,  0.049068,  0.061321,  0.073565,  0.085797,
-	 0.098017,  0.110222,  0.122411,  0.134581,  0.146730,  0.158858,  0.170962,  0.183040,
-	 0.195090,  0.207111,  0.219101,  0.231058,  0.242980,  0.254866,  0.266713,  0.278520,
-	 0.290285,  0.302006,  0.313682,  0.325310,  0.336890,  0.348419,  0.359895,  0.371317,
-	 0.382683,  0.393992,  0.405241,  0.416430,  0.427555,  0.438616,  0.449611,  0.460539,
-	 0.471397,  0.482184,  0.492898,  0.503538,  0.514103,  0.524590,  0.534998,  0.545325,
-	 0.555570,  0.565732,  0.575808,  0.585798,  0.595699,  0.605511,  0.615232,  0.624860,
-	 0.634393,  0.643832,  0.653173,  0.662416,  0.671559,  0.680601,  0.689541,  0.698376,
-	 0.707107,  0.715731,  0.724247,  0.732654,  0.740951,  0.749136,  0.757209,  0.765167,
-	 0.773010,  0.780737,  0.788346,  0.795837,  0.803208,  0.810457,  0.817585,  0.824589,
-	 0.831470,  0.838225,  0.844854,  0.851355,  0.857729,  0.863973,  0.870087,  0.876070,
-	 0.881921,  0.887640,  0.893224,  0.898674,  0.903989,  0.909168,  0.914210,  0.919114,
-	 0.923880,  0.928506,  0.932993,  0.937339,  0.941544,  0.945607,  0.949528,  0.953306,
-	 0.956940,  0.960431,  0.963776,  0.966976,  0.970031,  0.972940,  0.975702,  0.978317,
-	 0.980785,  0.983105,  0.985278,  0.987301,  0.989177,  0.990903,  0.992480,  0.993907,
-	 0.995185,  0.996313,  0.997290,  0.998118,  0.998795,  0.999322,  0.999699,  0.999925
-};
+private:
+	float *_data  [17]; ///< The allocated memory.
+	float *_tables[17]; ///< The tables, aligned for SIMD loads.
 
-static const float cosTable1024[512] = {
-	 1.000000,  0.999981,  0.999925,  0.999831,  0.999699,  0.999529,  0.999322,  0.999078,
-	 0.998795,  0.998476,  0.998118,  0.997723,  0.997290,  0.996820,  0.996313,  0.995767,
-	 0.995185,  0.994565,  0.993907,  0.993212,  0.992480,  0.991710,  0.990903,  0.990058,
-	 0.989177,  0.988258,  0.987301,  0.986308,  0.985278,  0.984210,  0.983105,  0.981964,
-	 0.980785,  0.979570,  0.978317,  0.977028,  0.975702,  0.974339,  0.972940,  0.971504,
-	 0.970031,  0.968522,  0.966976,  0.965394,  0.963776,  0.962121,  0.960431,  0.958703,
-	 0.956940,  0.955141,  0.953306,  0.951435,  0.949528,  0.947586,  0.945607,  0.943593,
-	 0.941544,  0.939459,  0.937339,  0.935184,  0.932993,  0.930767,  0.928506,  0.926210,
-	 0.923880,  0.921514,  0.919114,  0.916679,  0.914210,  0.911706,  0.909168,  0.906596,
-	 0.903989,  0.901349,  0.898674,  0.895966,  0.893224,  0.890449,  0.887640,  0.884797,
-	 0.881921,  0.879012,  0.876070,  0.873095,  0.870087,  0.867046,  0.863973,  0.860867,
-	 0.857729,  0.854558,  0.851355,  0.848120,  0.844854,  0.841555,  0.838225,  0.834863,
-	 0.831470,  0.828045,  0.824589,  0.821102,  0.817585,  0.814036,  0.810457,  0.806848,
-	 0.803208,  0.799537,  0.795837,  0.792107,  0.788346,  0.784557,  0.780737,  0.776888,
-	 0.773010,  0.769103,  0.765167,  0.761202,  0.757209,  0.753187,  0.749136,  0.745058,
-	 0.740951,  0.736817,  0.732654,  0.728464,  0.724247,  0.720003,  0.715731,  0.711432,
-	 0.707107,  0.702755,  0.698376,  0.693971,  0.689541,  0.685084,  0.680601,  0.676093,
-	 0.671559,  0.667000,  0.662416,  0.657807,  0.653173,  0.648514,  0.643832,  0.639124,
-	 0.634393,  0.629638,  0.624860,  0.620057,  0.615232,  0.610383,  0.605511,  0.600616,
-	 0.595699,  0.590760,  0.585798,  0.580814,  0.575808,  0.570781,  0.565732,  0.560662,
-	 0.555570,  0.550458,  0.545325,  0.540171,  0.534998,  0.529804,  0.524590,  0.519356,
-	 0.514103,  0.508830,  0.503538,  0.498228,  0.492898,  0.487550,  0.482184,  0.476799,
-	 0.471397,  0.465977,  0.460539,  0.455084,  0.449611,  0.444122,  0.438616,  0.433094,
-	 0.427555,  0.422000,  0.416430,  0.410843,  0.405241,  0.399624,  0.393992,  0.388345,
-	 0.382683,  0.377007,  0.371317,  0.365613,  0.359895,  0.354164,  0.348419,  0.342661,
-	 0.336890,  0.331106,  0.325310,  0.319502,  0.313682,  0.307850,  0.302006,  0.296151,
-	 0.290285,  0.284408,  0.278520,  0.272621,  0.266713,  0.260794,  0.254866,  0.248928,
-	 0.242980,  0.237024,  0.231058,  0.225084,  0.219101,  0.213110,  0.207111,  0.201105,
-	 0.195090,  0.189069,  0.183040,  0.177004,  0.170962,  0.164913,  0.158858,  0.152797,
-	 0.146730,  0.140658,  0.134581,  0.128498,  0.122411,  0.116319,  0.110222,  0.104122,
-	 0.098017,  0.091909,  0.085797,  0.079682,  0.073565,  0.067444,  0.061321,  0.055195,
-	 0.049068,  0.042938,  0.036807,  0.030675,  0.024541,  0.018407,  0.012272,  0.006136,
-	 0.000000,  0.006136,  0.012272,  0.018407,  0.024541,  0.030675,  0.036807,  0.042938,
-	 0.049068,  0.055195,  0.061321,  0.067444,  0.073565,  0.079682,  0.085797,  0.091909,
-	 0.098017,  0.104122,  0.110222,  0.116319,  0.122411,  0.128498,  0.134581,  0.140658,
-	 0.146730,  0.152797,  0.158858,  0.164913,  0.170962,  0.177004,  0.183040,  0.189069,
-	 0.195090,  0.201105,  0.207111,  0.213110,  0.219101,  0.225084,  0.231058,  0.237024,
-	 0.242980,  0.248928,  0.254866,  0.260794,  0.266713,  0.272621,  0.278520,  0.284408,
-	 0.290285,  0.296151,  0.302006,  0.307850,  0.313682,  0.319502,  0.325310,  0.331106,
-	 0.336890,  0.342661,  0.348419,  0.354164,  0.359895,  0.365613,  0.371317,  0.377007,
-	 0.382683,  0.388345,  0.393992,  0.399624,  0.405241,  0.410843,  0.416430,  0.422000,
-	 0.427555,  0.433094,  0.438616,  0.444122,  0.449611,  0.455084,  0.460539,  0.465977,
-	 0.471397,  0.476799,  0.482184,  0.487550,  0.492898,  0.498228,  0.503538,  0.508830,
-	 0.514103,  0.519356,  0.524590,  0.529804,  0.534998,  0.540171,  0.545325,  0.550458,
-	 0.555570,  0.560662,  0.565732,  0.570781,  0.575808,  0.580814,  0.585798,  0.590760,
-	 0.595699,  0.600616,  0.605511,  0.610383,  0.615232,  0.620057,  0.624860,  0.629638,
-	 0.634393,  0.639124,  0.643832,  0.648514,  0.653173,  0.657807,  0.662416,  0.667000,
-	 0.671559,  0.676093,  0.680601,  0.685084,  0.689541,  0.693971,  0.698376,  0.702755,
-	 0.707107,  0.711432,  0.715731,  0.720003,  0.724247,  0.728464,  0.732654,  0.736817,
-	 0.740951,  0.745058,  0.749136,  0.753187,  0.757209,  0.761202,  0.765167,  0.769103,
-	 0.773010,  0.776888,  0.780737,  0.784557,  0.788346,  0.792107,  0.795837,  0.799537,
-	 0.803208,  0.806848,  0.810457,  0.814036,  0.817585,  0.821102,  0.824589,  0.828045,
-	 0.831470,  0.834863,  0.838225,  0.841555,  0.844854,  0.848120,  0.851355,  0.854558,
-	 0.857729,  0.860867,  0.863973,  0.867046,  0.870087,  0.873095,  0.876070,  0.879012,
-	 0.881921,  0.884797,  0.887640,  0.890449,  0.893224,  0.895966,  0.898674,  0.901349,
-	 0.903989,  0.906596,  0.909168,  0.911706,  0.914210,  0.916679,  0.919114,  0.921514,
-	 0.923880,  0.926210,  0.928506,  0.930767,  0.932993,  0.935184,  0.937339,  0.939459,
-	 0.941544,  0.943593,  0.945607,  0.947586,  0.949528,  0.951435,  0.953306,  0.955141,
-	 0.956940,  0.958703,  0.960431,  0.962121,  0.963776,  0.965394,  0.966976,  0.968522,
-	 0.970031,  0.971504,  0.972940,  0.974339,  0.975702,  0.977028,  0.978317,  0.979570,
-	 0.980785,  0.981964,  0.983105,  0.984210,  0.985278,  0.986308,  0.987301,  0.988258,
-	 0.989177,  0.990058,  0.990903,  0.991710,  0.992480,  0.993212,  0.993907,  0.994565,
-	 0.995185,  0.995767,  0.996313,  0.996820,  0.997290,  0.997723,  0.998118,  0.998476,
-	 0.998795,  0.999078,  0.999322,  0.999529,  0.999699,  0.999831,  0.999925,  0.999981
-};
+	Mutex _mutex;
 
-static const float cosTable2048[1024] = {
-	 1.000000,  0.999995,  0.999981,  0.999958,  0.999925,  0.999882,  0.999831,  0.999769,
-	 0.999699,  0.999619,  0.999529,  0.999431,  0.999322,  0.999205,  0.999078,  0.998941,
-	 0.998795,  0.998640,  0.998476,  0.998302,  0.998118,  0.997925,  0.997723,  0.997511,
-	 0.997290,  0.997060,  0.996820,  0.996571,  0.996313,  0.996045,  0.995767,  0.995481,
-	 0.995185,  0.994879,  0.994565,  0.994240,  0.993907,  0.993564,  0.993212,  0.992850,
-	 0.992480,  0.992099,  0.991710,  0.991311,  0.990903,  0.990485,  0.990058,  0.989622,
-	 0.989177,  0.988722,  0.988258,  0.987784,  0.987301,  0.986809,  0.986308,  0.985798,
-	 0.985278,  0.984748,  0.984210,  0.983662,  0.983105,  0.982539,  0.981964,  0.981379,
-	 0.980785,  0.980182,  0.979570,  0.978948,  0.978317,  0.977677,  0.977028,  0.976370,
-	 0.975702,  0.975025,  0.974339,  0.973644,  0.972940,  0.972227,  0.971504,  0.970772,
-	 0.970031,  0.969281,  0.968522,  0.967754,  0.966976,  0.966190,  0.965394,  0.964590,
-	 0.963776,  0.962953,  0.962121,  0.961280,  0.960431,  0.959572,  0.958703,  0.957826,
-	 0.956940,  0.956045,  0.955141,  0.954228,  0.953306,  0.952375,  0.951435,  0.950486,
-	 0.949528,  0.948561,  0.947586,  0.946601,  0.945607,  0.944605,  0.943593,  0.942573,
-	 0.941544,  0.940506,  0.939459,  0.938404,  0.937339,  0.936266,  0.935184,  0.934093,
-	 0.932993,  0.931884,  0.930767,  0.929641,  0.928506,  0.927363,  0.926210,  0.925049,
-	 0.923880,  0.922701,  0.921514,  0.920318,  0.919114,  0.917901,  0.916679,  0.915449,
-	 0.914210,  0.912962,  0.911706,  0.910441,  0.909168,  0.907886,  0.906596,  0.905297,
-	 0.903989,  0.902673,  0.901349,  0.900016,  0.898674,  0.897325,  0.895966,  0.894599,
-	 0.893224,  0.891841,  0.890449,  0.889048,  0.887640,  0.886223,  0.884797,  0.883363,
-	 0.881921,  0.880471,  0.879012,  0.877545,  0.876070,  0.874587,  0.873095,  0.871595,
-	 0.870087,  0.868571,  0.867046,  0.865514,  0.863973,  0.862424,  0.860867,  0.859302,
-	 0.857729,  0.856147,  0.854558,  0.852961,  0.851355,  0.849742,  0.848120,  0.846491,
-	 0.844854,  0.843208,  0.841555,  0.839894,  0.838225,  0.836548,  0.834863,  0.833170,
-	 0.831470,  0.829761,  0.828045,  0.826321,  0.824589,  0.822850,  0.821102,  0.819348,
-	 0.817585,  0.815814,  0.814036,  0.812251,  0.810457,  0.808656,  0.806848,  0.805031,
-	 0.803208,  0.801376,  0.799537,  0.797691,  0.795837,  0.793975,  0.792107,  0.790230,
-	 0.788346,  0.786455,  0.784557,  0.782651,  0.780737,  0.778817,  0.776888,  0.774953,
-	 0.773010,  0.771061,  0.769103,  0.767139,  0.765167,  0.763188,  0.761202,  0.759209,
-	 0.757209,  0.755201,  0.753187,  0.751165,  0.749136,  0.747101,  0.745058,  0.743008,
-	 0.740951,  0.738887,  0.736817,  0.734739,  0.732654,  0.730563,  0.728464,  0.726359,
-	 0.724247,  0.722128,  0.720003,  0.717870,  0.715731,  0.713585,  0.711432,  0.709273,
-	 0.707107,  0.704934,  0.702755,  0.700569,  0.698376,  0.696177,  0.693971,  0.691759,
-	 0.689541,  0.687315,  0.685084,  0.682846,  0.680601,  0.678350,  0.676093,  0.673829,
-	 0.671559,  0.669283,  0.667000,  0.664711,  0.662416,  0.660114,  0.657807,  0.655493,
-	 0.653173,  0.650847,  0.648514,  0.646176,  0.643832,  0.641481,  0.639124,  0.636762,
-	 0.634393,  0.632019,  0.629638,  0.627252,  0.624860,  0.622461,  0.620057,  0.617647,
-	 0.615232,  0.612810,  0.610383,  0.607950,  0.605511,  0.603067,  0.600616,  0.598161,
-	 0.595699,  0.593232,  0.590760,  0.588282,  0.585798,  0.583309,  0.580814,  0.578314,
-	 0.575808,  0.573297,  0.570781,  0.568259,  0.565732,  0.563199,  0.560662,  0.558119,
-	 0.555570,  0.553017,  0.550458,  0.547894,  0.545325,  0.542751,  0.540171,  0.537587,
-	 0.534998,  0.532403,  0.529804,  0.527199,  0.524590,  0.521975,  0.519356,  0.516732,
-	 0.514103,  0.511469,  0.508830,  0.506187,  0.503538,  0.500885,  0.498228,  0.495565,
-	 0.492898,  0.490226,  0.487550,  0.484869,  0.482184,  0.479494,  0.476799,  0.474100,
-	 0.471397,  0.468689,  0.465977,  0.463260,  0.460539,  0.457813,  0.455084,  0.452350,
-	 0.449611,  0.446869,  0.444122,  0.441371,  0.438616,  0.435857,  0.433094,  0.430326,
-	 0.427555,  0.424780,  0.422000,  0.419217,  0.416430,  0.413638,  0.410843,  0.408044,
-	 0.405241,  0.402435,  0.399624,  0.396810,  0.393992,  0.391170,  0.388345,  0.385516,
-	 0.382683,  0.379847,  0.377007,  0.374164,  0.371317,  0.368467,  0.365613,  0.362756,
-	 0.359895,  0.357031,  0.354164,  0.351293,  0.348419,  0.345541,  0.342661,  0.339777,
-	 0.336890,  0.334000,  0.331106,  0.328210,  0.325310,  0.322408,  0.319502,  0.316593,
-	 0.313682,  0.310767,  0.307850,  0.304929,  0.302006,  0.299080,  0.296151,  0.293219,
-	 0.290285,  0.287347,  0.284408,  0.281465,  0.278520,  0.275572,  0.272621,  0.269668,
-	 0.266713,  0.263755,  0.260794,  0.257831,  0.254866,  0.251898,  0.248928,  0.245955,
-	 0.242980,  0.240003,  0.237024,  0.234042,  0.231058,  0.228072,  0.225084,  0.222094,
-	 0.219101,  0.216107,  0.213110,  0.210112,  0.207111,  0.204109,  0.201105,  0.198098,
-	 0.195090,  0.192080,  0.189069,  0.186055,  0.183040,  0.180023,  0.177004,  0.173984,
-	 0.170962,  0.167938,  0.164913,  0.161886,  0.158858,  0.155828,  0.152797,  0.149765,
-	 0.146730,  0.143695,  0.140658,  0.137620,  0.134581,  0.131540,  0.128498,  0.125455,
-	 0.122411,  0.119365,  0.116319,  0.113271,  0.110222,  0.107172,  0.104122,  0.101070,
-	 0.098017,  0.094963,  0.091909,  0.088854,  0.085797,  0.082740,  0.079682,  0.076624,
-	 0.073565,  0.070505,  0.067444,  0.064383,  0.061321,  0.058258,  0.055195,  0.052132,
-	 0.049068,  0.046003,  0.042938,  0.039873,  0.036807,  0.033741,  0.030675,  0.027608,
-	 0.024541,  0.021474,  0.018407,  0.015339,  0.012272,  0.009204,  0.006136,  0.003068,
-	 0.000000,  0.003068,  0.006136,  0.009204,  0.012272,  0.015339,  0.018407,  0.021474,
-	 0.024541,  0.027608,  0.030675,  0.033741,  0.036807,  0.039873,  0.042938,  0.046003,
-	 0.049068,  0.052132,  0.055195,  0.058258,  0.061321,  0.064383,  0.067444,  0.070505,
-	 0.073565,  0.076624,  0.079682,  0.082740,  0.085797,  0.088854,  0.091909,  0.094963,
-	 0.098017,  0.101070,  0.104122,  0.107172,  0.110222,  0.113271,  0.116319,  0.119365,
-	 0.122411,  0.125455,  0.128498,  0.131540,  0.134581,  0.137620,  0.140658,  0.143695,
-	 0.146730,  0.149765,  0.152797,  0.155828,  0.158858,  0.161886,  0.164913,  0.167938,
-	 0.170962,  0.173984,  0.177004,  0.180023,  0.183040,  0.186055,  0.189069,  0.192080,
-	 0.195090,  0.198098,  0.201105,  0.204109,  0.207111,  0.210112,  0.213110,  0.216107,
-	 0.219101,  0.222094,  0.225084,  0.228072,  0.231058,  0.234042,  0.237024,  0.240003,
-	 0.242980,  0.245955,  0.248928,  0.251898,  0.254866,  0.257831,  0.260794,  0.263755,
-	 0.266713,  0.269668,  0.272621,  0.275572,  0.278520,  0.281465,  0.284408,  0.287347,
-	 0.290285,  0.293219,  0.296151,  0.299080,  0.302006,  0.304929,  0.307850,  0.310767,
-	 0.313682,  0.316593,  0.319502,  0.322408,  0.325310,  0.328210,  0.331106,  0.334000,
-	 0.336890,  0.339777,  0.342661,  0.345541,  0.348419,  0.351293,  0.354164,  0.357031,
-	 0.359895,  0.362756,  0.365613,  0.368467,  0.371317,  0.374164,  0.377007,  0.379847,
-	 0.382683,  0.385516,  0.388345,  0.391170,  0.393992,  0.396810,  0.399624,  0.402435,
-	 0.405241,  0.408044,  0.410843,  0.413638,  0.416430,  0.419217,  0.422000,  0.424780,
-	 0.427555,  0.430326,  0.433094,  0.435857,  0.438616,  0.441371,  0.444122,  0.446869,
-	 0.449611,  0.452350,  0.455084,  0.457813,  0.460539,  0.463260,  0.465977,  0.468689,
-	 0.471397,  0.474100,  0.476799,  0.479494,  0.482184,  0.484869,  0.487550,  0.490226,
-	 0.492898,  0.495565,  0.498228,  0.500885,  0.503538,  0.506187,  0.508830,  0.511469,
-	 0.514103,  0.516732,  0.519356,  0.521975,  0.524590,  0.527199,  0.529804,  0.532403,
-	 0.534998,  0.537587,  0.540171,  0.542751,  0.545325,  0.547894,  0.550458,  0.553017,
-	 0.555570,  0.558119,  0.560662,  0.563199,  0.565732,  0.568259,  0.570781,  0.573297,
-	 0.575808,  0.578314,  0.580814,  0.583309,  0.585798,  0.588282,  0.590760,  0.593232,
-	 0.595699,  0.598161,  0.600616,  0.603067,  0.605511,  0.607950,  0.610383,  0.612810,
-	 0.615232,  0.617647,  0.620057,  0.622461,  0.624860,  0.627252,  0.629638,  0.632019,
-	 0.634393,  0.636762,  0.639124,  0.641481,  0.643832,  0.646176,  0.648514,  0.650847,
-	 0.653173,  0.655493,  0.657807,  0.660114,  0.662416,  0.664711,  0.667000,  0.669283,
-	 0.671559,  0.673829,  0.676093,  0.678350,  0.680601,  0.682846,  0.685084,  0.687315,
-	 0.689541,  0.691759,  0.693971,  0.696177,  0.698376,  0.700569,  0.702755,  0.704934,
-	 0.707107,  0.709273,  0.711432,  0.713585,  0.715731,  0.717870,  0.720003,  0.722128,
-	 0.724247,  0.726359,  0.728464,  0.730563,  0.732654,  0.734739,  0.736817,  0.738887,
-	 0.740951,  0.743008,  0.745058,  0.747101,  0.749136,  0.751165,  0.753187,  0.755201,
-	 0.757209,  0.759209,  0.761202,  0.763188,  0.765167,  0.767139,  0.769103,  0.771061,
-	 0.773010,  0.774953,  0.776888,  0.778817,  0.780737,  0.782651,  0.784557,  0.786455,
-	 0.788346,  0.790230,  0.792107,  0.793975,  0.795837,  0.797691,  0.799537,  0.801376,
-	 0.803208,  0.805031,  0.806848,  0.808656,  0.810457,  0.812251,  0.814036,  0.815814,
-	 0.817585,  0.819348,  0.821102,  0.822850,  0.824589,  0.826321,  0.828045,  0.829761,
-	 0.831470,  0.833170,  0.834863,  0.836548,  0.838225,  0.839894,  0.841555,  0.843208,
-	 0.844854,  0.846491,  0.848120,  0.849742,  0.851355,  0.852961,  0.854558,  0.856147,
-	 0.857729,  0.859302,  0.860867,  0.862424,  0.863973,  0.865514,  0.867046,  0.868571,
-	 0.870087,  0.871595,  0.873095,  0.874587,  0.876070,  0.877545,  0.879012,  0.880471,
-	 0.881921,  0.883363,  0.884797,  0.886223,  0.887640,  0.889048,  0.890449,  0.891841,
-	 0.893224,  0.894599,  0.895966,  0.897325,  0.898674,  0.900016,  0.901349,  0.902673,
-	 0.903989,  0.905297,  0.906596,  0.907886,  0.909168,  0.910441,  0.911706,  0.912962,
-	 0.914210,  0.915449,  0.916679,  0.917901,  0.919114,  0.920318,  0.921514,  0.922701,
-	 0.923880,  0.925049,  0.926210,  0.927363,  0.928506,  0.929641,  0.930767,  0.931884,
-	 0.932993,  0.934093,  0.935184,  0.936266,  0.937339,  0.938404,  0.939459,  0.940506,
-	 0.941544,  0.942573,  0.943593,  0.944605,  0.945607,  0.946601,  0.947586,  0.948561,
-	 0.949528,  0.950486,  0.951435,  0.952375,  0.953306,  0.954228,  0.955141,  0.956045,
-	 0.956940,  0.957826,  0.958703,  0.959572,  0.960431,  0.961280,  0.962121,  0.962953,
-	 0.963776,  0.964590,  0.965394,  0.966190,  0.966976,  0.967754,  0.968522,  0.969281,
-	 0.970031,  0.970772,  0.971504,  0.972227,  0.972940,  0.973644,  0.974339,  0.975025,
-	 0.975702,  0.976370,  0.977028,  0.977677,  0.978317,  0.978948,  0.979570,  0.980182,
-	 0.980785,  0.981379,  0.981964,  0.982539,  0.983105,  0.983662,  0.984210,  0.984748,
-	 0.985278,  0.985798,  0.986308,  0.986809,  0.987301,  0.987784,  0.988258,  0.988722,
-	 0.989177,  0.989622,  0.990058,  0.990485,  0.990903,  0.991311,  0.991710,  0.992099,
-	 0.992480,  0.992850,  0.993212,  0.993564,  0.993907,  0.994240,  0.994565,  0.994879,
-	 0.995185,  0.995481,  0.995767,  0.996045,  0.996313,  0.996571,  0.996820,  0.997060,
-	 0.997290,  0.997511,  0.997723,  0.997925,  0.998118,  0.998302,  0.998476,  0.998640,
-	 0.998795,  0.998941,  0.999078,  0.999205,  0.999322,  0.999431,  0.999529,  0.999619,
-	 0.999699,  0.999769,  0.999831,  0.999882,  0.999925,  0.999958,  0.999981,  0.999995
-};
+	void generate(int bits) {
+		const int n = 1 << bits;
 
-static const float cosTable4096[2048] = {
-	 1.000000,  0.999999,  0.999995,  0.999989,  0.999981,  0.999971,  0.999958,  0.999942,
-	 0.999925,  0.999905,  0.999882,  0.999858,  0.999831,  0.999801,  0.999769,  0.999735,
-	 0.999699,  0.999660,  0.999619,  0.999575,  0.999529,  0.999481,  0.999431,  0.999378,
-	 0.999322,  0.999265,  0.999205,  0.999142,  0.999078,  0.999011,  0.998941,  0.998870,
-	 0.998795,  0.998719,  0.998640,  0.998559,  0.998476,  0.998390,  0.998302,  0.998211,
-	 0.998118,  0.998023,  0.997925,  0.997825,  0.997723,  0.997618,  0.997511,  0.997402,
-	 0.997290,  0.997176,  0.997060,  0.996941,  0.996820,  0.996697,  0.996571,  0.996443,
-	 0.996313,  0.996180,  0.996045,  0.995907,  0.995767,  0.995625,  0.995481,  0.995334,
-	 0.995185,  0.995033,  0.994879,  0.994723,  0.994565,  0.994404,  0.994240,  0.994075,
-	 0.993907,  0.993737,  0.993564,  0.993389,  0.993212,  0.993032,  0.992850,  0.992666,
-	 0.992480,  0.992291,  0.992099,  0.991906,  0.991710,  0.991511,  0.991311,  0.991108,
-	 0.990903,  0.990695,  0.990485,  0.990273,  0.990058,  0.989841,  0.989622,  0.989400,
-	 0.989177,  0.988950,  0.988722,  0.988491,  0.988258,  0.988022,  0.987784,  0.987544,
-	 0.987301,  0.987057,  0.986809,  0.986560,  0.986308,  0.986054,  0.985798,  0.985539,
-	 0.985278,  0.985014,  0.984748,  0.984480,  0.984210,  0.983937,  0.983662,  0.983385,
-	 0.983105,  0.982824,  0.982539,  0.982253,  0.981964,  0.981673,  0.981379,  0.981083,
-	 0.980785,  0.980485,  0.980182,  0.979877,  0.979570,  0.979260,  0.978948,  0.978634,
-	 0.978317,  0.977998,  0.977677,  0.977354,  0.977028,  0.976700,  0.976370,  0.976037,
-	 0.975702,  0.975365,  0.975025,  0.974684,  0.974339,  0.973993,  0.973644,  0.973293,
-	 0.972940,  0.972584,  0.972227,  0.971866,  0.971504,  0.971139,  0.970772,  0.970403,
-	 0.970031,  0.969657,  0.969281,  0.968903,  0.968522,  0.968139,  0.967754,  0.967366,
-	 0.966976,  0.966584,  0.966190,  0.965793,  0.965394,  0.964993,  0.964590,  0.964184,
-	 0.963776,  0.963366,  0.962953,  0.962538,  0.962121,  0.961702,  0.961280,  0.960857,
-	 0.960431,  0.960002,  0.959572,  0.959139,  0.958703,  0.958266,  0.957826,  0.957385,
-	 0.956940,  0.956494,  0.956045,  0.955594,  0.955141,  0.954686,  0.954228,  0.953768,
-	 0.953306,  0.952842,  0.952375,  0.951906,  0.951435,  0.950962,  0.950486,  0.950008,
-	 0.949528,  0.949046,  0.948561,  0.948075,  0.947586,  0.947094,  0.946601,  0.946105,
-	 0.945607,  0.945107,  0.944605,  0.944100,  0.943593,  0.943084,  0.942573,  0.942060,
-	 0.941544,  0.941026,  0.940506,  0.939984,  0.939459,  0.938932,  0.938404,  0.937872,
-	 0.937339,  0.936803,  0.936266,  0.935726,  0.935184,  0.934639,  0.934093,  0.933544,
-	 0.932993,  0.932440,  0.931884,  0.931327,  0.930767,  0.930205,  0.929641,  0.929075,
-	 0.928506,  0.927935,  0.927363,  0.926787,  0.926210,  0.925631,  0.925049,  0.924465,
-	 0.923880,  0.923291,  0.922701,  0.922109,  0.921514,  0.920917,  0.920318,  0.919717,
-	 0.919114,  0.918508,  0.917901,  0.917291,  0.916679,  0.916065,  0.915449,  0.914830,
-	 0.914210,  0.913587,  0.912962,  0.912335,  0.911706,  0.911075,  0.910441,  0.909806,
-	 0.909168,  0.908528,  0.907886,  0.907242,  0.906596,  0.905947,  0.905297,  0.904644,
-	 0.903989,  0.903332,  0.902673,  0.902012,  0.901349,  0.900683,  0.900016,  0.899346,
-	 0.898674,  0.898001,  0.897325,  0.896646,  0.895966,  0.895284,  0.894599,  0.893913,
-	 0.893224,  0.892534,  0.891841,  0.891146,  0.890449,  0.889750,  0.889048,  0.888345,
-	 0.887640,  0.886932,  0.886223,  0.885511,  0.884797,  0.884081,  0.883363,  0.882643,
-	 0.881921,  0.881197,  0.880471,  0.879743,  0.879012,  0.878280,  0.877545,  0.876809,
-	 0.876070,  0.875329,  0.874587,  0.873842,  0.873095,  0.872346,  0.871595,  0.870842,
-	 0.870087,  0.869330,  0.868571,  0.867809,  0.867046,  0.866281,  0.865514,  0.864744,
-	 0.863973,  0.863199,  0.862424,  0.861646,  0.860867,  0.860085,  0.859302,  0.858516,
-	 0.857729,  0.856939,  0.856147,  0.855354,  0.854558,  0.853760,  0.852961,  0.852159,
-	 0.851355,  0.850549,  0.849742,  0.848932,  0.848120,  0.847307,  0.846491,  0.845673,
-	 0.844854,  0.844032,  0.843208,  0.842383,  0.841555,  0.840725,  0.839894,  0.839060,
-	 0.838225,  0.837387,  0.836548,  0.835706,  0.834863,  0.834018,  0.833170,  0.832321,
-	 0.831470,  0.830616,  0.829761,  0.828904,  0.828045,  0.827184,  0.826321,  0.825456,
-	 0.824589,  0.823721,  0.822850,  0.821977,  0.821102,  0.820226,  0.819348,  0.818467,
-	 0.817585,  0.816701,  0.815814,  0.814926,  0.814036,  0.813144,  0.812251,  0.811355,
-	 0.810457,  0.809558,  0.808656,  0.807753,  0.806848,  0.805940,  0.805031,  0.804120,
-	 0.803208,  0.802293,  0.801376,  0.800458,  0.799537,  0.798615,  0.797691,  0.796765,
-	 0.795837,  0.794907,  0.793975,  0.793042,  0.792107,  0.791169,  0.790230,  0.789289,
-	 0.788346,  0.787402,  0.786455,  0.785507,  0.784557,  0.783605,  0.782651,  0.781695,
-	 0.780737,  0.779778,  0.778817,  0.777853,  0.776888,  0.775922,  0.774953,  0.773983,
-	 0.773010,  0.772036,  0.771061,  0.770083,  0.769103,  0.768122,  0.767139,  0.766154,
-	 0.765167,  0.764179,  0.763188,  0.762196,  0.761202,  0.760207,  0.759209,  0.758210,
-	 0.757209,  0.756206,  0.755201,  0.754195,  0.753187,  0.752177,  0.751165,  0.750152,
-	 0.749136,  0.748119,  0.747101,  0.746080,  0.745058,  0.744034,  0.743008,  0.741980,
-	 0.740951,  0.739920,  0.738887,  0.737853,  0.736817,  0.735779,  0.734739,  0.733697,
-	 0.732654,  0.731609,  0.730563,  0.729514,  0.728464,  0.727413,  0.726359,  0.725304,
-	 0.724247,  0.723188,  0.722128,  0.721066,  0.720003,  0.718937,  0.717870,  0.716801,
-	 0.715731,  0.714659,  0.713585,  0.712509,  0.711432,  0.710353,  0.709273,  0.708191,
-	 0.707107,  0.706021,  0.704934,  0.703845,  0.702755,  0.701663,  0.700569,  0.699473,
-	 0.698376,  0.697277,  0.696177,  0.695075,  0.693971,  0.692866,  0.691759,  0.690651,
-	 0.689541,  0.688429,  0.687315,  0.686200,  0.685084,  0.683965,  0.682846,  0.681724,
-	 0.680601,  0.679476,  0.678350,  0.677222,  0.676093,  0.674962,  0.673829,  0.672695,
-	 0.671559,  0.670422,  0.669283,  0.668142,  0.667000,  0.665856,  0.664711,  0.663564,
-	 0.662416,  0.661266,  0.660114,  0.658961,  0.657807,  0.656651,  0.655493,  0.654334,
-	 0.653173,  0.652011,  0.650847,  0.649681,  0.648514,  0.647346,  0.646176,  0.645005,
-	 0.643832,  0.642657,  0.641481,  0.640303,  0.639124,  0.637944,  0.636762,  0.635578,
-	 0.634393,  0.633207,  0.632019,  0.630829,  0.629638,  0.628446,  0.627252,  0.626056,
-	 0.624860,  0.623661,  0.622461,  0.621260,  0.620057,  0.618853,  0.617647,  0.616440,
-	 0.615232,  0.614022,  0.612810,  0.611597,  0.610383,  0.609167,  0.607950,  0.606731,
-	 0.605511,  0.604290,  0.603067,  0.601842,  0.600616,  0.599389,  0.598161,  0.596931,
-	 0.595699,  0.594467,  0.593232,  0.591997,  0.590760,  0.589521,  0.588282,  0.587040,
-	 0.585798,  0.584554,  0.583309,  0.582062,  0.580814,  0.579565,  0.578314,  0.577062,
-	 0.575808,  0.574553,  0.573297,  0.572040,  0.570781,  0.569521,  0.568259,  0.566996,
-	 0.565732,  0.564466,  0.563199,  0.561931,  0.560662,  0.559391,  0.558119,  0.556845,
-	 0.555570,  0.554294,  0.553017,  0.551738,  0.550458,  0.549177,  0.547894,  0.546610,
-	 0.545325,  0.544039,  0.542751,  0.541462,  0.540171,  0.538880,  0.537587,  0.536293,
-	 0.534998,  0.533701,  0.532403,  0.531104,  0.529804,  0.528502,  0.527199,  0.525895,
-	 0.524590,  0.523283,  0.521975,  0.520666,  0.519356,  0.518045,  0.516732,  0.515418,
-	 0.514103,  0.512786,  0.511469,  0.510150,  0.508830,  0.507509,  0.506187,  0.504863,
-	 0.503538,  0.502212,  0.500885,  0.499557,  0.498228,  0.496897,  0.495565,  0.494232,
-	 0.492898,  0.491563,  0.490226,  0.488889,  0.487550,  0.486210,  0.484869,  0.483527,
-	 0.482184,  0.480839,  0.479494,  0.478147,  0.476799,  0.475450,  0.474100,  0.472749,
-	 0.471397,  0.470043,  0.468689,  0.467333,  0.465977,  0.464619,  0.463260,  0.461900,
-	 0.460539,  0.459177,  0.457813,  0.456449,  0.455084,  0.453717,  0.452350,  0.450981,
-	 0.449611,  0.448241,  0.446869,  0.445496,  0.444122,  0.442747,  0.441371,  0.439994,
-	 0.438616,  0.437237,  0.435857,  0.434476,  0.433094,  0.431711,  0.430326,  0.428941,
-	 0.427555,  0.426168,  0.424780,  0.423390,  0.422000,  0.420609,  0.419217,  0.417824,
-	 0.416430,  0.415034,  0.413638,  0.412241,  0.410843,  0.409444,  0.408044,  0.406643,
-	 0.405241,  0.403838,  0.402435,  0.401030,  0.399624,  0.398218,  0.396810,  0.395401,
-	 0.393992,  0.392582,  0.391170,  0.389758,  0.388345,  0.386931,  0.385516,  0.384100,
-	 0.382683,  0.381266,  0.379847,  0.378428,  0.377007,  0.375586,  0.374164,  0.372741,
-	 0.371317,  0.369892,  0.368467,  0.367040,  0.365613,  0.364185,  0.362756,  0.361326,
-	 0.359895,  0.358463,  0.357031,  0.355598,  0.354164,  0.352729,  0.351293,  0.349856,
-	 0.348419,  0.346980,  0.345541,  0.344101,  0.342661,  0.341219,  0.339777,  0.338334,
-	 0.336890,  0.335445,  0.334000,  0.332553,  0.331106,  0.329658,  0.328210,  0.326760,
-	 0.325310,  0.323859,  0.322408,  0.320955,  0.319502,  0.318048,  0.316593,  0.315138,
-	 0.313682,  0.312225,  0.310767,  0.309309,  0.307850,  0.306390,  0.304929,  0.303468,
-	 0.302006,  0.300543,  0.299080,  0.297616,  0.296151,  0.294685,  0.293219,  0.291752,
-	 0.290285,  0.288816,  0.287347,  0.285878,  0.284408,  0.282937,  0.281465,  0.279993,
-	 0.278520,  0.277046,  0.275572,  0.274097,  0.272621,  0.271145,  0.269668,  0.268191,
-	 0.266713,  0.265234,  0.263755,  0.262275,  0.260794,  0.259313,  0.257831,  0.256349,
-	 0.254866,  0.253382,  0.251898,  0.250413,  0.248928,  0.247442,  0.245955,  0.244468,
-	 0.242980,  0.241492,  0.240003,  0.238514,  0.237024,  0.235533,  0.234042,  0.232550,
-	 0.231058,  0.229565,  0.228072,  0.226578,  0.225084,  0.223589,  0.222094,  0.220598,
-	 0.219101,  0.217604,  0.216107,  0.214609,  0.213110,  0.211611,  0.210112,  0.208612,
-	 0.207111,  0.205610,  0.204109,  0.202607,  0.201105,  0.199602,  0.198098,  0.196595,
-	 0.195090,  0.193586,  0.192080,  0.190575,  0.189069,  0.187562,  0.186055,  0.184548,
-	 0.183040,  0.181532,  0.180023,  0.178514,  0.177004,  0.175494,  0.173984,  0.172473,
-	 0.170962,  0.169450,  0.167938,  0.166426,  0.164913,  0.163400,  0.161886,  0.160372,
-	 0.158858,  0.157343,  0.155828,  0.154313,  0.152797,  0.151281,  0.149765,  0.148248,
-	 0.146730,  0.145213,  0.143695,  0.142177,  0.140658,  0.139139,  0.137620,  0.136101,
-	 0.134581,  0.133061,  0.131540,  0.130019,  0.128498,  0.126977,  0.125455,  0.123933,
-	 0.122411,  0.120888,  0.119365,  0.117842,  0.116319,  0.114795,  0.113271,  0.111747,
-	 0.110222,  0.108697,  0.107172,  0.105647,  0.104122,  0.102596,  0.101070,  0.099544,
-	 0.098017,  0.096490,  0.094963,  0.093436,  0.091909,  0.090381,  0.088854,  0.087326,
-	 0.085797,  0.084269,  0.082740,  0.081211,  0.079682,  0.078153,  0.076624,  0.075094,
-	 0.073565,  0.072035,  0.070505,  0.068974,  0.067444,  0.065913,  0.064383,  0.062852,
-	 0.061321,  0.059790,  0.058258,  0.056727,  0.055195,  0.053664,  0.052132,  0.050600,
-	 0.049068,  0.047535,  0.046003,  0.044471,  0.042938,  0.041406,  0.039873,  0.038340,
-	 0.036807,  0.035274,  0.033741,  0.032208,  0.030675,  0.029142,  0.027608,  0.026075,
-	 0.024541,  0.023008,  0.021474,  0.019940,  0.018407,  0.016873,  0.015339,  0.013805,
-	 0.012272,  0.010738,  0.009204,  0.007670,  0.006136,  0.004602,  0.003068,  0.001534,
-	 0.000000,  0.001534,  0.003068,  0.004602,  0.006136,  0.007670,  0.009204,  0.010738,
-	 0.012272,  0.013805,  0.015339,  0.016873,  0.018407,  0.019940,  0.021474,  0.023008,
-	 0.024541,  0.026075,  0.027608,  0.029142,  0.030675,  0.032208,  0.033741,  0.035274,
-	 0.036807,  0.038340,  0.039873,  0.041406,  0.042938,  0.044471,  0.046003,  0.047535,
-	 0.049068,  0.050600,  0.052132,  0.053664,  0.055195,  0.056727,  0.058258,  0.059790,
-	 0.061321,  0.062852,  0.064383,  0.065913,  0.067444,  0.068974,  0.070505,  0.072035,
-	 0.073565,  0.075094,  0.076624,  0.078153,  0.079682,  0.081211,  0.082740,  0.084269,
-	 0.085797,  0.087326,  0.088854,  0.090381,  0.091909,  0.093436,  0.094963,  0.096490,
-	 0.098017,  0.099544,  0.101070,  0.102596,  0.104122,  0.105647,  0.107172,  0.108697,
-	 0.110222,  0.111747,  0.113271,  0.114795,  0.116319,  0.117842,  0.119365,  0.120888,
-	 0.122411,  0.123933,  0.125455,  0.126977,  0.128498,  0.130019,  0.131540,  0.133061,
-	 0.134581,  0.136101,  0.137620,  0.139139,  0.140658,  0.142177,  0.143695,  0.145213,
-	 0.146730,  0.148248,  0.149765,  0.151281,  0.152797,  0.154313,  0.155828,  0.157343,
-	 0.158858,  0.160372,  0.161886,  0.163400,  0.164913,  0.166426,  0.167938,  0.169450,
-	 0.170962,  0.172473,  0.173984,  0.175494,  0.177004,  0.178514,  0.180023,  0.181532,
-	 0.183040,  0.184548,  0.186055,  0.187562,  0.189069,  0.190575,  0.192080,  0.193586,
-	 0.195090,  0.196595,  0.198098,  0.199602,  0.201105,  0.202607,  0.204109,  0.205610,
-	 0.207111,  0.208612,  0.210112,  0.211611,  0.213110,  0.214609,  0.216107,  0.217604,
-	 0.219101,  0.220598,  0.222094,  0.223589,  0.225084,  0.226578,  0.228072,  0.229565,
-	 0.231058,  0.232550,  0.234042,  0.235533,  0.237024,  0.238514,  0.240003,  0.241492,
-	 0.242980,  0.244468,  0.245955,  0.247442,  0.248928,  0.250413,  0.251898,  0.253382,
-	 0.254866,  0.256349,  0.257831,  0.259313,  0.260794,  0.262275,  0.263755,  0.265234,
-	 0.266713,  0.268191,  0.269668,  0.271145,  0.272621,  0.274097,  0.275572,  0.277046,
-	 0.278520,  0.279993,  0.281465,  0.282937,  0.284408,  0.285878,  0.287347,  0.288816,
-	 0.290285,  0.291752,  0.293219,  0.294685,  0.296151,  0.297616,  0.299080,  0.300543,
-	 0.302006,  0.303468,  0.304929,  0.306390,  0.307850,  0.309309,  0.310767,  0.312225,
-	 0.313682,  0.315138,  0.316593,  0.318048,  0.319502,  0.320955,  0.322408,  0.323859,
-	 0.325310,  0.326760,  0.328210,  0.329658,  0.331106,  0.332553,  0.334000,  0.335445,
-	 0.336890,  0.338334,  0.339777,  0.341219,  0.342661,  0.344101,  0.345541,  0.346980,
-	 0.348419,  0.349856,  0.351293,  0.352729,  0.354164,  0.355598,  0.357031,  0.358463,
-	 0.359895,  0.361326,  0.362756,  0.364185,  0.365613,  0.367040,  0.368467,  0.369892,
-	 0.371317,  0.372741,  0.374164,  0.375586,  0.377007,  0.378428,  0.379847,  0.381266,
-	 0.382683,  0.384100,  0.385516,  0.386931,  0.388345,  0.389758,  0.391170,  0.392582,
-	 0.393992,  0.395401,  0.396810,  0.398218,  0.399624,  0.401030,  0.402435,  0.403838,
-	 0.405241,  0.406643,  0.408044,  0.409444,  0.410843,  0.412241,  0.413638,  0.415034,
-	 0.416430,  0.417824,  0.419217,  0.420609,  0.422000,  0.423390,  0.424780,  0.426168,
-	 0.427555,  0.428941,  0.430326,  0.431711,  0.433094,  0.434476,  0.435857,  0.437237,
-	 0.438616,  0.439994,  0.441371,  0.442747,  0.444122,  0.445496,  0.446869,  0.448241,
-	 0.449611,  0.450981,  0.452350,  0.453717,  0.455084,  0.456449,  0.457813,  0.459177,
-	 0.460539,  0.461900,  0.463260,  0.464619,  0.465977,  0.467333,  0.468689,  0.470043,
-	 0.471397,  0.472749,  0.474100,  0.475450,  0.476799,  0.478147,  0.479494,  0.480839,
-	 0.482184,  0.483527,  0.484869,  0.486210,  0.487550,  0.488889,  0.490226,  0.491563,
-	 0.492898,  0.494232,  0.495565,  0.496897,  0.498228,  0.499557,  0.500885,  0.502212,
-	 0.503538,  0.504863,  0.506187,  0.507509,  0.508830,  0.510150,  0.511469,  0.512786,
-	 0.514103,  0.515418,  0.516732,  0.518045,  0.519356,  0.520666,  0.521975,  0.523283,
-	 0.524590,  0.525895,  0.527199,  0.528502,  0.529804,  0.531104,  0.532403,  0.533701,
-	 0.534998,  0.536293,  0.537587,  0.538880,  0.540171,  0.541462,  0.542751,  0.544039,
-	 0.545325,  0.546610,  0.547894,  0.549177,  0.550458,  0.551738,  0.553017,  0.554294,
-	 0.555570,  0.556845,  0.558119,  0.559391,  0.560662,  0.561931,  0.563199,  0.564466,
-	 0.565732,  0.566996,  0.568259,  0.569521,  0.570781,  0.572040,  0.573297,  0.574553,
-	 0.575808,  0.577062,  0.578314,  0.579565,  0.580814,  0.582062,  0.583309,  0.584554,
-	 0.585798,  0.587040,  0.588282,  0.589521,  0.590760,  0.591997,  0.593232,  0.594467,
-	 0.595699,  0.596931,  0.598161,  0.599389,  0.600616,  0.601842,  0.603067,  0.604290,
-	 0.605511,  0.606731,  0.607950,  0.609167,  0.610383,  0.611597,  0.612810,  0.614022,
-	 0.615232,  0.616440,  0.617647,  0.618853,  0.620057,  0.621260,  0.622461,  0.623661,
-	 0.624860,  0.626056,  0.627252,  0.628446,  0.629638,  0.630829,  0.632019,  0.633207,
-	 0.634393,  0.635578,  0.636762,  0.637944,  0.639124,  0.640303,  0.641481,  0.642657,
-	 0.643832,  0.645005,  0.646176,  0.647346,  0.648514,  0.649681,  0.650847,  0.652011,
-	 0.653173,  0.654334,  0.655493,  0.656651,  0.657807,  0.658961,  0.660114,  0.661266,
-	 0.662416,  0.663564,  0.664711,  0.665856,  0.667000,  0.668142,  0.669283,  0.670422,
-	 0.671559,  0.672695,  0.673829,  0.674962,  0.676093,  0.677222,  0.678350,  0.679476,
-	 0.680601,  0.681724,  0.682846,  0.683965,  0.685084,  0.686200,  0.687315,  0.688429,
-	 0.689541,  0.690651,  0.691759,  0.692866,  0.693971,  0.695075,  0.696177,  0.697277,
-	 0.698376,  0.699473,  0.700569,  0.701663,  0.702755,  0.703845,  0.704934,  0.706021,
-	 0.707107,  0.708191,  0.709273,  0.710353,  0.711432,  0.712509,  0.713585,  0.714659,
-	 0.715731,  0.716801,  0.717870,  0.718937,  0.720003,  0.721066,  0.722128,  0.723188,
-	 0.724247,  0.725304,  0.726359,  0.727413,  0.728464,  0.729514,  0.730563,  0.731609,
-	 0.732654,  0.733697,  0.734739,  0.735779,  0.736817,  0.737853,  0.738887,  0.739920,
-	 0.740951,  0.741980,  0.743008,  0.744034,  0.745058,  0.746080,  0.747101,  0.748119,
-	 0.749136,  0.750152,  0.751165,  0.752177,  0.753187,  0.754195,  0.755201,  0.756206,
-	 0.757209,  0.758210,  0.759209,  0.760207,  0.761202,  0.762196,  0.763188,  0.764179,
-	 0.765167,  0.766154,  0.767139,  0.768122,  0.769103,  0.770083,  0.771061,  0.772036,
-	 0.773010,  0.773983,  0.774953,  0.775922,  0.776888,  0.777853,  0.778817,  0.779778,
-	 0.780737,  0.781695,  0.782651,  0.783605,  0.784557,  0.785507,  0.786455,  0.787402,
-	 0.788346,  0.789289,  0.790230,  0.791169,  0.792107,  0.793042,  0.793975,  0.794907,
-	 0.795837,  0.796765,  0.797691,  0.798615,  0.799537,  0.800458,  0.801376,  0.802293,
-	 0.803208,  0.804120,  0.805031,  0.805940,  0.806848,  0.807753,  0.808656,  0.809558,
-	 0.810457,  0.811355,  0.812251,  0.813144,  0.814036,  0.814926,  0.815814,  0.816701,
-	 0.817585,  0.818467,  0.819348,  0.820226,  0.821102,  0.821977,  0.822850,  0.823721,
-	 0.824589,  0.825456,  0.826321,  0.827184,  0.828045,  0.828904,  0.829761,  0.830616,
-	 0.831470,  0.832321,  0.833170,  0.834018,  0.834863,  0.835706,  0.836548,  0.837387,
-	 0.838225,  0.839060,  0.839894,  0.840725,  0.841555,  0.842383,  0.843208,  0.844032,
-	 0.844854,  0.845673,  0.846491,  0.847307,  0.848120,  0.848932,  0.849742,  0.850549,
-	 0.851355,  0.852159,  0.852961,  0.853760,  0.854558,  0.855354,  0.856147,  0.856939,
-	 0.857729,  0.858516,  0.859302,  0.860085,  0.860867,  0.861646,  0.862424,  0.863199,
-	 0.863973,  0.864744,  0.865514,  0.866281,  0.867046,  0.867809,  0.868571,  0.869330,
-	 0.870087,  0.870842,  0.871595,  0.872346,  0.873095,  0.873842,  0.874587,  0.875329,
-	 0.876070,  0.876809,  0.877545,  0.878280,  0.879012,  0.879743,  0.880471,  0.881197,
-	 0.881921,  0.882643,  0.883363,  0.884081,  0.884797,  0.885511,  0.886223,  0.886932,
-	 0.887640,  0.888345,  0.889048,  0.889750,  0.890449,  0.891146,  0.891841,  0.892534,
-	 0.893224,  0.893913,  0.894599,  0.895284,  0.895966,  0.896646,  0.897325,  0.898001,
-	 0.898674,  0.899346,  0.900016,  0.900683,  0.901349,  0.902012,  0.902673,  0.903332,
-	 0.903989,  0.904644,  0.905297,  0.905947,  0.906596,  0.907242,  0.907886,  0.908528,
-	 0.909168,  0.909806,  0.910441,  0.911075,  0.911706,  0.912335,  0.912962,  0.913587,
-	 0.914210,  0.914830,  0.915449,  0.916065,  0.916679,  0.917291,  0.917901,  0.918508,
-	 0.919114,  0.919717,  0.920318,  0.920917,  0.921514,  0.922109,  0.922701,  0.923291,
-	 0.923880,  0.924465,  0.925049,  0.925631,  0.926210,  0.926787,  0.927363,  0.927935,
-	 0.928506,  0.929075,  0.929641,  0.930205,  0.930767,  0.931327,  0.931884,  0.932440,
-	 0.932993,  0.933544,  0.934093,  0.934639,  0.935184,  0.935726,  0.936266,  0.936803,
-	 0.937339,  0.937872,  0.938404,  0.938932,  0.939459,  0.939984,  0.940506,  0.941026,
-	 0.941544,  0.942060,  0.942573,  0.943084,  0.943593,  0.944100,  0.944605,  0.945107,
-	 0.945607,  0.946105,  0.946601,  0.947094,  0.947586,  0.948075,  0.948561,  0.949046,
-	 0.949528,  0.950008,  0.950486,  0.950962,  0.951435,  0.951906,  0.952375,  0.952842,
-	 0.953306,  0.953768,  0.954228,  0.954686,  0.955141,  0.955594,  0.956045,  0.956494,
-	 0.956940,  0.957385,  0.957826,  0.958266,  0.958703,  0.959139,  0.959572,  0.960002,
-	 0.960431,  0.960857,  0.961280,  0.961702,  0.962121,  0.962538,  0.962953,  0.963366,
-	 0.963776,  0.964184,  0.964590,  0.964993,  0.965394,  0.965793,  0.966190,  0.966584,
-	 0.966976,  0.967366,  0.967754,  0.968139,  0.968522,  0.968903,  0.969281,  0.969657,
-	 0.970031,  0.970403,  0.970772,  0.971139,  0.971504,  0.971866,  0.972227,  0.972584,
-	 0.972940,  0.973293,  0.973644,  0.973993,  0.974339,  0.974684,  0.975025,  0.975365,
-	 0.975702,  0.976037,  0.976370,  0.976700,  0.977028,  0.977354,  0.977677,  0.977998,
-	 0.978317,  0.978634,  0.978948,  0.979260,  0.979570,  0.979877,  0.980182,  0.980485,
-	 0.980785,  0.981083,  0.981379,  0.981673,  0.981964,  0.982253,  0.982539,  0.982824,
-	 0.983105,  0.983385,  0.983662,  0.983937,  0.984210,  0.984480,  0.984748,  0.985014,
-	 0.985278,  0.985539,  0.985798,  0.986054,  0.986308,  0.986560,  0.986809,  0.987057,
-	 0.987301,  0.987544,  0.987784,  0.988022,  0.988258,  0.988491,  0.988722,  0.988950,
-	 0.989177,  0.989400,  0.989622,  0.989841,  0.990058,  0.990273,  0.990485,  0.990695,
-	 0.990903,  0.991108,  0.991311,  0.991511,  0.991710,  0.991906,  0.992099,  0.992291,
-	 0.992480,  0.992666,  0.992850,  0.993032,  0.993212,  0.993389,  0.993564,  0.993737,
-	 0.993907,  0.994075,  0.994240,  0.994404,  0.994565,  0.994723,  0.994879,  0.995033,
-	 0.995185,  0.995334,  0.995481,  0.995625,  0.995767,  0.995907,  0.996045,  0.996180,
-	 0.996313,  0.996443,  0.996571,  0.996697,  0.996820,  0.996941,  0.997060,  0.997176,
-	 0.997290,  0.997402,  0.997511,  0.997618,  0.997723,  0.997825,  0.997925,  0.998023,
-	 0.998118,  0.998211,  0.998302,  0.998390,  0.998476,  0.998559,  0.998640,  0.998719,
-	 0.998795,  0.998870,  0.998941,  0.999011,  0.999078,  0.999142,  0.999205,  0.999265,
-	 0.999322,  0.999378,  0.999431,  0.999481,  0.999529,  0.999575,  0.999619,  0.999660,
-	 0.999699,  0.999735,  0.999769,  0.999801,  0.999831,  0.999858,  0.999882,  0.999905,
-	 0.999925,  0.999942,  0.999958,  0.999971,  0.999981,  0.999989,  0.999995,  0.999999
-};
+		// Align the table to 32 bytes
+		_data[bits] = new float[n / 2 + 8];
 
-static const float cosTable8192[4096] = {
-	 1.000000,  1.000000,  0.999999,  0.999997,  0.999995,  0.999993,  0.999989,  0.999986,
-	 0.999981,  0.999976,  0.999971,  0.999964,  0.999958,  0.999950,  0.999942,  0.999934,
-	 0.999925,  0.999915,  0.999905,  0.999894,  0.999882,  0.999870,  0.999858,  0.999844,
-	 0.999831,  0.999816,  0.999801,  0.999786,  0.999769,  0.999753,  0.999735,  0.999717,
-	 0.999699,  0.999680,  0.999660,  0.999640,  0.999619,  0.999597,  0.999575,  0.999553,
-	 0.999529,  0.999506,  0.999481,  0.999456,  0.999431,  0.999404,  0.999378,  0.999350,
-	 0.999322,  0.999294,  0.999265,  0.999235,  0.999205,  0.999174,  0.999142,  0.999110,
-	 0.999078,  0.999044,  0.999011,  0.998976,  0.998941,  0.998906,  0.998870,  0.998833,
-	 0.998795,  0.998758,  0.998719,  0.998680,  0.998640,  0.998600,  0.998559,  0.998518,
-	 0.998476,  0.998433,  0.998390,  0.998346,  0.998302,  0.998257,  0.998211,  0.998165,
-	 0.998118,  0.998071,  0.998023,  0.997974,  0.997925,  0.997876,  0.997825,  0.997774,
-	 0.997723,  0.997671,  0.997618,  0.997565,  0.997511,  0.997457,  0.997402,  0.997347,
-	 0.997290,  0.997234,  0.997176,  0.997119,  0.997060,  0.997001,  0.996941,  0.996881,
-	 0.996820,  0.996759,  0.996697,  0.996634,  0.996571,  0.996507,  0.996443,  0.996378,
-	 0.996313,  0.996247,  0.996180,  0.996113,  0.996045,  0.995976,  0.995907,  0.995838,
-	 0.995767,  0.995697,  0.995625,  0.995553,  0.995481,  0.995408,  0.995334,  0.995260,
-	 0.995185,  0.995109,  0.995033,  0.994957,  0.994879,  0.994802,  0.994723,  0.994644,
-	 0.994565,  0.994484,  0.994404,  0.994322,  0.994240,  0.994158,  0.994075,  0.993991,
-	 0.993907,  0.993822,  0.993737,  0.993651,  0.993564,  0.993477,  0.993389,  0.993301,
-	 0.993212,  0.993122,  0.993032,  0.992942,  0.992850,  0.992759,  0.992666,  0.992573,
-	 0.992480,  0.992385,  0.992291,  0.992195,  0.992099,  0.992003,  0.991906,  0.991808,
-	 0.991710,  0.991611,  0.991511,  0.991411,  0.991311,  0.991210,  0.991108,  0.991006,
-	 0.990903,  0.990799,  0.990695,  0.990590,  0.990485,  0.990379,  0.990273,  0.990166,
-	 0.990058,  0.989950,  0.989841,  0.989732,  0.989622,  0.989511,  0.989400,  0.989289,
-	 0.989177,  0.989064,  0.988950,  0.988836,  0.988722,  0.988607,  0.988491,  0.988374,
-	 0.988258,  0.988140,  0.988022,  0.987903,  0.987784,  0.987664,  0.987544,  0.987423,
-	 0.987301,  0.987179,  0.987057,  0.986933,  0.986809,  0.986685,  0.986560,  0.986434,
-	 0.986308,  0.986181,  0.986054,  0.985926,  0.985798,  0.985668,  0.985539,  0.985408,
-	 0.985278,  0.985146,  0.985014,  0.984882,  0.984748,  0.984615,  0.984480,  0.984346,
-	 0.984210,  0.984074,  0.983937,  0.983800,  0.983662,  0.983524,  0.983385,  0.983246,
-	 0.983105,  0.982965,  0.982824,  0.982682,  0.982539,  0.982396,  0.982253,  0.982109,
-	 0.981964,  0.981819,  0.981673,  0.981526,  0.981379,  0.981232,  0.981083,  0.980935,
-	 0.980785,  0.980635,  0.980485,  0.980334,  0.980182,  0.980030,  0.979877,  0.979724,
-	 0.979570,  0.979415,  0.979260,  0.979104,  0.978948,  0.978791,  0.978634,  0.978476,
-	 0.978317,  0.978158,  0.977998,  0.977838,  0.977677,  0.977516,  0.977354,  0.977191,
-	 0.977028,  0.976864,  0.976700,  0.976535,  0.976370,  0.976204,  0.976037,  0.975870,
-	 0.975702,  0.975534,  0.975365,  0.975195,  0.975025,  0.974855,  0.974684,  0.974512,
-	 0.974339,  0.974166,  0.973993,  0.973819,  0.973644,  0.973469,  0.973293,  0.973117,
-	 0.972940,  0.972762,  0.972584,  0.972406,  0.972227,  0.972047,  0.971866,  0.971685,
-	 0.971504,  0.971322,  0.971139,  0.970956,  0.970772,  0.970588,  0.970403,  0.970217,
-	 0.970031,  0.969845,  0.969657,  0.969470,  0.969281,  0.969092,  0.968903,  0.968713,
-	 0.968522,  0.968331,  0.968139,  0.967947,  0.967754,  0.967560,  0.967366,  0.967172,
-	 0.966976,  0.966781,  0.966584,  0.966387,  0.966190,  0.965992,  0.965793,  0.965594,
-	 0.965394,  0.965194,  0.964993,  0.964792,  0.964590,  0.964387,  0.964184,  0.963980,
-	 0.963776,  0.963571,  0.963366,  0.963160,  0.962953,  0.962746,  0.962538,  0.962330,
-	 0.962121,  0.961912,  0.961702,  0.961492,  0.961280,  0.961069,  0.960857,  0.960644,
-	 0.960431,  0.960217,  0.960002,  0.959787,  0.959572,  0.959355,  0.959139,  0.958921,
-	 0.958703,  0.958485,  0.958266,  0.958046,  0.957826,  0.957606,  0.957385,  0.957163,
-	 0.956940,  0.956717,  0.956494,  0.956270,  0.956045,  0.955820,  0.955594,  0.955368,
-	 0.955141,  0.954914,  0.954686,  0.954457,  0.954228,  0.953998,  0.953768,  0.953537,
-	 0.953306,  0.953074,  0.952842,  0.952609,  0.952375,  0.952141,  0.951906,  0.951671,
-	 0.951435,  0.951199,  0.950962,  0.950724,  0.950486,  0.950247,  0.950008,  0.949768,
-	 0.949528,  0.949287,  0.949046,  0.948804,  0.948561,  0.948318,  0.948075,  0.947830,
-	 0.947586,  0.947340,  0.947094,  0.946848,  0.946601,  0.946353,  0.946105,  0.945857,
-	 0.945607,  0.945358,  0.945107,  0.944856,  0.944605,  0.944353,  0.944100,  0.943847,
-	 0.943593,  0.943339,  0.943084,  0.942829,  0.942573,  0.942317,  0.942060,  0.941802,
-	 0.941544,  0.941285,  0.941026,  0.940766,  0.940506,  0.940245,  0.939984,  0.939722,
-	 0.939459,  0.939196,  0.938932,  0.938668,  0.938404,  0.938138,  0.937872,  0.937606,
-	 0.937339,  0.937072,  0.936803,  0.936535,  0.936266,  0.935996,  0.935726,  0.935455,
-	 0.935184,  0.934912,  0.934639,  0.934366,  0.934093,  0.933818,  0.933544,  0.933269,
-	 0.932993,  0.932716,  0.932440,  0.932162,  0.931884,  0.931606,  0.931327,  0.931047,
-	 0.930767,  0.930486,  0.930205,  0.929923,  0.929641,  0.929358,  0.929075,  0.928791,
-	 0.928506,  0.928221,  0.927935,  0.927649,  0.927363,  0.927075,  0.926787,  0.926499,
-	 0.926210,  0.925921,  0.925631,  0.925340,  0.925049,  0.924758,  0.924465,  0.924173,
-	 0.923880,  0.923586,  0.923291,  0.922997,  0.922701,  0.922405,  0.922109,  0.921812,
-	 0.921514,  0.921216,  0.920917,  0.920618,  0.920318,  0.920018,  0.919717,  0.919416,
-	 0.919114,  0.918811,  0.918508,  0.918205,  0.917901,  0.917596,  0.917291,  0.916985,
-	 0.916679,  0.916372,  0.916065,  0.915757,  0.915449,  0.915140,  0.914830,  0.914520,
-	 0.914210,  0.913899,  0.913587,  0.913275,  0.912962,  0.912649,  0.912335,  0.912021,
-	 0.911706,  0.911391,  0.911075,  0.910758,  0.910441,  0.910124,  0.909806,  0.909487,
-	 0.909168,  0.908848,  0.908528,  0.908207,  0.907886,  0.907564,  0.907242,  0.906919,
-	 0.906596,  0.906272,  0.905947,  0.905622,  0.905297,  0.904971,  0.904644,  0.904317,
-	 0.903989,  0.903661,  0.903332,  0.903003,  0.902673,  0.902343,  0.902012,  0.901681,
-	 0.901349,  0.901016,  0.900683,  0.900350,  0.900016,  0.899681,  0.899346,  0.899011,
-	 0.898674,  0.898338,  0.898001,  0.897663,  0.897325,  0.896986,  0.896646,  0.896307,
-	 0.895966,  0.895625,  0.895284,  0.894942,  0.894599,  0.894256,  0.893913,  0.893569,
-	 0.893224,  0.892879,  0.892534,  0.892187,  0.891841,  0.891493,  0.891146,  0.890797,
-	 0.890449,  0.890099,  0.889750,  0.889399,  0.889048,  0.888697,  0.888345,  0.887993,
-	 0.887640,  0.887286,  0.886932,  0.886578,  0.886223,  0.885867,  0.885511,  0.885154,
-	 0.884797,  0.884439,  0.884081,  0.883723,  0.883363,  0.883004,  0.882643,  0.882283,
-	 0.881921,  0.881559,  0.881197,  0.880834,  0.880471,  0.880107,  0.879743,  0.879378,
-	 0.879012,  0.878646,  0.878280,  0.877913,  0.877545,  0.877177,  0.876809,  0.876440,
-	 0.876070,  0.875700,  0.875329,  0.874958,  0.874587,  0.874215,  0.873842,  0.873469,
-	 0.873095,  0.872721,  0.872346,  0.871971,  0.871595,  0.871219,  0.870842,  0.870465,
-	 0.870087,  0.869709,  0.869330,  0.868951,  0.868571,  0.868190,  0.867809,  0.867428,
-	 0.867046,  0.866664,  0.866281,  0.865898,  0.865514,  0.865129,  0.864744,  0.864359,
-	 0.863973,  0.863586,  0.863199,  0.862812,  0.862424,  0.862035,  0.861646,  0.861257,
-	 0.860867,  0.860476,  0.860085,  0.859694,  0.859302,  0.858909,  0.858516,  0.858123,
-	 0.857729,  0.857334,  0.856939,  0.856543,  0.856147,  0.855751,  0.855354,  0.854956,
-	 0.854558,  0.854159,  0.853760,  0.853361,  0.852961,  0.852560,  0.852159,  0.851757,
-	 0.851355,  0.850953,  0.850549,  0.850146,  0.849742,  0.849337,  0.848932,  0.848526,
-	 0.848120,  0.847714,  0.847307,  0.846899,  0.846491,  0.846082,  0.845673,  0.845264,
-	 0.844854,  0.844443,  0.844032,  0.843620,  0.843208,  0.842796,  0.842383,  0.841969,
-	 0.841555,  0.841140,  0.840725,  0.840310,  0.839894,  0.839477,  0.839060,  0.838643,
-	 0.838225,  0.837806,  0.837387,  0.836968,  0.836548,  0.836127,  0.835706,  0.835285,
-	 0.834863,  0.834440,  0.834018,  0.833594,  0.833170,  0.832746,  0.832321,  0.831895,
-	 0.831470,  0.831043,  0.830616,  0.830189,  0.829761,  0.829333,  0.828904,  0.828475,
-	 0.828045,  0.827615,  0.827184,  0.826753,  0.826321,  0.825889,  0.825456,  0.825023,
-	 0.824589,  0.824155,  0.823721,  0.823285,  0.822850,  0.822414,  0.821977,  0.821540,
-	 0.821102,  0.820664,  0.820226,  0.819787,  0.819348,  0.818908,  0.818467,  0.818026,
-	 0.817585,  0.817143,  0.816701,  0.816258,  0.815814,  0.815371,  0.814926,  0.814482,
-	 0.814036,  0.813591,  0.813144,  0.812698,  0.812251,  0.811803,  0.811355,  0.810906,
-	 0.810457,  0.810008,  0.809558,  0.809107,  0.808656,  0.808205,  0.807753,  0.807300,
-	 0.806848,  0.806394,  0.805940,  0.805486,  0.805031,  0.804576,  0.804120,  0.803664,
-	 0.803208,  0.802750,  0.802293,  0.801835,  0.801376,  0.800917,  0.800458,  0.799998,
-	 0.799537,  0.799076,  0.798615,  0.798153,  0.797691,  0.797228,  0.796765,  0.796301,
-	 0.795837,  0.795372,  0.794907,  0.794442,  0.793975,  0.793509,  0.793042,  0.792575,
-	 0.792107,  0.791638,  0.791169,  0.790700,  0.790230,  0.789760,  0.789289,  0.788818,
-	 0.788346,  0.787874,  0.787402,  0.786929,  0.786455,  0.785981,  0.785507,  0.785032,
-	 0.784557,  0.784081,  0.783605,  0.783128,  0.782651,  0.782173,  0.781695,  0.781216,
-	 0.780737,  0.780258,  0.779778,  0.779297,  0.778817,  0.778335,  0.777853,  0.777371,
-	 0.776888,  0.776405,  0.775922,  0.775438,  0.774953,  0.774468,  0.773983,  0.773497,
-	 0.773010,  0.772524,  0.772036,  0.771549,  0.771061,  0.770572,  0.770083,  0.769593,
-	 0.769103,  0.768613,  0.768122,  0.767631,  0.767139,  0.766647,  0.766154,  0.765661,
-	 0.765167,  0.764673,  0.764179,  0.763684,  0.763188,  0.762693,  0.762196,  0.761700,
-	 0.761202,  0.760705,  0.760207,  0.759708,  0.759209,  0.758710,  0.758210,  0.757710,
-	 0.757209,  0.756708,  0.756206,  0.755704,  0.755201,  0.754698,  0.754195,  0.753691,
-	 0.753187,  0.752682,  0.752177,  0.751671,  0.751165,  0.750659,  0.750152,  0.749644,
-	 0.749136,  0.748628,  0.748119,  0.747610,  0.747101,  0.746591,  0.746080,  0.745569,
-	 0.745058,  0.744546,  0.744034,  0.743521,  0.743008,  0.742494,  0.741980,  0.741466,
-	 0.740951,  0.740436,  0.739920,  0.739404,  0.738887,  0.738370,  0.737853,  0.737335,
-	 0.736817,  0.736298,  0.735779,  0.735259,  0.734739,  0.734218,  0.733697,  0.733176,
-	 0.732654,  0.732132,  0.731609,  0.731086,  0.730563,  0.730039,  0.729514,  0.728990,
-	 0.728464,  0.727939,  0.727413,  0.726886,  0.726359,  0.725832,  0.725304,  0.724776,
-	 0.724247,  0.723718,  0.723188,  0.722659,  0.722128,  0.721597,  0.721066,  0.720535,
-	 0.720003,  0.719470,  0.718937,  0.718404,  0.717870,  0.717336,  0.716801,  0.716266,
-	 0.715731,  0.715195,  0.714659,  0.714122,  0.713585,  0.713047,  0.712509,  0.711971,
-	 0.711432,  0.710893,  0.710353,  0.709813,  0.709273,  0.708732,  0.708191,  0.707649,
-	 0.707107,  0.706564,  0.706021,  0.705478,  0.704934,  0.704390,  0.703845,  0.703300,
-	 0.702755,  0.702209,  0.701663,  0.701116,  0.700569,  0.700021,  0.699473,  0.698925,
-	 0.698376,  0.697827,  0.697277,  0.696728,  0.696177,  0.695626,  0.695075,  0.694524,
-	 0.693971,  0.693419,  0.692866,  0.692313,  0.691759,  0.691205,  0.690651,  0.690096,
-	 0.689541,  0.688985,  0.688429,  0.687872,  0.687315,  0.686758,  0.686200,  0.685642,
-	 0.685084,  0.684525,  0.683965,  0.683406,  0.682846,  0.682285,  0.681724,  0.681163,
-	 0.680601,  0.680039,  0.679476,  0.678913,  0.678350,  0.677786,  0.677222,  0.676658,
-	 0.676093,  0.675527,  0.674962,  0.674396,  0.673829,  0.673262,  0.672695,  0.672127,
-	 0.671559,  0.670990,  0.670422,  0.669852,  0.669283,  0.668712,  0.668142,  0.667571,
-	 0.667000,  0.666428,  0.665856,  0.665284,  0.664711,  0.664138,  0.663564,  0.662990,
-	 0.662416,  0.661841,  0.661266,  0.660690,  0.660114,  0.659538,  0.658961,  0.658384,
-	 0.657807,  0.657229,  0.656651,  0.656072,  0.655493,  0.654913,  0.654334,  0.653753,
-	 0.653173,  0.652592,  0.652011,  0.651429,  0.650847,  0.650264,  0.649681,  0.649098,
-	 0.648514,  0.647930,  0.647346,  0.646761,  0.646176,  0.645590,  0.645005,  0.644418,
-	 0.643832,  0.643245,  0.642657,  0.642069,  0.641481,  0.640892,  0.640303,  0.639714,
-	 0.639124,  0.638534,  0.637944,  0.637353,  0.636762,  0.636170,  0.635578,  0.634986,
-	 0.634393,  0.633800,  0.633207,  0.632613,  0.632019,  0.631424,  0.630829,  0.630234,
-	 0.629638,  0.629042,  0.628446,  0.627849,  0.627252,  0.626654,  0.626056,  0.625458,
-	 0.624860,  0.624260,  0.623661,  0.623061,  0.622461,  0.621861,  0.621260,  0.620659,
-	 0.620057,  0.619455,  0.618853,  0.618250,  0.617647,  0.617044,  0.616440,  0.615836,
-	 0.615232,  0.614627,  0.614022,  0.613416,  0.612810,  0.612204,  0.611597,  0.610990,
-	 0.610383,  0.609775,  0.609167,  0.608559,  0.607950,  0.607341,  0.606731,  0.606121,
-	 0.605511,  0.604900,  0.604290,  0.603678,  0.603067,  0.602455,  0.601842,  0.601230,
-	 0.600616,  0.600003,  0.599389,  0.598775,  0.598161,  0.597546,  0.596931,  0.596315,
-	 0.595699,  0.595083,  0.594467,  0.593850,  0.593232,  0.592615,  0.591997,  0.591378,
-	 0.590760,  0.590141,  0.589521,  0.588902,  0.588282,  0.587661,  0.587040,  0.586419,
-	 0.585798,  0.585176,  0.584554,  0.583931,  0.583309,  0.582685,  0.582062,  0.581438,
-	 0.580814,  0.580189,  0.579565,  0.578939,  0.578314,  0.577688,  0.577062,  0.576435,
-	 0.575808,  0.575181,  0.574553,  0.573925,  0.573297,  0.572669,  0.572040,  0.571410,
-	 0.570781,  0.570151,  0.569521,  0.568890,  0.568259,  0.567628,  0.566996,  0.566364,
-	 0.565732,  0.565099,  0.564466,  0.563833,  0.563199,  0.562565,  0.561931,  0.561297,
-	 0.560662,  0.560026,  0.559391,  0.558755,  0.558119,  0.557482,  0.556845,  0.556208,
-	 0.555570,  0.554932,  0.554294,  0.553656,  0.553017,  0.552378,  0.551738,  0.551098,
-	 0.550458,  0.549818,  0.549177,  0.548536,  0.547894,  0.547252,  0.546610,  0.545968,
-	 0.545325,  0.544682,  0.544039,  0.543395,  0.542751,  0.542106,  0.541462,  0.540817,
-	 0.540171,  0.539526,  0.538880,  0.538234,  0.537587,  0.536940,  0.536293,  0.535645,
-	 0.534998,  0.534349,  0.533701,  0.533052,  0.532403,  0.531754,  0.531104,  0.530454,
-	 0.529804,  0.529153,  0.528502,  0.527851,  0.527199,  0.526547,  0.525895,  0.525243,
-	 0.524590,  0.523937,  0.523283,  0.522629,  0.521975,  0.521321,  0.520666,  0.520011,
-	 0.519356,  0.518700,  0.518045,  0.517388,  0.516732,  0.516075,  0.515418,  0.514760,
-	 0.514103,  0.513445,  0.512786,  0.512128,  0.511469,  0.510810,  0.510150,  0.509490,
-	 0.508830,  0.508170,  0.507509,  0.506848,  0.506187,  0.505525,  0.504863,  0.504201,
-	 0.503538,  0.502876,  0.502212,  0.501549,  0.500885,  0.500221,  0.499557,  0.498893,
-	 0.498228,  0.497562,  0.496897,  0.496231,  0.495565,  0.494899,  0.494232,  0.493565,
-	 0.492898,  0.492231,  0.491563,  0.490895,  0.490226,  0.489558,  0.488889,  0.488220,
-	 0.487550,  0.486880,  0.486210,  0.485540,  0.484869,  0.484198,  0.483527,  0.482856,
-	 0.482184,  0.481512,  0.480839,  0.480167,  0.479494,  0.478821,  0.478147,  0.477473,
-	 0.476799,  0.476125,  0.475450,  0.474775,  0.474100,  0.473425,  0.472749,  0.472073,
-	 0.471397,  0.470720,  0.470043,  0.469366,  0.468689,  0.468011,  0.467333,  0.466655,
-	 0.465977,  0.465298,  0.464619,  0.463939,  0.463260,  0.462580,  0.461900,  0.461219,
-	 0.460539,  0.459858,  0.459177,  0.458495,  0.457813,  0.457131,  0.456449,  0.455766,
-	 0.455084,  0.454400,  0.453717,  0.453033,  0.452350,  0.451665,  0.450981,  0.450296,
-	 0.449611,  0.448926,  0.448241,  0.447555,  0.446869,  0.446183,  0.445496,  0.444809,
-	 0.444122,  0.443435,  0.442747,  0.442059,  0.441371,  0.440683,  0.439994,  0.439305,
-	 0.438616,  0.437927,  0.437237,  0.436547,  0.435857,  0.435167,  0.434476,  0.433785,
-	 0.433094,  0.432402,  0.431711,  0.431019,  0.430326,  0.429634,  0.428941,  0.428248,
-	 0.427555,  0.426862,  0.426168,  0.425474,  0.424780,  0.424085,  0.423390,  0.422695,
-	 0.422000,  0.421305,  0.420609,  0.419913,  0.419217,  0.418520,  0.417824,  0.417127,
-	 0.416430,  0.415732,  0.415034,  0.414337,  0.413638,  0.412940,  0.412241,  0.411542,
-	 0.410843,  0.410144,  0.409444,  0.408744,  0.408044,  0.407344,  0.406643,  0.405942,
-	 0.405241,  0.404540,  0.403838,  0.403137,  0.402435,  0.401732,  0.401030,  0.400327,
-	 0.399624,  0.398921,  0.398218,  0.397514,  0.396810,  0.396106,  0.395401,  0.394697,
-	 0.393992,  0.393287,  0.392582,  0.391876,  0.391170,  0.390464,  0.389758,  0.389052,
-	 0.388345,  0.387638,  0.386931,  0.386224,  0.385516,  0.384808,  0.384100,  0.383392,
-	 0.382683,  0.381975,  0.381266,  0.380557,  0.379847,  0.379138,  0.378428,  0.377718,
-	 0.377007,  0.376297,  0.375586,  0.374875,  0.374164,  0.373453,  0.372741,  0.372029,
-	 0.371317,  0.370605,  0.369892,  0.369180,  0.368467,  0.367754,  0.367040,  0.366327,
-	 0.365613,  0.364899,  0.364185,  0.363470,  0.362756,  0.362041,  0.361326,  0.360611,
-	 0.359895,  0.359179,  0.358463,  0.357747,  0.357031,  0.356314,  0.355598,  0.354881,
-	 0.354164,  0.353446,  0.352729,  0.352011,  0.351293,  0.350575,  0.349856,  0.349138,
-	 0.348419,  0.347700,  0.346980,  0.346261,  0.345541,  0.344821,  0.344101,  0.343381,
-	 0.342661,  0.341940,  0.341219,  0.340498,  0.339777,  0.339055,  0.338334,  0.337612,
-	 0.336890,  0.336168,  0.335445,  0.334722,  0.334000,  0.333277,  0.332553,  0.331830,
-	 0.331106,  0.330382,  0.329658,  0.328934,  0.328210,  0.327485,  0.326760,  0.326035,
-	 0.325310,  0.324585,  0.323859,  0.323134,  0.322408,  0.321682,  0.320955,  0.320229,
-	 0.319502,  0.318775,  0.318048,  0.317321,  0.316593,  0.315866,  0.315138,  0.314410,
-	 0.313682,  0.312953,  0.312225,  0.311496,  0.310767,  0.310038,  0.309309,  0.308579,
-	 0.307850,  0.307120,  0.306390,  0.305660,  0.304929,  0.304199,  0.303468,  0.302737,
-	 0.302006,  0.301275,  0.300543,  0.299812,  0.299080,  0.298348,  0.297616,  0.296883,
-	 0.296151,  0.295418,  0.294685,  0.293952,  0.293219,  0.292486,  0.291752,  0.291019,
-	 0.290285,  0.289551,  0.288816,  0.288082,  0.287347,  0.286613,  0.285878,  0.285143,
-	 0.284408,  0.283672,  0.282937,  0.282201,  0.281465,  0.280729,  0.279993,  0.279256,
-	 0.278520,  0.277783,  0.277046,  0.276309,  0.275572,  0.274834,  0.274097,  0.273359,
-	 0.272621,  0.271883,  0.271145,  0.270407,  0.269668,  0.268930,  0.268191,  0.267452,
-	 0.266713,  0.265973,  0.265234,  0.264494,  0.263755,  0.263015,  0.262275,  0.261534,
-	 0.260794,  0.260054,  0.259313,  0.258572,  0.257831,  0.257090,  0.256349,  0.255607,
-	 0.254866,  0.254124,  0.253382,  0.252640,  0.251898,  0.251155,  0.250413,  0.249670,
-	 0.248928,  0.248185,  0.247442,  0.246698,  0.245955,  0.245212,  0.244468,  0.243724,
-	 0.242980,  0.242236,  0.241492,  0.240748,  0.240003,  0.239258,  0.238514,  0.237769,
-	 0.237024,  0.236278,  0.235533,  0.234788,  0.234042,  0.233296,  0.232550,  0.231804,
-	 0.231058,  0.230312,  0.229565,  0.228819,  0.228072,  0.227325,  0.226578,  0.225831,
-	 0.225084,  0.224337,  0.223589,  0.222841,  0.222094,  0.221346,  0.220598,  0.219850,
-	 0.219101,  0.218353,  0.217604,  0.216856,  0.216107,  0.215358,  0.214609,  0.213860,
-	 0.213110,  0.212361,  0.211611,  0.210862,  0.210112,  0.209362,  0.208612,  0.207862,
-	 0.207111,  0.206361,  0.205610,  0.204860,  0.204109,  0.203358,  0.202607,  0.201856,
-	 0.201105,  0.200353,  0.199602,  0.198850,  0.198098,  0.197347,  0.196595,  0.195843,
-	 0.195090,  0.194338,  0.193586,  0.192833,  0.192080,  0.191328,  0.190575,  0.189822,
-	 0.189069,  0.188315,  0.187562,  0.186809,  0.186055,  0.185301,  0.184548,  0.183794,
-	 0.183040,  0.182286,  0.181532,  0.180777,  0.180023,  0.179268,  0.178514,  0.177759,
-	 0.177004,  0.176249,  0.175494,  0.174739,  0.173984,  0.173229,  0.172473,  0.171718,
-	 0.170962,  0.170206,  0.169450,  0.168694,  0.167938,  0.167182,  0.166426,  0.165670,
-	 0.164913,  0.164157,  0.163400,  0.162643,  0.161886,  0.161129,  0.160372,  0.159615,
-	 0.158858,  0.158101,  0.157343,  0.156586,  0.155828,  0.155071,  0.154313,  0.153555,
-	 0.152797,  0.152039,  0.151281,  0.150523,  0.149765,  0.149006,  0.148248,  0.147489,
-	 0.146730,  0.145972,  0.145213,  0.144454,  0.143695,  0.142936,  0.142177,  0.141418,
-	 0.140658,  0.139899,  0.139139,  0.138380,  0.137620,  0.136860,  0.136101,  0.135341,
-	 0.134581,  0.133821,  0.133061,  0.132300,  0.131540,  0.130780,  0.130019,  0.129259,
-	 0.128498,  0.127737,  0.126977,  0.126216,  0.125455,  0.124694,  0.123933,  0.123172,
-	 0.122411,  0.121649,  0.120888,  0.120127,  0.119365,  0.118604,  0.117842,  0.117080,
-	 0.116319,  0.115557,  0.114795,  0.114033,  0.113271,  0.112509,  0.111747,  0.110984,
-	 0.110222,  0.109460,  0.108697,  0.107935,  0.107172,  0.106410,  0.105647,  0.104884,
-	 0.104122,  0.103359,  0.102596,  0.101833,  0.101070,  0.100307,  0.099544,  0.098780,
-	 0.098017,  0.097254,  0.096490,  0.095727,  0.094963,  0.094200,  0.093436,  0.092673,
-	 0.091909,  0.091145,  0.090381,  0.089617,  0.088854,  0.088090,  0.087326,  0.086561,
-	 0.085797,  0.085033,  0.084269,  0.083505,  0.082740,  0.081976,  0.081211,  0.080447,
-	 0.079682,  0.078918,  0.078153,  0.077389,  0.076624,  0.075859,  0.075094,  0.074329,
-	 0.073565,  0.072800,  0.072035,  0.071270,  0.070505,  0.069739,  0.068974,  0.068209,
-	 0.067444,  0.066679,  0.065913,  0.065148,  0.064383,  0.063617,  0.062852,  0.062086,
-	 0.061321,  0.060555,  0.059790,  0.059024,  0.058258,  0.057493,  0.056727,  0.055961,
-	 0.055195,  0.054429,  0.053664,  0.052898,  0.052132,  0.051366,  0.050600,  0.049834,
-	 0.049068,  0.048302,  0.047535,  0.046769,  0.046003,  0.045237,  0.044471,  0.043705,
-	 0.042938,  0.042172,  0.041406,  0.040639,  0.039873,  0.039107,  0.038340,  0.037574,
-	 0.036807,  0.036041,  0.035274,  0.034508,  0.033741,  0.032975,  0.032208,  0.031441,
-	 0.030675,  0.029908,  0.029142,  0.028375,  0.027608,  0.026841,  0.026075,  0.025308,
-	 0.024541,  0.023774,  0.023008,  0.022241,  0.021474,  0.020707,  0.019940,  0.019174,
-	 0.018407,  0.017640,  0.016873,  0.016106,  0.015339,  0.014572,  0.013805,  0.013038,
-	 0.012272,  0.011505,  0.010738,  0.009971,  0.009204,  0.008437,  0.007670,  0.006903,
-	 0.006136,  0.005369,  0.004602,  0.003835,  0.003068,  0.002301,  0.001534,  0.000767,
-	 0.000000,  0.000767,  0.001534,  0.002301,  0.003068,  0.003835,  0.004602,  0.005369,
-	 0.006136,  0.006903,  0.007670,  0.008437,  0.009204,  0.009971,  0.010738,  0.011505,
-	 0.012272,  0.013038,  0.013805,  0.014572,  0.015339,  0.016106,  0.016873,  0.017640,
-	 0.018407,  0.019174,  0.019940,  0.020707,  0.021474,  0.022241,  0.023008,  0.023774,
-	 0.024541,  0.025308,  0.026075,  0.026841,  0.027608,  0.028375,  0.029142,  0.029908,
-	 0.030675,  0.031441,  0.032208,  0.032975,  0.033741,  0.034508,  0.035274,  0.036041,
-	 0.036807,  0.037574,  0.038340,  0.039107,  0.039873,  0.040639,  0.041406,  0.042172,
-	 0.042938,  0.043705,  0.044471,  0.045237,  0.046003,  0.046769,  0.047535,  0.048302,
-	 0.049068,  0.049834,  0.050600,  0.051366,  0.052132,  0.052898,  0.053664,  0.054429,
-	 0.055195,  0.055961,  0.056727,  0.057493,  0.058258,  0.059024,  0.059790,  0.060555,
-	 0.061321,  0.062086,  0.062852,  0.063617,  0.064383,  0.065148,  0.065913,  0.066679,
-	 0.067444,  0.068209,  0.068974,  0.069739,  0.070505,  0.071270,  0.072035,  0.072800,
-	 0.073565,  0.074329,  0.075094,  0.075859,  0.076624,  0.077389,  0.078153,  0.078918,
-	 0.079682,  0.080447,  0.081211,  0.081976,  0.082740,  0.083505,  0.084269,  0.085033,
-	 0.085797,  0.086561,  0.087326,  0.088090,  0.088854,  0.089617,  0.090381,  0.091145,
-	 0.091909,  0.092673,  0.093436,  0.094200,  0.094963,  0.095727,  0.096490,  0.097254,
-	 0.098017,  0.098780,  0.099544,  0.100307,  0.101070,  0.101833,  0.102596,  0.103359,
-	 0.104122,  0.104884,  0.105647,  0.106410,  0.107172,  0.107935,  0.108697,  0.109460,
-	 0.110222,  0.110984,  0.111747,  0.112509,  0.113271,  0.114033,  0.114795,  0.115557,
-	 0.116319,  0.117080,  0.117842,  0.118604,  0.119365,  0.120127,  0.120888,  0.121649,
-	 0.122411,  0.123172,  0.123933,  0.124694,  0.125455,  0.126216,  0.126977,  0.127737,
-	 0.128498,  0.129259,  0.130019,  0.130780,  0.131540,  0.132300,  0.133061,  0.133821,
-	 0.134581,  0.135341,  0.136101,  0.136860,  0.137620,  0.138380,  0.139139,  0.139899,
-	 0.140658,  0.141418,  0.142177,  0.142936,  0.143695,  0.144454,  0.145213,  0.145972,
-	 0.146730,  0.147489,  0.148248,  0.149006,  0.149765,  0.150523,  0.151281,  0.152039,
-	 0.152797,  0.153555,  0.154313,  0.155071,  0.155828,  0.156586,  0.157343,  0.158101,
-	 0.158858,  0.159615,  0.160372,  0.161129,  0.161886,  0.162643,  0.163400,  0.164157,
-	 0.164913,  0.165670,  0.166426,  0.167182,  0.167938,  0.168694,  0.169450,  0.170206,
-	 0.170962,  0.171718,  0.172473,  0.173229,  0.173984,  0.174739,  0.175494,  0.176249,
-	 0.177004,  0.177759,  0.178514,  0.179268,  0.180023,  0.180777,  0.181532,  0.182286,
-	 0.183040,  0.183794,  0.184548,  0.185301,  0.186055,  0.186809,  0.187562,  0.188315,
-	 0.189069,  0.189822,  0.190575,  0.191328,  0.192080,  0.192833,  0.193586,  0.194338,
-	 0.195090,  0.195843,  0.196595,  0.197347,  0.198098,  0.198850,  0.199602,  0.200353,
-	 0.201105,  0.201856,  0.202607,  0.203358,  0.204109,  0.204860,  0.205610,  0.206361,
-	 0.207111,  0.207862,  0.208612,  0.209362,  0.210112,  0.210862,  0.211611,  0.212361,
-	 0.213110,  0.213860,  0.214609,  0.215358,  0.216107,  0.216856,  0.217604,  0.218353,
-	 0.219101,  0.219850,  0.220598,  0.221346,  0.222094,  0.222841,  0.223589,  0.224337,
-	 0.225084,  0.225831,  0.226578,  0.227325,  0.228072,  0.228819,  0.229565,  0.230312,
-	 0.231058,  0.231804,  0.232550,  0.233296,  0.234042,  0.234788,  0.235533,  0.236278,
-	 0.237024,  0.237769,  0.238514,  0.239258,  0.240003,  0.240748,  0.241492,  0.242236,
-	 0.242980,  0.243724,  0.244468,  0.245212,  0.245955,  0.246698,  0.247442,  0.248185,
-	 0.248928,  0.249670,  0.250413,  0.251155,  0.251898,  0.252640,  0.253382,  0.254124,
-	 0.254866,  0.255607,  0.256349,  0.257090,  0.257831,  0.258572,  0.259313,  0.260054,
-	 0.260794,  0.261534,  0.262275,  0.263015,  0.263755,  0.264494,  0.265234,  0.265973,
-	 0.266713,  0.267452,  0.268191,  0.268930,  0.269668,  0.270407,  0.271145,  0.271883,
-	 0.272621,  0.273359,  0.274097,  0.274834,  0.275572,  0.276309,  0.277046,  0.277783,
-	 0.278520,  0.279256,  0.279993,  0.280729,  0.281465,  0.282201,  0.282937,  0.283672,
-	 0.284408,  0.285143,  0.285878,  0.286613,  0.287347,  0.288082,  0.288816,  0.289551,
-	 0.290285,  0.291019,  0.291752,  0.292486,  0.293219,  0.293952,  0.294685,  0.295418,
-	 0.296151,  0.296883,  0.297616,  0.298348,  0.299080,  0.299812,  0.300543,  0.301275,
-	 0.302006,  0.302737,  0.303468,  0.304199,  0.304929,  0.305660,  0.306390,  0.307120,
-	 0.307850,  0.308579,  0.309309,  0.310038,  0.310767,  0.311496,  0.312225,  0.312953,
-	 0.313682,  0.314410,  0.315138,  0.315866,  0.316593,  0.317321,  0.318048,  0.318775,
-	 0.319502,  0.320229,  0.320955,  0.321682,  0.322408,  0.323134,  0.323859,  0.324585,
-	 0.325310,  0.326035,  0.326760,  0.327485,  0.328210,  0.328934,  0.329658,  0.330382,
-	 0.331106,  0.331830,  0.332553,  0.333277,  0.334000,  0.334722,  0.335445,  0.336168,
-	 0.336890,  0.337612,  0.338334,  0.339055,  0.339777,  0.340498,  0.341219,  0.341940,
-	 0.342661,  0.343381,  0.344101,  0.344821,  0.345541,  0.346261,  0.346980,  0.347700,
-	 0.348419,  0.349138,  0.349856,  0.350575,  0.351293,  0.352011,  0.352729,  0.353446,
-	 0.354164,  0.354881,  0.355598,  0.356314,  0.357031,  0.357747,  0.358463,  0.359179,
-	 0.359895,  0.360611,  0.361326,  0.362041,  0.362756,  0.363470,  0.364185,  0.364899,
-	 0.365613,  0.366327,  0.367040,  0.367754,  0.368467,  0.369180,  0.369892,  0.370605,
-	 0.371317,  0.372029,  0.372741,  0.373453,  0.374164,  0.374875,  0.375586,  0.376297,
-	 0.377007,  0.377718,  0.378428,  0.379138,  0.379847,  0.380557,  0.381266,  0.381975,
-	 0.382683,  0.383392,  0.384100,  0.384808,  0.385516,  0.386224,  0.386931,  0.387638,
-	 0.388345,  0.389052,  0.389758,  0.390464,  0.391170,  0.391876,  0.392582,  0.393287,
-	 0.393992,  0.394697,  0.395401,  0.396106,  0.396810,  0.397514,  0.398218,  0.398921,
-	 0.399624,  0.400327,  0.401030,  0.401732,  0.402435,  0.403137,  0.403838,  0.404540,
-	 0.405241,  0.405942,  0.406643,  0.407344,  0.408044,  0.408744,  0.409444,  0.410144,
-	 0.410843,  0.411542,  0.412241,  0.412940,  0.413638,  0.414337,  0.415034,  0.415732,
-	 0.416430,  0.417127,  0.417824,  0.418520,  0.419217,  0.419913,  0.420609,  0.421305,
-	 0.422000,  0.422695,  0.423390,  0.424085,  0.424780,  0.425474,  0.426168,  0.426862,
-	 0.427555,  0.428248,  0.428941,  0.429634,  0.430326,  0.431019,  0.431711,  0.432402,
-	 0.433094,  0.433785,  0.434476,  0.435167,  0.435857,  0.436547,  0.437237,  0.437927,
-	 0.438616,  0.439305,  0.439994,  0.440683,  0.441371,  0.442059,  0.442747,  0.443435,
-	 0.444122,  0.444809,  0.445496,  0.446183,  0.446869,  0.447555,  0.448241,  0.448926,
-	 0.449611,  0.450296,  0.450981,  0.451665,  0.452350,  0.453033,  0.453717,  0.454400,
-	 0.455084,  0.455766,  0.456449,  0.457131,  0.457813,  0.458495,  0.459177,  0.459858,
-	 0.460539,  0.461219,  0.461900,  0.462580,  0.463260,  0.463939,  0.464619,  0.465298,
-	 0.465977,  0.466655,  0.467333,  0.468011,  0.468689,  0.469366,  0.470043,  0.470720,
-	 0.471397,  0.472073,  0.472749,  0.473425,  0.474100,  0.474775,  0.475450,  0.476125,
-	 0.476799,  0.477473,  0.478147,  0.478821,  0.479494,  0.480167,  0.480839,  0.481512,
-	 0.482184,  0.482856,  0.483527,  0.484198,  0.484869,  0.485540,  0.486210,  0.486880,
-	 0.487550,  0.488220,  0.488889,  0.489558,  0.490226,  0.490895,  0.491563,  0.492231,
-	 0.492898,  0.493565,  0.494232,  0.494899,  0.495565,  0.496231,  0.496897,  0.497562,
-	 0.498228,  0.498893,  0.499557,  0.500221,  0.500885,  0.501549,  0.502212,  0.502876,
-	 0.503538,  0.504201,  0.504863,  0.505525,  0.506187,  0.506848,  0.507509,  0.508170,
-	 0.508830,  0.509490,  0.510150,  0.510810,  0.511469,  0.512128,  0.512786,  0.513445,
-	 0.514103,  0.514760,  0.515418,  0.516075,  0.516732,  0.517388,  0.518045,  0.518700,
-	 0.519356,  0.520011,  0.520666,  0.521321,  0.521975,  0.522629,  0.523283,  0.523937,
-	 0.524590,  0.525243,  0.525895,  0.526547,  0.527199,  0.527851,  0.528502,  0.529153,
-	 0.529804,  0.530454,  0.531104,  0.531754,  0.532403,  0.533052,  0.533701,  0.534349,
-	 0.534998,  0.535645,  0.536293,  0.536940,  0.537587,  0.538234,  0.538880,  0.539526,
-	 0.540171,  0.540817,  0.541462,  0.542106,  0.542751,  0.543395,  0.544039,  0.544682,
-	 0.545325,  0.545968,  0.546610,  0.547252,  0.547894,  0.548536,  0.549177,  0.549818,
-	 0.550458,  0.551098,  0.551738,  0.552378,  0.553017,  0.553656,  0.554294,  0.554932,
-	 0.555570,  0.556208,  0.556845,  0.557482,  0.558119,  0.558755,  0.559391,  0.560026,
-	 0.560662,  0.561297,  0.561931,  0.562565,  0.563199,  0.563833,  0.564466,  0.565099,
-	 0.565732,  0.566364,  0.566996,  0.567628,  0.568259,  0.568890,  0.569521,  0.570151,
-	 0.570781,  0.571410,  0.572040,  0.572669,  0.573297,  0.573925,  0.574553,  0.575181,
-	 0.575808,  0.576435,  0.577062,  0.577688,  0.578314,  0.578939,  0.579565,  0.580189,
-	 0.580814,  0.581438,  0.582062,  0.582685,  0.583309,  0.583931,  0.584554,  0.585176,
-	 0.585798,  0.586419,  0.587040,  0.587661,  0.588282,  0.588902,  0.589521,  0.590141,
-	 0.590760,  0.591378,  0.591997,  0.592615,  0.593232,  0.593850,  0.594467,  0.595083,
-	 0.595699,  0.596315,  0.596931,  0.597546,  0.598161,  0.598775,  0.599389,  0.600003,
-	 0.600616,  0.601230,  0.601842,  0.602455,  0.603067,  0.603678,  0.604290,  0.604900,
-	 0.605511,  0.606121,  0.606731,  0.607341,  0.607950,  0.608559,  0.609167,  0.609775,
-	 0.610383,  0.610990,  0.611597,  0.612204,  0.612810,  0.613416,  0.614022,  0.614627,
-	 0.615232,  0.615836,  0.616440,  0.617044,  0.617647,  0.618250,  0.618853,  0.619455,
-	 0.620057,  0.620659,  0.621260,  0.621861,  0.622461,  0.623061,  0.623661,  0.624260,
-	 0.624860,  0.625458,  0.626056,  0.626654,  0.627252,  0.627849,  0.628446,  0.629042,
-	 0.629638,  0.630234,  0.630829,  0.631424,  0.632019,  0.632613,  0.633207,  0.633800,
-	 0.634393,  0.634986,  0.635578,  0.636170,  0.636762,  0.637353,  0.637944,  0.638534,
-	 0.639124,  0.639714,  0.640303,  0.640892,  0.641481,  0.642069,  0.642657,  0.643245,
-	 0.643832,  0.644418,  0.645005,  0.645590,  0.646176,  0.646761,  0.647346,  0.647930,
-	 0.648514,  0.649098,  0.649681,  0.650264,  0.650847,  0.651429,  0.652011,  0.652592,
-	 0.653173,  0.653753,  0.654334,  0.654913,  0.655493,  0.656072,  0.656651,  0.657229,
-	 0.657807,  0.658384,  0.658961,  0.659538,  0.660114,  0.660690,  0.661266,  0.661841,
-	 0.662416,  0.662990,  0.663564,  0.664138,  0.664711,  0.665284,  0.665856,  0.666428,
-	 0.667000,  0.667571,  0.668142,  0.668712,  0.669283,  0.669852,  0.670422,  0.670990,
-	 0.671559,  0.672127,  0.672695,  0.673262,  0.673829,  0.674396,  0.674962,  0.675527,
-	 0.676093,  0.676658,  0.677222,  0.677786,  0.678350,  0.678913,  0.679476,  0.680039,
-	 0.680601,  0.681163,  0.681724,  0.682285,  0.682846,  0.683406,  0.683965,  0.684525,
-	 0.685084,  0.685642,  0.686200,  0.686758,  0.687315,  0.687872,  0.688429,  0.688985,
-	 0.689541,  0.690096,  0.690651,  0.691205,  0.691759,  0.692313,  0.692866,  0.693419,
-	 0.693971,  0.694524,  0.695075,  0.695626,  0.696177,  0.696728,  0.697277,  0.697827,
-	 0.698376,  0.698925,  0.699473,  0.700021,  0.700569,  0.701116,  0.701663,  0.702209,
-	 0.702755,  0.703300,  0.703845,  0.704390,  0.704934,  0.705478,  0.706021,  0.706564,
-	 0.707107,  0.707649,  0.708191,  0.708732,  0.709273,  0.709813,  0.710353,  0.710893,
-	 0.711432,  0.711971,  0.712509,  0.713047,  0.713585,  0.714122,  0.714659,  0.715195,
-	 0.715731,  0.716266,  0.716801,  0.717336,  0.717870,  0.718404,  0.718937,  0.719470,
-	 0.720003,  0.720535,  0.721066,  0.721597,  0.722128,  0.722659,  0.723188,  0.723718,
-	 0.724247,  0.724776,  0.725304,  0.725832,  0.726359,  0.726886,  0.727413,  0.727939,
-	 0.728464,  0.728990,  0.729514,  0.730039,  0.730563,  0.731086,  0.731609,  0.732132,
-	 0.732654,  0.733176,  0.733697,  0.734218,  0.734739,  0.735259,  0.735779,  0.736298,
-	 0.736817,  0.737335,  0.737853,  0.738370,  0.738887,  0.739404,  0.739920,  0.740436,
-	 0.740951,  0.741466,  0.741980,  0.742494,  0.743008,  0.743521,  0.744034,  0.744546,
-	 0.745058,  0.745569,  0.746080,  0.746591,  0.747101,  0.747610,  0.748119,  0.748628,
-	 0.749136,  0.749644,  0.750152,  0.750659,  0.751165,  0.751671,  0.752177,  0.752682,
-	 0.753187,  0.753691,  0.754195,  0.754698,  0.755201,  0.755704,  0.756206,  0.756708,
-	 0.757209,  0.757710,  0.758210,  0.758710,  0.759209,  0.759708,  0.760207,  0.760705,
-	 0.761202,  0.761700,  0.762196,  0.762693,  0.763188,  0.763684,  0.764179,  0.764673,
-	 0.765167,  0.765661,  0.766154,  0.766647,  0.767139,  0.767631,  0.768122,  0.768613,
-	 0.769103,  0.769593,  0.770083,  0.770572,  0.771061,  0.771549,  0.772036,  0.772524,
-	 0.773010,  0.773497,  0.773983,  0.774468,  0.774953,  0.775438,  0.775922,  0.776405,
-	 0.776888,  0.777371,  0.777853,  0.778335,  0.778817,  0.779297,  0.779778,  0.780258,
-	 0.780737,  0.781216,  0.781695,  0.782173,  0.782651,  0.783128,  0.783605,  0.784081,
-	 0.784557,  0.785032,  0.785507,  0.785981,  0.786455,  0.786929,  0.787402,  0.787874,
-	 0.788346,  0.788818,  0.789289,  0.789760,  0.790230,  0.790700,  0.791169,  0.791638,
-	 0.792107,  0.792575,  0.793042,  0.793509,  0.793975,  0.794442,  0.794907,  0.795372,
-	 0.795837,  0.796301,  0.796765,  0.797228,  0.797691,  0.798153,  0.798615,  0.799076,
-	 0.799537,  0.799998,  0.800458,  0.800917,  0.801376,  0.801835,  0.802293,  0.802750,
-	 0.803208,  0.803664,  0.804120,  0.804576,  0.805031,  0.805486,  0.805940,  0.806394,
-	 0.806848,  0.807300,  0.807753,  0.808205,  0.808656,  0.809107,  0.809558,  0.810008,
-	 0.810457,  0.810906,  0.811355,  0.811803,  0.812251,  0.812698,  0.813144,  0.813591,
-	 0.814036,  0.814482,  0.814926,  0.815371,  0.815814,  0.816258,  0.816701,  0.817143,
-	 0.817585,  0.818026,  0.818467,  0.818908,  0.819348,  0.819787,  0.820226,  0.820664,
-	 0.821102,  0.821540,  0.821977,  0.822414,  0.822850,  0.823285,  0.823721,  0.824155,
-	 0.824589,  0.825023,  0.825456,  0.825889,  0.826321,  0.826753,  0.827184,  0.827615,
-	 0.828045,  0.828475,  0.828904,  0.829333,  0.829761,  0.830189,  0.830616,  0.831043,
-	 0.831470,  0.831895,  0.832321,  0.832746,  0.833170,  0.833594,  0.834018,  0.834440,
-	 0.834863,  0.835285,  0.835706,  0.836127,  0.836548,  0.836968,  0.837387,  0.837806,
-	 0.838225,  0.838643,  0.839060,  0.839477,  0.839894,  0.840310,  0.840725,  0.841140,
-	 0.841555,  0.841969,  0.842383,  0.842796,  0.843208,  0.843620,  0.844032,  0.844443,
-	 0.844854,  0.845264,  0.845673,  0.846082,  0.846491,  0.846899,  0.847307,  0.847714,
-	 0.848120,  0.848526,  0.848932,  0.849337,  0.849742,  0.850146,  0.850549,  0.850953,
-	 0.851355,  0.851757,  0.852159,  0.852560,  0.852961,  0.853361,  0.853760,  0.854159,
-	 0.854558,  0.854956,  0.855354,  0.855751,  0.856147,  0.856543,  0.856939,  0.857334,
-	 0.857729,  0.858123,  0.858516,  0.858909,  0.859302,  0.859694,  0.860085,  0.860476,
-	 0.860867,  0.861257,  0.861646,  0.862035,  0.862424,  0.862812,  0.863199,  0.863586,
-	 0.863973,  0.864359,  0.864744,  0.865129,  0.865514,  0.865898,  0.866281,  0.866664,
-	 0.867046,  0.867428,  0.867809,  0.868190,  0.868571,  0.868951,  0.869330,  0.869709,
-	 0.870087,  0.870465,  0.870842,  0.871219,  0.871595,  0.871971,  0.872346,  0.872721,
-	 0.873095,  0.873469,  0.873842,  0.874215,  0.874587,  0.874958,  0.875329,  0.875700,
-	 0.876070,  0.876440,  0.876809,  0.877177,  0.877545,  0.877913,  0.878280,  0.878646,
-	 0.879012,  0.879378,  0.879743,  0.880107,  0.880471,  0.880834,  0.881197,  0.881559,
-	 0.881921,  0.882283,  0.882643,  0.883004,  0.883363,  0.883723,  0.884081,  0.884439,
-	 0.884797,  0.885154,  0.885511,  0.885867,  0.886223,  0.886578,  0.886932,  0.887286,
-	 0.887640,  0.887993,  0.888345,  0.888697,  0.889048,  0.889399,  0.889750,  0.890099,
-	 0.890449,  0.890797,  0.891146,  0.891493,  0.891841,  0.892187,  0.892534,  0.892879,
-	 0.893224,  0.893569,  0.893913,  0.894256,  0.894599,  0.894942,  0.895284,  0.895625,
-	 0.895966,  0.896307,  0.896646,  0.896986,  0.897325,  0.897663,  0.898001,  0.898338,
-	 0.898674,  0.899011,  0.899346,  0.899681,  0.900016,  0.900350,  0.900683,  0.901016,
-	 0.901349,  0.901681,  0.902012,  0.902343,  0.902673,  0.903003,  0.903332,  0.903661,
-	 0.903989,  0.904317,  0.904644,  0.904971,  0.905297,  0.905622,  0.905947,  0.906272,
-	 0.906596,  0.906919,  0.907242,  0.907564,  0.907886,  0.908207,  0.908528,  0.908848,
-	 0.909168,  0.909487,  0.909806,  0.910124,  0.910441,  0.910758,  0.911075,  0.911391,
-	 0.911706,  0.912021,  0.912335,  0.912649,  0.912962,  0.913275,  0.913587,  0.913899,
-	 0.914210,  0.914520,  0.914830,  0.915140,  0.915449,  0.915757,  0.916065,  0.916372,
-	 0.916679,  0.916985,  0.917291,  0.917596,  0.917901,  0.918205,  0.918508,  0.918811,
-	 0.919114,  0.919416,  0.919717,  0.920018,  0.920318,  0.920618,  0.920917,  0.921216,
-	 0.921514,  0.921812,  0.922109,  0.922405,  0.922701,  0.922997,  0.923291,  0.923586,
-	 0.923880,  0.924173,  0.924465,  0.924758,  0.925049,  0.925340,  0.925631,  0.925921,
-	 0.926210,  0.926499,  0.926787,  0.927075,  0.927363,  0.927649,  0.927935,  0.928221,
-	 0.928506,  0.928791,  0.929075,  0.929358,  0.929641,  0.929923,  0.930205,  0.930486,
-	 0.930767,  0.931047,  0.931327,  0.931606,  0.931884,  0.932162,  0.932440,  0.932716,
-	 0.932993,  0.933269,  0.933544,  0.933818,  0.934093,  0.934366,  0.934639,  0.934912,
-	 0.935184,  0.935455,  0.935726,  0.935996,  0.936266,  0.936535,  0.936803,  0.937072,
-	 0.937339,  0.937606,  0.937872,  0.938138,  0.938404,  0.938668,  0.938932,  0.939196,
-	 0.939459,  0.939722,  0.939984,  0.940245,  0.940506,  0.940766,  0.941026,  0.941285,
-	 0.941544,  0.941802,  0.942060,  0.942317,  0.942573,  0.942829,  0.943084,  0.943339,
-	 0.943593,  0.943847,  0.944100,  0.944353,  0.944605,  0.944856,  0.945107,  0.945358,
-	 0.945607,  0.945857,  0.946105,  0.946353,  0.946601,  0.946848,  0.947094,  0.947340,
-	 0.947586,  0.947830,  0.948075,  0.948318,  0.948561,  0.948804,  0.949046,  0.949287,
-	 0.949528,  0.949768,  0.950008,  0.950247,  0.950486,  0.950724,  0.950962,  0.951199,
-	 0.951435,  0.951671,  0.951906,  0.952141,  0.952375,  0.952609,  0.952842,  0.953074,
-	 0.953306,  0.953537,  0.953768,  0.953998,  0.954228,  0.954457,  0.954686,  0.954914,
-	 0.955141,  0.955368,  0.955594,  0.955820,  0.956045,  0.956270,  0.956494,  0.956717,
-	 0.956940,  0.957163,  0.957385,  0.957606,  0.957826,  0.958046,  0.958266,  0.958485,
-	 0.958703,  0.958921,  0.959139,  0.959355,  0.959572,  0.959787,  0.960002,  0.960217,
-	 0.960431,  0.960644,  0.960857,  0.961069,  0.961280,  0.961492,  0.961702,  0.961912,
-	 0.962121,  0.962330,  0.962538,  0.962746,  0.962953,  0.963160,  0.963366,  0.963571,
-	 0.963776,  0.963980,  0.964184,  0.964387,  0.964590,  0.964792,  0.964993,  0.965194,
-	 0.965394,  0.965594,  0.965793,  0.965992,  0.966190,  0.966387,  0.966584,  0.966781,
-	 0.966976,  0.967172,  0.967366,  0.967560,  0.967754,  0.967947,  0.968139,  0.968331,
-	 0.968522,  0.968713,  0.968903,  0.969092,  0.969281,  0.969470,  0.969657,  0.969845,
-	 0.970031,  0.970217,  0.970403,  0.970588,  0.970772,  0.970956,  0.971139,  0.971322,
-	 0.971504,  0.971685,  0.971866,  0.972047,  0.972227,  0.972406,  0.972584,  0.972762,
-	 0.972940,  0.973117,  0.973293,  0.973469,  0.973644,  0.973819,  0.973993,  0.974166,
-	 0.974339,  0.974512,  0.974684,  0.974855,  0.975025,  0.975195,  0.975365,  0.975534,
-	 0.975702,  0.975870,  0.976037,  0.976204,  0.976370,  0.976535,  0.976700,  0.976864,
-	 0.977028,  0.977191,  0.977354,  0.977516,  0.977677,  0.977838,  0.977998,  0.978158,
-	 0.978317,  0.978476,  0.978634,  0.978791,  0.978948,  0.979104,  0.979260,  0.979415,
-	 0.979570,  0.979724,  0.979877,  0.980030,  0.980182,  0.980334,  0.980485,  0.980635,
-	 0.980785,  0.980935,  0.981083,  0.981232,  0.981379,  0.981526,  0.981673,  0.981819,
-	 0.981964,  0.982109,  0.982253,  0.982396,  0.982539,  0.982682,  0.982824,  0.982965,
-	 0.983105,  0.983246,  0.983385,  0.983524,  0.983662,  0.983800,  0.983937,  0.984074,
-	 0.984210,  0.984346,  0.984480,  0.984615,  0.984748,  0.984882,  0.985014,  0.985146,
-	 0.985278,  0.985408,  0.985539,  0.985668,  0.985798,  0.985926,  0.986054,  0.986181,
-	 0.986308,  0.986434,  0.986560,  0.986685,  0.986809,  0.986933,  0.987057,  0.987179,
-	 0.987301,  0.987423,  0.987544,  0.987664,  0.987784,  0.987903,  0.988022,  0.988140,
-	 0.988258,  0.988374,  0.988491,  0.988607,  0.988722,  0.988836,  0.988950,  0.989064,
-	 0.989177,  0.989289,  0.989400,  0.989511,  0.989622,  0.989732,  0.989841,  0.989950,
-	 0.990058,  0.990166,  0.990273,  0.990379,  0.990485,  0.990590,  0.990695,  0.990799,
-	 0.990903,  0.991006,  0.991108,  0.991210,  0.991311,  0.991411,  0.991511,  0.991611,
-	 0.991710,  0.991808,  0.991906,  0.992003,  0.992099,  0.992195,  0.992291,  0.992385,
-	 0.992480,  0.992573,  0.992666,  0.992759,  0.992850,  0.992942,  0.993032,  0.993122,
-	 0.993212,  0.993301,  0.993389,  0.993477,  0.993564,  0.993651,  0.993737,  0.993822,
-	 0.993907,  0.993991,  0.994075,  0.994158,  0.994240,  0.994322,  0.994404,  0.994484,
-	 0.994565,  0.994644,  0.994723,  0.994802,  0.994879,  0.994957,  0.995033,  0.995109,
-	 0.995185,  0.995260,  0.995334,  0.995408,  0.995481,  0.995553,  0.995625,  0.995697,
-	 0.995767,  0.995838,  0.995907,  0.995976,  0.996045,  0.996113,  0.996180,  0.996247,
-	 0.996313,  0.996378,  0.996443,  0.996507,  0.996571,  0.996634,  0.996697,  0.996759,
-	 0.996820,  0.996881,  0.996941,  0.997001,  0.997060,  0.997119,  0.997176,  0.997234,
-	 0.997290,  0.997347,  0.997402,  0.997457,  0.997511,  0.997565,  0.997618,  0.997671,
-	 0.997723,  0.997774,  0.997825,  0.997876,  0.997925,  0.997974,  0.998023,  0.998071,
-	 0.998118,  0.998165,  0.998211,  0.998257,  0.998302,  0.998346,  0.998390,  0.998433,
-	 0.998476,  0.998518,  0.998559,  0.998600,  0.998640,  0.998680,  0.998719,  0.998758,
-	 0.998795,  0.998833,  0.998870,  0.998906,  0.998941,  0.998976,  0.999011,  0.999044,
-	 0.999078,  0.999110,  0.999142,  0.999174,  0.999205,  0.999235,  0.999265,  0.999294,
-	 0.999322,  0.999350,  0.999378,  0.999404,  0.999431,  0.999456,  0.999481,  0.999506,
-	 0.999529,  0.999553,  0.999575,  0.999597,  0.999619,  0.999640,  0.999660,  0.999680,
-	 0.999699,  0.999717,  0.999735,  0.999753,  0.999769,  0.999786,  0.999801,  0.999816,
-	 0.999831,  0.999844,  0.999858,  0.999870,  0.999882,  0.999894,  0.999905,  0.999915,
-	 0.999925,  0.999934,  0.999942,  0.999950,  0.999958,  0.999964,  0.999971,  0.999976,
-	 0.999981,  0.999986,  0.999989,  0.999993,  0.999995,  0.999997,  0.999999,  1.000000
-};
+		float *table = _data[bits];
+		while (((size_t) table) & 31)
+			table++;
 
-static const float cosTable16384[8192] = {
-	 1.000000,  1.000000,  1.000000,  0.999999,  0.999999,  0.999998,  0.999997,  0.999996,
-	 0.999995,  0.999994,  0.999993,  0.999991,  0.999989,  0.999988,  0.999986,  0.999983,
-	 0.999981,  0.999979,  0.999976,  0.999973,  0.999971,  0.999968,  0.999964,  0.999961,
-	 0.999958,  0.999954,  0.999950,  0.999946,  0.999942,  0.999938,  0.999934,  0.999929,
-	 0.999925,  0.999920,  0.999915,  0.999910,  0.999905,  0.999899,  0.999894,  0.999888,
-	 0.999882,  0.999876,  0.999870,  0.999864,  0.999858,  0.999851,  0.999844,  0.999838,
-	 0.999831,  0.999823,  0.999816,  0.999809,  0.999801,  0.999793,  0.999786,  0.999778,
-	 0.999769,  0.999761,  0.999753,  0.999744,  0.999735,  0.999726,  0.999717,  0.999708,
-	 0.999699,  0.999689,  0.999680,  0.999670,  0.999660,  0.999650,  0.999640,  0.999629,
-	 0.999619,  0.999608,  0.999597,  0.999586,  0.999575,  0.999564,  0.999553,  0.999541,
-	 0.999529,  0.999518,  0.999506,  0.999493,  0.999481,  0.999469,  0.999456,  0.999443,
-	 0.999431,  0.999418,  0.999404,  0.999391,  0.999378,  0.999364,  0.999350,  0.999336,
-	 0.999322,  0.999308,  0.999294,  0.999279,  0.999265,  0.999250,  0.999235,  0.999220,
-	 0.999205,  0.999189,  0.999174,  0.999158,  0.999142,  0.999126,  0.999110,  0.999094,
-	 0.999078,  0.999061,  0.999044,  0.999028,  0.999011,  0.998994,  0.998976,  0.998959,
-	 0.998941,  0.998924,  0.998906,  0.998888,  0.998870,  0.998851,  0.998833,  0.998814,
-	 0.998795,  0.998777,  0.998758,  0.998738,  0.998719,  0.998700,  0.998680,  0.998660,
-	 0.998640,  0.998620,  0.998600,  0.998580,  0.998559,  0.998538,  0.998518,  0.998497,
-	 0.998476,  0.998454,  0.998433,  0.998411,  0.998390,  0.998368,  0.998346,  0.998324,
-	 0.998302,  0.998279,  0.998257,  0.998234,  0.998211,  0.998188,  0.998165,  0.998142,
-	 0.998118,  0.998094,  0.998071,  0.998047,  0.998023,  0.997999,  0.997974,  0.997950,
-	 0.997925,  0.997901,  0.997876,  0.997851,  0.997825,  0.997800,  0.997774,  0.997749,
-	 0.997723,  0.997697,  0.997671,  0.997645,  0.997618,  0.997592,  0.997565,  0.997538,
-	 0.997511,  0.997484,  0.997457,  0.997430,  0.997402,  0.997374,  0.997347,  0.997319,
-	 0.997290,  0.997262,  0.997234,  0.997205,  0.997176,  0.997148,  0.997119,  0.997089,
-	 0.997060,  0.997031,  0.997001,  0.996971,  0.996941,  0.996911,  0.996881,  0.996851,
-	 0.996820,  0.996790,  0.996759,  0.996728,  0.996697,  0.996666,  0.996634,  0.996603,
-	 0.996571,  0.996539,  0.996507,  0.996475,  0.996443,  0.996411,  0.996378,  0.996345,
-	 0.996313,  0.996280,  0.996247,  0.996213,  0.996180,  0.996146,  0.996113,  0.996079,
-	 0.996045,  0.996011,  0.995976,  0.995942,  0.995907,  0.995872,  0.995838,  0.995803,
-	 0.995767,  0.995732,  0.995697,  0.995661,  0.995625,  0.995589,  0.995553,  0.995517,
-	 0.995481,  0.995444,  0.995408,  0.995371,  0.995334,  0.995297,  0.995260,  0.995222,
-	 0.995185,  0.995147,  0.995109,  0.995071,  0.995033,  0.994995,  0.994957,  0.994918,
-	 0.994879,  0.994841,  0.994802,  0.994762,  0.994723,  0.994684,  0.994644,  0.994604,
-	 0.994565,  0.994525,  0.994484,  0.994444,  0.994404,  0.994363,  0.994322,  0.994281,
-	 0.994240,  0.994199,  0.994158,  0.994116,  0.994075,  0.994033,  0.993991,  0.993949,
-	 0.993907,  0.993865,  0.993822,  0.993779,  0.993737,  0.993694,  0.993651,  0.993608,
-	 0.993564,  0.993521,  0.993477,  0.993433,  0.993389,  0.993345,  0.993301,  0.993257,
-	 0.993212,  0.993167,  0.993122,  0.993077,  0.993032,  0.992987,  0.992942,  0.992896,
-	 0.992850,  0.992805,  0.992759,  0.992712,  0.992666,  0.992620,  0.992573,  0.992526,
-	 0.992480,  0.992433,  0.992385,  0.992338,  0.992291,  0.992243,  0.992195,  0.992147,
-	 0.992099,  0.992051,  0.992003,  0.991954,  0.991906,  0.991857,  0.991808,  0.991759,
-	 0.991710,  0.991660,  0.991611,  0.991561,  0.991511,  0.991462,  0.991411,  0.991361,
-	 0.991311,  0.991260,  0.991210,  0.991159,  0.991108,  0.991057,  0.991006,  0.990954,
-	 0.990903,  0.990851,  0.990799,  0.990747,  0.990695,  0.990643,  0.990590,  0.990538,
-	 0.990485,  0.990432,  0.990379,  0.990326,  0.990273,  0.990219,  0.990166,  0.990112,
-	 0.990058,  0.990004,  0.989950,  0.989896,  0.989841,  0.989787,  0.989732,  0.989677,
-	 0.989622,  0.989567,  0.989511,  0.989456,  0.989400,  0.989345,  0.989289,  0.989233,
-	 0.989177,  0.989120,  0.989064,  0.989007,  0.988950,  0.988893,  0.988836,  0.988779,
-	 0.988722,  0.988664,  0.988607,  0.988549,  0.988491,  0.988433,  0.988374,  0.988316,
-	 0.988258,  0.988199,  0.988140,  0.988081,  0.988022,  0.987963,  0.987903,  0.987844,
-	 0.987784,  0.987724,  0.987664,  0.987604,  0.987544,  0.987484,  0.987423,  0.987362,
-	 0.987301,  0.987240,  0.987179,  0.987118,  0.987057,  0.986995,  0.986933,  0.986871,
-	 0.986809,  0.986747,  0.986685,  0.986623,  0.986560,  0.986497,  0.986434,  0.986371,
-	 0.986308,  0.986245,  0.986181,  0.986118,  0.986054,  0.985990,  0.985926,  0.985862,
-	 0.985798,  0.985733,  0.985668,  0.985604,  0.985539,  0.985474,  0.985408,  0.985343,
-	 0.985278,  0.985212,  0.985146,  0.985080,  0.985014,  0.984948,  0.984882,  0.984815,
-	 0.984748,  0.984682,  0.984615,  0.984548,  0.984480,  0.984413,  0.984346,  0.984278,
-	 0.984210,  0.984142,  0.984074,  0.984006,  0.983937,  0.983869,  0.983800,  0.983731,
-	 0.983662,  0.983593,  0.983524,  0.983455,  0.983385,  0.983315,  0.983246,  0.983176,
-	 0.983105,  0.983035,  0.982965,  0.982894,  0.982824,  0.982753,  0.982682,  0.982611,
-	 0.982539,  0.982468,  0.982396,  0.982325,  0.982253,  0.982181,  0.982109,  0.982036,
-	 0.981964,  0.981891,  0.981819,  0.981746,  0.981673,  0.981600,  0.981526,  0.981453,
-	 0.981379,  0.981305,  0.981232,  0.981158,  0.981083,  0.981009,  0.980935,  0.980860,
-	 0.980785,  0.980710,  0.980635,  0.980560,  0.980485,  0.980409,  0.980334,  0.980258,
-	 0.980182,  0.980106,  0.980030,  0.979954,  0.979877,  0.979800,  0.979724,  0.979647,
-	 0.979570,  0.979493,  0.979415,  0.979338,  0.979260,  0.979182,  0.979104,  0.979026,
-	 0.978948,  0.978870,  0.978791,  0.978713,  0.978634,  0.978555,  0.978476,  0.978397,
-	 0.978317,  0.978238,  0.978158,  0.978078,  0.977998,  0.977918,  0.977838,  0.977758,
-	 0.977677,  0.977597,  0.977516,  0.977435,  0.977354,  0.977273,  0.977191,  0.977110,
-	 0.977028,  0.976946,  0.976864,  0.976782,  0.976700,  0.976618,  0.976535,  0.976453,
-	 0.976370,  0.976287,  0.976204,  0.976120,  0.976037,  0.975954,  0.975870,  0.975786,
-	 0.975702,  0.975618,  0.975534,  0.975449,  0.975365,  0.975280,  0.975195,  0.975110,
-	 0.975025,  0.974940,  0.974855,  0.974769,  0.974684,  0.974598,  0.974512,  0.974426,
-	 0.974339,  0.974253,  0.974166,  0.974080,  0.973993,  0.973906,  0.973819,  0.973732,
-	 0.973644,  0.973557,  0.973469,  0.973381,  0.973293,  0.973205,  0.973117,  0.973028,
-	 0.972940,  0.972851,  0.972762,  0.972673,  0.972584,  0.972495,  0.972406,  0.972316,
-	 0.972227,  0.972137,  0.972047,  0.971957,  0.971866,  0.971776,  0.971685,  0.971595,
-	 0.971504,  0.971413,  0.971322,  0.971231,  0.971139,  0.971048,  0.970956,  0.970864,
-	 0.970772,  0.970680,  0.970588,  0.970495,  0.970403,  0.970310,  0.970217,  0.970124,
-	 0.970031,  0.969938,  0.969845,  0.969751,  0.969657,  0.969564,  0.969470,  0.969375,
-	 0.969281,  0.969187,  0.969092,  0.968998,  0.968903,  0.968808,  0.968713,  0.968617,
-	 0.968522,  0.968427,  0.968331,  0.968235,  0.968139,  0.968043,  0.967947,  0.967850,
-	 0.967754,  0.967657,  0.967560,  0.967463,  0.967366,  0.967269,  0.967172,  0.967074,
-	 0.966976,  0.966879,  0.966781,  0.966683,  0.966584,  0.966486,  0.966387,  0.966289,
-	 0.966190,  0.966091,  0.965992,  0.965893,  0.965793,  0.965694,  0.965594,  0.965494,
-	 0.965394,  0.965294,  0.965194,  0.965094,  0.964993,  0.964893,  0.964792,  0.964691,
-	 0.964590,  0.964489,  0.964387,  0.964286,  0.964184,  0.964082,  0.963980,  0.963878,
-	 0.963776,  0.963674,  0.963571,  0.963469,  0.963366,  0.963263,  0.963160,  0.963057,
-	 0.962953,  0.962850,  0.962746,  0.962642,  0.962538,  0.962434,  0.962330,  0.962226,
-	 0.962121,  0.962017,  0.961912,  0.961807,  0.961702,  0.961597,  0.961492,  0.961386,
-	 0.961280,  0.961175,  0.961069,  0.960963,  0.960857,  0.960750,  0.960644,  0.960537,
-	 0.960431,  0.960324,  0.960217,  0.960109,  0.960002,  0.959895,  0.959787,  0.959679,
-	 0.959572,  0.959463,  0.959355,  0.959247,  0.959139,  0.959030,  0.958921,  0.958812,
-	 0.958703,  0.958594,  0.958485,  0.958376,  0.958266,  0.958156,  0.958046,  0.957937,
-	 0.957826,  0.957716,  0.957606,  0.957495,  0.957385,  0.957274,  0.957163,  0.957052,
-	 0.956940,  0.956829,  0.956717,  0.956606,  0.956494,  0.956382,  0.956270,  0.956158,
-	 0.956045,  0.955933,  0.955820,  0.955707,  0.955594,  0.955481,  0.955368,  0.955255,
-	 0.955141,  0.955028,  0.954914,  0.954800,  0.954686,  0.954572,  0.954457,  0.954343,
-	 0.954228,  0.954113,  0.953998,  0.953883,  0.953768,  0.953653,  0.953537,  0.953422,
-	 0.953306,  0.953190,  0.953074,  0.952958,  0.952842,  0.952725,  0.952609,  0.952492,
-	 0.952375,  0.952258,  0.952141,  0.952024,  0.951906,  0.951789,  0.951671,  0.951553,
-	 0.951435,  0.951317,  0.951199,  0.951080,  0.950962,  0.950843,  0.950724,  0.950605,
-	 0.950486,  0.950367,  0.950247,  0.950128,  0.950008,  0.949888,  0.949768,  0.949648,
-	 0.949528,  0.949408,  0.949287,  0.949167,  0.949046,  0.948925,  0.948804,  0.948683,
-	 0.948561,  0.948440,  0.948318,  0.948196,  0.948075,  0.947953,  0.947830,  0.947708,
-	 0.947586,  0.947463,  0.947340,  0.947217,  0.947094,  0.946971,  0.946848,  0.946724,
-	 0.946601,  0.946477,  0.946353,  0.946229,  0.946105,  0.945981,  0.945857,  0.945732,
-	 0.945607,  0.945482,  0.945358,  0.945232,  0.945107,  0.944982,  0.944856,  0.944731,
-	 0.944605,  0.944479,  0.944353,  0.944227,  0.944100,  0.943974,  0.943847,  0.943720,
-	 0.943593,  0.943466,  0.943339,  0.943212,  0.943084,  0.942957,  0.942829,  0.942701,
-	 0.942573,  0.942445,  0.942317,  0.942188,  0.942060,  0.941931,  0.941802,  0.941673,
-	 0.941544,  0.941415,  0.941285,  0.941156,  0.941026,  0.940896,  0.940766,  0.940636,
-	 0.940506,  0.940376,  0.940245,  0.940115,  0.939984,  0.939853,  0.939722,  0.939591,
-	 0.939459,  0.939328,  0.939196,  0.939064,  0.938932,  0.938800,  0.938668,  0.938536,
-	 0.938404,  0.938271,  0.938138,  0.938005,  0.937872,  0.937739,  0.937606,  0.937473,
-	 0.937339,  0.937205,  0.937072,  0.936938,  0.936803,  0.936669,  0.936535,  0.936400,
-	 0.936266,  0.936131,  0.935996,  0.935861,  0.935726,  0.935590,  0.935455,  0.935319,
-	 0.935184,  0.935048,  0.934912,  0.934775,  0.934639,  0.934503,  0.934366,  0.934229,
-	 0.934093,  0.933956,  0.933818,  0.933681,  0.933544,  0.933406,  0.933269,  0.933131,
-	 0.932993,  0.932855,  0.932716,  0.932578,  0.932440,  0.932301,  0.932162,  0.932023,
-	 0.931884,  0.931745,  0.931606,  0.931466,  0.931327,  0.931187,  0.931047,  0.930907,
-	 0.930767,  0.930627,  0.930486,  0.930346,  0.930205,  0.930064,  0.929923,  0.929782,
-	 0.929641,  0.929500,  0.929358,  0.929216,  0.929075,  0.928933,  0.928791,  0.928648,
-	 0.928506,  0.928364,  0.928221,  0.928078,  0.927935,  0.927792,  0.927649,  0.927506,
-	 0.927363,  0.927219,  0.927075,  0.926931,  0.926787,  0.926643,  0.926499,  0.926355,
-	 0.926210,  0.926066,  0.925921,  0.925776,  0.925631,  0.925486,  0.925340,  0.925195,
-	 0.925049,  0.924904,  0.924758,  0.924612,  0.924465,  0.924319,  0.924173,  0.924026,
-	 0.923880,  0.923733,  0.923586,  0.923439,  0.923291,  0.923144,  0.922997,  0.922849,
-	 0.922701,  0.922553,  0.922405,  0.922257,  0.922109,  0.921960,  0.921812,  0.921663,
-	 0.921514,  0.921365,  0.921216,  0.921067,  0.920917,  0.920768,  0.920618,  0.920468,
-	 0.920318,  0.920168,  0.920018,  0.919868,  0.919717,  0.919567,  0.919416,  0.919265,
-	 0.919114,  0.918963,  0.918811,  0.918660,  0.918508,  0.918357,  0.918205,  0.918053,
-	 0.917901,  0.917749,  0.917596,  0.917444,  0.917291,  0.917138,  0.916985,  0.916832,
-	 0.916679,  0.916526,  0.916372,  0.916219,  0.916065,  0.915911,  0.915757,  0.915603,
-	 0.915449,  0.915294,  0.915140,  0.914985,  0.914830,  0.914675,  0.914520,  0.914365,
-	 0.914210,  0.914054,  0.913899,  0.913743,  0.913587,  0.913431,  0.913275,  0.913119,
-	 0.912962,  0.912806,  0.912649,  0.912492,  0.912335,  0.912178,  0.912021,  0.911864,
-	 0.911706,  0.911548,  0.911391,  0.911233,  0.911075,  0.910917,  0.910758,  0.910600,
-	 0.910441,  0.910283,  0.910124,  0.909965,  0.909806,  0.909646,  0.909487,  0.909328,
-	 0.909168,  0.909008,  0.908848,  0.908688,  0.908528,  0.908368,  0.908207,  0.908047,
-	 0.907886,  0.907725,  0.907564,  0.907403,  0.907242,  0.907081,  0.906919,  0.906757,
-	 0.906596,  0.906434,  0.906272,  0.906110,  0.905947,  0.905785,  0.905622,  0.905460,
-	 0.905297,  0.905134,  0.904971,  0.904807,  0.904644,  0.904481,  0.904317,  0.904153,
-	 0.903989,  0.903825,  0.903661,  0.903497,  0.903332,  0.903168,  0.903003,  0.902838,
-	 0.902673,  0.902508,  0.902343,  0.902178,  0.902012,  0.901847,  0.901681,  0.901515,
-	 0.901349,  0.901183,  0.901016,  0.900850,  0.900683,  0.900517,  0.900350,  0.900183,
-	 0.900016,  0.899849,  0.899681,  0.899514,  0.899346,  0.899179,  0.899011,  0.898843,
-	 0.898674,  0.898506,  0.898338,  0.898169,  0.898001,  0.897832,  0.897663,  0.897494,
-	 0.897325,  0.897155,  0.896986,  0.896816,  0.896646,  0.896477,  0.896307,  0.896137,
-	 0.895966,  0.895796,  0.895625,  0.895455,  0.895284,  0.895113,  0.894942,  0.894771,
-	 0.894599,  0.894428,  0.894256,  0.894085,  0.893913,  0.893741,  0.893569,  0.893397,
-	 0.893224,  0.893052,  0.892879,  0.892706,  0.892534,  0.892361,  0.892187,  0.892014,
-	 0.891841,  0.891667,  0.891493,  0.891320,  0.891146,  0.890972,  0.890797,  0.890623,
-	 0.890449,  0.890274,  0.890099,  0.889925,  0.889750,  0.889574,  0.889399,  0.889224,
-	 0.889048,  0.888873,  0.888697,  0.888521,  0.888345,  0.888169,  0.887993,  0.887816,
-	 0.887640,  0.887463,  0.887286,  0.887109,  0.886932,  0.886755,  0.886578,  0.886400,
-	 0.886223,  0.886045,  0.885867,  0.885689,  0.885511,  0.885333,  0.885154,  0.884976,
-	 0.884797,  0.884618,  0.884439,  0.884260,  0.884081,  0.883902,  0.883723,  0.883543,
-	 0.883363,  0.883184,  0.883004,  0.882824,  0.882643,  0.882463,  0.882283,  0.882102,
-	 0.881921,  0.881740,  0.881559,  0.881378,  0.881197,  0.881016,  0.880834,  0.880653,
-	 0.880471,  0.880289,  0.880107,  0.879925,  0.879743,  0.879560,  0.879378,  0.879195,
-	 0.879012,  0.878829,  0.878646,  0.878463,  0.878280,  0.878096,  0.877913,  0.877729,
-	 0.877545,  0.877361,  0.877177,  0.876993,  0.876809,  0.876624,  0.876440,  0.876255,
-	 0.876070,  0.875885,  0.875700,  0.875515,  0.875329,  0.875144,  0.874958,  0.874773,
-	 0.874587,  0.874401,  0.874215,  0.874028,  0.873842,  0.873655,  0.873469,  0.873282,
-	 0.873095,  0.872908,  0.872721,  0.872534,  0.872346,  0.872159,  0.871971,  0.871783,
-	 0.871595,  0.871407,  0.871219,  0.871031,  0.870842,  0.870654,  0.870465,  0.870276,
-	 0.870087,  0.869898,  0.869709,  0.869519,  0.869330,  0.869140,  0.868951,  0.868761,
-	 0.868571,  0.868381,  0.868190,  0.868000,  0.867809,  0.867619,  0.867428,  0.867237,
-	 0.867046,  0.866855,  0.866664,  0.866472,  0.866281,  0.866089,  0.865898,  0.865706,
-	 0.865514,  0.865321,  0.865129,  0.864937,  0.864744,  0.864552,  0.864359,  0.864166,
-	 0.863973,  0.863780,  0.863586,  0.863393,  0.863199,  0.863006,  0.862812,  0.862618,
-	 0.862424,  0.862230,  0.862035,  0.861841,  0.861646,  0.861452,  0.861257,  0.861062,
-	 0.860867,  0.860672,  0.860476,  0.860281,  0.860085,  0.859890,  0.859694,  0.859498,
-	 0.859302,  0.859106,  0.858909,  0.858713,  0.858516,  0.858320,  0.858123,  0.857926,
-	 0.857729,  0.857531,  0.857334,  0.857137,  0.856939,  0.856741,  0.856543,  0.856345,
-	 0.856147,  0.855949,  0.855751,  0.855552,  0.855354,  0.855155,  0.854956,  0.854757,
-	 0.854558,  0.854359,  0.854159,  0.853960,  0.853760,  0.853561,  0.853361,  0.853161,
-	 0.852961,  0.852760,  0.852560,  0.852360,  0.852159,  0.851958,  0.851757,  0.851556,
-	 0.851355,  0.851154,  0.850953,  0.850751,  0.850549,  0.850348,  0.850146,  0.849944,
-	 0.849742,  0.849540,  0.849337,  0.849135,  0.848932,  0.848729,  0.848526,  0.848323,
-	 0.848120,  0.847917,  0.847714,  0.847510,  0.847307,  0.847103,  0.846899,  0.846695,
-	 0.846491,  0.846287,  0.846082,  0.845878,  0.845673,  0.845469,  0.845264,  0.845059,
-	 0.844854,  0.844648,  0.844443,  0.844238,  0.844032,  0.843826,  0.843620,  0.843414,
-	 0.843208,  0.843002,  0.842796,  0.842589,  0.842383,  0.842176,  0.841969,  0.841762,
-	 0.841555,  0.841348,  0.841140,  0.840933,  0.840725,  0.840518,  0.840310,  0.840102,
-	 0.839894,  0.839686,  0.839477,  0.839269,  0.839060,  0.838852,  0.838643,  0.838434,
-	 0.838225,  0.838015,  0.837806,  0.837597,  0.837387,  0.837178,  0.836968,  0.836758,
-	 0.836548,  0.836338,  0.836127,  0.835917,  0.835706,  0.835496,  0.835285,  0.835074,
-	 0.834863,  0.834652,  0.834440,  0.834229,  0.834018,  0.833806,  0.833594,  0.833382,
-	 0.833170,  0.832958,  0.832746,  0.832533,  0.832321,  0.832108,  0.831895,  0.831683,
-	 0.831470,  0.831257,  0.831043,  0.830830,  0.830616,  0.830403,  0.830189,  0.829975,
-	 0.829761,  0.829547,  0.829333,  0.829119,  0.828904,  0.828690,  0.828475,  0.828260,
-	 0.828045,  0.827830,  0.827615,  0.827399,  0.827184,  0.826968,  0.826753,  0.826537,
-	 0.826321,  0.826105,  0.825889,  0.825673,  0.825456,  0.825240,  0.825023,  0.824806,
-	 0.824589,  0.824372,  0.824155,  0.823938,  0.823721,  0.823503,  0.823285,  0.823068,
-	 0.822850,  0.822632,  0.822414,  0.822195,  0.821977,  0.821759,  0.821540,  0.821321,
-	 0.821102,  0.820884,  0.820664,  0.820445,  0.820226,  0.820007,  0.819787,  0.819567,
-	 0.819348,  0.819128,  0.818908,  0.818687,  0.818467,  0.818247,  0.818026,  0.817806,
-	 0.817585,  0.817364,  0.817143,  0.816922,  0.816701,  0.816479,  0.816258,  0.816036,
-	 0.815814,  0.815593,  0.815371,  0.815149,  0.814926,  0.814704,  0.814482,  0.814259,
-	 0.814036,  0.813814,  0.813591,  0.813368,  0.813144,  0.812921,  0.812698,  0.812474,
-	 0.812251,  0.812027,  0.811803,  0.811579,  0.811355,  0.811131,  0.810906,  0.810682,
-	 0.810457,  0.810232,  0.810008,  0.809783,  0.809558,  0.809332,  0.809107,  0.808882,
-	 0.808656,  0.808430,  0.808205,  0.807979,  0.807753,  0.807527,  0.807300,  0.807074,
-	 0.806848,  0.806621,  0.806394,  0.806167,  0.805940,  0.805713,  0.805486,  0.805259,
-	 0.805031,  0.804804,  0.804576,  0.804348,  0.804120,  0.803892,  0.803664,  0.803436,
-	 0.803208,  0.802979,  0.802750,  0.802522,  0.802293,  0.802064,  0.801835,  0.801606,
-	 0.801376,  0.801147,  0.800917,  0.800687,  0.800458,  0.800228,  0.799998,  0.799768,
-	 0.799537,  0.799307,  0.799076,  0.798846,  0.798615,  0.798384,  0.798153,  0.797922,
-	 0.797691,  0.797459,  0.797228,  0.796996,  0.796765,  0.796533,  0.796301,  0.796069,
-	 0.795837,  0.795605,  0.795372,  0.795140,  0.794907,  0.794674,  0.794442,  0.794209,
-	 0.793975,  0.793742,  0.793509,  0.793276,  0.793042,  0.792808,  0.792575,  0.792341,
-	 0.792107,  0.791872,  0.791638,  0.791404,  0.791169,  0.790935,  0.790700,  0.790465,
-	 0.790230,  0.789995,  0.789760,  0.789525,  0.789289,  0.789054,  0.788818,  0.788582,
-	 0.788346,  0.788110,  0.787874,  0.787638,  0.787402,  0.787165,  0.786929,  0.786692,
-	 0.786455,  0.786218,  0.785981,  0.785744,  0.785507,  0.785269,  0.785032,  0.784794,
-	 0.784557,  0.784319,  0.784081,  0.783843,  0.783605,  0.783366,  0.783128,  0.782889,
-	 0.782651,  0.782412,  0.782173,  0.781934,  0.781695,  0.781456,  0.781216,  0.780977,
-	 0.780737,  0.780498,  0.780258,  0.780018,  0.779778,  0.779538,  0.779297,  0.779057,
-	 0.778817,  0.778576,  0.778335,  0.778094,  0.777853,  0.777612,  0.777371,  0.777130,
-	 0.776888,  0.776647,  0.776405,  0.776164,  0.775922,  0.775680,  0.775438,  0.775195,
-	 0.774953,  0.774711,  0.774468,  0.774225,  0.773983,  0.773740,  0.773497,  0.773254,
-	 0.773010,  0.772767,  0.772524,  0.772280,  0.772036,  0.771793,  0.771549,  0.771305,
-	 0.771061,  0.770816,  0.770572,  0.770327,  0.770083,  0.769838,  0.769593,  0.769348,
-	 0.769103,  0.768858,  0.768613,  0.768368,  0.768122,  0.767876,  0.767631,  0.767385,
-	 0.767139,  0.766893,  0.766647,  0.766400,  0.766154,  0.765907,  0.765661,  0.765414,
-	 0.765167,  0.764920,  0.764673,  0.764426,  0.764179,  0.763931,  0.763684,  0.763436,
-	 0.763188,  0.762941,  0.762693,  0.762444,  0.762196,  0.761948,  0.761700,  0.761451,
-	 0.761202,  0.760954,  0.760705,  0.760456,  0.760207,  0.759957,  0.759708,  0.759459,
-	 0.759209,  0.758960,  0.758710,  0.758460,  0.758210,  0.757960,  0.757710,  0.757459,
-	 0.757209,  0.756958,  0.756708,  0.756457,  0.756206,  0.755955,  0.755704,  0.755453,
-	 0.755201,  0.754950,  0.754698,  0.754447,  0.754195,  0.753943,  0.753691,  0.753439,
-	 0.753187,  0.752934,  0.752682,  0.752429,  0.752177,  0.751924,  0.751671,  0.751418,
-	 0.751165,  0.750912,  0.750659,  0.750405,  0.750152,  0.749898,  0.749644,  0.749390,
-	 0.749136,  0.748882,  0.748628,  0.748374,  0.748119,  0.747865,  0.747610,  0.747355,
-	 0.747101,  0.746846,  0.746591,  0.746335,  0.746080,  0.745825,  0.745569,  0.745314,
-	 0.745058,  0.744802,  0.744546,  0.744290,  0.744034,  0.743777,  0.743521,  0.743265,
-	 0.743008,  0.742751,  0.742494,  0.742237,  0.741980,  0.741723,  0.741466,  0.741209,
-	 0.740951,  0.740694,  0.740436,  0.740178,  0.739920,  0.739662,  0.739404,  0.739146,
-	 0.738887,  0.738629,  0.738370,  0.738112,  0.737853,  0.737594,  0.737335,  0.737076,
-	 0.736817,  0.736557,  0.736298,  0.736038,  0.735779,  0.735519,  0.735259,  0.734999,
-	 0.734739,  0.734479,  0.734218,  0.733958,  0.733697,  0.733437,  0.733176,  0.732915,
-	 0.732654,  0.732393,  0.732132,  0.731871,  0.731609,  0.731348,  0.731086,  0.730825,
-	 0.730563,  0.730301,  0.730039,  0.729777,  0.729514,  0.729252,  0.728990,  0.728727,
-	 0.728464,  0.728202,  0.727939,  0.727676,  0.727413,  0.727149,  0.726886,  0.726623,
-	 0.726359,  0.726095,  0.725832,  0.725568,  0.725304,  0.725040,  0.724776,  0.724511,
-	 0.724247,  0.723983,  0.723718,  0.723453,  0.723188,  0.722924,  0.722659,  0.722393,
-	 0.722128,  0.721863,  0.721597,  0.721332,  0.721066,  0.720800,  0.720535,  0.720269,
-	 0.720003,  0.719736,  0.719470,  0.719204,  0.718937,  0.718670,  0.718404,  0.718137,
-	 0.717870,  0.717603,  0.717336,  0.717069,  0.716801,  0.716534,  0.716266,  0.715999,
-	 0.715731,  0.715463,  0.715195,  0.714927,  0.714659,  0.714390,  0.714122,  0.713853,
-	 0.713585,  0.713316,  0.713047,  0.712778,  0.712509,  0.712240,  0.711971,  0.711702,
-	 0.711432,  0.711163,  0.710893,  0.710623,  0.710353,  0.710083,  0.709813,  0.709543,
-	 0.709273,  0.709002,  0.708732,  0.708461,  0.708191,  0.707920,  0.707649,  0.707378,
-	 0.707107,  0.706836,  0.706564,  0.706293,  0.706021,  0.705750,  0.705478,  0.705206,
-	 0.704934,  0.704662,  0.704390,  0.704118,  0.703845,  0.703573,  0.703300,  0.703028,
-	 0.702755,  0.702482,  0.702209,  0.701936,  0.701663,  0.701389,  0.701116,  0.700842,
-	 0.700569,  0.700295,  0.700021,  0.699747,  0.699473,  0.699199,  0.698925,  0.698651,
-	 0.698376,  0.698102,  0.697827,  0.697552,  0.697277,  0.697003,  0.696728,  0.696452,
-	 0.696177,  0.695902,  0.695626,  0.695351,  0.695075,  0.694799,  0.694524,  0.694248,
-	 0.693971,  0.693695,  0.693419,  0.693143,  0.692866,  0.692590,  0.692313,  0.692036,
-	 0.691759,  0.691482,  0.691205,  0.690928,  0.690651,  0.690373,  0.690096,  0.689818,
-	 0.689541,  0.689263,  0.688985,  0.688707,  0.688429,  0.688151,  0.687872,  0.687594,
-	 0.687315,  0.687037,  0.686758,  0.686479,  0.686200,  0.685921,  0.685642,  0.685363,
-	 0.685084,  0.684804,  0.684525,  0.684245,  0.683965,  0.683686,  0.683406,  0.683126,
-	 0.682846,  0.682565,  0.682285,  0.682005,  0.681724,  0.681443,  0.681163,  0.680882,
-	 0.680601,  0.680320,  0.680039,  0.679758,  0.679476,  0.679195,  0.678913,  0.678632,
-	 0.678350,  0.678068,  0.677786,  0.677504,  0.677222,  0.676940,  0.676658,  0.676375,
-	 0.676093,  0.675810,  0.675527,  0.675245,  0.674962,  0.674679,  0.674396,  0.674112,
-	 0.673829,  0.673546,  0.673262,  0.672978,  0.672695,  0.672411,  0.672127,  0.671843,
-	 0.671559,  0.671275,  0.670990,  0.670706,  0.670422,  0.670137,  0.669852,  0.669567,
-	 0.669283,  0.668998,  0.668712,  0.668427,  0.668142,  0.667857,  0.667571,  0.667286,
-	 0.667000,  0.666714,  0.666428,  0.666142,  0.665856,  0.665570,  0.665284,  0.664997,
-	 0.664711,  0.664424,  0.664138,  0.663851,  0.663564,  0.663277,  0.662990,  0.662703,
-	 0.662416,  0.662128,  0.661841,  0.661553,  0.661266,  0.660978,  0.660690,  0.660402,
-	 0.660114,  0.659826,  0.659538,  0.659250,  0.658961,  0.658673,  0.658384,  0.658095,
-	 0.657807,  0.657518,  0.657229,  0.656940,  0.656651,  0.656361,  0.656072,  0.655782,
-	 0.655493,  0.655203,  0.654913,  0.654624,  0.654334,  0.654044,  0.653753,  0.653463,
-	 0.653173,  0.652882,  0.652592,  0.652301,  0.652011,  0.651720,  0.651429,  0.651138,
-	 0.650847,  0.650555,  0.650264,  0.649973,  0.649681,  0.649390,  0.649098,  0.648806,
-	 0.648514,  0.648222,  0.647930,  0.647638,  0.647346,  0.647054,  0.646761,  0.646469,
-	 0.646176,  0.645883,  0.645590,  0.645298,  0.645005,  0.644711,  0.644418,  0.644125,
-	 0.643832,  0.643538,  0.643245,  0.642951,  0.642657,  0.642363,  0.642069,  0.641775,
-	 0.641481,  0.641187,  0.640892,  0.640598,  0.640303,  0.640009,  0.639714,  0.639419,
-	 0.639124,  0.638829,  0.638534,  0.638239,  0.637944,  0.637649,  0.637353,  0.637057,
-	 0.636762,  0.636466,  0.636170,  0.635874,  0.635578,  0.635282,  0.634986,  0.634690,
-	 0.634393,  0.634097,  0.633800,  0.633504,  0.633207,  0.632910,  0.632613,  0.632316,
-	 0.632019,  0.631721,  0.631424,  0.631127,  0.630829,  0.630532,  0.630234,  0.629936,
-	 0.629638,  0.629340,  0.629042,  0.628744,  0.628446,  0.628147,  0.627849,  0.627550,
-	 0.627252,  0.626953,  0.626654,  0.626355,  0.626056,  0.625757,  0.625458,  0.625159,
-	 0.624860,  0.624560,  0.624260,  0.623961,  0.623661,  0.623361,  0.623061,  0.622761,
-	 0.622461,  0.622161,  0.621861,  0.621560,  0.621260,  0.620959,  0.620659,  0.620358,
-	 0.620057,  0.619756,  0.619455,  0.619154,  0.618853,  0.618552,  0.618250,  0.617949,
-	 0.617647,  0.617346,  0.617044,  0.616742,  0.616440,  0.616138,  0.615836,  0.615534,
-	 0.615232,  0.614929,  0.614627,  0.614324,  0.614022,  0.613719,  0.613416,  0.613113,
-	 0.612810,  0.612507,  0.612204,  0.611901,  0.611597,  0.611294,  0.610990,  0.610687,
-	 0.610383,  0.610079,  0.609775,  0.609471,  0.609167,  0.608863,  0.608559,  0.608254,
-	 0.607950,  0.607645,  0.607341,  0.607036,  0.606731,  0.606426,  0.606121,  0.605816,
-	 0.605511,  0.605206,  0.604900,  0.604595,  0.604290,  0.603984,  0.603678,  0.603372,
-	 0.603067,  0.602761,  0.602455,  0.602148,  0.601842,  0.601536,  0.601230,  0.600923,
-	 0.600616,  0.600310,  0.600003,  0.599696,  0.599389,  0.599082,  0.598775,  0.598468,
-	 0.598161,  0.597853,  0.597546,  0.597238,  0.596931,  0.596623,  0.596315,  0.596007,
-	 0.595699,  0.595391,  0.595083,  0.594775,  0.594467,  0.594158,  0.593850,  0.593541,
-	 0.593232,  0.592924,  0.592615,  0.592306,  0.591997,  0.591688,  0.591378,  0.591069,
-	 0.590760,  0.590450,  0.590141,  0.589831,  0.589521,  0.589212,  0.588902,  0.588592,
-	 0.588282,  0.587971,  0.587661,  0.587351,  0.587040,  0.586730,  0.586419,  0.586109,
-	 0.585798,  0.585487,  0.585176,  0.584865,  0.584554,  0.584243,  0.583931,  0.583620,
-	 0.583309,  0.582997,  0.582685,  0.582374,  0.582062,  0.581750,  0.581438,  0.581126,
-	 0.580814,  0.580502,  0.580189,  0.579877,  0.579565,  0.579252,  0.578939,  0.578627,
-	 0.578314,  0.578001,  0.577688,  0.577375,  0.577062,  0.576748,  0.576435,  0.576122,
-	 0.575808,  0.575495,  0.575181,  0.574867,  0.574553,  0.574239,  0.573925,  0.573611,
-	 0.573297,  0.572983,  0.572669,  0.572354,  0.572040,  0.571725,  0.571410,  0.571096,
-	 0.570781,  0.570466,  0.570151,  0.569836,  0.569521,  0.569205,  0.568890,  0.568574,
-	 0.568259,  0.567943,  0.567628,  0.567312,  0.566996,  0.566680,  0.566364,  0.566048,
-	 0.565732,  0.565416,  0.565099,  0.564783,  0.564466,  0.564150,  0.563833,  0.563516,
-	 0.563199,  0.562882,  0.562565,  0.562248,  0.561931,  0.561614,  0.561297,  0.560979,
-	 0.560662,  0.560344,  0.560026,  0.559709,  0.559391,  0.559073,  0.558755,  0.558437,
-	 0.558119,  0.557800,  0.557482,  0.557164,  0.556845,  0.556526,  0.556208,  0.555889,
-	 0.555570,  0.555251,  0.554932,  0.554613,  0.554294,  0.553975,  0.553656,  0.553336,
-	 0.553017,  0.552697,  0.552378,  0.552058,  0.551738,  0.551418,  0.551098,  0.550778,
-	 0.550458,  0.550138,  0.549818,  0.549497,  0.549177,  0.548856,  0.548536,  0.548215,
-	 0.547894,  0.547573,  0.547252,  0.546931,  0.546610,  0.546289,  0.545968,  0.545646,
-	 0.545325,  0.545003,  0.544682,  0.544360,  0.544039,  0.543717,  0.543395,  0.543073,
-	 0.542751,  0.542429,  0.542106,  0.541784,  0.541462,  0.541139,  0.540817,  0.540494,
-	 0.540171,  0.539849,  0.539526,  0.539203,  0.538880,  0.538557,  0.538234,  0.537910,
-	 0.537587,  0.537264,  0.536940,  0.536617,  0.536293,  0.535969,  0.535645,  0.535322,
-	 0.534998,  0.534674,  0.534349,  0.534025,  0.533701,  0.533377,  0.533052,  0.532728,
-	 0.532403,  0.532078,  0.531754,  0.531429,  0.531104,  0.530779,  0.530454,  0.530129,
-	 0.529804,  0.529478,  0.529153,  0.528828,  0.528502,  0.528176,  0.527851,  0.527525,
-	 0.527199,  0.526873,  0.526547,  0.526221,  0.525895,  0.525569,  0.525243,  0.524916,
-	 0.524590,  0.524263,  0.523937,  0.523610,  0.523283,  0.522956,  0.522629,  0.522302,
-	 0.521975,  0.521648,  0.521321,  0.520994,  0.520666,  0.520339,  0.520011,  0.519684,
-	 0.519356,  0.519028,  0.518700,  0.518372,  0.518045,  0.517716,  0.517388,  0.517060,
-	 0.516732,  0.516403,  0.516075,  0.515746,  0.515418,  0.515089,  0.514760,  0.514432,
-	 0.514103,  0.513774,  0.513445,  0.513116,  0.512786,  0.512457,  0.512128,  0.511798,
-	 0.511469,  0.511139,  0.510810,  0.510480,  0.510150,  0.509820,  0.509490,  0.509160,
-	 0.508830,  0.508500,  0.508170,  0.507839,  0.507509,  0.507179,  0.506848,  0.506517,
-	 0.506187,  0.505856,  0.505525,  0.505194,  0.504863,  0.504532,  0.504201,  0.503870,
-	 0.503538,  0.503207,  0.502876,  0.502544,  0.502212,  0.501881,  0.501549,  0.501217,
-	 0.500885,  0.500553,  0.500221,  0.499889,  0.499557,  0.499225,  0.498893,  0.498560,
-	 0.498228,  0.497895,  0.497562,  0.497230,  0.496897,  0.496564,  0.496231,  0.495898,
-	 0.495565,  0.495232,  0.494899,  0.494566,  0.494232,  0.493899,  0.493565,  0.493232,
-	 0.492898,  0.492564,  0.492231,  0.491897,  0.491563,  0.491229,  0.490895,  0.490561,
-	 0.490226,  0.489892,  0.489558,  0.489223,  0.488889,  0.488554,  0.488220,  0.487885,
-	 0.487550,  0.487215,  0.486880,  0.486545,  0.486210,  0.485875,  0.485540,  0.485205,
-	 0.484869,  0.484534,  0.484198,  0.483863,  0.483527,  0.483191,  0.482856,  0.482520,
-	 0.482184,  0.481848,  0.481512,  0.481176,  0.480839,  0.480503,  0.480167,  0.479830,
-	 0.479494,  0.479157,  0.478821,  0.478484,  0.478147,  0.477810,  0.477473,  0.477136,
-	 0.476799,  0.476462,  0.476125,  0.475788,  0.475450,  0.475113,  0.474775,  0.474438,
-	 0.474100,  0.473763,  0.473425,  0.473087,  0.472749,  0.472411,  0.472073,  0.471735,
-	 0.471397,  0.471058,  0.470720,  0.470382,  0.470043,  0.469705,  0.469366,  0.469028,
-	 0.468689,  0.468350,  0.468011,  0.467672,  0.467333,  0.466994,  0.466655,  0.466316,
-	 0.465977,  0.465637,  0.465298,  0.464958,  0.464619,  0.464279,  0.463939,  0.463600,
-	 0.463260,  0.462920,  0.462580,  0.462240,  0.461900,  0.461560,  0.461219,  0.460879,
-	 0.460539,  0.460198,  0.459858,  0.459517,  0.459177,  0.458836,  0.458495,  0.458154,
-	 0.457813,  0.457472,  0.457131,  0.456790,  0.456449,  0.456108,  0.455766,  0.455425,
-	 0.455084,  0.454742,  0.454400,  0.454059,  0.453717,  0.453375,  0.453033,  0.452692,
-	 0.452350,  0.452008,  0.451665,  0.451323,  0.450981,  0.450639,  0.450296,  0.449954,
-	 0.449611,  0.449269,  0.448926,  0.448583,  0.448241,  0.447898,  0.447555,  0.447212,
-	 0.446869,  0.446526,  0.446183,  0.445839,  0.445496,  0.445153,  0.444809,  0.444466,
-	 0.444122,  0.443779,  0.443435,  0.443091,  0.442747,  0.442403,  0.442059,  0.441715,
-	 0.441371,  0.441027,  0.440683,  0.440339,  0.439994,  0.439650,  0.439305,  0.438961,
-	 0.438616,  0.438272,  0.437927,  0.437582,  0.437237,  0.436892,  0.436547,  0.436202,
-	 0.435857,  0.435512,  0.435167,  0.434821,  0.434476,  0.434131,  0.433785,  0.433439,
-	 0.433094,  0.432748,  0.432402,  0.432057,  0.431711,  0.431365,  0.431019,  0.430673,
-	 0.430326,  0.429980,  0.429634,  0.429288,  0.428941,  0.428595,  0.428248,  0.427902,
-	 0.427555,  0.427208,  0.426862,  0.426515,  0.426168,  0.425821,  0.425474,  0.425127,
-	 0.424780,  0.424432,  0.424085,  0.423738,  0.423390,  0.423043,  0.422695,  0.422348,
-	 0.422000,  0.421653,  0.421305,  0.420957,  0.420609,  0.420261,  0.419913,  0.419565,
-	 0.419217,  0.418869,  0.418520,  0.418172,  0.417824,  0.417475,  0.417127,  0.416778,
-	 0.416430,  0.416081,  0.415732,  0.415383,  0.415034,  0.414685,  0.414337,  0.413987,
-	 0.413638,  0.413289,  0.412940,  0.412591,  0.412241,  0.411892,  0.411542,  0.411193,
-	 0.410843,  0.410493,  0.410144,  0.409794,  0.409444,  0.409094,  0.408744,  0.408394,
-	 0.408044,  0.407694,  0.407344,  0.406994,  0.406643,  0.406293,  0.405942,  0.405592,
-	 0.405241,  0.404891,  0.404540,  0.404189,  0.403838,  0.403488,  0.403137,  0.402786,
-	 0.402435,  0.402084,  0.401732,  0.401381,  0.401030,  0.400679,  0.400327,  0.399976,
-	 0.399624,  0.399273,  0.398921,  0.398569,  0.398218,  0.397866,  0.397514,  0.397162,
-	 0.396810,  0.396458,  0.396106,  0.395754,  0.395401,  0.395049,  0.394697,  0.394344,
-	 0.393992,  0.393640,  0.393287,  0.392934,  0.392582,  0.392229,  0.391876,  0.391523,
-	 0.391170,  0.390817,  0.390464,  0.390111,  0.389758,  0.389405,  0.389052,  0.388698,
-	 0.388345,  0.387992,  0.387638,  0.387285,  0.386931,  0.386577,  0.386224,  0.385870,
-	 0.385516,  0.385162,  0.384808,  0.384454,  0.384100,  0.383746,  0.383392,  0.383038,
-	 0.382683,  0.382329,  0.381975,  0.381620,  0.381266,  0.380911,  0.380557,  0.380202,
-	 0.379847,  0.379492,  0.379138,  0.378783,  0.378428,  0.378073,  0.377718,  0.377363,
-	 0.377007,  0.376652,  0.376297,  0.375942,  0.375586,  0.375231,  0.374875,  0.374520,
-	 0.374164,  0.373808,  0.373453,  0.373097,  0.372741,  0.372385,  0.372029,  0.371673,
-	 0.371317,  0.370961,  0.370605,  0.370249,  0.369892,  0.369536,  0.369180,  0.368823,
-	 0.368467,  0.368110,  0.367754,  0.367397,  0.367040,  0.366684,  0.366327,  0.365970,
-	 0.365613,  0.365256,  0.364899,  0.364542,  0.364185,  0.363828,  0.363470,  0.363113,
-	 0.362756,  0.362398,  0.362041,  0.361683,  0.361326,  0.360968,  0.360611,  0.360253,
-	 0.359895,  0.359537,  0.359179,  0.358821,  0.358463,  0.358105,  0.357747,  0.357389,
-	 0.357031,  0.356673,  0.356314,  0.355956,  0.355598,  0.355239,  0.354881,  0.354522,
-	 0.354164,  0.353805,  0.353446,  0.353087,  0.352729,  0.352370,  0.352011,  0.351652,
-	 0.351293,  0.350934,  0.350575,  0.350215,  0.349856,  0.349497,  0.349138,  0.348778,
-	 0.348419,  0.348059,  0.347700,  0.347340,  0.346980,  0.346621,  0.346261,  0.345901,
-	 0.345541,  0.345181,  0.344821,  0.344461,  0.344101,  0.343741,  0.343381,  0.343021,
-	 0.342661,  0.342300,  0.341940,  0.341580,  0.341219,  0.340859,  0.340498,  0.340138,
-	 0.339777,  0.339416,  0.339055,  0.338695,  0.338334,  0.337973,  0.337612,  0.337251,
-	 0.336890,  0.336529,  0.336168,  0.335806,  0.335445,  0.335084,  0.334722,  0.334361,
-	 0.334000,  0.333638,  0.333277,  0.332915,  0.332553,  0.332192,  0.331830,  0.331468,
-	 0.331106,  0.330744,  0.330382,  0.330020,  0.329658,  0.329296,  0.328934,  0.328572,
-	 0.328210,  0.327848,  0.327485,  0.327123,  0.326760,  0.326398,  0.326035,  0.325673,
-	 0.325310,  0.324948,  0.324585,  0.324222,  0.323859,  0.323497,  0.323134,  0.322771,
-	 0.322408,  0.322045,  0.321682,  0.321318,  0.320955,  0.320592,  0.320229,  0.319865,
-	 0.319502,  0.319139,  0.318775,  0.318412,  0.318048,  0.317684,  0.317321,  0.316957,
-	 0.316593,  0.316230,  0.315866,  0.315502,  0.315138,  0.314774,  0.314410,  0.314046,
-	 0.313682,  0.313318,  0.312953,  0.312589,  0.312225,  0.311860,  0.311496,  0.311132,
-	 0.310767,  0.310403,  0.310038,  0.309673,  0.309309,  0.308944,  0.308579,  0.308214,
-	 0.307850,  0.307485,  0.307120,  0.306755,  0.306390,  0.306025,  0.305660,  0.305294,
-	 0.304929,  0.304564,  0.304199,  0.303833,  0.303468,  0.303103,  0.302737,  0.302372,
-	 0.302006,  0.301640,  0.301275,  0.300909,  0.300543,  0.300177,  0.299812,  0.299446,
-	 0.299080,  0.298714,  0.298348,  0.297982,  0.297616,  0.297250,  0.296883,  0.296517,
-	 0.296151,  0.295785,  0.295418,  0.295052,  0.294685,  0.294319,  0.293952,  0.293586,
-	 0.293219,  0.292852,  0.292486,  0.292119,  0.291752,  0.291385,  0.291019,  0.290652,
-	 0.290285,  0.289918,  0.289551,  0.289184,  0.288816,  0.288449,  0.288082,  0.287715,
-	 0.287347,  0.286980,  0.286613,  0.286245,  0.285878,  0.285510,  0.285143,  0.284775,
-	 0.284408,  0.284040,  0.283672,  0.283304,  0.282937,  0.282569,  0.282201,  0.281833,
-	 0.281465,  0.281097,  0.280729,  0.280361,  0.279993,  0.279624,  0.279256,  0.278888,
-	 0.278520,  0.278151,  0.277783,  0.277415,  0.277046,  0.276678,  0.276309,  0.275940,
-	 0.275572,  0.275203,  0.274834,  0.274466,  0.274097,  0.273728,  0.273359,  0.272990,
-	 0.272621,  0.272252,  0.271883,  0.271514,  0.271145,  0.270776,  0.270407,  0.270038,
-	 0.269668,  0.269299,  0.268930,  0.268560,  0.268191,  0.267821,  0.267452,  0.267082,
-	 0.266713,  0.266343,  0.265973,  0.265604,  0.265234,  0.264864,  0.264494,  0.264125,
-	 0.263755,  0.263385,  0.263015,  0.262645,  0.262275,  0.261905,  0.261534,  0.261164,
-	 0.260794,  0.260424,  0.260054,  0.259683,  0.259313,  0.258943,  0.258572,  0.258202,
-	 0.257831,  0.257461,  0.257090,  0.256719,  0.256349,  0.255978,  0.255607,  0.255236,
-	 0.254866,  0.254495,  0.254124,  0.253753,  0.253382,  0.253011,  0.252640,  0.252269,
-	 0.251898,  0.251527,  0.251155,  0.250784,  0.250413,  0.250042,  0.249670,  0.249299,
-	 0.248928,  0.248556,  0.248185,  0.247813,  0.247442,  0.247070,  0.246698,  0.246327,
-	 0.245955,  0.245583,  0.245212,  0.244840,  0.244468,  0.244096,  0.243724,  0.243352,
-	 0.242980,  0.242608,  0.242236,  0.241864,  0.241492,  0.241120,  0.240748,  0.240375,
-	 0.240003,  0.239631,  0.239258,  0.238886,  0.238514,  0.238141,  0.237769,  0.237396,
-	 0.237024,  0.236651,  0.236278,  0.235906,  0.235533,  0.235160,  0.234788,  0.234415,
-	 0.234042,  0.233669,  0.233296,  0.232923,  0.232550,  0.232177,  0.231804,  0.231431,
-	 0.231058,  0.230685,  0.230312,  0.229939,  0.229565,  0.229192,  0.228819,  0.228445,
-	 0.228072,  0.227699,  0.227325,  0.226952,  0.226578,  0.226205,  0.225831,  0.225458,
-	 0.225084,  0.224710,  0.224337,  0.223963,  0.223589,  0.223215,  0.222841,  0.222468,
-	 0.222094,  0.221720,  0.221346,  0.220972,  0.220598,  0.220224,  0.219850,  0.219475,
-	 0.219101,  0.218727,  0.218353,  0.217979,  0.217604,  0.217230,  0.216856,  0.216481,
-	 0.216107,  0.215732,  0.215358,  0.214983,  0.214609,  0.214234,  0.213860,  0.213485,
-	 0.213110,  0.212736,  0.212361,  0.211986,  0.211611,  0.211237,  0.210862,  0.210487,
-	 0.210112,  0.209737,  0.209362,  0.208987,  0.208612,  0.208237,  0.207862,  0.207487,
-	 0.207111,  0.206736,  0.206361,  0.205986,  0.205610,  0.205235,  0.204860,  0.204484,
-	 0.204109,  0.203734,  0.203358,  0.202983,  0.202607,  0.202231,  0.201856,  0.201480,
-	 0.201105,  0.200729,  0.200353,  0.199978,  0.199602,  0.199226,  0.198850,  0.198474,
-	 0.198098,  0.197722,  0.197347,  0.196971,  0.196595,  0.196219,  0.195843,  0.195466,
-	 0.195090,  0.194714,  0.194338,  0.193962,  0.193586,  0.193209,  0.192833,  0.192457,
-	 0.192080,  0.191704,  0.191328,  0.190951,  0.190575,  0.190198,  0.189822,  0.189445,
-	 0.189069,  0.188692,  0.188315,  0.187939,  0.187562,  0.187185,  0.186809,  0.186432,
-	 0.186055,  0.185678,  0.185301,  0.184925,  0.184548,  0.184171,  0.183794,  0.183417,
-	 0.183040,  0.182663,  0.182286,  0.181909,  0.181532,  0.181154,  0.180777,  0.180400,
-	 0.180023,  0.179646,  0.179268,  0.178891,  0.178514,  0.178136,  0.177759,  0.177382,
-	 0.177004,  0.176627,  0.176249,  0.175872,  0.175494,  0.175117,  0.174739,  0.174362,
-	 0.173984,  0.173606,  0.173229,  0.172851,  0.172473,  0.172095,  0.171718,  0.171340,
-	 0.170962,  0.170584,  0.170206,  0.169828,  0.169450,  0.169072,  0.168694,  0.168316,
-	 0.167938,  0.167560,  0.167182,  0.166804,  0.166426,  0.166048,  0.165670,  0.165291,
-	 0.164913,  0.164535,  0.164157,  0.163778,  0.163400,  0.163022,  0.162643,  0.162265,
-	 0.161886,  0.161508,  0.161129,  0.160751,  0.160372,  0.159994,  0.159615,  0.159237,
-	 0.158858,  0.158480,  0.158101,  0.157722,  0.157343,  0.156965,  0.156586,  0.156207,
-	 0.155828,  0.155450,  0.155071,  0.154692,  0.154313,  0.153934,  0.153555,  0.153176,
-	 0.152797,  0.152418,  0.152039,  0.151660,  0.151281,  0.150902,  0.150523,  0.150144,
-	 0.149765,  0.149385,  0.149006,  0.148627,  0.148248,  0.147868,  0.147489,  0.147110,
-	 0.146730,  0.146351,  0.145972,  0.145592,  0.145213,  0.144833,  0.144454,  0.144075,
-	 0.143695,  0.143316,  0.142936,  0.142556,  0.142177,  0.141797,  0.141418,  0.141038,
-	 0.140658,  0.140279,  0.139899,  0.139519,  0.139139,  0.138760,  0.138380,  0.138000,
-	 0.137620,  0.137240,  0.136860,  0.136480,  0.136101,  0.135721,  0.135341,  0.134961,
-	 0.134581,  0.134201,  0.133821,  0.133441,  0.133061,  0.132680,  0.132300,  0.131920,
-	 0.131540,  0.131160,  0.130780,  0.130399,  0.130019,  0.129639,  0.129259,  0.128878,
-	 0.128498,  0.128118,  0.127737,  0.127357,  0.126977,  0.126596,  0.126216,  0.125835,
-	 0.125455,  0.125075,  0.124694,  0.124314,  0.123933,  0.123552,  0.123172,  0.122791,
-	 0.122411,  0.122030,  0.121649,  0.121269,  0.120888,  0.120507,  0.120127,  0.119746,
-	 0.119365,  0.118984,  0.118604,  0.118223,  0.117842,  0.117461,  0.117080,  0.116700,
-	 0.116319,  0.115938,  0.115557,  0.115176,  0.114795,  0.114414,  0.114033,  0.113652,
-	 0.113271,  0.112890,  0.112509,  0.112128,  0.111747,  0.111366,  0.110984,  0.110603,
-	 0.110222,  0.109841,  0.109460,  0.109079,  0.108697,  0.108316,  0.107935,  0.107554,
-	 0.107172,  0.106791,  0.106410,  0.106028,  0.105647,  0.105266,  0.104884,  0.104503,
-	 0.104122,  0.103740,  0.103359,  0.102977,  0.102596,  0.102214,  0.101833,  0.101451,
-	 0.101070,  0.100688,  0.100307,  0.099925,  0.099544,  0.099162,  0.098780,  0.098399,
-	 0.098017,  0.097635,  0.097254,  0.096872,  0.096490,  0.096109,  0.095727,  0.095345,
-	 0.094963,  0.094582,  0.094200,  0.093818,  0.093436,  0.093055,  0.092673,  0.092291,
-	 0.091909,  0.091527,  0.091145,  0.090763,  0.090381,  0.089999,  0.089617,  0.089236,
-	 0.088854,  0.088472,  0.088090,  0.087708,  0.087326,  0.086943,  0.086561,  0.086179,
-	 0.085797,  0.085415,  0.085033,  0.084651,  0.084269,  0.083887,  0.083505,  0.083122,
-	 0.082740,  0.082358,  0.081976,  0.081594,  0.081211,  0.080829,  0.080447,  0.080065,
-	 0.079682,  0.079300,  0.078918,  0.078536,  0.078153,  0.077771,  0.077389,  0.077006,
-	 0.076624,  0.076241,  0.075859,  0.075477,  0.075094,  0.074712,  0.074329,  0.073947,
-	 0.073565,  0.073182,  0.072800,  0.072417,  0.072035,  0.071652,  0.071270,  0.070887,
-	 0.070505,  0.070122,  0.069739,  0.069357,  0.068974,  0.068592,  0.068209,  0.067827,
-	 0.067444,  0.067061,  0.066679,  0.066296,  0.065913,  0.065531,  0.065148,  0.064765,
-	 0.064383,  0.064000,  0.063617,  0.063234,  0.062852,  0.062469,  0.062086,  0.061704,
-	 0.061321,  0.060938,  0.060555,  0.060172,  0.059790,  0.059407,  0.059024,  0.058641,
-	 0.058258,  0.057875,  0.057493,  0.057110,  0.056727,  0.056344,  0.055961,  0.055578,
-	 0.055195,  0.054812,  0.054429,  0.054046,  0.053664,  0.053281,  0.052898,  0.052515,
-	 0.052132,  0.051749,  0.051366,  0.050983,  0.050600,  0.050217,  0.049834,  0.049451,
-	 0.049068,  0.048685,  0.048302,  0.047919,  0.047535,  0.047152,  0.046769,  0.046386,
-	 0.046003,  0.045620,  0.045237,  0.044854,  0.044471,  0.044088,  0.043705,  0.043321,
-	 0.042938,  0.042555,  0.042172,  0.041789,  0.041406,  0.041022,  0.040639,  0.040256,
-	 0.039873,  0.039490,  0.039107,  0.038723,  0.038340,  0.037957,  0.037574,  0.037190,
-	 0.036807,  0.036424,  0.036041,  0.035657,  0.035274,  0.034891,  0.034508,  0.034124,
-	 0.033741,  0.033358,  0.032975,  0.032591,  0.032208,  0.031825,  0.031441,  0.031058,
-	 0.030675,  0.030291,  0.029908,  0.029525,  0.029142,  0.028758,  0.028375,  0.027991,
-	 0.027608,  0.027225,  0.026841,  0.026458,  0.026075,  0.025691,  0.025308,  0.024925,
-	 0.024541,  0.024158,  0.023774,  0.023391,  0.023008,  0.022624,  0.022241,  0.021857,
-	 0.021474,  0.021091,  0.020707,  0.020324,  0.019940,  0.019557,  0.019174,  0.018790,
-	 0.018407,  0.018023,  0.017640,  0.017256,  0.016873,  0.016490,  0.016106,  0.015723,
-	 0.015339,  0.014956,  0.014572,  0.014189,  0.013805,  0.013422,  0.013038,  0.012655,
-	 0.012272,  0.011888,  0.011505,  0.011121,  0.010738,  0.010354,  0.009971,  0.009587,
-	 0.009204,  0.008820,  0.008437,  0.008053,  0.007670,  0.007286,  0.006903,  0.006519,
-	 0.006136,  0.005752,  0.005369,  0.004985,  0.004602,  0.004218,  0.003835,  0.003451,
-	 0.003068,  0.002684,  0.002301,  0.001917,  0.001534,  0.001150,  0.000767,  0.000383,
-	 0.000000,  0.000383,  0.000767,  0.001150,  0.001534,  0.001917,  0.002301,  0.002684,
-	 0.003068,  0.003451,  0.003835,  0.004218,  0.004602,  0.004985,  0.005369,  0.005752,
-	 0.006136,  0.006519,  0.006903,  0.007286,  0.007670,  0.008053,  0.008437,  0.008820,
-	 0.009204,  0.009587,  0.009971,  0.010354,  0.010738,  0.011121,  0.011505,  0.011888,
-	 0.012272,  0.012655,  0.013038,  0.013422,  0.013805,  0.014189,  0.014572,  0.014956,
-	 0.015339,  0.015723,  0.016106,  0.016490,  0.016873,  0.017256,  0.017640,  0.018023,
-	 0.018407,  0.018790,  0.019174,  0.019557,  0.019940,  0.020324,  0.020707,  0.021091,
-	 0.021474,  0.021857,  0.022241,  0.022624,  0.023008,  0.023391,  0.023774,  0.024158,
-	 0.024541,  0.024925,  0.025308,  0.025691,  0.026075,  0.026458,  0.026841,  0.027225,
-	 0.027608,  0.027991,  0.028375,  0.028758,  0.029142,  0.029525,  0.029908,  0.030291,
-	 0.030675,  0.031058,  0.031441,  0.031825,  0.032208,  0.032591,  0.032975,  0.033358,
-	 0.033741,  0.034124,  0.034508,  0.034891,  0.035274,  0.035657,  0.036041,  0.036424,
-	 0.036807,  0.037190,  0.037574,  0.037957,  0.038340,  0.038723,  0.039107,  0.039490,
-	 0.039873,  0.040256,  0.040639,  0.041022,  0.041406,  0.041789,  0.042172,  0.042555,
-	 0.042938,  0.043321,  0.043705,  0.044088,  0.044471,  0.044854,  0.045237,  0.045620,
-	 0.046003,  0.046386,  0.046769,  0.047152,  0.047535,  0.047919,  0.048302,  0.048685,
-	 0.049068,  0.049451,  0.049834,  0.050217,  0.050600,  0.050983,  0.051366,  0.051749,
-	 0.052132,  0.052515,  0.052898,  0.053281,  0.053664,  0.054046,  0.054429,  0.054812,
-	 0.055195,  0.055578,  0.055961,  0.056344,  0.056727,  0.057110,  0.057493,  0.057875,
-	 0.058258,  0.058641,  0.059024,  0.059407,  0.059790,  0.060172,  0.060555,  0.060938,
-	 0.061321,  0.061704,  0.062086,  0.062469,  0.062852,  0.063234,  0.063617,  0.064000,
-	 0.064383,  0.064765,  0.065148,  0.065531,  0.065913,  0.066296,  0.066679,  0.067061,
-	 0.067444,  0.067827,  0.068209,  0.068592,  0.068974,  0.069357,  0.069739,  0.070122,
-	 0.070505,  0.070887,  0.071270,  0.071652,  0.072035,  0.072417,  0.072800,  0.073182,
-	 0.073565,  0.073947,  0.074329,  0.074712,  0.075094,  0.075477,  0.075859,  0.076241,
-	 0.076624,  0.077006,  0.077389,  0.077771,  0.078153,  0.078536,  0.078918,  0.079300,
-	 0.079682,  0.080065,  0.080447,  0.080829,  0.081211,  0.081594,  0.081976,  0.082358,
-	 0.082740,  0.083122,  0.083505,  0.083887,  0.084269,  0.084651,  0.085033,  0.085415,
-	 0.085797,  0.086179,  0.086561,  0.086943,  0.087326,  0.087708,  0.088090,  0.088472,
-	 0.088854,  0.089236,  0.089617,  0.089999,  0.090381,  0.090763,  0.091145,  0.091527,
-	 0.091909,  0.092291,  0.092673,  0.093055,  0.093436,  0.093818,  0.094200,  0.094582,
-	 0.094963,  0.095345,  0.095727,  0.096109,  0.096490,  0.096872,  0.097254,  0.097635,
-	 0.098017,  0.098399,  0.098780,  0.099162,  0.099544,  0.099925,  0.100307,  0.100688,
-	 0.101070,  0.101451,  0.101833,  0.102214,  0.102596,  0.102977,  0.103359,  0.103740,
-	 0.104122,  0.104503,  0.104884,  0.105266,  0.105647,  0.106028,  0.106410,  0.106791,
-	 0.107172,  0.107554,  0.107935,  0.108316,  0.108697,  0.109079,  0.109460,  0.109841,
-	 0.110222,  0.110603,  0.110984,  0.111366,  0.111747,  0.112128,  0.112509,  0.112890,
-	 0.113271,  0.113652,  0.114033,  0.114414,  0.114795,  0.115176,  0.115557,  0.115938,
-	 0.116319,  0.116700,  0.117080,  0.117461,  0.117842,  0.118223,  0.118604,  0.118984,
-	 0.119365,  0.119746,  0.120127,  0.120507,  0.120888,  0.121269,  0.121649,  0.122030,
-	 0.122411,  0.122791,  0.123172,  0.123552,  0.123933,  0.124314,  0.124694,  0.125075,
-	 0.125455,  0.125835,  0.126216,  0.126596,  0.126977,  0.127357,  0.127737,  0.128118,
-	 0.128498,  0.128878,  0.129259,  0.129639,  0.130019,  0.130399,  0.130780,  0.131160,
-	 0.131540,  0.131920,  0.132300,  0.132680,  0.133061,  0.133441,  0.133821,  0.134201,
-	 0.134581,  0.134961,  0.135341,  0.135721,  0.136101,  0.136480,  0.136860,  0.137240,
-	 0.137620,  0.138000,  0.138380,  0.138760,  0.139139,  0.139519,  0.139899,  0.140279,
-	 0.140658,  0.141038,  0.141418,  0.141797,  0.142177,  0.142556,  0.142936,  0.143316,
-	 0.143695,  0.144075,  0.144454,  0.144833,  0.145213,  0.145592,  0.145972,  0.146351,
-	 0.146730,  0.147110,  0.147489,  0.147868,  0.148248,  0.148627,  0.149006,  0.149385,
-	 0.149765,  0.150144,  0.150523,  0.150902,  0.151281,  0.151660,  0.152039,  0.152418,
-	 0.152797,  0.153176,  0.153555,  0.153934,  0.154313,  0.154692,  0.155071,  0.155450,
-	 0.155828,  0.156207,  0.156586,  0.156965,  0.157343,  0.157722,  0.158101,  0.158480,
-	 0.158858,  0.159237,  0.159615,  0.159994,  0.160372,  0.160751,  0.161129,  0.161508,
-	 0.161886,  0.162265,  0.162643,  0.163022,  0.163400,  0.163778,  0.164157,  0.164535,
-	 0.164913,  0.165291,  0.165670,  0.166048,  0.166426,  0.166804,  0.167182,  0.167560,
-	 0.167938,  0.168316,  0.168694,  0.169072,  0.169450,  0.169828,  0.170206,  0.170584,
-	 0.170962,  0.171340,  0.171718,  0.172095,  0.172473,  0.172851,  0.173229,  0.173606,
-	 0.173984,  0.174362,  0.174739,  0.175117,  0.175494,  0.175872,  0.176249,  0.176627,
-	 0.177004,  0.177382,  0.177759,  0.178136,  0.178514,  0.178891,  0.179268,  0.179646,
-	 0.180023,  0.180400,  0.180777,  0.181154,  0.181532,  0.181909,  0.182286,  0.182663,
-	 0.183040,  0.183417,  0.183794,  0.184171,  0.184548,  0.184925,  0.185301,  0.185678,
-	 0.186055,  0.186432,  0.186809,  0.187185,  0.187562,  0.187939,  0.188315,  0.188692,
-	 0.189069,  0.189445,  0.189822,  0.190198,  0.190575,  0.190951,  0.191328,  0.191704,
-	 0.192080,  0.192457,  0.192833,  0.193209,  0.193586,  0.193962,  0.194338,  0.194714,
-	 0.195090,  0.195466,  0.195843,  0.196219,  0.196595,  0.196971,  0.197347,  0.197722,
-	 0.198098,  0.198474,  0.198850,  0.199226,  0.199602,  0.199978,  0.200353,  0.200729,
-	 0.201105,  0.201480,  0.201856,  0.202231,  0.202607,  0.202983,  0.203358,  0.203734,
-	 0.204109,  0.204484,  0.204860,  0.205235,  0.205610,  0.205986,  0.206361,  0.206736,
-	 0.207111,  0.207487,  0.207862,  0.208237,  0.208612,  0.208987,  0.209362,  0.209737,
-	 0.210112,  0.210487,  0.210862,  0.211237,  0.211611,  0.211986,  0.212361,  0.212736,
-	 0.213110,  0.213485,  0.213860,  0.214234,  0.214609,  0.214983,  0.215358,  0.215732,
-	 0.216107,  0.216481,  0.216856,  0.217230,  0.217604,  0.217979,  0.218353,  0.218727,
-	 0.219101,  0.219475,  0.219850,  0.220224,  0.220598,  0.220972,  0.221346,  0.221720,
-	 0.222094,  0.222468,  0.222841,  0.223215,  0.223589,  0.223963,  0.224337,  0.224710,
-	 0.225084,  0.225458,  0.225831,  0.226205,  0.226578,  0.226952,  0.227325,  0.227699,
-	 0.228072,  0.228445,  0.228819,  0.229192,  0.229565,  0.229939,  0.230312,  0.230685,
-	 0.231058,  0.231431,  0.231804,  0.232177,  0.232550,  0.232923,  0.233296,  0.233669,
-	 0.234042,  0.234415,  0.234788,  0.235160,  0.235533,  0.235906,  0.236278,  0.236651,
-	 0.237024,  0.237396,  0.237769,  0.238141,  0.238514,  0.238886,  0.239258,  0.239631,
-	 0.240003,  0.240375,  0.240748,  0.241120,  0.241492,  0.241864,  0.242236,  0.242608,
-	 0.242980,  0.243352,  0.243724,  0.244096,  0.244468,  0.244840,  0.245212,  0.245583,
-	 0.245955,  0.246327,  0.246698,  0.247070,  0.247442,  0.247813,  0.248185,  0.248556,
-	 0.248928,  0.249299,  0.249670,  0.250042,  0.250413,  0.250784,  0.251155,  0.251527,
-	 0.251898,  0.252269,  0.252640,  0.253011,  0.253382,  0.253753,  0.254124,  0.254495,
-	 0.254866,  0.255236,  0.255607,  0.255978,  0.256349,  0.256719,  0.257090,  0.257461,
-	 0.257831,  0.258202,  0.258572,  0.258943,  0.259313,  0.259683,  0.260054,  0.260424,
-	 0.260794,  0.261164,  0.261534,  0.261905,  0.262275,  0.262645,  0.263015,  0.263385,
-	 0.263755,  0.264125,  0.264494,  0.264864,  0.265234,  0.265604,  0.265973,  0.266343,
-	 0.266713,  0.267082,  0.267452,  0.267821,  0.268191,  0.268560,  0.268930,  0.269299,
-	 0.269668,  0.270038,  0.270407,  0.270776,  0.271145,  0.271514,  0.271883,  0.272252,
-	 0.272621,  0.272990,  0.273359,  0.273728,  0.274097,  0.274466,  0.274834,  0.275203,
-	 0.275572,  0.275940,  0.276309,  0.276678,  0.277046,  0.277415,  0.277783,  0.278151,
-	 0.278520,  0.278888,  0.279256,  0.279624,  0.279993,  0.280361,  0.280729,  0.281097,
-	 0.281465,  0.281833,  0.282201,  0.282569,  0.282937,  0.283304,  0.283672,  0.284040,
-	 0.284408,  0.284775,  0.285143,  0.285510,  0.285878,  0.286245,  0.286613,  0.286980,
-	 0.287347,  0.287715,  0.288082,  0.288449,  0.288816,  0.289184,  0.289551,  0.289918,
-	 0.290285,  0.290652,  0.291019,  0.291385,  0.291752,  0.292119,  0.292486,  0.292852,
-	 0.293219,  0.293586,  0.293952,  0.294319,  0.294685,  0.295052,  0.295418,  0.295785,
-	 0.296151,  0.296517,  0.296883,  0.297250,  0.297616,  0.297982,  0.298348,  0.298714,
-	 0.299080,  0.299446,  0.299812,  0.300177,  0.300543,  0.300909,  0.301275,  0.301640,
-	 0.302006,  0.302372,  0.302737,  0.303103,  0.303468,  0.303833,  0.304199,  0.304564,
-	 0.304929,  0.305294,  0.305660,  0.306025,  0.306390,  0.306755,  0.307120,  0.307485,
-	 0.307850,  0.308214,  0.308579,  0.308944,  0.309309,  0.309673,  0.310038,  0.310403,
-	 0.310767,  0.311132,  0.311496,  0.311860,  0.312225,  0.312589,  0.312953,  0.313318,
-	 0.313682,  0.314046,  0.314410,  0.314774,  0.315138,  0.315502,  0.315866,  0.316230,
-	 0.316593,  0.316957,  0.317321,  0.317684,  0.318048,  0.318412,  0.318775,  0.319139,
-	 0.319502,  0.319865,  0.320229,  0.320592,  0.320955,  0.321318,  0.321682,  0.322045,
-	 0.322408,  0.322771,  0.323134,  0.323497,  0.323859,  0.324222,  0.324585,  0.324948,
-	 0.325310,  0.325673,  0.326035,  0.326398,  0.326760,  0.327123,  0.327485,  0.327848,
-	 0.328210,  0.328572,  0.328934,  0.329296,  0.329658,  0.330020,  0.330382,  0.330744,
-	 0.331106,  0.331468,  0.331830,  0.332192,  0.332553,  0.332915,  0.333277,  0.333638,
-	 0.334000,  0.334361,  0.334722,  0.335084,  0.335445,  0.335806,  0.336168,  0.336529,
-	 0.336890,  0.337251,  0.337612,  0.337973,  0.338334,  0.338695,  0.339055,  0.339416,
-	 0.339777,  0.340138,  0.340498,  0.340859,  0.341219,  0.341580,  0.341940,  0.342300,
-	 0.342661,  0.343021,  0.343381,  0.343741,  0.344101,  0.344461,  0.344821,  0.345181,
-	 0.345541,  0.345901,  0.346261,  0.346621,  0.346980,  0.347340,  0.347700,  0.348059,
-	 0.348419,  0.348778,  0.349138,  0.349497,  0.349856,  0.350215,  0.350575,  0.350934,
-	 0.351293,  0.351652,  0.352011,  0.352370,  0.352729,  0.353087,  0.353446,  0.353805,
-	 0.354164,  0.354522,  0.354881,  0.355239,  0.355598,  0.355956,  0.356314,  0.356673,
-	 0.357031,  0.357389,  0.357747,  0.358105,  0.358463,  0.358821,  0.359179,  0.359537,
-	 0.359895,  0.360253,  0.360611,  0.360968,  0.361326,  0.361683,  0.362041,  0.362398,
-	 0.362756,  0.363113,  0.363470,  0.363828,  0.364185,  0.364542,  0.364899,  0.365256,
-	 0.365613,  0.365970,  0.366327,  0.366684,  0.367040,  0.367397,  0.367754,  0.368110,
-	 0.368467,  0.368823,  0.369180,  0.369536,  0.369892,  0.370249,  0.370605,  0.370961,
-	 0.371317,  0.371673,  0.372029,  0.372385,  0.372741,  0.373097,  0.373453,  0.373808,
-	 0.374164,  0.374520,  0.374875,  0.375231,  0.375586,  0.375942,  0.376297,  0.376652,
-	 0.377007,  0.377363,  0.377718,  0.378073,  0.378428,  0.378783,  0.379138,  0.379492,
-	 0.379847,  0.380202,  0.380557,  0.380911,  0.381266,  0.381620,  0.381975,  0.382329,
-	 0.382683,  0.383038,  0.383392,  0.383746,  0.384100,  0.384454,  0.384808,  0.385162,
-	 0.385516,  0.385870,  0.386224,  0.386577,  0.386931,  0.387285,  0.387638,  0.387992,
-	 0.388345,  0.388698,  0.389052,  0.389405,  0.389758,  0.390111,  0.390464,  0.390817,
-	 0.391170,  0.391523,  0.391876,  0.392229,  0.392582,  0.392934,  0.393287,  0.393640,
-	 0.393992,  0.394344,  0.394697,  0.395049,  0.395401,  0.395754,  0.396106,  0.396458,
-	 0.396810,  0.397162,  0.397514,  0.397866,  0.398218,  0.398569,  0.398921,  0.399273,
-	 0.399624,  0.399976,  0.400327,  0.400679,  0.401030,  0.401381,  0.401732,  0.402084,
-	 0.402435,  0.402786,  0.403137,  0.403488,  0.403838,  0.404189,  0.404540,  0.404891,
-	 0.405241,  0.405592,  0.405942,  0.406293,  0.406643,  0.406994,  0.407344,  0.407694,
-	 0.408044,  0.408394,  0.408744,  0.409094,  0.409444,  0.409794,  0.410144,  0.410493,
-	 0.410843,  0.411193,  0.411542,  0.411892,  0.412241,  0.412591,  0.412940,  0.413289,
-	 0.413638,  0.413987,  0.414337,  0.414685,  0.415034,  0.415383,  0.415732,  0.416081,
-	 0.416430,  0.416778,  0.417127,  0.417475,  0.417824,  0.418172,  0.418520,  0.418869,
-	 0.419217,  0.419565,  0.419913,  0.420261,  0.420609,  0.420957,  0.421305,  0.421653,
-	 0.422000,  0.422348,  0.422695,  0.423043,  0.423390,  0.423738,  0.424085,  0.424432,
-	 0.424780,  0.425127,  0.425474,  0.425821,  0.426168,  0.426515,  0.426862,  0.427208,
-	 0.427555,  0.427902,  0.428248,  0.428595,  0.428941,  0.429288,  0.429634,  0.429980,
-	 0.430326,  0.430673,  0.431019,  0.431365,  0.431711,  0.432057,  0.432402,  0.432748,
-	 0.433094,  0.433439,  0.433785,  0.434131,  0.434476,  0.434821,  0.435167,  0.435512,
-	 0.435857,  0.436202,  0.436547,  0.436892,  0.437237,  0.437582,  0.437927,  0.438272,
-	 0.438616,  0.438961,  0.439305,  0.439650,  0.439994,  0.440339,  0.440683,  0.441027,
-	 0.441371,  0.441715,  0.442059,  0.442403,  0.442747,  0.443091,  0.443435,  0.443779,
-	 0.444122,  0.444466,  0.444809,  0.445153,  0.445496,  0.445839,  0.446183,  0.446526,
-	 0.446869,  0.447212,  0.447555,  0.447898,  0.448241,  0.448583,  0.448926,  0.449269,
-	 0.449611,  0.449954,  0.450296,  0.450639,  0.450981,  0.451323,  0.451665,  0.452008,
-	 0.452350,  0.452692,  0.453033,  0.453375,  0.453717,  0.454059,  0.454400,  0.454742,
-	 0.455084,  0.455425,  0.455766,  0.456108,  0.456449,  0.456790,  0.457131,  0.457472,
-	 0.457813,  0.458154,  0.458495,  0.458836,  0.459177,  0.459517,  0.459858,  0.460198,
-	 0.460539,  0.460879,  0.461219,  0.461560,  0.461900,  0.462240,  0.462580,  0.462920,
-	 0.463260,  0.463600,  0.463939,  0.464279,  0.464619,  0.464958,  0.465298,  0.465637,
-	 0.465977,  0.466316,  0.466655,  0.466994,  0.467333,  0.467672,  0.468011,  0.468350,
-	 0.468689,  0.469028,  0.469366,  0.469705,  0.470043,  0.470382,  0.470720,  0.471058,
-	 0.471397,  0.471735,  0.472073,  0.472411,  0.472749,  0.473087,  0.473425,  0.473763,
-	 0.474100,  0.474438,  0.474775,  0.475113,  0.475450,  0.475788,  0.476125,  0.476462,
-	 0.476799,  0.477136,  0.477473,  0.477810,  0.478147,  0.478484,  0.478821,  0.479157,
-	 0.479494,  0.479830,  0.480167,  0.480503,  0.480839,  0.481176,  0.481512,  0.481848,
-	 0.482184,  0.482520,  0.482856,  0.483191,  0.483527,  0.483863,  0.484198,  0.484534,
-	 0.484869,  0.485205,  0.485540,  0.485875,  0.486210,  0.486545,  0.486880,  0.487215,
-	 0.487550,  0.487885,  0.488220,  0.488554,  0.488889,  0.489223,  0.489558,  0.489892,
-	 0.490226,  0.490561,  0.490895,  0.491229,  0.491563,  0.491897,  0.492231,  0.492564,
-	 0.492898,  0.493232,  0.493565,  0.493899,  0.494232,  0.494566,  0.494899,  0.495232,
-	 0.495565,  0.495898,  0.496231,  0.496564,  0.496897,  0.497230,  0.497562,  0.497895,
-	 0.498228,  0.498560,  0.498893,  0.499225,  0.499557,  0.499889,  0.500221,  0.500553,
-	 0.500885,  0.501217,  0.501549,  0.501881,  0.502212,  0.502544,  0.502876,  0.503207,
-	 0.503538,  0.503870,  0.504201,  0.504532,  0.504863,  0.505194,  0.505525,  0.505856,
-	 0.506187,  0.506517,  0.506848,  0.507179,  0.507509,  0.507839,  0.508170,  0.508500,
-	 0.508830,  0.509160,  0.509490,  0.509820,  0.510150,  0.510480,  0.510810,  0.511139,
-	 0.511469,  0.511798,  0.512128,  0.512457,  0.512786,  0.513116,  0.513445,  0.513774,
-	 0.514103,  0.514432,  0.514760,  0.515089,  0.515418,  0.515746,  0.516075,  0.516403,
-	 0.516732,  0.517060,  0.517388,  0.517716,  0.518045,  0.518372,  0.518700,  0.519028,
-	 0.519356,  0.519684,  0.520011,  0.520339,  0.520666,  0.520994,  0.521321,  0.521648,
-	 0.521975,  0.522302,  0.522629,  0.522956,  0.523283,  0.523610,  0.523937,  0.524263,
-	 0.524590,  0.524916,  0.525243,  0.525569,  0.525895,  0.526221,  0.526547,  0.526873,
-	 0.527199,  0.527525,  0.527851,  0.528176,  0.528502,  0.528828,  0.529153,  0.529478,
-	 0.529804,  0.530129,  0.530454,  0.530779,  0.531104,  0.531429,  0.531754,  0.532078,
-	 0.532403,  0.532728,  0.533052,  0.533377,  0.533701,  0.534025,  0.534349,  0.534674,
-	 0.534998,  0.535322,  0.535645,  0.535969,  0.536293,  0.536617,  0.536940,  0.537264,
-	 0.537587,  0.537910,  0.538234,  0.538557,  0.538880,  0.539203,  0.539526,  0.539849,
-	 0.540171,  0.540494,  0.540817,  0.541139,  0.541462,  0.541784,  0.542106,  0.542429,
-	 0.542751,  0.543073,  0.543395,  0.543717,  0.544039,  0.544360,  0.544682,  0.545003,
-	 0.545325,  0.545646,  0.545968,  0.546289,  0.546610,  0.546931,  0.547252,  0.547573,
-	 0.547894,  0.548215,  0.548536,  0.548856,  0.549177,  0.549497,  0.549818,  0.550138,
-	 0.550458,  0.550778,  0.551098,  0.551418,  0.551738,  0.552058,  0.552378,  0.552697,
-	 0.553017,  0.553336,  0.553656,  0.553975,  0.554294,  0.554613,  0.554932,  0.555251,
-	 0.555570,  0.555889,  0.556208,  0.556526,  0.556845,  0.557164,  0.557482,  0.557800,
-	 0.558119,  0.558437,  0.558755,  0.559073,  0.559391,  0.559709,  0.560026,  0.560344,
-	 0.560662,  0.560979,  0.561297,  0.561614,  0.561931,  0.562248,  0.562565,  0.562882,
-	 0.563199,  0.563516,  0.563833,  0.564150,  0.564466,  0.564783,  0.565099,  0.565416,
-	 0.565732,  0.566048,  0.566364,  0.566680,  0.566996,  0.567312,  0.567628,  0.567943,
-	 0.568259,  0.568574,  0.568890,  0.569205,  0.569521,  0.569836,  0.570151,  0.570466,
-	 0.570781,  0.571096,  0.571410,  0.571725,  0.572040,  0.572354,  0.572669,  0.572983,
-	 0.573297,  0.573611,  0.573925,  0.574239,  0.574553,  0.574867,  0.575181,  0.575495,
-	 0.575808,  0.576122,  0.576435,  0.576748,  0.577062,  0.577375,  0.577688,  0.578001,
-	 0.578314,  0.578627,  0.578939,  0.579252,  0.579565,  0.579877,  0.580189,  0.580502,
-	 0.580814,  0.581126,  0.581438,  0.581750,  0.582062,  0.582374,  0.582685,  0.582997,
-	 0.583309,  0.583620,  0.583931,  0.584243,  0.584554,  0.584865,  0.585176,  0.585487,
-	 0.585798,  0.586109,  0.586419,  0.586730,  0.587040,  0.587351,  0.587661,  0.587971,
-	 0.588282,  0.588592,  0.588902,  0.589212,  0.589521,  0.589831,  0.590141,  0.590450,
-	 0.590760,  0.591069,  0.591378,  0.591688,  0.591997,  0.592306,  0.592615,  0.592924,
-	 0.593232,  0.593541,  0.593850,  0.594158,  0.594467,  0.594775,  0.595083,  0.595391,
-	 0.595699,  0.596007,  0.596315,  0.596623,  0.596931,  0.597238,  0.597546,  0.597853,
-	 0.598161,  0.598468,  0.598775,  0.599082,  0.599389,  0.599696,  0.600003,  0.600310,
-	 0.600616,  0.600923,  0.601230,  0.601536,  0.601842,  0.602148,  0.602455,  0.602761,
-	 0.603067,  0.603372,  0.603678,  0.603984,  0.604290,  0.604595,  0.604900,  0.605206,
-	 0.605511,  0.605816,  0.606121,  0.606426,  0.606731,  0.607036,  0.607341,  0.607645,
-	 0.607950,  0.608254,  0.608559,  0.608863,  0.609167,  0.609471,  0.609775,  0.610079,
-	 0.610383,  0.610687,  0.610990,  0.611294,  0.611597,  0.611901,  0.612204,  0.612507,
-	 0.612810,  0.613113,  0.613416,  0.613719,  0.614022,  0.614324,  0.614627,  0.614929,
-	 0.615232,  0.615534,  0.615836,  0.616138,  0.616440,  0.616742,  0.617044,  0.617346,
-	 0.617647,  0.617949,  0.618250,  0.618552,  0.618853,  0.619154,  0.619455,  0.619756,
-	 0.620057,  0.620358,  0.620659,  0.620959,  0.621260,  0.621560,  0.621861,  0.622161,
-	 0.622461,  0.622761,  0.623061,  0.623361,  0.623661,  0.623961,  0.624260,  0.624560,
-	 0.624860,  0.625159,  0.625458,  0.625757,  0.626056,  0.626355,  0.626654,  0.626953,
-	 0.627252,  0.627550,  0.627849,  0.628147,  0.628446,  0.628744,  0.629042,  0.629340,
-	 0.629638,  0.629936,  0.630234,  0.630532,  0.630829,  0.631127,  0.631424,  0.631721,
-	 0.632019,  0.632316,  0.632613,  0.632910,  0.633207,  0.633504,  0.633800,  0.634097,
-	 0.634393,  0.634690,  0.634986,  0.635282,  0.635578,  0.635874,  0.636170,  0.636466,
-	 0.636762,  0.637057,  0.637353,  0.637649,  0.637944,  0.638239,  0.638534,  0.638829,
-	 0.639124,  0.639419,  0.639714,  0.640009,  0.640303,  0.640598,  0.640892,  0.641187,
-	 0.641481,  0.641775,  0.642069,  0.642363,  0.642657,  0.642951,  0.643245,  0.643538,
-	 0.643832,  0.644125,  0.644418,  0.644711,  0.645005,  0.645298,  0.645590,  0.645883,
-	 0.646176,  0.646469,  0.646761,  0.647054,  0.647346,  0.647638,  0.647930,  0.648222,
-	 0.648514,  0.648806,  0.649098,  0.649390,  0.649681,  0.649973,  0.650264,  0.650555,
-	 0.650847,  0.651138,  0.651429,  0.651720,  0.652011,  0.652301,  0.652592,  0.652882,
-	 0.653173,  0.653463,  0.653753,  0.654044,  0.654334,  0.654624,  0.654913,  0.655203,
-	 0.655493,  0.655782,  0.656072,  0.656361,  0.656651,  0.656940,  0.657229,  0.657518,
-	 0.657807,  0.658095,  0.658384,  0.658673,  0.658961,  0.659250,  0.659538,  0.659826,
-	 0.660114,  0.660402,  0.660690,  0.660978,  0.661266,  0.661553,  0.661841,  0.662128,
-	 0.662416,  0.662703,  0.662990,  0.663277,  0.663564,  0.663851,  0.664138,  0.664424,
-	 0.664711,  0.664997,  0.665284,  0.665570,  0.665856,  0.666142,  0.666428,  0.666714,
-	 0.667000,  0.667286,  0.667571,  0.667857,  0.668142,  0.668427,  0.668712,  0.668998,
-	 0.669283,  0.669567,  0.669852,  0.670137,  0.670422,  0.670706,  0.670990,  0.671275,
-	 0.671559,  0.671843,  0.672127,  0.672411,  0.672695,  0.672978,  0.673262,  0.673546,
-	 0.673829,  0.674112,  0.674396,  0.674679,  0.674962,  0.675245,  0.675527,  0.675810,
-	 0.676093,  0.676375,  0.676658,  0.676940,  0.677222,  0.677504,  0.677786,  0.678068,
-	 0.678350,  0.678632,  0.678913,  0.679195,  0.679476,  0.679758,  0.680039,  0.680320,
-	 0.680601,  0.680882,  0.681163,  0.681443,  0.681724,  0.682005,  0.682285,  0.682565,
-	 0.682846,  0.683126,  0.683406,  0.683686,  0.683965,  0.684245,  0.684525,  0.684804,
-	 0.685084,  0.685363,  0.685642,  0.685921,  0.686200,  0.686479,  0.686758,  0.687037,
-	 0.687315,  0.687594,  0.687872,  0.688151,  0.688429,  0.688707,  0.688985,  0.689263,
-	 0.689541,  0.689818,  0.690096,  0.690373,  0.690651,  0.690928,  0.691205,  0.691482,
-	 0.691759,  0.692036,  0.692313,  0.692590,  0.692866,  0.693143,  0.693419,  0.693695,
-	 0.693971,  0.694248,  0.694524,  0.694799,  0.695075,  0.695351,  0.695626,  0.695902,
-	 0.696177,  0.696452,  0.696728,  0.697003,  0.697277,  0.697552,  0.697827,  0.698102,
-	 0.698376,  0.698651,  0.698925,  0.699199,  0.699473,  0.699747,  0.700021,  0.700295,
-	 0.700569,  0.700842,  0.701116,  0.701389,  0.701663,  0.701936,  0.702209,  0.702482,
-	 0.702755,  0.703028,  0.703300,  0.703573,  0.703845,  0.704118,  0.704390,  0.704662,
-	 0.704934,  0.705206,  0.705478,  0.705750,  0.706021,  0.706293,  0.706564,  0.706836,
-	 0.707107,  0.707378,  0.707649,  0.707920,  0.708191,  0.708461,  0.708732,  0.709002,
-	 0.709273,  0.709543,  0.709813,  0.710083,  0.710353,  0.710623,  0.710893,  0.711163,
-	 0.711432,  0.711702,  0.711971,  0.712240,  0.712509,  0.712778,  0.713047,  0.713316,
-	 0.713585,  0.713853,  0.714122,  0.714390,  0.714659,  0.714927,  0.715195,  0.715463,
-	 0.715731,  0.715999,  0.716266,  0.716534,  0.716801,  0.717069,  0.717336,  0.717603,
-	 0.717870,  0.718137,  0.718404,  0.718670,  0.718937,  0.719204,  0.719470,  0.719736,
-	 0.720003,  0.720269,  0.720535,  0.720800,  0.721066,  0.721332,  0.721597,  0.721863,
-	 0.722128,  0.722393,  0.722659,  0.722924,  0.723188,  0.723453,  0.723718,  0.723983,
-	 0.724247,  0.724511,  0.724776,  0.725040,  0.725304,  0.725568,  0.725832,  0.726095,
-	 0.726359,  0.726623,  0.726886,  0.727149,  0.727413,  0.727676,  0.727939,  0.728202,
-	 0.728464,  0.728727,  0.728990,  0.729252,  0.729514,  0.729777,  0.730039,  0.730301,
-	 0.730563,  0.730825,  0.731086,  0.731348,  0.731609,  0.731871,  0.732132,  0.732393,
-	 0.732654,  0.732915,  0.733176,  0.733437,  0.733697,  0.733958,  0.734218,  0.734479,
-	 0.734739,  0.734999,  0.735259,  0.735519,  0.735779,  0.736038,  0.736298,  0.736557,
-	 0.736817,  0.737076,  0.737335,  0.737594,  0.737853,  0.738112,  0.738370,  0.738629,
-	 0.738887,  0.739146,  0.739404,  0.739662,  0.739920,  0.740178,  0.740436,  0.740694,
-	 0.740951,  0.741209,  0.741466,  0.741723,  0.741980,  0.742237,  0.742494,  0.742751,
-	 0.743008,  0.743265,  0.743521,  0.743777,  0.744034,  0.744290,  0.744546,  0.744802,
-	 0.745058,  0.745314,  0.745569,  0.745825,  0.746080,  0.746335,  0.746591,  0.746846,
-	 0.747101,  0.747355,  0.747610,  0.747865,  0.748119,  0.748374,  0.748628,  0.748882,
-	 0.749136,  0.749390,  0.749644,  0.749898,  0.750152,  0.750405,  0.750659,  0.750912,
-	 0.751165,  0.751418,  0.751671,  0.751924,  0.752177,  0.752429,  0.752682,  0.752934,
-	 0.753187,  0.753439,  0.753691,  0.753943,  0.754195,  0.754447,  0.754698,  0.754950,
-	 0.755201,  0.755453,  0.755704,  0.755955,  0.756206,  0.756457,  0.756708,  0.756958,
-	 0.757209,  0.757459,  0.757710,  0.757960,  0.758210,  0.758460,  0.758710,  0.758960,
-	 0.759209,  0.759459,  0.759708,  0.759957,  0.760207,  0.760456,  0.760705,  0.760954,
-	 0.761202,  0.761451,  0.761700,  0.761948,  0.762196,  0.762444,  0.762693,  0.762941,
-	 0.763188,  0.763436,  0.763684,  0.763931,  0.764179,  0.764426,  0.764673,  0.764920,
-	 0.765167,  0.765414,  0.765661,  0.765907,  0.766154,  0.766400,  0.766647,  0.766893,
-	 0.767139,  0.767385,  0.767631,  0.767876,  0.768122,  0.768368,  0.768613,  0.768858,
-	 0.769103,  0.769348,  0.769593,  0.769838,  0.770083,  0.770327,  0.770572,  0.770816,
-	 0.771061,  0.771305,  0.771549,  0.771793,  0.772036,  0.772280,  0.772524,  0.772767,
-	 0.773010,  0.773254,  0.773497,  0.773740,  0.773983,  0.774225,  0.774468,  0.774711,
-	 0.774953,  0.775195,  0.775438,  0.775680,  0.775922,  0.776164,  0.776405,  0.776647,
-	 0.776888,  0.777130,  0.777371,  0.777612,  0.777853,  0.778094,  0.778335,  0.778576,
-	 0.778817,  0.779057,  0.779297,  0.779538,  0.779778,  0.780018,  0.780258,  0.780498,
-	 0.780737,  0.780977,  0.781216,  0.781456,  0.781695,  0.781934,  0.782173,  0.782412,
-	 0.782651,  0.782889,  0.783128,  0.783366,  0.783605,  0.783843,  0.784081,  0.784319,
-	 0.784557,  0.784794,  0.785032,  0.785269,  0.785507,  0.785744,  0.785981,  0.786218,
-	 0.786455,  0.786692,  0.786929,  0.787165,  0.787402,  0.787638,  0.787874,  0.788110,
-	 0.788346,  0.788582,  0.788818,  0.789054,  0.789289,  0.789525,  0.789760,  0.789995,
-	 0.790230,  0.790465,  0.790700,  0.790935,  0.791169,  0.791404,  0.791638,  0.791872,
-	 0.792107,  0.792341,  0.792575,  0.792808,  0.793042,  0.793276,  0.793509,  0.793742,
-	 0.793975,  0.794209,  0.794442,  0.794674,  0.794907,  0.795140,  0.795372,  0.795605,
-	 0.795837,  0.796069,  0.796301,  0.796533,  0.796765,  0.796996,  0.797228,  0.797459,
-	 0.797691,  0.797922,  0.798153,  0.798384,  0.798615,  0.798846,  0.799076,  0.799307,
-	 0.799537,  0.799768,  0.799998,  0.800228,  0.800458,  0.800687,  0.800917,  0.801147,
-	 0.801376,  0.801606,  0.801835,  0.802064,  0.802293,  0.802522,  0.802750,  0.802979,
-	 0.803208,  0.803436,  0.803664,  0.803892,  0.804120,  0.804348,  0.804576,  0.804804,
-	 0.805031,  0.805259,  0.805486,  0.805713,  0.805940,  0.806167,  0.806394,  0.806621,
-	 0.806848,  0.807074,  0.807300,  0.807527,  0.807753,  0.807979,  0.808205,  0.808430,
-	 0.808656,  0.808882,  0.809107,  0.809332,  0.809558,  0.809783,  0.810008,  0.810232,
-	 0.810457,  0.810682,  0.810906,  0.811131,  0.811355,  0.811579,  0.811803,  0.812027,
-	 0.812251,  0.812474,  0.812698,  0.812921,  0.813144,  0.813368,  0.813591,  0.813814,
-	 0.814036,  0.814259,  0.814482,  0.814704,  0.814926,  0.815149,  0.815371,  0.815593,
-	 0.815814,  0.816036,  0.816258,  0.816479,  0.816701,  0.816922,  0.817143,  0.817364,
-	 0.817585,  0.817806,  0.818026,  0.818247,  0.818467,  0.818687,  0.818908,  0.819128,
-	 0.819348,  0.819567,  0.819787,  0.820007,  0.820226,  0.820445,  0.820664,  0.820884,
-	 0.821102,  0.821321,  0.821540,  0.821759,  0.821977,  0.822195,  0.822414,  0.822632,
-	 0.822850,  0.823068,  0.823285,  0.823503,  0.823721,  0.823938,  0.824155,  0.824372,
-	 0.824589,  0.824806,  0.825023,  0.825240,  0.825456,  0.825673,  0.825889,  0.826105,
-	 0.826321,  0.826537,  0.826753,  0.826968,  0.827184,  0.827399,  0.827615,  0.827830,
-	 0.828045,  0.828260,  0.828475,  0.828690,  0.828904,  0.829119,  0.829333,  0.829547,
-	 0.829761,  0.829975,  0.830189,  0.830403,  0.830616,  0.830830,  0.831043,  0.831257,
-	 0.831470,  0.831683,  0.831895,  0.832108,  0.832321,  0.832533,  0.832746,  0.832958,
-	 0.833170,  0.833382,  0.833594,  0.833806,  0.834018,  0.834229,  0.834440,  0.834652,
-	 0.834863,  0.835074,  0.835285,  0.835496,  0.835706,  0.835917,  0.836127,  0.836338,
-	 0.836548,  0.836758,  0.836968,  0.837178,  0.837387,  0.837597,  0.837806,  0.838015,
-	 0.838225,  0.838434,  0.838643,  0.838852,  0.839060,  0.839269,  0.839477,  0.839686,
-	 0.839894,  0.840102,  0.840310,  0.840518,  0.840725,  0.840933,  0.841140,  0.841348,
-	 0.841555,  0.841762,  0.841969,  0.842176,  0.842383,  0.842589,  0.842796,  0.843002,
-	 0.843208,  0.843414,  0.843620,  0.843826,  0.844032,  0.844238,  0.844443,  0.844648,
-	 0.844854,  0.845059,  0.845264,  0.845469,  0.845673,  0.845878,  0.846082,  0.846287,
-	 0.846491,  0.846695,  0.846899,  0.847103,  0.847307,  0.847510,  0.847714,  0.847917,
-	 0.848120,  0.848323,  0.848526,  0.848729,  0.848932,  0.849135,  0.849337,  0.849540,
-	 0.849742,  0.849944,  0.850146,  0.850348,  0.850549,  0.850751,  0.850953,  0.851154,
-	 0.851355,  0.851556,  0.851757,  0.851958,  0.852159,  0.852360,  0.852560,  0.852760,
-	 0.852961,  0.853161,  0.853361,  0.853561,  0.853760,  0.853960,  0.854159,  0.854359,
-	 0.854558,  0.854757,  0.854956,  0.855155,  0.855354,  0.855552,  0.855751,  0.855949,
-	 0.856147,  0.856345,  0.856543,  0.856741,  0.856939,  0.857137,  0.857334,  0.857531,
-	 0.857729,  0.857926,  0.858123,  0.858320,  0.858516,  0.858713,  0.858909,  0.859106,
-	 0.859302,  0.859498,  0.859694,  0.859890,  0.860085,  0.860281,  0.860476,  0.860672,
-	 0.860867,  0.861062,  0.861257,  0.861452,  0.861646,  0.861841,  0.862035,  0.862230,
-	 0.862424,  0.862618,  0.862812,  0.863006,  0.863199,  0.863393,  0.863586,  0.863780,
-	 0.863973,  0.864166,  0.864359,  0.864552,  0.864744,  0.864937,  0.865129,  0.865321,
-	 0.865514,  0.865706,  0.865898,  0.866089,  0.866281,  0.866472,  0.866664,  0.866855,
-	 0.867046,  0.867237,  0.867428,  0.867619,  0.867809,  0.868000,  0.868190,  0.868381,
-	 0.868571,  0.868761,  0.868951,  0.869140,  0.869330,  0.869519,  0.869709,  0.869898,
-	 0.870087,  0.870276,  0.870465,  0.870654,  0.870842,  0.871031,  0.871219,  0.871407,
-	 0.871595,  0.871783,  0.871971,  0.872159,  0.872346,  0.872534,  0.872721,  0.872908,
-	 0.873095,  0.873282,  0.873469,  0.873655,  0.873842,  0.874028,  0.874215,  0.874401,
-	 0.874587,  0.874773,  0.874958,  0.875144,  0.875329,  0.875515,  0.875700,  0.875885,
-	 0.876070,  0.876255,  0.876440,  0.876624,  0.876809,  0.876993,  0.877177,  0.877361,
-	 0.877545,  0.877729,  0.877913,  0.878096,  0.878280,  0.878463,  0.878646,  0.878829,
-	 0.879012,  0.879195,  0.879378,  0.879560,  0.879743,  0.879925,  0.880107,  0.880289,
-	 0.880471,  0.880653,  0.880834,  0.881016,  0.881197,  0.881378,  0.881559,  0.881740,
-	 0.881921,  0.882102,  0.882283,  0.882463,  0.882643,  0.882824,  0.883004,  0.883184,
-	 0.883363,  0.883543,  0.883723,  0.883902,  0.884081,  0.884260,  0.884439,  0.884618,
-	 0.884797,  0.884976,  0.885154,  0.885333,  0.885511,  0.885689,  0.885867,  0.886045,
-	 0.886223,  0.886400,  0.886578,  0.886755,  0.886932,  0.887109,  0.887286,  0.887463,
-	 0.887640,  0.887816,  0.887993,  0.888169,  0.888345,  0.888521,  0.888697,  0.888873,
-	 0.889048,  0.889224,  0.889399,  0.889574,  0.889750,  0.889925,  0.890099,  0.890274,
-	 0.890449,  0.890623,  0.890797,  0.890972,  0.891146,  0.891320,  0.891493,  0.891667,
-	 0.891841,  0.892014,  0.892187,  0.892361,  0.892534,  0.892706,  0.892879,  0.893052,
-	 0.893224,  0.893397,  0.893569,  0.893741,  0.893913,  0.894085,  0.894256,  0.894428,
-	 0.894599,  0.894771,  0.894942,  0.895113,  0.895284,  0.895455,  0.895625,  0.895796,
-	 0.895966,  0.896137,  0.896307,  0.896477,  0.896646,  0.896816,  0.896986,  0.897155,
-	 0.897325,  0.897494,  0.897663,  0.897832,  0.898001,  0.898169,  0.898338,  0.898506,
-	 0.898674,  0.898843,  0.899011,  0.899179,  0.899346,  0.899514,  0.899681,  0.899849,
-	 0.900016,  0.900183,  0.900350,  0.900517,  0.900683,  0.900850,  0.901016,  0.901183,
-	 0.901349,  0.901515,  0.901681,  0.901847,  0.902012,  0.902178,  0.902343,  0.902508,
-	 0.902673,  0.902838,  0.903003,  0.903168,  0.903332,  0.903497,  0.903661,  0.903825,
-	 0.903989,  0.904153,  0.904317,  0.904481,  0.904644,  0.904807,  0.904971,  0.905134,
-	 0.905297,  0.905460,  0.905622,  0.905785,  0.905947,  0.906110,  0.906272,  0.906434,
-	 0.906596,  0.906757,  0.906919,  0.907081,  0.907242,  0.907403,  0.907564,  0.907725,
-	 0.907886,  0.908047,  0.908207,  0.908368,  0.908528,  0.908688,  0.908848,  0.909008,
-	 0.909168,  0.909328,  0.909487,  0.909646,  0.909806,  0.909965,  0.910124,  0.910283,
-	 0.910441,  0.910600,  0.910758,  0.910917,  0.911075,  0.911233,  0.911391,  0.911548,
-	 0.911706,  0.911864,  0.912021,  0.912178,  0.912335,  0.912492,  0.912649,  0.912806,
-	 0.912962,  0.913119,  0.913275,  0.913431,  0.913587,  0.913743,  0.913899,  0.914054,
-	 0.914210,  0.914365,  0.914520,  0.914675,  0.914830,  0.914985,  0.915140,  0.915294,
-	 0.915449,  0.915603,  0.915757,  0.915911,  0.916065,  0.916219,  0.916372,  0.916526,
-	 0.916679,  0.916832,  0.916985,  0.917138,  0.917291,  0.917444,  0.917596,  0.917749,
-	 0.917901,  0.918053,  0.918205,  0.918357,  0.918508,  0.918660,  0.918811,  0.918963,
-	 0.919114,  0.919265,  0.919416,  0.919567,  0.919717,  0.919868,  0.920018,  0.920168,
-	 0.920318,  0.920468,  0.920618,  0.920768,  0.920917,  0.921067,  0.921216,  0.921365,
-	 0.921514,  0.921663,  0.921812,  0.921960,  0.922109,  0.922257,  0.922405,  0.922553,
-	 0.922701,  0.922849,  0.922997,  0.923144,  0.923291,  0.923439,  0.923586,  0.923733,
-	 0.923880,  0.924026,  0.924173,  0.924319,  0.924465,  0.924612,  0.924758,  0.924904,
-	 0.925049,  0.925195,  0.925340,  0.925486,  0.925631,  0.925776,  0.925921,  0.926066,
-	 0.926210,  0.926355,  0.926499,  0.926643,  0.926787,  0.926931,  0.927075,  0.927219,
-	 0.927363,  0.927506,  0.927649,  0.927792,  0.927935,  0.928078,  0.928221,  0.928364,
-	 0.928506,  0.928648,  0.928791,  0.928933,  0.929075,  0.929216,  0.929358,  0.929500,
-	 0.929641,  0.929782,  0.929923,  0.930064,  0.930205,  0.930346,  0.930486,  0.930627,
-	 0.930767,  0.930907,  0.931047,  0.931187,  0.931327,  0.931466,  0.931606,  0.931745,
-	 0.931884,  0.932023,  0.932162,  0.932301,  0.932440,  0.932578,  0.932716,  0.932855,
-	 0.932993,  0.933131,  0.933269,  0.933406,  0.933544,  0.933681,  0.933818,  0.933956,
-	 0.934093,  0.934229,  0.934366,  0.934503,  0.934639,  0.934775,  0.934912,  0.935048,
-	 0.935184,  0.935319,  0.935455,  0.935590,  0.935726,  0.935861,  0.935996,  0.936131,
-	 0.936266,  0.936400,  0.936535,  0.936669,  0.936803,  0.936938,  0.937072,  0.937205,
-	 0.937339,  0.937473,  0.937606,  0.937739,  0.937872,  0.938005,  0.938138,  0.938271,
-	 0.938404,  0.938536,  0.938668,  0.938800,  0.938932,  0.939064,  0.939196,  0.939328,
-	 0.939459,  0.939591,  0.939722,  0.939853,  0.939984,  0.940115,  0.940245,  0.940376,
-	 0.940506,  0.940636,  0.940766,  0.940896,  0.941026,  0.941156,  0.941285,  0.941415,
-	 0.941544,  0.941673,  0.941802,  0.941931,  0.942060,  0.942188,  0.942317,  0.942445,
-	 0.942573,  0.942701,  0.942829,  0.942957,  0.943084,  0.943212,  0.943339,  0.943466,
-	 0.943593,  0.943720,  0.943847,  0.943974,  0.944100,  0.944227,  0.944353,  0.944479,
-	 0.944605,  0.944731,  0.944856,  0.944982,  0.945107,  0.945232,  0.945358,  0.945482,
-	 0.945607,  0.945732,  0.945857,  0.945981,  0.946105,  0.946229,  0.946353,  0.946477,
-	 0.946601,  0.946724,  0.946848,  0.946971,  0.947094,  0.947217,  0.947340,  0.947463,
-	 0.947586,  0.947708,  0.947830,  0.947953,  0.948075,  0.948196,  0.948318,  0.948440,
-	 0.948561,  0.948683,  0.948804,  0.948925,  0.949046,  0.949167,  0.949287,  0.949408,
-	 0.949528,  0.949648,  0.949768,  0.949888,  0.950008,  0.950128,  0.950247,  0.950367,
-	 0.950486,  0.950605,  0.950724,  0.950843,  0.950962,  0.951080,  0.951199,  0.951317,
-	 0.951435,  0.951553,  0.951671,  0.951789,  0.951906,  0.952024,  0.952141,  0.952258,
-	 0.952375,  0.952492,  0.952609,  0.952725,  0.952842,  0.952958,  0.953074,  0.953190,
-	 0.953306,  0.953422,  0.953537,  0.953653,  0.953768,  0.953883,  0.953998,  0.954113,
-	 0.954228,  0.954343,  0.954457,  0.954572,  0.954686,  0.954800,  0.954914,  0.955028,
-	 0.955141,  0.955255,  0.955368,  0.955481,  0.955594,  0.955707,  0.955820,  0.955933,
-	 0.956045,  0.956158,  0.956270,  0.956382,  0.956494,  0.956606,  0.956717,  0.956829,
-	 0.956940,  0.957052,  0.957163,  0.957274,  0.957385,  0.957495,  0.957606,  0.957716,
-	 0.957826,  0.957937,  0.958046,  0.958156,  0.958266,  0.958376,  0.958485,  0.958594,
-	 0.958703,  0.958812,  0.958921,  0.959030,  0.959139,  0.959247,  0.959355,  0.959463,
-	 0.959572,  0.959679,  0.959787,  0.959895,  0.960002,  0.960109,  0.960217,  0.960324,
-	 0.960431,  0.960537,  0.960644,  0.960750,  0.960857,  0.960963,  0.961069,  0.961175,
-	 0.961280,  0.961386,  0.961492,  0.961597,  0.961702,  0.961807,  0.961912,  0.962017,
-	 0.962121,  0.962226,  0.962330,  0.962434,  0.962538,  0.962642,  0.962746,  0.962850,
-	 0.962953,  0.963057,  0.963160,  0.963263,  0.963366,  0.963469,  0.963571,  0.963674,
-	 0.963776,  0.963878,  0.963980,  0.964082,  0.964184,  0.964286,  0.964387,  0.964489,
-	 0.964590,  0.964691,  0.964792,  0.964893,  0.964993,  0.965094,  0.965194,  0.965294,
-	 0.965394,  0.965494,  0.965594,  0.965694,  0.965793,  0.965893,  0.965992,  0.966091,
-	 0.966190,  0.966289,  0.966387,  0.966486,  0.966584,  0.966683,  0.966781,  0.966879,
-	 0.966976,  0.967074,  0.967172,  0.967269,  0.967366,  0.967463,  0.967560,  0.967657,
-	 0.967754,  0.967850,  0.967947,  0.968043,  0.968139,  0.968235,  0.968331,  0.968427,
-	 0.968522,  0.968617,  0.968713,  0.968808,  0.968903,  0.968998,  0.969092,  0.969187,
-	 0.969281,  0.969375,  0.969470,  0.969564,  0.969657,  0.969751,  0.969845,  0.969938,
-	 0.970031,  0.970124,  0.970217,  0.970310,  0.970403,  0.970495,  0.970588,  0.970680,
-	 0.970772,  0.970864,  0.970956,  0.971048,  0.971139,  0.971231,  0.971322,  0.971413,
-	 0.971504,  0.971595,  0.971685,  0.971776,  0.971866,  0.971957,  0.972047,  0.972137,
-	 0.972227,  0.972316,  0.972406,  0.972495,  0.972584,  0.972673,  0.972762,  0.972851,
-	 0.972940,  0.973028,  0.973117,  0.973205,  0.973293,  0.973381,  0.973469,  0.973557,
-	 0.973644,  0.973732,  0.973819,  0.973906,  0.973993,  0.974080,  0.974166,  0.974253,
-	 0.974339,  0.974426,  0.974512,  0.974598,  0.974684,  0.974769,  0.974855,  0.974940,
-	 0.975025,  0.975110,  0.975195,  0.975280,  0.975365,  0.975449,  0.975534,  0.975618,
-	 0.975702,  0.975786,  0.975870,  0.975954,  0.976037,  0.976120,  0.976204,  0.976287,
-	 0.976370,  0.976453,  0.976535,  0.976618,  0.976700,  0.976782,  0.976864,  0.976946,
-	 0.977028,  0.977110,  0.977191,  0.977273,  0.977354,  0.977435,  0.977516,  0.977597,
-	 0.977677,  0.977758,  0.977838,  0.977918,  0.977998,  0.978078,  0.978158,  0.978238,
-	 0.978317,  0.978397,  0.978476,  0.978555,  0.978634,  0.978713,  0.978791,  0.978870,
-	 0.978948,  0.979026,  0.979104,  0.979182,  0.979260,  0.979338,  0.979415,  0.979493,
-	 0.979570,  0.979647,  0.979724,  0.979800,  0.979877,  0.979954,  0.980030,  0.980106,
-	 0.980182,  0.980258,  0.980334,  0.980409,  0.980485,  0.980560,  0.980635,  0.980710,
-	 0.980785,  0.980860,  0.980935,  0.981009,  0.981083,  0.981158,  0.981232,  0.981305,
-	 0.981379,  0.981453,  0.981526,  0.981600,  0.981673,  0.981746,  0.981819,  0.981891,
-	 0.981964,  0.982036,  0.982109,  0.982181,  0.982253,  0.982325,  0.982396,  0.982468,
-	 0.982539,  0.982611,  0.982682,  0.982753,  0.982824,  0.982894,  0.982965,  0.983035,
-	 0.983105,  0.983176,  0.983246,  0.983315,  0.983385,  0.983455,  0.983524,  0.983593,
-	 0.983662,  0.983731,  0.983800,  0.983869,  0.983937,  0.984006,  0.984074,  0.984142,
-	 0.984210,  0.984278,  0.984346,  0.984413,  0.984480,  0.984548,  0.984615,  0.984682,
-	 0.984748,  0.984815,  0.984882,  0.984948,  0.985014,  0.985080,  0.985146,  0.985212,
-	 0.985278,  0.985343,  0.985408,  0.985474,  0.985539,  0.985604,  0.985668,  0.985733,
-	 0.985798,  0.985862,  0.985926,  0.985990,  0.986054,  0.986118,  0.986181,  0.986245,
-	 0.986308,  0.986371,  0.986434,  0.986497,  0.986560,  0.986623,  0.986685,  0.986747,
-	 0.986809,  0.986871,  0.986933,  0.986995,  0.987057,  0.987118,  0.987179,  0.987240,
-	 0.987301,  0.987362,  0.987423,  0.987484,  0.987544,  0.987604,  0.987664,  0.987724,
-	 0.987784,  0.987844,  0.987903,  0.987963,  0.988022,  0.988081,  0.988140,  0.988199,
-	 0.988258,  0.988316,  0.988374,  0.988433,  0.988491,  0.988549,  0.988607,  0.988664,
-	 0.988722,  0.988779,  0.988836,  0.988893,  0.988950,  0.989007,  0.989064,  0.989120,
-	 0.989177,  0.989233,  0.989289,  0.989345,  0.989400,  0.989456,  0.989511,  0.989567,
-	 0.989622,  0.989677,  0.989732,  0.989787,  0.989841,  0.989896,  0.989950,  0.990004,
-	 0.990058,  0.990112,  0.990166,  0.990219,  0.990273,  0.990326,  0.990379,  0.990432,
-	 0.990485,  0.990538,  0.990590,  0.990643,  0.990695,  0.990747,  0.990799,  0.990851,
-	 0.990903,  0.990954,  0.991006,  0.991057,  0.991108,  0.991159,  0.991210,  0.991260,
-	 0.991311,  0.991361,  0.991411,  0.991462,  0.991511,  0.991561,  0.991611,  0.991660,
-	 0.991710,  0.991759,  0.991808,  0.991857,  0.991906,  0.991954,  0.992003,  0.992051,
-	 0.992099,  0.992147,  0.992195,  0.992243,  0.992291,  0.992338,  0.992385,  0.992433,
-	 0.992480,  0.992526,  0.992573,  0.992620,  0.992666,  0.992712,  0.992759,  0.992805,
-	 0.992850,  0.992896,  0.992942,  0.992987,  0.993032,  0.993077,  0.993122,  0.993167,
-	 0.993212,  0.993257,  0.993301,  0.993345,  0.993389,  0.993433,  0.993477,  0.993521,
-	 0.993564,  0.993608,  0.993651,  0.993694,  0.993737,  0.993779,  0.993822,  0.993865,
-	 0.993907,  0.993949,  0.993991,  0.994033,  0.994075,  0.994116,  0.994158,  0.994199,
-	 0.994240,  0.994281,  0.994322,  0.994363,  0.994404,  0.994444,  0.994484,  0.994525,
-	 0.994565,  0.994604,  0.994644,  0.994684,  0.994723,  0.994762,  0.994802,  0.994841,
-	 0.994879,  0.994918,  0.994957,  0.994995,  0.995033,  0.995071,  0.995109,  0.995147,
-	 0.995185,  0.995222,  0.995260,  0.995297,  0.995334,  0.995371,  0.995408,  0.995444,
-	 0.995481,  0.995517,  0.995553,  0.995589,  0.995625,  0.995661,  0.995697,  0.995732,
-	 0.995767,  0.995803,  0.995838,  0.995872,  0.995907,  0.995942,  0.995976,  0.996011,
-	 0.996045,  0.996079,  0.996113,  0.996146,  0.996180,  0.996213,  0.996247,  0.996280,
-	 0.996313,  0.996345,  0.996378,  0.996411,  0.996443,  0.996475,  0.996507,  0.996539,
-	 0.996571,  0.996603,  0.996634,  0.996666,  0.996697,  0.996728,  0.996759,  0.996790,
-	 0.996820,  0.996851,  0.996881,  0.996911,  0.996941,  0.996971,  0.997001,  0.997031,
-	 0.997060,  0.997089,  0.997119,  0.997148,  0.997176,  0.997205,  0.997234,  0.997262,
-	 0.997290,  0.997319,  0.997347,  0.997374,  0.997402,  0.997430,  0.997457,  0.997484,
-	 0.997511,  0.997538,  0.997565,  0.997592,  0.997618,  0.997645,  0.997671,  0.997697,
-	 0.997723,  0.997749,  0.997774,  0.997800,  0.997825,  0.997851,  0.997876,  0.997901,
-	 0.997925,  0.997950,  0.997974,  0.997999,  0.998023,  0.998047,  0.998071,  0.998094,
-	 0.998118,  0.998142,  0.998165,  0.998188,  0.998211,  0.998234,  0.998257,  0.998279,
-	 0.998302,  0.998324,  0.998346,  0.998368,  0.998390,  0.998411,  0.998433,  0.998454,
-	 0.998476,  0.998497,  0.998518,  0.998538,  0.998559,  0.998580,  0.998600,  0.998620,
-	 0.998640,  0.998660,  0.998680,  0.998700,  0.998719,  0.998738,  0.998758,  0.998777,
-	 0.998795,  0.998814,  0.998833,  0.998851,  0.998870,  0.998888,  0.998906,  0.998924,
-	 0.998941,  0.998959,  0.998976,  0.998994,  0.999011,  0.999028,  0.999044,  0.999061,
-	 0.999078,  0.999094,  0.999110,  0.999126,  0.999142,  0.999158,  0.999174,  0.999189,
-	 0.999205,  0.999220,  0.999235,  0.999250,  0.999265,  0.999279,  0.999294,  0.999308,
-	 0.999322,  0.999336,  0.999350,  0.999364,  0.999378,  0.999391,  0.999404,  0.999418,
-	 0.999431,  0.999443,  0.999456,  0.999469,  0.999481,  0.999493,  0.999506,  0.999518,
-	 0.999529,  0.999541,  0.999553,  0.999564,  0.999575,  0.999586,  0.999597,  0.999608,
-	 0.999619,  0.999629,  0.999640,  0.999650,  0.999660,  0.999670,  0.999680,  0.999689,
-	 0.999699,  0.999708,  0.999717,  0.999726,  0.999735,  0.999744,  0.999753,  0.999761,
-	 0.999769,  0.999778,  0.999786,  0.999793,  0.999801,  0.999809,  0.999816,  0.999823,
-	 0.999831,  0.999838,  0.999844,  0.999851,  0.999858,  0.999864,  0.999870,  0.999876,
-	 0.999882,  0.999888,  0.999894,  0.999899,  0.999905,  0.999910,  0.999915,  0.999920,
-	 0.999925,  0.999929,  0.999934,  0.999938,  0.999942,  0.999946,  0.999950,  0.999954,
-	 0.999958,  0.999961,  0.999964,  0.999968,  0.999971,  0.999973,  0.999976,  0.999979,
-	 0.999981,  0.999983,  0.999986,  0.999988,  0.999989,  0.999991,  0.999993,  0.999994,
-	 0.999995,  0.999996,  0.999997,  0.999998,  0.999999,  0.999999,  1.000000,  1.000000
-};
+		const double freq = 2 * M_PI / n;
 
-static const float cosTable32768[16384] = {
-	 1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  0.999999,  0.999999,
-	 0.999999,  0.999999,  0.999998,  0.999998,  0.999997,  0.999997,  0.999996,  0.999996,
-	 0.999995,  0.999995,  0.999994,  0.999993,  0.999993,  0.999992,  0.999991,  0.999990,
-	 0.999989,  0.999988,  0.999988,  0.999987,  0.999986,  0.999985,  0.999983,  0.999982,
-	 0.999981,  0.999980,  0.999979,  0.999977,  0.999976,  0.999975,  0.999973,  0.999972,
-	 0.999971,  0.999969,  0.999968,  0.999966,  0.999964,  0.999963,  0.999961,  0.999959,
-	 0.999958,  0.999956,  0.999954,  0.999952,  0.999950,  0.999948,  0.999946,  0.999944,
-	 0.999942,  0.999940,  0.999938,  0.999936,  0.999934,  0.999932,  0.999929,  0.999927,
-	 0.999925,  0.999922,  0.999920,  0.999917,  0.999915,  0.999913,  0.999910,  0.999907,
-	 0.999905,  0.999902,  0.999899,  0.999897,  0.999894,  0.999891,  0.999888,  0.999885,
-	 0.999882,  0.999879,  0.999876,  0.999873,  0.999870,  0.999867,  0.999864,  0.999861,
-	 0.999858,  0.999854,  0.999851,  0.999848,  0.999844,  0.999841,  0.999838,  0.999834,
-	 0.999831,  0.999827,  0.999823,  0.999820,  0.999816,  0.999812,  0.999809,  0.999805,
-	 0.999801,  0.999797,  0.999793,  0.999790,  0.999786,  0.999782,  0.999778,  0.999774,
-	 0.999769,  0.999765,  0.999761,  0.999757,  0.999753,  0.999748,  0.999744,  0.999740,
-	 0.999735,  0.999731,  0.999726,  0.999722,  0.999717,  0.999713,  0.999708,  0.999704,
-	 0.999699,  0.999694,  0.999689,  0.999685,  0.999680,  0.999675,  0.999670,  0.999665,
-	 0.999660,  0.999655,  0.999650,  0.999645,  0.999640,  0.999635,  0.999629,  0.999624,
-	 0.999619,  0.999614,  0.999608,  0.999603,  0.999597,  0.999592,  0.999586,  0.999581,
-	 0.999575,  0.999570,  0.999564,  0.999558,  0.999553,  0.999547,  0.999541,  0.999535,
-	 0.999529,  0.999524,  0.999518,  0.999512,  0.999506,  0.999500,  0.999493,  0.999487,
-	 0.999481,  0.999475,  0.999469,  0.999462,  0.999456,  0.999450,  0.999443,  0.999437,
-	 0.999431,  0.999424,  0.999418,  0.999411,  0.999404,  0.999398,  0.999391,  0.999384,
-	 0.999378,  0.999371,  0.999364,  0.999357,  0.999350,  0.999343,  0.999336,  0.999329,
-	 0.999322,  0.999315,  0.999308,  0.999301,  0.999294,  0.999287,  0.999279,  0.999272,
-	 0.999265,  0.999257,  0.999250,  0.999243,  0.999235,  0.999228,  0.999220,  0.999212,
-	 0.999205,  0.999197,  0.999189,  0.999182,  0.999174,  0.999166,  0.999158,  0.999150,
-	 0.999142,  0.999134,  0.999126,  0.999118,  0.999110,  0.999102,  0.999094,  0.999086,
-	 0.999078,  0.999069,  0.999061,  0.999053,  0.999044,  0.999036,  0.999028,  0.999019,
-	 0.999011,  0.999002,  0.998994,  0.998985,  0.998976,  0.998968,  0.998959,  0.998950,
-	 0.998941,  0.998932,  0.998924,  0.998915,  0.998906,  0.998897,  0.998888,  0.998879,
-	 0.998870,  0.998860,  0.998851,  0.998842,  0.998833,  0.998824,  0.998814,  0.998805,
-	 0.998795,  0.998786,  0.998777,  0.998767,  0.998758,  0.998748,  0.998738,  0.998729,
-	 0.998719,  0.998709,  0.998700,  0.998690,  0.998680,  0.998670,  0.998660,  0.998650,
-	 0.998640,  0.998630,  0.998620,  0.998610,  0.998600,  0.998590,  0.998580,  0.998569,
-	 0.998559,  0.998549,  0.998538,  0.998528,  0.998518,  0.998507,  0.998497,  0.998486,
-	 0.998476,  0.998465,  0.998454,  0.998444,  0.998433,  0.998422,  0.998411,  0.998401,
-	 0.998390,  0.998379,  0.998368,  0.998357,  0.998346,  0.998335,  0.998324,  0.998313,
-	 0.998302,  0.998290,  0.998279,  0.998268,  0.998257,  0.998245,  0.998234,  0.998222,
-	 0.998211,  0.998200,  0.998188,  0.998176,  0.998165,  0.998153,  0.998142,  0.998130,
-	 0.998118,  0.998106,  0.998094,  0.998083,  0.998071,  0.998059,  0.998047,  0.998035,
-	 0.998023,  0.998011,  0.997999,  0.997987,  0.997974,  0.997962,  0.997950,  0.997938,
-	 0.997925,  0.997913,  0.997901,  0.997888,  0.997876,  0.997863,  0.997851,  0.997838,
-	 0.997825,  0.997813,  0.997800,  0.997787,  0.997774,  0.997762,  0.997749,  0.997736,
-	 0.997723,  0.997710,  0.997697,  0.997684,  0.997671,  0.997658,  0.997645,  0.997632,
-	 0.997618,  0.997605,  0.997592,  0.997579,  0.997565,  0.997552,  0.997538,  0.997525,
-	 0.997511,  0.997498,  0.997484,  0.997471,  0.997457,  0.997443,  0.997430,  0.997416,
-	 0.997402,  0.997388,  0.997374,  0.997361,  0.997347,  0.997333,  0.997319,  0.997305,
-	 0.997290,  0.997276,  0.997262,  0.997248,  0.997234,  0.997219,  0.997205,  0.997191,
-	 0.997176,  0.997162,  0.997148,  0.997133,  0.997119,  0.997104,  0.997089,  0.997075,
-	 0.997060,  0.997045,  0.997031,  0.997016,  0.997001,  0.996986,  0.996971,  0.996956,
-	 0.996941,  0.996926,  0.996911,  0.996896,  0.996881,  0.996866,  0.996851,  0.996836,
-	 0.996820,  0.996805,  0.996790,  0.996774,  0.996759,  0.996743,  0.996728,  0.996712,
-	 0.996697,  0.996681,  0.996666,  0.996650,  0.996634,  0.996619,  0.996603,  0.996587,
-	 0.996571,  0.996555,  0.996539,  0.996523,  0.996507,  0.996491,  0.996475,  0.996459,
-	 0.996443,  0.996427,  0.996411,  0.996394,  0.996378,  0.996362,  0.996345,  0.996329,
-	 0.996313,  0.996296,  0.996280,  0.996263,  0.996247,  0.996230,  0.996213,  0.996197,
-	 0.996180,  0.996163,  0.996146,  0.996129,  0.996113,  0.996096,  0.996079,  0.996062,
-	 0.996045,  0.996028,  0.996011,  0.995993,  0.995976,  0.995959,  0.995942,  0.995925,
-	 0.995907,  0.995890,  0.995872,  0.995855,  0.995838,  0.995820,  0.995803,  0.995785,
-	 0.995767,  0.995750,  0.995732,  0.995714,  0.995697,  0.995679,  0.995661,  0.995643,
-	 0.995625,  0.995607,  0.995589,  0.995571,  0.995553,  0.995535,  0.995517,  0.995499,
-	 0.995481,  0.995463,  0.995444,  0.995426,  0.995408,  0.995389,  0.995371,  0.995352,
-	 0.995334,  0.995315,  0.995297,  0.995278,  0.995260,  0.995241,  0.995222,  0.995203,
-	 0.995185,  0.995166,  0.995147,  0.995128,  0.995109,  0.995090,  0.995071,  0.995052,
-	 0.995033,  0.995014,  0.994995,  0.994976,  0.994957,  0.994937,  0.994918,  0.994899,
-	 0.994879,  0.994860,  0.994841,  0.994821,  0.994802,  0.994782,  0.994762,  0.994743,
-	 0.994723,  0.994703,  0.994684,  0.994664,  0.994644,  0.994624,  0.994604,  0.994585,
-	 0.994565,  0.994545,  0.994525,  0.994505,  0.994484,  0.994464,  0.994444,  0.994424,
-	 0.994404,  0.994383,  0.994363,  0.994343,  0.994322,  0.994302,  0.994281,  0.994261,
-	 0.994240,  0.994220,  0.994199,  0.994179,  0.994158,  0.994137,  0.994116,  0.994096,
-	 0.994075,  0.994054,  0.994033,  0.994012,  0.993991,  0.993970,  0.993949,  0.993928,
-	 0.993907,  0.993886,  0.993865,  0.993843,  0.993822,  0.993801,  0.993779,  0.993758,
-	 0.993737,  0.993715,  0.993694,  0.993672,  0.993651,  0.993629,  0.993608,  0.993586,
-	 0.993564,  0.993542,  0.993521,  0.993499,  0.993477,  0.993455,  0.993433,  0.993411,
-	 0.993389,  0.993367,  0.993345,  0.993323,  0.993301,  0.993279,  0.993257,  0.993234,
-	 0.993212,  0.993190,  0.993167,  0.993145,  0.993122,  0.993100,  0.993077,  0.993055,
-	 0.993032,  0.993010,  0.992987,  0.992964,  0.992942,  0.992919,  0.992896,  0.992873,
-	 0.992850,  0.992828,  0.992805,  0.992782,  0.992759,  0.992736,  0.992712,  0.992689,
-	 0.992666,  0.992643,  0.992620,  0.992596,  0.992573,  0.992550,  0.992526,  0.992503,
-	 0.992480,  0.992456,  0.992433,  0.992409,  0.992385,  0.992362,  0.992338,  0.992314,
-	 0.992291,  0.992267,  0.992243,  0.992219,  0.992195,  0.992171,  0.992147,  0.992123,
-	 0.992099,  0.992075,  0.992051,  0.992027,  0.992003,  0.991979,  0.991954,  0.991930,
-	 0.991906,  0.991881,  0.991857,  0.991832,  0.991808,  0.991783,  0.991759,  0.991734,
-	 0.991710,  0.991685,  0.991660,  0.991636,  0.991611,  0.991586,  0.991561,  0.991536,
-	 0.991511,  0.991487,  0.991462,  0.991437,  0.991411,  0.991386,  0.991361,  0.991336,
-	 0.991311,  0.991286,  0.991260,  0.991235,  0.991210,  0.991184,  0.991159,  0.991133,
-	 0.991108,  0.991082,  0.991057,  0.991031,  0.991006,  0.990980,  0.990954,  0.990928,
-	 0.990903,  0.990877,  0.990851,  0.990825,  0.990799,  0.990773,  0.990747,  0.990721,
-	 0.990695,  0.990669,  0.990643,  0.990617,  0.990590,  0.990564,  0.990538,  0.990511,
-	 0.990485,  0.990459,  0.990432,  0.990406,  0.990379,  0.990353,  0.990326,  0.990299,
-	 0.990273,  0.990246,  0.990219,  0.990193,  0.990166,  0.990139,  0.990112,  0.990085,
-	 0.990058,  0.990031,  0.990004,  0.989977,  0.989950,  0.989923,  0.989896,  0.989869,
-	 0.989841,  0.989814,  0.989787,  0.989759,  0.989732,  0.989704,  0.989677,  0.989650,
-	 0.989622,  0.989594,  0.989567,  0.989539,  0.989511,  0.989484,  0.989456,  0.989428,
-	 0.989400,  0.989373,  0.989345,  0.989317,  0.989289,  0.989261,  0.989233,  0.989205,
-	 0.989177,  0.989148,  0.989120,  0.989092,  0.989064,  0.989035,  0.989007,  0.988979,
-	 0.988950,  0.988922,  0.988893,  0.988865,  0.988836,  0.988808,  0.988779,  0.988750,
-	 0.988722,  0.988693,  0.988664,  0.988635,  0.988607,  0.988578,  0.988549,  0.988520,
-	 0.988491,  0.988462,  0.988433,  0.988404,  0.988374,  0.988345,  0.988316,  0.988287,
-	 0.988258,  0.988228,  0.988199,  0.988169,  0.988140,  0.988111,  0.988081,  0.988052,
-	 0.988022,  0.987992,  0.987963,  0.987933,  0.987903,  0.987874,  0.987844,  0.987814,
-	 0.987784,  0.987754,  0.987724,  0.987694,  0.987664,  0.987634,  0.987604,  0.987574,
-	 0.987544,  0.987514,  0.987484,  0.987453,  0.987423,  0.987393,  0.987362,  0.987332,
-	 0.987301,  0.987271,  0.987240,  0.987210,  0.987179,  0.987149,  0.987118,  0.987087,
-	 0.987057,  0.987026,  0.986995,  0.986964,  0.986933,  0.986902,  0.986871,  0.986840,
-	 0.986809,  0.986778,  0.986747,  0.986716,  0.986685,  0.986654,  0.986623,  0.986591,
-	 0.986560,  0.986529,  0.986497,  0.986466,  0.986434,  0.986403,  0.986371,  0.986340,
-	 0.986308,  0.986276,  0.986245,  0.986213,  0.986181,  0.986150,  0.986118,  0.986086,
-	 0.986054,  0.986022,  0.985990,  0.985958,  0.985926,  0.985894,  0.985862,  0.985830,
-	 0.985798,  0.985765,  0.985733,  0.985701,  0.985668,  0.985636,  0.985604,  0.985571,
-	 0.985539,  0.985506,  0.985474,  0.985441,  0.985408,  0.985376,  0.985343,  0.985310,
-	 0.985278,  0.985245,  0.985212,  0.985179,  0.985146,  0.985113,  0.985080,  0.985047,
-	 0.985014,  0.984981,  0.984948,  0.984915,  0.984882,  0.984848,  0.984815,  0.984782,
-	 0.984748,  0.984715,  0.984682,  0.984648,  0.984615,  0.984581,  0.984548,  0.984514,
-	 0.984480,  0.984447,  0.984413,  0.984379,  0.984346,  0.984312,  0.984278,  0.984244,
-	 0.984210,  0.984176,  0.984142,  0.984108,  0.984074,  0.984040,  0.984006,  0.983972,
-	 0.983937,  0.983903,  0.983869,  0.983835,  0.983800,  0.983766,  0.983731,  0.983697,
-	 0.983662,  0.983628,  0.983593,  0.983559,  0.983524,  0.983489,  0.983455,  0.983420,
-	 0.983385,  0.983350,  0.983315,  0.983281,  0.983246,  0.983211,  0.983176,  0.983141,
-	 0.983105,  0.983070,  0.983035,  0.983000,  0.982965,  0.982930,  0.982894,  0.982859,
-	 0.982824,  0.982788,  0.982753,  0.982717,  0.982682,  0.982646,  0.982611,  0.982575,
-	 0.982539,  0.982504,  0.982468,  0.982432,  0.982396,  0.982360,  0.982325,  0.982289,
-	 0.982253,  0.982217,  0.982181,  0.982145,  0.982109,  0.982072,  0.982036,  0.982000,
-	 0.981964,  0.981928,  0.981891,  0.981855,  0.981819,  0.981782,  0.981746,  0.981709,
-	 0.981673,  0.981636,  0.981600,  0.981563,  0.981526,  0.981490,  0.981453,  0.981416,
-	 0.981379,  0.981342,  0.981305,  0.981269,  0.981232,  0.981195,  0.981158,  0.981120,
-	 0.981083,  0.981046,  0.981009,  0.980972,  0.980935,  0.980897,  0.980860,  0.980823,
-	 0.980785,  0.980748,  0.980710,  0.980673,  0.980635,  0.980598,  0.980560,  0.980523,
-	 0.980485,  0.980447,  0.980409,  0.980372,  0.980334,  0.980296,  0.980258,  0.980220,
-	 0.980182,  0.980144,  0.980106,  0.980068,  0.980030,  0.979992,  0.979954,  0.979915,
-	 0.979877,  0.979839,  0.979800,  0.979762,  0.979724,  0.979685,  0.979647,  0.979608,
-	 0.979570,  0.979531,  0.979493,  0.979454,  0.979415,  0.979376,  0.979338,  0.979299,
-	 0.979260,  0.979221,  0.979182,  0.979143,  0.979104,  0.979065,  0.979026,  0.978987,
-	 0.978948,  0.978909,  0.978870,  0.978831,  0.978791,  0.978752,  0.978713,  0.978673,
-	 0.978634,  0.978594,  0.978555,  0.978516,  0.978476,  0.978436,  0.978397,  0.978357,
-	 0.978317,  0.978278,  0.978238,  0.978198,  0.978158,  0.978118,  0.978078,  0.978038,
-	 0.977998,  0.977959,  0.977918,  0.977878,  0.977838,  0.977798,  0.977758,  0.977718,
-	 0.977677,  0.977637,  0.977597,  0.977556,  0.977516,  0.977475,  0.977435,  0.977394,
-	 0.977354,  0.977313,  0.977273,  0.977232,  0.977191,  0.977151,  0.977110,  0.977069,
-	 0.977028,  0.976987,  0.976946,  0.976905,  0.976864,  0.976823,  0.976782,  0.976741,
-	 0.976700,  0.976659,  0.976618,  0.976576,  0.976535,  0.976494,  0.976453,  0.976411,
-	 0.976370,  0.976328,  0.976287,  0.976245,  0.976204,  0.976162,  0.976120,  0.976079,
-	 0.976037,  0.975995,  0.975954,  0.975912,  0.975870,  0.975828,  0.975786,  0.975744,
-	 0.975702,  0.975660,  0.975618,  0.975576,  0.975534,  0.975492,  0.975449,  0.975407,
-	 0.975365,  0.975323,  0.975280,  0.975238,  0.975195,  0.975153,  0.975110,  0.975068,
-	 0.975025,  0.974983,  0.974940,  0.974897,  0.974855,  0.974812,  0.974769,  0.974726,
-	 0.974684,  0.974641,  0.974598,  0.974555,  0.974512,  0.974469,  0.974426,  0.974383,
-	 0.974339,  0.974296,  0.974253,  0.974210,  0.974166,  0.974123,  0.974080,  0.974036,
-	 0.973993,  0.973949,  0.973906,  0.973862,  0.973819,  0.973775,  0.973732,  0.973688,
-	 0.973644,  0.973601,  0.973557,  0.973513,  0.973469,  0.973425,  0.973381,  0.973337,
-	 0.973293,  0.973249,  0.973205,  0.973161,  0.973117,  0.973073,  0.973028,  0.972984,
-	 0.972940,  0.972896,  0.972851,  0.972807,  0.972762,  0.972718,  0.972673,  0.972629,
-	 0.972584,  0.972540,  0.972495,  0.972450,  0.972406,  0.972361,  0.972316,  0.972271,
-	 0.972227,  0.972182,  0.972137,  0.972092,  0.972047,  0.972002,  0.971957,  0.971911,
-	 0.971866,  0.971821,  0.971776,  0.971731,  0.971685,  0.971640,  0.971595,  0.971549,
-	 0.971504,  0.971458,  0.971413,  0.971367,  0.971322,  0.971276,  0.971231,  0.971185,
-	 0.971139,  0.971093,  0.971048,  0.971002,  0.970956,  0.970910,  0.970864,  0.970818,
-	 0.970772,  0.970726,  0.970680,  0.970634,  0.970588,  0.970542,  0.970495,  0.970449,
-	 0.970403,  0.970357,  0.970310,  0.970264,  0.970217,  0.970171,  0.970124,  0.970078,
-	 0.970031,  0.969985,  0.969938,  0.969891,  0.969845,  0.969798,  0.969751,  0.969704,
-	 0.969657,  0.969611,  0.969564,  0.969517,  0.969470,  0.969423,  0.969375,  0.969328,
-	 0.969281,  0.969234,  0.969187,  0.969140,  0.969092,  0.969045,  0.968998,  0.968950,
-	 0.968903,  0.968855,  0.968808,  0.968760,  0.968713,  0.968665,  0.968617,  0.968570,
-	 0.968522,  0.968474,  0.968427,  0.968379,  0.968331,  0.968283,  0.968235,  0.968187,
-	 0.968139,  0.968091,  0.968043,  0.967995,  0.967947,  0.967899,  0.967850,  0.967802,
-	 0.967754,  0.967706,  0.967657,  0.967609,  0.967560,  0.967512,  0.967463,  0.967415,
-	 0.967366,  0.967318,  0.967269,  0.967220,  0.967172,  0.967123,  0.967074,  0.967025,
-	 0.966976,  0.966928,  0.966879,  0.966830,  0.966781,  0.966732,  0.966683,  0.966633,
-	 0.966584,  0.966535,  0.966486,  0.966437,  0.966387,  0.966338,  0.966289,  0.966239,
-	 0.966190,  0.966141,  0.966091,  0.966042,  0.965992,  0.965942,  0.965893,  0.965843,
-	 0.965793,  0.965744,  0.965694,  0.965644,  0.965594,  0.965544,  0.965494,  0.965444,
-	 0.965394,  0.965344,  0.965294,  0.965244,  0.965194,  0.965144,  0.965094,  0.965044,
-	 0.964993,  0.964943,  0.964893,  0.964842,  0.964792,  0.964741,  0.964691,  0.964640,
-	 0.964590,  0.964539,  0.964489,  0.964438,  0.964387,  0.964336,  0.964286,  0.964235,
-	 0.964184,  0.964133,  0.964082,  0.964031,  0.963980,  0.963929,  0.963878,  0.963827,
-	 0.963776,  0.963725,  0.963674,  0.963623,  0.963571,  0.963520,  0.963469,  0.963417,
-	 0.963366,  0.963314,  0.963263,  0.963211,  0.963160,  0.963108,  0.963057,  0.963005,
-	 0.962953,  0.962902,  0.962850,  0.962798,  0.962746,  0.962694,  0.962642,  0.962590,
-	 0.962538,  0.962486,  0.962434,  0.962382,  0.962330,  0.962278,  0.962226,  0.962174,
-	 0.962121,  0.962069,  0.962017,  0.961964,  0.961912,  0.961860,  0.961807,  0.961755,
-	 0.961702,  0.961649,  0.961597,  0.961544,  0.961492,  0.961439,  0.961386,  0.961333,
-	 0.961280,  0.961228,  0.961175,  0.961122,  0.961069,  0.961016,  0.960963,  0.960910,
-	 0.960857,  0.960804,  0.960750,  0.960697,  0.960644,  0.960591,  0.960537,  0.960484,
-	 0.960431,  0.960377,  0.960324,  0.960270,  0.960217,  0.960163,  0.960109,  0.960056,
-	 0.960002,  0.959948,  0.959895,  0.959841,  0.959787,  0.959733,  0.959679,  0.959625,
-	 0.959572,  0.959518,  0.959463,  0.959409,  0.959355,  0.959301,  0.959247,  0.959193,
-	 0.959139,  0.959084,  0.959030,  0.958976,  0.958921,  0.958867,  0.958812,  0.958758,
-	 0.958703,  0.958649,  0.958594,  0.958540,  0.958485,  0.958430,  0.958376,  0.958321,
-	 0.958266,  0.958211,  0.958156,  0.958101,  0.958046,  0.957992,  0.957937,  0.957882,
-	 0.957826,  0.957771,  0.957716,  0.957661,  0.957606,  0.957550,  0.957495,  0.957440,
-	 0.957385,  0.957329,  0.957274,  0.957218,  0.957163,  0.957107,  0.957052,  0.956996,
-	 0.956940,  0.956885,  0.956829,  0.956773,  0.956717,  0.956662,  0.956606,  0.956550,
-	 0.956494,  0.956438,  0.956382,  0.956326,  0.956270,  0.956214,  0.956158,  0.956101,
-	 0.956045,  0.955989,  0.955933,  0.955876,  0.955820,  0.955764,  0.955707,  0.955651,
-	 0.955594,  0.955538,  0.955481,  0.955425,  0.955368,  0.955311,  0.955255,  0.955198,
-	 0.955141,  0.955084,  0.955028,  0.954971,  0.954914,  0.954857,  0.954800,  0.954743,
-	 0.954686,  0.954629,  0.954572,  0.954514,  0.954457,  0.954400,  0.954343,  0.954285,
-	 0.954228,  0.954171,  0.954113,  0.954056,  0.953998,  0.953941,  0.953883,  0.953826,
-	 0.953768,  0.953711,  0.953653,  0.953595,  0.953537,  0.953480,  0.953422,  0.953364,
-	 0.953306,  0.953248,  0.953190,  0.953132,  0.953074,  0.953016,  0.952958,  0.952900,
-	 0.952842,  0.952783,  0.952725,  0.952667,  0.952609,  0.952550,  0.952492,  0.952433,
-	 0.952375,  0.952317,  0.952258,  0.952199,  0.952141,  0.952082,  0.952024,  0.951965,
-	 0.951906,  0.951847,  0.951789,  0.951730,  0.951671,  0.951612,  0.951553,  0.951494,
-	 0.951435,  0.951376,  0.951317,  0.951258,  0.951199,  0.951139,  0.951080,  0.951021,
-	 0.950962,  0.950902,  0.950843,  0.950784,  0.950724,  0.950665,  0.950605,  0.950546,
-	 0.950486,  0.950426,  0.950367,  0.950307,  0.950247,  0.950188,  0.950128,  0.950068,
-	 0.950008,  0.949948,  0.949888,  0.949829,  0.949768,  0.949708,  0.949648,  0.949588,
-	 0.949528,  0.949468,  0.949408,  0.949348,  0.949287,  0.949227,  0.949167,  0.949106,
-	 0.949046,  0.948985,  0.948925,  0.948864,  0.948804,  0.948743,  0.948683,  0.948622,
-	 0.948561,  0.948501,  0.948440,  0.948379,  0.948318,  0.948257,  0.948196,  0.948136,
-	 0.948075,  0.948014,  0.947953,  0.947891,  0.947830,  0.947769,  0.947708,  0.947647,
-	 0.947586,  0.947524,  0.947463,  0.947402,  0.947340,  0.947279,  0.947217,  0.947156,
-	 0.947094,  0.947033,  0.946971,  0.946910,  0.946848,  0.946786,  0.946724,  0.946663,
-	 0.946601,  0.946539,  0.946477,  0.946415,  0.946353,  0.946291,  0.946229,  0.946167,
-	 0.946105,  0.946043,  0.945981,  0.945919,  0.945857,  0.945794,  0.945732,  0.945670,
-	 0.945607,  0.945545,  0.945482,  0.945420,  0.945358,  0.945295,  0.945232,  0.945170,
-	 0.945107,  0.945045,  0.944982,  0.944919,  0.944856,  0.944793,  0.944731,  0.944668,
-	 0.944605,  0.944542,  0.944479,  0.944416,  0.944353,  0.944290,  0.944227,  0.944163,
-	 0.944100,  0.944037,  0.943974,  0.943910,  0.943847,  0.943784,  0.943720,  0.943657,
-	 0.943593,  0.943530,  0.943466,  0.943403,  0.943339,  0.943276,  0.943212,  0.943148,
-	 0.943084,  0.943021,  0.942957,  0.942893,  0.942829,  0.942765,  0.942701,  0.942637,
-	 0.942573,  0.942509,  0.942445,  0.942381,  0.942317,  0.942253,  0.942188,  0.942124,
-	 0.942060,  0.941995,  0.941931,  0.941867,  0.941802,  0.941738,  0.941673,  0.941609,
-	 0.941544,  0.941479,  0.941415,  0.941350,  0.941285,  0.941221,  0.941156,  0.941091,
-	 0.941026,  0.940961,  0.940896,  0.940831,  0.940766,  0.940701,  0.940636,  0.940571,
-	 0.940506,  0.940441,  0.940376,  0.940310,  0.940245,  0.940180,  0.940115,  0.940049,
-	 0.939984,  0.939918,  0.939853,  0.939787,  0.939722,  0.939656,  0.939591,  0.939525,
-	 0.939459,  0.939394,  0.939328,  0.939262,  0.939196,  0.939130,  0.939064,  0.938998,
-	 0.938932,  0.938866,  0.938800,  0.938734,  0.938668,  0.938602,  0.938536,  0.938470,
-	 0.938404,  0.938337,  0.938271,  0.938205,  0.938138,  0.938072,  0.938005,  0.937939,
-	 0.937872,  0.937806,  0.937739,  0.937673,  0.937606,  0.937539,  0.937473,  0.937406,
-	 0.937339,  0.937272,  0.937205,  0.937138,  0.937072,  0.937005,  0.936938,  0.936871,
-	 0.936803,  0.936736,  0.936669,  0.936602,  0.936535,  0.936468,  0.936400,  0.936333,
-	 0.936266,  0.936198,  0.936131,  0.936063,  0.935996,  0.935928,  0.935861,  0.935793,
-	 0.935726,  0.935658,  0.935590,  0.935523,  0.935455,  0.935387,  0.935319,  0.935251,
-	 0.935184,  0.935116,  0.935048,  0.934980,  0.934912,  0.934844,  0.934775,  0.934707,
-	 0.934639,  0.934571,  0.934503,  0.934434,  0.934366,  0.934298,  0.934229,  0.934161,
-	 0.934093,  0.934024,  0.933956,  0.933887,  0.933818,  0.933750,  0.933681,  0.933612,
-	 0.933544,  0.933475,  0.933406,  0.933337,  0.933269,  0.933200,  0.933131,  0.933062,
-	 0.932993,  0.932924,  0.932855,  0.932786,  0.932716,  0.932647,  0.932578,  0.932509,
-	 0.932440,  0.932370,  0.932301,  0.932232,  0.932162,  0.932093,  0.932023,  0.931954,
-	 0.931884,  0.931815,  0.931745,  0.931675,  0.931606,  0.931536,  0.931466,  0.931397,
-	 0.931327,  0.931257,  0.931187,  0.931117,  0.931047,  0.930977,  0.930907,  0.930837,
-	 0.930767,  0.930697,  0.930627,  0.930556,  0.930486,  0.930416,  0.930346,  0.930275,
-	 0.930205,  0.930135,  0.930064,  0.929994,  0.929923,  0.929853,  0.929782,  0.929712,
-	 0.929641,  0.929570,  0.929500,  0.929429,  0.929358,  0.929287,  0.929216,  0.929146,
-	 0.929075,  0.929004,  0.928933,  0.928862,  0.928791,  0.928720,  0.928648,  0.928577,
-	 0.928506,  0.928435,  0.928364,  0.928292,  0.928221,  0.928150,  0.928078,  0.928007,
-	 0.927935,  0.927864,  0.927792,  0.927721,  0.927649,  0.927578,  0.927506,  0.927434,
-	 0.927363,  0.927291,  0.927219,  0.927147,  0.927075,  0.927003,  0.926931,  0.926859,
-	 0.926787,  0.926715,  0.926643,  0.926571,  0.926499,  0.926427,  0.926355,  0.926283,
-	 0.926210,  0.926138,  0.926066,  0.925993,  0.925921,  0.925848,  0.925776,  0.925703,
-	 0.925631,  0.925558,  0.925486,  0.925413,  0.925340,  0.925268,  0.925195,  0.925122,
-	 0.925049,  0.924976,  0.924904,  0.924831,  0.924758,  0.924685,  0.924612,  0.924539,
-	 0.924465,  0.924392,  0.924319,  0.924246,  0.924173,  0.924100,  0.924026,  0.923953,
-	 0.923880,  0.923806,  0.923733,  0.923659,  0.923586,  0.923512,  0.923439,  0.923365,
-	 0.923291,  0.923218,  0.923144,  0.923070,  0.922997,  0.922923,  0.922849,  0.922775,
-	 0.922701,  0.922627,  0.922553,  0.922479,  0.922405,  0.922331,  0.922257,  0.922183,
-	 0.922109,  0.922034,  0.921960,  0.921886,  0.921812,  0.921737,  0.921663,  0.921588,
-	 0.921514,  0.921440,  0.921365,  0.921291,  0.921216,  0.921141,  0.921067,  0.920992,
-	 0.920917,  0.920842,  0.920768,  0.920693,  0.920618,  0.920543,  0.920468,  0.920393,
-	 0.920318,  0.920243,  0.920168,  0.920093,  0.920018,  0.919943,  0.919868,  0.919792,
-	 0.919717,  0.919642,  0.919567,  0.919491,  0.919416,  0.919340,  0.919265,  0.919189,
-	 0.919114,  0.919038,  0.918963,  0.918887,  0.918811,  0.918736,  0.918660,  0.918584,
-	 0.918508,  0.918433,  0.918357,  0.918281,  0.918205,  0.918129,  0.918053,  0.917977,
-	 0.917901,  0.917825,  0.917749,  0.917672,  0.917596,  0.917520,  0.917444,  0.917367,
-	 0.917291,  0.917215,  0.917138,  0.917062,  0.916985,  0.916909,  0.916832,  0.916756,
-	 0.916679,  0.916602,  0.916526,  0.916449,  0.916372,  0.916296,  0.916219,  0.916142,
-	 0.916065,  0.915988,  0.915911,  0.915834,  0.915757,  0.915680,  0.915603,  0.915526,
-	 0.915449,  0.915372,  0.915294,  0.915217,  0.915140,  0.915062,  0.914985,  0.914908,
-	 0.914830,  0.914753,  0.914675,  0.914598,  0.914520,  0.914443,  0.914365,  0.914287,
-	 0.914210,  0.914132,  0.914054,  0.913976,  0.913899,  0.913821,  0.913743,  0.913665,
-	 0.913587,  0.913509,  0.913431,  0.913353,  0.913275,  0.913197,  0.913119,  0.913040,
-	 0.912962,  0.912884,  0.912806,  0.912727,  0.912649,  0.912571,  0.912492,  0.912414,
-	 0.912335,  0.912257,  0.912178,  0.912099,  0.912021,  0.911942,  0.911864,  0.911785,
-	 0.911706,  0.911627,  0.911548,  0.911470,  0.911391,  0.911312,  0.911233,  0.911154,
-	 0.911075,  0.910996,  0.910917,  0.910837,  0.910758,  0.910679,  0.910600,  0.910521,
-	 0.910441,  0.910362,  0.910283,  0.910203,  0.910124,  0.910044,  0.909965,  0.909885,
-	 0.909806,  0.909726,  0.909646,  0.909567,  0.909487,  0.909407,  0.909328,  0.909248,
-	 0.909168,  0.909088,  0.909008,  0.908928,  0.908848,  0.908768,  0.908688,  0.908608,
-	 0.908528,  0.908448,  0.908368,  0.908288,  0.908207,  0.908127,  0.908047,  0.907966,
-	 0.907886,  0.907806,  0.907725,  0.907645,  0.907564,  0.907484,  0.907403,  0.907323,
-	 0.907242,  0.907161,  0.907081,  0.907000,  0.906919,  0.906838,  0.906757,  0.906677,
-	 0.906596,  0.906515,  0.906434,  0.906353,  0.906272,  0.906191,  0.906110,  0.906028,
-	 0.905947,  0.905866,  0.905785,  0.905704,  0.905622,  0.905541,  0.905460,  0.905378,
-	 0.905297,  0.905215,  0.905134,  0.905052,  0.904971,  0.904889,  0.904807,  0.904726,
-	 0.904644,  0.904562,  0.904481,  0.904399,  0.904317,  0.904235,  0.904153,  0.904071,
-	 0.903989,  0.903907,  0.903825,  0.903743,  0.903661,  0.903579,  0.903497,  0.903415,
-	 0.903332,  0.903250,  0.903168,  0.903085,  0.903003,  0.902921,  0.902838,  0.902756,
-	 0.902673,  0.902591,  0.902508,  0.902426,  0.902343,  0.902260,  0.902178,  0.902095,
-	 0.902012,  0.901929,  0.901847,  0.901764,  0.901681,  0.901598,  0.901515,  0.901432,
-	 0.901349,  0.901266,  0.901183,  0.901100,  0.901016,  0.900933,  0.900850,  0.900767,
-	 0.900683,  0.900600,  0.900517,  0.900433,  0.900350,  0.900266,  0.900183,  0.900099,
-	 0.900016,  0.899932,  0.899849,  0.899765,  0.899681,  0.899598,  0.899514,  0.899430,
-	 0.899346,  0.899262,  0.899179,  0.899095,  0.899011,  0.898927,  0.898843,  0.898759,
-	 0.898674,  0.898590,  0.898506,  0.898422,  0.898338,  0.898254,  0.898169,  0.898085,
-	 0.898001,  0.897916,  0.897832,  0.897747,  0.897663,  0.897578,  0.897494,  0.897409,
-	 0.897325,  0.897240,  0.897155,  0.897071,  0.896986,  0.896901,  0.896816,  0.896731,
-	 0.896646,  0.896562,  0.896477,  0.896392,  0.896307,  0.896222,  0.896137,  0.896051,
-	 0.895966,  0.895881,  0.895796,  0.895711,  0.895625,  0.895540,  0.895455,  0.895369,
-	 0.895284,  0.895198,  0.895113,  0.895028,  0.894942,  0.894856,  0.894771,  0.894685,
-	 0.894599,  0.894514,  0.894428,  0.894342,  0.894256,  0.894171,  0.894085,  0.893999,
-	 0.893913,  0.893827,  0.893741,  0.893655,  0.893569,  0.893483,  0.893397,  0.893310,
-	 0.893224,  0.893138,  0.893052,  0.892965,  0.892879,  0.892793,  0.892706,  0.892620,
-	 0.892534,  0.892447,  0.892361,  0.892274,  0.892187,  0.892101,  0.892014,  0.891927,
-	 0.891841,  0.891754,  0.891667,  0.891580,  0.891493,  0.891407,  0.891320,  0.891233,
-	 0.891146,  0.891059,  0.890972,  0.890885,  0.890797,  0.890710,  0.890623,  0.890536,
-	 0.890449,  0.890361,  0.890274,  0.890187,  0.890099,  0.890012,  0.889925,  0.889837,
-	 0.889750,  0.889662,  0.889574,  0.889487,  0.889399,  0.889312,  0.889224,  0.889136,
-	 0.889048,  0.888961,  0.888873,  0.888785,  0.888697,  0.888609,  0.888521,  0.888433,
-	 0.888345,  0.888257,  0.888169,  0.888081,  0.887993,  0.887904,  0.887816,  0.887728,
-	 0.887640,  0.887551,  0.887463,  0.887375,  0.887286,  0.887198,  0.887109,  0.887021,
-	 0.886932,  0.886844,  0.886755,  0.886666,  0.886578,  0.886489,  0.886400,  0.886311,
-	 0.886223,  0.886134,  0.886045,  0.885956,  0.885867,  0.885778,  0.885689,  0.885600,
-	 0.885511,  0.885422,  0.885333,  0.885243,  0.885154,  0.885065,  0.884976,  0.884886,
-	 0.884797,  0.884708,  0.884618,  0.884529,  0.884439,  0.884350,  0.884260,  0.884171,
-	 0.884081,  0.883992,  0.883902,  0.883812,  0.883723,  0.883633,  0.883543,  0.883453,
-	 0.883363,  0.883273,  0.883184,  0.883094,  0.883004,  0.882914,  0.882824,  0.882733,
-	 0.882643,  0.882553,  0.882463,  0.882373,  0.882283,  0.882192,  0.882102,  0.882012,
-	 0.881921,  0.881831,  0.881740,  0.881650,  0.881559,  0.881469,  0.881378,  0.881288,
-	 0.881197,  0.881106,  0.881016,  0.880925,  0.880834,  0.880743,  0.880653,  0.880562,
-	 0.880471,  0.880380,  0.880289,  0.880198,  0.880107,  0.880016,  0.879925,  0.879834,
-	 0.879743,  0.879651,  0.879560,  0.879469,  0.879378,  0.879286,  0.879195,  0.879104,
-	 0.879012,  0.878921,  0.878829,  0.878738,  0.878646,  0.878555,  0.878463,  0.878371,
-	 0.878280,  0.878188,  0.878096,  0.878005,  0.877913,  0.877821,  0.877729,  0.877637,
-	 0.877545,  0.877453,  0.877361,  0.877269,  0.877177,  0.877085,  0.876993,  0.876901,
-	 0.876809,  0.876716,  0.876624,  0.876532,  0.876440,  0.876347,  0.876255,  0.876163,
-	 0.876070,  0.875978,  0.875885,  0.875793,  0.875700,  0.875607,  0.875515,  0.875422,
-	 0.875329,  0.875237,  0.875144,  0.875051,  0.874958,  0.874865,  0.874773,  0.874680,
-	 0.874587,  0.874494,  0.874401,  0.874308,  0.874215,  0.874121,  0.874028,  0.873935,
-	 0.873842,  0.873749,  0.873655,  0.873562,  0.873469,  0.873375,  0.873282,  0.873188,
-	 0.873095,  0.873001,  0.872908,  0.872814,  0.872721,  0.872627,  0.872534,  0.872440,
-	 0.872346,  0.872252,  0.872159,  0.872065,  0.871971,  0.871877,  0.871783,  0.871689,
-	 0.871595,  0.871501,  0.871407,  0.871313,  0.871219,  0.871125,  0.871031,  0.870936,
-	 0.870842,  0.870748,  0.870654,  0.870559,  0.870465,  0.870370,  0.870276,  0.870182,
-	 0.870087,  0.869992,  0.869898,  0.869803,  0.869709,  0.869614,  0.869519,  0.869425,
-	 0.869330,  0.869235,  0.869140,  0.869045,  0.868951,  0.868856,  0.868761,  0.868666,
-	 0.868571,  0.868476,  0.868381,  0.868285,  0.868190,  0.868095,  0.868000,  0.867905,
-	 0.867809,  0.867714,  0.867619,  0.867523,  0.867428,  0.867333,  0.867237,  0.867142,
-	 0.867046,  0.866951,  0.866855,  0.866759,  0.866664,  0.866568,  0.866472,  0.866377,
-	 0.866281,  0.866185,  0.866089,  0.865993,  0.865898,  0.865802,  0.865706,  0.865610,
-	 0.865514,  0.865418,  0.865321,  0.865225,  0.865129,  0.865033,  0.864937,  0.864841,
-	 0.864744,  0.864648,  0.864552,  0.864455,  0.864359,  0.864262,  0.864166,  0.864069,
-	 0.863973,  0.863876,  0.863780,  0.863683,  0.863586,  0.863490,  0.863393,  0.863296,
-	 0.863199,  0.863103,  0.863006,  0.862909,  0.862812,  0.862715,  0.862618,  0.862521,
-	 0.862424,  0.862327,  0.862230,  0.862133,  0.862035,  0.861938,  0.861841,  0.861744,
-	 0.861646,  0.861549,  0.861452,  0.861354,  0.861257,  0.861160,  0.861062,  0.860964,
-	 0.860867,  0.860769,  0.860672,  0.860574,  0.860476,  0.860379,  0.860281,  0.860183,
-	 0.860085,  0.859988,  0.859890,  0.859792,  0.859694,  0.859596,  0.859498,  0.859400,
-	 0.859302,  0.859204,  0.859106,  0.859007,  0.858909,  0.858811,  0.858713,  0.858615,
-	 0.858516,  0.858418,  0.858320,  0.858221,  0.858123,  0.858024,  0.857926,  0.857827,
-	 0.857729,  0.857630,  0.857531,  0.857433,  0.857334,  0.857235,  0.857137,  0.857038,
-	 0.856939,  0.856840,  0.856741,  0.856642,  0.856543,  0.856444,  0.856345,  0.856246,
-	 0.856147,  0.856048,  0.855949,  0.855850,  0.855751,  0.855651,  0.855552,  0.855453,
-	 0.855354,  0.855254,  0.855155,  0.855056,  0.854956,  0.854857,  0.854757,  0.854658,
-	 0.854558,  0.854458,  0.854359,  0.854259,  0.854159,  0.854060,  0.853960,  0.853860,
-	 0.853760,  0.853660,  0.853561,  0.853461,  0.853361,  0.853261,  0.853161,  0.853061,
-	 0.852961,  0.852861,  0.852760,  0.852660,  0.852560,  0.852460,  0.852360,  0.852259,
-	 0.852159,  0.852059,  0.851958,  0.851858,  0.851757,  0.851657,  0.851556,  0.851456,
-	 0.851355,  0.851255,  0.851154,  0.851053,  0.850953,  0.850852,  0.850751,  0.850650,
-	 0.850549,  0.850449,  0.850348,  0.850247,  0.850146,  0.850045,  0.849944,  0.849843,
-	 0.849742,  0.849641,  0.849540,  0.849438,  0.849337,  0.849236,  0.849135,  0.849033,
-	 0.848932,  0.848831,  0.848729,  0.848628,  0.848526,  0.848425,  0.848323,  0.848222,
-	 0.848120,  0.848019,  0.847917,  0.847815,  0.847714,  0.847612,  0.847510,  0.847408,
-	 0.847307,  0.847205,  0.847103,  0.847001,  0.846899,  0.846797,  0.846695,  0.846593,
-	 0.846491,  0.846389,  0.846287,  0.846185,  0.846082,  0.845980,  0.845878,  0.845776,
-	 0.845673,  0.845571,  0.845469,  0.845366,  0.845264,  0.845161,  0.845059,  0.844956,
-	 0.844854,  0.844751,  0.844648,  0.844546,  0.844443,  0.844340,  0.844238,  0.844135,
-	 0.844032,  0.843929,  0.843826,  0.843723,  0.843620,  0.843517,  0.843414,  0.843311,
-	 0.843208,  0.843105,  0.843002,  0.842899,  0.842796,  0.842692,  0.842589,  0.842486,
-	 0.842383,  0.842279,  0.842176,  0.842072,  0.841969,  0.841866,  0.841762,  0.841659,
-	 0.841555,  0.841451,  0.841348,  0.841244,  0.841140,  0.841037,  0.840933,  0.840829,
-	 0.840725,  0.840622,  0.840518,  0.840414,  0.840310,  0.840206,  0.840102,  0.839998,
-	 0.839894,  0.839790,  0.839686,  0.839581,  0.839477,  0.839373,  0.839269,  0.839165,
-	 0.839060,  0.838956,  0.838852,  0.838747,  0.838643,  0.838538,  0.838434,  0.838329,
-	 0.838225,  0.838120,  0.838015,  0.837911,  0.837806,  0.837701,  0.837597,  0.837492,
-	 0.837387,  0.837282,  0.837178,  0.837073,  0.836968,  0.836863,  0.836758,  0.836653,
-	 0.836548,  0.836443,  0.836338,  0.836232,  0.836127,  0.836022,  0.835917,  0.835812,
-	 0.835706,  0.835601,  0.835496,  0.835390,  0.835285,  0.835179,  0.835074,  0.834968,
-	 0.834863,  0.834757,  0.834652,  0.834546,  0.834440,  0.834335,  0.834229,  0.834123,
-	 0.834018,  0.833912,  0.833806,  0.833700,  0.833594,  0.833488,  0.833382,  0.833276,
-	 0.833170,  0.833064,  0.832958,  0.832852,  0.832746,  0.832640,  0.832533,  0.832427,
-	 0.832321,  0.832215,  0.832108,  0.832002,  0.831895,  0.831789,  0.831683,  0.831576,
-	 0.831470,  0.831363,  0.831257,  0.831150,  0.831043,  0.830937,  0.830830,  0.830723,
-	 0.830616,  0.830510,  0.830403,  0.830296,  0.830189,  0.830082,  0.829975,  0.829868,
-	 0.829761,  0.829654,  0.829547,  0.829440,  0.829333,  0.829226,  0.829119,  0.829011,
-	 0.828904,  0.828797,  0.828690,  0.828582,  0.828475,  0.828367,  0.828260,  0.828153,
-	 0.828045,  0.827938,  0.827830,  0.827722,  0.827615,  0.827507,  0.827399,  0.827292,
-	 0.827184,  0.827076,  0.826968,  0.826861,  0.826753,  0.826645,  0.826537,  0.826429,
-	 0.826321,  0.826213,  0.826105,  0.825997,  0.825889,  0.825781,  0.825673,  0.825564,
-	 0.825456,  0.825348,  0.825240,  0.825131,  0.825023,  0.824915,  0.824806,  0.824698,
-	 0.824589,  0.824481,  0.824372,  0.824264,  0.824155,  0.824047,  0.823938,  0.823829,
-	 0.823721,  0.823612,  0.823503,  0.823394,  0.823285,  0.823177,  0.823068,  0.822959,
-	 0.822850,  0.822741,  0.822632,  0.822523,  0.822414,  0.822305,  0.822195,  0.822086,
-	 0.821977,  0.821868,  0.821759,  0.821649,  0.821540,  0.821431,  0.821321,  0.821212,
-	 0.821102,  0.820993,  0.820884,  0.820774,  0.820664,  0.820555,  0.820445,  0.820336,
-	 0.820226,  0.820116,  0.820007,  0.819897,  0.819787,  0.819677,  0.819567,  0.819457,
-	 0.819348,  0.819238,  0.819128,  0.819018,  0.818908,  0.818798,  0.818687,  0.818577,
-	 0.818467,  0.818357,  0.818247,  0.818137,  0.818026,  0.817916,  0.817806,  0.817695,
-	 0.817585,  0.817474,  0.817364,  0.817253,  0.817143,  0.817032,  0.816922,  0.816811,
-	 0.816701,  0.816590,  0.816479,  0.816368,  0.816258,  0.816147,  0.816036,  0.815925,
-	 0.815814,  0.815704,  0.815593,  0.815482,  0.815371,  0.815260,  0.815149,  0.815037,
-	 0.814926,  0.814815,  0.814704,  0.814593,  0.814482,  0.814370,  0.814259,  0.814148,
-	 0.814036,  0.813925,  0.813814,  0.813702,  0.813591,  0.813479,  0.813368,  0.813256,
-	 0.813144,  0.813033,  0.812921,  0.812809,  0.812698,  0.812586,  0.812474,  0.812362,
-	 0.812251,  0.812139,  0.812027,  0.811915,  0.811803,  0.811691,  0.811579,  0.811467,
-	 0.811355,  0.811243,  0.811131,  0.811018,  0.810906,  0.810794,  0.810682,  0.810570,
-	 0.810457,  0.810345,  0.810232,  0.810120,  0.810008,  0.809895,  0.809783,  0.809670,
-	 0.809558,  0.809445,  0.809332,  0.809220,  0.809107,  0.808994,  0.808882,  0.808769,
-	 0.808656,  0.808543,  0.808430,  0.808318,  0.808205,  0.808092,  0.807979,  0.807866,
-	 0.807753,  0.807640,  0.807527,  0.807414,  0.807300,  0.807187,  0.807074,  0.806961,
-	 0.806848,  0.806734,  0.806621,  0.806508,  0.806394,  0.806281,  0.806167,  0.806054,
-	 0.805940,  0.805827,  0.805713,  0.805600,  0.805486,  0.805372,  0.805259,  0.805145,
-	 0.805031,  0.804918,  0.804804,  0.804690,  0.804576,  0.804462,  0.804348,  0.804234,
-	 0.804120,  0.804006,  0.803892,  0.803778,  0.803664,  0.803550,  0.803436,  0.803322,
-	 0.803208,  0.803093,  0.802979,  0.802865,  0.802750,  0.802636,  0.802522,  0.802407,
-	 0.802293,  0.802178,  0.802064,  0.801949,  0.801835,  0.801720,  0.801606,  0.801491,
-	 0.801376,  0.801261,  0.801147,  0.801032,  0.800917,  0.800802,  0.800687,  0.800573,
-	 0.800458,  0.800343,  0.800228,  0.800113,  0.799998,  0.799883,  0.799768,  0.799652,
-	 0.799537,  0.799422,  0.799307,  0.799192,  0.799076,  0.798961,  0.798846,  0.798730,
-	 0.798615,  0.798500,  0.798384,  0.798269,  0.798153,  0.798038,  0.797922,  0.797806,
-	 0.797691,  0.797575,  0.797459,  0.797344,  0.797228,  0.797112,  0.796996,  0.796881,
-	 0.796765,  0.796649,  0.796533,  0.796417,  0.796301,  0.796185,  0.796069,  0.795953,
-	 0.795837,  0.795721,  0.795605,  0.795488,  0.795372,  0.795256,  0.795140,  0.795023,
-	 0.794907,  0.794791,  0.794674,  0.794558,  0.794442,  0.794325,  0.794209,  0.794092,
-	 0.793975,  0.793859,  0.793742,  0.793626,  0.793509,  0.793392,  0.793276,  0.793159,
-	 0.793042,  0.792925,  0.792808,  0.792691,  0.792575,  0.792458,  0.792341,  0.792224,
-	 0.792107,  0.791990,  0.791872,  0.791755,  0.791638,  0.791521,  0.791404,  0.791287,
-	 0.791169,  0.791052,  0.790935,  0.790817,  0.790700,  0.790583,  0.790465,  0.790348,
-	 0.790230,  0.790113,  0.789995,  0.789878,  0.789760,  0.789642,  0.789525,  0.789407,
-	 0.789289,  0.789172,  0.789054,  0.788936,  0.788818,  0.788700,  0.788582,  0.788464,
-	 0.788346,  0.788228,  0.788110,  0.787992,  0.787874,  0.787756,  0.787638,  0.787520,
-	 0.787402,  0.787284,  0.787165,  0.787047,  0.786929,  0.786810,  0.786692,  0.786574,
-	 0.786455,  0.786337,  0.786218,  0.786100,  0.785981,  0.785863,  0.785744,  0.785625,
-	 0.785507,  0.785388,  0.785269,  0.785151,  0.785032,  0.784913,  0.784794,  0.784675,
-	 0.784557,  0.784438,  0.784319,  0.784200,  0.784081,  0.783962,  0.783843,  0.783724,
-	 0.783605,  0.783485,  0.783366,  0.783247,  0.783128,  0.783009,  0.782889,  0.782770,
-	 0.782651,  0.782531,  0.782412,  0.782292,  0.782173,  0.782053,  0.781934,  0.781814,
-	 0.781695,  0.781575,  0.781456,  0.781336,  0.781216,  0.781097,  0.780977,  0.780857,
-	 0.780737,  0.780617,  0.780498,  0.780378,  0.780258,  0.780138,  0.780018,  0.779898,
-	 0.779778,  0.779658,  0.779538,  0.779418,  0.779297,  0.779177,  0.779057,  0.778937,
-	 0.778817,  0.778696,  0.778576,  0.778456,  0.778335,  0.778215,  0.778094,  0.777974,
-	 0.777853,  0.777733,  0.777612,  0.777492,  0.777371,  0.777251,  0.777130,  0.777009,
-	 0.776888,  0.776768,  0.776647,  0.776526,  0.776405,  0.776284,  0.776164,  0.776043,
-	 0.775922,  0.775801,  0.775680,  0.775559,  0.775438,  0.775317,  0.775195,  0.775074,
-	 0.774953,  0.774832,  0.774711,  0.774589,  0.774468,  0.774347,  0.774225,  0.774104,
-	 0.773983,  0.773861,  0.773740,  0.773618,  0.773497,  0.773375,  0.773254,  0.773132,
-	 0.773010,  0.772889,  0.772767,  0.772645,  0.772524,  0.772402,  0.772280,  0.772158,
-	 0.772036,  0.771915,  0.771793,  0.771671,  0.771549,  0.771427,  0.771305,  0.771183,
-	 0.771061,  0.770938,  0.770816,  0.770694,  0.770572,  0.770450,  0.770327,  0.770205,
-	 0.770083,  0.769961,  0.769838,  0.769716,  0.769593,  0.769471,  0.769348,  0.769226,
-	 0.769103,  0.768981,  0.768858,  0.768736,  0.768613,  0.768490,  0.768368,  0.768245,
-	 0.768122,  0.767999,  0.767876,  0.767754,  0.767631,  0.767508,  0.767385,  0.767262,
-	 0.767139,  0.767016,  0.766893,  0.766770,  0.766647,  0.766524,  0.766400,  0.766277,
-	 0.766154,  0.766031,  0.765907,  0.765784,  0.765661,  0.765538,  0.765414,  0.765291,
-	 0.765167,  0.765044,  0.764920,  0.764797,  0.764673,  0.764550,  0.764426,  0.764302,
-	 0.764179,  0.764055,  0.763931,  0.763808,  0.763684,  0.763560,  0.763436,  0.763312,
-	 0.763188,  0.763065,  0.762941,  0.762817,  0.762693,  0.762569,  0.762444,  0.762320,
-	 0.762196,  0.762072,  0.761948,  0.761824,  0.761700,  0.761575,  0.761451,  0.761327,
-	 0.761202,  0.761078,  0.760954,  0.760829,  0.760705,  0.760580,  0.760456,  0.760331,
-	 0.760207,  0.760082,  0.759957,  0.759833,  0.759708,  0.759583,  0.759459,  0.759334,
-	 0.759209,  0.759084,  0.758960,  0.758835,  0.758710,  0.758585,  0.758460,  0.758335,
-	 0.758210,  0.758085,  0.757960,  0.757835,  0.757710,  0.757584,  0.757459,  0.757334,
-	 0.757209,  0.757084,  0.756958,  0.756833,  0.756708,  0.756582,  0.756457,  0.756331,
-	 0.756206,  0.756081,  0.755955,  0.755829,  0.755704,  0.755578,  0.755453,  0.755327,
-	 0.755201,  0.755076,  0.754950,  0.754824,  0.754698,  0.754573,  0.754447,  0.754321,
-	 0.754195,  0.754069,  0.753943,  0.753817,  0.753691,  0.753565,  0.753439,  0.753313,
-	 0.753187,  0.753061,  0.752934,  0.752808,  0.752682,  0.752556,  0.752429,  0.752303,
-	 0.752177,  0.752050,  0.751924,  0.751798,  0.751671,  0.751545,  0.751418,  0.751292,
-	 0.751165,  0.751039,  0.750912,  0.750785,  0.750659,  0.750532,  0.750405,  0.750278,
-	 0.750152,  0.750025,  0.749898,  0.749771,  0.749644,  0.749517,  0.749390,  0.749263,
-	 0.749136,  0.749009,  0.748882,  0.748755,  0.748628,  0.748501,  0.748374,  0.748247,
-	 0.748119,  0.747992,  0.747865,  0.747738,  0.747610,  0.747483,  0.747355,  0.747228,
-	 0.747101,  0.746973,  0.746846,  0.746718,  0.746591,  0.746463,  0.746335,  0.746208,
-	 0.746080,  0.745952,  0.745825,  0.745697,  0.745569,  0.745441,  0.745314,  0.745186,
-	 0.745058,  0.744930,  0.744802,  0.744674,  0.744546,  0.744418,  0.744290,  0.744162,
-	 0.744034,  0.743906,  0.743777,  0.743649,  0.743521,  0.743393,  0.743265,  0.743136,
-	 0.743008,  0.742880,  0.742751,  0.742623,  0.742494,  0.742366,  0.742237,  0.742109,
-	 0.741980,  0.741852,  0.741723,  0.741595,  0.741466,  0.741337,  0.741209,  0.741080,
-	 0.740951,  0.740822,  0.740694,  0.740565,  0.740436,  0.740307,  0.740178,  0.740049,
-	 0.739920,  0.739791,  0.739662,  0.739533,  0.739404,  0.739275,  0.739146,  0.739017,
-	 0.738887,  0.738758,  0.738629,  0.738500,  0.738370,  0.738241,  0.738112,  0.737982,
-	 0.737853,  0.737723,  0.737594,  0.737464,  0.737335,  0.737205,  0.737076,  0.736946,
-	 0.736817,  0.736687,  0.736557,  0.736428,  0.736298,  0.736168,  0.736038,  0.735908,
-	 0.735779,  0.735649,  0.735519,  0.735389,  0.735259,  0.735129,  0.734999,  0.734869,
-	 0.734739,  0.734609,  0.734479,  0.734349,  0.734218,  0.734088,  0.733958,  0.733828,
-	 0.733697,  0.733567,  0.733437,  0.733306,  0.733176,  0.733046,  0.732915,  0.732785,
-	 0.732654,  0.732524,  0.732393,  0.732263,  0.732132,  0.732001,  0.731871,  0.731740,
-	 0.731609,  0.731479,  0.731348,  0.731217,  0.731086,  0.730955,  0.730825,  0.730694,
-	 0.730563,  0.730432,  0.730301,  0.730170,  0.730039,  0.729908,  0.729777,  0.729646,
-	 0.729514,  0.729383,  0.729252,  0.729121,  0.728990,  0.728858,  0.728727,  0.728596,
-	 0.728464,  0.728333,  0.728202,  0.728070,  0.727939,  0.727807,  0.727676,  0.727544,
-	 0.727413,  0.727281,  0.727149,  0.727018,  0.726886,  0.726754,  0.726623,  0.726491,
-	 0.726359,  0.726227,  0.726095,  0.725964,  0.725832,  0.725700,  0.725568,  0.725436,
-	 0.725304,  0.725172,  0.725040,  0.724908,  0.724776,  0.724644,  0.724511,  0.724379,
-	 0.724247,  0.724115,  0.723983,  0.723850,  0.723718,  0.723586,  0.723453,  0.723321,
-	 0.723188,  0.723056,  0.722924,  0.722791,  0.722659,  0.722526,  0.722393,  0.722261,
-	 0.722128,  0.721996,  0.721863,  0.721730,  0.721597,  0.721465,  0.721332,  0.721199,
-	 0.721066,  0.720933,  0.720800,  0.720668,  0.720535,  0.720402,  0.720269,  0.720136,
-	 0.720003,  0.719869,  0.719736,  0.719603,  0.719470,  0.719337,  0.719204,  0.719070,
-	 0.718937,  0.718804,  0.718670,  0.718537,  0.718404,  0.718270,  0.718137,  0.718004,
-	 0.717870,  0.717737,  0.717603,  0.717469,  0.717336,  0.717202,  0.717069,  0.716935,
-	 0.716801,  0.716668,  0.716534,  0.716400,  0.716266,  0.716132,  0.715999,  0.715865,
-	 0.715731,  0.715597,  0.715463,  0.715329,  0.715195,  0.715061,  0.714927,  0.714793,
-	 0.714659,  0.714525,  0.714390,  0.714256,  0.714122,  0.713988,  0.713853,  0.713719,
-	 0.713585,  0.713451,  0.713316,  0.713182,  0.713047,  0.712913,  0.712778,  0.712644,
-	 0.712509,  0.712375,  0.712240,  0.712106,  0.711971,  0.711836,  0.711702,  0.711567,
-	 0.711432,  0.711297,  0.711163,  0.711028,  0.710893,  0.710758,  0.710623,  0.710488,
-	 0.710353,  0.710218,  0.710083,  0.709948,  0.709813,  0.709678,  0.709543,  0.709408,
-	 0.709273,  0.709138,  0.709002,  0.708867,  0.708732,  0.708597,  0.708461,  0.708326,
-	 0.708191,  0.708055,  0.707920,  0.707784,  0.707649,  0.707513,  0.707378,  0.707242,
-	 0.707107,  0.706971,  0.706836,  0.706700,  0.706564,  0.706429,  0.706293,  0.706157,
-	 0.706021,  0.705885,  0.705750,  0.705614,  0.705478,  0.705342,  0.705206,  0.705070,
-	 0.704934,  0.704798,  0.704662,  0.704526,  0.704390,  0.704254,  0.704118,  0.703981,
-	 0.703845,  0.703709,  0.703573,  0.703436,  0.703300,  0.703164,  0.703028,  0.702891,
-	 0.702755,  0.702618,  0.702482,  0.702345,  0.702209,  0.702072,  0.701936,  0.701799,
-	 0.701663,  0.701526,  0.701389,  0.701253,  0.701116,  0.700979,  0.700842,  0.700706,
-	 0.700569,  0.700432,  0.700295,  0.700158,  0.700021,  0.699884,  0.699747,  0.699610,
-	 0.699473,  0.699336,  0.699199,  0.699062,  0.698925,  0.698788,  0.698651,  0.698513,
-	 0.698376,  0.698239,  0.698102,  0.697964,  0.697827,  0.697690,  0.697552,  0.697415,
-	 0.697277,  0.697140,  0.697003,  0.696865,  0.696728,  0.696590,  0.696452,  0.696315,
-	 0.696177,  0.696039,  0.695902,  0.695764,  0.695626,  0.695489,  0.695351,  0.695213,
-	 0.695075,  0.694937,  0.694799,  0.694661,  0.694524,  0.694386,  0.694248,  0.694109,
-	 0.693971,  0.693833,  0.693695,  0.693557,  0.693419,  0.693281,  0.693143,  0.693004,
-	 0.692866,  0.692728,  0.692590,  0.692451,  0.692313,  0.692175,  0.692036,  0.691898,
-	 0.691759,  0.691621,  0.691482,  0.691344,  0.691205,  0.691067,  0.690928,  0.690789,
-	 0.690651,  0.690512,  0.690373,  0.690235,  0.690096,  0.689957,  0.689818,  0.689679,
-	 0.689541,  0.689402,  0.689263,  0.689124,  0.688985,  0.688846,  0.688707,  0.688568,
-	 0.688429,  0.688290,  0.688151,  0.688011,  0.687872,  0.687733,  0.687594,  0.687455,
-	 0.687315,  0.687176,  0.687037,  0.686897,  0.686758,  0.686619,  0.686479,  0.686340,
-	 0.686200,  0.686061,  0.685921,  0.685782,  0.685642,  0.685503,  0.685363,  0.685223,
-	 0.685084,  0.684944,  0.684804,  0.684664,  0.684525,  0.684385,  0.684245,  0.684105,
-	 0.683965,  0.683825,  0.683686,  0.683546,  0.683406,  0.683266,  0.683126,  0.682986,
-	 0.682846,  0.682705,  0.682565,  0.682425,  0.682285,  0.682145,  0.682005,  0.681864,
-	 0.681724,  0.681584,  0.681443,  0.681303,  0.681163,  0.681022,  0.680882,  0.680741,
-	 0.680601,  0.680461,  0.680320,  0.680179,  0.680039,  0.679898,  0.679758,  0.679617,
-	 0.679476,  0.679336,  0.679195,  0.679054,  0.678913,  0.678773,  0.678632,  0.678491,
-	 0.678350,  0.678209,  0.678068,  0.677927,  0.677786,  0.677645,  0.677504,  0.677363,
-	 0.677222,  0.677081,  0.676940,  0.676799,  0.676658,  0.676516,  0.676375,  0.676234,
-	 0.676093,  0.675951,  0.675810,  0.675669,  0.675527,  0.675386,  0.675245,  0.675103,
-	 0.674962,  0.674820,  0.674679,  0.674537,  0.674396,  0.674254,  0.674112,  0.673971,
-	 0.673829,  0.673687,  0.673546,  0.673404,  0.673262,  0.673120,  0.672978,  0.672837,
-	 0.672695,  0.672553,  0.672411,  0.672269,  0.672127,  0.671985,  0.671843,  0.671701,
-	 0.671559,  0.671417,  0.671275,  0.671133,  0.670990,  0.670848,  0.670706,  0.670564,
-	 0.670422,  0.670279,  0.670137,  0.669995,  0.669852,  0.669710,  0.669567,  0.669425,
-	 0.669283,  0.669140,  0.668998,  0.668855,  0.668712,  0.668570,  0.668427,  0.668285,
-	 0.668142,  0.667999,  0.667857,  0.667714,  0.667571,  0.667428,  0.667286,  0.667143,
-	 0.667000,  0.666857,  0.666714,  0.666571,  0.666428,  0.666285,  0.666142,  0.665999,
-	 0.665856,  0.665713,  0.665570,  0.665427,  0.665284,  0.665141,  0.664997,  0.664854,
-	 0.664711,  0.664568,  0.664424,  0.664281,  0.664138,  0.663994,  0.663851,  0.663708,
-	 0.663564,  0.663421,  0.663277,  0.663134,  0.662990,  0.662847,  0.662703,  0.662559,
-	 0.662416,  0.662272,  0.662128,  0.661985,  0.661841,  0.661697,  0.661553,  0.661410,
-	 0.661266,  0.661122,  0.660978,  0.660834,  0.660690,  0.660546,  0.660402,  0.660258,
-	 0.660114,  0.659970,  0.659826,  0.659682,  0.659538,  0.659394,  0.659250,  0.659105,
-	 0.658961,  0.658817,  0.658673,  0.658529,  0.658384,  0.658240,  0.658095,  0.657951,
-	 0.657807,  0.657662,  0.657518,  0.657373,  0.657229,  0.657084,  0.656940,  0.656795,
-	 0.656651,  0.656506,  0.656361,  0.656217,  0.656072,  0.655927,  0.655782,  0.655638,
-	 0.655493,  0.655348,  0.655203,  0.655058,  0.654913,  0.654769,  0.654624,  0.654479,
-	 0.654334,  0.654189,  0.654044,  0.653899,  0.653753,  0.653608,  0.653463,  0.653318,
-	 0.653173,  0.653028,  0.652882,  0.652737,  0.652592,  0.652447,  0.652301,  0.652156,
-	 0.652011,  0.651865,  0.651720,  0.651574,  0.651429,  0.651283,  0.651138,  0.650992,
-	 0.650847,  0.650701,  0.650555,  0.650410,  0.650264,  0.650119,  0.649973,  0.649827,
-	 0.649681,  0.649536,  0.649390,  0.649244,  0.649098,  0.648952,  0.648806,  0.648660,
-	 0.648514,  0.648368,  0.648222,  0.648076,  0.647930,  0.647784,  0.647638,  0.647492,
-	 0.647346,  0.647200,  0.647054,  0.646907,  0.646761,  0.646615,  0.646469,  0.646322,
-	 0.646176,  0.646030,  0.645883,  0.645737,  0.645590,  0.645444,  0.645298,  0.645151,
-	 0.645005,  0.644858,  0.644711,  0.644565,  0.644418,  0.644272,  0.644125,  0.643978,
-	 0.643832,  0.643685,  0.643538,  0.643391,  0.643245,  0.643098,  0.642951,  0.642804,
-	 0.642657,  0.642510,  0.642363,  0.642216,  0.642069,  0.641922,  0.641775,  0.641628,
-	 0.641481,  0.641334,  0.641187,  0.641040,  0.640892,  0.640745,  0.640598,  0.640451,
-	 0.640303,  0.640156,  0.640009,  0.639862,  0.639714,  0.639567,  0.639419,  0.639272,
-	 0.639124,  0.638977,  0.638829,  0.638682,  0.638534,  0.638387,  0.638239,  0.638092,
-	 0.637944,  0.637796,  0.637649,  0.637501,  0.637353,  0.637205,  0.637057,  0.636910,
-	 0.636762,  0.636614,  0.636466,  0.636318,  0.636170,  0.636022,  0.635874,  0.635726,
-	 0.635578,  0.635430,  0.635282,  0.635134,  0.634986,  0.634838,  0.634690,  0.634542,
-	 0.634393,  0.634245,  0.634097,  0.633949,  0.633800,  0.633652,  0.633504,  0.633355,
-	 0.633207,  0.633058,  0.632910,  0.632761,  0.632613,  0.632464,  0.632316,  0.632167,
-	 0.632019,  0.631870,  0.631721,  0.631573,  0.631424,  0.631275,  0.631127,  0.630978,
-	 0.630829,  0.630680,  0.630532,  0.630383,  0.630234,  0.630085,  0.629936,  0.629787,
-	 0.629638,  0.629489,  0.629340,  0.629191,  0.629042,  0.628893,  0.628744,  0.628595,
-	 0.628446,  0.628297,  0.628147,  0.627998,  0.627849,  0.627700,  0.627550,  0.627401,
-	 0.627252,  0.627102,  0.626953,  0.626804,  0.626654,  0.626505,  0.626355,  0.626206,
-	 0.626056,  0.625907,  0.625757,  0.625608,  0.625458,  0.625309,  0.625159,  0.625009,
-	 0.624860,  0.624710,  0.624560,  0.624410,  0.624260,  0.624111,  0.623961,  0.623811,
-	 0.623661,  0.623511,  0.623361,  0.623211,  0.623061,  0.622911,  0.622761,  0.622611,
-	 0.622461,  0.622311,  0.622161,  0.622011,  0.621861,  0.621711,  0.621560,  0.621410,
-	 0.621260,  0.621110,  0.620959,  0.620809,  0.620659,  0.620508,  0.620358,  0.620208,
-	 0.620057,  0.619907,  0.619756,  0.619606,  0.619455,  0.619305,  0.619154,  0.619004,
-	 0.618853,  0.618702,  0.618552,  0.618401,  0.618250,  0.618100,  0.617949,  0.617798,
-	 0.617647,  0.617496,  0.617346,  0.617195,  0.617044,  0.616893,  0.616742,  0.616591,
-	 0.616440,  0.616289,  0.616138,  0.615987,  0.615836,  0.615685,  0.615534,  0.615383,
-	 0.615232,  0.615080,  0.614929,  0.614778,  0.614627,  0.614475,  0.614324,  0.614173,
-	 0.614022,  0.613870,  0.613719,  0.613567,  0.613416,  0.613265,  0.613113,  0.612962,
-	 0.612810,  0.612659,  0.612507,  0.612355,  0.612204,  0.612052,  0.611901,  0.611749,
-	 0.611597,  0.611445,  0.611294,  0.611142,  0.610990,  0.610838,  0.610687,  0.610535,
-	 0.610383,  0.610231,  0.610079,  0.609927,  0.609775,  0.609623,  0.609471,  0.609319,
-	 0.609167,  0.609015,  0.608863,  0.608711,  0.608559,  0.608406,  0.608254,  0.608102,
-	 0.607950,  0.607798,  0.607645,  0.607493,  0.607341,  0.607188,  0.607036,  0.606884,
-	 0.606731,  0.606579,  0.606426,  0.606274,  0.606121,  0.605969,  0.605816,  0.605664,
-	 0.605511,  0.605358,  0.605206,  0.605053,  0.604900,  0.604748,  0.604595,  0.604442,
-	 0.604290,  0.604137,  0.603984,  0.603831,  0.603678,  0.603525,  0.603372,  0.603220,
-	 0.603067,  0.602914,  0.602761,  0.602608,  0.602455,  0.602302,  0.602148,  0.601995,
-	 0.601842,  0.601689,  0.601536,  0.601383,  0.601230,  0.601076,  0.600923,  0.600770,
-	 0.600616,  0.600463,  0.600310,  0.600156,  0.600003,  0.599850,  0.599696,  0.599543,
-	 0.599389,  0.599236,  0.599082,  0.598929,  0.598775,  0.598622,  0.598468,  0.598314,
-	 0.598161,  0.598007,  0.597853,  0.597700,  0.597546,  0.597392,  0.597238,  0.597085,
-	 0.596931,  0.596777,  0.596623,  0.596469,  0.596315,  0.596161,  0.596007,  0.595853,
-	 0.595699,  0.595545,  0.595391,  0.595237,  0.595083,  0.594929,  0.594775,  0.594621,
-	 0.594467,  0.594312,  0.594158,  0.594004,  0.593850,  0.593695,  0.593541,  0.593387,
-	 0.593232,  0.593078,  0.592924,  0.592769,  0.592615,  0.592460,  0.592306,  0.592151,
-	 0.591997,  0.591842,  0.591688,  0.591533,  0.591378,  0.591224,  0.591069,  0.590914,
-	 0.590760,  0.590605,  0.590450,  0.590295,  0.590141,  0.589986,  0.589831,  0.589676,
-	 0.589521,  0.589366,  0.589212,  0.589057,  0.588902,  0.588747,  0.588592,  0.588437,
-	 0.588282,  0.588126,  0.587971,  0.587816,  0.587661,  0.587506,  0.587351,  0.587196,
-	 0.587040,  0.586885,  0.586730,  0.586575,  0.586419,  0.586264,  0.586109,  0.585953,
-	 0.585798,  0.585642,  0.585487,  0.585332,  0.585176,  0.585021,  0.584865,  0.584710,
-	 0.584554,  0.584398,  0.584243,  0.584087,  0.583931,  0.583776,  0.583620,  0.583464,
-	 0.583309,  0.583153,  0.582997,  0.582841,  0.582685,  0.582530,  0.582374,  0.582218,
-	 0.582062,  0.581906,  0.581750,  0.581594,  0.581438,  0.581282,  0.581126,  0.580970,
-	 0.580814,  0.580658,  0.580502,  0.580346,  0.580189,  0.580033,  0.579877,  0.579721,
-	 0.579565,  0.579408,  0.579252,  0.579096,  0.578939,  0.578783,  0.578627,  0.578470,
-	 0.578314,  0.578157,  0.578001,  0.577844,  0.577688,  0.577531,  0.577375,  0.577218,
-	 0.577062,  0.576905,  0.576748,  0.576592,  0.576435,  0.576278,  0.576122,  0.575965,
-	 0.575808,  0.575651,  0.575495,  0.575338,  0.575181,  0.575024,  0.574867,  0.574710,
-	 0.574553,  0.574396,  0.574239,  0.574082,  0.573925,  0.573768,  0.573611,  0.573454,
-	 0.573297,  0.573140,  0.572983,  0.572826,  0.572669,  0.572511,  0.572354,  0.572197,
-	 0.572040,  0.571882,  0.571725,  0.571568,  0.571410,  0.571253,  0.571096,  0.570938,
-	 0.570781,  0.570623,  0.570466,  0.570308,  0.570151,  0.569993,  0.569836,  0.569678,
-	 0.569521,  0.569363,  0.569205,  0.569048,  0.568890,  0.568732,  0.568574,  0.568417,
-	 0.568259,  0.568101,  0.567943,  0.567786,  0.567628,  0.567470,  0.567312,  0.567154,
-	 0.566996,  0.566838,  0.566680,  0.566522,  0.566364,  0.566206,  0.566048,  0.565890,
-	 0.565732,  0.565574,  0.565416,  0.565257,  0.565099,  0.564941,  0.564783,  0.564624,
-	 0.564466,  0.564308,  0.564150,  0.563991,  0.563833,  0.563675,  0.563516,  0.563358,
-	 0.563199,  0.563041,  0.562882,  0.562724,  0.562565,  0.562407,  0.562248,  0.562090,
-	 0.561931,  0.561773,  0.561614,  0.561455,  0.561297,  0.561138,  0.560979,  0.560820,
-	 0.560662,  0.560503,  0.560344,  0.560185,  0.560026,  0.559867,  0.559709,  0.559550,
-	 0.559391,  0.559232,  0.559073,  0.558914,  0.558755,  0.558596,  0.558437,  0.558278,
-	 0.558119,  0.557959,  0.557800,  0.557641,  0.557482,  0.557323,  0.557164,  0.557004,
-	 0.556845,  0.556686,  0.556526,  0.556367,  0.556208,  0.556048,  0.555889,  0.555730,
-	 0.555570,  0.555411,  0.555251,  0.555092,  0.554932,  0.554773,  0.554613,  0.554454,
-	 0.554294,  0.554134,  0.553975,  0.553815,  0.553656,  0.553496,  0.553336,  0.553176,
-	 0.553017,  0.552857,  0.552697,  0.552537,  0.552378,  0.552218,  0.552058,  0.551898,
-	 0.551738,  0.551578,  0.551418,  0.551258,  0.551098,  0.550938,  0.550778,  0.550618,
-	 0.550458,  0.550298,  0.550138,  0.549978,  0.549818,  0.549657,  0.549497,  0.549337,
-	 0.549177,  0.549016,  0.548856,  0.548696,  0.548536,  0.548375,  0.548215,  0.548054,
-	 0.547894,  0.547734,  0.547573,  0.547413,  0.547252,  0.547092,  0.546931,  0.546771,
-	 0.546610,  0.546450,  0.546289,  0.546128,  0.545968,  0.545807,  0.545646,  0.545486,
-	 0.545325,  0.545164,  0.545003,  0.544843,  0.544682,  0.544521,  0.544360,  0.544199,
-	 0.544039,  0.543878,  0.543717,  0.543556,  0.543395,  0.543234,  0.543073,  0.542912,
-	 0.542751,  0.542590,  0.542429,  0.542268,  0.542106,  0.541945,  0.541784,  0.541623,
-	 0.541462,  0.541301,  0.541139,  0.540978,  0.540817,  0.540655,  0.540494,  0.540333,
-	 0.540171,  0.540010,  0.539849,  0.539687,  0.539526,  0.539364,  0.539203,  0.539041,
-	 0.538880,  0.538718,  0.538557,  0.538395,  0.538234,  0.538072,  0.537910,  0.537749,
-	 0.537587,  0.537425,  0.537264,  0.537102,  0.536940,  0.536778,  0.536617,  0.536455,
-	 0.536293,  0.536131,  0.535969,  0.535807,  0.535645,  0.535484,  0.535322,  0.535160,
-	 0.534998,  0.534836,  0.534674,  0.534512,  0.534349,  0.534187,  0.534025,  0.533863,
-	 0.533701,  0.533539,  0.533377,  0.533214,  0.533052,  0.532890,  0.532728,  0.532565,
-	 0.532403,  0.532241,  0.532078,  0.531916,  0.531754,  0.531591,  0.531429,  0.531266,
-	 0.531104,  0.530942,  0.530779,  0.530617,  0.530454,  0.530291,  0.530129,  0.529966,
-	 0.529804,  0.529641,  0.529478,  0.529316,  0.529153,  0.528990,  0.528828,  0.528665,
-	 0.528502,  0.528339,  0.528176,  0.528014,  0.527851,  0.527688,  0.527525,  0.527362,
-	 0.527199,  0.527036,  0.526873,  0.526710,  0.526547,  0.526384,  0.526221,  0.526058,
-	 0.525895,  0.525732,  0.525569,  0.525406,  0.525243,  0.525079,  0.524916,  0.524753,
-	 0.524590,  0.524426,  0.524263,  0.524100,  0.523937,  0.523773,  0.523610,  0.523447,
-	 0.523283,  0.523120,  0.522956,  0.522793,  0.522629,  0.522466,  0.522302,  0.522139,
-	 0.521975,  0.521812,  0.521648,  0.521485,  0.521321,  0.521157,  0.520994,  0.520830,
-	 0.520666,  0.520503,  0.520339,  0.520175,  0.520011,  0.519848,  0.519684,  0.519520,
-	 0.519356,  0.519192,  0.519028,  0.518864,  0.518700,  0.518536,  0.518372,  0.518209,
-	 0.518045,  0.517880,  0.517716,  0.517552,  0.517388,  0.517224,  0.517060,  0.516896,
-	 0.516732,  0.516568,  0.516403,  0.516239,  0.516075,  0.515911,  0.515746,  0.515582,
-	 0.515418,  0.515254,  0.515089,  0.514925,  0.514760,  0.514596,  0.514432,  0.514267,
-	 0.514103,  0.513938,  0.513774,  0.513609,  0.513445,  0.513280,  0.513116,  0.512951,
-	 0.512786,  0.512622,  0.512457,  0.512292,  0.512128,  0.511963,  0.511798,  0.511634,
-	 0.511469,  0.511304,  0.511139,  0.510974,  0.510810,  0.510645,  0.510480,  0.510315,
-	 0.510150,  0.509985,  0.509820,  0.509655,  0.509490,  0.509325,  0.509160,  0.508995,
-	 0.508830,  0.508665,  0.508500,  0.508335,  0.508170,  0.508005,  0.507839,  0.507674,
-	 0.507509,  0.507344,  0.507179,  0.507013,  0.506848,  0.506683,  0.506517,  0.506352,
-	 0.506187,  0.506021,  0.505856,  0.505690,  0.505525,  0.505360,  0.505194,  0.505029,
-	 0.504863,  0.504698,  0.504532,  0.504366,  0.504201,  0.504035,  0.503870,  0.503704,
-	 0.503538,  0.503373,  0.503207,  0.503041,  0.502876,  0.502710,  0.502544,  0.502378,
-	 0.502212,  0.502047,  0.501881,  0.501715,  0.501549,  0.501383,  0.501217,  0.501051,
-	 0.500885,  0.500719,  0.500553,  0.500387,  0.500221,  0.500055,  0.499889,  0.499723,
-	 0.499557,  0.499391,  0.499225,  0.499059,  0.498893,  0.498726,  0.498560,  0.498394,
-	 0.498228,  0.498061,  0.497895,  0.497729,  0.497562,  0.497396,  0.497230,  0.497063,
-	 0.496897,  0.496731,  0.496564,  0.496398,  0.496231,  0.496065,  0.495898,  0.495732,
-	 0.495565,  0.495399,  0.495232,  0.495066,  0.494899,  0.494732,  0.494566,  0.494399,
-	 0.494232,  0.494066,  0.493899,  0.493732,  0.493565,  0.493399,  0.493232,  0.493065,
-	 0.492898,  0.492731,  0.492564,  0.492398,  0.492231,  0.492064,  0.491897,  0.491730,
-	 0.491563,  0.491396,  0.491229,  0.491062,  0.490895,  0.490728,  0.490561,  0.490394,
-	 0.490226,  0.490059,  0.489892,  0.489725,  0.489558,  0.489391,  0.489223,  0.489056,
-	 0.488889,  0.488722,  0.488554,  0.488387,  0.488220,  0.488052,  0.487885,  0.487718,
-	 0.487550,  0.487383,  0.487215,  0.487048,  0.486880,  0.486713,  0.486545,  0.486378,
-	 0.486210,  0.486043,  0.485875,  0.485708,  0.485540,  0.485372,  0.485205,  0.485037,
-	 0.484869,  0.484702,  0.484534,  0.484366,  0.484198,  0.484031,  0.483863,  0.483695,
-	 0.483527,  0.483359,  0.483191,  0.483023,  0.482856,  0.482688,  0.482520,  0.482352,
-	 0.482184,  0.482016,  0.481848,  0.481680,  0.481512,  0.481344,  0.481176,  0.481007,
-	 0.480839,  0.480671,  0.480503,  0.480335,  0.480167,  0.479998,  0.479830,  0.479662,
-	 0.479494,  0.479325,  0.479157,  0.478989,  0.478821,  0.478652,  0.478484,  0.478315,
-	 0.478147,  0.477979,  0.477810,  0.477642,  0.477473,  0.477305,  0.477136,  0.476968,
-	 0.476799,  0.476631,  0.476462,  0.476294,  0.476125,  0.475956,  0.475788,  0.475619,
-	 0.475450,  0.475282,  0.475113,  0.474944,  0.474775,  0.474607,  0.474438,  0.474269,
-	 0.474100,  0.473931,  0.473763,  0.473594,  0.473425,  0.473256,  0.473087,  0.472918,
-	 0.472749,  0.472580,  0.472411,  0.472242,  0.472073,  0.471904,  0.471735,  0.471566,
-	 0.471397,  0.471228,  0.471058,  0.470889,  0.470720,  0.470551,  0.470382,  0.470213,
-	 0.470043,  0.469874,  0.469705,  0.469536,  0.469366,  0.469197,  0.469028,  0.468858,
-	 0.468689,  0.468519,  0.468350,  0.468181,  0.468011,  0.467842,  0.467672,  0.467503,
-	 0.467333,  0.467164,  0.466994,  0.466825,  0.466655,  0.466485,  0.466316,  0.466146,
-	 0.465977,  0.465807,  0.465637,  0.465467,  0.465298,  0.465128,  0.464958,  0.464788,
-	 0.464619,  0.464449,  0.464279,  0.464109,  0.463939,  0.463769,  0.463600,  0.463430,
-	 0.463260,  0.463090,  0.462920,  0.462750,  0.462580,  0.462410,  0.462240,  0.462070,
-	 0.461900,  0.461730,  0.461560,  0.461390,  0.461219,  0.461049,  0.460879,  0.460709,
-	 0.460539,  0.460369,  0.460198,  0.460028,  0.459858,  0.459687,  0.459517,  0.459347,
-	 0.459177,  0.459006,  0.458836,  0.458665,  0.458495,  0.458325,  0.458154,  0.457984,
-	 0.457813,  0.457643,  0.457472,  0.457302,  0.457131,  0.456961,  0.456790,  0.456620,
-	 0.456449,  0.456278,  0.456108,  0.455937,  0.455766,  0.455596,  0.455425,  0.455254,
-	 0.455084,  0.454913,  0.454742,  0.454571,  0.454400,  0.454230,  0.454059,  0.453888,
-	 0.453717,  0.453546,  0.453375,  0.453204,  0.453033,  0.452863,  0.452692,  0.452521,
-	 0.452350,  0.452179,  0.452008,  0.451836,  0.451665,  0.451494,  0.451323,  0.451152,
-	 0.450981,  0.450810,  0.450639,  0.450467,  0.450296,  0.450125,  0.449954,  0.449783,
-	 0.449611,  0.449440,  0.449269,  0.449097,  0.448926,  0.448755,  0.448583,  0.448412,
-	 0.448241,  0.448069,  0.447898,  0.447726,  0.447555,  0.447383,  0.447212,  0.447040,
-	 0.446869,  0.446697,  0.446526,  0.446354,  0.446183,  0.446011,  0.445839,  0.445668,
-	 0.445496,  0.445324,  0.445153,  0.444981,  0.444809,  0.444637,  0.444466,  0.444294,
-	 0.444122,  0.443950,  0.443779,  0.443607,  0.443435,  0.443263,  0.443091,  0.442919,
-	 0.442747,  0.442575,  0.442403,  0.442231,  0.442059,  0.441887,  0.441715,  0.441543,
-	 0.441371,  0.441199,  0.441027,  0.440855,  0.440683,  0.440511,  0.440339,  0.440166,
-	 0.439994,  0.439822,  0.439650,  0.439478,  0.439305,  0.439133,  0.438961,  0.438789,
-	 0.438616,  0.438444,  0.438272,  0.438099,  0.437927,  0.437754,  0.437582,  0.437410,
-	 0.437237,  0.437065,  0.436892,  0.436720,  0.436547,  0.436375,  0.436202,  0.436030,
-	 0.435857,  0.435685,  0.435512,  0.435339,  0.435167,  0.434994,  0.434821,  0.434649,
-	 0.434476,  0.434303,  0.434131,  0.433958,  0.433785,  0.433612,  0.433439,  0.433267,
-	 0.433094,  0.432921,  0.432748,  0.432575,  0.432402,  0.432229,  0.432057,  0.431884,
-	 0.431711,  0.431538,  0.431365,  0.431192,  0.431019,  0.430846,  0.430673,  0.430500,
-	 0.430326,  0.430153,  0.429980,  0.429807,  0.429634,  0.429461,  0.429288,  0.429114,
-	 0.428941,  0.428768,  0.428595,  0.428422,  0.428248,  0.428075,  0.427902,  0.427728,
-	 0.427555,  0.427382,  0.427208,  0.427035,  0.426862,  0.426688,  0.426515,  0.426341,
-	 0.426168,  0.425994,  0.425821,  0.425647,  0.425474,  0.425300,  0.425127,  0.424953,
-	 0.424780,  0.424606,  0.424432,  0.424259,  0.424085,  0.423912,  0.423738,  0.423564,
-	 0.423390,  0.423217,  0.423043,  0.422869,  0.422695,  0.422522,  0.422348,  0.422174,
-	 0.422000,  0.421826,  0.421653,  0.421479,  0.421305,  0.421131,  0.420957,  0.420783,
-	 0.420609,  0.420435,  0.420261,  0.420087,  0.419913,  0.419739,  0.419565,  0.419391,
-	 0.419217,  0.419043,  0.418869,  0.418695,  0.418520,  0.418346,  0.418172,  0.417998,
-	 0.417824,  0.417650,  0.417475,  0.417301,  0.417127,  0.416952,  0.416778,  0.416604,
-	 0.416430,  0.416255,  0.416081,  0.415906,  0.415732,  0.415558,  0.415383,  0.415209,
-	 0.415034,  0.414860,  0.414685,  0.414511,  0.414337,  0.414162,  0.413987,  0.413813,
-	 0.413638,  0.413464,  0.413289,  0.413115,  0.412940,  0.412765,  0.412591,  0.412416,
-	 0.412241,  0.412067,  0.411892,  0.411717,  0.411542,  0.411368,  0.411193,  0.411018,
-	 0.410843,  0.410668,  0.410493,  0.410319,  0.410144,  0.409969,  0.409794,  0.409619,
-	 0.409444,  0.409269,  0.409094,  0.408919,  0.408744,  0.408569,  0.408394,  0.408219,
-	 0.408044,  0.407869,  0.407694,  0.407519,  0.407344,  0.407169,  0.406994,  0.406818,
-	 0.406643,  0.406468,  0.406293,  0.406118,  0.405942,  0.405767,  0.405592,  0.405417,
-	 0.405241,  0.405066,  0.404891,  0.404715,  0.404540,  0.404365,  0.404189,  0.404014,
-	 0.403838,  0.403663,  0.403488,  0.403312,  0.403137,  0.402961,  0.402786,  0.402610,
-	 0.402435,  0.402259,  0.402084,  0.401908,  0.401732,  0.401557,  0.401381,  0.401206,
-	 0.401030,  0.400854,  0.400679,  0.400503,  0.400327,  0.400151,  0.399976,  0.399800,
-	 0.399624,  0.399448,  0.399273,  0.399097,  0.398921,  0.398745,  0.398569,  0.398393,
-	 0.398218,  0.398042,  0.397866,  0.397690,  0.397514,  0.397338,  0.397162,  0.396986,
-	 0.396810,  0.396634,  0.396458,  0.396282,  0.396106,  0.395930,  0.395754,  0.395578,
-	 0.395401,  0.395225,  0.395049,  0.394873,  0.394697,  0.394521,  0.394344,  0.394168,
-	 0.393992,  0.393816,  0.393640,  0.393463,  0.393287,  0.393111,  0.392934,  0.392758,
-	 0.392582,  0.392405,  0.392229,  0.392053,  0.391876,  0.391700,  0.391523,  0.391347,
-	 0.391170,  0.390994,  0.390817,  0.390641,  0.390464,  0.390288,  0.390111,  0.389935,
-	 0.389758,  0.389582,  0.389405,  0.389228,  0.389052,  0.388875,  0.388698,  0.388522,
-	 0.388345,  0.388168,  0.387992,  0.387815,  0.387638,  0.387461,  0.387285,  0.387108,
-	 0.386931,  0.386754,  0.386577,  0.386400,  0.386224,  0.386047,  0.385870,  0.385693,
-	 0.385516,  0.385339,  0.385162,  0.384985,  0.384808,  0.384631,  0.384454,  0.384277,
-	 0.384100,  0.383923,  0.383746,  0.383569,  0.383392,  0.383215,  0.383038,  0.382861,
-	 0.382683,  0.382506,  0.382329,  0.382152,  0.381975,  0.381797,  0.381620,  0.381443,
-	 0.381266,  0.381088,  0.380911,  0.380734,  0.380557,  0.380379,  0.380202,  0.380025,
-	 0.379847,  0.379670,  0.379492,  0.379315,  0.379138,  0.378960,  0.378783,  0.378605,
-	 0.378428,  0.378250,  0.378073,  0.377895,  0.377718,  0.377540,  0.377363,  0.377185,
-	 0.377007,  0.376830,  0.376652,  0.376475,  0.376297,  0.376119,  0.375942,  0.375764,
-	 0.375586,  0.375408,  0.375231,  0.375053,  0.374875,  0.374697,  0.374520,  0.374342,
-	 0.374164,  0.373986,  0.373808,  0.373631,  0.373453,  0.373275,  0.373097,  0.372919,
-	 0.372741,  0.372563,  0.372385,  0.372207,  0.372029,  0.371851,  0.371673,  0.371495,
-	 0.371317,  0.371139,  0.370961,  0.370783,  0.370605,  0.370427,  0.370249,  0.370071,
-	 0.369892,  0.369714,  0.369536,  0.369358,  0.369180,  0.369002,  0.368823,  0.368645,
-	 0.368467,  0.368289,  0.368110,  0.367932,  0.367754,  0.367575,  0.367397,  0.367219,
-	 0.367040,  0.366862,  0.366684,  0.366505,  0.366327,  0.366148,  0.365970,  0.365791,
-	 0.365613,  0.365435,  0.365256,  0.365078,  0.364899,  0.364720,  0.364542,  0.364363,
-	 0.364185,  0.364006,  0.363828,  0.363649,  0.363470,  0.363292,  0.363113,  0.362934,
-	 0.362756,  0.362577,  0.362398,  0.362220,  0.362041,  0.361862,  0.361683,  0.361505,
-	 0.361326,  0.361147,  0.360968,  0.360789,  0.360611,  0.360432,  0.360253,  0.360074,
-	 0.359895,  0.359716,  0.359537,  0.359358,  0.359179,  0.359000,  0.358821,  0.358642,
-	 0.358463,  0.358284,  0.358105,  0.357926,  0.357747,  0.357568,  0.357389,  0.357210,
-	 0.357031,  0.356852,  0.356673,  0.356494,  0.356314,  0.356135,  0.355956,  0.355777,
-	 0.355598,  0.355418,  0.355239,  0.355060,  0.354881,  0.354701,  0.354522,  0.354343,
-	 0.354164,  0.353984,  0.353805,  0.353626,  0.353446,  0.353267,  0.353087,  0.352908,
-	 0.352729,  0.352549,  0.352370,  0.352190,  0.352011,  0.351831,  0.351652,  0.351472,
-	 0.351293,  0.351113,  0.350934,  0.350754,  0.350575,  0.350395,  0.350215,  0.350036,
-	 0.349856,  0.349676,  0.349497,  0.349317,  0.349138,  0.348958,  0.348778,  0.348598,
-	 0.348419,  0.348239,  0.348059,  0.347879,  0.347700,  0.347520,  0.347340,  0.347160,
-	 0.346980,  0.346801,  0.346621,  0.346441,  0.346261,  0.346081,  0.345901,  0.345721,
-	 0.345541,  0.345361,  0.345181,  0.345001,  0.344821,  0.344641,  0.344461,  0.344281,
-	 0.344101,  0.343921,  0.343741,  0.343561,  0.343381,  0.343201,  0.343021,  0.342841,
-	 0.342661,  0.342481,  0.342300,  0.342120,  0.341940,  0.341760,  0.341580,  0.341399,
-	 0.341219,  0.341039,  0.340859,  0.340678,  0.340498,  0.340318,  0.340138,  0.339957,
-	 0.339777,  0.339597,  0.339416,  0.339236,  0.339055,  0.338875,  0.338695,  0.338514,
-	 0.338334,  0.338153,  0.337973,  0.337792,  0.337612,  0.337431,  0.337251,  0.337070,
-	 0.336890,  0.336709,  0.336529,  0.336348,  0.336168,  0.335987,  0.335806,  0.335626,
-	 0.335445,  0.335265,  0.335084,  0.334903,  0.334722,  0.334542,  0.334361,  0.334180,
-	 0.334000,  0.333819,  0.333638,  0.333457,  0.333277,  0.333096,  0.332915,  0.332734,
-	 0.332553,  0.332373,  0.332192,  0.332011,  0.331830,  0.331649,  0.331468,  0.331287,
-	 0.331106,  0.330925,  0.330744,  0.330563,  0.330382,  0.330202,  0.330020,  0.329839,
-	 0.329658,  0.329477,  0.329296,  0.329115,  0.328934,  0.328753,  0.328572,  0.328391,
-	 0.328210,  0.328029,  0.327848,  0.327666,  0.327485,  0.327304,  0.327123,  0.326942,
-	 0.326760,  0.326579,  0.326398,  0.326217,  0.326035,  0.325854,  0.325673,  0.325492,
-	 0.325310,  0.325129,  0.324948,  0.324766,  0.324585,  0.324404,  0.324222,  0.324041,
-	 0.323859,  0.323678,  0.323497,  0.323315,  0.323134,  0.322952,  0.322771,  0.322589,
-	 0.322408,  0.322226,  0.322045,  0.321863,  0.321682,  0.321500,  0.321318,  0.321137,
-	 0.320955,  0.320774,  0.320592,  0.320410,  0.320229,  0.320047,  0.319865,  0.319684,
-	 0.319502,  0.319320,  0.319139,  0.318957,  0.318775,  0.318593,  0.318412,  0.318230,
-	 0.318048,  0.317866,  0.317684,  0.317503,  0.317321,  0.317139,  0.316957,  0.316775,
-	 0.316593,  0.316411,  0.316230,  0.316048,  0.315866,  0.315684,  0.315502,  0.315320,
-	 0.315138,  0.314956,  0.314774,  0.314592,  0.314410,  0.314228,  0.314046,  0.313864,
-	 0.313682,  0.313500,  0.313318,  0.313135,  0.312953,  0.312771,  0.312589,  0.312407,
-	 0.312225,  0.312043,  0.311860,  0.311678,  0.311496,  0.311314,  0.311132,  0.310949,
-	 0.310767,  0.310585,  0.310403,  0.310220,  0.310038,  0.309856,  0.309673,  0.309491,
-	 0.309309,  0.309126,  0.308944,  0.308762,  0.308579,  0.308397,  0.308214,  0.308032,
-	 0.307850,  0.307667,  0.307485,  0.307302,  0.307120,  0.306937,  0.306755,  0.306572,
-	 0.306390,  0.306207,  0.306025,  0.305842,  0.305660,  0.305477,  0.305294,  0.305112,
-	 0.304929,  0.304747,  0.304564,  0.304381,  0.304199,  0.304016,  0.303833,  0.303651,
-	 0.303468,  0.303285,  0.303103,  0.302920,  0.302737,  0.302554,  0.302372,  0.302189,
-	 0.302006,  0.301823,  0.301640,  0.301458,  0.301275,  0.301092,  0.300909,  0.300726,
-	 0.300543,  0.300360,  0.300177,  0.299995,  0.299812,  0.299629,  0.299446,  0.299263,
-	 0.299080,  0.298897,  0.298714,  0.298531,  0.298348,  0.298165,  0.297982,  0.297799,
-	 0.297616,  0.297433,  0.297250,  0.297066,  0.296883,  0.296700,  0.296517,  0.296334,
-	 0.296151,  0.295968,  0.295785,  0.295601,  0.295418,  0.295235,  0.295052,  0.294869,
-	 0.294685,  0.294502,  0.294319,  0.294136,  0.293952,  0.293769,  0.293586,  0.293402,
-	 0.293219,  0.293036,  0.292852,  0.292669,  0.292486,  0.292302,  0.292119,  0.291936,
-	 0.291752,  0.291569,  0.291385,  0.291202,  0.291019,  0.290835,  0.290652,  0.290468,
-	 0.290285,  0.290101,  0.289918,  0.289734,  0.289551,  0.289367,  0.289184,  0.289000,
-	 0.288816,  0.288633,  0.288449,  0.288266,  0.288082,  0.287898,  0.287715,  0.287531,
-	 0.287347,  0.287164,  0.286980,  0.286796,  0.286613,  0.286429,  0.286245,  0.286062,
-	 0.285878,  0.285694,  0.285510,  0.285327,  0.285143,  0.284959,  0.284775,  0.284591,
-	 0.284408,  0.284224,  0.284040,  0.283856,  0.283672,  0.283488,  0.283304,  0.283120,
-	 0.282937,  0.282753,  0.282569,  0.282385,  0.282201,  0.282017,  0.281833,  0.281649,
-	 0.281465,  0.281281,  0.281097,  0.280913,  0.280729,  0.280545,  0.280361,  0.280177,
-	 0.279993,  0.279809,  0.279624,  0.279440,  0.279256,  0.279072,  0.278888,  0.278704,
-	 0.278520,  0.278336,  0.278151,  0.277967,  0.277783,  0.277599,  0.277415,  0.277230,
-	 0.277046,  0.276862,  0.276678,  0.276493,  0.276309,  0.276125,  0.275940,  0.275756,
-	 0.275572,  0.275387,  0.275203,  0.275019,  0.274834,  0.274650,  0.274466,  0.274281,
-	 0.274097,  0.273912,  0.273728,  0.273544,  0.273359,  0.273175,  0.272990,  0.272806,
-	 0.272621,  0.272437,  0.272252,  0.272068,  0.271883,  0.271699,  0.271514,  0.271330,
-	 0.271145,  0.270961,  0.270776,  0.270591,  0.270407,  0.270222,  0.270038,  0.269853,
-	 0.269668,  0.269484,  0.269299,  0.269114,  0.268930,  0.268745,  0.268560,  0.268376,
-	 0.268191,  0.268006,  0.267821,  0.267637,  0.267452,  0.267267,  0.267082,  0.266898,
-	 0.266713,  0.266528,  0.266343,  0.266158,  0.265973,  0.265789,  0.265604,  0.265419,
-	 0.265234,  0.265049,  0.264864,  0.264679,  0.264494,  0.264309,  0.264125,  0.263940,
-	 0.263755,  0.263570,  0.263385,  0.263200,  0.263015,  0.262830,  0.262645,  0.262460,
-	 0.262275,  0.262090,  0.261905,  0.261720,  0.261534,  0.261349,  0.261164,  0.260979,
-	 0.260794,  0.260609,  0.260424,  0.260239,  0.260054,  0.259868,  0.259683,  0.259498,
-	 0.259313,  0.259128,  0.258943,  0.258757,  0.258572,  0.258387,  0.258202,  0.258016,
-	 0.257831,  0.257646,  0.257461,  0.257275,  0.257090,  0.256905,  0.256719,  0.256534,
-	 0.256349,  0.256163,  0.255978,  0.255793,  0.255607,  0.255422,  0.255236,  0.255051,
-	 0.254866,  0.254680,  0.254495,  0.254309,  0.254124,  0.253938,  0.253753,  0.253568,
-	 0.253382,  0.253197,  0.253011,  0.252826,  0.252640,  0.252454,  0.252269,  0.252083,
-	 0.251898,  0.251712,  0.251527,  0.251341,  0.251155,  0.250970,  0.250784,  0.250599,
-	 0.250413,  0.250227,  0.250042,  0.249856,  0.249670,  0.249485,  0.249299,  0.249113,
-	 0.248928,  0.248742,  0.248556,  0.248370,  0.248185,  0.247999,  0.247813,  0.247627,
-	 0.247442,  0.247256,  0.247070,  0.246884,  0.246698,  0.246513,  0.246327,  0.246141,
-	 0.245955,  0.245769,  0.245583,  0.245397,  0.245212,  0.245026,  0.244840,  0.244654,
-	 0.244468,  0.244282,  0.244096,  0.243910,  0.243724,  0.243538,  0.243352,  0.243166,
-	 0.242980,  0.242794,  0.242608,  0.242422,  0.242236,  0.242050,  0.241864,  0.241678,
-	 0.241492,  0.241306,  0.241120,  0.240934,  0.240748,  0.240561,  0.240375,  0.240189,
-	 0.240003,  0.239817,  0.239631,  0.239445,  0.239258,  0.239072,  0.238886,  0.238700,
-	 0.238514,  0.238327,  0.238141,  0.237955,  0.237769,  0.237582,  0.237396,  0.237210,
-	 0.237024,  0.236837,  0.236651,  0.236465,  0.236278,  0.236092,  0.235906,  0.235719,
-	 0.235533,  0.235347,  0.235160,  0.234974,  0.234788,  0.234601,  0.234415,  0.234228,
-	 0.234042,  0.233856,  0.233669,  0.233483,  0.233296,  0.233110,  0.232923,  0.232737,
-	 0.232550,  0.232364,  0.232177,  0.231991,  0.231804,  0.231618,  0.231431,  0.231245,
-	 0.231058,  0.230872,  0.230685,  0.230498,  0.230312,  0.230125,  0.229939,  0.229752,
-	 0.229565,  0.229379,  0.229192,  0.229005,  0.228819,  0.228632,  0.228445,  0.228259,
-	 0.228072,  0.227885,  0.227699,  0.227512,  0.227325,  0.227139,  0.226952,  0.226765,
-	 0.226578,  0.226391,  0.226205,  0.226018,  0.225831,  0.225644,  0.225458,  0.225271,
-	 0.225084,  0.224897,  0.224710,  0.224523,  0.224337,  0.224150,  0.223963,  0.223776,
-	 0.223589,  0.223402,  0.223215,  0.223028,  0.222841,  0.222654,  0.222468,  0.222281,
-	 0.222094,  0.221907,  0.221720,  0.221533,  0.221346,  0.221159,  0.220972,  0.220785,
-	 0.220598,  0.220411,  0.220224,  0.220037,  0.219850,  0.219662,  0.219475,  0.219288,
-	 0.219101,  0.218914,  0.218727,  0.218540,  0.218353,  0.218166,  0.217979,  0.217791,
-	 0.217604,  0.217417,  0.217230,  0.217043,  0.216856,  0.216668,  0.216481,  0.216294,
-	 0.216107,  0.215920,  0.215732,  0.215545,  0.215358,  0.215171,  0.214983,  0.214796,
-	 0.214609,  0.214422,  0.214234,  0.214047,  0.213860,  0.213672,  0.213485,  0.213298,
-	 0.213110,  0.212923,  0.212736,  0.212548,  0.212361,  0.212174,  0.211986,  0.211799,
-	 0.211611,  0.211424,  0.211237,  0.211049,  0.210862,  0.210674,  0.210487,  0.210299,
-	 0.210112,  0.209924,  0.209737,  0.209549,  0.209362,  0.209174,  0.208987,  0.208799,
-	 0.208612,  0.208424,  0.208237,  0.208049,  0.207862,  0.207674,  0.207487,  0.207299,
-	 0.207111,  0.206924,  0.206736,  0.206549,  0.206361,  0.206173,  0.205986,  0.205798,
-	 0.205610,  0.205423,  0.205235,  0.205047,  0.204860,  0.204672,  0.204484,  0.204297,
-	 0.204109,  0.203921,  0.203734,  0.203546,  0.203358,  0.203170,  0.202983,  0.202795,
-	 0.202607,  0.202419,  0.202231,  0.202044,  0.201856,  0.201668,  0.201480,  0.201292,
-	 0.201105,  0.200917,  0.200729,  0.200541,  0.200353,  0.200165,  0.199978,  0.199790,
-	 0.199602,  0.199414,  0.199226,  0.199038,  0.198850,  0.198662,  0.198474,  0.198286,
-	 0.198098,  0.197910,  0.197722,  0.197535,  0.197347,  0.197159,  0.196971,  0.196783,
-	 0.196595,  0.196407,  0.196219,  0.196031,  0.195843,  0.195654,  0.195466,  0.195278,
-	 0.195090,  0.194902,  0.194714,  0.194526,  0.194338,  0.194150,  0.193962,  0.193774,
-	 0.193586,  0.193397,  0.193209,  0.193021,  0.192833,  0.192645,  0.192457,  0.192269,
-	 0.192080,  0.191892,  0.191704,  0.191516,  0.191328,  0.191139,  0.190951,  0.190763,
-	 0.190575,  0.190387,  0.190198,  0.190010,  0.189822,  0.189634,  0.189445,  0.189257,
-	 0.189069,  0.188880,  0.188692,  0.188504,  0.188315,  0.188127,  0.187939,  0.187750,
-	 0.187562,  0.187374,  0.187185,  0.186997,  0.186809,  0.186620,  0.186432,  0.186244,
-	 0.186055,  0.185867,  0.185678,  0.185490,  0.185301,  0.185113,  0.184925,  0.184736,
-	 0.184548,  0.184359,  0.184171,  0.183982,  0.183794,  0.183605,  0.183417,  0.183228,
-	 0.183040,  0.182851,  0.182663,  0.182474,  0.182286,  0.182097,  0.181909,  0.181720,
-	 0.181532,  0.181343,  0.181154,  0.180966,  0.180777,  0.180589,  0.180400,  0.180212,
-	 0.180023,  0.179834,  0.179646,  0.179457,  0.179268,  0.179080,  0.178891,  0.178702,
-	 0.178514,  0.178325,  0.178136,  0.177948,  0.177759,  0.177570,  0.177382,  0.177193,
-	 0.177004,  0.176815,  0.176627,  0.176438,  0.176249,  0.176061,  0.175872,  0.175683,
-	 0.175494,  0.175305,  0.175117,  0.174928,  0.174739,  0.174550,  0.174362,  0.174173,
-	 0.173984,  0.173795,  0.173606,  0.173417,  0.173229,  0.173040,  0.172851,  0.172662,
-	 0.172473,  0.172284,  0.172095,  0.171906,  0.171718,  0.171529,  0.171340,  0.171151,
-	 0.170962,  0.170773,  0.170584,  0.170395,  0.170206,  0.170017,  0.169828,  0.169639,
-	 0.169450,  0.169261,  0.169072,  0.168883,  0.168694,  0.168505,  0.168316,  0.168127,
-	 0.167938,  0.167749,  0.167560,  0.167371,  0.167182,  0.166993,  0.166804,  0.166615,
-	 0.166426,  0.166237,  0.166048,  0.165859,  0.165670,  0.165480,  0.165291,  0.165102,
-	 0.164913,  0.164724,  0.164535,  0.164346,  0.164157,  0.163967,  0.163778,  0.163589,
-	 0.163400,  0.163211,  0.163022,  0.162832,  0.162643,  0.162454,  0.162265,  0.162076,
-	 0.161886,  0.161697,  0.161508,  0.161319,  0.161129,  0.160940,  0.160751,  0.160562,
-	 0.160372,  0.160183,  0.159994,  0.159805,  0.159615,  0.159426,  0.159237,  0.159047,
-	 0.158858,  0.158669,  0.158480,  0.158290,  0.158101,  0.157912,  0.157722,  0.157533,
-	 0.157343,  0.157154,  0.156965,  0.156775,  0.156586,  0.156397,  0.156207,  0.156018,
-	 0.155828,  0.155639,  0.155450,  0.155260,  0.155071,  0.154881,  0.154692,  0.154502,
-	 0.154313,  0.154124,  0.153934,  0.153745,  0.153555,  0.153366,  0.153176,  0.152987,
-	 0.152797,  0.152608,  0.152418,  0.152229,  0.152039,  0.151850,  0.151660,  0.151471,
-	 0.151281,  0.151092,  0.150902,  0.150712,  0.150523,  0.150333,  0.150144,  0.149954,
-	 0.149765,  0.149575,  0.149385,  0.149196,  0.149006,  0.148817,  0.148627,  0.148437,
-	 0.148248,  0.148058,  0.147868,  0.147679,  0.147489,  0.147299,  0.147110,  0.146920,
-	 0.146730,  0.146541,  0.146351,  0.146161,  0.145972,  0.145782,  0.145592,  0.145403,
-	 0.145213,  0.145023,  0.144833,  0.144644,  0.144454,  0.144264,  0.144075,  0.143885,
-	 0.143695,  0.143505,  0.143316,  0.143126,  0.142936,  0.142746,  0.142556,  0.142367,
-	 0.142177,  0.141987,  0.141797,  0.141607,  0.141418,  0.141228,  0.141038,  0.140848,
-	 0.140658,  0.140468,  0.140279,  0.140089,  0.139899,  0.139709,  0.139519,  0.139329,
-	 0.139139,  0.138949,  0.138760,  0.138570,  0.138380,  0.138190,  0.138000,  0.137810,
-	 0.137620,  0.137430,  0.137240,  0.137050,  0.136860,  0.136670,  0.136480,  0.136291,
-	 0.136101,  0.135911,  0.135721,  0.135531,  0.135341,  0.135151,  0.134961,  0.134771,
-	 0.134581,  0.134391,  0.134201,  0.134011,  0.133821,  0.133631,  0.133441,  0.133251,
-	 0.133061,  0.132870,  0.132680,  0.132490,  0.132300,  0.132110,  0.131920,  0.131730,
-	 0.131540,  0.131350,  0.131160,  0.130970,  0.130780,  0.130590,  0.130399,  0.130209,
-	 0.130019,  0.129829,  0.129639,  0.129449,  0.129259,  0.129069,  0.128878,  0.128688,
-	 0.128498,  0.128308,  0.128118,  0.127928,  0.127737,  0.127547,  0.127357,  0.127167,
-	 0.126977,  0.126787,  0.126596,  0.126406,  0.126216,  0.126026,  0.125835,  0.125645,
-	 0.125455,  0.125265,  0.125075,  0.124884,  0.124694,  0.124504,  0.124314,  0.124123,
-	 0.123933,  0.123743,  0.123552,  0.123362,  0.123172,  0.122982,  0.122791,  0.122601,
-	 0.122411,  0.122220,  0.122030,  0.121840,  0.121649,  0.121459,  0.121269,  0.121078,
-	 0.120888,  0.120698,  0.120507,  0.120317,  0.120127,  0.119936,  0.119746,  0.119556,
-	 0.119365,  0.119175,  0.118984,  0.118794,  0.118604,  0.118413,  0.118223,  0.118032,
-	 0.117842,  0.117652,  0.117461,  0.117271,  0.117080,  0.116890,  0.116700,  0.116509,
-	 0.116319,  0.116128,  0.115938,  0.115747,  0.115557,  0.115366,  0.115176,  0.114985,
-	 0.114795,  0.114604,  0.114414,  0.114223,  0.114033,  0.113842,  0.113652,  0.113461,
-	 0.113271,  0.113080,  0.112890,  0.112699,  0.112509,  0.112318,  0.112128,  0.111937,
-	 0.111747,  0.111556,  0.111366,  0.111175,  0.110984,  0.110794,  0.110603,  0.110413,
-	 0.110222,  0.110032,  0.109841,  0.109650,  0.109460,  0.109269,  0.109079,  0.108888,
-	 0.108697,  0.108507,  0.108316,  0.108126,  0.107935,  0.107744,  0.107554,  0.107363,
-	 0.107172,  0.106982,  0.106791,  0.106600,  0.106410,  0.106219,  0.106028,  0.105838,
-	 0.105647,  0.105456,  0.105266,  0.105075,  0.104884,  0.104694,  0.104503,  0.104312,
-	 0.104122,  0.103931,  0.103740,  0.103550,  0.103359,  0.103168,  0.102977,  0.102787,
-	 0.102596,  0.102405,  0.102214,  0.102024,  0.101833,  0.101642,  0.101451,  0.101261,
-	 0.101070,  0.100879,  0.100688,  0.100498,  0.100307,  0.100116,  0.099925,  0.099734,
-	 0.099544,  0.099353,  0.099162,  0.098971,  0.098780,  0.098590,  0.098399,  0.098208,
-	 0.098017,  0.097826,  0.097635,  0.097445,  0.097254,  0.097063,  0.096872,  0.096681,
-	 0.096490,  0.096300,  0.096109,  0.095918,  0.095727,  0.095536,  0.095345,  0.095154,
-	 0.094963,  0.094773,  0.094582,  0.094391,  0.094200,  0.094009,  0.093818,  0.093627,
-	 0.093436,  0.093245,  0.093055,  0.092864,  0.092673,  0.092482,  0.092291,  0.092100,
-	 0.091909,  0.091718,  0.091527,  0.091336,  0.091145,  0.090954,  0.090763,  0.090572,
-	 0.090381,  0.090190,  0.089999,  0.089808,  0.089617,  0.089427,  0.089236,  0.089045,
-	 0.088854,  0.088663,  0.088472,  0.088281,  0.088090,  0.087899,  0.087708,  0.087517,
-	 0.087326,  0.087135,  0.086943,  0.086752,  0.086561,  0.086370,  0.086179,  0.085988,
-	 0.085797,  0.085606,  0.085415,  0.085224,  0.085033,  0.084842,  0.084651,  0.084460,
-	 0.084269,  0.084078,  0.083887,  0.083696,  0.083505,  0.083314,  0.083122,  0.082931,
-	 0.082740,  0.082549,  0.082358,  0.082167,  0.081976,  0.081785,  0.081594,  0.081403,
-	 0.081211,  0.081020,  0.080829,  0.080638,  0.080447,  0.080256,  0.080065,  0.079874,
-	 0.079682,  0.079491,  0.079300,  0.079109,  0.078918,  0.078727,  0.078536,  0.078344,
-	 0.078153,  0.077962,  0.077771,  0.077580,  0.077389,  0.077197,  0.077006,  0.076815,
-	 0.076624,  0.076433,  0.076241,  0.076050,  0.075859,  0.075668,  0.075477,  0.075286,
-	 0.075094,  0.074903,  0.074712,  0.074521,  0.074329,  0.074138,  0.073947,  0.073756,
-	 0.073565,  0.073373,  0.073182,  0.072991,  0.072800,  0.072608,  0.072417,  0.072226,
-	 0.072035,  0.071843,  0.071652,  0.071461,  0.071270,  0.071078,  0.070887,  0.070696,
-	 0.070505,  0.070313,  0.070122,  0.069931,  0.069739,  0.069548,  0.069357,  0.069166,
-	 0.068974,  0.068783,  0.068592,  0.068400,  0.068209,  0.068018,  0.067827,  0.067635,
-	 0.067444,  0.067253,  0.067061,  0.066870,  0.066679,  0.066487,  0.066296,  0.066105,
-	 0.065913,  0.065722,  0.065531,  0.065339,  0.065148,  0.064957,  0.064765,  0.064574,
-	 0.064383,  0.064191,  0.064000,  0.063809,  0.063617,  0.063426,  0.063234,  0.063043,
-	 0.062852,  0.062660,  0.062469,  0.062278,  0.062086,  0.061895,  0.061704,  0.061512,
-	 0.061321,  0.061129,  0.060938,  0.060747,  0.060555,  0.060364,  0.060172,  0.059981,
-	 0.059790,  0.059598,  0.059407,  0.059215,  0.059024,  0.058833,  0.058641,  0.058450,
-	 0.058258,  0.058067,  0.057875,  0.057684,  0.057493,  0.057301,  0.057110,  0.056918,
-	 0.056727,  0.056535,  0.056344,  0.056152,  0.055961,  0.055770,  0.055578,  0.055387,
-	 0.055195,  0.055004,  0.054812,  0.054621,  0.054429,  0.054238,  0.054046,  0.053855,
-	 0.053664,  0.053472,  0.053281,  0.053089,  0.052898,  0.052706,  0.052515,  0.052323,
-	 0.052132,  0.051940,  0.051749,  0.051557,  0.051366,  0.051174,  0.050983,  0.050791,
-	 0.050600,  0.050408,  0.050217,  0.050025,  0.049834,  0.049642,  0.049451,  0.049259,
-	 0.049068,  0.048876,  0.048685,  0.048493,  0.048302,  0.048110,  0.047919,  0.047727,
-	 0.047535,  0.047344,  0.047152,  0.046961,  0.046769,  0.046578,  0.046386,  0.046195,
-	 0.046003,  0.045812,  0.045620,  0.045429,  0.045237,  0.045045,  0.044854,  0.044662,
-	 0.044471,  0.044279,  0.044088,  0.043896,  0.043705,  0.043513,  0.043321,  0.043130,
-	 0.042938,  0.042747,  0.042555,  0.042364,  0.042172,  0.041980,  0.041789,  0.041597,
-	 0.041406,  0.041214,  0.041022,  0.040831,  0.040639,  0.040448,  0.040256,  0.040065,
-	 0.039873,  0.039681,  0.039490,  0.039298,  0.039107,  0.038915,  0.038723,  0.038532,
-	 0.038340,  0.038149,  0.037957,  0.037765,  0.037574,  0.037382,  0.037190,  0.036999,
-	 0.036807,  0.036616,  0.036424,  0.036232,  0.036041,  0.035849,  0.035657,  0.035466,
-	 0.035274,  0.035083,  0.034891,  0.034699,  0.034508,  0.034316,  0.034124,  0.033933,
-	 0.033741,  0.033550,  0.033358,  0.033166,  0.032975,  0.032783,  0.032591,  0.032400,
-	 0.032208,  0.032016,  0.031825,  0.031633,  0.031441,  0.031250,  0.031058,  0.030866,
-	 0.030675,  0.030483,  0.030291,  0.030100,  0.029908,  0.029717,  0.029525,  0.029333,
-	 0.029142,  0.028950,  0.028758,  0.028567,  0.028375,  0.028183,  0.027991,  0.027800,
-	 0.027608,  0.027416,  0.027225,  0.027033,  0.026841,  0.026650,  0.026458,  0.026266,
-	 0.026075,  0.025883,  0.025691,  0.025500,  0.025308,  0.025116,  0.024925,  0.024733,
-	 0.024541,  0.024350,  0.024158,  0.023966,  0.023774,  0.023583,  0.023391,  0.023199,
-	 0.023008,  0.022816,  0.022624,  0.022433,  0.022241,  0.022049,  0.021857,  0.021666,
-	 0.021474,  0.021282,  0.021091,  0.020899,  0.020707,  0.020516,  0.020324,  0.020132,
-	 0.019940,  0.019749,  0.019557,  0.019365,  0.019174,  0.018982,  0.018790,  0.018598,
-	 0.018407,  0.018215,  0.018023,  0.017832,  0.017640,  0.017448,  0.017256,  0.017065,
-	 0.016873,  0.016681,  0.016490,  0.016298,  0.016106,  0.015914,  0.015723,  0.015531,
-	 0.015339,  0.015147,  0.014956,  0.014764,  0.014572,  0.014381,  0.014189,  0.013997,
-	 0.013805,  0.013614,  0.013422,  0.013230,  0.013038,  0.012847,  0.012655,  0.012463,
-	 0.012272,  0.012080,  0.011888,  0.011696,  0.011505,  0.011313,  0.011121,  0.010929,
-	 0.010738,  0.010546,  0.010354,  0.010162,  0.009971,  0.009779,  0.009587,  0.009395,
-	 0.009204,  0.009012,  0.008820,  0.008629,  0.008437,  0.008245,  0.008053,  0.007862,
-	 0.007670,  0.007478,  0.007286,  0.007095,  0.006903,  0.006711,  0.006519,  0.006328,
-	 0.006136,  0.005944,  0.005752,  0.005561,  0.005369,  0.005177,  0.004985,  0.004794,
-	 0.004602,  0.004410,  0.004218,  0.004027,  0.003835,  0.003643,  0.003451,  0.003260,
-	 0.003068,  0.002876,  0.002684,  0.002493,  0.002301,  0.002109,  0.001917,  0.001726,
-	 0.001534,  0.001342,  0.001150,  0.000959,  0.000767,  0.000575,  0.000383,  0.000192,
-	 0.000000,  0.000192,  0.000383,  0.000575,  0.000767,  0.000959,  0.001150,  0.001342,
-	 0.001534,  0.001726,  0.001917,  0.002109,  0.002301,  0.002493,  0.002684,  0.002876,
-	 0.003068,  0.003260,  0.003451,  0.003643,  0.003835,  0.004027,  0.004218,  0.004410,
-	 0.004602,  0.004794,  0.004985,  0.005177,  0.005369,  0.005561,  0.005752,  0.005944,
-	 0.006136,  0.006328,  0.006519,  0.006711,  0.006903,  0.007095,  0.007286,  0.007478,
-	 0.007670,  0.007862,  0.008053,  0.008245,  0.008437,  0.008629,  0.008820,  0.009012,
-	 0.009204,  0.009395,  0.009587,  0.009779,  0.009971,  0.010162,  0.010354,  0.010546,
-	 0.010738,  0.010929,  0.011121,  0.011313,  0.011505,  0.011696,  0.011888,  0.012080,
-	 0.012272,  0.012463,  0.012655,  0.012847,  0.013038,  0.013230,  0.013422,  0.013614,
-	 0.013805,  0.013997,  0.014189,  0.014381,  0.014572,  0.014764,  0.014956,  0.015147,
-	 0.015339,  0.015531,  0.015723,  0.015914,  0.016106,  0.016298,  0.016490,  0.016681,
-	 0.016873,  0.017065,  0.017256,  0.017448,  0.017640,  0.017832,  0.018023,  0.018215,
-	 0.018407,  0.018598,  0.018790,  0.018982,  0.019174,  0.019365,  0.019557,  0.019749,
-	 0.019940,  0.020132,  0.020324,  0.020516,  0.020707,  0.020899,  0.021091,  0.021282,
-	 0.021474,  0.021666,  0.021857,  0.022049,  0.022241,  0.022433,  0.022624,  0.022816,
-	 0.023008,  0.023199,  0.023391,  0.023583,  0.023774,  0.023966,  0.024158,  0.024350,
-	 0.024541,  0.024733,  0.024925,  0.025116,  0.025308,  0.025500,  0.025691,  0.025883,
-	 0.026075,  0.026266,  0.026458,  0.026650,  0.026841,  0.027033,  0.027225,  0.027416,
-	 0.027608,  0.027800,  0.027991,  0.028183,  0.028375,  0.028567,  0.028758,  0.028950,
-	 0.029142,  0.029333,  0.029525,  0.029717,  0.029908,  0.030100,  0.030291,  0.030483,
-	 0.030675,  0.030866,  0.031058,  0.031250,  0.031441,  0.031633,  0.031825,  0.032016,
-	 0.032208,  0.032400,  0.032591,  0.032783,  0.032975,  0.033166,  0.033358,  0.033550,
-	 0.033741,  0.033933,  0.034124,  0.034316,  0.034508,  0.034699,  0.034891,  0.035083,
-	 0.035274,  0.035466,  0.035657,  0.035849,  0.036041,  0.036232,  0.036424,  0.036616,
-	 0.036807,  0.036999,  0.037190,  0.037382,  0.037574,  0.037765,  0.037957,  0.038149,
-	 0.038340,  0.038532,  0.038723,  0.038915,  0.039107,  0.039298,  0.039490,  0.039681,
-	 0.039873,  0.040065,  0.040256,  0.040448,  0.040639,  0.040831,  0.041022,  0.041214,
-	 0.041406,  0.041597,  0.041789,  0.041980,  0.042172,  0.042364,  0.042555,  0.042747,
-	 0.042938,  0.043130,  0.043321,  0.043513,  0.043705,  0.043896,  0.044088,  0.044279,
-	 0.044471,  0.044662,  0.044854,  0.045045,  0.045237,  0.045429,  0.045620,  0.045812,
-	 0.046003,  0.046195,  0.046386,  0.046578,  0.046769,  0.046961,  0.047152,  0.047344,
-	 0.047535,  0.047727,  0.047919,  0.048110,  0.048302,  0.048493,  0.048685,  0.048876,
-	 0.049068,  0.049259,  0.049451,  0.049642,  0.049834,  0.050025,  0.050217,  0.050408,
-	 0.050600,  0.050791,  0.050983,  0.051174,  0.051366,  0.051557,  0.051749,  0.051940,
-	 0.052132,  0.052323,  0.052515,  0.052706,  0.052898,  0.053089,  0.053281,  0.053472,
-	 0.053664,  0.053855,  0.054046,  0.054238,  0.054429,  0.054621,  0.054812,  0.055004,
-	 0.055195,  0.055387,  0.055578,  0.055770,  0.055961,  0.056152,  0.056344,  0.056535,
-	 0.056727,  0.056918,  0.057110,  0.057301,  0.057493,  0.057684,  0.057875,  0.058067,
-	 0.058258,  0.058450,  0.058641,  0.058833,  0.059024,  0.059215,  0.059407,  0.059598,
-	 0.059790,  0.059981,  0.060172,  0.060364,  0.060555,  0.060747,  0.060938,  0.061129,
-	 0.061321,  0.061512,  0.061704,  0.061895,  0.062086,  0.062278,  0.062469,  0.062660,
-	 0.062852,  0.063043,  0.063234,  0.063426,  0.063617,  0.063809,  0.064000,  0.064191,
-	 0.064383,  0.064574,  0.064765,  0.064957,  0.065148,  0.065339,  0.065531,  0.065722,
-	 0.065913,  0.066105,  0.066296,  0.066487,  0.066679,  0.066870,  0.067061,  0.067253,
-	 0.067444,  0.067635,  0.067827,  0.068018,  0.068209,  0.068400,  0.068592,  0.068783,
-	 0.068974,  0.069166,  0.069357,  0.069548,  0.069739,  0.069931,  0.070122,  0.070313,
-	 0.070505,  0.070696,  0.070887,  0.071078,  0.071270,  0.071461,  0.071652,  0.071843,
-	 0.072035,  0.072226,  0.072417,  0.072608,  0.072800,  0.072991,  0.073182,  0.073373,
-	 0.073565,  0.073756,  0.073947,  0.074138,  0.074329,  0.074521,  0.074712,  0.074903,
-	 0.075094,  0.075286,  0.075477,  0.075668,  0.075859,  0.076050,  0.076241,  0.076433,
-	 0.076624,  0.076815,  0.077006,  0.077197,  0.077389,  0.077580,  0.077771,  0.077962,
-	 0.078153,  0.078344,  0.078536,  0.078727,  0.078918,  0.079109,  0.079300,  0.079491,
-	 0.079682,  0.079874,  0.080065,  0.080256,  0.080447,  0.080638,  0.080829,  0.081020,
-	 0.081211,  0.081403,  0.081594,  0.081785,  0.081976,  0.082167,  0.082358,  0.082549,
-	 0.082740,  0.082931,  0.083122,  0.083314,  0.083505,  0.083696,  0.083887,  0.084078,
-	 0.084269,  0.084460,  0.084651,  0.084842,  0.085033,  0.085224,  0.085415,  0.085606,
-	 0.085797,  0.085988,  0.086179,  0.086370,  0.086561,  0.086752,  0.086943,  0.087135,
-	 0.087326,  0.087517,  0.087708,  0.087899,  0.088090,  0.088281,  0.088472,  0.088663,
-	 0.088854,  0.089045,  0.089236,  0.089427,  0.089617,  0.089808,  0.089999,  0.090190,
-	 0.090381,  0.090572,  0.090763,  0.090954,  0.091145,  0.091336,  0.091527,  0.091718,
-	 0.091909,  0.092100,  0.092291,  0.092482,  0.092673,  0.092864,  0.093055,  0.093245,
-	 0.093436,  0.093627,  0.093818,  0.094009,  0.094200,  0.094391,  0.094582,  0.094773,
-	 0.094963,  0.095154,  0.095345,  0.095536,  0.095727,  0.095918,  0.096109,  0.096300,
-	 0.096490,  0.096681,  0.096872,  0.097063,  0.097254,  0.097445,  0.097635,  0.097826,
-	 0.098017,  0.098208,  0.098399,  0.098590,  0.098780,  0.098971,  0.099162,  0.099353,
-	 0.099544,  0.099734,  0.099925,  0.100116,  0.100307,  0.100498,  0.100688,  0.100879,
-	 0.101070,  0.101261,  0.101451,  0.101642,  0.101833,  0.102024,  0.102214,  0.102405,
-	 0.102596,  0.102787,  0.102977,  0.103168,  0.103359,  0.103550,  0.103740,  0.103931,
-	 0.104122,  0.104312,  0.104503,  0.104694,  0.104884,  0.105075,  0.105266,  0.105456,
-	 0.105647,  0.105838,  0.106028,  0.106219,  0.106410,  0.106600,  0.106791,  0.106982,
-	 0.107172,  0.107363,  0.107554,  0.107744,  0.107935,  0.108126,  0.108316,  0.108507,
-	 0.108697,  0.108888,  0.109079,  0.109269,  0.109460,  0.109650,  0.109841,  0.110032,
-	 0.110222,  0.110413,  0.110603,  0.110794,  0.110984,  0.111175,  0.111366,  0.111556,
-	 0.111747,  0.111937,  0.112128,  0.112318,  0.112509,  0.112699,  0.112890,  0.113080,
-	 0.113271,  0.113461,  0.113652,  0.113842,  0.114033,  0.114223,  0.114414,  0.114604,
-	 0.114795,  0.114985,  0.115176,  0.115366,  0.115557,  0.115747,  0.115938,  0.116128,
-	 0.116319,  0.116509,  0.116700,  0.116890,  0.117080,  0.117271,  0.117461,  0.117652,
-	 0.117842,  0.118032,  0.118223,  0.118413,  0.118604,  0.118794,  0.118984,  0.119175,
-	 0.119365,  0.119556,  0.119746,  0.119936,  0.120127,  0.120317,  0.120507,  0.120698,
-	 0.120888,  0.121078,  0.121269,  0.121459,  0.121649,  0.121840,  0.122030,  0.122220,
-	 0.122411,  0.122601,  0.122791,  0.122982,  0.123172,  0.123362,  0.123552,  0.123743,
-	 0.123933,  0.124123,  0.124314,  0.124504,  0.124694,  0.124884,  0.125075,  0.125265,
-	 0.125455,  0.125645,  0.125835,  0.126026,  0.126216,  0.126406,  0.126596,  0.126787,
-	 0.126977,  0.127167,  0.127357,  0.127547,  0.127737,  0.127928,  0.128118,  0.128308,
-	 0.128498,  0.128688,  0.128878,  0.129069,  0.129259,  0.129449,  0.129639,  0.129829,
-	 0.130019,  0.130209,  0.130399,  0.130590,  0.130780,  0.130970,  0.131160,  0.131350,
-	 0.131540,  0.131730,  0.131920,  0.132110,  0.132300,  0.132490,  0.132680,  0.132870,
-	 0.133061,  0.133251,  0.133441,  0.133631,  0.133821,  0.134011,  0.134201,  0.134391,
-	 0.134581,  0.134771,  0.134961,  0.135151,  0.135341,  0.135531,  0.135721,  0.135911,
-	 0.136101,  0.136291,  0.136480,  0.136670,  0.136860,  0.137050,  0.137240,  0.137430,
-	 0.137620,  0.137810,  0.138000,  0.138190,  0.138380,  0.138570,  0.138760,  0.138949,
-	 0.139139,  0.139329,  0.139519,  0.139709,  0.139899,  0.140089,  0.140279,  0.140468,
-	 0.140658,  0.140848,  0.141038,  0.141228,  0.141418,  0.141607,  0.141797,  0.141987,
-	 0.142177,  0.142367,  0.142556,  0.142746,  0.142936,  0.143126,  0.143316,  0.143505,
-	 0.143695,  0.143885,  0.144075,  0.144264,  0.144454,  0.144644,  0.144833,  0.145023,
-	 0.145213,  0.145403,  0.145592,  0.145782,  0.145972,  0.146161,  0.146351,  0.146541,
-	 0.146730,  0.146920,  0.147110,  0.147299,  0.147489,  0.147679,  0.147868,  0.148058,
-	 0.148248,  0.148437,  0.148627,  0.148817,  0.149006,  0.149196,  0.149385,  0.149575,
-	 0.149765,  0.149954,  0.150144,  0.150333,  0.150523,  0.150712,  0.150902,  0.151092,
-	 0.151281,  0.151471,  0.151660,  0.151850,  0.152039,  0.152229,  0.152418,  0.152608,
-	 0.152797,  0.152987,  0.153176,  0.153366,  0.153555,  0.153745,  0.153934,  0.154124,
-	 0.154313,  0.154502,  0.154692,  0.154881,  0.155071,  0.155260,  0.155450,  0.155639,
-	 0.155828,  0.156018,  0.156207,  0.156397,  0.156586,  0.156775,  0.156965,  0.157154,
-	 0.157343,  0.157533,  0.157722,  0.157912,  0.158101,  0.158290,  0.158480,  0.158669,
-	 0.158858,  0.159047,  0.159237,  0.159426,  0.159615,  0.159805,  0.159994,  0.160183,
-	 0.160372,  0.160562,  0.160751,  0.160940,  0.161129,  0.161319,  0.161508,  0.161697,
-	 0.161886,  0.162076,  0.162265,  0.162454,  0.162643,  0.162832,  0.163022,  0.163211,
-	 0.163400,  0.163589,  0.163778,  0.163967,  0.164157,  0.164346,  0.164535,  0.164724,
-	 0.164913,  0.165102,  0.165291,  0.165480,  0.165670,  0.165859,  0.166048,  0.166237,
-	 0.166426,  0.166615,  0.166804,  0.166993,  0.167182,  0.167371,  0.167560,  0.167749,
-	 0.167938,  0.168127,  0.168316,  0.168505,  0.168694,  0.168883,  0.169072,  0.169261,
-	 0.169450,  0.169639,  0.169828,  0.170017,  0.170206,  0.170395,  0.170584,  0.170773,
-	 0.170962,  0.171151,  0.171340,  0.171529,  0.171718,  0.171906,  0.172095,  0.172284,
-	 0.172473,  0.172662,  0.172851,  0.173040,  0.173229,  0.173417,  0.173606,  0.173795,
-	 0.173984,  0.174173,  0.174362,  0.174550,  0.174739,  0.174928,  0.175117,  0.175305,
-	 0.175494,  0.175683,  0.175872,  0.176061,  0.176249,  0.176438,  0.176627,  0.176815,
-	 0.177004,  0.177193,  0.177382,  0.177570,  0.177759,  0.177948,  0.178136,  0.178325,
-	 0.178514,  0.178702,  0.178891,  0.179080,  0.179268,  0.179457,  0.179646,  0.179834,
-	 0.180023,  0.180212,  0.180400,  0.180589,  0.180777,  0.180966,  0.181154,  0.181343,
-	 0.181532,  0.181720,  0.181909,  0.182097,  0.182286,  0.182474,  0.182663,  0.182851,
-	 0.183040,  0.183228,  0.183417,  0.183605,  0.183794,  0.183982,  0.184171,  0.184359,
-	 0.184548,  0.184736,  0.184925,  0.185113,  0.185301,  0.185490,  0.185678,  0.185867,
-	 0.186055,  0.186244,  0.186432,  0.186620,  0.186809,  0.186997,  0.187185,  0.187374,
-	 0.187562,  0.187750,  0.187939,  0.188127,  0.188315,  0.188504,  0.188692,  0.188880,
-	 0.189069,  0.189257,  0.189445,  0.189634,  0.189822,  0.190010,  0.190198,  0.190387,
-	 0.190575,  0.190763,  0.190951,  0.191139,  0.191328,  0.191516,  0.191704,  0.191892,
-	 0.192080,  0.192269,  0.192457,  0.192645,  0.192833,  0.193021,  0.193209,  0.193397,
-	 0.193586,  0.193774,  0.193962,  0.194150,  0.194338,  0.194526,  0.194714,  0.194902,
-	 0.195090,  0.195278,  0.195466,  0.195654,  0.195843,  0.196031,  0.196219,  0.196407,
-	 0.196595,  0.196783,  0.196971,  0.197159,  0.197347,  0.197535,  0.197722,  0.197910,
-	 0.198098,  0.198286,  0.198474,  0.198662,  0.198850,  0.199038,  0.199226,  0.199414,
-	 0.199602,  0.199790,  0.199978,  0.200165,  0.200353,  0.200541,  0.200729,  0.200917,
-	 0.201105,  0.201292,  0.201480,  0.201668,  0.201856,  0.202044,  0.202231,  0.202419,
-	 0.202607,  0.202795,  0.202983,  0.203170,  0.203358,  0.203546,  0.203734,  0.203921,
-	 0.204109,  0.204297,  0.204484,  0.204672,  0.204860,  0.205047,  0.205235,  0.205423,
-	 0.205610,  0.205798,  0.205986,  0.206173,  0.206361,  0.206549,  0.206736,  0.206924,
-	 0.207111,  0.207299,  0.207487,  0.207674,  0.207862,  0.208049,  0.208237,  0.208424,
-	 0.208612,  0.208799,  0.208987,  0.209174,  0.209362,  0.209549,  0.209737,  0.209924,
-	 0.210112,  0.210299,  0.210487,  0.210674,  0.210862,  0.211049,  0.211237,  0.211424,
-	 0.211611,  0.211799,  0.211986,  0.212174,  0.212361,  0.212548,  0.212736,  0.212923,
-	 0.213110,  0.213298,  0.213485,  0.213672,  0.213860,  0.214047,  0.214234,  0.214422,
-	 0.214609,  0.214796,  0.214983,  0.215171,  0.215358,  0.215545,  0.215732,  0.215920,
-	 0.216107,  0.216294,  0.216481,  0.216668,  0.216856,  0.217043,  0.217230,  0.217417,
-	 0.217604,  0.217791,  0.217979,  0.218166,  0.218353,  0.218540,  0.218727,  0.218914,
-	 0.219101,  0.219288,  0.219475,  0.219662,  0.219850,  0.220037,  0.220224,  0.220411,
-	 0.220598,  0.220785,  0.220972,  0.221159,  0.221346,  0.221533,  0.221720,  0.221907,
-	 0.222094,  0.222281,  0.222468,  0.222654,  0.222841,  0.223028,  0.223215,  0.223402,
-	 0.223589,  0.223776,  0.223963,  0.224150,  0.224337,  0.224523,  0.224710,  0.224897,
-	 0.225084,  0.225271,  0.225458,  0.225644,  0.225831,  0.226018,  0.226205,  0.226391,
-	 0.226578,  0.226765,  0.226952,  0.227139,  0.227325,  0.227512,  0.227699,  0.227885,
-	 0.228072,  0.228259,  0.228445,  0.228632,  0.228819,  0.229005,  0.229192,  0.229379,
-	 0.229565,  0.229752,  0.229939,  0.230125,  0.230312,  0.230498,  0.230685,  0.230872,
-	 0.231058,  0.231245,  0.231431,  0.231618,  0.231804,  0.231991,  0.232177,  0.232364,
-	 0.232550,  0.232737,  0.232923,  0.233110,  0.233296,  0.233483,  0.233669,  0.233856,
-	 0.234042,  0.234228,  0.234415,  0.234601,  0.234788,  0.234974,  0.235160,  0.235347,
-	 0.235533,  0.235719,  0.235906,  0.236092,  0.236278,  0.236465,  0.236651,  0.236837,
-	 0.237024,  0.237210,  0.237396,  0.237582,  0.237769,  0.237955,  0.238141,  0.238327,
-	 0.238514,  0.238700,  0.238886,  0.239072,  0.239258,  0.239445,  0.239631,  0.239817,
-	 0.240003,  0.240189,  0.240375,  0.240561,  0.240748,  0.240934,  0.241120,  0.241306,
-	 0.241492,  0.241678,  0.241864,  0.242050,  0.242236,  0.242422,  0.242608,  0.242794,
-	 0.242980,  0.243166,  0.243352,  0.243538,  0.243724,  0.243910,  0.244096,  0.244282,
-	 0.244468,  0.244654,  0.244840,  0.245026,  0.245212,  0.245397,  0.245583,  0.245769,
-	 0.245955,  0.246141,  0.246327,  0.246513,  0.246698,  0.246884,  0.247070,  0.247256,
-	 0.247442,  0.247627,  0.247813,  0.247999,  0.248185,  0.248370,  0.248556,  0.248742,
-	 0.248928,  0.249113,  0.249299,  0.249485,  0.249670,  0.249856,  0.250042,  0.250227,
-	 0.250413,  0.250599,  0.250784,  0.250970,  0.251155,  0.251341,  0.251527,  0.251712,
-	 0.251898,  0.252083,  0.252269,  0.252454,  0.252640,  0.252826,  0.253011,  0.253197,
-	 0.253382,  0.253568,  0.253753,  0.253938,  0.254124,  0.254309,  0.254495,  0.254680,
-	 0.254866,  0.255051,  0.255236,  0.255422,  0.255607,  0.255793,  0.255978,  0.256163,
-	 0.256349,  0.256534,  0.256719,  0.256905,  0.257090,  0.257275,  0.257461,  0.257646,
-	 0.257831,  0.258016,  0.258202,  0.258387,  0.258572,  0.258757,  0.258943,  0.259128,
-	 0.259313,  0.259498,  0.259683,  0.259868,  0.260054,  0.260239,  0.260424,  0.260609,
-	 0.260794,  0.260979,  0.261164,  0.261349,  0.261534,  0.261720,  0.261905,  0.262090,
-	 0.262275,  0.262460,  0.262645,  0.262830,  0.263015,  0.263200,  0.263385,  0.263570,
-	 0.263755,  0.263940,  0.264125,  0.264309,  0.264494,  0.264679,  0.264864,  0.265049,
-	 0.265234,  0.265419,  0.265604,  0.265789,  0.265973,  0.266158,  0.266343,  0.266528,
-	 0.266713,  0.266898,  0.267082,  0.267267,  0.267452,  0.267637,  0.267821,  0.268006,
-	 0.268191,  0.268376,  0.268560,  0.268745,  0.268930,  0.269114,  0.269299,  0.269484,
-	 0.269668,  0.269853,  0.270038,  0.270222,  0.270407,  0.270591,  0.270776,  0.270961,
-	 0.271145,  0.271330,  0.271514,  0.271699,  0.271883,  0.272068,  0.272252,  0.272437,
-	 0.272621,  0.272806,  0.272990,  0.273175,  0.273359,  0.273544,  0.273728,  0.273912,
-	 0.274097,  0.274281,  0.274466,  0.274650,  0.274834,  0.275019,  0.275203,  0.275387,
-	 0.275572,  0.275756,  0.275940,  0.276125,  0.276309,  0.276493,  0.276678,  0.276862,
-	 0.277046,  0.277230,  0.277415,  0.277599,  0.277783,  0.277967,  0.278151,  0.278336,
-	 0.278520,  0.278704,  0.278888,  0.279072,  0.279256,  0.279440,  0.279624,  0.279809,
-	 0.279993,  0.280177,  0.280361,  0.280545,  0.280729,  0.280913,  0.281097,  0.281281,
-	 0.281465,  0.281649,  0.281833,  0.282017,  0.282201,  0.282385,  0.282569,  0.282753,
-	 0.282937,  0.283120,  0.283304,  0.283488,  0.283672,  0.283856,  0.284040,  0.284224,
-	 0.284408,  0.284591,  0.284775,  0.284959,  0.285143,  0.285327,  0.285510,  0.285694,
-	 0.285878,  0.286062,  0.286245,  0.286429,  0.286613,  0.286796,  0.286980,  0.287164,
-	 0.287347,  0.287531,  0.287715,  0.287898,  0.288082,  0.288266,  0.288449,  0.288633,
-	 0.288816,  0.289000,  0.289184,  0.289367,  0.289551,  0.289734,  0.289918,  0.290101,
-	 0.290285,  0.290468,  0.290652,  0.290835,  0.291019,  0.291202,  0.291385,  0.291569,
-	 0.291752,  0.291936,  0.292119,  0.292302,  0.292486,  0.292669,  0.292852,  0.293036,
-	 0.293219,  0.293402,  0.293586,  0.293769,  0.293952,  0.294136,  0.294319,  0.294502,
-	 0.294685,  0.294869,  0.295052,  0.295235,  0.295418,  0.295601,  0.295785,  0.295968,
-	 0.296151,  0.296334,  0.296517,  0.296700,  0.296883,  0.297066,  0.297250,  0.297433,
-	 0.297616,  0.297799,  0.297982,  0.298165,  0.298348,  0.298531,  0.298714,  0.298897,
-	 0.299080,  0.299263,  0.299446,  0.299629,  0.299812,  0.299995,  0.300177,  0.300360,
-	 0.300543,  0.300726,  0.300909,  0.301092,  0.301275,  0.301458,  0.301640,  0.301823,
-	 0.302006,  0.302189,  0.302372,  0.302554,  0.302737,  0.302920,  0.303103,  0.303285,
-	 0.303468,  0.303651,  0.303833,  0.304016,  0.304199,  0.304381,  0.304564,  0.304747,
-	 0.304929,  0.305112,  0.305294,  0.305477,  0.305660,  0.305842,  0.306025,  0.306207,
-	 0.306390,  0.306572,  0.306755,  0.306937,  0.307120,  0.307302,  0.307485,  0.307667,
-	 0.307850,  0.308032,  0.308214,  0.308397,  0.308579,  0.308762,  0.308944,  0.309126,
-	 0.309309,  0.309491,  0.309673,  0.309856,  0.310038,  0.310220,  0.310403,  0.310585,
-	 0.310767,  0.310949,  0.311132,  0.311314,  0.311496,  0.311678,  0.311860,  0.312043,
-	 0.312225,  0.312407,  0.312589,  0.312771,  0.312953,  0.313135,  0.313318,  0.313500,
-	 0.313682,  0.313864,  0.314046,  0.314228,  0.314410,  0.314592,  0.314774,  0.314956,
-	 0.315138,  0.315320,  0.315502,  0.315684,  0.315866,  0.316048,  0.316230,  0.316411,
-	 0.316593,  0.316775,  0.316957,  0.317139,  0.317321,  0.317503,  0.317684,  0.317866,
-	 0.318048,  0.318230,  0.318412,  0.318593,  0.318775,  0.318957,  0.319139,  0.319320,
-	 0.319502,  0.319684,  0.319865,  0.320047,  0.320229,  0.320410,  0.320592,  0.320774,
-	 0.320955,  0.321137,  0.321318,  0.321500,  0.321682,  0.321863,  0.322045,  0.322226,
-	 0.322408,  0.322589,  0.322771,  0.322952,  0.323134,  0.323315,  0.323497,  0.323678,
-	 0.323859,  0.324041,  0.324222,  0.324404,  0.324585,  0.324766,  0.324948,  0.325129,
-	 0.325310,  0.325492,  0.325673,  0.325854,  0.326035,  0.326217,  0.326398,  0.326579,
-	 0.326760,  0.326942,  0.327123,  0.327304,  0.327485,  0.327666,  0.327848,  0.328029,
-	 0.328210,  0.328391,  0.328572,  0.328753,  0.328934,  0.329115,  0.329296,  0.329477,
-	 0.329658,  0.329839,  0.330020,  0.330202,  0.330382,  0.330563,  0.330744,  0.330925,
-	 0.331106,  0.331287,  0.331468,  0.331649,  0.331830,  0.332011,  0.332192,  0.332373,
-	 0.332553,  0.332734,  0.332915,  0.333096,  0.333277,  0.333457,  0.333638,  0.333819,
-	 0.334000,  0.334180,  0.334361,  0.334542,  0.334722,  0.334903,  0.335084,  0.335265,
-	 0.335445,  0.335626,  0.335806,  0.335987,  0.336168,  0.336348,  0.336529,  0.336709,
-	 0.336890,  0.337070,  0.337251,  0.337431,  0.337612,  0.337792,  0.337973,  0.338153,
-	 0.338334,  0.338514,  0.338695,  0.338875,  0.339055,  0.339236,  0.339416,  0.339597,
-	 0.339777,  0.339957,  0.340138,  0.340318,  0.340498,  0.340678,  0.340859,  0.341039,
-	 0.341219,  0.341399,  0.341580,  0.341760,  0.341940,  0.342120,  0.342300,  0.342481,
-	 0.342661,  0.342841,  0.343021,  0.343201,  0.343381,  0.343561,  0.343741,  0.343921,
-	 0.344101,  0.344281,  0.344461,  0.344641,  0.344821,  0.345001,  0.345181,  0.345361,
-	 0.345541,  0.345721,  0.345901,  0.346081,  0.346261,  0.346441,  0.346621,  0.346801,
-	 0.346980,  0.347160,  0.347340,  0.347520,  0.347700,  0.347879,  0.348059,  0.348239,
-	 0.348419,  0.348598,  0.348778,  0.348958,  0.349138,  0.349317,  0.349497,  0.349676,
-	 0.349856,  0.350036,  0.350215,  0.350395,  0.350575,  0.350754,  0.350934,  0.351113,
-	 0.351293,  0.351472,  0.351652,  0.351831,  0.352011,  0.352190,  0.352370,  0.352549,
-	 0.352729,  0.352908,  0.353087,  0.353267,  0.353446,  0.353626,  0.353805,  0.353984,
-	 0.354164,  0.354343,  0.354522,  0.354701,  0.354881,  0.355060,  0.355239,  0.355418,
-	 0.355598,  0.355777,  0.355956,  0.356135,  0.356314,  0.356494,  0.356673,  0.356852,
-	 0.357031,  0.357210,  0.357389,  0.357568,  0.357747,  0.357926,  0.358105,  0.358284,
-	 0.358463,  0.358642,  0.358821,  0.359000,  0.359179,  0.359358,  0.359537,  0.359716,
-	 0.359895,  0.360074,  0.360253,  0.360432,  0.360611,  0.360789,  0.360968,  0.361147,
-	 0.361326,  0.361505,  0.361683,  0.361862,  0.362041,  0.362220,  0.362398,  0.362577,
-	 0.362756,  0.362934,  0.363113,  0.363292,  0.363470,  0.363649,  0.363828,  0.364006,
-	 0.364185,  0.364363,  0.364542,  0.364720,  0.364899,  0.365078,  0.365256,  0.365435,
-	 0.365613,  0.365791,  0.365970,  0.366148,  0.366327,  0.366505,  0.366684,  0.366862,
-	 0.367040,  0.367219,  0.367397,  0.367575,  0.367754,  0.367932,  0.368110,  0.368289,
-	 0.368467,  0.368645,  0.368823,  0.369002,  0.369180,  0.369358,  0.369536,  0.369714,
-	 0.369892,  0.370071,  0.370249,  0.370427,  0.370605,  0.370783,  0.370961,  0.371139,
-	 0.371317,  0.371495,  0.371673,  0.371851,  0.372029,  0.372207,  0.372385,  0.372563,
-	 0.372741,  0.372919,  0.373097,  0.373275,  0.373453,  0.373631,  0.373808,  0.373986,
-	 0.374164,  0.374342,  0.374520,  0.374697,  0.374875,  0.375053,  0.375231,  0.375408,
-	 0.375586,  0.375764,  0.375942,  0.376119,  0.376297,  0.376475,  0.376652,  0.376830,
-	 0.377007,  0.377185,  0.377363,  0.377540,  0.377718,  0.377895,  0.378073,  0.378250,
-	 0.378428,  0.378605,  0.378783,  0.378960,  0.379138,  0.379315,  0.379492,  0.379670,
-	 0.379847,  0.380025,  0.380202,  0.380379,  0.380557,  0.380734,  0.380911,  0.381088,
-	 0.381266,  0.381443,  0.381620,  0.381797,  0.381975,  0.382152,  0.382329,  0.382506,
-	 0.382683,  0.382861,  0.383038,  0.383215,  0.383392,  0.383569,  0.383746,  0.383923,
-	 0.384100,  0.384277,  0.384454,  0.384631,  0.384808,  0.384985,  0.385162,  0.385339,
-	 0.385516,  0.385693,  0.385870,  0.386047,  0.386224,  0.386400,  0.386577,  0.386754,
-	 0.386931,  0.387108,  0.387285,  0.387461,  0.387638,  0.387815,  0.387992,  0.388168,
-	 0.388345,  0.388522,  0.388698,  0.388875,  0.389052,  0.389228,  0.389405,  0.389582,
-	 0.389758,  0.389935,  0.390111,  0.390288,  0.390464,  0.390641,  0.390817,  0.390994,
-	 0.391170,  0.391347,  0.391523,  0.391700,  0.391876,  0.392053,  0.392229,  0.392405,
-	 0.392582,  0.392758,  0.392934,  0.393111,  0.393287,  0.393463,  0.393640,  0.393816,
-	 0.393992,  0.394168,  0.394344,  0.394521,  0.394697,  0.394873,  0.395049,  0.395225,
-	 0.395401,  0.395578,  0.395754,  0.395930,  0.396106,  0.396282,  0.396458,  0.396634,
-	 0.396810,  0.396986,  0.397162,  0.397338,  0.397514,  0.397690,  0.397866,  0.398042,
-	 0.398218,  0.398393,  0.398569,  0.398745,  0.398921,  0.399097,  0.399273,  0.399448,
-	 0.399624,  0.399800,  0.399976,  0.400151,  0.400327,  0.400503,  0.400679,  0.400854,
-	 0.401030,  0.401206,  0.401381,  0.401557,  0.401732,  0.401908,  0.402084,  0.402259,
-	 0.402435,  0.402610,  0.402786,  0.402961,  0.403137,  0.403312,  0.403488,  0.403663,
-	 0.403838,  0.404014,  0.404189,  0.404365,  0.404540,  0.404715,  0.404891,  0.405066,
-	 0.405241,  0.405417,  0.405592,  0.405767,  0.405942,  0.406118,  0.406293,  0.406468,
-	 0.406643,  0.406818,  0.406994,  0.407169,  0.407344,  0.407519,  0.407694,  0.407869,
-	 0.408044,  0.408219,  0.408394,  0.408569,  0.408744,  0.408919,  0.409094,  0.409269,
-	 0.409444,  0.409619,  0.409794,  0.409969,  0.410144,  0.410319,  0.410493,  0.410668,
-	 0.410843,  0.411018,  0.411193,  0.411368,  0.411542,  0.411717,  0.411892,  0.412067,
-	 0.412241,  0.412416,  0.412591,  0.412765,  0.412940,  0.413115,  0.413289,  0.413464,
-	 0.413638,  0.413813,  0.413987,  0.414162,  0.414337,  0.414511,  0.414685,  0.414860,
-	 0.415034,  0.415209,  0.415383,  0.415558,  0.415732,  0.415906,  0.416081,  0.416255,
-	 0.416430,  0.416604,  0.416778,  0.416952,  0.417127,  0.417301,  0.417475,  0.417650,
-	 0.417824,  0.417998,  0.418172,  0.418346,  0.418520,  0.418695,  0.418869,  0.419043,
-	 0.419217,  0.419391,  0.419565,  0.419739,  0.419913,  0.420087,  0.420261,  0.420435,
-	 0.420609,  0.420783,  0.420957,  0.421131,  0.421305,  0.421479,  0.421653,  0.421826,
-	 0.422000,  0.422174,  0.422348,  0.422522,  0.422695,  0.422869,  0.423043,  0.423217,
-	 0.423390,  0.423564,  0.423738,  0.423912,  0.424085,  0.424259,  0.424432,  0.424606,
-	 0.424780,  0.424953,  0.425127,  0.425300,  0.425474,  0.425647,  0.425821,  0.425994,
-	 0.426168,  0.426341,  0.426515,  0.426688,  0.426862,  0.427035,  0.427208,  0.427382,
-	 0.427555,  0.427728,  0.427902,  0.428075,  0.428248,  0.428422,  0.428595,  0.428768,
-	 0.428941,  0.429114,  0.429288,  0.429461,  0.429634,  0.429807,  0.429980,  0.430153,
-	 0.430326,  0.430500,  0.430673,  0.430846,  0.431019,  0.431192,  0.431365,  0.431538,
-	 0.431711,  0.431884,  0.432057,  0.432229,  0.432402,  0.432575,  0.432748,  0.432921,
-	 0.433094,  0.433267,  0.433439,  0.433612,  0.433785,  0.433958,  0.434131,  0.434303,
-	 0.434476,  0.434649,  0.434821,  0.434994,  0.435167,  0.435339,  0.435512,  0.435685,
-	 0.435857,  0.436030,  0.436202,  0.436375,  0.436547,  0.436720,  0.436892,  0.437065,
-	 0.437237,  0.437410,  0.437582,  0.437754,  0.437927,  0.438099,  0.438272,  0.438444,
-	 0.438616,  0.438789,  0.438961,  0.439133,  0.439305,  0.439478,  0.439650,  0.439822,
-	 0.439994,  0.440166,  0.440339,  0.440511,  0.440683,  0.440855,  0.441027,  0.441199,
-	 0.441371,  0.441543,  0.441715,  0.441887,  0.442059,  0.442231,  0.442403,  0.442575,
-	 0.442747,  0.442919,  0.443091,  0.443263,  0.443435,  0.443607,  0.443779,  0.443950,
-	 0.444122,  0.444294,  0.444466,  0.444637,  0.444809,  0.444981,  0.445153,  0.445324,
-	 0.445496,  0.445668,  0.445839,  0.446011,  0.446183,  0.446354,  0.446526,  0.446697,
-	 0.446869,  0.447040,  0.447212,  0.447383,  0.447555,  0.447726,  0.447898,  0.448069,
-	 0.448241,  0.448412,  0.448583,  0.448755,  0.448926,  0.449097,  0.449269,  0.449440,
-	 0.449611,  0.449783,  0.449954,  0.450125,  0.450296,  0.450467,  0.450639,  0.450810,
-	 0.450981,  0.451152,  0.451323,  0.451494,  0.451665,  0.451836,  0.452008,  0.452179,
-	 0.452350,  0.452521,  0.452692,  0.452863,  0.453033,  0.453204,  0.453375,  0.453546,
-	 0.453717,  0.453888,  0.454059,  0.454230,  0.454400,  0.454571,  0.454742,  0.454913,
-	 0.455084,  0.455254,  0.455425,  0.455596,  0.455766,  0.455937,  0.456108,  0.456278,
-	 0.456449,  0.456620,  0.456790,  0.456961,  0.457131,  0.457302,  0.457472,  0.457643,
-	 0.457813,  0.457984,  0.458154,  0.458325,  0.458495,  0.458665,  0.458836,  0.459006,
-	 0.459177,  0.459347,  0.459517,  0.459687,  0.459858,  0.460028,  0.460198,  0.460369,
-	 0.460539,  0.460709,  0.460879,  0.461049,  0.461219,  0.461390,  0.461560,  0.461730,
-	 0.461900,  0.462070,  0.462240,  0.462410,  0.462580,  0.462750,  0.462920,  0.463090,
-	 0.463260,  0.463430,  0.463600,  0.463769,  0.463939,  0.464109,  0.464279,  0.464449,
-	 0.464619,  0.464788,  0.464958,  0.465128,  0.465298,  0.465467,  0.465637,  0.465807,
-	 0.465977,  0.466146,  0.466316,  0.466485,  0.466655,  0.466825,  0.466994,  0.467164,
-	 0.467333,  0.467503,  0.467672,  0.467842,  0.468011,  0.468181,  0.468350,  0.468519,
-	 0.468689,  0.468858,  0.469028,  0.469197,  0.469366,  0.469536,  0.469705,  0.469874,
-	 0.470043,  0.470213,  0.470382,  0.470551,  0.470720,  0.470889,  0.471058,  0.471228,
-	 0.471397,  0.471566,  0.471735,  0.471904,  0.472073,  0.472242,  0.472411,  0.472580,
-	 0.472749,  0.472918,  0.473087,  0.473256,  0.473425,  0.473594,  0.473763,  0.473931,
-	 0.474100,  0.474269,  0.474438,  0.474607,  0.474775,  0.474944,  0.475113,  0.475282,
-	 0.475450,  0.475619,  0.475788,  0.475956,  0.476125,  0.476294,  0.476462,  0.476631,
-	 0.476799,  0.476968,  0.477136,  0.477305,  0.477473,  0.477642,  0.477810,  0.477979,
-	 0.478147,  0.478315,  0.478484,  0.478652,  0.478821,  0.478989,  0.479157,  0.479325,
-	 0.479494,  0.479662,  0.479830,  0.479998,  0.480167,  0.480335,  0.480503,  0.480671,
-	 0.480839,  0.481007,  0.481176,  0.481344,  0.481512,  0.481680,  0.481848,  0.482016,
-	 0.482184,  0.482352,  0.482520,  0.482688,  0.482856,  0.483023,  0.483191,  0.483359,
-	 0.483527,  0.483695,  0.483863,  0.484031,  0.484198,  0.484366,  0.484534,  0.484702,
-	 0.484869,  0.485037,  0.485205,  0.485372,  0.485540,  0.485708,  0.485875,  0.486043,
-	 0.486210,  0.486378,  0.486545,  0.486713,  0.486880,  0.487048,  0.487215,  0.487383,
-	 0.487550,  0.487718,  0.487885,  0.488052,  0.488220,  0.488387,  0.488554,  0.488722,
-	 0.488889,  0.489056,  0.489223,  0.489391,  0.489558,  0.489725,  0.489892,  0.490059,
-	 0.490226,  0.490394,  0.490561,  0.490728,  0.490895,  0.491062,  0.491229,  0.491396,
-	 0.491563,  0.491730,  0.491897,  0.492064,  0.492231,  0.492398,  0.492564,  0.492731,
-	 0.492898,  0.493065,  0.493232,  0.493399,  0.493565,  0.493732,  0.493899,  0.494066,
-	 0.494232,  0.494399,  0.494566,  0.494732,  0.494899,  0.495066,  0.495232,  0.495399,
-	 0.495565,  0.495732,  0.495898,  0.496065,  0.496231,  0.496398,  0.496564,  0.496731,
-	 0.496897,  0.497063,  0.497230,  0.497396,  0.497562,  0.497729,  0.497895,  0.498061,
-	 0.498228,  0.498394,  0.498560,  0.498726,  0.498893,  0.499059,  0.499225,  0.499391,
-	 0.499557,  0.499723,  0.499889,  0.500055,  0.500221,  0.500387,  0.500553,  0.500719,
-	 0.500885,  0.501051,  0.501217,  0.501383,  0.501549,  0.501715,  0.501881,  0.502047,
-	 0.502212,  0.502378,  0.502544,  0.502710,  0.502876,  0.503041,  0.503207,  0.503373,
-	 0.503538,  0.503704,  0.503870,  0.504035,  0.504201,  0.504366,  0.504532,  0.504698,
-	 0.504863,  0.505029,  0.505194,  0.505360,  0.505525,  0.505690,  0.505856,  0.506021,
-	 0.506187,  0.506352,  0.506517,  0.506683,  0.506848,  0.507013,  0.507179,  0.507344,
-	 0.507509,  0.507674,  0.507839,  0.508005,  0.508170,  0.508335,  0.508500,  0.508665,
-	 0.508830,  0.508995,  0.509160,  0.509325,  0.509490,  0.509655,  0.509820,  0.509985,
-	 0.510150,  0.510315,  0.510480,  0.510645,  0.510810,  0.510974,  0.511139,  0.511304,
-	 0.511469,  0.511634,  0.511798,  0.511963,  0.512128,  0.512292,  0.512457,  0.512622,
-	 0.512786,  0.512951,  0.513116,  0.513280,  0.513445,  0.513609,  0.513774,  0.513938,
-	 0.514103,  0.514267,  0.514432,  0.514596,  0.514760,  0.514925,  0.515089,  0.515254,
-	 0.515418,  0.515582,  0.515746,  0.515911,  0.516075,  0.516239,  0.516403,  0.516568,
-	 0.516732,  0.516896,  0.517060,  0.517224,  0.517388,  0.517552,  0.517716,  0.517880,
-	 0.518045,  0.518209,  0.518372,  0.518536,  0.518700,  0.518864,  0.519028,  0.519192,
-	 0.519356,  0.519520,  0.519684,  0.519848,  0.520011,  0.520175,  0.520339,  0.520503,
-	 0.520666,  0.520830,  0.520994,  0.521157,  0.521321,  0.521485,  0.521648,  0.521812,
-	 0.521975,  0.522139,  0.522302,  0.522466,  0.522629,  0.522793,  0.522956,  0.523120,
-	 0.523283,  0.523447,  0.523610,  0.523773,  0.523937,  0.524100,  0.524263,  0.524426,
-	 0.524590,  0.524753,  0.524916,  0.525079,  0.525243,  0.525406,  0.525569,  0.525732,
-	 0.525895,  0.526058,  0.526221,  0.526384,  0.526547,  0.526710,  0.526873,  0.527036,
-	 0.527199,  0.527362,  0.527525,  0.527688,  0.527851,  0.528014,  0.528176,  0.528339,
-	 0.528502,  0.528665,  0.528828,  0.528990,  0.529153,  0.529316,  0.529478,  0.529641,
-	 0.529804,  0.529966,  0.530129,  0.530291,  0.530454,  0.530617,  0.530779,  0.530942,
-	 0.531104,  0.531266,  0.531429,  0.531591,  0.531754,  0.531916,  0.532078,  0.532241,
-	 0.532403,  0.532565,  0.532728,  0.532890,  0.533052,  0.533214,  0.533377,  0.533539,
-	 0.533701,  0.533863,  0.534025,  0.534187,  0.534349,  0.534512,  0.534674,  0.534836,
-	 0.534998,  0.535160,  0.535322,  0.535484,  0.535645,  0.535807,  0.535969,  0.536131,
-	 0.536293,  0.536455,  0.536617,  0.536778,  0.536940,  0.537102,  0.537264,  0.537425,
-	 0.537587,  0.537749,  0.537910,  0.538072,  0.538234,  0.538395,  0.538557,  0.538718,
-	 0.538880,  0.539041,  0.539203,  0.539364,  0.539526,  0.539687,  0.539849,  0.540010,
-	 0.540171,  0.540333,  0.540494,  0.540655,  0.540817,  0.540978,  0.541139,  0.541301,
-	 0.541462,  0.541623,  0.541784,  0.541945,  0.542106,  0.542268,  0.542429,  0.542590,
-	 0.542751,  0.542912,  0.543073,  0.543234,  0.543395,  0.543556,  0.543717,  0.543878,
-	 0.544039,  0.544199,  0.544360,  0.544521,  0.544682,  0.544843,  0.545003,  0.545164,
-	 0.545325,  0.545486,  0.545646,  0.545807,  0.545968,  0.546128,  0.546289,  0.546450,
-	 0.546610,  0.546771,  0.546931,  0.547092,  0.547252,  0.547413,  0.547573,  0.547734,
-	 0.547894,  0.548054,  0.548215,  0.548375,  0.548536,  0.548696,  0.548856,  0.549016,
-	 0.549177,  0.549337,  0.549497,  0.549657,  0.549818,  0.549978,  0.550138,  0.550298,
-	 0.550458,  0.550618,  0.550778,  0.550938,  0.551098,  0.551258,  0.551418,  0.551578,
-	 0.551738,  0.551898,  0.552058,  0.552218,  0.552378,  0.552537,  0.552697,  0.552857,
-	 0.553017,  0.553176,  0.553336,  0.553496,  0.553656,  0.553815,  0.553975,  0.554134,
-	 0.554294,  0.554454,  0.554613,  0.554773,  0.554932,  0.555092,  0.555251,  0.555411,
-	 0.555570,  0.555730,  0.555889,  0.556048,  0.556208,  0.556367,  0.556526,  0.556686,
-	 0.556845,  0.557004,  0.557164,  0.557323,  0.557482,  0.557641,  0.557800,  0.557959,
-	 0.558119,  0.558278,  0.558437,  0.558596,  0.558755,  0.558914,  0.559073,  0.559232,
-	 0.559391,  0.559550,  0.559709,  0.559867,  0.560026,  0.560185,  0.560344,  0.560503,
-	 0.560662,  0.560820,  0.560979,  0.561138,  0.561297,  0.561455,  0.561614,  0.561773,
-	 0.561931,  0.562090,  0.562248,  0.562407,  0.562565,  0.562724,  0.562882,  0.563041,
-	 0.563199,  0.563358,  0.563516,  0.563675,  0.563833,  0.563991,  0.564150,  0.564308,
-	 0.564466,  0.564624,  0.564783,  0.564941,  0.565099,  0.565257,  0.565416,  0.565574,
-	 0.565732,  0.565890,  0.566048,  0.566206,  0.566364,  0.566522,  0.566680,  0.566838,
-	 0.566996,  0.567154,  0.567312,  0.567470,  0.567628,  0.567786,  0.567943,  0.568101,
-	 0.568259,  0.568417,  0.568574,  0.568732,  0.568890,  0.569048,  0.569205,  0.569363,
-	 0.569521,  0.569678,  0.569836,  0.569993,  0.570151,  0.570308,  0.570466,  0.570623,
-	 0.570781,  0.570938,  0.571096,  0.571253,  0.571410,  0.571568,  0.571725,  0.571882,
-	 0.572040,  0.572197,  0.572354,  0.572511,  0.572669,  0.572826,  0.572983,  0.573140,
-	 0.573297,  0.573454,  0.573611,  0.573768,  0.573925,  0.574082,  0.574239,  0.574396,
-	 0.574553,  0.574710,  0.574867,  0.575024,  0.575181,  0.575338,  0.575495,  0.575651,
-	 0.575808,  0.575965,  0.576122,  0.576278,  0.576435,  0.576592,  0.576748,  0.576905,
-	 0.577062,  0.577218,  0.577375,  0.577531,  0.577688,  0.577844,  0.578001,  0.578157,
-	 0.578314,  0.578470,  0.578627,  0.578783,  0.578939,  0.579096,  0.579252,  0.579408,
-	 0.579565,  0.579721,  0.579877,  0.580033,  0.580189,  0.580346,  0.580502,  0.580658,
-	 0.580814,  0.580970,  0.581126,  0.581282,  0.581438,  0.581594,  0.581750,  0.581906,
-	 0.582062,  0.582218,  0.582374,  0.582530,  0.582685,  0.582841,  0.582997,  0.583153,
-	 0.583309,  0.583464,  0.583620,  0.583776,  0.583931,  0.584087,  0.584243,  0.584398,
-	 0.584554,  0.584710,  0.584865,  0.585021,  0.585176,  0.585332,  0.585487,  0.585642,
-	 0.585798,  0.585953,  0.586109,  0.586264,  0.586419,  0.586575,  0.586730,  0.586885,
-	 0.587040,  0.587196,  0.587351,  0.587506,  0.587661,  0.587816,  0.587971,  0.588126,
-	 0.588282,  0.588437,  0.588592,  0.588747,  0.588902,  0.589057,  0.589212,  0.589366,
-	 0.589521,  0.589676,  0.589831,  0.589986,  0.590141,  0.590295,  0.590450,  0.590605,
-	 0.590760,  0.590914,  0.591069,  0.591224,  0.591378,  0.591533,  0.591688,  0.591842,
-	 0.591997,  0.592151,  0.592306,  0.592460,  0.592615,  0.592769,  0.592924,  0.593078,
-	 0.593232,  0.593387,  0.593541,  0.593695,  0.593850,  0.594004,  0.594158,  0.594312,
-	 0.594467,  0.594621,  0.594775,  0.594929,  0.595083,  0.595237,  0.595391,  0.595545,
-	 0.595699,  0.595853,  0.596007,  0.596161,  0.596315,  0.596469,  0.596623,  0.596777,
-	 0.596931,  0.597085,  0.597238,  0.597392,  0.597546,  0.597700,  0.597853,  0.598007,
-	 0.598161,  0.598314,  0.598468,  0.598622,  0.598775,  0.598929,  0.599082,  0.599236,
-	 0.599389,  0.599543,  0.599696,  0.599850,  0.600003,  0.600156,  0.600310,  0.600463,
-	 0.600616,  0.600770,  0.600923,  0.601076,  0.601230,  0.601383,  0.601536,  0.601689,
-	 0.601842,  0.601995,  0.602148,  0.602302,  0.602455,  0.602608,  0.602761,  0.602914,
-	 0.603067,  0.603220,  0.603372,  0.603525,  0.603678,  0.603831,  0.603984,  0.604137,
-	 0.604290,  0.604442,  0.604595,  0.604748,  0.604900,  0.605053,  0.605206,  0.605358,
-	 0.605511,  0.605664,  0.605816,  0.605969,  0.606121,  0.606274,  0.606426,  0.606579,
-	 0.606731,  0.606884,  0.607036,  0.607188,  0.607341,  0.607493,  0.607645,  0.607798,
-	 0.607950,  0.608102,  0.608254,  0.608406,  0.608559,  0.608711,  0.608863,  0.609015,
-	 0.609167,  0.609319,  0.609471,  0.609623,  0.609775,  0.609927,  0.610079,  0.610231,
-	 0.610383,  0.610535,  0.610687,  0.610838,  0.610990,  0.611142,  0.611294,  0.611445,
-	 0.611597,  0.611749,  0.611901,  0.612052,  0.612204,  0.612355,  0.612507,  0.612659,
-	 0.612810,  0.612962,  0.613113,  0.613265,  0.613416,  0.613567,  0.613719,  0.613870,
-	 0.614022,  0.614173,  0.614324,  0.614475,  0.614627,  0.614778,  0.614929,  0.615080,
-	 0.615232,  0.615383,  0.615534,  0.615685,  0.615836,  0.615987,  0.616138,  0.616289,
-	 0.616440,  0.616591,  0.616742,  0.616893,  0.617044,  0.617195,  0.617346,  0.617496,
-	 0.617647,  0.617798,  0.617949,  0.618100,  0.618250,  0.618401,  0.618552,  0.618702,
-	 0.618853,  0.619004,  0.619154,  0.619305,  0.619455,  0.619606,  0.619756,  0.619907,
-	 0.620057,  0.620208,  0.620358,  0.620508,  0.620659,  0.620809,  0.620959,  0.621110,
-	 0.621260,  0.621410,  0.621560,  0.621711,  0.621861,  0.622011,  0.622161,  0.622311,
-	 0.622461,  0.622611,  0.622761,  0.622911,  0.623061,  0.623211,  0.623361,  0.623511,
-	 0.623661,  0.623811,  0.623961,  0.624111,  0.624260,  0.624410,  0.624560,  0.624710,
-	 0.624860,  0.625009,  0.625159,  0.625309,  0.625458,  0.625608,  0.625757,  0.625907,
-	 0.626056,  0.626206,  0.626355,  0.626505,  0.626654,  0.626804,  0.626953,  0.627102,
-	 0.627252,  0.627401,  0.627550,  0.627700,  0.627849,  0.627998,  0.628147,  0.628297,
-	 0.628446,  0.628595,  0.628744,  0.628893,  0.629042,  0.629191,  0.629340,  0.629489,
-	 0.629638,  0.629787,  0.629936,  0.630085,  0.630234,  0.630383,  0.630532,  0.630680,
-	 0.630829,  0.630978,  0.631127,  0.631275,  0.631424,  0.631573,  0.631721,  0.631870,
-	 0.632019,  0.632167,  0.632316,  0.632464,  0.632613,  0.632761,  0.632910,  0.633058,
-	 0.633207,  0.633355,  0.633504,  0.633652,  0.633800,  0.633949,  0.634097,  0.634245,
-	 0.634393,  0.634542,  0.634690,  0.634838,  0.634986,  0.635134,  0.635282,  0.635430,
-	 0.635578,  0.635726,  0.635874,  0.636022,  0.636170,  0.636318,  0.636466,  0.636614,
-	 0.636762,  0.636910,  0.637057,  0.637205,  0.637353,  0.637501,  0.637649,  0.637796,
-	 0.637944,  0.638092,  0.638239,  0.638387,  0.638534,  0.638682,  0.638829,  0.638977,
-	 0.639124,  0.639272,  0.639419,  0.639567,  0.639714,  0.639862,  0.640009,  0.640156,
-	 0.640303,  0.640451,  0.640598,  0.640745,  0.640892,  0.641040,  0.641187,  0.641334,
-	 0.641481,  0.641628,  0.641775,  0.641922,  0.642069,  0.642216,  0.642363,  0.642510,
-	 0.642657,  0.642804,  0.642951,  0.643098,  0.643245,  0.643391,  0.643538,  0.643685,
-	 0.643832,  0.643978,  0.644125,  0.644272,  0.644418,  0.644565,  0.644711,  0.644858,
-	 0.645005,  0.645151,  0.645298,  0.645444,  0.645590,  0.645737,  0.645883,  0.646030,
-	 0.646176,  0.646322,  0.646469,  0.646615,  0.646761,  0.646907,  0.647054,  0.647200,
-	 0.647346,  0.647492,  0.647638,  0.647784,  0.647930,  0.648076,  0.648222,  0.648368,
-	 0.648514,  0.648660,  0.648806,  0.648952,  0.649098,  0.649244,  0.649390,  0.649536,
-	 0.649681,  0.649827,  0.649973,  0.650119,  0.650264,  0.650410,  0.650555,  0.650701,
-	 0.650847,  0.650992,  0.651138,  0.651283,  0.651429,  0.651574,  0.651720,  0.651865,
-	 0.652011,  0.652156,  0.652301,  0.652447,  0.652592,  0.652737,  0.652882,  0.653028,
-	 0.653173,  0.653318,  0.653463,  0.653608,  0.653753,  0.653899,  0.654044,  0.654189,
-	 0.654334,  0.654479,  0.654624,  0.654769,  0.654913,  0.655058,  0.655203,  0.655348,
-	 0.655493,  0.655638,  0.655782,  0.655927,  0.656072,  0.656217,  0.656361,  0.656506,
-	 0.656651,  0.656795,  0.656940,  0.657084,  0.657229,  0.657373,  0.657518,  0.657662,
-	 0.657807,  0.657951,  0.658095,  0.658240,  0.658384,  0.658529,  0.658673,  0.658817,
-	 0.658961,  0.659105,  0.659250,  0.659394,  0.659538,  0.659682,  0.659826,  0.659970,
-	 0.660114,  0.660258,  0.660402,  0.660546,  0.660690,  0.660834,  0.660978,  0.661122,
-	 0.661266,  0.661410,  0.661553,  0.661697,  0.661841,  0.661985,  0.662128,  0.662272,
-	 0.662416,  0.662559,  0.662703,  0.662847,  0.662990,  0.663134,  0.663277,  0.663421,
-	 0.663564,  0.663708,  0.663851,  0.663994,  0.664138,  0.664281,  0.664424,  0.664568,
-	 0.664711,  0.664854,  0.664997,  0.665141,  0.665284,  0.665427,  0.665570,  0.665713,
-	 0.665856,  0.665999,  0.666142,  0.666285,  0.666428,  0.666571,  0.666714,  0.666857,
-	 0.667000,  0.667143,  0.667286,  0.667428,  0.667571,  0.667714,  0.667857,  0.667999,
-	 0.668142,  0.668285,  0.668427,  0.668570,  0.668712,  0.668855,  0.668998,  0.669140,
-	 0.669283,  0.669425,  0.669567,  0.669710,  0.669852,  0.669995,  0.670137,  0.670279,
-	 0.670422,  0.670564,  0.670706,  0.670848,  0.670990,  0.671133,  0.671275,  0.671417,
-	 0.671559,  0.671701,  0.671843,  0.671985,  0.672127,  0.672269,  0.672411,  0.672553,
-	 0.672695,  0.672837,  0.672978,  0.673120,  0.673262,  0.673404,  0.673546,  0.673687,
-	 0.673829,  0.673971,  0.674112,  0.674254,  0.674396,  0.674537,  0.674679,  0.674820,
-	 0.674962,  0.675103,  0.675245,  0.675386,  0.675527,  0.675669,  0.675810,  0.675951,
-	 0.676093,  0.676234,  0.676375,  0.676516,  0.676658,  0.676799,  0.676940,  0.677081,
-	 0.677222,  0.677363,  0.677504,  0.677645,  0.677786,  0.677927,  0.678068,  0.678209,
-	 0.678350,  0.678491,  0.678632,  0.678773,  0.678913,  0.679054,  0.679195,  0.679336,
-	 0.679476,  0.679617,  0.679758,  0.679898,  0.680039,  0.680179,  0.680320,  0.680461,
-	 0.680601,  0.680741,  0.680882,  0.681022,  0.681163,  0.681303,  0.681443,  0.681584,
-	 0.681724,  0.681864,  0.682005,  0.682145,  0.682285,  0.682425,  0.682565,  0.682705,
-	 0.682846,  0.682986,  0.683126,  0.683266,  0.683406,  0.683546,  0.683686,  0.683825,
-	 0.683965,  0.684105,  0.684245,  0.684385,  0.684525,  0.684664,  0.684804,  0.684944,
-	 0.685084,  0.685223,  0.685363,  0.685503,  0.685642,  0.685782,  0.685921,  0.686061,
-	 0.686200,  0.686340,  0.686479,  0.686619,  0.686758,  0.686897,  0.687037,  0.687176,
-	 0.687315,  0.687455,  0.687594,  0.687733,  0.687872,  0.688011,  0.688151,  0.688290,
-	 0.688429,  0.688568,  0.688707,  0.688846,  0.688985,  0.689124,  0.689263,  0.689402,
-	 0.689541,  0.689679,  0.689818,  0.689957,  0.690096,  0.690235,  0.690373,  0.690512,
-	 0.690651,  0.690789,  0.690928,  0.691067,  0.691205,  0.691344,  0.691482,  0.691621,
-	 0.691759,  0.691898,  0.692036,  0.692175,  0.692313,  0.692451,  0.692590,  0.692728,
-	 0.692866,  0.693004,  0.693143,  0.693281,  0.693419,  0.693557,  0.693695,  0.693833,
-	 0.693971,  0.694109,  0.694248,  0.694386,  0.694524,  0.694661,  0.694799,  0.694937,
-	 0.695075,  0.695213,  0.695351,  0.695489,  0.695626,  0.695764,  0.695902,  0.696039,
-	 0.696177,  0.696315,  0.696452,  0.696590,  0.696728,  0.696865,  0.697003,  0.697140,
-	 0.697277,  0.697415,  0.697552,  0.697690,  0.697827,  0.697964,  0.698102,  0.698239,
-	 0.698376,  0.698513,  0.698651,  0.698788,  0.698925,  0.699062,  0.699199,  0.699336,
-	 0.699473,  0.699610,  0.699747,  0.699884,  0.700021,  0.700158,  0.700295,  0.700432,
-	 0.700569,  0.700706,  0.700842,  0.700979,  0.701116,  0.701253,  0.701389,  0.701526,
-	 0.701663,  0.701799,  0.701936,  0.702072,  0.702209,  0.702345,  0.702482,  0.702618,
-	 0.702755,  0.702891,  0.703028,  0.703164,  0.703300,  0.703436,  0.703573,  0.703709,
-	 0.703845,  0.703981,  0.704118,  0.704254,  0.704390,  0.704526,  0.704662,  0.704798,
-	 0.704934,  0.705070,  0.705206,  0.705342,  0.705478,  0.705614,  0.705750,  0.705885,
-	 0.706021,  0.706157,  0.706293,  0.706429,  0.706564,  0.706700,  0.706836,  0.706971,
-	 0.707107,  0.707242,  0.707378,  0.707513,  0.707649,  0.707784,  0.707920,  0.708055,
-	 0.708191,  0.708326,  0.708461,  0.708597,  0.708732,  0.708867,  0.709002,  0.709138,
-	 0.709273,  0.709408,  0.709543,  0.709678,  0.709813,  0.709948,  0.710083,  0.710218,
-	 0.710353,  0.710488,  0.710623,  0.710758,  0.710893,  0.711028,  0.711163,  0.711297,
-	 0.711432,  0.711567,  0.711702,  0.711836,  0.711971,  0.712106,  0.712240,  0.712375,
-	 0.712509,  0.712644,  0.712778,  0.712913,  0.713047,  0.713182,  0.713316,  0.713451,
-	 0.713585,  0.713719,  0.713853,  0.713988,  0.714122,  0.714256,  0.714390,  0.714525,
-	 0.714659,  0.714793,  0.714927,  0.715061,  0.715195,  0.715329,  0.715463,  0.715597,
-	 0.715731,  0.715865,  0.715999,  0.716132,  0.716266,  0.716400,  0.716534,  0.716668,
-	 0.716801,  0.716935,  0.717069,  0.717202,  0.717336,  0.717469,  0.717603,  0.717737,
-	 0.717870,  0.718004,  0.718137,  0.718270,  0.718404,  0.718537,  0.718670,  0.718804,
-	 0.718937,  0.719070,  0.719204,  0.719337,  0.719470,  0.719603,  0.719736,  0.719869,
-	 0.720003,  0.720136,  0.720269,  0.720402,  0.720535,  0.720668,  0.720800,  0.720933,
-	 0.721066,  0.721199,  0.721332,  0.721465,  0.721597,  0.721730,  0.721863,  0.721996,
-	 0.722128,  0.722261,  0.722393,  0.722526,  0.722659,  0.722791,  0.722924,  0.723056,
-	 0.723188,  0.723321,  0.723453,  0.723586,  0.723718,  0.723850,  0.723983,  0.724115,
-	 0.724247,  0.724379,  0.724511,  0.724644,  0.724776,  0.724908,  0.725040,  0.725172,
-	 0.725304,  0.725436,  0.725568,  0.725700,  0.725832,  0.725964,  0.726095,  0.726227,
-	 0.726359,  0.726491,  0.726623,  0.726754,  0.726886,  0.727018,  0.727149,  0.727281,
-	 0.727413,  0.727544,  0.727676,  0.727807,  0.727939,  0.728070,  0.728202,  0.728333,
-	 0.728464,  0.728596,  0.728727,  0.728858,  0.728990,  0.729121,  0.729252,  0.729383,
-	 0.729514,  0.729646,  0.729777,  0.729908,  0.730039,  0.730170,  0.730301,  0.730432,
-	 0.730563,  0.730694,  0.730825,  0.730955,  0.731086,  0.731217,  0.731348,  0.731479,
-	 0.731609,  0.731740,  0.731871,  0.732001,  0.732132,  0.732263,  0.732393,  0.732524,
-	 0.732654,  0.732785,  0.732915,  0.733046,  0.733176,  0.733306,  0.733437,  0.733567,
-	 0.733697,  0.733828,  0.733958,  0.734088,  0.734218,  0.734349,  0.734479,  0.734609,
-	 0.734739,  0.734869,  0.734999,  0.735129,  0.735259,  0.735389,  0.735519,  0.735649,
-	 0.735779,  0.735908,  0.736038,  0.736168,  0.736298,  0.736428,  0.736557,  0.736687,
-	 0.736817,  0.736946,  0.737076,  0.737205,  0.737335,  0.737464,  0.737594,  0.737723,
-	 0.737853,  0.737982,  0.738112,  0.738241,  0.738370,  0.738500,  0.738629,  0.738758,
-	 0.738887,  0.739017,  0.739146,  0.739275,  0.739404,  0.739533,  0.739662,  0.739791,
-	 0.739920,  0.740049,  0.740178,  0.740307,  0.740436,  0.740565,  0.740694,  0.740822,
-	 0.740951,  0.741080,  0.741209,  0.741337,  0.741466,  0.741595,  0.741723,  0.741852,
-	 0.741980,  0.742109,  0.742237,  0.742366,  0.742494,  0.742623,  0.742751,  0.742880,
-	 0.743008,  0.743136,  0.743265,  0.743393,  0.743521,  0.743649,  0.743777,  0.743906,
-	 0.744034,  0.744162,  0.744290,  0.744418,  0.744546,  0.744674,  0.744802,  0.744930,
-	 0.745058,  0.745186,  0.745314,  0.745441,  0.745569,  0.745697,  0.745825,  0.745952,
-	 0.746080,  0.746208,  0.746335,  0.746463,  0.746591,  0.746718,  0.746846,  0.746973,
-	 0.747101,  0.747228,  0.747355,  0.747483,  0.747610,  0.747738,  0.747865,  0.747992,
-	 0.748119,  0.748247,  0.748374,  0.748501,  0.748628,  0.748755,  0.748882,  0.749009,
-	 0.749136,  0.749263,  0.749390,  0.749517,  0.749644,  0.749771,  0.749898,  0.750025,
-	 0.750152,  0.750278,  0.750405,  0.750532,  0.750659,  0.750785,  0.750912,  0.751039,
-	 0.751165,  0.751292,  0.751418,  0.751545,  0.751671,  0.751798,  0.751924,  0.752050,
-	 0.752177,  0.752303,  0.752429,  0.752556,  0.752682,  0.752808,  0.752934,  0.753061,
-	 0.753187,  0.753313,  0.753439,  0.753565,  0.753691,  0.753817,  0.753943,  0.754069,
-	 0.754195,  0.754321,  0.754447,  0.754573,  0.754698,  0.754824,  0.754950,  0.755076,
-	 0.755201,  0.755327,  0.755453,  0.755578,  0.755704,  0.755829,  0.755955,  0.756081,
-	 0.756206,  0.756331,  0.756457,  0.756582,  0.756708,  0.756833,  0.756958,  0.757084,
-	 0.757209,  0.757334,  0.757459,  0.757584,  0.757710,  0.757835,  0.757960,  0.758085,
-	 0.758210,  0.758335,  0.758460,  0.758585,  0.758710,  0.758835,  0.758960,  0.759084,
-	 0.759209,  0.759334,  0.759459,  0.759583,  0.759708,  0.759833,  0.759957,  0.760082,
-	 0.760207,  0.760331,  0.760456,  0.760580,  0.760705,  0.760829,  0.760954,  0.761078,
-	 0.761202,  0.761327,  0.761451,  0.761575,  0.761700,  0.761824,  0.761948,  0.762072,
-	 0.762196,  0.762320,  0.762444,  0.762569,  0.762693,  0.762817,  0.762941,  0.763065,
-	 0.763188,  0.763312,  0.763436,  0.763560,  0.763684,  0.763808,  0.763931,  0.764055,
-	 0.764179,  0.764302,  0.764426,  0.764550,  0.764673,  0.764797,  0.764920,  0.765044,
-	 0.765167,  0.765291,  0.765414,  0.765538,  0.765661,  0.765784,  0.765907,  0.766031,
-	 0.766154,  0.766277,  0.766400,  0.766524,  0.766647,  0.766770,  0.766893,  0.767016,
-	 0.767139,  0.767262,  0.767385,  0.767508,  0.767631,  0.767754,  0.767876,  0.767999,
-	 0.768122,  0.768245,  0.768368,  0.768490,  0.768613,  0.768736,  0.768858,  0.768981,
-	 0.769103,  0.769226,  0.769348,  0.769471,  0.769593,  0.769716,  0.769838,  0.769961,
-	 0.770083,  0.770205,  0.770327,  0.770450,  0.770572,  0.770694,  0.770816,  0.770938,
-	 0.771061,  0.771183,  0.771305,  0.771427,  0.771549,  0.771671,  0.771793,  0.771915,
-	 0.772036,  0.772158,  0.772280,  0.772402,  0.772524,  0.772645,  0.772767,  0.772889,
-	 0.773010,  0.773132,  0.773254,  0.773375,  0.773497,  0.773618,  0.773740,  0.773861,
-	 0.773983,  0.774104,  0.774225,  0.774347,  0.774468,  0.774589,  0.774711,  0.774832,
-	 0.774953,  0.775074,  0.775195,  0.775317,  0.775438,  0.775559,  0.775680,  0.775801,
-	 0.775922,  0.776043,  0.776164,  0.776284,  0.776405,  0.776526,  0.776647,  0.776768,
-	 0.776888,  0.777009,  0.777130,  0.777251,  0.777371,  0.777492,  0.777612,  0.777733,
-	 0.777853,  0.777974,  0.778094,  0.778215,  0.778335,  0.778456,  0.778576,  0.778696,
-	 0.778817,  0.778937,  0.779057,  0.779177,  0.779297,  0.779418,  0.779538,  0.779658,
-	 0.779778,  0.779898,  0.780018,  0.780138,  0.780258,  0.780378,  0.780498,  0.780617,
-	 0.780737,  0.780857,  0.780977,  0.781097,  0.781216,  0.781336,  0.781456,  0.781575,
-	 0.781695,  0.781814,  0.781934,  0.782053,  0.782173,  0.782292,  0.782412,  0.782531,
-	 0.782651,  0.782770,  0.782889,  0.783009,  0.783128,  0.783247,  0.783366,  0.783485,
-	 0.783605,  0.783724,  0.783843,  0.783962,  0.784081,  0.784200,  0.784319,  0.784438,
-	 0.784557,  0.784675,  0.784794,  0.784913,  0.785032,  0.785151,  0.785269,  0.785388,
-	 0.785507,  0.785625,  0.785744,  0.785863,  0.785981,  0.786100,  0.786218,  0.786337,
-	 0.786455,  0.786574,  0.786692,  0.786810,  0.786929,  0.787047,  0.787165,  0.787284,
-	 0.787402,  0.787520,  0.787638,  0.787756,  0.787874,  0.787992,  0.788110,  0.788228,
-	 0.788346,  0.788464,  0.788582,  0.788700,  0.788818,  0.788936,  0.789054,  0.789172,
-	 0.789289,  0.789407,  0.789525,  0.789642,  0.789760,  0.789878,  0.789995,  0.790113,
-	 0.790230,  0.790348,  0.790465,  0.790583,  0.790700,  0.790817,  0.790935,  0.791052,
-	 0.791169,  0.791287,  0.791404,  0.791521,  0.791638,  0.791755,  0.791872,  0.791990,
-	 0.792107,  0.792224,  0.792341,  0.792458,  0.792575,  0.792691,  0.792808,  0.792925,
-	 0.793042,  0.793159,  0.793276,  0.793392,  0.793509,  0.793626,  0.793742,  0.793859,
-	 0.793975,  0.794092,  0.794209,  0.794325,  0.794442,  0.794558,  0.794674,  0.794791,
-	 0.794907,  0.795023,  0.795140,  0.795256,  0.795372,  0.795488,  0.795605,  0.795721,
-	 0.795837,  0.795953,  0.796069,  0.796185,  0.796301,  0.796417,  0.796533,  0.796649,
-	 0.796765,  0.796881,  0.796996,  0.797112,  0.797228,  0.797344,  0.797459,  0.797575,
-	 0.797691,  0.797806,  0.797922,  0.798038,  0.798153,  0.798269,  0.798384,  0.798500,
-	 0.798615,  0.798730,  0.798846,  0.798961,  0.799076,  0.799192,  0.799307,  0.799422,
-	 0.799537,  0.799652,  0.799768,  0.799883,  0.799998,  0.800113,  0.800228,  0.800343,
-	 0.800458,  0.800573,  0.800687,  0.800802,  0.800917,  0.801032,  0.801147,  0.801261,
-	 0.801376,  0.801491,  0.801606,  0.801720,  0.801835,  0.801949,  0.802064,  0.802178,
-	 0.802293,  0.802407,  0.802522,  0.802636,  0.802750,  0.802865,  0.802979,  0.803093,
-	 0.803208,  0.803322,  0.803436,  0.803550,  0.803664,  0.803778,  0.803892,  0.804006,
-	 0.804120,  0.804234,  0.804348,  0.804462,  0.804576,  0.804690,  0.804804,  0.804918,
-	 0.805031,  0.805145,  0.805259,  0.805372,  0.805486,  0.805600,  0.805713,  0.805827,
-	 0.805940,  0.806054,  0.806167,  0.806281,  0.806394,  0.806508,  0.806621,  0.806734,
-	 0.806848,  0.806961,  0.807074,  0.807187,  0.807300,  0.807414,  0.807527,  0.807640,
-	 0.807753,  0.807866,  0.807979,  0.808092,  0.808205,  0.808318,  0.808430,  0.808543,
-	 0.808656,  0.808769,  0.808882,  0.808994,  0.809107,  0.809220,  0.809332,  0.809445,
-	 0.809558,  0.809670,  0.809783,  0.809895,  0.810008,  0.810120,  0.810232,  0.810345,
-	 0.810457,  0.810570,  0.810682,  0.810794,  0.810906,  0.811018,  0.811131,  0.811243,
-	 0.811355,  0.811467,  0.811579,  0.811691,  0.811803,  0.811915,  0.812027,  0.812139,
-	 0.812251,  0.812362,  0.812474,  0.812586,  0.812698,  0.812809,  0.812921,  0.813033,
-	 0.813144,  0.813256,  0.813368,  0.813479,  0.813591,  0.813702,  0.813814,  0.813925,
-	 0.814036,  0.814148,  0.814259,  0.814370,  0.814482,  0.814593,  0.814704,  0.814815,
-	 0.814926,  0.815037,  0.815149,  0.815260,  0.815371,  0.815482,  0.815593,  0.815704,
-	 0.815814,  0.815925,  0.816036,  0.816147,  0.816258,  0.816368,  0.816479,  0.816590,
-	 0.816701,  0.816811,  0.816922,  0.817032,  0.817143,  0.817253,  0.817364,  0.817474,
-	 0.817585,  0.817695,  0.817806,  0.817916,  0.818026,  0.818137,  0.818247,  0.818357,
-	 0.818467,  0.818577,  0.818687,  0.818798,  0.818908,  0.819018,  0.819128,  0.819238,
-	 0.819348,  0.819457,  0.819567,  0.819677,  0.819787,  0.819897,  0.820007,  0.820116,
-	 0.820226,  0.820336,  0.820445,  0.820555,  0.820664,  0.820774,  0.820884,  0.820993,
-	 0.821102,  0.821212,  0.821321,  0.821431,  0.821540,  0.821649,  0.821759,  0.821868,
-	 0.821977,  0.822086,  0.822195,  0.822305,  0.822414,  0.822523,  0.822632,  0.822741,
-	 0.822850,  0.822959,  0.823068,  0.823177,  0.823285,  0.823394,  0.823503,  0.823612,
-	 0.823721,  0.823829,  0.823938,  0.824047,  0.824155,  0.824264,  0.824372,  0.824481,
-	 0.824589,  0.824698,  0.824806,  0.824915,  0.825023,  0.825131,  0.825240,  0.825348,
-	 0.825456,  0.825564,  0.825673,  0.825781,  0.825889,  0.825997,  0.826105,  0.826213,
-	 0.826321,  0.826429,  0.826537,  0.826645,  0.826753,  0.826861,  0.826968,  0.827076,
-	 0.827184,  0.827292,  0.827399,  0.827507,  0.827615,  0.827722,  0.827830,  0.827938,
-	 0.828045,  0.828153,  0.828260,  0.828367,  0.828475,  0.828582,  0.828690,  0.828797,
-	 0.828904,  0.829011,  0.829119,  0.829226,  0.829333,  0.829440,  0.829547,  0.829654,
-	 0.829761,  0.829868,  0.829975,  0.830082,  0.830189,  0.830296,  0.830403,  0.830510,
-	 0.830616,  0.830723,  0.830830,  0.830937,  0.831043,  0.831150,  0.831257,  0.831363,
-	 0.831470,  0.831576,  0.831683,  0.831789,  0.831895,  0.832002,  0.832108,  0.832215,
-	 0.832321,  0.832427,  0.832533,  0.832640,  0.832746,  0.832852,  0.832958,  0.833064,
-	 0.833170,  0.833276,  0.833382,  0.833488,  0.833594,  0.833700,  0.833806,  0.833912,
-	 0.834018,  0.834123,  0.834229,  0.834335,  0.834440,  0.834546,  0.834652,  0.834757,
-	 0.834863,  0.834968,  0.835074,  0.835179,  0.835285,  0.835390,  0.835496,  0.835601,
-	 0.835706,  0.835812,  0.835917,  0.836022,  0.836127,  0.836232,  0.836338,  0.836443,
-	 0.836548,  0.836653,  0.836758,  0.836863,  0.836968,  0.837073,  0.837178,  0.837282,
-	 0.837387,  0.837492,  0.837597,  0.837701,  0.837806,  0.837911,  0.838015,  0.838120,
-	 0.838225,  0.838329,  0.838434,  0.838538,  0.838643,  0.838747,  0.838852,  0.838956,
-	 0.839060,  0.839165,  0.839269,  0.839373,  0.839477,  0.839581,  0.839686,  0.839790,
-	 0.839894,  0.839998,  0.840102,  0.840206,  0.840310,  0.840414,  0.840518,  0.840622,
-	 0.840725,  0.840829,  0.840933,  0.841037,  0.841140,  0.841244,  0.841348,  0.841451,
-	 0.841555,  0.841659,  0.841762,  0.841866,  0.841969,  0.842072,  0.842176,  0.842279,
-	 0.842383,  0.842486,  0.842589,  0.842692,  0.842796,  0.842899,  0.843002,  0.843105,
-	 0.843208,  0.843311,  0.843414,  0.843517,  0.843620,  0.843723,  0.843826,  0.843929,
-	 0.844032,  0.844135,  0.844238,  0.844340,  0.844443,  0.844546,  0.844648,  0.844751,
-	 0.844854,  0.844956,  0.845059,  0.845161,  0.845264,  0.845366,  0.845469,  0.845571,
-	 0.845673,  0.845776,  0.845878,  0.845980,  0.846082,  0.846185,  0.846287,  0.846389,
-	 0.846491,  0.846593,  0.846695,  0.846797,  0.846899,  0.847001,  0.847103,  0.847205,
-	 0.847307,  0.847408,  0.847510,  0.847612,  0.847714,  0.847815,  0.847917,  0.848019,
-	 0.848120,  0.848222,  0.848323,  0.848425,  0.848526,  0.848628,  0.848729,  0.848831,
-	 0.848932,  0.849033,  0.849135,  0.849236,  0.849337,  0.849438,  0.849540,  0.849641,
-	 0.849742,  0.849843,  0.849944,  0.850045,  0.850146,  0.850247,  0.850348,  0.850449,
-	 0.850549,  0.850650,  0.850751,  0.850852,  0.850953,  0.851053,  0.851154,  0.851255,
-	 0.851355,  0.851456,  0.851556,  0.851657,  0.851757,  0.851858,  0.851958,  0.852059,
-	 0.852159,  0.852259,  0.852360,  0.852460,  0.852560,  0.852660,  0.852760,  0.852861,
-	 0.852961,  0.853061,  0.853161,  0.853261,  0.853361,  0.853461,  0.853561,  0.853660,
-	 0.853760,  0.853860,  0.853960,  0.854060,  0.854159,  0.854259,  0.854359,  0.854458,
-	 0.854558,  0.854658,  0.854757,  0.854857,  0.854956,  0.855056,  0.855155,  0.855254,
-	 0.855354,  0.855453,  0.855552,  0.855651,  0.855751,  0.855850,  0.855949,  0.856048,
-	 0.856147,  0.856246,  0.856345,  0.856444,  0.856543,  0.856642,  0.856741,  0.856840,
-	 0.856939,  0.857038,  0.857137,  0.857235,  0.857334,  0.857433,  0.857531,  0.857630,
-	 0.857729,  0.857827,  0.857926,  0.858024,  0.858123,  0.858221,  0.858320,  0.858418,
-	 0.858516,  0.858615,  0.858713,  0.858811,  0.858909,  0.859007,  0.859106,  0.859204,
-	 0.859302,  0.859400,  0.859498,  0.859596,  0.859694,  0.859792,  0.859890,  0.859988,
-	 0.860085,  0.860183,  0.860281,  0.860379,  0.860476,  0.860574,  0.860672,  0.860769,
-	 0.860867,  0.860964,  0.861062,  0.861160,  0.861257,  0.861354,  0.861452,  0.861549,
-	 0.861646,  0.861744,  0.861841,  0.861938,  0.862035,  0.862133,  0.862230,  0.862327,
-	 0.862424,  0.862521,  0.862618,  0.862715,  0.862812,  0.862909,  0.863006,  0.863103,
-	 0.863199,  0.863296,  0.863393,  0.863490,  0.863586,  0.863683,  0.863780,  0.863876,
-	 0.863973,  0.864069,  0.864166,  0.864262,  0.864359,  0.864455,  0.864552,  0.864648,
-	 0.864744,  0.864841,  0.864937,  0.865033,  0.865129,  0.865225,  0.865321,  0.865418,
-	 0.865514,  0.865610,  0.865706,  0.865802,  0.865898,  0.865993,  0.866089,  0.866185,
-	 0.866281,  0.866377,  0.866472,  0.866568,  0.866664,  0.866759,  0.866855,  0.866951,
-	 0.867046,  0.867142,  0.867237,  0.867333,  0.867428,  0.867523,  0.867619,  0.867714,
-	 0.867809,  0.867905,  0.868000,  0.868095,  0.868190,  0.868285,  0.868381,  0.868476,
-	 0.868571,  0.868666,  0.868761,  0.868856,  0.868951,  0.869045,  0.869140,  0.869235,
-	 0.869330,  0.869425,  0.869519,  0.869614,  0.869709,  0.869803,  0.869898,  0.869992,
-	 0.870087,  0.870182,  0.870276,  0.870370,  0.870465,  0.870559,  0.870654,  0.870748,
-	 0.870842,  0.870936,  0.871031,  0.871125,  0.871219,  0.871313,  0.871407,  0.871501,
-	 0.871595,  0.871689,  0.871783,  0.871877,  0.871971,  0.872065,  0.872159,  0.872252,
-	 0.872346,  0.872440,  0.872534,  0.872627,  0.872721,  0.872814,  0.872908,  0.873001,
-	 0.873095,  0.873188,  0.873282,  0.873375,  0.873469,  0.873562,  0.873655,  0.873749,
-	 0.873842,  0.873935,  0.874028,  0.874121,  0.874215,  0.874308,  0.874401,  0.874494,
-	 0.874587,  0.874680,  0.874773,  0.874865,  0.874958,  0.875051,  0.875144,  0.875237,
-	 0.875329,  0.875422,  0.875515,  0.875607,  0.875700,  0.875793,  0.875885,  0.875978,
-	 0.876070,  0.876163,  0.876255,  0.876347,  0.876440,  0.876532,  0.876624,  0.876716,
-	 0.876809,  0.876901,  0.876993,  0.877085,  0.877177,  0.877269,  0.877361,  0.877453,
-	 0.877545,  0.877637,  0.877729,  0.877821,  0.877913,  0.878005,  0.878096,  0.878188,
-	 0.878280,  0.878371,  0.878463,  0.878555,  0.878646,  0.878738,  0.878829,  0.878921,
-	 0.879012,  0.879104,  0.879195,  0.879286,  0.879378,  0.879469,  0.879560,  0.879651,
-	 0.879743,  0.879834,  0.879925,  0.880016,  0.880107,  0.880198,  0.880289,  0.880380,
-	 0.880471,  0.880562,  0.880653,  0.880743,  0.880834,  0.880925,  0.881016,  0.881106,
-	 0.881197,  0.881288,  0.881378,  0.881469,  0.881559,  0.881650,  0.881740,  0.881831,
-	 0.881921,  0.882012,  0.882102,  0.882192,  0.882283,  0.882373,  0.882463,  0.882553,
-	 0.882643,  0.882733,  0.882824,  0.882914,  0.883004,  0.883094,  0.883184,  0.883273,
-	 0.883363,  0.883453,  0.883543,  0.883633,  0.883723,  0.883812,  0.883902,  0.883992,
-	 0.884081,  0.884171,  0.884260,  0.884350,  0.884439,  0.884529,  0.884618,  0.884708,
-	 0.884797,  0.884886,  0.884976,  0.885065,  0.885154,  0.885243,  0.885333,  0.885422,
-	 0.885511,  0.885600,  0.885689,  0.885778,  0.885867,  0.885956,  0.886045,  0.886134,
-	 0.886223,  0.886311,  0.886400,  0.886489,  0.886578,  0.886666,  0.886755,  0.886844,
-	 0.886932,  0.887021,  0.887109,  0.887198,  0.887286,  0.887375,  0.887463,  0.887551,
-	 0.887640,  0.887728,  0.887816,  0.887904,  0.887993,  0.888081,  0.888169,  0.888257,
-	 0.888345,  0.888433,  0.888521,  0.888609,  0.888697,  0.888785,  0.888873,  0.888961,
-	 0.889048,  0.889136,  0.889224,  0.889312,  0.889399,  0.889487,  0.889574,  0.889662,
-	 0.889750,  0.889837,  0.889925,  0.890012,  0.890099,  0.890187,  0.890274,  0.890361,
-	 0.890449,  0.890536,  0.890623,  0.890710,  0.890797,  0.890885,  0.890972,  0.891059,
-	 0.891146,  0.891233,  0.891320,  0.891407,  0.891493,  0.891580,  0.891667,  0.891754,
-	 0.891841,  0.891927,  0.892014,  0.892101,  0.892187,  0.892274,  0.892361,  0.892447,
-	 0.892534,  0.892620,  0.892706,  0.892793,  0.892879,  0.892965,  0.893052,  0.893138,
-	 0.893224,  0.893310,  0.893397,  0.893483,  0.893569,  0.893655,  0.893741,  0.893827,
-	 0.893913,  0.893999,  0.894085,  0.894171,  0.894256,  0.894342,  0.894428,  0.894514,
-	 0.894599,  0.894685,  0.894771,  0.894856,  0.894942,  0.895028,  0.895113,  0.895198,
-	 0.895284,  0.895369,  0.895455,  0.895540,  0.895625,  0.895711,  0.895796,  0.895881,
-	 0.895966,  0.896051,  0.896137,  0.896222,  0.896307,  0.896392,  0.896477,  0.896562,
-	 0.896646,  0.896731,  0.896816,  0.896901,  0.896986,  0.897071,  0.897155,  0.897240,
-	 0.897325,  0.897409,  0.897494,  0.897578,  0.897663,  0.897747,  0.897832,  0.897916,
-	 0.898001,  0.898085,  0.898169,  0.898254,  0.898338,  0.898422,  0.898506,  0.898590,
-	 0.898674,  0.898759,  0.898843,  0.898927,  0.899011,  0.899095,  0.899179,  0.899262,
-	 0.899346,  0.899430,  0.899514,  0.899598,  0.899681,  0.899765,  0.899849,  0.899932,
-	 0.900016,  0.900099,  0.900183,  0.900266,  0.900350,  0.900433,  0.900517,  0.900600,
-	 0.900683,  0.900767,  0.900850,  0.900933,  0.901016,  0.901100,  0.901183,  0.901266,
-	 0.901349,  0.901432,  0.901515,  0.901598,  0.901681,  0.901764,  0.901847,  0.901929,
-	 0.902012,  0.902095,  0.902178,  0.902260,  0.902343,  0.902426,  0.902508,  0.902591,
-	 0.902673,  0.902756,  0.902838,  0.902921,  0.903003,  0.903085,  0.903168,  0.903250,
-	 0.903332,  0.903415,  0.903497,  0.903579,  0.903661,  0.903743,  0.903825,  0.903907,
-	 0.903989,  0.904071,  0.904153,  0.904235,  0.904317,  0.904399,  0.904481,  0.904562,
-	 0.904644,  0.904726,  0.904807,  0.904889,  0.904971,  0.905052,  0.905134,  0.905215,
-	 0.905297,  0.905378,  0.905460,  0.905541,  0.905622,  0.905704,  0.905785,  0.905866,
-	 0.905947,  0.906028,  0.906110,  0.906191,  0.906272,  0.906353,  0.906434,  0.906515,
-	 0.906596,  0.906677,  0.906757,  0.906838,  0.906919,  0.907000,  0.907081,  0.907161,
-	 0.907242,  0.907323,  0.907403,  0.907484,  0.907564,  0.907645,  0.907725,  0.907806,
-	 0.907886,  0.907966,  0.908047,  0.908127,  0.908207,  0.908288,  0.908368,  0.908448,
-	 0.908528,  0.908608,  0.908688,  0.908768,  0.908848,  0.908928,  0.909008,  0.909088,
-	 0.909168,  0.909248,  0.909328,  0.909407,  0.909487,  0.909567,  0.909646,  0.909726,
-	 0.909806,  0.909885,  0.909965,  0.910044,  0.910124,  0.910203,  0.910283,  0.910362,
-	 0.910441,  0.910521,  0.910600,  0.910679,  0.910758,  0.910837,  0.910917,  0.910996,
-	 0.911075,  0.911154,  0.911233,  0.911312,  0.911391,  0.911470,  0.911548,  0.911627,
-	 0.911706,  0.911785,  0.911864,  0.911942,  0.912021,  0.912099,  0.912178,  0.912257,
-	 0.912335,  0.912414,  0.912492,  0.912571,  0.912649,  0.912727,  0.912806,  0.912884,
-	 0.912962,  0.913040,  0.913119,  0.913197,  0.913275,  0.913353,  0.913431,  0.913509,
-	 0.913587,  0.913665,  0.913743,  0.913821,  0.913899,  0.913976,  0.914054,  0.914132,
-	 0.914210,  0.914287,  0.914365,  0.914443,  0.914520,  0.914598,  0.914675,  0.914753,
-	 0.914830,  0.914908,  0.914985,  0.915062,  0.915140,  0.915217,  0.915294,  0.915372,
-	 0.915449,  0.915526,  0.915603,  0.915680,  0.915757,  0.915834,  0.915911,  0.915988,
-	 0.916065,  0.916142,  0.916219,  0.916296,  0.916372,  0.916449,  0.916526,  0.916602,
-	 0.916679,  0.916756,  0.916832,  0.916909,  0.916985,  0.917062,  0.917138,  0.917215,
-	 0.917291,  0.917367,  0.917444,  0.917520,  0.917596,  0.917672,  0.917749,  0.917825,
-	 0.917901,  0.917977,  0.918053,  0.918129,  0.918205,  0.918281,  0.918357,  0.918433,
-	 0.918508,  0.918584,  0.918660,  0.918736,  0.918811,  0.918887,  0.918963,  0.919038,
-	 0.919114,  0.919189,  0.919265,  0.919340,  0.919416,  0.919491,  0.919567,  0.919642,
-	 0.919717,  0.919792,  0.919868,  0.919943,  0.920018,  0.920093,  0.920168,  0.920243,
-	 0.920318,  0.920393,  0.920468,  0.920543,  0.920618,  0.920693,  0.920768,  0.920842,
-	 0.920917,  0.920992,  0.921067,  0.921141,  0.921216,  0.921291,  0.921365,  0.921440,
-	 0.921514,  0.921588,  0.921663,  0.921737,  0.921812,  0.921886,  0.921960,  0.922034,
-	 0.922109,  0.922183,  0.922257,  0.922331,  0.922405,  0.922479,  0.922553,  0.922627,
-	 0.922701,  0.922775,  0.922849,  0.922923,  0.922997,  0.923070,  0.923144,  0.923218,
-	 0.923291,  0.923365,  0.923439,  0.923512,  0.923586,  0.923659,  0.923733,  0.923806,
-	 0.923880,  0.923953,  0.924026,  0.924100,  0.924173,  0.924246,  0.924319,  0.924392,
-	 0.924465,  0.924539,  0.924612,  0.924685,  0.924758,  0.924831,  0.924904,  0.924976,
-	 0.925049,  0.925122,  0.925195,  0.925268,  0.925340,  0.925413,  0.925486,  0.925558,
-	 0.925631,  0.925703,  0.925776,  0.925848,  0.925921,  0.925993,  0.926066,  0.926138,
-	 0.926210,  0.926283,  0.926355,  0.926427,  0.926499,  0.926571,  0.926643,  0.926715,
-	 0.926787,  0.926859,  0.926931,  0.927003,  0.927075,  0.927147,  0.927219,  0.927291,
-	 0.927363,  0.927434,  0.927506,  0.927578,  0.927649,  0.927721,  0.927792,  0.927864,
-	 0.927935,  0.928007,  0.928078,  0.928150,  0.928221,  0.928292,  0.928364,  0.928435,
-	 0.928506,  0.928577,  0.928648,  0.928720,  0.928791,  0.928862,  0.928933,  0.929004,
-	 0.929075,  0.929146,  0.929216,  0.929287,  0.929358,  0.929429,  0.929500,  0.929570,
-	 0.929641,  0.929712,  0.929782,  0.929853,  0.929923,  0.929994,  0.930064,  0.930135,
-	 0.930205,  0.930275,  0.930346,  0.930416,  0.930486,  0.930556,  0.930627,  0.930697,
-	 0.930767,  0.930837,  0.930907,  0.930977,  0.931047,  0.931117,  0.931187,  0.931257,
-	 0.931327,  0.931397,  0.931466,  0.931536,  0.931606,  0.931675,  0.931745,  0.931815,
-	 0.931884,  0.931954,  0.932023,  0.932093,  0.932162,  0.932232,  0.932301,  0.932370,
-	 0.932440,  0.932509,  0.932578,  0.932647,  0.932716,  0.932786,  0.932855,  0.932924,
-	 0.932993,  0.933062,  0.933131,  0.933200,  0.933269,  0.933337,  0.933406,  0.933475,
-	 0.933544,  0.933612,  0.933681,  0.933750,  0.933818,  0.933887,  0.933956,  0.934024,
-	 0.934093,  0.934161,  0.934229,  0.934298,  0.934366,  0.934434,  0.934503,  0.934571,
-	 0.934639,  0.934707,  0.934775,  0.934844,  0.934912,  0.934980,  0.935048,  0.935116,
-	 0.935184,  0.935251,  0.935319,  0.935387,  0.935455,  0.935523,  0.935590,  0.935658,
-	 0.935726,  0.935793,  0.935861,  0.935928,  0.935996,  0.936063,  0.936131,  0.936198,
-	 0.936266,  0.936333,  0.936400,  0.936468,  0.936535,  0.936602,  0.936669,  0.936736,
-	 0.936803,  0.936871,  0.936938,  0.937005,  0.937072,  0.937138,  0.937205,  0.937272,
-	 0.937339,  0.937406,  0.937473,  0.937539,  0.937606,  0.937673,  0.937739,  0.937806,
-	 0.937872,  0.937939,  0.938005,  0.938072,  0.938138,  0.938205,  0.938271,  0.938337,
-	 0.938404,  0.938470,  0.938536,  0.938602,  0.938668,  0.938734,  0.938800,  0.938866,
-	 0.938932,  0.938998,  0.939064,  0.939130,  0.939196,  0.939262,  0.939328,  0.939394,
-	 0.939459,  0.939525,  0.939591,  0.939656,  0.939722,  0.939787,  0.939853,  0.939918,
-	 0.939984,  0.940049,  0.940115,  0.940180,  0.940245,  0.940310,  0.940376,  0.940441,
-	 0.940506,  0.940571,  0.940636,  0.940701,  0.940766,  0.940831,  0.940896,  0.940961,
-	 0.941026,  0.941091,  0.941156,  0.941221,  0.941285,  0.941350,  0.941415,  0.941479,
-	 0.941544,  0.941609,  0.941673,  0.941738,  0.941802,  0.941867,  0.941931,  0.941995,
-	 0.942060,  0.942124,  0.942188,  0.942253,  0.942317,  0.942381,  0.942445,  0.942509,
-	 0.942573,  0.942637,  0.942701,  0.942765,  0.942829,  0.942893,  0.942957,  0.943021,
-	 0.943084,  0.943148,  0.943212,  0.943276,  0.943339,  0.943403,  0.943466,  0.943530,
-	 0.943593,  0.943657,  0.943720,  0.943784,  0.943847,  0.943910,  0.943974,  0.944037,
-	 0.944100,  0.944163,  0.944227,  0.944290,  0.944353,  0.944416,  0.944479,  0.944542,
-	 0.944605,  0.944668,  0.944731,  0.944793,  0.944856,  0.944919,  0.944982,  0.945045,
-	 0.945107,  0.945170,  0.945232,  0.945295,  0.945358,  0.945420,  0.945482,  0.945545,
-	 0.945607,  0.945670,  0.945732,  0.945794,  0.945857,  0.945919,  0.945981,  0.946043,
-	 0.946105,  0.946167,  0.946229,  0.946291,  0.946353,  0.946415,  0.946477,  0.946539,
-	 0.946601,  0.946663,  0.946724,  0.946786,  0.946848,  0.946910,  0.946971,  0.947033,
-	 0.947094,  0.947156,  0.947217,  0.947279,  0.947340,  0.947402,  0.947463,  0.947524,
-	 0.947586,  0.947647,  0.947708,  0.947769,  0.947830,  0.947891,  0.947953,  0.948014,
-	 0.948075,  0.948136,  0.948196,  0.948257,  0.948318,  0.948379,  0.948440,  0.948501,
-	 0.948561,  0.948622,  0.948683,  0.948743,  0.948804,  0.948864,  0.948925,  0.948985,
-	 0.949046,  0.949106,  0.949167,  0.949227,  0.949287,  0.949348,  0.949408,  0.949468,
-	 0.949528,  0.949588,  0.949648,  0.949708,  0.949768,  0.949829,  0.949888,  0.949948,
-	 0.950008,  0.950068,  0.950128,  0.950188,  0.950247,  0.950307,  0.950367,  0.950426,
-	 0.950486,  0.950546,  0.950605,  0.950665,  0.950724,  0.950784,  0.950843,  0.950902,
-	 0.950962,  0.951021,  0.951080,  0.951139,  0.951199,  0.951258,  0.951317,  0.951376,
-	 0.951435,  0.951494,  0.951553,  0.951612,  0.951671,  0.951730,  0.951789,  0.951847,
-	 0.951906,  0.951965,  0.952024,  0.952082,  0.952141,  0.952199,  0.952258,  0.952317,
-	 0.952375,  0.952433,  0.952492,  0.952550,  0.952609,  0.952667,  0.952725,  0.952783,
-	 0.952842,  0.952900,  0.952958,  0.953016,  0.953074,  0.953132,  0.953190,  0.953248,
-	 0.953306,  0.953364,  0.953422,  0.953480,  0.953537,  0.953595,  0.953653,  0.953711,
-	 0.953768,  0.953826,  0.953883,  0.953941,  0.953998,  0.954056,  0.954113,  0.954171,
-	 0.954228,  0.954285,  0.954343,  0.954400,  0.954457,  0.954514,  0.954572,  0.954629,
-	 0.954686,  0.954743,  0.954800,  0.954857,  0.954914,  0.954971,  0.955028,  0.955084,
-	 0.955141,  0.955198,  0.955255,  0.955311,  0.955368,  0.955425,  0.955481,  0.955538,
-	 0.955594,  0.955651,  0.955707,  0.955764,  0.955820,  0.955876,  0.955933,  0.955989,
-	 0.956045,  0.956101,  0.956158,  0.956214,  0.956270,  0.956326,  0.956382,  0.956438,
-	 0.956494,  0.956550,  0.956606,  0.956662,  0.956717,  0.956773,  0.956829,  0.956885,
-	 0.956940,  0.956996,  0.957052,  0.957107,  0.957163,  0.957218,  0.957274,  0.957329,
-	 0.957385,  0.957440,  0.957495,  0.957550,  0.957606,  0.957661,  0.957716,  0.957771,
-	 0.957826,  0.957882,  0.957937,  0.957992,  0.958046,  0.958101,  0.958156,  0.958211,
-	 0.958266,  0.958321,  0.958376,  0.958430,  0.958485,  0.958540,  0.958594,  0.958649,
-	 0.958703,  0.958758,  0.958812,  0.958867,  0.958921,  0.958976,  0.959030,  0.959084,
-	 0.959139,  0.959193,  0.959247,  0.959301,  0.959355,  0.959409,  0.959463,  0.959518,
-	 0.959572,  0.959625,  0.959679,  0.959733,  0.959787,  0.959841,  0.959895,  0.959948,
-	 0.960002,  0.960056,  0.960109,  0.960163,  0.960217,  0.960270,  0.960324,  0.960377,
-	 0.960431,  0.960484,  0.960537,  0.960591,  0.960644,  0.960697,  0.960750,  0.960804,
-	 0.960857,  0.960910,  0.960963,  0.961016,  0.961069,  0.961122,  0.961175,  0.961228,
-	 0.961280,  0.961333,  0.961386,  0.961439,  0.961492,  0.961544,  0.961597,  0.961649,
-	 0.961702,  0.961755,  0.961807,  0.961860,  0.961912,  0.961964,  0.962017,  0.962069,
-	 0.962121,  0.962174,  0.962226,  0.962278,  0.962330,  0.962382,  0.962434,  0.962486,
-	 0.962538,  0.962590,  0.962642,  0.962694,  0.962746,  0.962798,  0.962850,  0.962902,
-	 0.962953,  0.963005,  0.963057,  0.963108,  0.963160,  0.963211,  0.963263,  0.963314,
-	 0.963366,  0.963417,  0.963469,  0.963520,  0.963571,  0.963623,  0.963674,  0.963725,
-	 0.963776,  0.963827,  0.963878,  0.963929,  0.963980,  0.964031,  0.964082,  0.964133,
-	 0.964184,  0.964235,  0.964286,  0.964336,  0.964387,  0.964438,  0.964489,  0.964539,
-	 0.964590,  0.964640,  0.964691,  0.964741,  0.964792,  0.964842,  0.964893,  0.964943,
-	 0.964993,  0.965044,  0.965094,  0.965144,  0.965194,  0.965244,  0.965294,  0.965344,
-	 0.965394,  0.965444,  0.965494,  0.965544,  0.965594,  0.965644,  0.965694,  0.965744,
-	 0.965793,  0.965843,  0.965893,  0.965942,  0.965992,  0.966042,  0.966091,  0.966141,
-	 0.966190,  0.966239,  0.966289,  0.966338,  0.966387,  0.966437,  0.966486,  0.966535,
-	 0.966584,  0.966633,  0.966683,  0.966732,  0.966781,  0.966830,  0.966879,  0.966928,
-	 0.966976,  0.967025,  0.967074,  0.967123,  0.967172,  0.967220,  0.967269,  0.967318,
-	 0.967366,  0.967415,  0.967463,  0.967512,  0.967560,  0.967609,  0.967657,  0.967706,
-	 0.967754,  0.967802,  0.967850,  0.967899,  0.967947,  0.967995,  0.968043,  0.968091,
-	 0.968139,  0.968187,  0.968235,  0.968283,  0.968331,  0.968379,  0.968427,  0.968474,
-	 0.968522,  0.968570,  0.968617,  0.968665,  0.968713,  0.968760,  0.968808,  0.968855,
-	 0.968903,  0.968950,  0.968998,  0.969045,  0.969092,  0.969140,  0.969187,  0.969234,
-	 0.969281,  0.969328,  0.969375,  0.969423,  0.969470,  0.969517,  0.969564,  0.969611,
-	 0.969657,  0.969704,  0.969751,  0.969798,  0.969845,  0.969891,  0.969938,  0.969985,
-	 0.970031,  0.970078,  0.970124,  0.970171,  0.970217,  0.970264,  0.970310,  0.970357,
-	 0.970403,  0.970449,  0.970495,  0.970542,  0.970588,  0.970634,  0.970680,  0.970726,
-	 0.970772,  0.970818,  0.970864,  0.970910,  0.970956,  0.971002,  0.971048,  0.971093,
-	 0.971139,  0.971185,  0.971231,  0.971276,  0.971322,  0.971367,  0.971413,  0.971458,
-	 0.971504,  0.971549,  0.971595,  0.971640,  0.971685,  0.971731,  0.971776,  0.971821,
-	 0.971866,  0.971911,  0.971957,  0.972002,  0.972047,  0.972092,  0.972137,  0.972182,
-	 0.972227,  0.972271,  0.972316,  0.972361,  0.972406,  0.972450,  0.972495,  0.972540,
-	 0.972584,  0.972629,  0.972673,  0.972718,  0.972762,  0.972807,  0.972851,  0.972896,
-	 0.972940,  0.972984,  0.973028,  0.973073,  0.973117,  0.973161,  0.973205,  0.973249,
-	 0.973293,  0.973337,  0.973381,  0.973425,  0.973469,  0.973513,  0.973557,  0.973601,
-	 0.973644,  0.973688,  0.973732,  0.973775,  0.973819,  0.973862,  0.973906,  0.973949,
-	 0.973993,  0.974036,  0.974080,  0.974123,  0.974166,  0.974210,  0.974253,  0.974296,
-	 0.974339,  0.974383,  0.974426,  0.974469,  0.974512,  0.974555,  0.974598,  0.974641,
-	 0.974684,  0.974726,  0.974769,  0.974812,  0.974855,  0.974897,  0.974940,  0.974983,
-	 0.975025,  0.975068,  0.975110,  0.975153,  0.975195,  0.975238,  0.975280,  0.975323,
-	 0.975365,  0.975407,  0.975449,  0.975492,  0.975534,  0.975576,  0.975618,  0.975660,
-	 0.975702,  0.975744,  0.975786,  0.975828,  0.975870,  0.975912,  0.975954,  0.975995,
-	 0.976037,  0.976079,  0.976120,  0.976162,  0.976204,  0.976245,  0.976287,  0.976328,
-	 0.976370,  0.976411,  0.976453,  0.976494,  0.976535,  0.976576,  0.976618,  0.976659,
-	 0.976700,  0.976741,  0.976782,  0.976823,  0.976864,  0.976905,  0.976946,  0.976987,
-	 0.977028,  0.977069,  0.977110,  0.977151,  0.977191,  0.977232,  0.977273,  0.977313,
-	 0.977354,  0.977394,  0.977435,  0.977475,  0.977516,  0.977556,  0.977597,  0.977637,
-	 0.977677,  0.977718,  0.977758,  0.977798,  0.977838,  0.977878,  0.977918,  0.977959,
-	 0.977998,  0.978038,  0.978078,  0.978118,  0.978158,  0.978198,  0.978238,  0.978278,
-	 0.978317,  0.978357,  0.978397,  0.978436,  0.978476,  0.978516,  0.978555,  0.978594,
-	 0.978634,  0.978673,  0.978713,  0.978752,  0.978791,  0.978831,  0.978870,  0.978909,
-	 0.978948,  0.978987,  0.979026,  0.979065,  0.979104,  0.979143,  0.979182,  0.979221,
-	 0.979260,  0.979299,  0.979338,  0.979376,  0.979415,  0.979454,  0.979493,  0.979531,
-	 0.979570,  0.979608,  0.979647,  0.979685,  0.979724,  0.979762,  0.979800,  0.979839,
-	 0.979877,  0.979915,  0.979954,  0.979992,  0.980030,  0.980068,  0.980106,  0.980144,
-	 0.980182,  0.980220,  0.980258,  0.980296,  0.980334,  0.980372,  0.980409,  0.980447,
-	 0.980485,  0.980523,  0.980560,  0.980598,  0.980635,  0.980673,  0.980710,  0.980748,
-	 0.980785,  0.980823,  0.980860,  0.980897,  0.980935,  0.980972,  0.981009,  0.981046,
-	 0.981083,  0.981120,  0.981158,  0.981195,  0.981232,  0.981269,  0.981305,  0.981342,
-	 0.981379,  0.981416,  0.981453,  0.981490,  0.981526,  0.981563,  0.981600,  0.981636,
-	 0.981673,  0.981709,  0.981746,  0.981782,  0.981819,  0.981855,  0.981891,  0.981928,
-	 0.981964,  0.982000,  0.982036,  0.982072,  0.982109,  0.982145,  0.982181,  0.982217,
-	 0.982253,  0.982289,  0.982325,  0.982360,  0.982396,  0.982432,  0.982468,  0.982504,
-	 0.982539,  0.982575,  0.982611,  0.982646,  0.982682,  0.982717,  0.982753,  0.982788,
-	 0.982824,  0.982859,  0.982894,  0.982930,  0.982965,  0.983000,  0.983035,  0.983070,
-	 0.983105,  0.983141,  0.983176,  0.983211,  0.983246,  0.983281,  0.983315,  0.983350,
-	 0.983385,  0.983420,  0.983455,  0.983489,  0.983524,  0.983559,  0.983593,  0.983628,
-	 0.983662,  0.983697,  0.983731,  0.983766,  0.983800,  0.983835,  0.983869,  0.983903,
-	 0.983937,  0.983972,  0.984006,  0.984040,  0.984074,  0.984108,  0.984142,  0.984176,
-	 0.984210,  0.984244,  0.984278,  0.984312,  0.984346,  0.984379,  0.984413,  0.984447,
-	 0.984480,  0.984514,  0.984548,  0.984581,  0.984615,  0.984648,  0.984682,  0.984715,
-	 0.984748,  0.984782,  0.984815,  0.984848,  0.984882,  0.984915,  0.984948,  0.984981,
-	 0.985014,  0.985047,  0.985080,  0.985113,  0.985146,  0.985179,  0.985212,  0.985245,
-	 0.985278,  0.985310,  0.985343,  0.985376,  0.985408,  0.985441,  0.985474,  0.985506,
-	 0.985539,  0.985571,  0.985604,  0.985636,  0.985668,  0.985701,  0.985733,  0.985765,
-	 0.985798,  0.985830,  0.985862,  0.985894,  0.985926,  0.985958,  0.985990,  0.986022,
-	 0.986054,  0.986086,  0.986118,  0.986150,  0.986181,  0.986213,  0.986245,  0.986276,
-	 0.986308,  0.986340,  0.986371,  0.986403,  0.986434,  0.986466,  0.986497,  0.986529,
-	 0.986560,  0.986591,  0.986623,  0.986654,  0.986685,  0.986716,  0.986747,  0.986778,
-	 0.986809,  0.986840,  0.986871,  0.986902,  0.986933,  0.986964,  0.986995,  0.987026,
-	 0.987057,  0.987087,  0.987118,  0.987149,  0.987179,  0.987210,  0.987240,  0.987271,
-	 0.987301,  0.987332,  0.987362,  0.987393,  0.987423,  0.987453,  0.987484,  0.987514,
-	 0.987544,  0.987574,  0.987604,  0.987634,  0.987664,  0.987694,  0.987724,  0.987754,
-	 0.987784,  0.987814,  0.987844,  0.987874,  0.987903,  0.987933,  0.987963,  0.987992,
-	 0.988022,  0.988052,  0.988081,  0.988111,  0.988140,  0.988169,  0.988199,  0.988228,
-	 0.988258,  0.988287,  0.988316,  0.988345,  0.988374,  0.988404,  0.988433,  0.988462,
-	 0.988491,  0.988520,  0.988549,  0.988578,  0.988607,  0.988635,  0.988664,  0.988693,
-	 0.988722,  0.988750,  0.988779,  0.988808,  0.988836,  0.988865,  0.988893,  0.988922,
-	 0.988950,  0.988979,  0.989007,  0.989035,  0.989064,  0.989092,  0.989120,  0.989148,
-	 0.989177,  0.989205,  0.989233,  0.989261,  0.989289,  0.989317,  0.989345,  0.989373,
-	 0.989400,  0.989428,  0.989456,  0.989484,  0.989511,  0.989539,  0.989567,  0.989594,
-	 0.989622,  0.989650,  0.989677,  0.989704,  0.989732,  0.989759,  0.989787,  0.989814,
-	 0.989841,  0.989869,  0.989896,  0.989923,  0.989950,  0.989977,  0.990004,  0.990031,
-	 0.990058,  0.990085,  0.990112,  0.990139,  0.990166,  0.990193,  0.990219,  0.990246,
-	 0.990273,  0.990299,  0.990326,  0.990353,  0.990379,  0.990406,  0.990432,  0.990459,
-	 0.990485,  0.990511,  0.990538,  0.990564,  0.990590,  0.990617,  0.990643,  0.990669,
-	 0.990695,  0.990721,  0.990747,  0.990773,  0.990799,  0.990825,  0.990851,  0.990877,
-	 0.990903,  0.990928,  0.990954,  0.990980,  0.991006,  0.991031,  0.991057,  0.991082,
-	 0.991108,  0.991133,  0.991159,  0.991184,  0.991210,  0.991235,  0.991260,  0.991286,
-	 0.991311,  0.991336,  0.991361,  0.991386,  0.991411,  0.991437,  0.991462,  0.991487,
-	 0.991511,  0.991536,  0.991561,  0.991586,  0.991611,  0.991636,  0.991660,  0.991685,
-	 0.991710,  0.991734,  0.991759,  0.991783,  0.991808,  0.991832,  0.991857,  0.991881,
-	 0.991906,  0.991930,  0.991954,  0.991979,  0.992003,  0.992027,  0.992051,  0.992075,
-	 0.992099,  0.992123,  0.992147,  0.992171,  0.992195,  0.992219,  0.992243,  0.992267,
-	 0.992291,  0.992314,  0.992338,  0.992362,  0.992385,  0.992409,  0.992433,  0.992456,
-	 0.992480,  0.992503,  0.992526,  0.992550,  0.992573,  0.992596,  0.992620,  0.992643,
-	 0.992666,  0.992689,  0.992712,  0.992736,  0.992759,  0.992782,  0.992805,  0.992828,
-	 0.992850,  0.992873,  0.992896,  0.992919,  0.992942,  0.992964,  0.992987,  0.993010,
-	 0.993032,  0.993055,  0.993077,  0.993100,  0.993122,  0.993145,  0.993167,  0.993190,
-	 0.993212,  0.993234,  0.993257,  0.993279,  0.993301,  0.993323,  0.993345,  0.993367,
-	 0.993389,  0.993411,  0.993433,  0.993455,  0.993477,  0.993499,  0.993521,  0.993542,
-	 0.993564,  0.993586,  0.993608,  0.993629,  0.993651,  0.993672,  0.993694,  0.993715,
-	 0.993737,  0.993758,  0.993779,  0.993801,  0.993822,  0.993843,  0.993865,  0.993886,
-	 0.993907,  0.993928,  0.993949,  0.993970,  0.993991,  0.994012,  0.994033,  0.994054,
-	 0.994075,  0.994096,  0.994116,  0.994137,  0.994158,  0.994179,  0.994199,  0.994220,
-	 0.994240,  0.994261,  0.994281,  0.994302,  0.994322,  0.994343,  0.994363,  0.994383,
-	 0.994404,  0.994424,  0.994444,  0.994464,  0.994484,  0.994505,  0.994525,  0.994545,
-	 0.994565,  0.994585,  0.994604,  0.994624,  0.994644,  0.994664,  0.994684,  0.994703,
-	 0.994723,  0.994743,  0.994762,  0.994782,  0.994802,  0.994821,  0.994841,  0.994860,
-	 0.994879,  0.994899,  0.994918,  0.994937,  0.994957,  0.994976,  0.994995,  0.995014,
-	 0.995033,  0.995052,  0.995071,  0.995090,  0.995109,  0.995128,  0.995147,  0.995166,
-	 0.995185,  0.995203,  0.995222,  0.995241,  0.995260,  0.995278,  0.995297,  0.995315,
-	 0.995334,  0.995352,  0.995371,  0.995389,  0.995408,  0.995426,  0.995444,  0.995463,
-	 0.995481,  0.995499,  0.995517,  0.995535,  0.995553,  0.995571,  0.995589,  0.995607,
-	 0.995625,  0.995643,  0.995661,  0.995679,  0.995697,  0.995714,  0.995732,  0.995750,
-	 0.995767,  0.995785,  0.995803,  0.995820,  0.995838,  0.995855,  0.995872,  0.995890,
-	 0.995907,  0.995925,  0.995942,  0.995959,  0.995976,  0.995993,  0.996011,  0.996028,
-	 0.996045,  0.996062,  0.996079,  0.996096,  0.996113,  0.996129,  0.996146,  0.996163,
-	 0.996180,  0.996197,  0.996213,  0.996230,  0.996247,  0.996263,  0.996280,  0.996296,
-	 0.996313,  0.996329,  0.996345,  0.996362,  0.996378,  0.996394,  0.996411,  0.996427,
-	 0.996443,  0.996459,  0.996475,  0.996491,  0.996507,  0.996523,  0.996539,  0.996555,
-	 0.996571,  0.996587,  0.996603,  0.996619,  0.996634,  0.996650,  0.996666,  0.996681,
-	 0.996697,  0.996712,  0.996728,  0.996743,  0.996759,  0.996774,  0.996790,  0.996805,
-	 0.996820,  0.996836,  0.996851,  0.996866,  0.996881,  0.996896,  0.996911,  0.996926,
-	 0.996941,  0.996956,  0.996971,  0.996986,  0.997001,  0.997016,  0.997031,  0.997045,
-	 0.997060,  0.997075,  0.997089,  0.997104,  0.997119,  0.997133,  0.997148,  0.997162,
-	 0.997176,  0.997191,  0.997205,  0.997219,  0.997234,  0.997248,  0.997262,  0.997276,
-	 0.997290,  0.997305,  0.997319,  0.997333,  0.997347,  0.997361,  0.997374,  0.997388,
-	 0.997402,  0.997416,  0.997430,  0.997443,  0.997457,  0.997471,  0.997484,  0.997498,
-	 0.997511,  0.997525,  0.997538,  0.997552,  0.997565,  0.997579,  0.997592,  0.997605,
-	 0.997618,  0.997632,  0.997645,  0.997658,  0.997671,  0.997684,  0.997697,  0.997710,
-	 0.997723,  0.997736,  0.997749,  0.997762,  0.997774,  0.997787,  0.997800,  0.997813,
-	 0.997825,  0.997838,  0.997851,  0.997863,  0.997876,  0.997888,  0.997901,  0.997913,
-	 0.997925,  0.997938,  0.997950,  0.997962,  0.997974,  0.997987,  0.997999,  0.998011,
-	 0.998023,  0.998035,  0.998047,  0.998059,  0.998071,  0.998083,  0.998094,  0.998106,
-	 0.998118,  0.998130,  0.998142,  0.998153,  0.998165,  0.998176,  0.998188,  0.998200,
-	 0.998211,  0.998222,  0.998234,  0.998245,  0.998257,  0.998268,  0.998279,  0.998290,
-	 0.998302,  0.998313,  0.998324,  0.998335,  0.998346,  0.998357,  0.998368,  0.998379,
-	 0.998390,  0.998401,  0.998411,  0.998422,  0.998433,  0.998444,  0.998454,  0.998465,
-	 0.998476,  0.998486,  0.998497,  0.998507,  0.998518,  0.998528,  0.998538,  0.998549,
-	 0.998559,  0.998569,  0.998580,  0.998590,  0.998600,  0.998610,  0.998620,  0.998630,
-	 0.998640,  0.998650,  0.998660,  0.998670,  0.998680,  0.998690,  0.998700,  0.998709,
-	 0.998719,  0.998729,  0.998738,  0.998748,  0.998758,  0.998767,  0.998777,  0.998786,
-	 0.998795,  0.998805,  0.998814,  0.998824,  0.998833,  0.998842,  0.998851,  0.998860,
-	 0.998870,  0.998879,  0.998888,  0.998897,  0.998906,  0.998915,  0.998924,  0.998932,
-	 0.998941,  0.998950,  0.998959,  0.998968,  0.998976,  0.998985,  0.998994,  0.999002,
-	 0.999011,  0.999019,  0.999028,  0.999036,  0.999044,  0.999053,  0.999061,  0.999069,
-	 0.999078,  0.999086,  0.999094,  0.999102,  0.999110,  0.999118,  0.999126,  0.999134,
-	 0.999142,  0.999150,  0.999158,  0.999166,  0.999174,  0.999182,  0.999189,  0.999197,
-	 0.999205,  0.999212,  0.999220,  0.999228,  0.999235,  0.999243,  0.999250,  0.999257,
-	 0.999265,  0.999272,  0.999279,  0.999287,  0.999294,  0.999301,  0.999308,  0.999315,
-	 0.999322,  0.999329,  0.999336,  0.999343,  0.999350,  0.999357,  0.999364,  0.999371,
-	 0.999378,  0.999384,  0.999391,  0.999398,  0.999404,  0.999411,  0.999418,  0.999424,
-	 0.999431,  0.999437,  0.999443,  0.999450,  0.999456,  0.999462,  0.999469,  0.999475,
-	 0.999481,  0.999487,  0.999493,  0.999500,  0.999506,  0.999512,  0.999518,  0.999524,
-	 0.999529,  0.999535,  0.999541,  0.999547,  0.999553,  0.999558,  0.999564,  0.999570,
-	 0.999575,  0.999581,  0.999586,  0.999592,  0.999597,  0.999603,  0.999608,  0.999614,
-	 0.999619,  0.999624,  0.999629,  0.999635,  0.999640,  0.999645,  0.999650,  0.999655,
-	 0.999660,  0.999665,  0.999670,  0.999675,  0.999680,  0.999685,  0.999689,  0.999694,
-	 0.999699,  0.999704,  0.999708,  0.999713,  0.999717,  0.999722,  0.999726,  0.999731,
-	 0.999735,  0.999740,  0.999744,  0.999748,  0.999753,  0.999757,  0.999761,  0.999765,
-	 0.999769,  0.999774,  0.999778,  0.999782,  0.999786,  0.999790,  0.999793,  0.999797,
-	 0.999801,  0.999805,  0.999809,  0.999812,  0.999816,  0.999820,  0.999823,  0.999827,
-	 0.999831,  0.999834,  0.999838,  0.999841,  0.999844,  0.999848,  0.999851,  0.999854,
-	 0.999858,  0.999861,  0.999864,  0.999867,  0.999870,  0.999873,  0.999876,  0.999879,
-	 0.999882,  0.999885,  0.999888,  0.999891,  0.999894,  0.999897,  0.999899,  0.999902,
-	 0.999905,  0.999907,  0.999910,  0.999913,  0.999915,  0.999917,  0.999920,  0.999922,
-	 0.999925,  0.999927,  0.999929,  0.999932,  0.999934,  0.999936,  0.999938,  0.999940,
-	 0.999942,  0.999944,  0.999946,  0.999948,  0.999950,  0.999952,  0.999954,  0.999956,
-	 0.999958,  0.999959,  0.999961,  0.999963,  0.999964,  0.999966,  0.999968,  0.999969,
-	 0.999971,  0.999972,  0.999973,  0.999975,  0.999976,  0.999977,  0.999979,  0.999980,
-	 0.999981,  0.999982,  0.999983,  0.999985,  0.999986,  0.999987,  0.999988,  0.999988,
-	 0.999989,  0.999990,  0.999991,  0.999992,  0.999993,  0.999993,  0.999994,  0.999995,
-	 0.999995,  0.999996,  0.999996,  0.999997,  0.999997,  0.999998,  0.999998,  0.999999,
-	 0.999999,  0.999999,  0.999999,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000
-};
+		// cos(2 * pi * i / n) for the first quarter, mirrored for the second
+		for (int i = 0; i <= (n / 4); i++)
+			table[i] = cos(i * freq);
 
-static const float cosTable65536[32768] = {
-	 1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,
-	 1.000000,  1.000000,  1.000000,  0.999999,  0.999999,  0.999999,  0.999999,  0.999999,
-	 0.999999,  0.999999,  0.999999,  0.999998,  0.999998,  0.999998,  0.999998,  0.999998,
-	 0.999997,  0.999997,  0.999997,  0.999997,  0.999996,  0.999996,  0.999996,  0.999996,
-	 0.999995,  0.999995,  0.999995,  0.999994,  0.999994,  0.999994,  0.999993,  0.999993,
-	 0.999993,  0.999992,  0.999992,  0.999991,  0.999991,  0.999991,  0.999990,  0.999990,
-	 0.999989,  0.999989,  0.999988,  0.999988,  0.999988,  0.999987,  0.999987,  0.999986,
-	 0.999986,  0.999985,  0.999985,  0.999984,  0.999983,  0.999983,  0.999982,  0.999982,
-	 0.999981,  0.999981,  0.999980,  0.999979,  0.999979,  0.999978,  0.999977,  0.999977,
-	 0.999976,  0.999976,  0.999975,  0.999974,  0.999973,  0.999973,  0.999972,  0.999971,
-	 0.999971,  0.999970,  0.999969,  0.999968,  0.999968,  0.999967,  0.999966,  0.999965,
-	 0.999964,  0.999964,  0.999963,  0.999962,  0.999961,  0.999960,  0.999959,  0.999959,
-	 0.999958,  0.999957,  0.999956,  0.999955,  0.999954,  0.999953,  0.999952,  0.999951,
-	 0.999950,  0.999949,  0.999948,  0.999947,  0.999946,  0.999945,  0.999944,  0.999943,
-	 0.999942,  0.999941,  0.999940,  0.999939,  0.999938,  0.999937,  0.999936,  0.999935,
-	 0.999934,  0.999933,  0.999932,  0.999930,  0.999929,  0.999928,  0.999927,  0.999926,
-	 0.999925,  0.999924,  0.999922,  0.999921,  0.999920,  0.999919,  0.999917,  0.999916,
-	 0.999915,  0.999914,  0.999913,  0.999911,  0.999910,  0.999909,  0.999907,  0.999906,
-	 0.999905,  0.999903,  0.999902,  0.999901,  0.999899,  0.999898,  0.999897,  0.999895,
-	 0.999894,  0.999892,  0.999891,  0.999890,  0.999888,  0.999887,  0.999885,  0.999884,
-	 0.999882,  0.999881,  0.999879,  0.999878,  0.999876,  0.999875,  0.999873,  0.999872,
-	 0.999870,  0.999869,  0.999867,  0.999866,  0.999864,  0.999862,  0.999861,  0.999859,
-	 0.999858,  0.999856,  0.999854,  0.999853,  0.999851,  0.999849,  0.999848,  0.999846,
-	 0.999844,  0.999843,  0.999841,  0.999839,  0.999838,  0.999836,  0.999834,  0.999832,
-	 0.999831,  0.999829,  0.999827,  0.999825,  0.999823,  0.999822,  0.999820,  0.999818,
-	 0.999816,  0.999814,  0.999812,  0.999811,  0.999809,  0.999807,  0.999805,  0.999803,
-	 0.999801,  0.999799,  0.999797,  0.999795,  0.999793,  0.999792,  0.999790,  0.999788,
-	 0.999786,  0.999784,  0.999782,  0.999780,  0.999778,  0.999776,  0.999774,  0.999771,
-	 0.999769,  0.999767,  0.999765,  0.999763,  0.999761,  0.999759,  0.999757,  0.999755,
-	 0.999753,  0.999750,  0.999748,  0.999746,  0.999744,  0.999742,  0.999740,  0.999738,
-	 0.999735,  0.999733,  0.999731,  0.999729,  0.999726,  0.999724,  0.999722,  0.999720,
-	 0.999717,  0.999715,  0.999713,  0.999710,  0.999708,  0.999706,  0.999704,  0.999701,
-	 0.999699,  0.999696,  0.999694,  0.999692,  0.999689,  0.999687,  0.999685,  0.999682,
-	 0.999680,  0.999677,  0.999675,  0.999672,  0.999670,  0.999667,  0.999665,  0.999663,
-	 0.999660,  0.999658,  0.999655,  0.999652,  0.999650,  0.999647,  0.999645,  0.999642,
-	 0.999640,  0.999637,  0.999635,  0.999632,  0.999629,  0.999627,  0.999624,  0.999621,
-	 0.999619,  0.999616,  0.999614,  0.999611,  0.999608,  0.999605,  0.999603,  0.999600,
-	 0.999597,  0.999595,  0.999592,  0.999589,  0.999586,  0.999584,  0.999581,  0.999578,
-	 0.999575,  0.999573,  0.999570,  0.999567,  0.999564,  0.999561,  0.999558,  0.999556,
-	 0.999553,  0.999550,  0.999547,  0.999544,  0.999541,  0.999538,  0.999535,  0.999532,
-	 0.999529,  0.999527,  0.999524,  0.999521,  0.999518,  0.999515,  0.999512,  0.999509,
-	 0.999506,  0.999503,  0.999500,  0.999497,  0.999493,  0.999490,  0.999487,  0.999484,
-	 0.999481,  0.999478,  0.999475,  0.999472,  0.999469,  0.999466,  0.999462,  0.999459,
-	 0.999456,  0.999453,  0.999450,  0.999447,  0.999443,  0.999440,  0.999437,  0.999434,
-	 0.999431,  0.999427,  0.999424,  0.999421,  0.999418,  0.999414,  0.999411,  0.999408,
-	 0.999404,  0.999401,  0.999398,  0.999394,  0.999391,  0.999388,  0.999384,  0.999381,
-	 0.999378,  0.999374,  0.999371,  0.999367,  0.999364,  0.999361,  0.999357,  0.999354,
-	 0.999350,  0.999347,  0.999343,  0.999340,  0.999336,  0.999333,  0.999329,  0.999326,
-	 0.999322,  0.999319,  0.999315,  0.999312,  0.999308,  0.999305,  0.999301,  0.999297,
-	 0.999294,  0.999290,  0.999287,  0.999283,  0.999279,  0.999276,  0.999272,  0.999268,
-	 0.999265,  0.999261,  0.999257,  0.999254,  0.999250,  0.999246,  0.999243,  0.999239,
-	 0.999235,  0.999231,  0.999228,  0.999224,  0.999220,  0.999216,  0.999212,  0.999209,
-	 0.999205,  0.999201,  0.999197,  0.999193,  0.999189,  0.999186,  0.999182,  0.999178,
-	 0.999174,  0.999170,  0.999166,  0.999162,  0.999158,  0.999154,  0.999150,  0.999146,
-	 0.999142,  0.999138,  0.999134,  0.999130,  0.999126,  0.999122,  0.999118,  0.999114,
-	 0.999110,  0.999106,  0.999102,  0.999098,  0.999094,  0.999090,  0.999086,  0.999082,
-	 0.999078,  0.999074,  0.999069,  0.999065,  0.999061,  0.999057,  0.999053,  0.999049,
-	 0.999044,  0.999040,  0.999036,  0.999032,  0.999028,  0.999023,  0.999019,  0.999015,
-	 0.999011,  0.999006,  0.999002,  0.998998,  0.998994,  0.998989,  0.998985,  0.998981,
-	 0.998976,  0.998972,  0.998968,  0.998963,  0.998959,  0.998954,  0.998950,  0.998946,
-	 0.998941,  0.998937,  0.998932,  0.998928,  0.998924,  0.998919,  0.998915,  0.998910,
-	 0.998906,  0.998901,  0.998897,  0.998892,  0.998888,  0.998883,  0.998879,  0.998874,
-	 0.998870,  0.998865,  0.998860,  0.998856,  0.998851,  0.998847,  0.998842,  0.998837,
-	 0.998833,  0.998828,  0.998824,  0.998819,  0.998814,  0.998810,  0.998805,  0.998800,
-	 0.998795,  0.998791,  0.998786,  0.998781,  0.998777,  0.998772,  0.998767,  0.998762,
-	 0.998758,  0.998753,  0.998748,  0.998743,  0.998738,  0.998734,  0.998729,  0.998724,
-	 0.998719,  0.998714,  0.998709,  0.998704,  0.998700,  0.998695,  0.998690,  0.998685,
-	 0.998680,  0.998675,  0.998670,  0.998665,  0.998660,  0.998655,  0.998650,  0.998645,
-	 0.998640,  0.998635,  0.998630,  0.998625,  0.998620,  0.998615,  0.998610,  0.998605,
-	 0.998600,  0.998595,  0.998590,  0.998585,  0.998580,  0.998574,  0.998569,  0.998564,
-	 0.998559,  0.998554,  0.998549,  0.998544,  0.998538,  0.998533,  0.998528,  0.998523,
-	 0.998518,  0.998512,  0.998507,  0.998502,  0.998497,  0.998491,  0.998486,  0.998481,
-	 0.998476,  0.998470,  0.998465,  0.998460,  0.998454,  0.998449,  0.998444,  0.998438,
-	 0.998433,  0.998428,  0.998422,  0.998417,  0.998411,  0.998406,  0.998401,  0.998395,
-	 0.998390,  0.998384,  0.998379,  0.998373,  0.998368,  0.998362,  0.998357,  0.998351,
-	 0.998346,  0.998340,  0.998335,  0.998329,  0.998324,  0.998318,  0.998313,  0.998307,
-	 0.998302,  0.998296,  0.998290,  0.998285,  0.998279,  0.998273,  0.998268,  0.998262,
-	 0.998257,  0.998251,  0.998245,  0.998240,  0.998234,  0.998228,  0.998222,  0.998217,
-	 0.998211,  0.998205,  0.998200,  0.998194,  0.998188,  0.998182,  0.998176,  0.998171,
-	 0.998165,  0.998159,  0.998153,  0.998147,  0.998142,  0.998136,  0.998130,  0.998124,
-	 0.998118,  0.998112,  0.998106,  0.998100,  0.998094,  0.998089,  0.998083,  0.998077,
-	 0.998071,  0.998065,  0.998059,  0.998053,  0.998047,  0.998041,  0.998035,  0.998029,
-	 0.998023,  0.998017,  0.998011,  0.998005,  0.997999,  0.997993,  0.997987,  0.997980,
-	 0.997974,  0.997968,  0.997962,  0.997956,  0.997950,  0.997944,  0.997938,  0.997931,
-	 0.997925,  0.997919,  0.997913,  0.997907,  0.997901,  0.997894,  0.997888,  0.997882,
-	 0.997876,  0.997869,  0.997863,  0.997857,  0.997851,  0.997844,  0.997838,  0.997832,
-	 0.997825,  0.997819,  0.997813,  0.997806,  0.997800,  0.997794,  0.997787,  0.997781,
-	 0.997774,  0.997768,  0.997762,  0.997755,  0.997749,  0.997742,  0.997736,  0.997730,
-	 0.997723,  0.997717,  0.997710,  0.997704,  0.997697,  0.997691,  0.997684,  0.997678,
-	 0.997671,  0.997665,  0.997658,  0.997651,  0.997645,  0.997638,  0.997632,  0.997625,
-	 0.997618,  0.997612,  0.997605,  0.997599,  0.997592,  0.997585,  0.997579,  0.997572,
-	 0.997565,  0.997559,  0.997552,  0.997545,  0.997538,  0.997532,  0.997525,  0.997518,
-	 0.997511,  0.997505,  0.997498,  0.997491,  0.997484,  0.997478,  0.997471,  0.997464,
-	 0.997457,  0.997450,  0.997443,  0.997437,  0.997430,  0.997423,  0.997416,  0.997409,
-	 0.997402,  0.997395,  0.997388,  0.997381,  0.997374,  0.997368,  0.997361,  0.997354,
-	 0.997347,  0.997340,  0.997333,  0.997326,  0.997319,  0.997312,  0.997305,  0.997298,
-	 0.997290,  0.997283,  0.997276,  0.997269,  0.997262,  0.997255,  0.997248,  0.997241,
-	 0.997234,  0.997227,  0.997219,  0.997212,  0.997205,  0.997198,  0.997191,  0.997184,
-	 0.997176,  0.997169,  0.997162,  0.997155,  0.997148,  0.997140,  0.997133,  0.997126,
-	 0.997119,  0.997111,  0.997104,  0.997097,  0.997089,  0.997082,  0.997075,  0.997067,
-	 0.997060,  0.997053,  0.997045,  0.997038,  0.997031,  0.997023,  0.997016,  0.997008,
-	 0.997001,  0.996994,  0.996986,  0.996979,  0.996971,  0.996964,  0.996956,  0.996949,
-	 0.996941,  0.996934,  0.996926,  0.996919,  0.996911,  0.996904,  0.996896,  0.996889,
-	 0.996881,  0.996874,  0.996866,  0.996858,  0.996851,  0.996843,  0.996836,  0.996828,
-	 0.996820,  0.996813,  0.996805,  0.996797,  0.996790,  0.996782,  0.996774,  0.996767,
-	 0.996759,  0.996751,  0.996743,  0.996736,  0.996728,  0.996720,  0.996712,  0.996705,
-	 0.996697,  0.996689,  0.996681,  0.996674,  0.996666,  0.996658,  0.996650,  0.996642,
-	 0.996634,  0.996626,  0.996619,  0.996611,  0.996603,  0.996595,  0.996587,  0.996579,
-	 0.996571,  0.996563,  0.996555,  0.996547,  0.996539,  0.996531,  0.996523,  0.996515,
-	 0.996507,  0.996499,  0.996491,  0.996483,  0.996475,  0.996467,  0.996459,  0.996451,
-	 0.996443,  0.996435,  0.996427,  0.996419,  0.996411,  0.996403,  0.996394,  0.996386,
-	 0.996378,  0.996370,  0.996362,  0.996354,  0.996345,  0.996337,  0.996329,  0.996321,
-	 0.996313,  0.996304,  0.996296,  0.996288,  0.996280,  0.996271,  0.996263,  0.996255,
-	 0.996247,  0.996238,  0.996230,  0.996222,  0.996213,  0.996205,  0.996197,  0.996188,
-	 0.996180,  0.996171,  0.996163,  0.996155,  0.996146,  0.996138,  0.996129,  0.996121,
-	 0.996113,  0.996104,  0.996096,  0.996087,  0.996079,  0.996070,  0.996062,  0.996053,
-	 0.996045,  0.996036,  0.996028,  0.996019,  0.996011,  0.996002,  0.995993,  0.995985,
-	 0.995976,  0.995968,  0.995959,  0.995950,  0.995942,  0.995933,  0.995925,  0.995916,
-	 0.995907,  0.995899,  0.995890,  0.995881,  0.995872,  0.995864,  0.995855,  0.995846,
-	 0.995838,  0.995829,  0.995820,  0.995811,  0.995803,  0.995794,  0.995785,  0.995776,
-	 0.995767,  0.995759,  0.995750,  0.995741,  0.995732,  0.995723,  0.995714,  0.995705,
-	 0.995697,  0.995688,  0.995679,  0.995670,  0.995661,  0.995652,  0.995643,  0.995634,
-	 0.995625,  0.995616,  0.995607,  0.995598,  0.995589,  0.995580,  0.995571,  0.995562,
-	 0.995553,  0.995544,  0.995535,  0.995526,  0.995517,  0.995508,  0.995499,  0.995490,
-	 0.995481,  0.995472,  0.995463,  0.995453,  0.995444,  0.995435,  0.995426,  0.995417,
-	 0.995408,  0.995398,  0.995389,  0.995380,  0.995371,  0.995362,  0.995352,  0.995343,
-	 0.995334,  0.995325,  0.995315,  0.995306,  0.995297,  0.995288,  0.995278,  0.995269,
-	 0.995260,  0.995250,  0.995241,  0.995232,  0.995222,  0.995213,  0.995203,  0.995194,
-	 0.995185,  0.995175,  0.995166,  0.995156,  0.995147,  0.995138,  0.995128,  0.995119,
-	 0.995109,  0.995100,  0.995090,  0.995081,  0.995071,  0.995062,  0.995052,  0.995043,
-	 0.995033,  0.995024,  0.995014,  0.995005,  0.994995,  0.994985,  0.994976,  0.994966,
-	 0.994957,  0.994947,  0.994937,  0.994928,  0.994918,  0.994908,  0.994899,  0.994889,
-	 0.994879,  0.994870,  0.994860,  0.994850,  0.994841,  0.994831,  0.994821,  0.994811,
-	 0.994802,  0.994792,  0.994782,  0.994772,  0.994762,  0.994753,  0.994743,  0.994733,
-	 0.994723,  0.994713,  0.994703,  0.994694,  0.994684,  0.994674,  0.994664,  0.994654,
-	 0.994644,  0.994634,  0.994624,  0.994614,  0.994604,  0.994594,  0.994585,  0.994575,
-	 0.994565,  0.994555,  0.994545,  0.994535,  0.994525,  0.994515,  0.994505,  0.994494,
-	 0.994484,  0.994474,  0.994464,  0.994454,  0.994444,  0.994434,  0.994424,  0.994414,
-	 0.994404,  0.994394,  0.994383,  0.994373,  0.994363,  0.994353,  0.994343,  0.994333,
-	 0.994322,  0.994312,  0.994302,  0.994292,  0.994281,  0.994271,  0.994261,  0.994251,
-	 0.994240,  0.994230,  0.994220,  0.994210,  0.994199,  0.994189,  0.994179,  0.994168,
-	 0.994158,  0.994148,  0.994137,  0.994127,  0.994116,  0.994106,  0.994096,  0.994085,
-	 0.994075,  0.994064,  0.994054,  0.994044,  0.994033,  0.994023,  0.994012,  0.994002,
-	 0.993991,  0.993981,  0.993970,  0.993960,  0.993949,  0.993939,  0.993928,  0.993918,
-	 0.993907,  0.993896,  0.993886,  0.993875,  0.993865,  0.993854,  0.993843,  0.993833,
-	 0.993822,  0.993811,  0.993801,  0.993790,  0.993779,  0.993769,  0.993758,  0.993747,
-	 0.993737,  0.993726,  0.993715,  0.993705,  0.993694,  0.993683,  0.993672,  0.993662,
-	 0.993651,  0.993640,  0.993629,  0.993618,  0.993608,  0.993597,  0.993586,  0.993575,
-	 0.993564,  0.993553,  0.993542,  0.993532,  0.993521,  0.993510,  0.993499,  0.993488,
-	 0.993477,  0.993466,  0.993455,  0.993444,  0.993433,  0.993422,  0.993411,  0.993400,
-	 0.993389,  0.993378,  0.993367,  0.993356,  0.993345,  0.993334,  0.993323,  0.993312,
-	 0.993301,  0.993290,  0.993279,  0.993268,  0.993257,  0.993245,  0.993234,  0.993223,
-	 0.993212,  0.993201,  0.993190,  0.993178,  0.993167,  0.993156,  0.993145,  0.993134,
-	 0.993122,  0.993111,  0.993100,  0.993089,  0.993077,  0.993066,  0.993055,  0.993044,
-	 0.993032,  0.993021,  0.993010,  0.992998,  0.992987,  0.992976,  0.992964,  0.992953,
-	 0.992942,  0.992930,  0.992919,  0.992908,  0.992896,  0.992885,  0.992873,  0.992862,
-	 0.992850,  0.992839,  0.992828,  0.992816,  0.992805,  0.992793,  0.992782,  0.992770,
-	 0.992759,  0.992747,  0.992736,  0.992724,  0.992712,  0.992701,  0.992689,  0.992678,
-	 0.992666,  0.992655,  0.992643,  0.992631,  0.992620,  0.992608,  0.992596,  0.992585,
-	 0.992573,  0.992561,  0.992550,  0.992538,  0.992526,  0.992515,  0.992503,  0.992491,
-	 0.992480,  0.992468,  0.992456,  0.992444,  0.992433,  0.992421,  0.992409,  0.992397,
-	 0.992385,  0.992374,  0.992362,  0.992350,  0.992338,  0.992326,  0.992314,  0.992302,
-	 0.992291,  0.992279,  0.992267,  0.992255,  0.992243,  0.992231,  0.992219,  0.992207,
-	 0.992195,  0.992183,  0.992171,  0.992159,  0.992147,  0.992135,  0.992123,  0.992111,
-	 0.992099,  0.992087,  0.992075,  0.992063,  0.992051,  0.992039,  0.992027,  0.992015,
-	 0.992003,  0.991991,  0.991979,  0.991966,  0.991954,  0.991942,  0.991930,  0.991918,
-	 0.991906,  0.991894,  0.991881,  0.991869,  0.991857,  0.991845,  0.991832,  0.991820,
-	 0.991808,  0.991796,  0.991783,  0.991771,  0.991759,  0.991747,  0.991734,  0.991722,
-	 0.991710,  0.991697,  0.991685,  0.991673,  0.991660,  0.991648,  0.991636,  0.991623,
-	 0.991611,  0.991598,  0.991586,  0.991574,  0.991561,  0.991549,  0.991536,  0.991524,
-	 0.991511,  0.991499,  0.991487,  0.991474,  0.991462,  0.991449,  0.991437,  0.991424,
-	 0.991411,  0.991399,  0.991386,  0.991374,  0.991361,  0.991349,  0.991336,  0.991323,
-	 0.991311,  0.991298,  0.991286,  0.991273,  0.991260,  0.991248,  0.991235,  0.991222,
-	 0.991210,  0.991197,  0.991184,  0.991172,  0.991159,  0.991146,  0.991133,  0.991121,
-	 0.991108,  0.991095,  0.991082,  0.991070,  0.991057,  0.991044,  0.991031,  0.991018,
-	 0.991006,  0.990993,  0.990980,  0.990967,  0.990954,  0.990941,  0.990928,  0.990916,
-	 0.990903,  0.990890,  0.990877,  0.990864,  0.990851,  0.990838,  0.990825,  0.990812,
-	 0.990799,  0.990786,  0.990773,  0.990760,  0.990747,  0.990734,  0.990721,  0.990708,
-	 0.990695,  0.990682,  0.990669,  0.990656,  0.990643,  0.990630,  0.990617,  0.990603,
-	 0.990590,  0.990577,  0.990564,  0.990551,  0.990538,  0.990525,  0.990511,  0.990498,
-	 0.990485,  0.990472,  0.990459,  0.990445,  0.990432,  0.990419,  0.990406,  0.990393,
-	 0.990379,  0.990366,  0.990353,  0.990339,  0.990326,  0.990313,  0.990299,  0.990286,
-	 0.990273,  0.990259,  0.990246,  0.990233,  0.990219,  0.990206,  0.990193,  0.990179,
-	 0.990166,  0.990152,  0.990139,  0.990126,  0.990112,  0.990099,  0.990085,  0.990072,
-	 0.990058,  0.990045,  0.990031,  0.990018,  0.990004,  0.989991,  0.989977,  0.989964,
-	 0.989950,  0.989936,  0.989923,  0.989909,  0.989896,  0.989882,  0.989869,  0.989855,
-	 0.989841,  0.989828,  0.989814,  0.989800,  0.989787,  0.989773,  0.989759,  0.989746,
-	 0.989732,  0.989718,  0.989704,  0.989691,  0.989677,  0.989663,  0.989650,  0.989636,
-	 0.989622,  0.989608,  0.989594,  0.989581,  0.989567,  0.989553,  0.989539,  0.989525,
-	 0.989511,  0.989498,  0.989484,  0.989470,  0.989456,  0.989442,  0.989428,  0.989414,
-	 0.989400,  0.989386,  0.989373,  0.989359,  0.989345,  0.989331,  0.989317,  0.989303,
-	 0.989289,  0.989275,  0.989261,  0.989247,  0.989233,  0.989219,  0.989205,  0.989191,
-	 0.989177,  0.989162,  0.989148,  0.989134,  0.989120,  0.989106,  0.989092,  0.989078,
-	 0.989064,  0.989050,  0.989035,  0.989021,  0.989007,  0.988993,  0.988979,  0.988964,
-	 0.988950,  0.988936,  0.988922,  0.988908,  0.988893,  0.988879,  0.988865,  0.988851,
-	 0.988836,  0.988822,  0.988808,  0.988793,  0.988779,  0.988765,  0.988750,  0.988736,
-	 0.988722,  0.988707,  0.988693,  0.988679,  0.988664,  0.988650,  0.988635,  0.988621,
-	 0.988607,  0.988592,  0.988578,  0.988563,  0.988549,  0.988534,  0.988520,  0.988505,
-	 0.988491,  0.988476,  0.988462,  0.988447,  0.988433,  0.988418,  0.988404,  0.988389,
-	 0.988374,  0.988360,  0.988345,  0.988331,  0.988316,  0.988301,  0.988287,  0.988272,
-	 0.988258,  0.988243,  0.988228,  0.988214,  0.988199,  0.988184,  0.988169,  0.988155,
-	 0.988140,  0.988125,  0.988111,  0.988096,  0.988081,  0.988066,  0.988052,  0.988037,
-	 0.988022,  0.988007,  0.987992,  0.987978,  0.987963,  0.987948,  0.987933,  0.987918,
-	 0.987903,  0.987889,  0.987874,  0.987859,  0.987844,  0.987829,  0.987814,  0.987799,
-	 0.987784,  0.987769,  0.987754,  0.987739,  0.987724,  0.987709,  0.987694,  0.987679,
-	 0.987664,  0.987649,  0.987634,  0.987619,  0.987604,  0.987589,  0.987574,  0.987559,
-	 0.987544,  0.987529,  0.987514,  0.987499,  0.987484,  0.987468,  0.987453,  0.987438,
-	 0.987423,  0.987408,  0.987393,  0.987377,  0.987362,  0.987347,  0.987332,  0.987317,
-	 0.987301,  0.987286,  0.987271,  0.987256,  0.987240,  0.987225,  0.987210,  0.987195,
-	 0.987179,  0.987164,  0.987149,  0.987133,  0.987118,  0.987103,  0.987087,  0.987072,
-	 0.987057,  0.987041,  0.987026,  0.987010,  0.986995,  0.986980,  0.986964,  0.986949,
-	 0.986933,  0.986918,  0.986902,  0.986887,  0.986871,  0.986856,  0.986840,  0.986825,
-	 0.986809,  0.986794,  0.986778,  0.986763,  0.986747,  0.986732,  0.986716,  0.986701,
-	 0.986685,  0.986669,  0.986654,  0.986638,  0.986623,  0.986607,  0.986591,  0.986576,
-	 0.986560,  0.986544,  0.986529,  0.986513,  0.986497,  0.986481,  0.986466,  0.986450,
-	 0.986434,  0.986419,  0.986403,  0.986387,  0.986371,  0.986355,  0.986340,  0.986324,
-	 0.986308,  0.986292,  0.986276,  0.986261,  0.986245,  0.986229,  0.986213,  0.986197,
-	 0.986181,  0.986165,  0.986150,  0.986134,  0.986118,  0.986102,  0.986086,  0.986070,
-	 0.986054,  0.986038,  0.986022,  0.986006,  0.985990,  0.985974,  0.985958,  0.985942,
-	 0.985926,  0.985910,  0.985894,  0.985878,  0.985862,  0.985846,  0.985830,  0.985814,
-	 0.985798,  0.985781,  0.985765,  0.985749,  0.985733,  0.985717,  0.985701,  0.985685,
-	 0.985668,  0.985652,  0.985636,  0.985620,  0.985604,  0.985587,  0.985571,  0.985555,
-	 0.985539,  0.985523,  0.985506,  0.985490,  0.985474,  0.985457,  0.985441,  0.985425,
-	 0.985408,  0.985392,  0.985376,  0.985359,  0.985343,  0.985327,  0.985310,  0.985294,
-	 0.985278,  0.985261,  0.985245,  0.985228,  0.985212,  0.985196,  0.985179,  0.985163,
-	 0.985146,  0.985130,  0.985113,  0.985097,  0.985080,  0.985064,  0.985047,  0.985031,
-	 0.985014,  0.984998,  0.984981,  0.984965,  0.984948,  0.984931,  0.984915,  0.984898,
-	 0.984882,  0.984865,  0.984848,  0.984832,  0.984815,  0.984798,  0.984782,  0.984765,
-	 0.984748,  0.984732,  0.984715,  0.984698,  0.984682,  0.984665,  0.984648,  0.984632,
-	 0.984615,  0.984598,  0.984581,  0.984564,  0.984548,  0.984531,  0.984514,  0.984497,
-	 0.984480,  0.984464,  0.984447,  0.984430,  0.984413,  0.984396,  0.984379,  0.984362,
-	 0.984346,  0.984329,  0.984312,  0.984295,  0.984278,  0.984261,  0.984244,  0.984227,
-	 0.984210,  0.984193,  0.984176,  0.984159,  0.984142,  0.984125,  0.984108,  0.984091,
-	 0.984074,  0.984057,  0.984040,  0.984023,  0.984006,  0.983989,  0.983972,  0.983955,
-	 0.983937,  0.983920,  0.983903,  0.983886,  0.983869,  0.983852,  0.983835,  0.983817,
-	 0.983800,  0.983783,  0.983766,  0.983749,  0.983731,  0.983714,  0.983697,  0.983680,
-	 0.983662,  0.983645,  0.983628,  0.983611,  0.983593,  0.983576,  0.983559,  0.983541,
-	 0.983524,  0.983507,  0.983489,  0.983472,  0.983455,  0.983437,  0.983420,  0.983402,
-	 0.983385,  0.983368,  0.983350,  0.983333,  0.983315,  0.983298,  0.983281,  0.983263,
-	 0.983246,  0.983228,  0.983211,  0.983193,  0.983176,  0.983158,  0.983141,  0.983123,
-	 0.983105,  0.983088,  0.983070,  0.983053,  0.983035,  0.983018,  0.983000,  0.982982,
-	 0.982965,  0.982947,  0.982930,  0.982912,  0.982894,  0.982877,  0.982859,  0.982841,
-	 0.982824,  0.982806,  0.982788,  0.982770,  0.982753,  0.982735,  0.982717,  0.982699,
-	 0.982682,  0.982664,  0.982646,  0.982628,  0.982611,  0.982593,  0.982575,  0.982557,
-	 0.982539,  0.982521,  0.982504,  0.982486,  0.982468,  0.982450,  0.982432,  0.982414,
-	 0.982396,  0.982378,  0.982360,  0.982343,  0.982325,  0.982307,  0.982289,  0.982271,
-	 0.982253,  0.982235,  0.982217,  0.982199,  0.982181,  0.982163,  0.982145,  0.982127,
-	 0.982109,  0.982091,  0.982072,  0.982054,  0.982036,  0.982018,  0.982000,  0.981982,
-	 0.981964,  0.981946,  0.981928,  0.981909,  0.981891,  0.981873,  0.981855,  0.981837,
-	 0.981819,  0.981800,  0.981782,  0.981764,  0.981746,  0.981727,  0.981709,  0.981691,
-	 0.981673,  0.981654,  0.981636,  0.981618,  0.981600,  0.981581,  0.981563,  0.981545,
-	 0.981526,  0.981508,  0.981490,  0.981471,  0.981453,  0.981434,  0.981416,  0.981398,
-	 0.981379,  0.981361,  0.981342,  0.981324,  0.981305,  0.981287,  0.981269,  0.981250,
-	 0.981232,  0.981213,  0.981195,  0.981176,  0.981158,  0.981139,  0.981120,  0.981102,
-	 0.981083,  0.981065,  0.981046,  0.981028,  0.981009,  0.980990,  0.980972,  0.980953,
-	 0.980935,  0.980916,  0.980897,  0.980879,  0.980860,  0.980841,  0.980823,  0.980804,
-	 0.980785,  0.980767,  0.980748,  0.980729,  0.980710,  0.980692,  0.980673,  0.980654,
-	 0.980635,  0.980617,  0.980598,  0.980579,  0.980560,  0.980541,  0.980523,  0.980504,
-	 0.980485,  0.980466,  0.980447,  0.980428,  0.980409,  0.980390,  0.980372,  0.980353,
-	 0.980334,  0.980315,  0.980296,  0.980277,  0.980258,  0.980239,  0.980220,  0.980201,
-	 0.980182,  0.980163,  0.980144,  0.980125,  0.980106,  0.980087,  0.980068,  0.980049,
-	 0.980030,  0.980011,  0.979992,  0.979973,  0.979954,  0.979934,  0.979915,  0.979896,
-	 0.979877,  0.979858,  0.979839,  0.979820,  0.979800,  0.979781,  0.979762,  0.979743,
-	 0.979724,  0.979704,  0.979685,  0.979666,  0.979647,  0.979628,  0.979608,  0.979589,
-	 0.979570,  0.979550,  0.979531,  0.979512,  0.979493,  0.979473,  0.979454,  0.979435,
-	 0.979415,  0.979396,  0.979376,  0.979357,  0.979338,  0.979318,  0.979299,  0.979280,
-	 0.979260,  0.979241,  0.979221,  0.979202,  0.979182,  0.979163,  0.979143,  0.979124,
-	 0.979104,  0.979085,  0.979065,  0.979046,  0.979026,  0.979007,  0.978987,  0.978968,
-	 0.978948,  0.978929,  0.978909,  0.978889,  0.978870,  0.978850,  0.978831,  0.978811,
-	 0.978791,  0.978772,  0.978752,  0.978732,  0.978713,  0.978693,  0.978673,  0.978654,
-	 0.978634,  0.978614,  0.978594,  0.978575,  0.978555,  0.978535,  0.978516,  0.978496,
-	 0.978476,  0.978456,  0.978436,  0.978417,  0.978397,  0.978377,  0.978357,  0.978337,
-	 0.978317,  0.978298,  0.978278,  0.978258,  0.978238,  0.978218,  0.978198,  0.978178,
-	 0.978158,  0.978138,  0.978118,  0.978098,  0.978078,  0.978058,  0.978038,  0.978019,
-	 0.977998,  0.977979,  0.977959,  0.977938,  0.977918,  0.977898,  0.977878,  0.977858,
-	 0.977838,  0.977818,  0.977798,  0.977778,  0.977758,  0.977738,  0.977718,  0.977697,
-	 0.977677,  0.977657,  0.977637,  0.977617,  0.977597,  0.977577,  0.977556,  0.977536,
-	 0.977516,  0.977496,  0.977475,  0.977455,  0.977435,  0.977415,  0.977394,  0.977374,
-	 0.977354,  0.977334,  0.977313,  0.977293,  0.977273,  0.977252,  0.977232,  0.977212,
-	 0.977191,  0.977171,  0.977151,  0.977130,  0.977110,  0.977089,  0.977069,  0.977049,
-	 0.977028,  0.977008,  0.976987,  0.976967,  0.976946,  0.976926,  0.976905,  0.976885,
-	 0.976864,  0.976844,  0.976823,  0.976803,  0.976782,  0.976762,  0.976741,  0.976721,
-	 0.976700,  0.976680,  0.976659,  0.976638,  0.976618,  0.976597,  0.976576,  0.976556,
-	 0.976535,  0.976515,  0.976494,  0.976473,  0.976453,  0.976432,  0.976411,  0.976390,
-	 0.976370,  0.976349,  0.976328,  0.976308,  0.976287,  0.976266,  0.976245,  0.976224,
-	 0.976204,  0.976183,  0.976162,  0.976141,  0.976120,  0.976100,  0.976079,  0.976058,
-	 0.976037,  0.976016,  0.975995,  0.975974,  0.975954,  0.975933,  0.975912,  0.975891,
-	 0.975870,  0.975849,  0.975828,  0.975807,  0.975786,  0.975765,  0.975744,  0.975723,
-	 0.975702,  0.975681,  0.975660,  0.975639,  0.975618,  0.975597,  0.975576,  0.975555,
-	 0.975534,  0.975513,  0.975492,  0.975471,  0.975449,  0.975428,  0.975407,  0.975386,
-	 0.975365,  0.975344,  0.975323,  0.975301,  0.975280,  0.975259,  0.975238,  0.975217,
-	 0.975195,  0.975174,  0.975153,  0.975132,  0.975110,  0.975089,  0.975068,  0.975047,
-	 0.975025,  0.975004,  0.974983,  0.974961,  0.974940,  0.974919,  0.974897,  0.974876,
-	 0.974855,  0.974833,  0.974812,  0.974791,  0.974769,  0.974748,  0.974726,  0.974705,
-	 0.974684,  0.974662,  0.974641,  0.974619,  0.974598,  0.974576,  0.974555,  0.974533,
-	 0.974512,  0.974490,  0.974469,  0.974447,  0.974426,  0.974404,  0.974383,  0.974361,
-	 0.974339,  0.974318,  0.974296,  0.974275,  0.974253,  0.974231,  0.974210,  0.974188,
-	 0.974166,  0.974145,  0.974123,  0.974101,  0.974080,  0.974058,  0.974036,  0.974015,
-	 0.973993,  0.973971,  0.973949,  0.973928,  0.973906,  0.973884,  0.973862,  0.973841,
-	 0.973819,  0.973797,  0.973775,  0.973753,  0.973732,  0.973710,  0.973688,  0.973666,
-	 0.973644,  0.973622,  0.973601,  0.973579,  0.973557,  0.973535,  0.973513,  0.973491,
-	 0.973469,  0.973447,  0.973425,  0.973403,  0.973381,  0.973359,  0.973337,  0.973315,
-	 0.973293,  0.973271,  0.973249,  0.973227,  0.973205,  0.973183,  0.973161,  0.973139,
-	 0.973117,  0.973095,  0.973073,  0.973051,  0.973028,  0.973006,  0.972984,  0.972962,
-	 0.972940,  0.972918,  0.972896,  0.972873,  0.972851,  0.972829,  0.972807,  0.972785,
-	 0.972762,  0.972740,  0.972718,  0.972696,  0.972673,  0.972651,  0.972629,  0.972607,
-	 0.972584,  0.972562,  0.972540,  0.972517,  0.972495,  0.972473,  0.972450,  0.972428,
-	 0.972406,  0.972383,  0.972361,  0.972339,  0.972316,  0.972294,  0.972271,  0.972249,
-	 0.972227,  0.972204,  0.972182,  0.972159,  0.972137,  0.972114,  0.972092,  0.972069,
-	 0.972047,  0.972024,  0.972002,  0.971979,  0.971957,  0.971934,  0.971911,  0.971889,
-	 0.971866,  0.971844,  0.971821,  0.971799,  0.971776,  0.971753,  0.971731,  0.971708,
-	 0.971685,  0.971663,  0.971640,  0.971617,  0.971595,  0.971572,  0.971549,  0.971527,
-	 0.971504,  0.971481,  0.971458,  0.971436,  0.971413,  0.971390,  0.971367,  0.971345,
-	 0.971322,  0.971299,  0.971276,  0.971253,  0.971231,  0.971208,  0.971185,  0.971162,
-	 0.971139,  0.971116,  0.971093,  0.971071,  0.971048,  0.971025,  0.971002,  0.970979,
-	 0.970956,  0.970933,  0.970910,  0.970887,  0.970864,  0.970841,  0.970818,  0.970795,
-	 0.970772,  0.970749,  0.970726,  0.970703,  0.970680,  0.970657,  0.970634,  0.970611,
-	 0.970588,  0.970565,  0.970542,  0.970518,  0.970495,  0.970472,  0.970449,  0.970426,
-	 0.970403,  0.970380,  0.970357,  0.970333,  0.970310,  0.970287,  0.970264,  0.970241,
-	 0.970217,  0.970194,  0.970171,  0.970148,  0.970124,  0.970101,  0.970078,  0.970055,
-	 0.970031,  0.970008,  0.969985,  0.969961,  0.969938,  0.969915,  0.969891,  0.969868,
-	 0.969845,  0.969821,  0.969798,  0.969774,  0.969751,  0.969728,  0.969704,  0.969681,
-	 0.969657,  0.969634,  0.969611,  0.969587,  0.969564,  0.969540,  0.969517,  0.969493,
-	 0.969470,  0.969446,  0.969423,  0.969399,  0.969375,  0.969352,  0.969328,  0.969305,
-	 0.969281,  0.969258,  0.969234,  0.969210,  0.969187,  0.969163,  0.969140,  0.969116,
-	 0.969092,  0.969069,  0.969045,  0.969021,  0.968998,  0.968974,  0.968950,  0.968927,
-	 0.968903,  0.968879,  0.968855,  0.968832,  0.968808,  0.968784,  0.968760,  0.968737,
-	 0.968713,  0.968689,  0.968665,  0.968641,  0.968617,  0.968594,  0.968570,  0.968546,
-	 0.968522,  0.968498,  0.968474,  0.968450,  0.968427,  0.968403,  0.968379,  0.968355,
-	 0.968331,  0.968307,  0.968283,  0.968259,  0.968235,  0.968211,  0.968187,  0.968163,
-	 0.968139,  0.968115,  0.968091,  0.968067,  0.968043,  0.968019,  0.967995,  0.967971,
-	 0.967947,  0.967923,  0.967899,  0.967874,  0.967850,  0.967826,  0.967802,  0.967778,
-	 0.967754,  0.967730,  0.967706,  0.967681,  0.967657,  0.967633,  0.967609,  0.967585,
-	 0.967560,  0.967536,  0.967512,  0.967488,  0.967463,  0.967439,  0.967415,  0.967391,
-	 0.967366,  0.967342,  0.967318,  0.967293,  0.967269,  0.967245,  0.967220,  0.967196,
-	 0.967172,  0.967147,  0.967123,  0.967099,  0.967074,  0.967050,  0.967025,  0.967001,
-	 0.966976,  0.966952,  0.966928,  0.966903,  0.966879,  0.966854,  0.966830,  0.966805,
-	 0.966781,  0.966756,  0.966732,  0.966707,  0.966683,  0.966658,  0.966633,  0.966609,
-	 0.966584,  0.966560,  0.966535,  0.966511,  0.966486,  0.966461,  0.966437,  0.966412,
-	 0.966387,  0.966363,  0.966338,  0.966313,  0.966289,  0.966264,  0.966239,  0.966215,
-	 0.966190,  0.966165,  0.966141,  0.966116,  0.966091,  0.966066,  0.966042,  0.966017,
-	 0.965992,  0.965967,  0.965942,  0.965918,  0.965893,  0.965868,  0.965843,  0.965818,
-	 0.965793,  0.965769,  0.965744,  0.965719,  0.965694,  0.965669,  0.965644,  0.965619,
-	 0.965594,  0.965569,  0.965544,  0.965519,  0.965494,  0.965469,  0.965444,  0.965419,
-	 0.965394,  0.965369,  0.965344,  0.965319,  0.965294,  0.965269,  0.965244,  0.965219,
-	 0.965194,  0.965169,  0.965144,  0.965119,  0.965094,  0.965069,  0.965044,  0.965018,
-	 0.964993,  0.964968,  0.964943,  0.964918,  0.964893,  0.964867,  0.964842,  0.964817,
-	 0.964792,  0.964767,  0.964741,  0.964716,  0.964691,  0.964666,  0.964640,  0.964615,
-	 0.964590,  0.964565,  0.964539,  0.964514,  0.964489,  0.964463,  0.964438,  0.964413,
-	 0.964387,  0.964362,  0.964336,  0.964311,  0.964286,  0.964260,  0.964235,  0.964209,
-	 0.964184,  0.964159,  0.964133,  0.964108,  0.964082,  0.964057,  0.964031,  0.964006,
-	 0.963980,  0.963955,  0.963929,  0.963904,  0.963878,  0.963853,  0.963827,  0.963802,
-	 0.963776,  0.963750,  0.963725,  0.963699,  0.963674,  0.963648,  0.963623,  0.963597,
-	 0.963571,  0.963546,  0.963520,  0.963494,  0.963469,  0.963443,  0.963417,  0.963391,
-	 0.963366,  0.963340,  0.963314,  0.963289,  0.963263,  0.963237,  0.963211,  0.963186,
-	 0.963160,  0.963134,  0.963108,  0.963082,  0.963057,  0.963031,  0.963005,  0.962979,
-	 0.962953,  0.962927,  0.962902,  0.962876,  0.962850,  0.962824,  0.962798,  0.962772,
-	 0.962746,  0.962720,  0.962694,  0.962668,  0.962642,  0.962616,  0.962590,  0.962564,
-	 0.962538,  0.962512,  0.962486,  0.962460,  0.962434,  0.962408,  0.962382,  0.962356,
-	 0.962330,  0.962304,  0.962278,  0.962252,  0.962226,  0.962200,  0.962174,  0.962148,
-	 0.962121,  0.962095,  0.962069,  0.962043,  0.962017,  0.961991,  0.961964,  0.961938,
-	 0.961912,  0.961886,  0.961860,  0.961833,  0.961807,  0.961781,  0.961755,  0.961728,
-	 0.961702,  0.961676,  0.961649,  0.961623,  0.961597,  0.961571,  0.961544,  0.961518,
-	 0.961492,  0.961465,  0.961439,  0.961412,  0.961386,  0.961360,  0.961333,  0.961307,
-	 0.961280,  0.961254,  0.961228,  0.961201,  0.961175,  0.961148,  0.961122,  0.961095,
-	 0.961069,  0.961042,  0.961016,  0.960989,  0.960963,  0.960936,  0.960910,  0.960883,
-	 0.960857,  0.960830,  0.960804,  0.960777,  0.960750,  0.960724,  0.960697,  0.960670,
-	 0.960644,  0.960617,  0.960591,  0.960564,  0.960537,  0.960511,  0.960484,  0.960457,
-	 0.960431,  0.960404,  0.960377,  0.960350,  0.960324,  0.960297,  0.960270,  0.960243,
-	 0.960217,  0.960190,  0.960163,  0.960136,  0.960109,  0.960083,  0.960056,  0.960029,
-	 0.960002,  0.959975,  0.959948,  0.959922,  0.959895,  0.959868,  0.959841,  0.959814,
-	 0.959787,  0.959760,  0.959733,  0.959706,  0.959679,  0.959652,  0.959625,  0.959598,
-	 0.959572,  0.959545,  0.959518,  0.959491,  0.959463,  0.959436,  0.959409,  0.959382,
-	 0.959355,  0.959328,  0.959301,  0.959274,  0.959247,  0.959220,  0.959193,  0.959166,
-	 0.959139,  0.959112,  0.959084,  0.959057,  0.959030,  0.959003,  0.958976,  0.958949,
-	 0.958921,  0.958894,  0.958867,  0.958840,  0.958812,  0.958785,  0.958758,  0.958731,
-	 0.958703,  0.958676,  0.958649,  0.958622,  0.958594,  0.958567,  0.958540,  0.958512,
-	 0.958485,  0.958458,  0.958430,  0.958403,  0.958376,  0.958348,  0.958321,  0.958293,
-	 0.958266,  0.958239,  0.958211,  0.958184,  0.958156,  0.958129,  0.958101,  0.958074,
-	 0.958046,  0.958019,  0.957992,  0.957964,  0.957937,  0.957909,  0.957882,  0.957854,
-	 0.957826,  0.957799,  0.957771,  0.957744,  0.957716,  0.957689,  0.957661,  0.957633,
-	 0.957606,  0.957578,  0.957550,  0.957523,  0.957495,  0.957468,  0.957440,  0.957412,
-	 0.957385,  0.957357,  0.957329,  0.957301,  0.957274,  0.957246,  0.957218,  0.957190,
-	 0.957163,  0.957135,  0.957107,  0.957079,  0.957052,  0.957024,  0.956996,  0.956968,
-	 0.956940,  0.956913,  0.956885,  0.956857,  0.956829,  0.956801,  0.956773,  0.956745,
-	 0.956717,  0.956689,  0.956662,  0.956634,  0.956606,  0.956578,  0.956550,  0.956522,
-	 0.956494,  0.956466,  0.956438,  0.956410,  0.956382,  0.956354,  0.956326,  0.956298,
-	 0.956270,  0.956242,  0.956214,  0.956186,  0.956158,  0.956130,  0.956101,  0.956073,
-	 0.956045,  0.956017,  0.955989,  0.955961,  0.955933,  0.955905,  0.955876,  0.955848,
-	 0.955820,  0.955792,  0.955764,  0.955736,  0.955707,  0.955679,  0.955651,  0.955623,
-	 0.955594,  0.955566,  0.955538,  0.955510,  0.955481,  0.955453,  0.955425,  0.955396,
-	 0.955368,  0.955340,  0.955311,  0.955283,  0.955255,  0.955226,  0.955198,  0.955170,
-	 0.955141,  0.955113,  0.955084,  0.955056,  0.955028,  0.954999,  0.954971,  0.954942,
-	 0.954914,  0.954885,  0.954857,  0.954828,  0.954800,  0.954771,  0.954743,  0.954714,
-	 0.954686,  0.954657,  0.954629,  0.954600,  0.954572,  0.954543,  0.954514,  0.954486,
-	 0.954457,  0.954429,  0.954400,  0.954371,  0.954343,  0.954314,  0.954285,  0.954257,
-	 0.954228,  0.954199,  0.954171,  0.954142,  0.954113,  0.954085,  0.954056,  0.954027,
-	 0.953998,  0.953970,  0.953941,  0.953912,  0.953883,  0.953855,  0.953826,  0.953797,
-	 0.953768,  0.953739,  0.953711,  0.953682,  0.953653,  0.953624,  0.953595,  0.953566,
-	 0.953537,  0.953508,  0.953480,  0.953451,  0.953422,  0.953393,  0.953364,  0.953335,
-	 0.953306,  0.953277,  0.953248,  0.953219,  0.953190,  0.953161,  0.953132,  0.953103,
-	 0.953074,  0.953045,  0.953016,  0.952987,  0.952958,  0.952929,  0.952900,  0.952871,
-	 0.952842,  0.952813,  0.952783,  0.952754,  0.952725,  0.952696,  0.952667,  0.952638,
-	 0.952609,  0.952579,  0.952550,  0.952521,  0.952492,  0.952463,  0.952433,  0.952404,
-	 0.952375,  0.952346,  0.952317,  0.952287,  0.952258,  0.952229,  0.952199,  0.952170,
-	 0.952141,  0.952112,  0.952082,  0.952053,  0.952024,  0.951994,  0.951965,  0.951936,
-	 0.951906,  0.951877,  0.951847,  0.951818,  0.951789,  0.951759,  0.951730,  0.951700,
-	 0.951671,  0.951641,  0.951612,  0.951582,  0.951553,  0.951524,  0.951494,  0.951465,
-	 0.951435,  0.951406,  0.951376,  0.951346,  0.951317,  0.951287,  0.951258,  0.951228,
-	 0.951199,  0.951169,  0.951139,  0.951110,  0.951080,  0.951051,  0.951021,  0.950991,
-	 0.950962,  0.950932,  0.950902,  0.950873,  0.950843,  0.950813,  0.950784,  0.950754,
-	 0.950724,  0.950694,  0.950665,  0.950635,  0.950605,  0.950575,  0.950546,  0.950516,
-	 0.950486,  0.950456,  0.950426,  0.950397,  0.950367,  0.950337,  0.950307,  0.950277,
-	 0.950247,  0.950218,  0.950188,  0.950158,  0.950128,  0.950098,  0.950068,  0.950038,
-	 0.950008,  0.949978,  0.949948,  0.949918,  0.949888,  0.949858,  0.949829,  0.949798,
-	 0.949768,  0.949739,  0.949708,  0.949678,  0.949648,  0.949618,  0.949588,  0.949558,
-	 0.949528,  0.949498,  0.949468,  0.949438,  0.949408,  0.949378,  0.949348,  0.949317,
-	 0.949287,  0.949257,  0.949227,  0.949197,  0.949167,  0.949136,  0.949106,  0.949076,
-	 0.949046,  0.949016,  0.948985,  0.948955,  0.948925,  0.948895,  0.948864,  0.948834,
-	 0.948804,  0.948774,  0.948743,  0.948713,  0.948683,  0.948652,  0.948622,  0.948592,
-	 0.948561,  0.948531,  0.948501,  0.948470,  0.948440,  0.948409,  0.948379,  0.948349,
-	 0.948318,  0.948288,  0.948257,  0.948227,  0.948196,  0.948166,  0.948136,  0.948105,
-	 0.948075,  0.948044,  0.948014,  0.947983,  0.947953,  0.947922,  0.947891,  0.947861,
-	 0.947830,  0.947800,  0.947769,  0.947739,  0.947708,  0.947677,  0.947647,  0.947616,
-	 0.947586,  0.947555,  0.947524,  0.947494,  0.947463,  0.947432,  0.947402,  0.947371,
-	 0.947340,  0.947310,  0.947279,  0.947248,  0.947217,  0.947187,  0.947156,  0.947125,
-	 0.947094,  0.947064,  0.947033,  0.947002,  0.946971,  0.946940,  0.946910,  0.946879,
-	 0.946848,  0.946817,  0.946786,  0.946755,  0.946724,  0.946694,  0.946663,  0.946632,
-	 0.946601,  0.946570,  0.946539,  0.946508,  0.946477,  0.946446,  0.946415,  0.946384,
-	 0.946353,  0.946322,  0.946291,  0.946260,  0.946229,  0.946198,  0.946167,  0.946136,
-	 0.946105,  0.946074,  0.946043,  0.946012,  0.945981,  0.945950,  0.945919,  0.945888,
-	 0.945857,  0.945825,  0.945794,  0.945763,  0.945732,  0.945701,  0.945670,  0.945639,
-	 0.945607,  0.945576,  0.945545,  0.945514,  0.945482,  0.945451,  0.945420,  0.945389,
-	 0.945358,  0.945326,  0.945295,  0.945264,  0.945232,  0.945201,  0.945170,  0.945139,
-	 0.945107,  0.945076,  0.945045,  0.945013,  0.944982,  0.944950,  0.944919,  0.944888,
-	 0.944856,  0.944825,  0.944793,  0.944762,  0.944731,  0.944699,  0.944668,  0.944636,
-	 0.944605,  0.944573,  0.944542,  0.944510,  0.944479,  0.944447,  0.944416,  0.944384,
-	 0.944353,  0.944321,  0.944290,  0.944258,  0.944227,  0.944195,  0.944163,  0.944132,
-	 0.944100,  0.944069,  0.944037,  0.944005,  0.943974,  0.943942,  0.943910,  0.943879,
-	 0.943847,  0.943815,  0.943784,  0.943752,  0.943720,  0.943689,  0.943657,  0.943625,
-	 0.943593,  0.943562,  0.943530,  0.943498,  0.943466,  0.943435,  0.943403,  0.943371,
-	 0.943339,  0.943307,  0.943276,  0.943244,  0.943212,  0.943180,  0.943148,  0.943116,
-	 0.943084,  0.943053,  0.943021,  0.942989,  0.942957,  0.942925,  0.942893,  0.942861,
-	 0.942829,  0.942797,  0.942765,  0.942733,  0.942701,  0.942669,  0.942637,  0.942605,
-	 0.942573,  0.942541,  0.942509,  0.942477,  0.942445,  0.942413,  0.942381,  0.942349,
-	 0.942317,  0.942285,  0.942253,  0.942220,  0.942188,  0.942156,  0.942124,  0.942092,
-	 0.942060,  0.942028,  0.941995,  0.941963,  0.941931,  0.941899,  0.941867,  0.941834,
-	 0.941802,  0.941770,  0.941738,  0.941705,  0.941673,  0.941641,  0.941609,  0.941576,
-	 0.941544,  0.941512,  0.941479,  0.941447,  0.941415,  0.941382,  0.941350,  0.941318,
-	 0.941285,  0.941253,  0.941221,  0.941188,  0.941156,  0.941123,  0.941091,  0.941059,
-	 0.941026,  0.940994,  0.940961,  0.940929,  0.940896,  0.940864,  0.940831,  0.940799,
-	 0.940766,  0.940734,  0.940701,  0.940669,  0.940636,  0.940604,  0.940571,  0.940539,
-	 0.940506,  0.940473,  0.940441,  0.940408,  0.940376,  0.940343,  0.940310,  0.940278,
-	 0.940245,  0.940213,  0.940180,  0.940147,  0.940115,  0.940082,  0.940049,  0.940016,
-	 0.939984,  0.939951,  0.939918,  0.939886,  0.939853,  0.939820,  0.939787,  0.939755,
-	 0.939722,  0.939689,  0.939656,  0.939623,  0.939591,  0.939558,  0.939525,  0.939492,
-	 0.939459,  0.939426,  0.939394,  0.939361,  0.939328,  0.939295,  0.939262,  0.939229,
-	 0.939196,  0.939163,  0.939130,  0.939097,  0.939064,  0.939031,  0.938998,  0.938965,
-	 0.938932,  0.938900,  0.938866,  0.938833,  0.938800,  0.938767,  0.938734,  0.938701,
-	 0.938668,  0.938635,  0.938602,  0.938569,  0.938536,  0.938503,  0.938470,  0.938437,
-	 0.938404,  0.938370,  0.938337,  0.938304,  0.938271,  0.938238,  0.938205,  0.938171,
-	 0.938138,  0.938105,  0.938072,  0.938039,  0.938005,  0.937972,  0.937939,  0.937906,
-	 0.937872,  0.937839,  0.937806,  0.937773,  0.937739,  0.937706,  0.937673,  0.937639,
-	 0.937606,  0.937573,  0.937539,  0.937506,  0.937473,  0.937439,  0.937406,  0.937372,
-	 0.937339,  0.937306,  0.937272,  0.937239,  0.937205,  0.937172,  0.937138,  0.937105,
-	 0.937072,  0.937038,  0.937005,  0.936971,  0.936938,  0.936904,  0.936871,  0.936837,
-	 0.936803,  0.936770,  0.936736,  0.936703,  0.936669,  0.936636,  0.936602,  0.936568,
-	 0.936535,  0.936501,  0.936468,  0.936434,  0.936400,  0.936367,  0.936333,  0.936299,
-	 0.936266,  0.936232,  0.936198,  0.936165,  0.936131,  0.936097,  0.936063,  0.936030,
-	 0.935996,  0.935962,  0.935928,  0.935895,  0.935861,  0.935827,  0.935793,  0.935759,
-	 0.935726,  0.935692,  0.935658,  0.935624,  0.935590,  0.935556,  0.935523,  0.935489,
-	 0.935455,  0.935421,  0.935387,  0.935353,  0.935319,  0.935285,  0.935251,  0.935217,
-	 0.935184,  0.935150,  0.935116,  0.935082,  0.935048,  0.935014,  0.934980,  0.934946,
-	 0.934912,  0.934878,  0.934844,  0.934810,  0.934775,  0.934741,  0.934707,  0.934673,
-	 0.934639,  0.934605,  0.934571,  0.934537,  0.934503,  0.934469,  0.934434,  0.934400,
-	 0.934366,  0.934332,  0.934298,  0.934264,  0.934229,  0.934195,  0.934161,  0.934127,
-	 0.934093,  0.934058,  0.934024,  0.933990,  0.933956,  0.933921,  0.933887,  0.933853,
-	 0.933818,  0.933784,  0.933750,  0.933716,  0.933681,  0.933647,  0.933612,  0.933578,
-	 0.933544,  0.933509,  0.933475,  0.933441,  0.933406,  0.933372,  0.933337,  0.933303,
-	 0.933269,  0.933234,  0.933200,  0.933165,  0.933131,  0.933096,  0.933062,  0.933027,
-	 0.932993,  0.932958,  0.932924,  0.932889,  0.932855,  0.932820,  0.932786,  0.932751,
-	 0.932716,  0.932682,  0.932647,  0.932613,  0.932578,  0.932544,  0.932509,  0.932474,
-	 0.932440,  0.932405,  0.932370,  0.932336,  0.932301,  0.932266,  0.932232,  0.932197,
-	 0.932162,  0.932128,  0.932093,  0.932058,  0.932023,  0.931989,  0.931954,  0.931919,
-	 0.931884,  0.931849,  0.931815,  0.931780,  0.931745,  0.931710,  0.931675,  0.931641,
-	 0.931606,  0.931571,  0.931536,  0.931501,  0.931466,  0.931431,  0.931397,  0.931362,
-	 0.931327,  0.931292,  0.931257,  0.931222,  0.931187,  0.931152,  0.931117,  0.931082,
-	 0.931047,  0.931012,  0.930977,  0.930942,  0.930907,  0.930872,  0.930837,  0.930802,
-	 0.930767,  0.930732,  0.930697,  0.930662,  0.930627,  0.930592,  0.930556,  0.930521,
-	 0.930486,  0.930451,  0.930416,  0.930381,  0.930346,  0.930311,  0.930275,  0.930240,
-	 0.930205,  0.930170,  0.930135,  0.930099,  0.930064,  0.930029,  0.929994,  0.929958,
-	 0.929923,  0.929888,  0.929853,  0.929817,  0.929782,  0.929747,  0.929712,  0.929676,
-	 0.929641,  0.929606,  0.929570,  0.929535,  0.929500,  0.929464,  0.929429,  0.929393,
-	 0.929358,  0.929323,  0.929287,  0.929252,  0.929216,  0.929181,  0.929146,  0.929110,
-	 0.929075,  0.929039,  0.929004,  0.928968,  0.928933,  0.928897,  0.928862,  0.928826,
-	 0.928791,  0.928755,  0.928720,  0.928684,  0.928648,  0.928613,  0.928577,  0.928542,
-	 0.928506,  0.928470,  0.928435,  0.928399,  0.928364,  0.928328,  0.928292,  0.928257,
-	 0.928221,  0.928185,  0.928150,  0.928114,  0.928078,  0.928043,  0.928007,  0.927971,
-	 0.927935,  0.927900,  0.927864,  0.927828,  0.927792,  0.927757,  0.927721,  0.927685,
-	 0.927649,  0.927613,  0.927578,  0.927542,  0.927506,  0.927470,  0.927434,  0.927398,
-	 0.927363,  0.927327,  0.927291,  0.927255,  0.927219,  0.927183,  0.927147,  0.927111,
-	 0.927075,  0.927039,  0.927003,  0.926967,  0.926931,  0.926895,  0.926859,  0.926823,
-	 0.926787,  0.926751,  0.926715,  0.926679,  0.926643,  0.926607,  0.926571,  0.926535,
-	 0.926499,  0.926463,  0.926427,  0.926391,  0.926355,  0.926319,  0.926283,  0.926246,
-	 0.926210,  0.926174,  0.926138,  0.926102,  0.926066,  0.926029,  0.925993,  0.925957,
-	 0.925921,  0.925885,  0.925848,  0.925812,  0.925776,  0.925740,  0.925703,  0.925667,
-	 0.925631,  0.925595,  0.925558,  0.925522,  0.925486,  0.925449,  0.925413,  0.925377,
-	 0.925340,  0.925304,  0.925268,  0.925231,  0.925195,  0.925158,  0.925122,  0.925086,
-	 0.925049,  0.925013,  0.924976,  0.924940,  0.924904,  0.924867,  0.924831,  0.924794,
-	 0.924758,  0.924721,  0.924685,  0.924648,  0.924612,  0.924575,  0.924539,  0.924502,
-	 0.924465,  0.924429,  0.924392,  0.924356,  0.924319,  0.924283,  0.924246,  0.924209,
-	 0.924173,  0.924136,  0.924100,  0.924063,  0.924026,  0.923990,  0.923953,  0.923916,
-	 0.923880,  0.923843,  0.923806,  0.923769,  0.923733,  0.923696,  0.923659,  0.923622,
-	 0.923586,  0.923549,  0.923512,  0.923475,  0.923439,  0.923402,  0.923365,  0.923328,
-	 0.923291,  0.923255,  0.923218,  0.923181,  0.923144,  0.923107,  0.923070,  0.923033,
-	 0.922997,  0.922960,  0.922923,  0.922886,  0.922849,  0.922812,  0.922775,  0.922738,
-	 0.922701,  0.922664,  0.922627,  0.922590,  0.922553,  0.922516,  0.922479,  0.922442,
-	 0.922405,  0.922368,  0.922331,  0.922294,  0.922257,  0.922220,  0.922183,  0.922146,
-	 0.922109,  0.922072,  0.922034,  0.921997,  0.921960,  0.921923,  0.921886,  0.921849,
-	 0.921812,  0.921774,  0.921737,  0.921700,  0.921663,  0.921626,  0.921588,  0.921551,
-	 0.921514,  0.921477,  0.921440,  0.921402,  0.921365,  0.921328,  0.921291,  0.921253,
-	 0.921216,  0.921179,  0.921141,  0.921104,  0.921067,  0.921029,  0.920992,  0.920955,
-	 0.920917,  0.920880,  0.920842,  0.920805,  0.920768,  0.920730,  0.920693,  0.920655,
-	 0.920618,  0.920581,  0.920543,  0.920506,  0.920468,  0.920431,  0.920393,  0.920356,
-	 0.920318,  0.920281,  0.920243,  0.920206,  0.920168,  0.920131,  0.920093,  0.920056,
-	 0.920018,  0.919980,  0.919943,  0.919905,  0.919868,  0.919830,  0.919792,  0.919755,
-	 0.919717,  0.919680,  0.919642,  0.919604,  0.919567,  0.919529,  0.919491,  0.919453,
-	 0.919416,  0.919378,  0.919340,  0.919303,  0.919265,  0.919227,  0.919189,  0.919152,
-	 0.919114,  0.919076,  0.919038,  0.919001,  0.918963,  0.918925,  0.918887,  0.918849,
-	 0.918811,  0.918774,  0.918736,  0.918698,  0.918660,  0.918622,  0.918584,  0.918546,
-	 0.918508,  0.918471,  0.918433,  0.918395,  0.918357,  0.918319,  0.918281,  0.918243,
-	 0.918205,  0.918167,  0.918129,  0.918091,  0.918053,  0.918015,  0.917977,  0.917939,
-	 0.917901,  0.917863,  0.917825,  0.917787,  0.917749,  0.917710,  0.917672,  0.917634,
-	 0.917596,  0.917558,  0.917520,  0.917482,  0.917444,  0.917405,  0.917367,  0.917329,
-	 0.917291,  0.917253,  0.917215,  0.917176,  0.917138,  0.917100,  0.917062,  0.917024,
-	 0.916985,  0.916947,  0.916909,  0.916871,  0.916832,  0.916794,  0.916756,  0.916717,
-	 0.916679,  0.916641,  0.916602,  0.916564,  0.916526,  0.916487,  0.916449,  0.916411,
-	 0.916372,  0.916334,  0.916296,  0.916257,  0.916219,  0.916180,  0.916142,  0.916103,
-	 0.916065,  0.916027,  0.915988,  0.915950,  0.915911,  0.915873,  0.915834,  0.915796,
-	 0.915757,  0.915719,  0.915680,  0.915642,  0.915603,  0.915564,  0.915526,  0.915487,
-	 0.915449,  0.915410,  0.915372,  0.915333,  0.915294,  0.915256,  0.915217,  0.915178,
-	 0.915140,  0.915101,  0.915062,  0.915024,  0.914985,  0.914946,  0.914908,  0.914869,
-	 0.914830,  0.914792,  0.914753,  0.914714,  0.914675,  0.914637,  0.914598,  0.914559,
-	 0.914520,  0.914482,  0.914443,  0.914404,  0.914365,  0.914326,  0.914287,  0.914249,
-	 0.914210,  0.914171,  0.914132,  0.914093,  0.914054,  0.914015,  0.913976,  0.913938,
-	 0.913899,  0.913860,  0.913821,  0.913782,  0.913743,  0.913704,  0.913665,  0.913626,
-	 0.913587,  0.913548,  0.913509,  0.913470,  0.913431,  0.913392,  0.913353,  0.913314,
-	 0.913275,  0.913236,  0.913197,  0.913158,  0.913119,  0.913080,  0.913040,  0.913001,
-	 0.912962,  0.912923,  0.912884,  0.912845,  0.912806,  0.912766,  0.912727,  0.912688,
-	 0.912649,  0.912610,  0.912571,  0.912531,  0.912492,  0.912453,  0.912414,  0.912374,
-	 0.912335,  0.912296,  0.912257,  0.912217,  0.912178,  0.912139,  0.912099,  0.912060,
-	 0.912021,  0.911982,  0.911942,  0.911903,  0.911864,  0.911824,  0.911785,  0.911745,
-	 0.911706,  0.911667,  0.911627,  0.911588,  0.911548,  0.911509,  0.911470,  0.911430,
-	 0.911391,  0.911351,  0.911312,  0.911272,  0.911233,  0.911193,  0.911154,  0.911114,
-	 0.911075,  0.911035,  0.910996,  0.910956,  0.910917,  0.910877,  0.910837,  0.910798,
-	 0.910758,  0.910719,  0.910679,  0.910639,  0.910600,  0.910560,  0.910521,  0.910481,
-	 0.910441,  0.910402,  0.910362,  0.910322,  0.910283,  0.910243,  0.910203,  0.910163,
-	 0.910124,  0.910084,  0.910044,  0.910005,  0.909965,  0.909925,  0.909885,  0.909845,
-	 0.909806,  0.909766,  0.909726,  0.909686,  0.909646,  0.909607,  0.909567,  0.909527,
-	 0.909487,  0.909447,  0.909407,  0.909368,  0.909328,  0.909288,  0.909248,  0.909208,
-	 0.909168,  0.909128,  0.909088,  0.909048,  0.909008,  0.908968,  0.908928,  0.908888,
-	 0.908848,  0.908808,  0.908768,  0.908728,  0.908688,  0.908648,  0.908608,  0.908568,
-	 0.908528,  0.908488,  0.908448,  0.908408,  0.908368,  0.908328,  0.908288,  0.908248,
-	 0.908207,  0.908167,  0.908127,  0.908087,  0.908047,  0.908007,  0.907966,  0.907926,
-	 0.907886,  0.907846,  0.907806,  0.907766,  0.907725,  0.907685,  0.907645,  0.907605,
-	 0.907564,  0.907524,  0.907484,  0.907444,  0.907403,  0.907363,  0.907323,  0.907282,
-	 0.907242,  0.907202,  0.907161,  0.907121,  0.907081,  0.907040,  0.907000,  0.906959,
-	 0.906919,  0.906879,  0.906838,  0.906798,  0.906757,  0.906717,  0.906677,  0.906636,
-	 0.906596,  0.906555,  0.906515,  0.906474,  0.906434,  0.906393,  0.906353,  0.906312,
-	 0.906272,  0.906231,  0.906191,  0.906150,  0.906110,  0.906069,  0.906028,  0.905988,
-	 0.905947,  0.905907,  0.905866,  0.905825,  0.905785,  0.905744,  0.905704,  0.905663,
-	 0.905622,  0.905582,  0.905541,  0.905500,  0.905460,  0.905419,  0.905378,  0.905337,
-	 0.905297,  0.905256,  0.905215,  0.905175,  0.905134,  0.905093,  0.905052,  0.905011,
-	 0.904971,  0.904930,  0.904889,  0.904848,  0.904807,  0.904767,  0.904726,  0.904685,
-	 0.904644,  0.904603,  0.904562,  0.904521,  0.904481,  0.904440,  0.904399,  0.904358,
-	 0.904317,  0.904276,  0.904235,  0.904194,  0.904153,  0.904112,  0.904071,  0.904030,
-	 0.903989,  0.903948,  0.903907,  0.903866,  0.903825,  0.903784,  0.903743,  0.903702,
-	 0.903661,  0.903620,  0.903579,  0.903538,  0.903497,  0.903456,  0.903415,  0.903373,
-	 0.903332,  0.903291,  0.903250,  0.903209,  0.903168,  0.903127,  0.903085,  0.903044,
-	 0.903003,  0.902962,  0.902921,  0.902879,  0.902838,  0.902797,  0.902756,  0.902715,
-	 0.902673,  0.902632,  0.902591,  0.902550,  0.902508,  0.902467,  0.902426,  0.902384,
-	 0.902343,  0.902302,  0.902260,  0.902219,  0.902178,  0.902136,  0.902095,  0.902054,
-	 0.902012,  0.901971,  0.901929,  0.901888,  0.901847,  0.901805,  0.901764,  0.901722,
-	 0.901681,  0.901639,  0.901598,  0.901556,  0.901515,  0.901473,  0.901432,  0.901390,
-	 0.901349,  0.901307,  0.901266,  0.901224,  0.901183,  0.901141,  0.901100,  0.901058,
-	 0.901016,  0.900975,  0.900933,  0.900892,  0.900850,  0.900808,  0.900767,  0.900725,
-	 0.900683,  0.900642,  0.900600,  0.900558,  0.900517,  0.900475,  0.900433,  0.900392,
-	 0.900350,  0.900308,  0.900266,  0.900225,  0.900183,  0.900141,  0.900099,  0.900058,
-	 0.900016,  0.899974,  0.899932,  0.899890,  0.899849,  0.899807,  0.899765,  0.899723,
-	 0.899681,  0.899639,  0.899598,  0.899556,  0.899514,  0.899472,  0.899430,  0.899388,
-	 0.899346,  0.899304,  0.899262,  0.899220,  0.899179,  0.899137,  0.899095,  0.899053,
-	 0.899011,  0.898969,  0.898927,  0.898885,  0.898843,  0.898801,  0.898759,  0.898717,
-	 0.898674,  0.898632,  0.898590,  0.898548,  0.898506,  0.898464,  0.898422,  0.898380,
-	 0.898338,  0.898296,  0.898254,  0.898211,  0.898169,  0.898127,  0.898085,  0.898043,
-	 0.898001,  0.897958,  0.897916,  0.897874,  0.897832,  0.897790,  0.897747,  0.897705,
-	 0.897663,  0.897621,  0.897578,  0.897536,  0.897494,  0.897452,  0.897409,  0.897367,
-	 0.897325,  0.897282,  0.897240,  0.897198,  0.897155,  0.897113,  0.897071,  0.897028,
-	 0.896986,  0.896943,  0.896901,  0.896859,  0.896816,  0.896774,  0.896731,  0.896689,
-	 0.896646,  0.896604,  0.896562,  0.896519,  0.896477,  0.896434,  0.896392,  0.896349,
-	 0.896307,  0.896264,  0.896222,  0.896179,  0.896137,  0.896094,  0.896051,  0.896009,
-	 0.895966,  0.895924,  0.895881,  0.895838,  0.895796,  0.895753,  0.895711,  0.895668,
-	 0.895625,  0.895583,  0.895540,  0.895497,  0.895455,  0.895412,  0.895369,  0.895327,
-	 0.895284,  0.895241,  0.895198,  0.895156,  0.895113,  0.895070,  0.895028,  0.894985,
-	 0.894942,  0.894899,  0.894856,  0.894814,  0.894771,  0.894728,  0.894685,  0.894642,
-	 0.894599,  0.894557,  0.894514,  0.894471,  0.894428,  0.894385,  0.894342,  0.894299,
-	 0.894256,  0.894214,  0.894171,  0.894128,  0.894085,  0.894042,  0.893999,  0.893956,
-	 0.893913,  0.893870,  0.893827,  0.893784,  0.893741,  0.893698,  0.893655,  0.893612,
-	 0.893569,  0.893526,  0.893483,  0.893440,  0.893397,  0.893354,  0.893310,  0.893267,
-	 0.893224,  0.893181,  0.893138,  0.893095,  0.893052,  0.893009,  0.892965,  0.892922,
-	 0.892879,  0.892836,  0.892793,  0.892750,  0.892706,  0.892663,  0.892620,  0.892577,
-	 0.892534,  0.892490,  0.892447,  0.892404,  0.892361,  0.892317,  0.892274,  0.892231,
-	 0.892187,  0.892144,  0.892101,  0.892057,  0.892014,  0.891971,  0.891927,  0.891884,
-	 0.891841,  0.891797,  0.891754,  0.891711,  0.891667,  0.891624,  0.891580,  0.891537,
-	 0.891493,  0.891450,  0.891407,  0.891363,  0.891320,  0.891276,  0.891233,  0.891189,
-	 0.891146,  0.891102,  0.891059,  0.891015,  0.890972,  0.890928,  0.890885,  0.890841,
-	 0.890797,  0.890754,  0.890710,  0.890667,  0.890623,  0.890580,  0.890536,  0.890492,
-	 0.890449,  0.890405,  0.890361,  0.890318,  0.890274,  0.890230,  0.890187,  0.890143,
-	 0.890099,  0.890056,  0.890012,  0.889968,  0.889925,  0.889881,  0.889837,  0.889793,
-	 0.889750,  0.889706,  0.889662,  0.889618,  0.889574,  0.889531,  0.889487,  0.889443,
-	 0.889399,  0.889355,  0.889312,  0.889268,  0.889224,  0.889180,  0.889136,  0.889092,
-	 0.889048,  0.889004,  0.888961,  0.888917,  0.888873,  0.888829,  0.888785,  0.888741,
-	 0.888697,  0.888653,  0.888609,  0.888565,  0.888521,  0.888477,  0.888433,  0.888389,
-	 0.888345,  0.888301,  0.888257,  0.888213,  0.888169,  0.888125,  0.888081,  0.888037,
-	 0.887993,  0.887949,  0.887904,  0.887860,  0.887816,  0.887772,  0.887728,  0.887684,
-	 0.887640,  0.887595,  0.887551,  0.887507,  0.887463,  0.887419,  0.887375,  0.887330,
-	 0.887286,  0.887242,  0.887198,  0.887153,  0.887109,  0.887065,  0.887021,  0.886976,
-	 0.886932,  0.886888,  0.886844,  0.886799,  0.886755,  0.886711,  0.886666,  0.886622,
-	 0.886578,  0.886533,  0.886489,  0.886445,  0.886400,  0.886356,  0.886311,  0.886267,
-	 0.886223,  0.886178,  0.886134,  0.886089,  0.886045,  0.886000,  0.885956,  0.885911,
-	 0.885867,  0.885822,  0.885778,  0.885733,  0.885689,  0.885644,  0.885600,  0.885555,
-	 0.885511,  0.885466,  0.885422,  0.885377,  0.885333,  0.885288,  0.885243,  0.885199,
-	 0.885154,  0.885110,  0.885065,  0.885020,  0.884976,  0.884931,  0.884886,  0.884842,
-	 0.884797,  0.884752,  0.884708,  0.884663,  0.884618,  0.884574,  0.884529,  0.884484,
-	 0.884439,  0.884395,  0.884350,  0.884305,  0.884260,  0.884216,  0.884171,  0.884126,
-	 0.884081,  0.884036,  0.883992,  0.883947,  0.883902,  0.883857,  0.883812,  0.883767,
-	 0.883723,  0.883678,  0.883633,  0.883588,  0.883543,  0.883498,  0.883453,  0.883408,
-	 0.883363,  0.883318,  0.883273,  0.883228,  0.883184,  0.883139,  0.883094,  0.883049,
-	 0.883004,  0.882959,  0.882914,  0.882869,  0.882824,  0.882779,  0.882733,  0.882688,
-	 0.882643,  0.882598,  0.882553,  0.882508,  0.882463,  0.882418,  0.882373,  0.882328,
-	 0.882283,  0.882237,  0.882192,  0.882147,  0.882102,  0.882057,  0.882012,  0.881966,
-	 0.881921,  0.881876,  0.881831,  0.881786,  0.881740,  0.881695,  0.881650,  0.881605,
-	 0.881559,  0.881514,  0.881469,  0.881424,  0.881378,  0.881333,  0.881288,  0.881242,
-	 0.881197,  0.881152,  0.881106,  0.881061,  0.881016,  0.880970,  0.880925,  0.880880,
-	 0.880834,  0.880789,  0.880743,  0.880698,  0.880653,  0.880607,  0.880562,  0.880516,
-	 0.880471,  0.880425,  0.880380,  0.880334,  0.880289,  0.880244,  0.880198,  0.880153,
-	 0.880107,  0.880061,  0.880016,  0.879970,  0.879925,  0.879879,  0.879834,  0.879788,
-	 0.879743,  0.879697,  0.879651,  0.879606,  0.879560,  0.879515,  0.879469,  0.879423,
-	 0.879378,  0.879332,  0.879286,  0.879241,  0.879195,  0.879149,  0.879104,  0.879058,
-	 0.879012,  0.878967,  0.878921,  0.878875,  0.878829,  0.878784,  0.878738,  0.878692,
-	 0.878646,  0.878600,  0.878555,  0.878509,  0.878463,  0.878417,  0.878371,  0.878326,
-	 0.878280,  0.878234,  0.878188,  0.878142,  0.878096,  0.878051,  0.878005,  0.877959,
-	 0.877913,  0.877867,  0.877821,  0.877775,  0.877729,  0.877683,  0.877637,  0.877591,
-	 0.877545,  0.877499,  0.877453,  0.877407,  0.877361,  0.877315,  0.877269,  0.877223,
-	 0.877177,  0.877131,  0.877085,  0.877039,  0.876993,  0.876947,  0.876901,  0.876855,
-	 0.876809,  0.876763,  0.876716,  0.876670,  0.876624,  0.876578,  0.876532,  0.876486,
-	 0.876440,  0.876393,  0.876347,  0.876301,  0.876255,  0.876209,  0.876163,  0.876116,
-	 0.876070,  0.876024,  0.875978,  0.875931,  0.875885,  0.875839,  0.875793,  0.875746,
-	 0.875700,  0.875654,  0.875607,  0.875561,  0.875515,  0.875468,  0.875422,  0.875376,
-	 0.875329,  0.875283,  0.875237,  0.875190,  0.875144,  0.875098,  0.875051,  0.875005,
-	 0.874958,  0.874912,  0.874865,  0.874819,  0.874773,  0.874726,  0.874680,  0.874633,
-	 0.874587,  0.874540,  0.874494,  0.874447,  0.874401,  0.874354,  0.874308,  0.874261,
-	 0.874215,  0.874168,  0.874121,  0.874075,  0.874028,  0.873982,  0.873935,  0.873888,
-	 0.873842,  0.873795,  0.873749,  0.873702,  0.873655,  0.873609,  0.873562,  0.873515,
-	 0.873469,  0.873422,  0.873375,  0.873329,  0.873282,  0.873235,  0.873188,  0.873142,
-	 0.873095,  0.873048,  0.873001,  0.872955,  0.872908,  0.872861,  0.872814,  0.872768,
-	 0.872721,  0.872674,  0.872627,  0.872580,  0.872534,  0.872487,  0.872440,  0.872393,
-	 0.872346,  0.872299,  0.872252,  0.872205,  0.872159,  0.872112,  0.872065,  0.872018,
-	 0.871971,  0.871924,  0.871877,  0.871830,  0.871783,  0.871736,  0.871689,  0.871642,
-	 0.871595,  0.871548,  0.871501,  0.871454,  0.871407,  0.871360,  0.871313,  0.871266,
-	 0.871219,  0.871172,  0.871125,  0.871078,  0.871031,  0.870983,  0.870936,  0.870889,
-	 0.870842,  0.870795,  0.870748,  0.870701,  0.870654,  0.870606,  0.870559,  0.870512,
-	 0.870465,  0.870418,  0.870370,  0.870323,  0.870276,  0.870229,  0.870182,  0.870134,
-	 0.870087,  0.870040,  0.869992,  0.869945,  0.869898,  0.869851,  0.869803,  0.869756,
-	 0.869709,  0.869661,  0.869614,  0.869567,  0.869519,  0.869472,  0.869425,  0.869377,
-	 0.869330,  0.869282,  0.869235,  0.869188,  0.869140,  0.869093,  0.869045,  0.868998,
-	 0.868951,  0.868903,  0.868856,  0.868808,  0.868761,  0.868713,  0.868666,  0.868618,
-	 0.868571,  0.868523,  0.868476,  0.868428,  0.868381,  0.868333,  0.868285,  0.868238,
-	 0.868190,  0.868143,  0.868095,  0.868048,  0.868000,  0.867952,  0.867905,  0.867857,
-	 0.867809,  0.867762,  0.867714,  0.867667,  0.867619,  0.867571,  0.867523,  0.867476,
-	 0.867428,  0.867380,  0.867333,  0.867285,  0.867237,  0.867190,  0.867142,  0.867094,
-	 0.867046,  0.866998,  0.866951,  0.866903,  0.866855,  0.866807,  0.866759,  0.866712,
-	 0.866664,  0.866616,  0.866568,  0.866520,  0.866472,  0.866425,  0.866377,  0.866329,
-	 0.866281,  0.866233,  0.866185,  0.866137,  0.866089,  0.866041,  0.865993,  0.865946,
-	 0.865898,  0.865850,  0.865802,  0.865754,  0.865706,  0.865658,  0.865610,  0.865562,
-	 0.865514,  0.865466,  0.865418,  0.865369,  0.865321,  0.865273,  0.865225,  0.865177,
-	 0.865129,  0.865081,  0.865033,  0.864985,  0.864937,  0.864889,  0.864841,  0.864792,
-	 0.864744,  0.864696,  0.864648,  0.864600,  0.864552,  0.864503,  0.864455,  0.864407,
-	 0.864359,  0.864311,  0.864262,  0.864214,  0.864166,  0.864118,  0.864069,  0.864021,
-	 0.863973,  0.863925,  0.863876,  0.863828,  0.863780,  0.863731,  0.863683,  0.863635,
-	 0.863586,  0.863538,  0.863490,  0.863441,  0.863393,  0.863345,  0.863296,  0.863248,
-	 0.863199,  0.863151,  0.863103,  0.863054,  0.863006,  0.862957,  0.862909,  0.862860,
-	 0.862812,  0.862763,  0.862715,  0.862666,  0.862618,  0.862570,  0.862521,  0.862472,
-	 0.862424,  0.862375,  0.862327,  0.862278,  0.862230,  0.862181,  0.862133,  0.862084,
-	 0.862035,  0.861987,  0.861938,  0.861890,  0.861841,  0.861792,  0.861744,  0.861695,
-	 0.861646,  0.861598,  0.861549,  0.861500,  0.861452,  0.861403,  0.861354,  0.861306,
-	 0.861257,  0.861208,  0.861160,  0.861111,  0.861062,  0.861013,  0.860964,  0.860916,
-	 0.860867,  0.860818,  0.860769,  0.860721,  0.860672,  0.860623,  0.860574,  0.860525,
-	 0.860476,  0.860428,  0.860379,  0.860330,  0.860281,  0.860232,  0.860183,  0.860134,
-	 0.860085,  0.860036,  0.859988,  0.859939,  0.859890,  0.859841,  0.859792,  0.859743,
-	 0.859694,  0.859645,  0.859596,  0.859547,  0.859498,  0.859449,  0.859400,  0.859351,
-	 0.859302,  0.859253,  0.859204,  0.859155,  0.859106,  0.859057,  0.859007,  0.858958,
-	 0.858909,  0.858860,  0.858811,  0.858762,  0.858713,  0.858664,  0.858615,  0.858565,
-	 0.858516,  0.858467,  0.858418,  0.858369,  0.858320,  0.858270,  0.858221,  0.858172,
-	 0.858123,  0.858073,  0.858024,  0.857975,  0.857926,  0.857876,  0.857827,  0.857778,
-	 0.857729,  0.857679,  0.857630,  0.857581,  0.857531,  0.857482,  0.857433,  0.857383,
-	 0.857334,  0.857285,  0.857235,  0.857186,  0.857137,  0.857087,  0.857038,  0.856988,
-	 0.856939,  0.856890,  0.856840,  0.856791,  0.856741,  0.856692,  0.856642,  0.856593,
-	 0.856543,  0.856494,  0.856444,  0.856395,  0.856345,  0.856296,  0.856246,  0.856197,
-	 0.856147,  0.856098,  0.856048,  0.855999,  0.855949,  0.855900,  0.855850,  0.855800,
-	 0.855751,  0.855701,  0.855651,  0.855602,  0.855552,  0.855503,  0.855453,  0.855403,
-	 0.855354,  0.855304,  0.855254,  0.855205,  0.855155,  0.855105,  0.855056,  0.855006,
-	 0.854956,  0.854906,  0.854857,  0.854807,  0.854757,  0.854707,  0.854658,  0.854608,
-	 0.854558,  0.854508,  0.854458,  0.854409,  0.854359,  0.854309,  0.854259,  0.854209,
-	 0.854159,  0.854110,  0.854060,  0.854010,  0.853960,  0.853910,  0.853860,  0.853810,
-	 0.853760,  0.853710,  0.853660,  0.853611,  0.853561,  0.853511,  0.853461,  0.853411,
-	 0.853361,  0.853311,  0.853261,  0.853211,  0.853161,  0.853111,  0.853061,  0.853011,
-	 0.852961,  0.852911,  0.852861,  0.852810,  0.852760,  0.852710,  0.852660,  0.852610,
-	 0.852560,  0.852510,  0.852460,  0.852410,  0.852360,  0.852309,  0.852259,  0.852209,
-	 0.852159,  0.852109,  0.852059,  0.852008,  0.851958,  0.851908,  0.851858,  0.851808,
-	 0.851757,  0.851707,  0.851657,  0.851607,  0.851556,  0.851506,  0.851456,  0.851406,
-	 0.851355,  0.851305,  0.851255,  0.851204,  0.851154,  0.851104,  0.851053,  0.851003,
-	 0.850953,  0.850902,  0.850852,  0.850801,  0.850751,  0.850701,  0.850650,  0.850600,
-	 0.850549,  0.850499,  0.850449,  0.850398,  0.850348,  0.850297,  0.850247,  0.850196,
-	 0.850146,  0.850095,  0.850045,  0.849994,  0.849944,  0.849893,  0.849843,  0.849792,
-	 0.849742,  0.849691,  0.849641,  0.849590,  0.849540,  0.849489,  0.849438,  0.849388,
-	 0.849337,  0.849287,  0.849236,  0.849185,  0.849135,  0.849084,  0.849033,  0.848983,
-	 0.848932,  0.848881,  0.848831,  0.848780,  0.848729,  0.848679,  0.848628,  0.848577,
-	 0.848526,  0.848476,  0.848425,  0.848374,  0.848323,  0.848273,  0.848222,  0.848171,
-	 0.848120,  0.848070,  0.848019,  0.847968,  0.847917,  0.847866,  0.847815,  0.847765,
-	 0.847714,  0.847663,  0.847612,  0.847561,  0.847510,  0.847459,  0.847408,  0.847358,
-	 0.847307,  0.847256,  0.847205,  0.847154,  0.847103,  0.847052,  0.847001,  0.846950,
-	 0.846899,  0.846848,  0.846797,  0.846746,  0.846695,  0.846644,  0.846593,  0.846542,
-	 0.846491,  0.846440,  0.846389,  0.846338,  0.846287,  0.846236,  0.846185,  0.846133,
-	 0.846082,  0.846031,  0.845980,  0.845929,  0.845878,  0.845827,  0.845776,  0.845724,
-	 0.845673,  0.845622,  0.845571,  0.845520,  0.845469,  0.845417,  0.845366,  0.845315,
-	 0.845264,  0.845212,  0.845161,  0.845110,  0.845059,  0.845007,  0.844956,  0.844905,
-	 0.844854,  0.844802,  0.844751,  0.844700,  0.844648,  0.844597,  0.844546,  0.844494,
-	 0.844443,  0.844392,  0.844340,  0.844289,  0.844238,  0.844186,  0.844135,  0.844083,
-	 0.844032,  0.843980,  0.843929,  0.843878,  0.843826,  0.843775,  0.843723,  0.843672,
-	 0.843620,  0.843569,  0.843517,  0.843466,  0.843414,  0.843363,  0.843311,  0.843260,
-	 0.843208,  0.843157,  0.843105,  0.843054,  0.843002,  0.842950,  0.842899,  0.842847,
-	 0.842796,  0.842744,  0.842692,  0.842641,  0.842589,  0.842538,  0.842486,  0.842434,
-	 0.842383,  0.842331,  0.842279,  0.842228,  0.842176,  0.842124,  0.842072,  0.842021,
-	 0.841969,  0.841917,  0.841866,  0.841814,  0.841762,  0.841710,  0.841659,  0.841607,
-	 0.841555,  0.841503,  0.841451,  0.841400,  0.841348,  0.841296,  0.841244,  0.841192,
-	 0.841140,  0.841089,  0.841037,  0.840985,  0.840933,  0.840881,  0.840829,  0.840777,
-	 0.840725,  0.840673,  0.840622,  0.840570,  0.840518,  0.840466,  0.840414,  0.840362,
-	 0.840310,  0.840258,  0.840206,  0.840154,  0.840102,  0.840050,  0.839998,  0.839946,
-	 0.839894,  0.839842,  0.839790,  0.839738,  0.839686,  0.839634,  0.839581,  0.839529,
-	 0.839477,  0.839425,  0.839373,  0.839321,  0.839269,  0.839217,  0.839165,  0.839112,
-	 0.839060,  0.839008,  0.838956,  0.838904,  0.838852,  0.838799,  0.838747,  0.838695,
-	 0.838643,  0.838591,  0.838538,  0.838486,  0.838434,  0.838382,  0.838329,  0.838277,
-	 0.838225,  0.838172,  0.838120,  0.838068,  0.838015,  0.837963,  0.837911,  0.837859,
-	 0.837806,  0.837754,  0.837701,  0.837649,  0.837597,  0.837544,  0.837492,  0.837440,
-	 0.837387,  0.837335,  0.837282,  0.837230,  0.837178,  0.837125,  0.837073,  0.837020,
-	 0.836968,  0.836915,  0.836863,  0.836810,  0.836758,  0.836705,  0.836653,  0.836600,
-	 0.836548,  0.836495,  0.836443,  0.836390,  0.836338,  0.836285,  0.836232,  0.836180,
-	 0.836127,  0.836075,  0.836022,  0.835969,  0.835917,  0.835864,  0.835812,  0.835759,
-	 0.835706,  0.835654,  0.835601,  0.835548,  0.835496,  0.835443,  0.835390,  0.835338,
-	 0.835285,  0.835232,  0.835179,  0.835127,  0.835074,  0.835021,  0.834968,  0.834916,
-	 0.834863,  0.834810,  0.834757,  0.834705,  0.834652,  0.834599,  0.834546,  0.834493,
-	 0.834440,  0.834388,  0.834335,  0.834282,  0.834229,  0.834176,  0.834123,  0.834070,
-	 0.834018,  0.833965,  0.833912,  0.833859,  0.833806,  0.833753,  0.833700,  0.833647,
-	 0.833594,  0.833541,  0.833488,  0.833435,  0.833382,  0.833329,  0.833276,  0.833223,
-	 0.833170,  0.833117,  0.833064,  0.833011,  0.832958,  0.832905,  0.832852,  0.832799,
-	 0.832746,  0.832693,  0.832640,  0.832586,  0.832533,  0.832480,  0.832427,  0.832374,
-	 0.832321,  0.832268,  0.832215,  0.832161,  0.832108,  0.832055,  0.832002,  0.831949,
-	 0.831895,  0.831842,  0.831789,  0.831736,  0.831683,  0.831629,  0.831576,  0.831523,
-	 0.831470,  0.831416,  0.831363,  0.831310,  0.831257,  0.831203,  0.831150,  0.831097,
-	 0.831043,  0.830990,  0.830937,  0.830883,  0.830830,  0.830777,  0.830723,  0.830670,
-	 0.830616,  0.830563,  0.830510,  0.830456,  0.830403,  0.830349,  0.830296,  0.830243,
-	 0.830189,  0.830136,  0.830082,  0.830029,  0.829975,  0.829922,  0.829868,  0.829815,
-	 0.829761,  0.829708,  0.829654,  0.829601,  0.829547,  0.829494,  0.829440,  0.829386,
-	 0.829333,  0.829279,  0.829226,  0.829172,  0.829119,  0.829065,  0.829011,  0.828958,
-	 0.828904,  0.828851,  0.828797,  0.828743,  0.828690,  0.828636,  0.828582,  0.828529,
-	 0.828475,  0.828421,  0.828367,  0.828314,  0.828260,  0.828206,  0.828153,  0.828099,
-	 0.828045,  0.827991,  0.827938,  0.827884,  0.827830,  0.827776,  0.827722,  0.827669,
-	 0.827615,  0.827561,  0.827507,  0.827453,  0.827399,  0.827346,  0.827292,  0.827238,
-	 0.827184,  0.827130,  0.827076,  0.827022,  0.826968,  0.826915,  0.826861,  0.826807,
-	 0.826753,  0.826699,  0.826645,  0.826591,  0.826537,  0.826483,  0.826429,  0.826375,
-	 0.826321,  0.826267,  0.826213,  0.826159,  0.826105,  0.826051,  0.825997,  0.825943,
-	 0.825889,  0.825835,  0.825781,  0.825727,  0.825673,  0.825618,  0.825564,  0.825510,
-	 0.825456,  0.825402,  0.825348,  0.825294,  0.825240,  0.825185,  0.825131,  0.825077,
-	 0.825023,  0.824969,  0.824915,  0.824860,  0.824806,  0.824752,  0.824698,  0.824644,
-	 0.824589,  0.824535,  0.824481,  0.824427,  0.824372,  0.824318,  0.824264,  0.824209,
-	 0.824155,  0.824101,  0.824047,  0.823992,  0.823938,  0.823884,  0.823829,  0.823775,
-	 0.823721,  0.823666,  0.823612,  0.823557,  0.823503,  0.823449,  0.823394,  0.823340,
-	 0.823285,  0.823231,  0.823177,  0.823122,  0.823068,  0.823013,  0.822959,  0.822904,
-	 0.822850,  0.822795,  0.822741,  0.822686,  0.822632,  0.822577,  0.822523,  0.822468,
-	 0.822414,  0.822359,  0.822305,  0.822250,  0.822195,  0.822141,  0.822086,  0.822032,
-	 0.821977,  0.821922,  0.821868,  0.821813,  0.821759,  0.821704,  0.821649,  0.821595,
-	 0.821540,  0.821485,  0.821431,  0.821376,  0.821321,  0.821267,  0.821212,  0.821157,
-	 0.821102,  0.821048,  0.820993,  0.820938,  0.820884,  0.820829,  0.820774,  0.820719,
-	 0.820664,  0.820610,  0.820555,  0.820500,  0.820445,  0.820390,  0.820336,  0.820281,
-	 0.820226,  0.820171,  0.820116,  0.820061,  0.820007,  0.819952,  0.819897,  0.819842,
-	 0.819787,  0.819732,  0.819677,  0.819622,  0.819567,  0.819512,  0.819457,  0.819402,
-	 0.819348,  0.819293,  0.819238,  0.819183,  0.819128,  0.819073,  0.819018,  0.818963,
-	 0.818908,  0.818853,  0.818798,  0.818742,  0.818687,  0.818632,  0.818577,  0.818522,
-	 0.818467,  0.818412,  0.818357,  0.818302,  0.818247,  0.818192,  0.818137,  0.818081,
-	 0.818026,  0.817971,  0.817916,  0.817861,  0.817806,  0.817750,  0.817695,  0.817640,
-	 0.817585,  0.817530,  0.817474,  0.817419,  0.817364,  0.817309,  0.817253,  0.817198,
-	 0.817143,  0.817088,  0.817032,  0.816977,  0.816922,  0.816867,  0.816811,  0.816756,
-	 0.816701,  0.816645,  0.816590,  0.816535,  0.816479,  0.816424,  0.816368,  0.816313,
-	 0.816258,  0.816202,  0.816147,  0.816092,  0.816036,  0.815981,  0.815925,  0.815870,
-	 0.815814,  0.815759,  0.815704,  0.815648,  0.815593,  0.815537,  0.815482,  0.815426,
-	 0.815371,  0.815315,  0.815260,  0.815204,  0.815149,  0.815093,  0.815037,  0.814982,
-	 0.814926,  0.814871,  0.814815,  0.814760,  0.814704,  0.814648,  0.814593,  0.814537,
-	 0.814482,  0.814426,  0.814370,  0.814315,  0.814259,  0.814203,  0.814148,  0.814092,
-	 0.814036,  0.813981,  0.813925,  0.813869,  0.813814,  0.813758,  0.813702,  0.813646,
-	 0.813591,  0.813535,  0.813479,  0.813423,  0.813368,  0.813312,  0.813256,  0.813200,
-	 0.813144,  0.813089,  0.813033,  0.812977,  0.812921,  0.812865,  0.812809,  0.812754,
-	 0.812698,  0.812642,  0.812586,  0.812530,  0.812474,  0.812418,  0.812362,  0.812307,
-	 0.812251,  0.812195,  0.812139,  0.812083,  0.812027,  0.811971,  0.811915,  0.811859,
-	 0.811803,  0.811747,  0.811691,  0.811635,  0.811579,  0.811523,  0.811467,  0.811411,
-	 0.811355,  0.811299,  0.811243,  0.811187,  0.811131,  0.811075,  0.811018,  0.810962,
-	 0.810906,  0.810850,  0.810794,  0.810738,  0.810682,  0.810626,  0.810570,  0.810513,
-	 0.810457,  0.810401,  0.810345,  0.810289,  0.810232,  0.810176,  0.810120,  0.810064,
-	 0.810008,  0.809951,  0.809895,  0.809839,  0.809783,  0.809726,  0.809670,  0.809614,
-	 0.809558,  0.809501,  0.809445,  0.809389,  0.809332,  0.809276,  0.809220,  0.809164,
-	 0.809107,  0.809051,  0.808994,  0.808938,  0.808882,  0.808825,  0.808769,  0.808713,
-	 0.808656,  0.808600,  0.808543,  0.808487,  0.808430,  0.808374,  0.808318,  0.808261,
-	 0.808205,  0.808148,  0.808092,  0.808035,  0.807979,  0.807922,  0.807866,  0.807809,
-	 0.807753,  0.807696,  0.807640,  0.807583,  0.807527,  0.807470,  0.807414,  0.807357,
-	 0.807300,  0.807244,  0.807187,  0.807131,  0.807074,  0.807017,  0.806961,  0.806904,
-	 0.806848,  0.806791,  0.806734,  0.806678,  0.806621,  0.806564,  0.806508,  0.806451,
-	 0.806394,  0.806338,  0.806281,  0.806224,  0.806167,  0.806111,  0.806054,  0.805997,
-	 0.805940,  0.805884,  0.805827,  0.805770,  0.805713,  0.805656,  0.805600,  0.805543,
-	 0.805486,  0.805429,  0.805372,  0.805316,  0.805259,  0.805202,  0.805145,  0.805088,
-	 0.805031,  0.804974,  0.804918,  0.804861,  0.804804,  0.804747,  0.804690,  0.804633,
-	 0.804576,  0.804519,  0.804462,  0.804405,  0.804348,  0.804291,  0.804234,  0.804177,
-	 0.804120,  0.804063,  0.804006,  0.803949,  0.803892,  0.803835,  0.803778,  0.803721,
-	 0.803664,  0.803607,  0.803550,  0.803493,  0.803436,  0.803379,  0.803322,  0.803265,
-	 0.803208,  0.803150,  0.803093,  0.803036,  0.802979,  0.802922,  0.802865,  0.802808,
-	 0.802750,  0.802693,  0.802636,  0.802579,  0.802522,  0.802464,  0.802407,  0.802350,
-	 0.802293,  0.802236,  0.802178,  0.802121,  0.802064,  0.802007,  0.801949,  0.801892,
-	 0.801835,  0.801777,  0.801720,  0.801663,  0.801606,  0.801548,  0.801491,  0.801434,
-	 0.801376,  0.801319,  0.801261,  0.801204,  0.801147,  0.801089,  0.801032,  0.800975,
-	 0.800917,  0.800860,  0.800802,  0.800745,  0.800687,  0.800630,  0.800573,  0.800515,
-	 0.800458,  0.800400,  0.800343,  0.800285,  0.800228,  0.800170,  0.800113,  0.800055,
-	 0.799998,  0.799940,  0.799883,  0.799825,  0.799768,  0.799710,  0.799652,  0.799595,
-	 0.799537,  0.799480,  0.799422,  0.799365,  0.799307,  0.799249,  0.799192,  0.799134,
-	 0.799076,  0.799019,  0.798961,  0.798903,  0.798846,  0.798788,  0.798730,  0.798673,
-	 0.798615,  0.798557,  0.798500,  0.798442,  0.798384,  0.798326,  0.798269,  0.798211,
-	 0.798153,  0.798095,  0.798038,  0.797980,  0.797922,  0.797864,  0.797806,  0.797749,
-	 0.797691,  0.797633,  0.797575,  0.797517,  0.797459,  0.797402,  0.797344,  0.797286,
-	 0.797228,  0.797170,  0.797112,  0.797054,  0.796996,  0.796939,  0.796881,  0.796823,
-	 0.796765,  0.796707,  0.796649,  0.796591,  0.796533,  0.796475,  0.796417,  0.796359,
-	 0.796301,  0.796243,  0.796185,  0.796127,  0.796069,  0.796011,  0.795953,  0.795895,
-	 0.795837,  0.795779,  0.795721,  0.795663,  0.795605,  0.795547,  0.795488,  0.795430,
-	 0.795372,  0.795314,  0.795256,  0.795198,  0.795140,  0.795082,  0.795023,  0.794965,
-	 0.794907,  0.794849,  0.794791,  0.794733,  0.794674,  0.794616,  0.794558,  0.794500,
-	 0.794442,  0.794383,  0.794325,  0.794267,  0.794209,  0.794150,  0.794092,  0.794034,
-	 0.793975,  0.793917,  0.793859,  0.793801,  0.793742,  0.793684,  0.793626,  0.793567,
-	 0.793509,  0.793451,  0.793392,  0.793334,  0.793276,  0.793217,  0.793159,  0.793100,
-	 0.793042,  0.792984,  0.792925,  0.792867,  0.792808,  0.792750,  0.792691,  0.792633,
-	 0.792575,  0.792516,  0.792458,  0.792399,  0.792341,  0.792282,  0.792224,  0.792165,
-	 0.792107,  0.792048,  0.791990,  0.791931,  0.791872,  0.791814,  0.791755,  0.791697,
-	 0.791638,  0.791580,  0.791521,  0.791462,  0.791404,  0.791345,  0.791287,  0.791228,
-	 0.791169,  0.791111,  0.791052,  0.790993,  0.790935,  0.790876,  0.790817,  0.790759,
-	 0.790700,  0.790641,  0.790583,  0.790524,  0.790465,  0.790406,  0.790348,  0.790289,
-	 0.790230,  0.790171,  0.790113,  0.790054,  0.789995,  0.789936,  0.789878,  0.789819,
-	 0.789760,  0.789701,  0.789642,  0.789584,  0.789525,  0.789466,  0.789407,  0.789348,
-	 0.789289,  0.789230,  0.789172,  0.789113,  0.789054,  0.788995,  0.788936,  0.788877,
-	 0.788818,  0.788759,  0.788700,  0.788641,  0.788582,  0.788523,  0.788464,  0.788405,
-	 0.788346,  0.788287,  0.788228,  0.788169,  0.788110,  0.788051,  0.787992,  0.787933,
-	 0.787874,  0.787815,  0.787756,  0.787697,  0.787638,  0.787579,  0.787520,  0.787461,
-	 0.787402,  0.787343,  0.787284,  0.787224,  0.787165,  0.787106,  0.787047,  0.786988,
-	 0.786929,  0.786870,  0.786810,  0.786751,  0.786692,  0.786633,  0.786574,  0.786514,
-	 0.786455,  0.786396,  0.786337,  0.786278,  0.786218,  0.786159,  0.786100,  0.786041,
-	 0.785981,  0.785922,  0.785863,  0.785803,  0.785744,  0.785685,  0.785625,  0.785566,
-	 0.785507,  0.785447,  0.785388,  0.785329,  0.785269,  0.785210,  0.785151,  0.785091,
-	 0.785032,  0.784973,  0.784913,  0.784854,  0.784794,  0.784735,  0.784675,  0.784616,
-	 0.784557,  0.784497,  0.784438,  0.784378,  0.784319,  0.784259,  0.784200,  0.784140,
-	 0.784081,  0.784021,  0.783962,  0.783902,  0.783843,  0.783783,  0.783724,  0.783664,
-	 0.783605,  0.783545,  0.783485,  0.783426,  0.783366,  0.783307,  0.783247,  0.783187,
-	 0.783128,  0.783068,  0.783009,  0.782949,  0.782889,  0.782830,  0.782770,  0.782710,
-	 0.782651,  0.782591,  0.782531,  0.782472,  0.782412,  0.782352,  0.782292,  0.782233,
-	 0.782173,  0.782113,  0.782053,  0.781994,  0.781934,  0.781874,  0.781814,  0.781755,
-	 0.781695,  0.781635,  0.781575,  0.781515,  0.781456,  0.781396,  0.781336,  0.781276,
-	 0.781216,  0.781156,  0.781097,  0.781037,  0.780977,  0.780917,  0.780857,  0.780797,
-	 0.780737,  0.780677,  0.780617,  0.780557,  0.780498,  0.780438,  0.780378,  0.780318,
-	 0.780258,  0.780198,  0.780138,  0.780078,  0.780018,  0.779958,  0.779898,  0.779838,
-	 0.779778,  0.779718,  0.779658,  0.779598,  0.779538,  0.779478,  0.779418,  0.779357,
-	 0.779297,  0.779237,  0.779177,  0.779117,  0.779057,  0.778997,  0.778937,  0.778877,
-	 0.778817,  0.778756,  0.778696,  0.778636,  0.778576,  0.778516,  0.778456,  0.778395,
-	 0.778335,  0.778275,  0.778215,  0.778155,  0.778094,  0.778034,  0.777974,  0.777914,
-	 0.777853,  0.777793,  0.777733,  0.777673,  0.777612,  0.777552,  0.777492,  0.777431,
-	 0.777371,  0.777311,  0.777251,  0.777190,  0.777130,  0.777070,  0.777009,  0.776949,
-	 0.776888,  0.776828,  0.776768,  0.776707,  0.776647,  0.776587,  0.776526,  0.776466,
-	 0.776405,  0.776345,  0.776284,  0.776224,  0.776164,  0.776103,  0.776043,  0.775982,
-	 0.775922,  0.775861,  0.775801,  0.775740,  0.775680,  0.775619,  0.775559,  0.775498,
-	 0.775438,  0.775377,  0.775317,  0.775256,  0.775195,  0.775135,  0.775074,  0.775014,
-	 0.774953,  0.774893,  0.774832,  0.774771,  0.774711,  0.774650,  0.774589,  0.774529,
-	 0.774468,  0.774407,  0.774347,  0.774286,  0.774225,  0.774165,  0.774104,  0.774043,
-	 0.773983,  0.773922,  0.773861,  0.773801,  0.773740,  0.773679,  0.773618,  0.773558,
-	 0.773497,  0.773436,  0.773375,  0.773314,  0.773254,  0.773193,  0.773132,  0.773071,
-	 0.773010,  0.772950,  0.772889,  0.772828,  0.772767,  0.772706,  0.772645,  0.772584,
-	 0.772524,  0.772463,  0.772402,  0.772341,  0.772280,  0.772219,  0.772158,  0.772097,
-	 0.772036,  0.771975,  0.771915,  0.771854,  0.771793,  0.771732,  0.771671,  0.771610,
-	 0.771549,  0.771488,  0.771427,  0.771366,  0.771305,  0.771244,  0.771183,  0.771122,
-	 0.771061,  0.770999,  0.770938,  0.770877,  0.770816,  0.770755,  0.770694,  0.770633,
-	 0.770572,  0.770511,  0.770450,  0.770389,  0.770327,  0.770266,  0.770205,  0.770144,
-	 0.770083,  0.770022,  0.769961,  0.769899,  0.769838,  0.769777,  0.769716,  0.769655,
-	 0.769593,  0.769532,  0.769471,  0.769410,  0.769348,  0.769287,  0.769226,  0.769165,
-	 0.769103,  0.769042,  0.768981,  0.768919,  0.768858,  0.768797,  0.768736,  0.768674,
-	 0.768613,  0.768552,  0.768490,  0.768429,  0.768368,  0.768306,  0.768245,  0.768183,
-	 0.768122,  0.768061,  0.767999,  0.767938,  0.767876,  0.767815,  0.767754,  0.767692,
-	 0.767631,  0.767569,  0.767508,  0.767446,  0.767385,  0.767323,  0.767262,  0.767200,
-	 0.767139,  0.767077,  0.767016,  0.766954,  0.766893,  0.766831,  0.766770,  0.766708,
-	 0.766647,  0.766585,  0.766524,  0.766462,  0.766400,  0.766339,  0.766277,  0.766216,
-	 0.766154,  0.766092,  0.766031,  0.765969,  0.765907,  0.765846,  0.765784,  0.765723,
-	 0.765661,  0.765599,  0.765538,  0.765476,  0.765414,  0.765352,  0.765291,  0.765229,
-	 0.765167,  0.765106,  0.765044,  0.764982,  0.764920,  0.764859,  0.764797,  0.764735,
-	 0.764673,  0.764611,  0.764550,  0.764488,  0.764426,  0.764364,  0.764302,  0.764241,
-	 0.764179,  0.764117,  0.764055,  0.763993,  0.763931,  0.763869,  0.763808,  0.763746,
-	 0.763684,  0.763622,  0.763560,  0.763498,  0.763436,  0.763374,  0.763312,  0.763250,
-	 0.763188,  0.763126,  0.763065,  0.763003,  0.762941,  0.762879,  0.762817,  0.762755,
-	 0.762693,  0.762631,  0.762569,  0.762507,  0.762444,  0.762382,  0.762320,  0.762258,
-	 0.762196,  0.762134,  0.762072,  0.762010,  0.761948,  0.761886,  0.761824,  0.761762,
-	 0.761700,  0.761637,  0.761575,  0.761513,  0.761451,  0.761389,  0.761327,  0.761265,
-	 0.761202,  0.761140,  0.761078,  0.761016,  0.760954,  0.760891,  0.760829,  0.760767,
-	 0.760705,  0.760643,  0.760580,  0.760518,  0.760456,  0.760394,  0.760331,  0.760269,
-	 0.760207,  0.760144,  0.760082,  0.760020,  0.759957,  0.759895,  0.759833,  0.759771,
-	 0.759708,  0.759646,  0.759583,  0.759521,  0.759459,  0.759396,  0.759334,  0.759272,
-	 0.759209,  0.759147,  0.759084,  0.759022,  0.758960,  0.758897,  0.758835,  0.758772,
-	 0.758710,  0.758647,  0.758585,  0.758522,  0.758460,  0.758397,  0.758335,  0.758272,
-	 0.758210,  0.758147,  0.758085,  0.758022,  0.757960,  0.757897,  0.757835,  0.757772,
-	 0.757710,  0.757647,  0.757584,  0.757522,  0.757459,  0.757397,  0.757334,  0.757271,
-	 0.757209,  0.757146,  0.757084,  0.757021,  0.756958,  0.756896,  0.756833,  0.756770,
-	 0.756708,  0.756645,  0.756582,  0.756520,  0.756457,  0.756394,  0.756331,  0.756269,
-	 0.756206,  0.756143,  0.756081,  0.756018,  0.755955,  0.755892,  0.755829,  0.755767,
-	 0.755704,  0.755641,  0.755578,  0.755516,  0.755453,  0.755390,  0.755327,  0.755264,
-	 0.755201,  0.755139,  0.755076,  0.755013,  0.754950,  0.754887,  0.754824,  0.754761,
-	 0.754698,  0.754636,  0.754573,  0.754510,  0.754447,  0.754384,  0.754321,  0.754258,
-	 0.754195,  0.754132,  0.754069,  0.754006,  0.753943,  0.753880,  0.753817,  0.753754,
-	 0.753691,  0.753628,  0.753565,  0.753502,  0.753439,  0.753376,  0.753313,  0.753250,
-	 0.753187,  0.753124,  0.753061,  0.752998,  0.752934,  0.752871,  0.752808,  0.752745,
-	 0.752682,  0.752619,  0.752556,  0.752493,  0.752429,  0.752366,  0.752303,  0.752240,
-	 0.752177,  0.752114,  0.752050,  0.751987,  0.751924,  0.751861,  0.751798,  0.751734,
-	 0.751671,  0.751608,  0.751545,  0.751481,  0.751418,  0.751355,  0.751292,  0.751228,
-	 0.751165,  0.751102,  0.751039,  0.750975,  0.750912,  0.750849,  0.750785,  0.750722,
-	 0.750659,  0.750595,  0.750532,  0.750469,  0.750405,  0.750342,  0.750278,  0.750215,
-	 0.750152,  0.750088,  0.750025,  0.749961,  0.749898,  0.749835,  0.749771,  0.749708,
-	 0.749644,  0.749581,  0.749517,  0.749454,  0.749390,  0.749327,  0.749263,  0.749200,
-	 0.749136,  0.749073,  0.749009,  0.748946,  0.748882,  0.748819,  0.748755,  0.748692,
-	 0.748628,  0.748565,  0.748501,  0.748437,  0.748374,  0.748310,  0.748247,  0.748183,
-	 0.748119,  0.748056,  0.747992,  0.747929,  0.747865,  0.747801,  0.747738,  0.747674,
-	 0.747610,  0.747547,  0.747483,  0.747419,  0.747355,  0.747292,  0.747228,  0.747164,
-	 0.747101,  0.747037,  0.746973,  0.746909,  0.746846,  0.746782,  0.746718,  0.746654,
-	 0.746591,  0.746527,  0.746463,  0.746399,  0.746335,  0.746272,  0.746208,  0.746144,
-	 0.746080,  0.746016,  0.745952,  0.745889,  0.745825,  0.745761,  0.745697,  0.745633,
-	 0.745569,  0.745505,  0.745441,  0.745377,  0.745314,  0.745250,  0.745186,  0.745122,
-	 0.745058,  0.744994,  0.744930,  0.744866,  0.744802,  0.744738,  0.744674,  0.744610,
-	 0.744546,  0.744482,  0.744418,  0.744354,  0.744290,  0.744226,  0.744162,  0.744098,
-	 0.744034,  0.743970,  0.743906,  0.743842,  0.743777,  0.743713,  0.743649,  0.743585,
-	 0.743521,  0.743457,  0.743393,  0.743329,  0.743265,  0.743200,  0.743136,  0.743072,
-	 0.743008,  0.742944,  0.742880,  0.742815,  0.742751,  0.742687,  0.742623,  0.742559,
-	 0.742494,  0.742430,  0.742366,  0.742302,  0.742237,  0.742173,  0.742109,  0.742045,
-	 0.741980,  0.741916,  0.741852,  0.741788,  0.741723,  0.741659,  0.741595,  0.741530,
-	 0.741466,  0.741402,  0.741337,  0.741273,  0.741209,  0.741144,  0.741080,  0.741015,
-	 0.740951,  0.740887,  0.740822,  0.740758,  0.740694,  0.740629,  0.740565,  0.740500,
-	 0.740436,  0.740371,  0.740307,  0.740242,  0.740178,  0.740114,  0.740049,  0.739985,
-	 0.739920,  0.739856,  0.739791,  0.739727,  0.739662,  0.739598,  0.739533,  0.739468,
-	 0.739404,  0.739339,  0.739275,  0.739210,  0.739146,  0.739081,  0.739017,  0.738952,
-	 0.738887,  0.738823,  0.738758,  0.738693,  0.738629,  0.738564,  0.738500,  0.738435,
-	 0.738370,  0.738306,  0.738241,  0.738176,  0.738112,  0.738047,  0.737982,  0.737918,
-	 0.737853,  0.737788,  0.737723,  0.737659,  0.737594,  0.737529,  0.737464,  0.737400,
-	 0.737335,  0.737270,  0.737205,  0.737141,  0.737076,  0.737011,  0.736946,  0.736881,
-	 0.736817,  0.736752,  0.736687,  0.736622,  0.736557,  0.736492,  0.736428,  0.736363,
-	 0.736298,  0.736233,  0.736168,  0.736103,  0.736038,  0.735973,  0.735908,  0.735844,
-	 0.735779,  0.735714,  0.735649,  0.735584,  0.735519,  0.735454,  0.735389,  0.735324,
-	 0.735259,  0.735194,  0.735129,  0.735064,  0.734999,  0.734934,  0.734869,  0.734804,
-	 0.734739,  0.734674,  0.734609,  0.734544,  0.734479,  0.734414,  0.734349,  0.734283,
-	 0.734218,  0.734153,  0.734088,  0.734023,  0.733958,  0.733893,  0.733828,  0.733763,
-	 0.733697,  0.733632,  0.733567,  0.733502,  0.733437,  0.733372,  0.733306,  0.733241,
-	 0.733176,  0.733111,  0.733046,  0.732980,  0.732915,  0.732850,  0.732785,  0.732720,
-	 0.732654,  0.732589,  0.732524,  0.732458,  0.732393,  0.732328,  0.732263,  0.732197,
-	 0.732132,  0.732067,  0.732001,  0.731936,  0.731871,  0.731805,  0.731740,  0.731675,
-	 0.731609,  0.731544,  0.731479,  0.731413,  0.731348,  0.731282,  0.731217,  0.731152,
-	 0.731086,  0.731021,  0.730955,  0.730890,  0.730825,  0.730759,  0.730694,  0.730628,
-	 0.730563,  0.730497,  0.730432,  0.730366,  0.730301,  0.730235,  0.730170,  0.730104,
-	 0.730039,  0.729973,  0.729908,  0.729842,  0.729777,  0.729711,  0.729646,  0.729580,
-	 0.729514,  0.729449,  0.729383,  0.729318,  0.729252,  0.729186,  0.729121,  0.729055,
-	 0.728990,  0.728924,  0.728858,  0.728793,  0.728727,  0.728661,  0.728596,  0.728530,
-	 0.728464,  0.728399,  0.728333,  0.728267,  0.728202,  0.728136,  0.728070,  0.728004,
-	 0.727939,  0.727873,  0.727807,  0.727741,  0.727676,  0.727610,  0.727544,  0.727478,
-	 0.727413,  0.727347,  0.727281,  0.727215,  0.727149,  0.727084,  0.727018,  0.726952,
-	 0.726886,  0.726820,  0.726754,  0.726689,  0.726623,  0.726557,  0.726491,  0.726425,
-	 0.726359,  0.726293,  0.726227,  0.726161,  0.726095,  0.726030,  0.725964,  0.725898,
-	 0.725832,  0.725766,  0.725700,  0.725634,  0.725568,  0.725502,  0.725436,  0.725370,
-	 0.725304,  0.725238,  0.725172,  0.725106,  0.725040,  0.724974,  0.724908,  0.724842,
-	 0.724776,  0.724710,  0.724644,  0.724578,  0.724511,  0.724445,  0.724379,  0.724313,
-	 0.724247,  0.724181,  0.724115,  0.724049,  0.723983,  0.723916,  0.723850,  0.723784,
-	 0.723718,  0.723652,  0.723586,  0.723520,  0.723453,  0.723387,  0.723321,  0.723255,
-	 0.723188,  0.723122,  0.723056,  0.722990,  0.722924,  0.722857,  0.722791,  0.722725,
-	 0.722659,  0.722592,  0.722526,  0.722460,  0.722393,  0.722327,  0.722261,  0.722194,
-	 0.722128,  0.722062,  0.721996,  0.721929,  0.721863,  0.721797,  0.721730,  0.721664,
-	 0.721597,  0.721531,  0.721465,  0.721398,  0.721332,  0.721265,  0.721199,  0.721133,
-	 0.721066,  0.721000,  0.720933,  0.720867,  0.720800,  0.720734,  0.720668,  0.720601,
-	 0.720535,  0.720468,  0.720402,  0.720335,  0.720269,  0.720202,  0.720136,  0.720069,
-	 0.720003,  0.719936,  0.719869,  0.719803,  0.719736,  0.719670,  0.719603,  0.719537,
-	 0.719470,  0.719403,  0.719337,  0.719270,  0.719204,  0.719137,  0.719070,  0.719004,
-	 0.718937,  0.718870,  0.718804,  0.718737,  0.718670,  0.718604,  0.718537,  0.718471,
-	 0.718404,  0.718337,  0.718270,  0.718204,  0.718137,  0.718070,  0.718004,  0.717937,
-	 0.717870,  0.717803,  0.717737,  0.717670,  0.717603,  0.717536,  0.717469,  0.717403,
-	 0.717336,  0.717269,  0.717202,  0.717135,  0.717069,  0.717002,  0.716935,  0.716868,
-	 0.716801,  0.716734,  0.716668,  0.716601,  0.716534,  0.716467,  0.716400,  0.716333,
-	 0.716266,  0.716199,  0.716132,  0.716066,  0.715999,  0.715932,  0.715865,  0.715798,
-	 0.715731,  0.715664,  0.715597,  0.715530,  0.715463,  0.715396,  0.715329,  0.715262,
-	 0.715195,  0.715128,  0.715061,  0.714994,  0.714927,  0.714860,  0.714793,  0.714726,
-	 0.714659,  0.714592,  0.714525,  0.714457,  0.714390,  0.714323,  0.714256,  0.714189,
-	 0.714122,  0.714055,  0.713988,  0.713921,  0.713853,  0.713786,  0.713719,  0.713652,
-	 0.713585,  0.713518,  0.713451,  0.713383,  0.713316,  0.713249,  0.713182,  0.713115,
-	 0.713047,  0.712980,  0.712913,  0.712846,  0.712778,  0.712711,  0.712644,  0.712577,
-	 0.712509,  0.712442,  0.712375,  0.712308,  0.712240,  0.712173,  0.712106,  0.712038,
-	 0.711971,  0.711904,  0.711836,  0.711769,  0.711702,  0.711634,  0.711567,  0.711500,
-	 0.711432,  0.711365,  0.711297,  0.711230,  0.711163,  0.711095,  0.711028,  0.710960,
-	 0.710893,  0.710826,  0.710758,  0.710691,  0.710623,  0.710556,  0.710488,  0.710421,
-	 0.710353,  0.710286,  0.710218,  0.710151,  0.710083,  0.710016,  0.709948,  0.709881,
-	 0.709813,  0.709746,  0.709678,  0.709611,  0.709543,  0.709476,  0.709408,  0.709340,
-	 0.709273,  0.709205,  0.709138,  0.709070,  0.709002,  0.708935,  0.708867,  0.708800,
-	 0.708732,  0.708664,  0.708597,  0.708529,  0.708461,  0.708394,  0.708326,  0.708258,
-	 0.708191,  0.708123,  0.708055,  0.707988,  0.707920,  0.707852,  0.707784,  0.707717,
-	 0.707649,  0.707581,  0.707513,  0.707446,  0.707378,  0.707310,  0.707242,  0.707175,
-	 0.707107,  0.707039,  0.706971,  0.706903,  0.706836,  0.706768,  0.706700,  0.706632,
-	 0.706564,  0.706496,  0.706429,  0.706361,  0.706293,  0.706225,  0.706157,  0.706089,
-	 0.706021,  0.705953,  0.705885,  0.705818,  0.705750,  0.705682,  0.705614,  0.705546,
-	 0.705478,  0.705410,  0.705342,  0.705274,  0.705206,  0.705138,  0.705070,  0.705002,
-	 0.704934,  0.704866,  0.704798,  0.704730,  0.704662,  0.704594,  0.704526,  0.704458,
-	 0.704390,  0.704322,  0.704254,  0.704186,  0.704118,  0.704050,  0.703981,  0.703913,
-	 0.703845,  0.703777,  0.703709,  0.703641,  0.703573,  0.703505,  0.703436,  0.703368,
-	 0.703300,  0.703232,  0.703164,  0.703096,  0.703028,  0.702959,  0.702891,  0.702823,
-	 0.702755,  0.702687,  0.702618,  0.702550,  0.702482,  0.702414,  0.702345,  0.702277,
-	 0.702209,  0.702141,  0.702072,  0.702004,  0.701936,  0.701868,  0.701799,  0.701731,
-	 0.701663,  0.701594,  0.701526,  0.701458,  0.701389,  0.701321,  0.701253,  0.701184,
-	 0.701116,  0.701048,  0.700979,  0.700911,  0.700842,  0.700774,  0.700706,  0.700637,
-	 0.700569,  0.700500,  0.700432,  0.700364,  0.700295,  0.700227,  0.700158,  0.700090,
-	 0.700021,  0.699953,  0.699884,  0.699816,  0.699747,  0.699679,  0.699610,  0.699542,
-	 0.699473,  0.699405,  0.699336,  0.699268,  0.699199,  0.699131,  0.699062,  0.698994,
-	 0.698925,  0.698856,  0.698788,  0.698719,  0.698651,  0.698582,  0.698513,  0.698445,
-	 0.698376,  0.698308,  0.698239,  0.698170,  0.698102,  0.698033,  0.697964,  0.697896,
-	 0.697827,  0.697758,  0.697690,  0.697621,  0.697552,  0.697484,  0.697415,  0.697346,
-	 0.697277,  0.697209,  0.697140,  0.697071,  0.697003,  0.696934,  0.696865,  0.696796,
-	 0.696728,  0.696659,  0.696590,  0.696521,  0.696452,  0.696384,  0.696315,  0.696246,
-	 0.696177,  0.696108,  0.696039,  0.695971,  0.695902,  0.695833,  0.695764,  0.695695,
-	 0.695626,  0.695557,  0.695489,  0.695420,  0.695351,  0.695282,  0.695213,  0.695144,
-	 0.695075,  0.695006,  0.694937,  0.694868,  0.694799,  0.694730,  0.694661,  0.694592,
-	 0.694524,  0.694454,  0.694386,  0.694317,  0.694248,  0.694179,  0.694109,  0.694040,
-	 0.693971,  0.693902,  0.693833,  0.693764,  0.693695,  0.693626,  0.693557,  0.693488,
-	 0.693419,  0.693350,  0.693281,  0.693212,  0.693143,  0.693074,  0.693004,  0.692935,
-	 0.692866,  0.692797,  0.692728,  0.692659,  0.692590,  0.692520,  0.692451,  0.692382,
-	 0.692313,  0.692244,  0.692175,  0.692105,  0.692036,  0.691967,  0.691898,  0.691828,
-	 0.691759,  0.691690,  0.691621,  0.691552,  0.691482,  0.691413,  0.691344,  0.691274,
-	 0.691205,  0.691136,  0.691067,  0.690997,  0.690928,  0.690859,  0.690789,  0.690720,
-	 0.690651,  0.690581,  0.690512,  0.690443,  0.690373,  0.690304,  0.690235,  0.690165,
-	 0.690096,  0.690026,  0.689957,  0.689888,  0.689818,  0.689749,  0.689679,  0.689610,
-	 0.689541,  0.689471,  0.689402,  0.689332,  0.689263,  0.689193,  0.689124,  0.689054,
-	 0.688985,  0.688915,  0.688846,  0.688776,  0.688707,  0.688637,  0.688568,  0.688498,
-	 0.688429,  0.688359,  0.688290,  0.688220,  0.688151,  0.688081,  0.688011,  0.687942,
-	 0.687872,  0.687803,  0.687733,  0.687663,  0.687594,  0.687524,  0.687455,  0.687385,
-	 0.687315,  0.687246,  0.687176,  0.687106,  0.687037,  0.686967,  0.686897,  0.686828,
-	 0.686758,  0.686688,  0.686619,  0.686549,  0.686479,  0.686409,  0.686340,  0.686270,
-	 0.686200,  0.686131,  0.686061,  0.685991,  0.685921,  0.685852,  0.685782,  0.685712,
-	 0.685642,  0.685572,  0.685503,  0.685433,  0.685363,  0.685293,  0.685223,  0.685153,
-	 0.685084,  0.685014,  0.684944,  0.684874,  0.684804,  0.684734,  0.684664,  0.684595,
-	 0.684525,  0.684455,  0.684385,  0.684315,  0.684245,  0.684175,  0.684105,  0.684035,
-	 0.683965,  0.683895,  0.683825,  0.683756,  0.683686,  0.683616,  0.683546,  0.683476,
-	 0.683406,  0.683336,  0.683266,  0.683196,  0.683126,  0.683056,  0.682986,  0.682916,
-	 0.682846,  0.682775,  0.682705,  0.682635,  0.682565,  0.682495,  0.682425,  0.682355,
-	 0.682285,  0.682215,  0.682145,  0.682075,  0.682005,  0.681934,  0.681864,  0.681794,
-	 0.681724,  0.681654,  0.681584,  0.681514,  0.681443,  0.681373,  0.681303,  0.681233,
-	 0.681163,  0.681093,  0.681022,  0.680952,  0.680882,  0.680812,  0.680741,  0.680671,
-	 0.680601,  0.680531,  0.680461,  0.680390,  0.680320,  0.680250,  0.680179,  0.680109,
-	 0.680039,  0.679969,  0.679898,  0.679828,  0.679758,  0.679687,  0.679617,  0.679547,
-	 0.679476,  0.679406,  0.679336,  0.679265,  0.679195,  0.679125,  0.679054,  0.678984,
-	 0.678913,  0.678843,  0.678773,  0.678702,  0.678632,  0.678561,  0.678491,  0.678420,
-	 0.678350,  0.678280,  0.678209,  0.678139,  0.678068,  0.677998,  0.677927,  0.677857,
-	 0.677786,  0.677716,  0.677645,  0.677575,  0.677504,  0.677434,  0.677363,  0.677293,
-	 0.677222,  0.677152,  0.677081,  0.677011,  0.676940,  0.676869,  0.676799,  0.676728,
-	 0.676658,  0.676587,  0.676516,  0.676446,  0.676375,  0.676305,  0.676234,  0.676163,
-	 0.676093,  0.676022,  0.675951,  0.675881,  0.675810,  0.675739,  0.675669,  0.675598,
-	 0.675527,  0.675457,  0.675386,  0.675315,  0.675245,  0.675174,  0.675103,  0.675032,
-	 0.674962,  0.674891,  0.674820,  0.674749,  0.674679,  0.674608,  0.674537,  0.674466,
-	 0.674396,  0.674325,  0.674254,  0.674183,  0.674112,  0.674042,  0.673971,  0.673900,
-	 0.673829,  0.673758,  0.673687,  0.673616,  0.673546,  0.673475,  0.673404,  0.673333,
-	 0.673262,  0.673191,  0.673120,  0.673049,  0.672978,  0.672908,  0.672837,  0.672766,
-	 0.672695,  0.672624,  0.672553,  0.672482,  0.672411,  0.672340,  0.672269,  0.672198,
-	 0.672127,  0.672056,  0.671985,  0.671914,  0.671843,  0.671772,  0.671701,  0.671630,
-	 0.671559,  0.671488,  0.671417,  0.671346,  0.671275,  0.671204,  0.671133,  0.671062,
-	 0.670990,  0.670919,  0.670848,  0.670777,  0.670706,  0.670635,  0.670564,  0.670493,
-	 0.670422,  0.670350,  0.670279,  0.670208,  0.670137,  0.670066,  0.669995,  0.669923,
-	 0.669852,  0.669781,  0.669710,  0.669639,  0.669567,  0.669496,  0.669425,  0.669354,
-	 0.669283,  0.669211,  0.669140,  0.669069,  0.668998,  0.668926,  0.668855,  0.668784,
-	 0.668712,  0.668641,  0.668570,  0.668499,  0.668427,  0.668356,  0.668285,  0.668213,
-	 0.668142,  0.668071,  0.667999,  0.667928,  0.667857,  0.667785,  0.667714,  0.667643,
-	 0.667571,  0.667500,  0.667428,  0.667357,  0.667286,  0.667214,  0.667143,  0.667071,
-	 0.667000,  0.666928,  0.666857,  0.666786,  0.666714,  0.666643,  0.666571,  0.666500,
-	 0.666428,  0.666357,  0.666285,  0.666214,  0.666142,  0.666071,  0.665999,  0.665928,
-	 0.665856,  0.665785,  0.665713,  0.665642,  0.665570,  0.665498,  0.665427,  0.665355,
-	 0.665284,  0.665212,  0.665141,  0.665069,  0.664997,  0.664926,  0.664854,  0.664783,
-	 0.664711,  0.664639,  0.664568,  0.664496,  0.664424,  0.664353,  0.664281,  0.664209,
-	 0.664138,  0.664066,  0.663994,  0.663923,  0.663851,  0.663779,  0.663708,  0.663636,
-	 0.663564,  0.663492,  0.663421,  0.663349,  0.663277,  0.663205,  0.663134,  0.663062,
-	 0.662990,  0.662918,  0.662847,  0.662775,  0.662703,  0.662631,  0.662559,  0.662488,
-	 0.662416,  0.662344,  0.662272,  0.662200,  0.662128,  0.662057,  0.661985,  0.661913,
-	 0.661841,  0.661769,  0.661697,  0.661625,  0.661553,  0.661482,  0.661410,  0.661338,
-	 0.661266,  0.661194,  0.661122,  0.661050,  0.660978,  0.660906,  0.660834,  0.660762,
-	 0.660690,  0.660618,  0.660546,  0.660474,  0.660402,  0.660330,  0.660258,  0.660186,
-	 0.660114,  0.660042,  0.659970,  0.659898,  0.659826,  0.659754,  0.659682,  0.659610,
-	 0.659538,  0.659466,  0.659394,  0.659322,  0.659250,  0.659178,  0.659105,  0.659033,
-	 0.658961,  0.658889,  0.658817,  0.658745,  0.658673,  0.658601,  0.658529,  0.658456,
-	 0.658384,  0.658312,  0.658240,  0.658168,  0.658095,  0.658023,  0.657951,  0.657879,
-	 0.657807,  0.657734,  0.657662,  0.657590,  0.657518,  0.657446,  0.657373,  0.657301,
-	 0.657229,  0.657157,  0.657084,  0.657012,  0.656940,  0.656867,  0.656795,  0.656723,
-	 0.656651,  0.656578,  0.656506,  0.656434,  0.656361,  0.656289,  0.656217,  0.656144,
-	 0.656072,  0.656000,  0.655927,  0.655855,  0.655782,  0.655710,  0.655638,  0.655565,
-	 0.655493,  0.655420,  0.655348,  0.655276,  0.655203,  0.655131,  0.655058,  0.654986,
-	 0.654913,  0.654841,  0.654769,  0.654696,  0.654624,  0.654551,  0.654479,  0.654406,
-	 0.654334,  0.654261,  0.654189,  0.654116,  0.654044,  0.653971,  0.653899,  0.653826,
-	 0.653753,  0.653681,  0.653608,  0.653536,  0.653463,  0.653391,  0.653318,  0.653245,
-	 0.653173,  0.653100,  0.653028,  0.652955,  0.652882,  0.652810,  0.652737,  0.652665,
-	 0.652592,  0.652519,  0.652447,  0.652374,  0.652301,  0.652229,  0.652156,  0.652083,
-	 0.652011,  0.651938,  0.651865,  0.651792,  0.651720,  0.651647,  0.651574,  0.651502,
-	 0.651429,  0.651356,  0.651283,  0.651211,  0.651138,  0.651065,  0.650992,  0.650919,
-	 0.650847,  0.650774,  0.650701,  0.650628,  0.650555,  0.650483,  0.650410,  0.650337,
-	 0.650264,  0.650191,  0.650119,  0.650046,  0.649973,  0.649900,  0.649827,  0.649754,
-	 0.649681,  0.649608,  0.649536,  0.649463,  0.649390,  0.649317,  0.649244,  0.649171,
-	 0.649098,  0.649025,  0.648952,  0.648879,  0.648806,  0.648733,  0.648660,  0.648587,
-	 0.648514,  0.648441,  0.648368,  0.648295,  0.648222,  0.648149,  0.648076,  0.648003,
-	 0.647930,  0.647857,  0.647784,  0.647711,  0.647638,  0.647565,  0.647492,  0.647419,
-	 0.647346,  0.647273,  0.647200,  0.647127,  0.647054,  0.646981,  0.646907,  0.646834,
-	 0.646761,  0.646688,  0.646615,  0.646542,  0.646469,  0.646396,  0.646322,  0.646249,
-	 0.646176,  0.646103,  0.646030,  0.645956,  0.645883,  0.645810,  0.645737,  0.645664,
-	 0.645590,  0.645517,  0.645444,  0.645371,  0.645298,  0.645224,  0.645151,  0.645078,
-	 0.645005,  0.644931,  0.644858,  0.644785,  0.644711,  0.644638,  0.644565,  0.644492,
-	 0.644418,  0.644345,  0.644272,  0.644198,  0.644125,  0.644052,  0.643978,  0.643905,
-	 0.643832,  0.643758,  0.643685,  0.643611,  0.643538,  0.643465,  0.643391,  0.643318,
-	 0.643245,  0.643171,  0.643098,  0.643024,  0.642951,  0.642877,  0.642804,  0.642730,
-	 0.642657,  0.642584,  0.642510,  0.642437,  0.642363,  0.642290,  0.642216,  0.642143,
-	 0.642069,  0.641996,  0.641922,  0.641849,  0.641775,  0.641702,  0.641628,  0.641555,
-	 0.641481,  0.641407,  0.641334,  0.641260,  0.641187,  0.641113,  0.641040,  0.640966,
-	 0.640892,  0.640819,  0.640745,  0.640672,  0.640598,  0.640524,  0.640451,  0.640377,
-	 0.640303,  0.640230,  0.640156,  0.640083,  0.640009,  0.639935,  0.639862,  0.639788,
-	 0.639714,  0.639640,  0.639567,  0.639493,  0.639419,  0.639346,  0.639272,  0.639198,
-	 0.639124,  0.639051,  0.638977,  0.638903,  0.638829,  0.638756,  0.638682,  0.638608,
-	 0.638534,  0.638461,  0.638387,  0.638313,  0.638239,  0.638165,  0.638092,  0.638018,
-	 0.637944,  0.637870,  0.637796,  0.637722,  0.637649,  0.637575,  0.637501,  0.637427,
-	 0.637353,  0.637279,  0.637205,  0.637131,  0.637057,  0.636984,  0.636910,  0.636836,
-	 0.636762,  0.636688,  0.636614,  0.636540,  0.636466,  0.636392,  0.636318,  0.636244,
-	 0.636170,  0.636096,  0.636022,  0.635948,  0.635874,  0.635800,  0.635726,  0.635652,
-	 0.635578,  0.635504,  0.635430,  0.635356,  0.635282,  0.635208,  0.635134,  0.635060,
-	 0.634986,  0.634912,  0.634838,  0.634764,  0.634690,  0.634616,  0.634542,  0.634467,
-	 0.634393,  0.634319,  0.634245,  0.634171,  0.634097,  0.634023,  0.633949,  0.633874,
-	 0.633800,  0.633726,  0.633652,  0.633578,  0.633504,  0.633429,  0.633355,  0.633281,
-	 0.633207,  0.633133,  0.633058,  0.632984,  0.632910,  0.632836,  0.632761,  0.632687,
-	 0.632613,  0.632539,  0.632464,  0.632390,  0.632316,  0.632242,  0.632167,  0.632093,
-	 0.632019,  0.631944,  0.631870,  0.631796,  0.631721,  0.631647,  0.631573,  0.631499,
-	 0.631424,  0.631350,  0.631275,  0.631201,  0.631127,  0.631052,  0.630978,  0.630904,
-	 0.630829,  0.630755,  0.630680,  0.630606,  0.630532,  0.630457,  0.630383,  0.630308,
-	 0.630234,  0.630159,  0.630085,  0.630011,  0.629936,  0.629862,  0.629787,  0.629713,
-	 0.629638,  0.629564,  0.629489,  0.629415,  0.629340,  0.629266,  0.629191,  0.629117,
-	 0.629042,  0.628968,  0.628893,  0.628819,  0.628744,  0.628669,  0.628595,  0.628520,
-	 0.628446,  0.628371,  0.628297,  0.628222,  0.628147,  0.628073,  0.627998,  0.627924,
-	 0.627849,  0.627774,  0.627700,  0.627625,  0.627550,  0.627476,  0.627401,  0.627326,
-	 0.627252,  0.627177,  0.627102,  0.627028,  0.626953,  0.626878,  0.626804,  0.626729,
-	 0.626654,  0.626580,  0.626505,  0.626430,  0.626355,  0.626281,  0.626206,  0.626131,
-	 0.626056,  0.625982,  0.625907,  0.625832,  0.625757,  0.625683,  0.625608,  0.625533,
-	 0.625458,  0.625383,  0.625309,  0.625234,  0.625159,  0.625084,  0.625009,  0.624934,
-	 0.624860,  0.624785,  0.624710,  0.624635,  0.624560,  0.624485,  0.624410,  0.624335,
-	 0.624260,  0.624186,  0.624111,  0.624036,  0.623961,  0.623886,  0.623811,  0.623736,
-	 0.623661,  0.623586,  0.623511,  0.623436,  0.623361,  0.623286,  0.623211,  0.623136,
-	 0.623061,  0.622986,  0.622911,  0.622836,  0.622761,  0.622686,  0.622611,  0.622536,
-	 0.622461,  0.622386,  0.622311,  0.622236,  0.622161,  0.622086,  0.622011,  0.621936,
-	 0.621861,  0.621786,  0.621711,  0.621636,  0.621560,  0.621485,  0.621410,  0.621335,
-	 0.621260,  0.621185,  0.621110,  0.621035,  0.620959,  0.620884,  0.620809,  0.620734,
-	 0.620659,  0.620584,  0.620508,  0.620433,  0.620358,  0.620283,  0.620208,  0.620132,
-	 0.620057,  0.619982,  0.619907,  0.619832,  0.619756,  0.619681,  0.619606,  0.619531,
-	 0.619455,  0.619380,  0.619305,  0.619229,  0.619154,  0.619079,  0.619004,  0.618928,
-	 0.618853,  0.618778,  0.618702,  0.618627,  0.618552,  0.618476,  0.618401,  0.618326,
-	 0.618250,  0.618175,  0.618100,  0.618024,  0.617949,  0.617873,  0.617798,  0.617723,
-	 0.617647,  0.617572,  0.617496,  0.617421,  0.617346,  0.617270,  0.617195,  0.617119,
-	 0.617044,  0.616968,  0.616893,  0.616818,  0.616742,  0.616667,  0.616591,  0.616516,
-	 0.616440,  0.616365,  0.616289,  0.616214,  0.616138,  0.616063,  0.615987,  0.615912,
-	 0.615836,  0.615761,  0.615685,  0.615609,  0.615534,  0.615458,  0.615383,  0.615307,
-	 0.615232,  0.615156,  0.615080,  0.615005,  0.614929,  0.614854,  0.614778,  0.614702,
-	 0.614627,  0.614551,  0.614475,  0.614400,  0.614324,  0.614249,  0.614173,  0.614097,
-	 0.614022,  0.613946,  0.613870,  0.613795,  0.613719,  0.613643,  0.613567,  0.613492,
-	 0.613416,  0.613340,  0.613265,  0.613189,  0.613113,  0.613037,  0.612962,  0.612886,
-	 0.612810,  0.612734,  0.612659,  0.612583,  0.612507,  0.612431,  0.612355,  0.612280,
-	 0.612204,  0.612128,  0.612052,  0.611976,  0.611901,  0.611825,  0.611749,  0.611673,
-	 0.611597,  0.611521,  0.611445,  0.611370,  0.611294,  0.611218,  0.611142,  0.611066,
-	 0.610990,  0.610914,  0.610838,  0.610762,  0.610687,  0.610611,  0.610535,  0.610459,
-	 0.610383,  0.610307,  0.610231,  0.610155,  0.610079,  0.610003,  0.609927,  0.609851,
-	 0.609775,  0.609699,  0.609623,  0.609547,  0.609471,  0.609395,  0.609319,  0.609243,
-	 0.609167,  0.609091,  0.609015,  0.608939,  0.608863,  0.608787,  0.608711,  0.608635,
-	 0.608559,  0.608482,  0.608406,  0.608330,  0.608254,  0.608178,  0.608102,  0.608026,
-	 0.607950,  0.607874,  0.607798,  0.607721,  0.607645,  0.607569,  0.607493,  0.607417,
-	 0.607341,  0.607264,  0.607188,  0.607112,  0.607036,  0.606960,  0.606884,  0.606807,
-	 0.606731,  0.606655,  0.606579,  0.606502,  0.606426,  0.606350,  0.606274,  0.606198,
-	 0.606121,  0.606045,  0.605969,  0.605892,  0.605816,  0.605740,  0.605664,  0.605587,
-	 0.605511,  0.605435,  0.605358,  0.605282,  0.605206,  0.605129,  0.605053,  0.604977,
-	 0.604900,  0.604824,  0.604748,  0.604671,  0.604595,  0.604519,  0.604442,  0.604366,
-	 0.604290,  0.604213,  0.604137,  0.604060,  0.603984,  0.603908,  0.603831,  0.603755,
-	 0.603678,  0.603602,  0.603525,  0.603449,  0.603372,  0.603296,  0.603220,  0.603143,
-	 0.603067,  0.602990,  0.602914,  0.602837,  0.602761,  0.602684,  0.602608,  0.602531,
-	 0.602455,  0.602378,  0.602302,  0.602225,  0.602148,  0.602072,  0.601995,  0.601919,
-	 0.601842,  0.601766,  0.601689,  0.601613,  0.601536,  0.601459,  0.601383,  0.601306,
-	 0.601230,  0.601153,  0.601076,  0.601000,  0.600923,  0.600846,  0.600770,  0.600693,
-	 0.600616,  0.600540,  0.600463,  0.600387,  0.600310,  0.600233,  0.600156,  0.600080,
-	 0.600003,  0.599926,  0.599850,  0.599773,  0.599696,  0.599620,  0.599543,  0.599466,
-	 0.599389,  0.599313,  0.599236,  0.599159,  0.599082,  0.599006,  0.598929,  0.598852,
-	 0.598775,  0.598698,  0.598622,  0.598545,  0.598468,  0.598391,  0.598314,  0.598238,
-	 0.598161,  0.598084,  0.598007,  0.597930,  0.597853,  0.597776,  0.597700,  0.597623,
-	 0.597546,  0.597469,  0.597392,  0.597315,  0.597238,  0.597161,  0.597085,  0.597008,
-	 0.596931,  0.596854,  0.596777,  0.596700,  0.596623,  0.596546,  0.596469,  0.596392,
-	 0.596315,  0.596238,  0.596161,  0.596084,  0.596007,  0.595930,  0.595853,  0.595776,
-	 0.595699,  0.595622,  0.595545,  0.595468,  0.595391,  0.595314,  0.595237,  0.595160,
-	 0.595083,  0.595006,  0.594929,  0.594852,  0.594775,  0.594698,  0.594621,  0.594544,
-	 0.594467,  0.594389,  0.594312,  0.594235,  0.594158,  0.594081,  0.594004,  0.593927,
-	 0.593850,  0.593772,  0.593695,  0.593618,  0.593541,  0.593464,  0.593387,  0.593309,
-	 0.593232,  0.593155,  0.593078,  0.593001,  0.592924,  0.592846,  0.592769,  0.592692,
-	 0.592615,  0.592537,  0.592460,  0.592383,  0.592306,  0.592228,  0.592151,  0.592074,
-	 0.591997,  0.591919,  0.591842,  0.591765,  0.591688,  0.591610,  0.591533,  0.591456,
-	 0.591378,  0.591301,  0.591224,  0.591146,  0.591069,  0.590992,  0.590914,  0.590837,
-	 0.590760,  0.590682,  0.590605,  0.590528,  0.590450,  0.590373,  0.590295,  0.590218,
-	 0.590141,  0.590063,  0.589986,  0.589908,  0.589831,  0.589754,  0.589676,  0.589599,
-	 0.589521,  0.589444,  0.589366,  0.589289,  0.589212,  0.589134,  0.589057,  0.588979,
-	 0.588902,  0.588824,  0.588747,  0.588669,  0.588592,  0.588514,  0.588437,  0.588359,
-	 0.588282,  0.588204,  0.588126,  0.588049,  0.587971,  0.587894,  0.587816,  0.587739,
-	 0.587661,  0.587584,  0.587506,  0.587428,  0.587351,  0.587273,  0.587196,  0.587118,
-	 0.587040,  0.586963,  0.586885,  0.586808,  0.586730,  0.586652,  0.586575,  0.586497,
-	 0.586419,  0.586342,  0.586264,  0.586186,  0.586109,  0.586031,  0.585953,  0.585876,
-	 0.585798,  0.585720,  0.585642,  0.585565,  0.585487,  0.585409,  0.585332,  0.585254,
-	 0.585176,  0.585098,  0.585021,  0.584943,  0.584865,  0.584787,  0.584710,  0.584632,
-	 0.584554,  0.584476,  0.584398,  0.584321,  0.584243,  0.584165,  0.584087,  0.584009,
-	 0.583931,  0.583854,  0.583776,  0.583698,  0.583620,  0.583542,  0.583464,  0.583387,
-	 0.583309,  0.583231,  0.583153,  0.583075,  0.582997,  0.582919,  0.582841,  0.582763,
-	 0.582685,  0.582608,  0.582530,  0.582452,  0.582374,  0.582296,  0.582218,  0.582140,
-	 0.582062,  0.581984,  0.581906,  0.581828,  0.581750,  0.581672,  0.581594,  0.581516,
-	 0.581438,  0.581360,  0.581282,  0.581204,  0.581126,  0.581048,  0.580970,  0.580892,
-	 0.580814,  0.580736,  0.580658,  0.580580,  0.580502,  0.580424,  0.580346,  0.580267,
-	 0.580189,  0.580111,  0.580033,  0.579955,  0.579877,  0.579799,  0.579721,  0.579643,
-	 0.579565,  0.579486,  0.579408,  0.579330,  0.579252,  0.579174,  0.579096,  0.579018,
-	 0.578939,  0.578861,  0.578783,  0.578705,  0.578627,  0.578548,  0.578470,  0.578392,
-	 0.578314,  0.578236,  0.578157,  0.578079,  0.578001,  0.577923,  0.577844,  0.577766,
-	 0.577688,  0.577610,  0.577531,  0.577453,  0.577375,  0.577297,  0.577218,  0.577140,
-	 0.577062,  0.576983,  0.576905,  0.576827,  0.576748,  0.576670,  0.576592,  0.576513,
-	 0.576435,  0.576357,  0.576278,  0.576200,  0.576122,  0.576043,  0.575965,  0.575887,
-	 0.575808,  0.575730,  0.575651,  0.575573,  0.575495,  0.575416,  0.575338,  0.575259,
-	 0.575181,  0.575103,  0.575024,  0.574946,  0.574867,  0.574789,  0.574710,  0.574632,
-	 0.574553,  0.574475,  0.574396,  0.574318,  0.574239,  0.574161,  0.574082,  0.574004,
-	 0.573925,  0.573847,  0.573768,  0.573690,  0.573611,  0.573533,  0.573454,  0.573376,
-	 0.573297,  0.573219,  0.573140,  0.573061,  0.572983,  0.572904,  0.572826,  0.572747,
-	 0.572669,  0.572590,  0.572511,  0.572433,  0.572354,  0.572276,  0.572197,  0.572118,
-	 0.572040,  0.571961,  0.571882,  0.571804,  0.571725,  0.571646,  0.571568,  0.571489,
-	 0.571410,  0.571332,  0.571253,  0.571174,  0.571096,  0.571017,  0.570938,  0.570859,
-	 0.570781,  0.570702,  0.570623,  0.570545,  0.570466,  0.570387,  0.570308,  0.570230,
-	 0.570151,  0.570072,  0.569993,  0.569914,  0.569836,  0.569757,  0.569678,  0.569599,
-	 0.569521,  0.569442,  0.569363,  0.569284,  0.569205,  0.569126,  0.569048,  0.568969,
-	 0.568890,  0.568811,  0.568732,  0.568653,  0.568574,  0.568496,  0.568417,  0.568338,
-	 0.568259,  0.568180,  0.568101,  0.568022,  0.567943,  0.567864,  0.567786,  0.567707,
-	 0.567628,  0.567549,  0.567470,  0.567391,  0.567312,  0.567233,  0.567154,  0.567075,
-	 0.566996,  0.566917,  0.566838,  0.566759,  0.566680,  0.566601,  0.566522,  0.566443,
-	 0.566364,  0.566285,  0.566206,  0.566127,  0.566048,  0.565969,  0.565890,  0.565811,
-	 0.565732,  0.565653,  0.565574,  0.565495,  0.565416,  0.565336,  0.565257,  0.565178,
-	 0.565099,  0.565020,  0.564941,  0.564862,  0.564783,  0.564704,  0.564624,  0.564545,
-	 0.564466,  0.564387,  0.564308,  0.564229,  0.564150,  0.564070,  0.563991,  0.563912,
-	 0.563833,  0.563754,  0.563675,  0.563595,  0.563516,  0.563437,  0.563358,  0.563279,
-	 0.563199,  0.563120,  0.563041,  0.562962,  0.562882,  0.562803,  0.562724,  0.562645,
-	 0.562565,  0.562486,  0.562407,  0.562328,  0.562248,  0.562169,  0.562090,  0.562010,
-	 0.561931,  0.561852,  0.561773,  0.561693,  0.561614,  0.561535,  0.561455,  0.561376,
-	 0.561297,  0.561217,  0.561138,  0.561058,  0.560979,  0.560900,  0.560820,  0.560741,
-	 0.560662,  0.560582,  0.560503,  0.560423,  0.560344,  0.560265,  0.560185,  0.560106,
-	 0.560026,  0.559947,  0.559867,  0.559788,  0.559709,  0.559629,  0.559550,  0.559470,
-	 0.559391,  0.559311,  0.559232,  0.559152,  0.559073,  0.558993,  0.558914,  0.558834,
-	 0.558755,  0.558675,  0.558596,  0.558516,  0.558437,  0.558357,  0.558278,  0.558198,
-	 0.558119,  0.558039,  0.557959,  0.557880,  0.557800,  0.557721,  0.557641,  0.557562,
-	 0.557482,  0.557402,  0.557323,  0.557243,  0.557164,  0.557084,  0.557004,  0.556925,
-	 0.556845,  0.556765,  0.556686,  0.556606,  0.556526,  0.556447,  0.556367,  0.556287,
-	 0.556208,  0.556128,  0.556048,  0.555969,  0.555889,  0.555809,  0.555730,  0.555650,
-	 0.555570,  0.555490,  0.555411,  0.555331,  0.555251,  0.555172,  0.555092,  0.555012,
-	 0.554932,  0.554853,  0.554773,  0.554693,  0.554613,  0.554533,  0.554454,  0.554374,
-	 0.554294,  0.554214,  0.554134,  0.554055,  0.553975,  0.553895,  0.553815,  0.553735,
-	 0.553656,  0.553576,  0.553496,  0.553416,  0.553336,  0.553256,  0.553176,  0.553097,
-	 0.553017,  0.552937,  0.552857,  0.552777,  0.552697,  0.552617,  0.552537,  0.552457,
-	 0.552378,  0.552298,  0.552218,  0.552138,  0.552058,  0.551978,  0.551898,  0.551818,
-	 0.551738,  0.551658,  0.551578,  0.551498,  0.551418,  0.551338,  0.551258,  0.551178,
-	 0.551098,  0.551018,  0.550938,  0.550858,  0.550778,  0.550698,  0.550618,  0.550538,
-	 0.550458,  0.550378,  0.550298,  0.550218,  0.550138,  0.550058,  0.549978,  0.549898,
-	 0.549818,  0.549737,  0.549657,  0.549577,  0.549497,  0.549417,  0.549337,  0.549257,
-	 0.549177,  0.549097,  0.549016,  0.548936,  0.548856,  0.548776,  0.548696,  0.548616,
-	 0.548536,  0.548455,  0.548375,  0.548295,  0.548215,  0.548135,  0.548054,  0.547974,
-	 0.547894,  0.547814,  0.547734,  0.547653,  0.547573,  0.547493,  0.547413,  0.547333,
-	 0.547252,  0.547172,  0.547092,  0.547011,  0.546931,  0.546851,  0.546771,  0.546690,
-	 0.546610,  0.546530,  0.546450,  0.546369,  0.546289,  0.546209,  0.546128,  0.546048,
-	 0.545968,  0.545887,  0.545807,  0.545727,  0.545646,  0.545566,  0.545486,  0.545405,
-	 0.545325,  0.545245,  0.545164,  0.545084,  0.545003,  0.544923,  0.544843,  0.544762,
-	 0.544682,  0.544602,  0.544521,  0.544441,  0.544360,  0.544280,  0.544199,  0.544119,
-	 0.544039,  0.543958,  0.543878,  0.543797,  0.543717,  0.543636,  0.543556,  0.543475,
-	 0.543395,  0.543314,  0.543234,  0.543153,  0.543073,  0.542992,  0.542912,  0.542831,
-	 0.542751,  0.542670,  0.542590,  0.542509,  0.542429,  0.542348,  0.542268,  0.542187,
-	 0.542106,  0.542026,  0.541945,  0.541865,  0.541784,  0.541704,  0.541623,  0.541542,
-	 0.541462,  0.541381,  0.541301,  0.541220,  0.541139,  0.541059,  0.540978,  0.540897,
-	 0.540817,  0.540736,  0.540655,  0.540575,  0.540494,  0.540413,  0.540333,  0.540252,
-	 0.540171,  0.540091,  0.540010,  0.539929,  0.539849,  0.539768,  0.539687,  0.539607,
-	 0.539526,  0.539445,  0.539364,  0.539284,  0.539203,  0.539122,  0.539041,  0.538961,
-	 0.538880,  0.538799,  0.538718,  0.538638,  0.538557,  0.538476,  0.538395,  0.538314,
-	 0.538234,  0.538153,  0.538072,  0.537991,  0.537910,  0.537830,  0.537749,  0.537668,
-	 0.537587,  0.537506,  0.537425,  0.537345,  0.537264,  0.537183,  0.537102,  0.537021,
-	 0.536940,  0.536859,  0.536778,  0.536698,  0.536617,  0.536536,  0.536455,  0.536374,
-	 0.536293,  0.536212,  0.536131,  0.536050,  0.535969,  0.535888,  0.535807,  0.535726,
-	 0.535645,  0.535564,  0.535484,  0.535403,  0.535322,  0.535241,  0.535160,  0.535079,
-	 0.534998,  0.534917,  0.534836,  0.534755,  0.534674,  0.534593,  0.534512,  0.534431,
-	 0.534349,  0.534268,  0.534187,  0.534106,  0.534025,  0.533944,  0.533863,  0.533782,
-	 0.533701,  0.533620,  0.533539,  0.533458,  0.533377,  0.533296,  0.533214,  0.533133,
-	 0.533052,  0.532971,  0.532890,  0.532809,  0.532728,  0.532647,  0.532565,  0.532484,
-	 0.532403,  0.532322,  0.532241,  0.532160,  0.532078,  0.531997,  0.531916,  0.531835,
-	 0.531754,  0.531673,  0.531591,  0.531510,  0.531429,  0.531348,  0.531266,  0.531185,
-	 0.531104,  0.531023,  0.530942,  0.530860,  0.530779,  0.530698,  0.530617,  0.530535,
-	 0.530454,  0.530373,  0.530291,  0.530210,  0.530129,  0.530048,  0.529966,  0.529885,
-	 0.529804,  0.529722,  0.529641,  0.529560,  0.529478,  0.529397,  0.529316,  0.529234,
-	 0.529153,  0.529072,  0.528990,  0.528909,  0.528828,  0.528746,  0.528665,  0.528583,
-	 0.528502,  0.528421,  0.528339,  0.528258,  0.528176,  0.528095,  0.528014,  0.527932,
-	 0.527851,  0.527769,  0.527688,  0.527606,  0.527525,  0.527444,  0.527362,  0.527281,
-	 0.527199,  0.527118,  0.527036,  0.526955,  0.526873,  0.526792,  0.526710,  0.526629,
-	 0.526547,  0.526466,  0.526384,  0.526303,  0.526221,  0.526140,  0.526058,  0.525977,
-	 0.525895,  0.525813,  0.525732,  0.525650,  0.525569,  0.525487,  0.525406,  0.525324,
-	 0.525243,  0.525161,  0.525079,  0.524998,  0.524916,  0.524835,  0.524753,  0.524671,
-	 0.524590,  0.524508,  0.524426,  0.524345,  0.524263,  0.524181,  0.524100,  0.524018,
-	 0.523937,  0.523855,  0.523773,  0.523692,  0.523610,  0.523528,  0.523447,  0.523365,
-	 0.523283,  0.523201,  0.523120,  0.523038,  0.522956,  0.522875,  0.522793,  0.522711,
-	 0.522629,  0.522548,  0.522466,  0.522384,  0.522302,  0.522221,  0.522139,  0.522057,
-	 0.521975,  0.521894,  0.521812,  0.521730,  0.521648,  0.521566,  0.521485,  0.521403,
-	 0.521321,  0.521239,  0.521157,  0.521075,  0.520994,  0.520912,  0.520830,  0.520748,
-	 0.520666,  0.520584,  0.520503,  0.520421,  0.520339,  0.520257,  0.520175,  0.520093,
-	 0.520011,  0.519929,  0.519848,  0.519766,  0.519684,  0.519602,  0.519520,  0.519438,
-	 0.519356,  0.519274,  0.519192,  0.519110,  0.519028,  0.518946,  0.518864,  0.518782,
-	 0.518700,  0.518618,  0.518536,  0.518454,  0.518372,  0.518291,  0.518209,  0.518126,
-	 0.518045,  0.517963,  0.517880,  0.517798,  0.517716,  0.517634,  0.517552,  0.517470,
-	 0.517388,  0.517306,  0.517224,  0.517142,  0.517060,  0.516978,  0.516896,  0.516814,
-	 0.516732,  0.516650,  0.516568,  0.516486,  0.516403,  0.516321,  0.516239,  0.516157,
-	 0.516075,  0.515993,  0.515911,  0.515829,  0.515746,  0.515664,  0.515582,  0.515500,
-	 0.515418,  0.515336,  0.515254,  0.515171,  0.515089,  0.515007,  0.514925,  0.514843,
-	 0.514760,  0.514678,  0.514596,  0.514514,  0.514432,  0.514349,  0.514267,  0.514185,
-	 0.514103,  0.514021,  0.513938,  0.513856,  0.513774,  0.513692,  0.513609,  0.513527,
-	 0.513445,  0.513362,  0.513280,  0.513198,  0.513116,  0.513033,  0.512951,  0.512869,
-	 0.512786,  0.512704,  0.512622,  0.512539,  0.512457,  0.512375,  0.512292,  0.512210,
-	 0.512128,  0.512045,  0.511963,  0.511881,  0.511798,  0.511716,  0.511634,  0.511551,
-	 0.511469,  0.511386,  0.511304,  0.511222,  0.511139,  0.511057,  0.510974,  0.510892,
-	 0.510810,  0.510727,  0.510645,  0.510562,  0.510480,  0.510397,  0.510315,  0.510233,
-	 0.510150,  0.510068,  0.509985,  0.509903,  0.509820,  0.509738,  0.509655,  0.509573,
-	 0.509490,  0.509408,  0.509325,  0.509243,  0.509160,  0.509078,  0.508995,  0.508913,
-	 0.508830,  0.508748,  0.508665,  0.508583,  0.508500,  0.508417,  0.508335,  0.508252,
-	 0.508170,  0.508087,  0.508005,  0.507922,  0.507839,  0.507757,  0.507674,  0.507592,
-	 0.507509,  0.507426,  0.507344,  0.507261,  0.507179,  0.507096,  0.507013,  0.506931,
-	 0.506848,  0.506765,  0.506683,  0.506600,  0.506517,  0.506435,  0.506352,  0.506269,
-	 0.506187,  0.506104,  0.506021,  0.505939,  0.505856,  0.505773,  0.505690,  0.505608,
-	 0.505525,  0.505442,  0.505360,  0.505277,  0.505194,  0.505111,  0.505029,  0.504946,
-	 0.504863,  0.504780,  0.504698,  0.504615,  0.504532,  0.504449,  0.504366,  0.504284,
-	 0.504201,  0.504118,  0.504035,  0.503953,  0.503870,  0.503787,  0.503704,  0.503621,
-	 0.503538,  0.503456,  0.503373,  0.503290,  0.503207,  0.503124,  0.503041,  0.502958,
-	 0.502876,  0.502793,  0.502710,  0.502627,  0.502544,  0.502461,  0.502378,  0.502295,
-	 0.502212,  0.502130,  0.502047,  0.501964,  0.501881,  0.501798,  0.501715,  0.501632,
-	 0.501549,  0.501466,  0.501383,  0.501300,  0.501217,  0.501134,  0.501051,  0.500968,
-	 0.500885,  0.500802,  0.500719,  0.500636,  0.500553,  0.500470,  0.500387,  0.500304,
-	 0.500221,  0.500138,  0.500055,  0.499972,  0.499889,  0.499806,  0.499723,  0.499640,
-	 0.499557,  0.499474,  0.499391,  0.499308,  0.499225,  0.499142,  0.499059,  0.498976,
-	 0.498893,  0.498809,  0.498726,  0.498643,  0.498560,  0.498477,  0.498394,  0.498311,
-	 0.498228,  0.498145,  0.498061,  0.497978,  0.497895,  0.497812,  0.497729,  0.497646,
-	 0.497562,  0.497479,  0.497396,  0.497313,  0.497230,  0.497147,  0.497063,  0.496980,
-	 0.496897,  0.496814,  0.496731,  0.496647,  0.496564,  0.496481,  0.496398,  0.496315,
-	 0.496231,  0.496148,  0.496065,  0.495982,  0.495898,  0.495815,  0.495732,  0.495649,
-	 0.495565,  0.495482,  0.495399,  0.495315,  0.495232,  0.495149,  0.495066,  0.494982,
-	 0.494899,  0.494816,  0.494732,  0.494649,  0.494566,  0.494482,  0.494399,  0.494316,
-	 0.494232,  0.494149,  0.494066,  0.493982,  0.493899,  0.493816,  0.493732,  0.493649,
-	 0.493565,  0.493482,  0.493399,  0.493315,  0.493232,  0.493148,  0.493065,  0.492982,
-	 0.492898,  0.492815,  0.492731,  0.492648,  0.492564,  0.492481,  0.492398,  0.492314,
-	 0.492231,  0.492147,  0.492064,  0.491980,  0.491897,  0.491813,  0.491730,  0.491646,
-	 0.491563,  0.491479,  0.491396,  0.491312,  0.491229,  0.491145,  0.491062,  0.490978,
-	 0.490895,  0.490811,  0.490728,  0.490644,  0.490561,  0.490477,  0.490394,  0.490310,
-	 0.490226,  0.490143,  0.490059,  0.489976,  0.489892,  0.489809,  0.489725,  0.489641,
-	 0.489558,  0.489474,  0.489391,  0.489307,  0.489223,  0.489140,  0.489056,  0.488973,
-	 0.488889,  0.488805,  0.488722,  0.488638,  0.488554,  0.488471,  0.488387,  0.488303,
-	 0.488220,  0.488136,  0.488052,  0.487969,  0.487885,  0.487801,  0.487718,  0.487634,
-	 0.487550,  0.487466,  0.487383,  0.487299,  0.487215,  0.487132,  0.487048,  0.486964,
-	 0.486880,  0.486797,  0.486713,  0.486629,  0.486545,  0.486462,  0.486378,  0.486294,
-	 0.486210,  0.486126,  0.486043,  0.485959,  0.485875,  0.485791,  0.485708,  0.485624,
-	 0.485540,  0.485456,  0.485372,  0.485288,  0.485205,  0.485121,  0.485037,  0.484953,
-	 0.484869,  0.484785,  0.484702,  0.484618,  0.484534,  0.484450,  0.484366,  0.484282,
-	 0.484198,  0.484114,  0.484031,  0.483947,  0.483863,  0.483779,  0.483695,  0.483611,
-	 0.483527,  0.483443,  0.483359,  0.483275,  0.483191,  0.483107,  0.483023,  0.482940,
-	 0.482856,  0.482772,  0.482688,  0.482604,  0.482520,  0.482436,  0.482352,  0.482268,
-	 0.482184,  0.482100,  0.482016,  0.481932,  0.481848,  0.481764,  0.481680,  0.481596,
-	 0.481512,  0.481428,  0.481344,  0.481260,  0.481176,  0.481091,  0.481007,  0.480923,
-	 0.480839,  0.480755,  0.480671,  0.480587,  0.480503,  0.480419,  0.480335,  0.480251,
-	 0.480167,  0.480083,  0.479998,  0.479914,  0.479830,  0.479746,  0.479662,  0.479578,
-	 0.479494,  0.479410,  0.479325,  0.479241,  0.479157,  0.479073,  0.478989,  0.478905,
-	 0.478821,  0.478736,  0.478652,  0.478568,  0.478484,  0.478400,  0.478315,  0.478231,
-	 0.478147,  0.478063,  0.477979,  0.477894,  0.477810,  0.477726,  0.477642,  0.477558,
-	 0.477473,  0.477389,  0.477305,  0.477221,  0.477136,  0.477052,  0.476968,  0.476884,
-	 0.476799,  0.476715,  0.476631,  0.476546,  0.476462,  0.476378,  0.476294,  0.476209,
-	 0.476125,  0.476041,  0.475956,  0.475872,  0.475788,  0.475703,  0.475619,  0.475535,
-	 0.475450,  0.475366,  0.475282,  0.475197,  0.475113,  0.475029,  0.474944,  0.474860,
-	 0.474775,  0.474691,  0.474607,  0.474522,  0.474438,  0.474353,  0.474269,  0.474185,
-	 0.474100,  0.474016,  0.473931,  0.473847,  0.473763,  0.473678,  0.473594,  0.473509,
-	 0.473425,  0.473340,  0.473256,  0.473171,  0.473087,  0.473002,  0.472918,  0.472834,
-	 0.472749,  0.472665,  0.472580,  0.472496,  0.472411,  0.472327,  0.472242,  0.472158,
-	 0.472073,  0.471988,  0.471904,  0.471819,  0.471735,  0.471650,  0.471566,  0.471481,
-	 0.471397,  0.471312,  0.471228,  0.471143,  0.471058,  0.470974,  0.470889,  0.470805,
-	 0.470720,  0.470636,  0.470551,  0.470466,  0.470382,  0.470297,  0.470213,  0.470128,
-	 0.470043,  0.469959,  0.469874,  0.469789,  0.469705,  0.469620,  0.469536,  0.469451,
-	 0.469366,  0.469282,  0.469197,  0.469112,  0.469028,  0.468943,  0.468858,  0.468774,
-	 0.468689,  0.468604,  0.468519,  0.468435,  0.468350,  0.468265,  0.468181,  0.468096,
-	 0.468011,  0.467926,  0.467842,  0.467757,  0.467672,  0.467587,  0.467503,  0.467418,
-	 0.467333,  0.467248,  0.467164,  0.467079,  0.466994,  0.466909,  0.466825,  0.466740,
-	 0.466655,  0.466570,  0.466485,  0.466401,  0.466316,  0.466231,  0.466146,  0.466061,
-	 0.465977,  0.465892,  0.465807,  0.465722,  0.465637,  0.465552,  0.465467,  0.465383,
-	 0.465298,  0.465213,  0.465128,  0.465043,  0.464958,  0.464873,  0.464788,  0.464704,
-	 0.464619,  0.464534,  0.464449,  0.464364,  0.464279,  0.464194,  0.464109,  0.464024,
-	 0.463939,  0.463854,  0.463769,  0.463685,  0.463600,  0.463515,  0.463430,  0.463345,
-	 0.463260,  0.463175,  0.463090,  0.463005,  0.462920,  0.462835,  0.462750,  0.462665,
-	 0.462580,  0.462495,  0.462410,  0.462325,  0.462240,  0.462155,  0.462070,  0.461985,
-	 0.461900,  0.461815,  0.461730,  0.461645,  0.461560,  0.461475,  0.461390,  0.461304,
-	 0.461219,  0.461134,  0.461049,  0.460964,  0.460879,  0.460794,  0.460709,  0.460624,
-	 0.460539,  0.460454,  0.460369,  0.460283,  0.460198,  0.460113,  0.460028,  0.459943,
-	 0.459858,  0.459773,  0.459687,  0.459602,  0.459517,  0.459432,  0.459347,  0.459262,
-	 0.459177,  0.459091,  0.459006,  0.458921,  0.458836,  0.458751,  0.458665,  0.458580,
-	 0.458495,  0.458410,  0.458325,  0.458239,  0.458154,  0.458069,  0.457984,  0.457899,
-	 0.457813,  0.457728,  0.457643,  0.457558,  0.457472,  0.457387,  0.457302,  0.457217,
-	 0.457131,  0.457046,  0.456961,  0.456875,  0.456790,  0.456705,  0.456620,  0.456534,
-	 0.456449,  0.456364,  0.456278,  0.456193,  0.456108,  0.456022,  0.455937,  0.455852,
-	 0.455766,  0.455681,  0.455596,  0.455510,  0.455425,  0.455340,  0.455254,  0.455169,
-	 0.455084,  0.454998,  0.454913,  0.454827,  0.454742,  0.454657,  0.454571,  0.454486,
-	 0.454400,  0.454315,  0.454230,  0.454144,  0.454059,  0.453973,  0.453888,  0.453803,
-	 0.453717,  0.453632,  0.453546,  0.453461,  0.453375,  0.453290,  0.453204,  0.453119,
-	 0.453033,  0.452948,  0.452863,  0.452777,  0.452692,  0.452606,  0.452521,  0.452435,
-	 0.452350,  0.452264,  0.452179,  0.452093,  0.452008,  0.451922,  0.451836,  0.451751,
-	 0.451665,  0.451580,  0.451494,  0.451409,  0.451323,  0.451238,  0.451152,  0.451067,
-	 0.450981,  0.450895,  0.450810,  0.450724,  0.450639,  0.450553,  0.450467,  0.450382,
-	 0.450296,  0.450211,  0.450125,  0.450039,  0.449954,  0.449868,  0.449783,  0.449697,
-	 0.449611,  0.449526,  0.449440,  0.449354,  0.449269,  0.449183,  0.449097,  0.449012,
-	 0.448926,  0.448840,  0.448755,  0.448669,  0.448583,  0.448498,  0.448412,  0.448326,
-	 0.448241,  0.448155,  0.448069,  0.447983,  0.447898,  0.447812,  0.447726,  0.447641,
-	 0.447555,  0.447469,  0.447383,  0.447298,  0.447212,  0.447126,  0.447040,  0.446955,
-	 0.446869,  0.446783,  0.446697,  0.446612,  0.446526,  0.446440,  0.446354,  0.446268,
-	 0.446183,  0.446097,  0.446011,  0.445925,  0.445839,  0.445754,  0.445668,  0.445582,
-	 0.445496,  0.445410,  0.445324,  0.445239,  0.445153,  0.445067,  0.444981,  0.444895,
-	 0.444809,  0.444723,  0.444637,  0.444552,  0.444466,  0.444380,  0.444294,  0.444208,
-	 0.444122,  0.444036,  0.443950,  0.443864,  0.443779,  0.443693,  0.443607,  0.443521,
-	 0.443435,  0.443349,  0.443263,  0.443177,  0.443091,  0.443005,  0.442919,  0.442833,
-	 0.442747,  0.442661,  0.442575,  0.442489,  0.442403,  0.442317,  0.442231,  0.442145,
-	 0.442059,  0.441973,  0.441887,  0.441801,  0.441715,  0.441629,  0.441543,  0.441457,
-	 0.441371,  0.441285,  0.441199,  0.441113,  0.441027,  0.440941,  0.440855,  0.440769,
-	 0.440683,  0.440597,  0.440511,  0.440425,  0.440339,  0.440253,  0.440166,  0.440080,
-	 0.439994,  0.439908,  0.439822,  0.439736,  0.439650,  0.439564,  0.439478,  0.439392,
-	 0.439305,  0.439219,  0.439133,  0.439047,  0.438961,  0.438875,  0.438789,  0.438702,
-	 0.438616,  0.438530,  0.438444,  0.438358,  0.438272,  0.438185,  0.438099,  0.438013,
-	 0.437927,  0.437841,  0.437754,  0.437668,  0.437582,  0.437496,  0.437410,  0.437323,
-	 0.437237,  0.437151,  0.437065,  0.436978,  0.436892,  0.436806,  0.436720,  0.436633,
-	 0.436547,  0.436461,  0.436375,  0.436288,  0.436202,  0.436116,  0.436030,  0.435943,
-	 0.435857,  0.435771,  0.435685,  0.435598,  0.435512,  0.435426,  0.435339,  0.435253,
-	 0.435167,  0.435080,  0.434994,  0.434908,  0.434821,  0.434735,  0.434649,  0.434562,
-	 0.434476,  0.434390,  0.434303,  0.434217,  0.434131,  0.434044,  0.433958,  0.433871,
-	 0.433785,  0.433699,  0.433612,  0.433526,  0.433439,  0.433353,  0.433267,  0.433180,
-	 0.433094,  0.433007,  0.432921,  0.432835,  0.432748,  0.432662,  0.432575,  0.432489,
-	 0.432402,  0.432316,  0.432229,  0.432143,  0.432057,  0.431970,  0.431884,  0.431797,
-	 0.431711,  0.431624,  0.431538,  0.431451,  0.431365,  0.431278,  0.431192,  0.431105,
-	 0.431019,  0.430932,  0.430846,  0.430759,  0.430673,  0.430586,  0.430500,  0.430413,
-	 0.430326,  0.430240,  0.430153,  0.430067,  0.429980,  0.429894,  0.429807,  0.429721,
-	 0.429634,  0.429547,  0.429461,  0.429374,  0.429288,  0.429201,  0.429114,  0.429028,
-	 0.428941,  0.428855,  0.428768,  0.428681,  0.428595,  0.428508,  0.428422,  0.428335,
-	 0.428248,  0.428162,  0.428075,  0.427988,  0.427902,  0.427815,  0.427728,  0.427642,
-	 0.427555,  0.427468,  0.427382,  0.427295,  0.427208,  0.427122,  0.427035,  0.426948,
-	 0.426862,  0.426775,  0.426688,  0.426601,  0.426515,  0.426428,  0.426341,  0.426255,
-	 0.426168,  0.426081,  0.425994,  0.425908,  0.425821,  0.425734,  0.425647,  0.425561,
-	 0.425474,  0.425387,  0.425300,  0.425214,  0.425127,  0.425040,  0.424953,  0.424866,
-	 0.424780,  0.424693,  0.424606,  0.424519,  0.424432,  0.424346,  0.424259,  0.424172,
-	 0.424085,  0.423998,  0.423912,  0.423825,  0.423738,  0.423651,  0.423564,  0.423477,
-	 0.423390,  0.423304,  0.423217,  0.423130,  0.423043,  0.422956,  0.422869,  0.422782,
-	 0.422695,  0.422609,  0.422522,  0.422435,  0.422348,  0.422261,  0.422174,  0.422087,
-	 0.422000,  0.421913,  0.421826,  0.421739,  0.421653,  0.421566,  0.421479,  0.421392,
-	 0.421305,  0.421218,  0.421131,  0.421044,  0.420957,  0.420870,  0.420783,  0.420696,
-	 0.420609,  0.420522,  0.420435,  0.420348,  0.420261,  0.420174,  0.420087,  0.420000,
-	 0.419913,  0.419826,  0.419739,  0.419652,  0.419565,  0.419478,  0.419391,  0.419304,
-	 0.419217,  0.419130,  0.419043,  0.418956,  0.418869,  0.418782,  0.418695,  0.418608,
-	 0.418520,  0.418433,  0.418346,  0.418259,  0.418172,  0.418085,  0.417998,  0.417911,
-	 0.417824,  0.417737,  0.417650,  0.417562,  0.417475,  0.417388,  0.417301,  0.417214,
-	 0.417127,  0.417040,  0.416952,  0.416865,  0.416778,  0.416691,  0.416604,  0.416517,
-	 0.416430,  0.416342,  0.416255,  0.416168,  0.416081,  0.415994,  0.415906,  0.415819,
-	 0.415732,  0.415645,  0.415558,  0.415471,  0.415383,  0.415296,  0.415209,  0.415122,
-	 0.415034,  0.414947,  0.414860,  0.414773,  0.414685,  0.414598,  0.414511,  0.414424,
-	 0.414337,  0.414249,  0.414162,  0.414075,  0.413987,  0.413900,  0.413813,  0.413726,
-	 0.413638,  0.413551,  0.413464,  0.413376,  0.413289,  0.413202,  0.413115,  0.413027,
-	 0.412940,  0.412853,  0.412765,  0.412678,  0.412591,  0.412503,  0.412416,  0.412329,
-	 0.412241,  0.412154,  0.412067,  0.411979,  0.411892,  0.411804,  0.411717,  0.411630,
-	 0.411542,  0.411455,  0.411368,  0.411280,  0.411193,  0.411105,  0.411018,  0.410931,
-	 0.410843,  0.410756,  0.410668,  0.410581,  0.410493,  0.410406,  0.410319,  0.410231,
-	 0.410144,  0.410056,  0.409969,  0.409881,  0.409794,  0.409707,  0.409619,  0.409532,
-	 0.409444,  0.409357,  0.409269,  0.409182,  0.409094,  0.409007,  0.408919,  0.408832,
-	 0.408744,  0.408657,  0.408569,  0.408482,  0.408394,  0.408307,  0.408219,  0.408132,
-	 0.408044,  0.407957,  0.407869,  0.407782,  0.407694,  0.407606,  0.407519,  0.407431,
-	 0.407344,  0.407256,  0.407169,  0.407081,  0.406994,  0.406906,  0.406818,  0.406731,
-	 0.406643,  0.406556,  0.406468,  0.406380,  0.406293,  0.406205,  0.406118,  0.406030,
-	 0.405942,  0.405855,  0.405767,  0.405680,  0.405592,  0.405504,  0.405417,  0.405329,
-	 0.405241,  0.405154,  0.405066,  0.404978,  0.404891,  0.404803,  0.404715,  0.404628,
-	 0.404540,  0.404452,  0.404365,  0.404277,  0.404189,  0.404102,  0.404014,  0.403926,
-	 0.403838,  0.403751,  0.403663,  0.403575,  0.403488,  0.403400,  0.403312,  0.403224,
-	 0.403137,  0.403049,  0.402961,  0.402873,  0.402786,  0.402698,  0.402610,  0.402522,
-	 0.402435,  0.402347,  0.402259,  0.402171,  0.402084,  0.401996,  0.401908,  0.401820,
-	 0.401732,  0.401645,  0.401557,  0.401469,  0.401381,  0.401293,  0.401206,  0.401118,
-	 0.401030,  0.400942,  0.400854,  0.400766,  0.400679,  0.400591,  0.400503,  0.400415,
-	 0.400327,  0.400239,  0.400151,  0.400064,  0.399976,  0.399888,  0.399800,  0.399712,
-	 0.399624,  0.399536,  0.399448,  0.399361,  0.399273,  0.399185,  0.399097,  0.399009,
-	 0.398921,  0.398833,  0.398745,  0.398657,  0.398569,  0.398481,  0.398393,  0.398306,
-	 0.398218,  0.398130,  0.398042,  0.397954,  0.397866,  0.397778,  0.397690,  0.397602,
-	 0.397514,  0.397426,  0.397338,  0.397250,  0.397162,  0.397074,  0.396986,  0.396898,
-	 0.396810,  0.396722,  0.396634,  0.396546,  0.396458,  0.396370,  0.396282,  0.396194,
-	 0.396106,  0.396018,  0.395930,  0.395842,  0.395754,  0.395666,  0.395578,  0.395490,
-	 0.395401,  0.395313,  0.395225,  0.395137,  0.395049,  0.394961,  0.394873,  0.394785,
-	 0.394697,  0.394609,  0.394521,  0.394433,  0.394344,  0.394256,  0.394168,  0.394080,
-	 0.393992,  0.393904,  0.393816,  0.393728,  0.393640,  0.393551,  0.393463,  0.393375,
-	 0.393287,  0.393199,  0.393111,  0.393023,  0.392934,  0.392846,  0.392758,  0.392670,
-	 0.392582,  0.392493,  0.392405,  0.392317,  0.392229,  0.392141,  0.392053,  0.391964,
-	 0.391876,  0.391788,  0.391700,  0.391612,  0.391523,  0.391435,  0.391347,  0.391259,
-	 0.391170,  0.391082,  0.390994,  0.390906,  0.390817,  0.390729,  0.390641,  0.390553,
-	 0.390464,  0.390376,  0.390288,  0.390200,  0.390111,  0.390023,  0.389935,  0.389846,
-	 0.389758,  0.389670,  0.389582,  0.389493,  0.389405,  0.389317,  0.389228,  0.389140,
-	 0.389052,  0.388963,  0.388875,  0.388787,  0.388698,  0.388610,  0.388522,  0.388433,
-	 0.388345,  0.388257,  0.388168,  0.388080,  0.387992,  0.387903,  0.387815,  0.387727,
-	 0.387638,  0.387550,  0.387461,  0.387373,  0.387285,  0.387196,  0.387108,  0.387019,
-	 0.386931,  0.386843,  0.386754,  0.386666,  0.386577,  0.386489,  0.386400,  0.386312,
-	 0.386224,  0.386135,  0.386047,  0.385958,  0.385870,  0.385781,  0.385693,  0.385605,
-	 0.385516,  0.385428,  0.385339,  0.385251,  0.385162,  0.385074,  0.384985,  0.384897,
-	 0.384808,  0.384720,  0.384631,  0.384543,  0.384454,  0.384366,  0.384277,  0.384189,
-	 0.384100,  0.384012,  0.383923,  0.383835,  0.383746,  0.383658,  0.383569,  0.383480,
-	 0.383392,  0.383303,  0.383215,  0.383126,  0.383038,  0.382949,  0.382861,  0.382772,
-	 0.382683,  0.382595,  0.382506,  0.382418,  0.382329,  0.382241,  0.382152,  0.382063,
-	 0.381975,  0.381886,  0.381797,  0.381709,  0.381620,  0.381532,  0.381443,  0.381354,
-	 0.381266,  0.381177,  0.381088,  0.381000,  0.380911,  0.380823,  0.380734,  0.380645,
-	 0.380557,  0.380468,  0.380379,  0.380291,  0.380202,  0.380113,  0.380025,  0.379936,
-	 0.379847,  0.379759,  0.379670,  0.379581,  0.379492,  0.379404,  0.379315,  0.379226,
-	 0.379138,  0.379049,  0.378960,  0.378871,  0.378783,  0.378694,  0.378605,  0.378516,
-	 0.378428,  0.378339,  0.378250,  0.378162,  0.378073,  0.377984,  0.377895,  0.377806,
-	 0.377718,  0.377629,  0.377540,  0.377451,  0.377363,  0.377274,  0.377185,  0.377096,
-	 0.377007,  0.376919,  0.376830,  0.376741,  0.376652,  0.376563,  0.376475,  0.376386,
-	 0.376297,  0.376208,  0.376119,  0.376030,  0.375942,  0.375853,  0.375764,  0.375675,
-	 0.375586,  0.375497,  0.375408,  0.375320,  0.375231,  0.375142,  0.375053,  0.374964,
-	 0.374875,  0.374786,  0.374697,  0.374609,  0.374520,  0.374431,  0.374342,  0.374253,
-	 0.374164,  0.374075,  0.373986,  0.373897,  0.373808,  0.373719,  0.373631,  0.373542,
-	 0.373453,  0.373364,  0.373275,  0.373186,  0.373097,  0.373008,  0.372919,  0.372830,
-	 0.372741,  0.372652,  0.372563,  0.372474,  0.372385,  0.372296,  0.372207,  0.372118,
-	 0.372029,  0.371940,  0.371851,  0.371762,  0.371673,  0.371584,  0.371495,  0.371406,
-	 0.371317,  0.371228,  0.371139,  0.371050,  0.370961,  0.370872,  0.370783,  0.370694,
-	 0.370605,  0.370516,  0.370427,  0.370338,  0.370249,  0.370160,  0.370071,  0.369982,
-	 0.369892,  0.369803,  0.369714,  0.369625,  0.369536,  0.369447,  0.369358,  0.369269,
-	 0.369180,  0.369091,  0.369002,  0.368912,  0.368823,  0.368734,  0.368645,  0.368556,
-	 0.368467,  0.368378,  0.368289,  0.368199,  0.368110,  0.368021,  0.367932,  0.367843,
-	 0.367754,  0.367665,  0.367575,  0.367486,  0.367397,  0.367308,  0.367219,  0.367130,
-	 0.367040,  0.366951,  0.366862,  0.366773,  0.366684,  0.366594,  0.366505,  0.366416,
-	 0.366327,  0.366238,  0.366148,  0.366059,  0.365970,  0.365881,  0.365791,  0.365702,
-	 0.365613,  0.365524,  0.365435,  0.365345,  0.365256,  0.365167,  0.365078,  0.364988,
-	 0.364899,  0.364810,  0.364720,  0.364631,  0.364542,  0.364453,  0.364363,  0.364274,
-	 0.364185,  0.364096,  0.364006,  0.363917,  0.363828,  0.363738,  0.363649,  0.363560,
-	 0.363470,  0.363381,  0.363292,  0.363202,  0.363113,  0.363024,  0.362934,  0.362845,
-	 0.362756,  0.362666,  0.362577,  0.362488,  0.362398,  0.362309,  0.362220,  0.362130,
-	 0.362041,  0.361952,  0.361862,  0.361773,  0.361683,  0.361594,  0.361505,  0.361415,
-	 0.361326,  0.361236,  0.361147,  0.361058,  0.360968,  0.360879,  0.360789,  0.360700,
-	 0.360611,  0.360521,  0.360432,  0.360342,  0.360253,  0.360163,  0.360074,  0.359984,
-	 0.359895,  0.359806,  0.359716,  0.359627,  0.359537,  0.359448,  0.359358,  0.359269,
-	 0.359179,  0.359090,  0.359000,  0.358911,  0.358821,  0.358732,  0.358642,  0.358553,
-	 0.358463,  0.358374,  0.358284,  0.358195,  0.358105,  0.358016,  0.357926,  0.357837,
-	 0.357747,  0.357658,  0.357568,  0.357479,  0.357389,  0.357300,  0.357210,  0.357121,
-	 0.357031,  0.356941,  0.356852,  0.356762,  0.356673,  0.356583,  0.356494,  0.356404,
-	 0.356314,  0.356225,  0.356135,  0.356046,  0.355956,  0.355866,  0.355777,  0.355687,
-	 0.355598,  0.355508,  0.355418,  0.355329,  0.355239,  0.355150,  0.355060,  0.354970,
-	 0.354881,  0.354791,  0.354701,  0.354612,  0.354522,  0.354432,  0.354343,  0.354253,
-	 0.354164,  0.354074,  0.353984,  0.353895,  0.353805,  0.353715,  0.353626,  0.353536,
-	 0.353446,  0.353356,  0.353267,  0.353177,  0.353087,  0.352998,  0.352908,  0.352818,
-	 0.352729,  0.352639,  0.352549,  0.352459,  0.352370,  0.352280,  0.352190,  0.352100,
-	 0.352011,  0.351921,  0.351831,  0.351742,  0.351652,  0.351562,  0.351472,  0.351383,
-	 0.351293,  0.351203,  0.351113,  0.351023,  0.350934,  0.350844,  0.350754,  0.350664,
-	 0.350575,  0.350485,  0.350395,  0.350305,  0.350215,  0.350126,  0.350036,  0.349946,
-	 0.349856,  0.349766,  0.349676,  0.349587,  0.349497,  0.349407,  0.349317,  0.349227,
-	 0.349138,  0.349048,  0.348958,  0.348868,  0.348778,  0.348688,  0.348598,  0.348509,
-	 0.348419,  0.348329,  0.348239,  0.348149,  0.348059,  0.347969,  0.347879,  0.347790,
-	 0.347700,  0.347610,  0.347520,  0.347430,  0.347340,  0.347250,  0.347160,  0.347070,
-	 0.346980,  0.346890,  0.346801,  0.346711,  0.346621,  0.346531,  0.346441,  0.346351,
-	 0.346261,  0.346171,  0.346081,  0.345991,  0.345901,  0.345811,  0.345721,  0.345631,
-	 0.345541,  0.345451,  0.345361,  0.345271,  0.345181,  0.345091,  0.345001,  0.344911,
-	 0.344821,  0.344731,  0.344641,  0.344551,  0.344461,  0.344371,  0.344281,  0.344191,
-	 0.344101,  0.344011,  0.343921,  0.343831,  0.343741,  0.343651,  0.343561,  0.343471,
-	 0.343381,  0.343291,  0.343201,  0.343111,  0.343021,  0.342931,  0.342841,  0.342751,
-	 0.342661,  0.342571,  0.342481,  0.342391,  0.342300,  0.342210,  0.342120,  0.342030,
-	 0.341940,  0.341850,  0.341760,  0.341670,  0.341580,  0.341490,  0.341399,  0.341309,
-	 0.341219,  0.341129,  0.341039,  0.340949,  0.340859,  0.340769,  0.340678,  0.340588,
-	 0.340498,  0.340408,  0.340318,  0.340228,  0.340138,  0.340047,  0.339957,  0.339867,
-	 0.339777,  0.339687,  0.339597,  0.339506,  0.339416,  0.339326,  0.339236,  0.339146,
-	 0.339055,  0.338965,  0.338875,  0.338785,  0.338695,  0.338604,  0.338514,  0.338424,
-	 0.338334,  0.338244,  0.338153,  0.338063,  0.337973,  0.337883,  0.337792,  0.337702,
-	 0.337612,  0.337522,  0.337431,  0.337341,  0.337251,  0.337161,  0.337070,  0.336980,
-	 0.336890,  0.336800,  0.336709,  0.336619,  0.336529,  0.336438,  0.336348,  0.336258,
-	 0.336168,  0.336077,  0.335987,  0.335897,  0.335806,  0.335716,  0.335626,  0.335535,
-	 0.335445,  0.335355,  0.335265,  0.335174,  0.335084,  0.334994,  0.334903,  0.334813,
-	 0.334722,  0.334632,  0.334542,  0.334451,  0.334361,  0.334271,  0.334180,  0.334090,
-	 0.334000,  0.333909,  0.333819,  0.333729,  0.333638,  0.333548,  0.333457,  0.333367,
-	 0.333277,  0.333186,  0.333096,  0.333005,  0.332915,  0.332825,  0.332734,  0.332644,
-	 0.332553,  0.332463,  0.332373,  0.332282,  0.332192,  0.332101,  0.332011,  0.331920,
-	 0.331830,  0.331739,  0.331649,  0.331559,  0.331468,  0.331378,  0.331287,  0.331197,
-	 0.331106,  0.331016,  0.330925,  0.330835,  0.330744,  0.330654,  0.330563,  0.330473,
-	 0.330382,  0.330292,  0.330202,  0.330111,  0.330020,  0.329930,  0.329839,  0.329749,
-	 0.329658,  0.329568,  0.329477,  0.329387,  0.329296,  0.329206,  0.329115,  0.329025,
-	 0.328934,  0.328844,  0.328753,  0.328663,  0.328572,  0.328482,  0.328391,  0.328300,
-	 0.328210,  0.328119,  0.328029,  0.327938,  0.327848,  0.327757,  0.327666,  0.327576,
-	 0.327485,  0.327395,  0.327304,  0.327213,  0.327123,  0.327032,  0.326942,  0.326851,
-	 0.326760,  0.326670,  0.326579,  0.326489,  0.326398,  0.326307,  0.326217,  0.326126,
-	 0.326035,  0.325945,  0.325854,  0.325764,  0.325673,  0.325582,  0.325492,  0.325401,
-	 0.325310,  0.325220,  0.325129,  0.325038,  0.324948,  0.324857,  0.324766,  0.324676,
-	 0.324585,  0.324494,  0.324404,  0.324313,  0.324222,  0.324131,  0.324041,  0.323950,
-	 0.323859,  0.323769,  0.323678,  0.323587,  0.323497,  0.323406,  0.323315,  0.323224,
-	 0.323134,  0.323043,  0.322952,  0.322861,  0.322771,  0.322680,  0.322589,  0.322498,
-	 0.322408,  0.322317,  0.322226,  0.322135,  0.322045,  0.321954,  0.321863,  0.321772,
-	 0.321682,  0.321591,  0.321500,  0.321409,  0.321318,  0.321228,  0.321137,  0.321046,
-	 0.320955,  0.320864,  0.320774,  0.320683,  0.320592,  0.320501,  0.320410,  0.320320,
-	 0.320229,  0.320138,  0.320047,  0.319956,  0.319865,  0.319775,  0.319684,  0.319593,
-	 0.319502,  0.319411,  0.319320,  0.319229,  0.319139,  0.319048,  0.318957,  0.318866,
-	 0.318775,  0.318684,  0.318593,  0.318503,  0.318412,  0.318321,  0.318230,  0.318139,
-	 0.318048,  0.317957,  0.317866,  0.317775,  0.317684,  0.317594,  0.317503,  0.317412,
-	 0.317321,  0.317230,  0.317139,  0.317048,  0.316957,  0.316866,  0.316775,  0.316684,
-	 0.316593,  0.316502,  0.316411,  0.316321,  0.316230,  0.316139,  0.316048,  0.315957,
-	 0.315866,  0.315775,  0.315684,  0.315593,  0.315502,  0.315411,  0.315320,  0.315229,
-	 0.315138,  0.315047,  0.314956,  0.314865,  0.314774,  0.314683,  0.314592,  0.314501,
-	 0.314410,  0.314319,  0.314228,  0.314137,  0.314046,  0.313955,  0.313864,  0.313773,
-	 0.313682,  0.313591,  0.313500,  0.313409,  0.313318,  0.313227,  0.313135,  0.313044,
-	 0.312953,  0.312862,  0.312771,  0.312680,  0.312589,  0.312498,  0.312407,  0.312316,
-	 0.312225,  0.312134,  0.312043,  0.311952,  0.311860,  0.311769,  0.311678,  0.311587,
-	 0.311496,  0.311405,  0.311314,  0.311223,  0.311132,  0.311041,  0.310949,  0.310858,
-	 0.310767,  0.310676,  0.310585,  0.310494,  0.310403,  0.310311,  0.310220,  0.310129,
-	 0.310038,  0.309947,  0.309856,  0.309765,  0.309673,  0.309582,  0.309491,  0.309400,
-	 0.309309,  0.309218,  0.309126,  0.309035,  0.308944,  0.308853,  0.308762,  0.308670,
-	 0.308579,  0.308488,  0.308397,  0.308306,  0.308214,  0.308123,  0.308032,  0.307941,
-	 0.307850,  0.307758,  0.307667,  0.307576,  0.307485,  0.307394,  0.307302,  0.307211,
-	 0.307120,  0.307029,  0.306937,  0.306846,  0.306755,  0.306664,  0.306572,  0.306481,
-	 0.306390,  0.306299,  0.306207,  0.306116,  0.306025,  0.305933,  0.305842,  0.305751,
-	 0.305660,  0.305568,  0.305477,  0.305386,  0.305294,  0.305203,  0.305112,  0.305021,
-	 0.304929,  0.304838,  0.304747,  0.304655,  0.304564,  0.304473,  0.304381,  0.304290,
-	 0.304199,  0.304107,  0.304016,  0.303925,  0.303833,  0.303742,  0.303651,  0.303559,
-	 0.303468,  0.303377,  0.303285,  0.303194,  0.303103,  0.303011,  0.302920,  0.302828,
-	 0.302737,  0.302646,  0.302554,  0.302463,  0.302372,  0.302280,  0.302189,  0.302097,
-	 0.302006,  0.301915,  0.301823,  0.301732,  0.301640,  0.301549,  0.301458,  0.301366,
-	 0.301275,  0.301183,  0.301092,  0.301000,  0.300909,  0.300818,  0.300726,  0.300635,
-	 0.300543,  0.300452,  0.300360,  0.300269,  0.300177,  0.300086,  0.299995,  0.299903,
-	 0.299812,  0.299720,  0.299629,  0.299537,  0.299446,  0.299354,  0.299263,  0.299171,
-	 0.299080,  0.298988,  0.298897,  0.298805,  0.298714,  0.298622,  0.298531,  0.298439,
-	 0.298348,  0.298256,  0.298165,  0.298073,  0.297982,  0.297890,  0.297799,  0.297707,
-	 0.297616,  0.297524,  0.297433,  0.297341,  0.297250,  0.297158,  0.297066,  0.296975,
-	 0.296883,  0.296792,  0.296700,  0.296609,  0.296517,  0.296426,  0.296334,  0.296242,
-	 0.296151,  0.296059,  0.295968,  0.295876,  0.295785,  0.295693,  0.295601,  0.295510,
-	 0.295418,  0.295327,  0.295235,  0.295143,  0.295052,  0.294960,  0.294869,  0.294777,
-	 0.294685,  0.294594,  0.294502,  0.294410,  0.294319,  0.294227,  0.294136,  0.294044,
-	 0.293952,  0.293861,  0.293769,  0.293677,  0.293586,  0.293494,  0.293402,  0.293311,
-	 0.293219,  0.293128,  0.293036,  0.292944,  0.292852,  0.292761,  0.292669,  0.292577,
-	 0.292486,  0.292394,  0.292302,  0.292211,  0.292119,  0.292027,  0.291936,  0.291844,
-	 0.291752,  0.291661,  0.291569,  0.291477,  0.291385,  0.291294,  0.291202,  0.291110,
-	 0.291019,  0.290927,  0.290835,  0.290743,  0.290652,  0.290560,  0.290468,  0.290376,
-	 0.290285,  0.290193,  0.290101,  0.290009,  0.289918,  0.289826,  0.289734,  0.289642,
-	 0.289551,  0.289459,  0.289367,  0.289275,  0.289184,  0.289092,  0.289000,  0.288908,
-	 0.288816,  0.288725,  0.288633,  0.288541,  0.288449,  0.288357,  0.288266,  0.288174,
-	 0.288082,  0.287990,  0.287898,  0.287807,  0.287715,  0.287623,  0.287531,  0.287439,
-	 0.287347,  0.287256,  0.287164,  0.287072,  0.286980,  0.286888,  0.286796,  0.286705,
-	 0.286613,  0.286521,  0.286429,  0.286337,  0.286245,  0.286153,  0.286062,  0.285970,
-	 0.285878,  0.285786,  0.285694,  0.285602,  0.285510,  0.285418,  0.285327,  0.285235,
-	 0.285143,  0.285051,  0.284959,  0.284867,  0.284775,  0.284683,  0.284591,  0.284499,
-	 0.284408,  0.284316,  0.284224,  0.284132,  0.284040,  0.283948,  0.283856,  0.283764,
-	 0.283672,  0.283580,  0.283488,  0.283396,  0.283304,  0.283212,  0.283120,  0.283029,
-	 0.282937,  0.282845,  0.282753,  0.282661,  0.282569,  0.282477,  0.282385,  0.282293,
-	 0.282201,  0.282109,  0.282017,  0.281925,  0.281833,  0.281741,  0.281649,  0.281557,
-	 0.281465,  0.281373,  0.281281,  0.281189,  0.281097,  0.281005,  0.280913,  0.280821,
-	 0.280729,  0.280637,  0.280545,  0.280453,  0.280361,  0.280269,  0.280177,  0.280085,
-	 0.279993,  0.279901,  0.279809,  0.279717,  0.279624,  0.279532,  0.279440,  0.279348,
-	 0.279256,  0.279164,  0.279072,  0.278980,  0.278888,  0.278796,  0.278704,  0.278612,
-	 0.278520,  0.278428,  0.278336,  0.278243,  0.278151,  0.278059,  0.277967,  0.277875,
-	 0.277783,  0.277691,  0.277599,  0.277507,  0.277415,  0.277322,  0.277230,  0.277138,
-	 0.277046,  0.276954,  0.276862,  0.276770,  0.276678,  0.276585,  0.276493,  0.276401,
-	 0.276309,  0.276217,  0.276125,  0.276033,  0.275940,  0.275848,  0.275756,  0.275664,
-	 0.275572,  0.275480,  0.275387,  0.275295,  0.275203,  0.275111,  0.275019,  0.274927,
-	 0.274834,  0.274742,  0.274650,  0.274558,  0.274466,  0.274374,  0.274281,  0.274189,
-	 0.274097,  0.274005,  0.273912,  0.273820,  0.273728,  0.273636,  0.273544,  0.273451,
-	 0.273359,  0.273267,  0.273175,  0.273083,  0.272990,  0.272898,  0.272806,  0.272714,
-	 0.272621,  0.272529,  0.272437,  0.272345,  0.272252,  0.272160,  0.272068,  0.271976,
-	 0.271883,  0.271791,  0.271699,  0.271607,  0.271514,  0.271422,  0.271330,  0.271237,
-	 0.271145,  0.271053,  0.270961,  0.270868,  0.270776,  0.270684,  0.270591,  0.270499,
-	 0.270407,  0.270315,  0.270222,  0.270130,  0.270038,  0.269945,  0.269853,  0.269761,
-	 0.269668,  0.269576,  0.269484,  0.269391,  0.269299,  0.269207,  0.269114,  0.269022,
-	 0.268930,  0.268837,  0.268745,  0.268653,  0.268560,  0.268468,  0.268376,  0.268283,
-	 0.268191,  0.268099,  0.268006,  0.267914,  0.267821,  0.267729,  0.267637,  0.267544,
-	 0.267452,  0.267359,  0.267267,  0.267175,  0.267082,  0.266990,  0.266898,  0.266805,
-	 0.266713,  0.266620,  0.266528,  0.266436,  0.266343,  0.266251,  0.266158,  0.266066,
-	 0.265973,  0.265881,  0.265789,  0.265696,  0.265604,  0.265511,  0.265419,  0.265326,
-	 0.265234,  0.265142,  0.265049,  0.264957,  0.264864,  0.264772,  0.264679,  0.264587,
-	 0.264494,  0.264402,  0.264309,  0.264217,  0.264125,  0.264032,  0.263940,  0.263847,
-	 0.263755,  0.263662,  0.263570,  0.263477,  0.263385,  0.263292,  0.263200,  0.263107,
-	 0.263015,  0.262922,  0.262830,  0.262737,  0.262645,  0.262552,  0.262460,  0.262367,
-	 0.262275,  0.262182,  0.262090,  0.261997,  0.261905,  0.261812,  0.261720,  0.261627,
-	 0.261534,  0.261442,  0.261349,  0.261257,  0.261164,  0.261072,  0.260979,  0.260887,
-	 0.260794,  0.260702,  0.260609,  0.260516,  0.260424,  0.260331,  0.260239,  0.260146,
-	 0.260054,  0.259961,  0.259868,  0.259776,  0.259683,  0.259591,  0.259498,  0.259405,
-	 0.259313,  0.259220,  0.259128,  0.259035,  0.258943,  0.258850,  0.258757,  0.258665,
-	 0.258572,  0.258479,  0.258387,  0.258294,  0.258202,  0.258109,  0.258016,  0.257924,
-	 0.257831,  0.257738,  0.257646,  0.257553,  0.257461,  0.257368,  0.257275,  0.257183,
-	 0.257090,  0.256997,  0.256905,  0.256812,  0.256719,  0.256627,  0.256534,  0.256441,
-	 0.256349,  0.256256,  0.256163,  0.256071,  0.255978,  0.255885,  0.255793,  0.255700,
-	 0.255607,  0.255515,  0.255422,  0.255329,  0.255236,  0.255144,  0.255051,  0.254958,
-	 0.254866,  0.254773,  0.254680,  0.254588,  0.254495,  0.254402,  0.254309,  0.254217,
-	 0.254124,  0.254031,  0.253938,  0.253846,  0.253753,  0.253660,  0.253568,  0.253475,
-	 0.253382,  0.253289,  0.253197,  0.253104,  0.253011,  0.252918,  0.252826,  0.252733,
-	 0.252640,  0.252547,  0.252454,  0.252362,  0.252269,  0.252176,  0.252083,  0.251991,
-	 0.251898,  0.251805,  0.251712,  0.251619,  0.251527,  0.251434,  0.251341,  0.251248,
-	 0.251155,  0.251063,  0.250970,  0.250877,  0.250784,  0.250691,  0.250599,  0.250506,
-	 0.250413,  0.250320,  0.250227,  0.250135,  0.250042,  0.249949,  0.249856,  0.249763,
-	 0.249670,  0.249578,  0.249485,  0.249392,  0.249299,  0.249206,  0.249113,  0.249020,
-	 0.248928,  0.248835,  0.248742,  0.248649,  0.248556,  0.248463,  0.248370,  0.248278,
-	 0.248185,  0.248092,  0.247999,  0.247906,  0.247813,  0.247720,  0.247627,  0.247535,
-	 0.247442,  0.247349,  0.247256,  0.247163,  0.247070,  0.246977,  0.246884,  0.246791,
-	 0.246698,  0.246606,  0.246513,  0.246420,  0.246327,  0.246234,  0.246141,  0.246048,
-	 0.245955,  0.245862,  0.245769,  0.245676,  0.245583,  0.245490,  0.245397,  0.245304,
-	 0.245212,  0.245119,  0.245026,  0.244933,  0.244840,  0.244747,  0.244654,  0.244561,
-	 0.244468,  0.244375,  0.244282,  0.244189,  0.244096,  0.244003,  0.243910,  0.243817,
-	 0.243724,  0.243631,  0.243538,  0.243445,  0.243352,  0.243259,  0.243166,  0.243073,
-	 0.242980,  0.242887,  0.242794,  0.242701,  0.242608,  0.242515,  0.242422,  0.242329,
-	 0.242236,  0.242143,  0.242050,  0.241957,  0.241864,  0.241771,  0.241678,  0.241585,
-	 0.241492,  0.241399,  0.241306,  0.241213,  0.241120,  0.241027,  0.240934,  0.240841,
-	 0.240748,  0.240654,  0.240561,  0.240468,  0.240375,  0.240282,  0.240189,  0.240096,
-	 0.240003,  0.239910,  0.239817,  0.239724,  0.239631,  0.239538,  0.239445,  0.239351,
-	 0.239258,  0.239165,  0.239072,  0.238979,  0.238886,  0.238793,  0.238700,  0.238607,
-	 0.238514,  0.238420,  0.238327,  0.238234,  0.238141,  0.238048,  0.237955,  0.237862,
-	 0.237769,  0.237676,  0.237582,  0.237489,  0.237396,  0.237303,  0.237210,  0.237117,
-	 0.237024,  0.236930,  0.236837,  0.236744,  0.236651,  0.236558,  0.236465,  0.236372,
-	 0.236278,  0.236185,  0.236092,  0.235999,  0.235906,  0.235813,  0.235719,  0.235626,
-	 0.235533,  0.235440,  0.235347,  0.235254,  0.235160,  0.235067,  0.234974,  0.234881,
-	 0.234788,  0.234694,  0.234601,  0.234508,  0.234415,  0.234322,  0.234228,  0.234135,
-	 0.234042,  0.233949,  0.233856,  0.233762,  0.233669,  0.233576,  0.233483,  0.233389,
-	 0.233296,  0.233203,  0.233110,  0.233017,  0.232923,  0.232830,  0.232737,  0.232644,
-	 0.232550,  0.232457,  0.232364,  0.232271,  0.232177,  0.232084,  0.231991,  0.231898,
-	 0.231804,  0.231711,  0.231618,  0.231524,  0.231431,  0.231338,  0.231245,  0.231151,
-	 0.231058,  0.230965,  0.230872,  0.230778,  0.230685,  0.230592,  0.230498,  0.230405,
-	 0.230312,  0.230218,  0.230125,  0.230032,  0.229939,  0.229845,  0.229752,  0.229659,
-	 0.229565,  0.229472,  0.229379,  0.229285,  0.229192,  0.229099,  0.229005,  0.228912,
-	 0.228819,  0.228725,  0.228632,  0.228539,  0.228445,  0.228352,  0.228259,  0.228165,
-	 0.228072,  0.227979,  0.227885,  0.227792,  0.227699,  0.227605,  0.227512,  0.227419,
-	 0.227325,  0.227232,  0.227139,  0.227045,  0.226952,  0.226858,  0.226765,  0.226672,
-	 0.226578,  0.226485,  0.226391,  0.226298,  0.226205,  0.226111,  0.226018,  0.225925,
-	 0.225831,  0.225738,  0.225644,  0.225551,  0.225458,  0.225364,  0.225271,  0.225177,
-	 0.225084,  0.224991,  0.224897,  0.224804,  0.224710,  0.224617,  0.224523,  0.224430,
-	 0.224337,  0.224243,  0.224150,  0.224056,  0.223963,  0.223869,  0.223776,  0.223682,
-	 0.223589,  0.223496,  0.223402,  0.223309,  0.223215,  0.223122,  0.223028,  0.222935,
-	 0.222841,  0.222748,  0.222654,  0.222561,  0.222468,  0.222374,  0.222281,  0.222187,
-	 0.222094,  0.222000,  0.221907,  0.221813,  0.221720,  0.221626,  0.221533,  0.221439,
-	 0.221346,  0.221252,  0.221159,  0.221065,  0.220972,  0.220878,  0.220785,  0.220691,
-	 0.220598,  0.220504,  0.220411,  0.220317,  0.220224,  0.220130,  0.220037,  0.219943,
-	 0.219850,  0.219756,  0.219662,  0.219569,  0.219475,  0.219382,  0.219288,  0.219195,
-	 0.219101,  0.219008,  0.218914,  0.218821,  0.218727,  0.218633,  0.218540,  0.218446,
-	 0.218353,  0.218259,  0.218166,  0.218072,  0.217979,  0.217885,  0.217791,  0.217698,
-	 0.217604,  0.217511,  0.217417,  0.217324,  0.217230,  0.217136,  0.217043,  0.216949,
-	 0.216856,  0.216762,  0.216668,  0.216575,  0.216481,  0.216388,  0.216294,  0.216200,
-	 0.216107,  0.216013,  0.215920,  0.215826,  0.215732,  0.215639,  0.215545,  0.215451,
-	 0.215358,  0.215264,  0.215171,  0.215077,  0.214983,  0.214890,  0.214796,  0.214702,
-	 0.214609,  0.214515,  0.214422,  0.214328,  0.214234,  0.214141,  0.214047,  0.213953,
-	 0.213860,  0.213766,  0.213672,  0.213579,  0.213485,  0.213391,  0.213298,  0.213204,
-	 0.213110,  0.213017,  0.212923,  0.212829,  0.212736,  0.212642,  0.212548,  0.212455,
-	 0.212361,  0.212267,  0.212174,  0.212080,  0.211986,  0.211892,  0.211799,  0.211705,
-	 0.211611,  0.211518,  0.211424,  0.211330,  0.211237,  0.211143,  0.211049,  0.210955,
-	 0.210862,  0.210768,  0.210674,  0.210580,  0.210487,  0.210393,  0.210299,  0.210206,
-	 0.210112,  0.210018,  0.209924,  0.209831,  0.209737,  0.209643,  0.209549,  0.209456,
-	 0.209362,  0.209268,  0.209174,  0.209081,  0.208987,  0.208893,  0.208799,  0.208706,
-	 0.208612,  0.208518,  0.208424,  0.208331,  0.208237,  0.208143,  0.208049,  0.207955,
-	 0.207862,  0.207768,  0.207674,  0.207580,  0.207487,  0.207393,  0.207299,  0.207205,
-	 0.207111,  0.207018,  0.206924,  0.206830,  0.206736,  0.206642,  0.206549,  0.206455,
-	 0.206361,  0.206267,  0.206173,  0.206080,  0.205986,  0.205892,  0.205798,  0.205704,
-	 0.205610,  0.205517,  0.205423,  0.205329,  0.205235,  0.205141,  0.205047,  0.204954,
-	 0.204860,  0.204766,  0.204672,  0.204578,  0.204484,  0.204391,  0.204297,  0.204203,
-	 0.204109,  0.204015,  0.203921,  0.203827,  0.203734,  0.203640,  0.203546,  0.203452,
-	 0.203358,  0.203264,  0.203170,  0.203076,  0.202983,  0.202889,  0.202795,  0.202701,
-	 0.202607,  0.202513,  0.202419,  0.202325,  0.202231,  0.202138,  0.202044,  0.201950,
-	 0.201856,  0.201762,  0.201668,  0.201574,  0.201480,  0.201386,  0.201292,  0.201199,
-	 0.201105,  0.201011,  0.200917,  0.200823,  0.200729,  0.200635,  0.200541,  0.200447,
-	 0.200353,  0.200259,  0.200165,  0.200071,  0.199978,  0.199884,  0.199790,  0.199696,
-	 0.199602,  0.199508,  0.199414,  0.199320,  0.199226,  0.199132,  0.199038,  0.198944,
-	 0.198850,  0.198756,  0.198662,  0.198568,  0.198474,  0.198380,  0.198286,  0.198192,
-	 0.198098,  0.198004,  0.197910,  0.197816,  0.197722,  0.197629,  0.197535,  0.197441,
-	 0.197347,  0.197253,  0.197159,  0.197065,  0.196971,  0.196877,  0.196783,  0.196689,
-	 0.196595,  0.196501,  0.196407,  0.196313,  0.196219,  0.196125,  0.196031,  0.195937,
-	 0.195843,  0.195748,  0.195654,  0.195560,  0.195466,  0.195372,  0.195278,  0.195184,
-	 0.195090,  0.194996,  0.194902,  0.194808,  0.194714,  0.194620,  0.194526,  0.194432,
-	 0.194338,  0.194244,  0.194150,  0.194056,  0.193962,  0.193868,  0.193774,  0.193680,
-	 0.193586,  0.193492,  0.193397,  0.193303,  0.193209,  0.193115,  0.193021,  0.192927,
-	 0.192833,  0.192739,  0.192645,  0.192551,  0.192457,  0.192363,  0.192269,  0.192174,
-	 0.192080,  0.191986,  0.191892,  0.191798,  0.191704,  0.191610,  0.191516,  0.191422,
-	 0.191328,  0.191234,  0.191139,  0.191045,  0.190951,  0.190857,  0.190763,  0.190669,
-	 0.190575,  0.190481,  0.190387,  0.190292,  0.190198,  0.190104,  0.190010,  0.189916,
-	 0.189822,  0.189728,  0.189634,  0.189539,  0.189445,  0.189351,  0.189257,  0.189163,
-	 0.189069,  0.188975,  0.188880,  0.188786,  0.188692,  0.188598,  0.188504,  0.188410,
-	 0.188315,  0.188221,  0.188127,  0.188033,  0.187939,  0.187845,  0.187750,  0.187656,
-	 0.187562,  0.187468,  0.187374,  0.187280,  0.187185,  0.187091,  0.186997,  0.186903,
-	 0.186809,  0.186715,  0.186620,  0.186526,  0.186432,  0.186338,  0.186244,  0.186149,
-	 0.186055,  0.185961,  0.185867,  0.185773,  0.185678,  0.185584,  0.185490,  0.185396,
-	 0.185301,  0.185207,  0.185113,  0.185019,  0.184925,  0.184830,  0.184736,  0.184642,
-	 0.184548,  0.184454,  0.184359,  0.184265,  0.184171,  0.184077,  0.183982,  0.183888,
-	 0.183794,  0.183700,  0.183605,  0.183511,  0.183417,  0.183323,  0.183228,  0.183134,
-	 0.183040,  0.182946,  0.182851,  0.182757,  0.182663,  0.182569,  0.182474,  0.182380,
-	 0.182286,  0.182192,  0.182097,  0.182003,  0.181909,  0.181814,  0.181720,  0.181626,
-	 0.181532,  0.181437,  0.181343,  0.181249,  0.181154,  0.181060,  0.180966,  0.180872,
-	 0.180777,  0.180683,  0.180589,  0.180494,  0.180400,  0.180306,  0.180212,  0.180117,
-	 0.180023,  0.179929,  0.179834,  0.179740,  0.179646,  0.179551,  0.179457,  0.179363,
-	 0.179268,  0.179174,  0.179080,  0.178985,  0.178891,  0.178797,  0.178702,  0.178608,
-	 0.178514,  0.178419,  0.178325,  0.178231,  0.178136,  0.178042,  0.177948,  0.177853,
-	 0.177759,  0.177665,  0.177570,  0.177476,  0.177382,  0.177287,  0.177193,  0.177099,
-	 0.177004,  0.176910,  0.176815,  0.176721,  0.176627,  0.176532,  0.176438,  0.176344,
-	 0.176249,  0.176155,  0.176061,  0.175966,  0.175872,  0.175777,  0.175683,  0.175589,
-	 0.175494,  0.175400,  0.175305,  0.175211,  0.175117,  0.175022,  0.174928,  0.174834,
-	 0.174739,  0.174645,  0.174550,  0.174456,  0.174362,  0.174267,  0.174173,  0.174078,
-	 0.173984,  0.173889,  0.173795,  0.173701,  0.173606,  0.173512,  0.173417,  0.173323,
-	 0.173229,  0.173134,  0.173040,  0.172945,  0.172851,  0.172756,  0.172662,  0.172568,
-	 0.172473,  0.172379,  0.172284,  0.172190,  0.172095,  0.172001,  0.171906,  0.171812,
-	 0.171718,  0.171623,  0.171529,  0.171434,  0.171340,  0.171245,  0.171151,  0.171056,
-	 0.170962,  0.170867,  0.170773,  0.170678,  0.170584,  0.170490,  0.170395,  0.170301,
-	 0.170206,  0.170112,  0.170017,  0.169923,  0.169828,  0.169734,  0.169639,  0.169545,
-	 0.169450,  0.169356,  0.169261,  0.169167,  0.169072,  0.168978,  0.168883,  0.168789,
-	 0.168694,  0.168600,  0.168505,  0.168411,  0.168316,  0.168222,  0.168127,  0.168033,
-	 0.167938,  0.167844,  0.167749,  0.167655,  0.167560,  0.167466,  0.167371,  0.167277,
-	 0.167182,  0.167088,  0.166993,  0.166899,  0.166804,  0.166710,  0.166615,  0.166520,
-	 0.166426,  0.166331,  0.166237,  0.166142,  0.166048,  0.165953,  0.165859,  0.165764,
-	 0.165670,  0.165575,  0.165480,  0.165386,  0.165291,  0.165197,  0.165102,  0.165008,
-	 0.164913,  0.164819,  0.164724,  0.164629,  0.164535,  0.164440,  0.164346,  0.164251,
-	 0.164157,  0.164062,  0.163967,  0.163873,  0.163778,  0.163684,  0.163589,  0.163495,
-	 0.163400,  0.163305,  0.163211,  0.163116,  0.163022,  0.162927,  0.162832,  0.162738,
-	 0.162643,  0.162549,  0.162454,  0.162359,  0.162265,  0.162170,  0.162076,  0.161981,
-	 0.161886,  0.161792,  0.161697,  0.161603,  0.161508,  0.161413,  0.161319,  0.161224,
-	 0.161129,  0.161035,  0.160940,  0.160846,  0.160751,  0.160656,  0.160562,  0.160467,
-	 0.160372,  0.160278,  0.160183,  0.160089,  0.159994,  0.159899,  0.159805,  0.159710,
-	 0.159615,  0.159521,  0.159426,  0.159331,  0.159237,  0.159142,  0.159047,  0.158953,
-	 0.158858,  0.158763,  0.158669,  0.158574,  0.158480,  0.158385,  0.158290,  0.158196,
-	 0.158101,  0.158006,  0.157912,  0.157817,  0.157722,  0.157627,  0.157533,  0.157438,
-	 0.157343,  0.157249,  0.157154,  0.157059,  0.156965,  0.156870,  0.156775,  0.156681,
-	 0.156586,  0.156491,  0.156397,  0.156302,  0.156207,  0.156112,  0.156018,  0.155923,
-	 0.155828,  0.155734,  0.155639,  0.155544,  0.155450,  0.155355,  0.155260,  0.155165,
-	 0.155071,  0.154976,  0.154881,  0.154787,  0.154692,  0.154597,  0.154502,  0.154408,
-	 0.154313,  0.154218,  0.154124,  0.154029,  0.153934,  0.153839,  0.153745,  0.153650,
-	 0.153555,  0.153460,  0.153366,  0.153271,  0.153176,  0.153081,  0.152987,  0.152892,
-	 0.152797,  0.152702,  0.152608,  0.152513,  0.152418,  0.152323,  0.152229,  0.152134,
-	 0.152039,  0.151944,  0.151850,  0.151755,  0.151660,  0.151565,  0.151471,  0.151376,
-	 0.151281,  0.151186,  0.151092,  0.150997,  0.150902,  0.150807,  0.150712,  0.150618,
-	 0.150523,  0.150428,  0.150333,  0.150238,  0.150144,  0.150049,  0.149954,  0.149859,
-	 0.149765,  0.149670,  0.149575,  0.149480,  0.149385,  0.149291,  0.149196,  0.149101,
-	 0.149006,  0.148911,  0.148817,  0.148722,  0.148627,  0.148532,  0.148437,  0.148342,
-	 0.148248,  0.148153,  0.148058,  0.147963,  0.147868,  0.147774,  0.147679,  0.147584,
-	 0.147489,  0.147394,  0.147299,  0.147205,  0.147110,  0.147015,  0.146920,  0.146825,
-	 0.146730,  0.146636,  0.146541,  0.146446,  0.146351,  0.146256,  0.146161,  0.146067,
-	 0.145972,  0.145877,  0.145782,  0.145687,  0.145592,  0.145497,  0.145403,  0.145308,
-	 0.145213,  0.145118,  0.145023,  0.144928,  0.144833,  0.144739,  0.144644,  0.144549,
-	 0.144454,  0.144359,  0.144264,  0.144169,  0.144075,  0.143980,  0.143885,  0.143790,
-	 0.143695,  0.143600,  0.143505,  0.143410,  0.143316,  0.143221,  0.143126,  0.143031,
-	 0.142936,  0.142841,  0.142746,  0.142651,  0.142556,  0.142461,  0.142367,  0.142272,
-	 0.142177,  0.142082,  0.141987,  0.141892,  0.141797,  0.141702,  0.141607,  0.141512,
-	 0.141418,  0.141323,  0.141228,  0.141133,  0.141038,  0.140943,  0.140848,  0.140753,
-	 0.140658,  0.140563,  0.140468,  0.140373,  0.140279,  0.140184,  0.140089,  0.139994,
-	 0.139899,  0.139804,  0.139709,  0.139614,  0.139519,  0.139424,  0.139329,  0.139234,
-	 0.139139,  0.139044,  0.138949,  0.138855,  0.138760,  0.138665,  0.138570,  0.138475,
-	 0.138380,  0.138285,  0.138190,  0.138095,  0.138000,  0.137905,  0.137810,  0.137715,
-	 0.137620,  0.137525,  0.137430,  0.137335,  0.137240,  0.137145,  0.137050,  0.136955,
-	 0.136860,  0.136765,  0.136670,  0.136575,  0.136480,  0.136386,  0.136291,  0.136196,
-	 0.136101,  0.136006,  0.135911,  0.135816,  0.135721,  0.135626,  0.135531,  0.135436,
-	 0.135341,  0.135246,  0.135151,  0.135056,  0.134961,  0.134866,  0.134771,  0.134676,
-	 0.134581,  0.134486,  0.134391,  0.134296,  0.134201,  0.134106,  0.134011,  0.133916,
-	 0.133821,  0.133726,  0.133631,  0.133536,  0.133441,  0.133346,  0.133251,  0.133156,
-	 0.133061,  0.132966,  0.132870,  0.132775,  0.132680,  0.132585,  0.132490,  0.132395,
-	 0.132300,  0.132205,  0.132110,  0.132015,  0.131920,  0.131825,  0.131730,  0.131635,
-	 0.131540,  0.131445,  0.131350,  0.131255,  0.131160,  0.131065,  0.130970,  0.130875,
-	 0.130780,  0.130685,  0.130590,  0.130495,  0.130399,  0.130304,  0.130209,  0.130114,
-	 0.130019,  0.129924,  0.129829,  0.129734,  0.129639,  0.129544,  0.129449,  0.129354,
-	 0.129259,  0.129164,  0.129069,  0.128973,  0.128878,  0.128783,  0.128688,  0.128593,
-	 0.128498,  0.128403,  0.128308,  0.128213,  0.128118,  0.128023,  0.127928,  0.127833,
-	 0.127737,  0.127642,  0.127547,  0.127452,  0.127357,  0.127262,  0.127167,  0.127072,
-	 0.126977,  0.126882,  0.126787,  0.126691,  0.126596,  0.126501,  0.126406,  0.126311,
-	 0.126216,  0.126121,  0.126026,  0.125931,  0.125835,  0.125740,  0.125645,  0.125550,
-	 0.125455,  0.125360,  0.125265,  0.125170,  0.125075,  0.124979,  0.124884,  0.124789,
-	 0.124694,  0.124599,  0.124504,  0.124409,  0.124314,  0.124218,  0.124123,  0.124028,
-	 0.123933,  0.123838,  0.123743,  0.123648,  0.123552,  0.123457,  0.123362,  0.123267,
-	 0.123172,  0.123077,  0.122982,  0.122886,  0.122791,  0.122696,  0.122601,  0.122506,
-	 0.122411,  0.122316,  0.122220,  0.122125,  0.122030,  0.121935,  0.121840,  0.121745,
-	 0.121649,  0.121554,  0.121459,  0.121364,  0.121269,  0.121174,  0.121078,  0.120983,
-	 0.120888,  0.120793,  0.120698,  0.120603,  0.120507,  0.120412,  0.120317,  0.120222,
-	 0.120127,  0.120032,  0.119936,  0.119841,  0.119746,  0.119651,  0.119556,  0.119460,
-	 0.119365,  0.119270,  0.119175,  0.119080,  0.118984,  0.118889,  0.118794,  0.118699,
-	 0.118604,  0.118508,  0.118413,  0.118318,  0.118223,  0.118128,  0.118032,  0.117937,
-	 0.117842,  0.117747,  0.117652,  0.117556,  0.117461,  0.117366,  0.117271,  0.117176,
-	 0.117080,  0.116985,  0.116890,  0.116795,  0.116700,  0.116604,  0.116509,  0.116414,
-	 0.116319,  0.116223,  0.116128,  0.116033,  0.115938,  0.115842,  0.115747,  0.115652,
-	 0.115557,  0.115462,  0.115366,  0.115271,  0.115176,  0.115081,  0.114985,  0.114890,
-	 0.114795,  0.114700,  0.114604,  0.114509,  0.114414,  0.114319,  0.114223,  0.114128,
-	 0.114033,  0.113938,  0.113842,  0.113747,  0.113652,  0.113557,  0.113461,  0.113366,
-	 0.113271,  0.113176,  0.113080,  0.112985,  0.112890,  0.112795,  0.112699,  0.112604,
-	 0.112509,  0.112414,  0.112318,  0.112223,  0.112128,  0.112033,  0.111937,  0.111842,
-	 0.111747,  0.111651,  0.111556,  0.111461,  0.111366,  0.111270,  0.111175,  0.111080,
-	 0.110984,  0.110889,  0.110794,  0.110699,  0.110603,  0.110508,  0.110413,  0.110317,
-	 0.110222,  0.110127,  0.110032,  0.109936,  0.109841,  0.109746,  0.109650,  0.109555,
-	 0.109460,  0.109365,  0.109269,  0.109174,  0.109079,  0.108983,  0.108888,  0.108793,
-	 0.108697,  0.108602,  0.108507,  0.108412,  0.108316,  0.108221,  0.108126,  0.108030,
-	 0.107935,  0.107840,  0.107744,  0.107649,  0.107554,  0.107458,  0.107363,  0.107268,
-	 0.107172,  0.107077,  0.106982,  0.106886,  0.106791,  0.106696,  0.106600,  0.106505,
-	 0.106410,  0.106314,  0.106219,  0.106124,  0.106028,  0.105933,  0.105838,  0.105742,
-	 0.105647,  0.105552,  0.105456,  0.105361,  0.105266,  0.105170,  0.105075,  0.104980,
-	 0.104884,  0.104789,  0.104694,  0.104598,  0.104503,  0.104408,  0.104312,  0.104217,
-	 0.104122,  0.104026,  0.103931,  0.103836,  0.103740,  0.103645,  0.103550,  0.103454,
-	 0.103359,  0.103263,  0.103168,  0.103073,  0.102977,  0.102882,  0.102787,  0.102691,
-	 0.102596,  0.102500,  0.102405,  0.102310,  0.102214,  0.102119,  0.102024,  0.101928,
-	 0.101833,  0.101738,  0.101642,  0.101547,  0.101451,  0.101356,  0.101261,  0.101165,
-	 0.101070,  0.100974,  0.100879,  0.100784,  0.100688,  0.100593,  0.100498,  0.100402,
-	 0.100307,  0.100211,  0.100116,  0.100021,  0.099925,  0.099830,  0.099734,  0.099639,
-	 0.099544,  0.099448,  0.099353,  0.099257,  0.099162,  0.099067,  0.098971,  0.098876,
-	 0.098780,  0.098685,  0.098590,  0.098494,  0.098399,  0.098303,  0.098208,  0.098113,
-	 0.098017,  0.097922,  0.097826,  0.097731,  0.097635,  0.097540,  0.097445,  0.097349,
-	 0.097254,  0.097158,  0.097063,  0.096968,  0.096872,  0.096777,  0.096681,  0.096586,
-	 0.096490,  0.096395,  0.096300,  0.096204,  0.096109,  0.096013,  0.095918,  0.095822,
-	 0.095727,  0.095632,  0.095536,  0.095441,  0.095345,  0.095250,  0.095154,  0.095059,
-	 0.094963,  0.094868,  0.094773,  0.094677,  0.094582,  0.094486,  0.094391,  0.094295,
-	 0.094200,  0.094104,  0.094009,  0.093914,  0.093818,  0.093723,  0.093627,  0.093532,
-	 0.093436,  0.093341,  0.093245,  0.093150,  0.093055,  0.092959,  0.092864,  0.092768,
-	 0.092673,  0.092577,  0.092482,  0.092386,  0.092291,  0.092195,  0.092100,  0.092004,
-	 0.091909,  0.091813,  0.091718,  0.091623,  0.091527,  0.091432,  0.091336,  0.091241,
-	 0.091145,  0.091050,  0.090954,  0.090859,  0.090763,  0.090668,  0.090572,  0.090477,
-	 0.090381,  0.090286,  0.090190,  0.090095,  0.089999,  0.089904,  0.089808,  0.089713,
-	 0.089617,  0.089522,  0.089427,  0.089331,  0.089236,  0.089140,  0.089045,  0.088949,
-	 0.088854,  0.088758,  0.088663,  0.088567,  0.088472,  0.088376,  0.088281,  0.088185,
-	 0.088090,  0.087994,  0.087899,  0.087803,  0.087708,  0.087612,  0.087517,  0.087421,
-	 0.087326,  0.087230,  0.087135,  0.087039,  0.086943,  0.086848,  0.086752,  0.086657,
-	 0.086561,  0.086466,  0.086370,  0.086275,  0.086179,  0.086084,  0.085988,  0.085893,
-	 0.085797,  0.085702,  0.085606,  0.085511,  0.085415,  0.085320,  0.085224,  0.085129,
-	 0.085033,  0.084938,  0.084842,  0.084747,  0.084651,  0.084555,  0.084460,  0.084364,
-	 0.084269,  0.084173,  0.084078,  0.083982,  0.083887,  0.083791,  0.083696,  0.083600,
-	 0.083505,  0.083409,  0.083314,  0.083218,  0.083122,  0.083027,  0.082931,  0.082836,
-	 0.082740,  0.082645,  0.082549,  0.082454,  0.082358,  0.082263,  0.082167,  0.082071,
-	 0.081976,  0.081880,  0.081785,  0.081689,  0.081594,  0.081498,  0.081403,  0.081307,
-	 0.081211,  0.081116,  0.081020,  0.080925,  0.080829,  0.080734,  0.080638,  0.080543,
-	 0.080447,  0.080351,  0.080256,  0.080160,  0.080065,  0.079969,  0.079874,  0.079778,
-	 0.079682,  0.079587,  0.079491,  0.079396,  0.079300,  0.079205,  0.079109,  0.079013,
-	 0.078918,  0.078822,  0.078727,  0.078631,  0.078536,  0.078440,  0.078344,  0.078249,
-	 0.078153,  0.078058,  0.077962,  0.077866,  0.077771,  0.077675,  0.077580,  0.077484,
-	 0.077389,  0.077293,  0.077197,  0.077102,  0.077006,  0.076911,  0.076815,  0.076719,
-	 0.076624,  0.076528,  0.076433,  0.076337,  0.076241,  0.076146,  0.076050,  0.075955,
-	 0.075859,  0.075764,  0.075668,  0.075572,  0.075477,  0.075381,  0.075286,  0.075190,
-	 0.075094,  0.074999,  0.074903,  0.074807,  0.074712,  0.074616,  0.074521,  0.074425,
-	 0.074329,  0.074234,  0.074138,  0.074043,  0.073947,  0.073851,  0.073756,  0.073660,
-	 0.073565,  0.073469,  0.073373,  0.073278,  0.073182,  0.073086,  0.072991,  0.072895,
-	 0.072800,  0.072704,  0.072608,  0.072513,  0.072417,  0.072322,  0.072226,  0.072130,
-	 0.072035,  0.071939,  0.071843,  0.071748,  0.071652,  0.071557,  0.071461,  0.071365,
-	 0.071270,  0.071174,  0.071078,  0.070983,  0.070887,  0.070791,  0.070696,  0.070600,
-	 0.070505,  0.070409,  0.070313,  0.070218,  0.070122,  0.070026,  0.069931,  0.069835,
-	 0.069739,  0.069644,  0.069548,  0.069453,  0.069357,  0.069261,  0.069166,  0.069070,
-	 0.068974,  0.068879,  0.068783,  0.068687,  0.068592,  0.068496,  0.068400,  0.068305,
-	 0.068209,  0.068113,  0.068018,  0.067922,  0.067827,  0.067731,  0.067635,  0.067540,
-	 0.067444,  0.067348,  0.067253,  0.067157,  0.067061,  0.066966,  0.066870,  0.066774,
-	 0.066679,  0.066583,  0.066487,  0.066392,  0.066296,  0.066200,  0.066105,  0.066009,
-	 0.065913,  0.065818,  0.065722,  0.065626,  0.065531,  0.065435,  0.065339,  0.065244,
-	 0.065148,  0.065052,  0.064957,  0.064861,  0.064765,  0.064670,  0.064574,  0.064478,
-	 0.064383,  0.064287,  0.064191,  0.064096,  0.064000,  0.063904,  0.063809,  0.063713,
-	 0.063617,  0.063522,  0.063426,  0.063330,  0.063234,  0.063139,  0.063043,  0.062947,
-	 0.062852,  0.062756,  0.062660,  0.062565,  0.062469,  0.062373,  0.062278,  0.062182,
-	 0.062086,  0.061991,  0.061895,  0.061799,  0.061704,  0.061608,  0.061512,  0.061416,
-	 0.061321,  0.061225,  0.061129,  0.061034,  0.060938,  0.060842,  0.060747,  0.060651,
-	 0.060555,  0.060459,  0.060364,  0.060268,  0.060172,  0.060077,  0.059981,  0.059885,
-	 0.059790,  0.059694,  0.059598,  0.059502,  0.059407,  0.059311,  0.059215,  0.059120,
-	 0.059024,  0.058928,  0.058833,  0.058737,  0.058641,  0.058545,  0.058450,  0.058354,
-	 0.058258,  0.058163,  0.058067,  0.057971,  0.057875,  0.057780,  0.057684,  0.057588,
-	 0.057493,  0.057397,  0.057301,  0.057205,  0.057110,  0.057014,  0.056918,  0.056823,
-	 0.056727,  0.056631,  0.056535,  0.056440,  0.056344,  0.056248,  0.056152,  0.056057,
-	 0.055961,  0.055865,  0.055770,  0.055674,  0.055578,  0.055482,  0.055387,  0.055291,
-	 0.055195,  0.055100,  0.055004,  0.054908,  0.054812,  0.054717,  0.054621,  0.054525,
-	 0.054429,  0.054334,  0.054238,  0.054142,  0.054046,  0.053951,  0.053855,  0.053759,
-	 0.053664,  0.053568,  0.053472,  0.053376,  0.053281,  0.053185,  0.053089,  0.052993,
-	 0.052898,  0.052802,  0.052706,  0.052610,  0.052515,  0.052419,  0.052323,  0.052227,
-	 0.052132,  0.052036,  0.051940,  0.051844,  0.051749,  0.051653,  0.051557,  0.051461,
-	 0.051366,  0.051270,  0.051174,  0.051078,  0.050983,  0.050887,  0.050791,  0.050696,
-	 0.050600,  0.050504,  0.050408,  0.050312,  0.050217,  0.050121,  0.050025,  0.049929,
-	 0.049834,  0.049738,  0.049642,  0.049546,  0.049451,  0.049355,  0.049259,  0.049163,
-	 0.049068,  0.048972,  0.048876,  0.048780,  0.048685,  0.048589,  0.048493,  0.048397,
-	 0.048302,  0.048206,  0.048110,  0.048014,  0.047919,  0.047823,  0.047727,  0.047631,
-	 0.047535,  0.047440,  0.047344,  0.047248,  0.047152,  0.047057,  0.046961,  0.046865,
-	 0.046769,  0.046674,  0.046578,  0.046482,  0.046386,  0.046290,  0.046195,  0.046099,
-	 0.046003,  0.045907,  0.045812,  0.045716,  0.045620,  0.045524,  0.045429,  0.045333,
-	 0.045237,  0.045141,  0.045045,  0.044950,  0.044854,  0.044758,  0.044662,  0.044567,
-	 0.044471,  0.044375,  0.044279,  0.044183,  0.044088,  0.043992,  0.043896,  0.043800,
-	 0.043705,  0.043609,  0.043513,  0.043417,  0.043321,  0.043226,  0.043130,  0.043034,
-	 0.042938,  0.042842,  0.042747,  0.042651,  0.042555,  0.042459,  0.042364,  0.042268,
-	 0.042172,  0.042076,  0.041980,  0.041885,  0.041789,  0.041693,  0.041597,  0.041501,
-	 0.041406,  0.041310,  0.041214,  0.041118,  0.041022,  0.040927,  0.040831,  0.040735,
-	 0.040639,  0.040544,  0.040448,  0.040352,  0.040256,  0.040160,  0.040065,  0.039969,
-	 0.039873,  0.039777,  0.039681,  0.039586,  0.039490,  0.039394,  0.039298,  0.039202,
-	 0.039107,  0.039011,  0.038915,  0.038819,  0.038723,  0.038628,  0.038532,  0.038436,
-	 0.038340,  0.038244,  0.038149,  0.038053,  0.037957,  0.037861,  0.037765,  0.037669,
-	 0.037574,  0.037478,  0.037382,  0.037286,  0.037190,  0.037095,  0.036999,  0.036903,
-	 0.036807,  0.036711,  0.036616,  0.036520,  0.036424,  0.036328,  0.036232,  0.036137,
-	 0.036041,  0.035945,  0.035849,  0.035753,  0.035657,  0.035562,  0.035466,  0.035370,
-	 0.035274,  0.035178,  0.035083,  0.034987,  0.034891,  0.034795,  0.034699,  0.034604,
-	 0.034508,  0.034412,  0.034316,  0.034220,  0.034124,  0.034029,  0.033933,  0.033837,
-	 0.033741,  0.033645,  0.033550,  0.033454,  0.033358,  0.033262,  0.033166,  0.033070,
-	 0.032975,  0.032879,  0.032783,  0.032687,  0.032591,  0.032495,  0.032400,  0.032304,
-	 0.032208,  0.032112,  0.032016,  0.031921,  0.031825,  0.031729,  0.031633,  0.031537,
-	 0.031441,  0.031346,  0.031250,  0.031154,  0.031058,  0.030962,  0.030866,  0.030771,
-	 0.030675,  0.030579,  0.030483,  0.030387,  0.030291,  0.030196,  0.030100,  0.030004,
-	 0.029908,  0.029812,  0.029717,  0.029621,  0.029525,  0.029429,  0.029333,  0.029237,
-	 0.029142,  0.029046,  0.028950,  0.028854,  0.028758,  0.028662,  0.028567,  0.028471,
-	 0.028375,  0.028279,  0.028183,  0.028087,  0.027991,  0.027896,  0.027800,  0.027704,
-	 0.027608,  0.027512,  0.027416,  0.027321,  0.027225,  0.027129,  0.027033,  0.026937,
-	 0.026841,  0.026746,  0.026650,  0.026554,  0.026458,  0.026362,  0.026266,  0.026171,
-	 0.026075,  0.025979,  0.025883,  0.025787,  0.025691,  0.025596,  0.025500,  0.025404,
-	 0.025308,  0.025212,  0.025116,  0.025020,  0.024925,  0.024829,  0.024733,  0.024637,
-	 0.024541,  0.024445,  0.024350,  0.024254,  0.024158,  0.024062,  0.023966,  0.023870,
-	 0.023774,  0.023679,  0.023583,  0.023487,  0.023391,  0.023295,  0.023199,  0.023104,
-	 0.023008,  0.022912,  0.022816,  0.022720,  0.022624,  0.022528,  0.022433,  0.022337,
-	 0.022241,  0.022145,  0.022049,  0.021953,  0.021857,  0.021762,  0.021666,  0.021570,
-	 0.021474,  0.021378,  0.021282,  0.021187,  0.021091,  0.020995,  0.020899,  0.020803,
-	 0.020707,  0.020611,  0.020516,  0.020420,  0.020324,  0.020228,  0.020132,  0.020036,
-	 0.019940,  0.019845,  0.019749,  0.019653,  0.019557,  0.019461,  0.019365,  0.019269,
-	 0.019174,  0.019078,  0.018982,  0.018886,  0.018790,  0.018694,  0.018598,  0.018503,
-	 0.018407,  0.018311,  0.018215,  0.018119,  0.018023,  0.017927,  0.017832,  0.017736,
-	 0.017640,  0.017544,  0.017448,  0.017352,  0.017256,  0.017161,  0.017065,  0.016969,
-	 0.016873,  0.016777,  0.016681,  0.016585,  0.016490,  0.016394,  0.016298,  0.016202,
-	 0.016106,  0.016010,  0.015914,  0.015819,  0.015723,  0.015627,  0.015531,  0.015435,
-	 0.015339,  0.015243,  0.015147,  0.015052,  0.014956,  0.014860,  0.014764,  0.014668,
-	 0.014572,  0.014476,  0.014381,  0.014285,  0.014189,  0.014093,  0.013997,  0.013901,
-	 0.013805,  0.013710,  0.013614,  0.013518,  0.013422,  0.013326,  0.013230,  0.013134,
-	 0.013038,  0.012943,  0.012847,  0.012751,  0.012655,  0.012559,  0.012463,  0.012367,
-	 0.012272,  0.012176,  0.012080,  0.011984,  0.011888,  0.011792,  0.011696,  0.011600,
-	 0.011505,  0.011409,  0.011313,  0.011217,  0.011121,  0.011025,  0.010929,  0.010834,
-	 0.010738,  0.010642,  0.010546,  0.010450,  0.010354,  0.010258,  0.010162,  0.010067,
-	 0.009971,  0.009875,  0.009779,  0.009683,  0.009587,  0.009491,  0.009395,  0.009300,
-	 0.009204,  0.009108,  0.009012,  0.008916,  0.008820,  0.008724,  0.008629,  0.008533,
-	 0.008437,  0.008341,  0.008245,  0.008149,  0.008053,  0.007957,  0.007862,  0.007766,
-	 0.007670,  0.007574,  0.007478,  0.007382,  0.007286,  0.007190,  0.007095,  0.006999,
-	 0.006903,  0.006807,  0.006711,  0.006615,  0.006519,  0.006424,  0.006328,  0.006232,
-	 0.006136,  0.006040,  0.005944,  0.005848,  0.005752,  0.005657,  0.005561,  0.005465,
-	 0.005369,  0.005273,  0.005177,  0.005081,  0.004985,  0.004890,  0.004794,  0.004698,
-	 0.004602,  0.004506,  0.004410,  0.004314,  0.004218,  0.004123,  0.004027,  0.003931,
-	 0.003835,  0.003739,  0.003643,  0.003547,  0.003451,  0.003356,  0.003260,  0.003164,
-	 0.003068,  0.002972,  0.002876,  0.002780,  0.002684,  0.002589,  0.002493,  0.002397,
-	 0.002301,  0.002205,  0.002109,  0.002013,  0.001917,  0.001822,  0.001726,  0.001630,
-	 0.001534,  0.001438,  0.001342,  0.001246,  0.001150,  0.001055,  0.000959,  0.000863,
-	 0.000767,  0.000671,  0.000575,  0.000479,  0.000383,  0.000288,  0.000192,  0.000096,
-	 0.000000,  0.000096,  0.000192,  0.000288,  0.000383,  0.000479,  0.000575,  0.000671,
-	 0.000767,  0.000863,  0.000959,  0.001055,  0.001150,  0.001246,  0.001342,  0.001438,
-	 0.001534,  0.001630,  0.001726,  0.001822,  0.001917,  0.002013,  0.002109,  0.002205,
-	 0.002301,  0.002397,  0.002493,  0.002589,  0.002684,  0.002780,  0.002876,  0.002972,
-	 0.003068,  0.003164,  0.003260,  0.003356,  0.003451,  0.003547,  0.003643,  0.003739,
-	 0.003835,  0.003931,  0.004027,  0.004123,  0.004218,  0.004314,  0.004410,  0.004506,
-	 0.004602,  0.004698,  0.004794,  0.004890,  0.004985,  0.005081,  0.005177,  0.005273,
-	 0.005369,  0.005465,  0.005561,  0.005657,  0.005752,  0.005848,  0.005944,  0.006040,
-	 0.006136,  0.006232,  0.006328,  0.006424,  0.006519,  0.006615,  0.006711,  0.006807,
-	 0.006903,  0.006999,  0.007095,  0.007190,  0.007286,  0.007382,  0.007478,  0.007574,
-	 0.007670,  0.007766,  0.007862,  0.007957,  0.008053,  0.008149,  0.008245,  0.008341,
-	 0.008437,  0.008533,  0.008629,  0.008724,  0.008820,  0.008916,  0.009012,  0.009108,
-	 0.009204,  0.009300,  0.009395,  0.009491,  0.009587,  0.009683,  0.009779,  0.009875,
-	 0.009971,  0.010067,  0.010162,  0.010258,  0.010354,  0.010450,  0.010546,  0.010642,
-	 0.010738,  0.010834,  0.010929,  0.011025,  0.011121,  0.011217,  0.011313,  0.011409,
-	 0.011505,  0.011600,  0.011696,  0.011792,  0.011888,  0.011984,  0.012080,  0.012176,
-	 0.012272,  0.012367,  0.012463,  0.012559,  0.012655,  0.012751,  0.012847,  0.012943,
-	 0.013038,  0.013134,  0.013230,  0.013326,  0.013422,  0.013518,  0.013614,  0.013710,
-	 0.013805,  0.013901,  0.013997,  0.014093,  0.014189,  0.014285,  0.014381,  0.014476,
-	 0.014572,  0.014668,  0.014764,  0.014860,  0.014956,  0.015052,  0.015147,  0.015243,
-	 0.015339,  0.015435,  0.015531,  0.015627,  0.015723,  0.015819,  0.015914,  0.016010,
-	 0.016106,  0.016202,  0.016298,  0.016394,  0.016490,  0.016585,  0.016681,  0.016777,
-	 0.016873,  0.016969,  0.017065,  0.017161,  0.017256,  0.017352,  0.017448,  0.017544,
-	 0.017640,  0.017736,  0.017832,  0.017927,  0.018023,  0.018119,  0.018215,  0.018311,
-	 0.018407,  0.018503,  0.018598,  0.018694,  0.018790,  0.018886,  0.018982,  0.019078,
-	 0.019174,  0.019269,  0.019365,  0.019461,  0.019557,  0.019653,  0.019749,  0.019845,
-	 0.019940,  0.020036,  0.020132,  0.020228,  0.020324,  0.020420,  0.020516,  0.020611,
-	 0.020707,  0.020803,  0.020899,  0.020995,  0.021091,  0.021187,  0.021282,  0.021378,
-	 0.021474,  0.021570,  0.021666,  0.021762,  0.021857,  0.021953,  0.022049,  0.022145,
-	 0.022241,  0.022337,  0.022433,  0.022528,  0.022624,  0.022720,  0.022816,  0.022912,
-	 0.023008,  0.023104,  0.023199,  0.023295,  0.023391,  0.023487,  0.023583,  0.023679,
-	 0.023774,  0.023870,  0.023966,  0.024062,  0.024158,  0.024254,  0.024350,  0.024445,
-	 0.024541,  0.024637,  0.024733,  0.024829,  0.024925,  0.025020,  0.025116,  0.025212,
-	 0.025308,  0.025404,  0.025500,  0.025596,  0.025691,  0.025787,  0.025883,  0.025979,
-	 0.026075,  0.026171,  0.026266,  0.026362,  0.026458,  0.026554,  0.026650,  0.026746,
-	 0.026841,  0.026937,  0.027033,  0.027129,  0.027225,  0.027321,  0.027416,  0.027512,
-	 0.027608,  0.027704,  0.027800,  0.027896,  0.027991,  0.028087,  0.028183,  0.028279,
-	 0.028375,  0.028471,  0.028567,  0.028662,  0.028758,  0.028854,  0.028950,  0.029046,
-	 0.029142,  0.029237,  0.029333,  0.029429,  0.029525,  0.029621,  0.029717,  0.029812,
-	 0.029908,  0.030004,  0.030100,  0.030196,  0.030291,  0.030387,  0.030483,  0.030579,
-	 0.030675,  0.030771,  0.030866,  0.030962,  0.031058,  0.031154,  0.031250,  0.031346,
-	 0.031441,  0.031537,  0.031633,  0.031729,  0.031825,  0.031921,  0.032016,  0.032112,
-	 0.032208,  0.032304,  0.032400,  0.032495,  0.032591,  0.032687,  0.032783,  0.032879,
-	 0.032975,  0.033070,  0.033166,  0.033262,  0.033358,  0.033454,  0.033550,  0.033645,
-	 0.033741,  0.033837,  0.033933,  0.034029,  0.034124,  0.034220,  0.034316,  0.034412,
-	 0.034508,  0.034604,  0.034699,  0.034795,  0.034891,  0.034987,  0.035083,  0.035178,
-	 0.035274,  0.035370,  0.035466,  0.035562,  0.035657,  0.035753,  0.035849,  0.035945,
-	 0.036041,  0.036137,  0.036232,  0.036328,  0.036424,  0.036520,  0.036616,  0.036711,
-	 0.036807,  0.036903,  0.036999,  0.037095,  0.037190,  0.037286,  0.037382,  0.037478,
-	 0.037574,  0.037669,  0.037765,  0.037861,  0.037957,  0.038053,  0.038149,  0.038244,
-	 0.038340,  0.038436,  0.038532,  0.038628,  0.038723,  0.038819,  0.038915,  0.039011,
-	 0.039107,  0.039202,  0.039298,  0.039394,  0.039490,  0.039586,  0.039681,  0.039777,
-	 0.039873,  0.039969,  0.040065,  0.040160,  0.040256,  0.040352,  0.040448,  0.040544,
-	 0.040639,  0.040735,  0.040831,  0.040927,  0.041022,  0.041118,  0.041214,  0.041310,
-	 0.041406,  0.041501,  0.041597,  0.041693,  0.041789,  0.041885,  0.041980,  0.042076,
-	 0.042172,  0.042268,  0.042364,  0.042459,  0.042555,  0.042651,  0.042747,  0.042842,
-	 0.042938,  0.043034,  0.043130,  0.043226,  0.043321,  0.043417,  0.043513,  0.043609,
-	 0.043705,  0.043800,  0.043896,  0.043992,  0.044088,  0.044183,  0.044279,  0.044375,
-	 0.044471,  0.044567,  0.044662,  0.044758,  0.044854,  0.044950,  0.045045,  0.045141,
-	 0.045237,  0.045333,  0.045429,  0.045524,  0.045620,  0.045716,  0.045812,  0.045907,
-	 0.046003,  0.046099,  0.046195,  0.046290,  0.046386,  0.046482,  0.046578,  0.046674,
-	 0.046769,  0.046865,  0.046961,  0.047057,  0.047152,  0.047248,  0.047344,  0.047440,
-	 0.047535,  0.047631,  0.047727,  0.047823,  0.047919,  0.048014,  0.048110,  0.048206,
-	 0.048302,  0.048397,  0.048493,  0.048589,  0.048685,  0.048780,  0.048876,  0.048972,
-	 0.049068,  0.049163,  0.049259,  0.049355,  0.049451,  0.049546,  0.049642,  0.049738,
-	 0.049834,  0.049929,  0.050025,  0.050121,  0.050217,  0.050312,  0.050408,  0.050504,
-	 0.050600,  0.050696,  0.050791,  0.050887,  0.050983,  0.051078,  0.051174,  0.051270,
-	 0.051366,  0.051461,  0.051557,  0.051653,  0.051749,  0.051844,  0.051940,  0.052036,
-	 0.052132,  0.052227,  0.052323,  0.052419,  0.052515,  0.052610,  0.052706,  0.052802,
-	 0.052898,  0.052993,  0.053089,  0.053185,  0.053281,  0.053376,  0.053472,  0.053568,
-	 0.053664,  0.053759,  0.053855,  0.053951,  0.054046,  0.054142,  0.054238,  0.054334,
-	 0.054429,  0.054525,  0.054621,  0.054717,  0.054812,  0.054908,  0.055004,  0.055100,
-	 0.055195,  0.055291,  0.055387,  0.055482,  0.055578,  0.055674,  0.055770,  0.055865,
-	 0.055961,  0.056057,  0.056152,  0.056248,  0.056344,  0.056440,  0.056535,  0.056631,
-	 0.056727,  0.056823,  0.056918,  0.057014,  0.057110,  0.057205,  0.057301,  0.057397,
-	 0.057493,  0.057588,  0.057684,  0.057780,  0.057875,  0.057971,  0.058067,  0.058163,
-	 0.058258,  0.058354,  0.058450,  0.058545,  0.058641,  0.058737,  0.058833,  0.058928,
-	 0.059024,  0.059120,  0.059215,  0.059311,  0.059407,  0.059502,  0.059598,  0.059694,
-	 0.059790,  0.059885,  0.059981,  0.060077,  0.060172,  0.060268,  0.060364,  0.060459,
-	 0.060555,  0.060651,  0.060747,  0.060842,  0.060938,  0.061034,  0.061129,  0.061225,
-	 0.061321,  0.061416,  0.061512,  0.061608,  0.061704,  0.061799,  0.061895,  0.061991,
-	 0.062086,  0.062182,  0.062278,  0.062373,  0.062469,  0.062565,  0.062660,  0.062756,
-	 0.062852,  0.062947,  0.063043,  0.063139,  0.063234,  0.063330,  0.063426,  0.063522,
-	 0.063617,  0.063713,  0.063809,  0.063904,  0.064000,  0.064096,  0.064191,  0.064287,
-	 0.064383,  0.064478,  0.064574,  0.064670,  0.064765,  0.064861,  0.064957,  0.065052,
-	 0.065148,  0.065244,  0.065339,  0.065435,  0.065531,  0.065626,  0.065722,  0.065818,
-	 0.065913,  0.066009,  0.066105,  0.066200,  0.066296,  0.066392,  0.066487,  0.066583,
-	 0.066679,  0.066774,  0.066870,  0.066966,  0.067061,  0.067157,  0.067253,  0.067348,
-	 0.067444,  0.067540,  0.067635,  0.067731,  0.067827,  0.067922,  0.068018,  0.068113,
-	 0.068209,  0.068305,  0.068400,  0.068496,  0.068592,  0.068687,  0.068783,  0.068879,
-	 0.068974,  0.069070,  0.069166,  0.069261,  0.069357,  0.069453,  0.069548,  0.069644,
-	 0.069739,  0.069835,  0.069931,  0.070026,  0.070122,  0.070218,  0.070313,  0.070409,
-	 0.070505,  0.070600,  0.070696,  0.070791,  0.070887,  0.070983,  0.071078,  0.071174,
-	 0.071270,  0.071365,  0.071461,  0.071557,  0.071652,  0.071748,  0.071843,  0.071939,
-	 0.072035,  0.072130,  0.072226,  0.072322,  0.072417,  0.072513,  0.072608,  0.072704,
-	 0.072800,  0.072895,  0.072991,  0.073086,  0.073182,  0.073278,  0.073373,  0.073469,
-	 0.073565,  0.073660,  0.073756,  0.073851,  0.073947,  0.074043,  0.074138,  0.074234,
-	 0.074329,  0.074425,  0.074521,  0.074616,  0.074712,  0.074807,  0.074903,  0.074999,
-	 0.075094,  0.075190,  0.075286,  0.075381,  0.075477,  0.075572,  0.075668,  0.075764,
-	 0.075859,  0.075955,  0.076050,  0.076146,  0.076241,  0.076337,  0.076433,  0.076528,
-	 0.076624,  0.076719,  0.076815,  0.076911,  0.077006,  0.077102,  0.077197,  0.077293,
-	 0.077389,  0.077484,  0.077580,  0.077675,  0.077771,  0.077866,  0.077962,  0.078058,
-	 0.078153,  0.078249,  0.078344,  0.078440,  0.078536,  0.078631,  0.078727,  0.078822,
-	 0.078918,  0.079013,  0.079109,  0.079205,  0.079300,  0.079396,  0.079491,  0.079587,
-	 0.079682,  0.079778,  0.079874,  0.079969,  0.080065,  0.080160,  0.080256,  0.080351,
-	 0.080447,  0.080543,  0.080638,  0.080734,  0.080829,  0.080925,  0.081020,  0.081116,
-	 0.081211,  0.081307,  0.081403,  0.081498,  0.081594,  0.081689,  0.081785,  0.081880,
-	 0.081976,  0.082071,  0.082167,  0.082263,  0.082358,  0.082454,  0.082549,  0.082645,
-	 0.082740,  0.082836,  0.082931,  0.083027,  0.083122,  0.083218,  0.083314,  0.083409,
-	 0.083505,  0.083600,  0.083696,  0.083791,  0.083887,  0.083982,  0.084078,  0.084173,
-	 0.084269,  0.084364,  0.084460,  0.084555,  0.084651,  0.084747,  0.084842,  0.084938,
-	 0.085033,  0.085129,  0.085224,  0.085320,  0.085415,  0.085511,  0.085606,  0.085702,
-	 0.085797,  0.085893,  0.085988,  0.086084,  0.086179,  0.086275,  0.086370,  0.086466,
-	 0.086561,  0.086657,  0.086752,  0.086848,  0.086943,  0.087039,  0.087135,  0.087230,
-	 0.087326,  0.087421,  0.087517,  0.087612,  0.087708,  0.087803,  0.087899,  0.087994,
-	 0.088090,  0.088185,  0.088281,  0.088376,  0.088472,  0.088567,  0.088663,  0.088758,
-	 0.088854,  0.088949,  0.089045,  0.089140,  0.089236,  0.089331,  0.089427,  0.089522,
-	 0.089617,  0.089713,  0.089808,  0.089904,  0.089999,  0.090095,  0.090190,  0.090286,
-	 0.090381,  0.090477,  0.090572,  0.090668,  0.090763,  0.090859,  0.090954,  0.091050,
-	 0.091145,  0.091241,  0.091336,  0.091432,  0.091527,  0.091623,  0.091718,  0.091813,
-	 0.091909,  0.092004,  0.092100,  0.092195,  0.092291,  0.092386,  0.092482,  0.092577,
-	 0.092673,  0.092768,  0.092864,  0.092959,  0.093055,  0.093150,  0.093245,  0.093341,
-	 0.093436,  0.093532,  0.093627,  0.093723,  0.093818,  0.093914,  0.094009,  0.094104,
-	 0.094200,  0.094295,  0.094391,  0.094486,  0.094582,  0.094677,  0.094773,  0.094868,
-	 0.094963,  0.095059,  0.095154,  0.095250,  0.095345,  0.095441,  0.095536,  0.095632,
-	 0.095727,  0.095822,  0.095918,  0.096013,  0.096109,  0.096204,  0.096300,  0.096395,
-	 0.096490,  0.096586,  0.096681,  0.096777,  0.096872,  0.096968,  0.097063,  0.097158,
-	 0.097254,  0.097349,  0.097445,  0.097540,  0.097635,  0.097731,  0.097826,  0.097922,
-	 0.098017,  0.098113,  0.098208,  0.098303,  0.098399,  0.098494,  0.098590,  0.098685,
-	 0.098780,  0.098876,  0.098971,  0.099067,  0.099162,  0.099257,  0.099353,  0.099448,
-	 0.099544,  0.099639,  0.099734,  0.099830,  0.099925,  0.100021,  0.100116,  0.100211,
-	 0.100307,  0.100402,  0.100498,  0.100593,  0.100688,  0.100784,  0.100879,  0.100974,
-	 0.101070,  0.101165,  0.101261,  0.101356,  0.101451,  0.101547,  0.101642,  0.101738,
-	 0.101833,  0.101928,  0.102024,  0.102119,  0.102214,  0.102310,  0.102405,  0.102500,
-	 0.102596,  0.102691,  0.102787,  0.102882,  0.102977,  0.103073,  0.103168,  0.103263,
-	 0.103359,  0.103454,  0.103550,  0.103645,  0.103740,  0.103836,  0.103931,  0.104026,
-	 0.104122,  0.104217,  0.104312,  0.104408,  0.104503,  0.104598,  0.104694,  0.104789,
-	 0.104884,  0.104980,  0.105075,  0.105170,  0.105266,  0.105361,  0.105456,  0.105552,
-	 0.105647,  0.105742,  0.105838,  0.105933,  0.106028,  0.106124,  0.106219,  0.106314,
-	 0.106410,  0.106505,  0.106600,  0.106696,  0.106791,  0.106886,  0.106982,  0.107077,
-	 0.107172,  0.107268,  0.107363,  0.107458,  0.107554,  0.107649,  0.107744,  0.107840,
-	 0.107935,  0.108030,  0.108126,  0.108221,  0.108316,  0.108412,  0.108507,  0.108602,
-	 0.108697,  0.108793,  0.108888,  0.108983,  0.109079,  0.109174,  0.109269,  0.109365,
-	 0.109460,  0.109555,  0.109650,  0.109746,  0.109841,  0.109936,  0.110032,  0.110127,
-	 0.110222,  0.110317,  0.110413,  0.110508,  0.110603,  0.110699,  0.110794,  0.110889,
-	 0.110984,  0.111080,  0.111175,  0.111270,  0.111366,  0.111461,  0.111556,  0.111651,
-	 0.111747,  0.111842,  0.111937,  0.112033,  0.112128,  0.112223,  0.112318,  0.112414,
-	 0.112509,  0.112604,  0.112699,  0.112795,  0.112890,  0.112985,  0.113080,  0.113176,
-	 0.113271,  0.113366,  0.113461,  0.113557,  0.113652,  0.113747,  0.113842,  0.113938,
-	 0.114033,  0.114128,  0.114223,  0.114319,  0.114414,  0.114509,  0.114604,  0.114700,
-	 0.114795,  0.114890,  0.114985,  0.115081,  0.115176,  0.115271,  0.115366,  0.115462,
-	 0.115557,  0.115652,  0.115747,  0.115842,  0.115938,  0.116033,  0.116128,  0.116223,
-	 0.116319,  0.116414,  0.116509,  0.116604,  0.116700,  0.116795,  0.116890,  0.116985,
-	 0.117080,  0.117176,  0.117271,  0.117366,  0.117461,  0.117556,  0.117652,  0.117747,
-	 0.117842,  0.117937,  0.118032,  0.118128,  0.118223,  0.118318,  0.118413,  0.118508,
-	 0.118604,  0.118699,  0.118794,  0.118889,  0.118984,  0.119080,  0.119175,  0.119270,
-	 0.119365,  0.119460,  0.119556,  0.119651,  0.119746,  0.119841,  0.119936,  0.120032,
-	 0.120127,  0.120222,  0.120317,  0.120412,  0.120507,  0.120603,  0.120698,  0.120793,
-	 0.120888,  0.120983,  0.121078,  0.121174,  0.121269,  0.121364,  0.121459,  0.121554,
-	 0.121649,  0.121745,  0.121840,  0.121935,  0.122030,  0.122125,  0.122220,  0.122316,
-	 0.122411,  0.122506,  0.122601,  0.122696,  0.122791,  0.122886,  0.122982,  0.123077,
-	 0.123172,  0.123267,  0.123362,  0.123457,  0.123552,  0.123648,  0.123743,  0.123838,
-	 0.123933,  0.124028,  0.124123,  0.124218,  0.124314,  0.124409,  0.124504,  0.124599,
-	 0.124694,  0.124789,  0.124884,  0.124979,  0.125075,  0.125170,  0.125265,  0.125360,
-	 0.125455,  0.125550,  0.125645,  0.125740,  0.125835,  0.125931,  0.126026,  0.126121,
-	 0.126216,  0.126311,  0.126406,  0.126501,  0.126596,  0.126691,  0.126787,  0.126882,
-	 0.126977,  0.127072,  0.127167,  0.127262,  0.127357,  0.127452,  0.127547,  0.127642,
-	 0.127737,  0.127833,  0.127928,  0.128023,  0.128118,  0.128213,  0.128308,  0.128403,
-	 0.128498,  0.128593,  0.128688,  0.128783,  0.128878,  0.128973,  0.129069,  0.129164,
-	 0.129259,  0.129354,  0.129449,  0.129544,  0.129639,  0.129734,  0.129829,  0.129924,
-	 0.130019,  0.130114,  0.130209,  0.130304,  0.130399,  0.130495,  0.130590,  0.130685,
-	 0.130780,  0.130875,  0.130970,  0.131065,  0.131160,  0.131255,  0.131350,  0.131445,
-	 0.131540,  0.131635,  0.131730,  0.131825,  0.131920,  0.132015,  0.132110,  0.132205,
-	 0.132300,  0.132395,  0.132490,  0.132585,  0.132680,  0.132775,  0.132870,  0.132966,
-	 0.133061,  0.133156,  0.133251,  0.133346,  0.133441,  0.133536,  0.133631,  0.133726,
-	 0.133821,  0.133916,  0.134011,  0.134106,  0.134201,  0.134296,  0.134391,  0.134486,
-	 0.134581,  0.134676,  0.134771,  0.134866,  0.134961,  0.135056,  0.135151,  0.135246,
-	 0.135341,  0.135436,  0.135531,  0.135626,  0.135721,  0.135816,  0.135911,  0.136006,
-	 0.136101,  0.136196,  0.136291,  0.136386,  0.136480,  0.136575,  0.136670,  0.136765,
-	 0.136860,  0.136955,  0.137050,  0.137145,  0.137240,  0.137335,  0.137430,  0.137525,
-	 0.137620,  0.137715,  0.137810,  0.137905,  0.138000,  0.138095,  0.138190,  0.138285,
-	 0.138380,  0.138475,  0.138570,  0.138665,  0.138760,  0.138855,  0.138949,  0.139044,
-	 0.139139,  0.139234,  0.139329,  0.139424,  0.139519,  0.139614,  0.139709,  0.139804,
-	 0.139899,  0.139994,  0.140089,  0.140184,  0.140279,  0.140373,  0.140468,  0.140563,
-	 0.140658,  0.140753,  0.140848,  0.140943,  0.141038,  0.141133,  0.141228,  0.141323,
-	 0.141418,  0.141512,  0.141607,  0.141702,  0.141797,  0.141892,  0.141987,  0.142082,
-	 0.142177,  0.142272,  0.142367,  0.142461,  0.142556,  0.142651,  0.142746,  0.142841,
-	 0.142936,  0.143031,  0.143126,  0.143221,  0.143316,  0.143410,  0.143505,  0.143600,
-	 0.143695,  0.143790,  0.143885,  0.143980,  0.144075,  0.144169,  0.144264,  0.144359,
-	 0.144454,  0.144549,  0.144644,  0.144739,  0.144833,  0.144928,  0.145023,  0.145118,
-	 0.145213,  0.145308,  0.145403,  0.145497,  0.145592,  0.145687,  0.145782,  0.145877,
-	 0.145972,  0.146067,  0.146161,  0.146256,  0.146351,  0.146446,  0.146541,  0.146636,
-	 0.146730,  0.146825,  0.146920,  0.147015,  0.147110,  0.147205,  0.147299,  0.147394,
-	 0.147489,  0.147584,  0.147679,  0.147774,  0.147868,  0.147963,  0.148058,  0.148153,
-	 0.148248,  0.148342,  0.148437,  0.148532,  0.148627,  0.148722,  0.148817,  0.148911,
-	 0.149006,  0.149101,  0.149196,  0.149291,  0.149385,  0.149480,  0.149575,  0.149670,
-	 0.149765,  0.149859,  0.149954,  0.150049,  0.150144,  0.150238,  0.150333,  0.150428,
-	 0.150523,  0.150618,  0.150712,  0.150807,  0.150902,  0.150997,  0.151092,  0.151186,
-	 0.151281,  0.151376,  0.151471,  0.151565,  0.151660,  0.151755,  0.151850,  0.151944,
-	 0.152039,  0.152134,  0.152229,  0.152323,  0.152418,  0.152513,  0.152608,  0.152702,
-	 0.152797,  0.152892,  0.152987,  0.153081,  0.153176,  0.153271,  0.153366,  0.153460,
-	 0.153555,  0.153650,  0.153745,  0.153839,  0.153934,  0.154029,  0.154124,  0.154218,
-	 0.154313,  0.154408,  0.154502,  0.154597,  0.154692,  0.154787,  0.154881,  0.154976,
-	 0.155071,  0.155165,  0.155260,  0.155355,  0.155450,  0.155544,  0.155639,  0.155734,
-	 0.155828,  0.155923,  0.156018,  0.156112,  0.156207,  0.156302,  0.156397,  0.156491,
-	 0.156586,  0.156681,  0.156775,  0.156870,  0.156965,  0.157059,  0.157154,  0.157249,
-	 0.157343,  0.157438,  0.157533,  0.157627,  0.157722,  0.157817,  0.157912,  0.158006,
-	 0.158101,  0.158196,  0.158290,  0.158385,  0.158480,  0.158574,  0.158669,  0.158763,
-	 0.158858,  0.158953,  0.159047,  0.159142,  0.159237,  0.159331,  0.159426,  0.159521,
-	 0.159615,  0.159710,  0.159805,  0.159899,  0.159994,  0.160089,  0.160183,  0.160278,
-	 0.160372,  0.160467,  0.160562,  0.160656,  0.160751,  0.160846,  0.160940,  0.161035,
-	 0.161129,  0.161224,  0.161319,  0.161413,  0.161508,  0.161603,  0.161697,  0.161792,
-	 0.161886,  0.161981,  0.162076,  0.162170,  0.162265,  0.162359,  0.162454,  0.162549,
-	 0.162643,  0.162738,  0.162832,  0.162927,  0.163022,  0.163116,  0.163211,  0.163305,
-	 0.163400,  0.163495,  0.163589,  0.163684,  0.163778,  0.163873,  0.163967,  0.164062,
-	 0.164157,  0.164251,  0.164346,  0.164440,  0.164535,  0.164629,  0.164724,  0.164819,
-	 0.164913,  0.165008,  0.165102,  0.165197,  0.165291,  0.165386,  0.165480,  0.165575,
-	 0.165670,  0.165764,  0.165859,  0.165953,  0.166048,  0.166142,  0.166237,  0.166331,
-	 0.166426,  0.166520,  0.166615,  0.166710,  0.166804,  0.166899,  0.166993,  0.167088,
-	 0.167182,  0.167277,  0.167371,  0.167466,  0.167560,  0.167655,  0.167749,  0.167844,
-	 0.167938,  0.168033,  0.168127,  0.168222,  0.168316,  0.168411,  0.168505,  0.168600,
-	 0.168694,  0.168789,  0.168883,  0.168978,  0.169072,  0.169167,  0.169261,  0.169356,
-	 0.169450,  0.169545,  0.169639,  0.169734,  0.169828,  0.169923,  0.170017,  0.170112,
-	 0.170206,  0.170301,  0.170395,  0.170490,  0.170584,  0.170678,  0.170773,  0.170867,
-	 0.170962,  0.171056,  0.171151,  0.171245,  0.171340,  0.171434,  0.171529,  0.171623,
-	 0.171718,  0.171812,  0.171906,  0.172001,  0.172095,  0.172190,  0.172284,  0.172379,
-	 0.172473,  0.172568,  0.172662,  0.172756,  0.172851,  0.172945,  0.173040,  0.173134,
-	 0.173229,  0.173323,  0.173417,  0.173512,  0.173606,  0.173701,  0.173795,  0.173889,
-	 0.173984,  0.174078,  0.174173,  0.174267,  0.174362,  0.174456,  0.174550,  0.174645,
-	 0.174739,  0.174834,  0.174928,  0.175022,  0.175117,  0.175211,  0.175305,  0.175400,
-	 0.175494,  0.175589,  0.175683,  0.175777,  0.175872,  0.175966,  0.176061,  0.176155,
-	 0.176249,  0.176344,  0.176438,  0.176532,  0.176627,  0.176721,  0.176815,  0.176910,
-	 0.177004,  0.177099,  0.177193,  0.177287,  0.177382,  0.177476,  0.177570,  0.177665,
-	 0.177759,  0.177853,  0.177948,  0.178042,  0.178136,  0.178231,  0.178325,  0.178419,
-	 0.178514,  0.178608,  0.178702,  0.178797,  0.178891,  0.178985,  0.179080,  0.179174,
-	 0.179268,  0.179363,  0.179457,  0.179551,  0.179646,  0.179740,  0.179834,  0.179929,
-	 0.180023,  0.180117,  0.180212,  0.180306,  0.180400,  0.180494,  0.180589,  0.180683,
-	 0.180777,  0.180872,  0.180966,  0.181060,  0.181154,  0.181249,  0.181343,  0.181437,
-	 0.181532,  0.181626,  0.181720,  0.181814,  0.181909,  0.182003,  0.182097,  0.182192,
-	 0.182286,  0.182380,  0.182474,  0.182569,  0.182663,  0.182757,  0.182851,  0.182946,
-	 0.183040,  0.183134,  0.183228,  0.183323,  0.183417,  0.183511,  0.183605,  0.183700,
-	 0.183794,  0.183888,  0.183982,  0.184077,  0.184171,  0.184265,  0.184359,  0.184454,
-	 0.184548,  0.184642,  0.184736,  0.184830,  0.184925,  0.185019,  0.185113,  0.185207,
-	 0.185301,  0.185396,  0.185490,  0.185584,  0.185678,  0.185773,  0.185867,  0.185961,
-	 0.186055,  0.186149,  0.186244,  0.186338,  0.186432,  0.186526,  0.186620,  0.186715,
-	 0.186809,  0.186903,  0.186997,  0.187091,  0.187185,  0.187280,  0.187374,  0.187468,
-	 0.187562,  0.187656,  0.187750,  0.187845,  0.187939,  0.188033,  0.188127,  0.188221,
-	 0.188315,  0.188410,  0.188504,  0.188598,  0.188692,  0.188786,  0.188880,  0.188975,
-	 0.189069,  0.189163,  0.189257,  0.189351,  0.189445,  0.189539,  0.189634,  0.189728,
-	 0.189822,  0.189916,  0.190010,  0.190104,  0.190198,  0.190292,  0.190387,  0.190481,
-	 0.190575,  0.190669,  0.190763,  0.190857,  0.190951,  0.191045,  0.191139,  0.191234,
-	 0.191328,  0.191422,  0.191516,  0.191610,  0.191704,  0.191798,  0.191892,  0.191986,
-	 0.192080,  0.192174,  0.192269,  0.192363,  0.192457,  0.192551,  0.192645,  0.192739,
-	 0.192833,  0.192927,  0.193021,  0.193115,  0.193209,  0.193303,  0.193397,  0.193492,
-	 0.193586,  0.193680,  0.193774,  0.193868,  0.193962,  0.194056,  0.194150,  0.194244,
-	 0.194338,  0.194432,  0.194526,  0.194620,  0.194714,  0.194808,  0.194902,  0.194996,
-	 0.195090,  0.195184,  0.195278,  0.195372,  0.195466,  0.195560,  0.195654,  0.195748,
-	 0.195843,  0.195937,  0.196031,  0.196125,  0.196219,  0.196313,  0.196407,  0.196501,
-	 0.196595,  0.196689,  0.196783,  0.196877,  0.196971,  0.197065,  0.197159,  0.197253,
-	 0.197347,  0.197441,  0.197535,  0.197629,  0.197722,  0.197816,  0.197910,  0.198004,
-	 0.198098,  0.198192,  0.198286,  0.198380,  0.198474,  0.198568,  0.198662,  0.198756,
-	 0.198850,  0.198944,  0.199038,  0.199132,  0.199226,  0.199320,  0.199414,  0.199508,
-	 0.199602,  0.199696,  0.199790,  0.199884,  0.199978,  0.200071,  0.200165,  0.200259,
-	 0.200353,  0.200447,  0.200541,  0.200635,  0.200729,  0.200823,  0.200917,  0.201011,
-	 0.201105,  0.201199,  0.201292,  0.201386,  0.201480,  0.201574,  0.201668,  0.201762,
-	 0.201856,  0.201950,  0.202044,  0.202138,  0.202231,  0.202325,  0.202419,  0.202513,
-	 0.202607,  0.202701,  0.202795,  0.202889,  0.202983,  0.203076,  0.203170,  0.203264,
-	 0.203358,  0.203452,  0.203546,  0.203640,  0.203734,  0.203827,  0.203921,  0.204015,
-	 0.204109,  0.204203,  0.204297,  0.204391,  0.204484,  0.204578,  0.204672,  0.204766,
-	 0.204860,  0.204954,  0.205047,  0.205141,  0.205235,  0.205329,  0.205423,  0.205517,
-	 0.205610,  0.205704,  0.205798,  0.205892,  0.205986,  0.206080,  0.206173,  0.206267,
-	 0.206361,  0.206455,  0.206549,  0.206642,  0.206736,  0.206830,  0.206924,  0.207018,
-	 0.207111,  0.207205,  0.207299,  0.207393,  0.207487,  0.207580,  0.207674,  0.207768,
-	 0.207862,  0.207955,  0.208049,  0.208143,  0.208237,  0.208331,  0.208424,  0.208518,
-	 0.208612,  0.208706,  0.208799,  0.208893,  0.208987,  0.209081,  0.209174,  0.209268,
-	 0.209362,  0.209456,  0.209549,  0.209643,  0.209737,  0.209831,  0.209924,  0.210018,
-	 0.210112,  0.210206,  0.210299,  0.210393,  0.210487,  0.210580,  0.210674,  0.210768,
-	 0.210862,  0.210955,  0.211049,  0.211143,  0.211237,  0.211330,  0.211424,  0.211518,
-	 0.211611,  0.211705,  0.211799,  0.211892,  0.211986,  0.212080,  0.212174,  0.212267,
-	 0.212361,  0.212455,  0.212548,  0.212642,  0.212736,  0.212829,  0.212923,  0.213017,
-	 0.213110,  0.213204,  0.213298,  0.213391,  0.213485,  0.213579,  0.213672,  0.213766,
-	 0.213860,  0.213953,  0.214047,  0.214141,  0.214234,  0.214328,  0.214422,  0.214515,
-	 0.214609,  0.214702,  0.214796,  0.214890,  0.214983,  0.215077,  0.215171,  0.215264,
-	 0.215358,  0.215451,  0.215545,  0.215639,  0.215732,  0.215826,  0.215920,  0.216013,
-	 0.216107,  0.216200,  0.216294,  0.216388,  0.216481,  0.216575,  0.216668,  0.216762,
-	 0.216856,  0.216949,  0.217043,  0.217136,  0.217230,  0.217324,  0.217417,  0.217511,
-	 0.217604,  0.217698,  0.217791,  0.217885,  0.217979,  0.218072,  0.218166,  0.218259,
-	 0.218353,  0.218446,  0.218540,  0.218633,  0.218727,  0.218821,  0.218914,  0.219008,
-	 0.219101,  0.219195,  0.219288,  0.219382,  0.219475,  0.219569,  0.219662,  0.219756,
-	 0.219850,  0.219943,  0.220037,  0.220130,  0.220224,  0.220317,  0.220411,  0.220504,
-	 0.220598,  0.220691,  0.220785,  0.220878,  0.220972,  0.221065,  0.221159,  0.221252,
-	 0.221346,  0.221439,  0.221533,  0.221626,  0.221720,  0.221813,  0.221907,  0.222000,
-	 0.222094,  0.222187,  0.222281,  0.222374,  0.222468,  0.222561,  0.222654,  0.222748,
-	 0.222841,  0.222935,  0.223028,  0.223122,  0.223215,  0.223309,  0.223402,  0.223496,
-	 0.223589,  0.223682,  0.223776,  0.223869,  0.223963,  0.224056,  0.224150,  0.224243,
-	 0.224337,  0.224430,  0.224523,  0.224617,  0.224710,  0.224804,  0.224897,  0.224991,
-	 0.225084,  0.225177,  0.225271,  0.225364,  0.225458,  0.225551,  0.225644,  0.225738,
-	 0.225831,  0.225925,  0.226018,  0.226111,  0.226205,  0.226298,  0.226391,  0.226485,
-	 0.226578,  0.226672,  0.226765,  0.226858,  0.226952,  0.227045,  0.227139,  0.227232,
-	 0.227325,  0.227419,  0.227512,  0.227605,  0.227699,  0.227792,  0.227885,  0.227979,
-	 0.228072,  0.228165,  0.228259,  0.228352,  0.228445,  0.228539,  0.228632,  0.228725,
-	 0.228819,  0.228912,  0.229005,  0.229099,  0.229192,  0.229285,  0.229379,  0.229472,
-	 0.229565,  0.229659,  0.229752,  0.229845,  0.229939,  0.230032,  0.230125,  0.230218,
-	 0.230312,  0.230405,  0.230498,  0.230592,  0.230685,  0.230778,  0.230872,  0.230965,
-	 0.231058,  0.231151,  0.231245,  0.231338,  0.231431,  0.231524,  0.231618,  0.231711,
-	 0.231804,  0.231898,  0.231991,  0.232084,  0.232177,  0.232271,  0.232364,  0.232457,
-	 0.232550,  0.232644,  0.232737,  0.232830,  0.232923,  0.233017,  0.233110,  0.233203,
-	 0.233296,  0.233389,  0.233483,  0.233576,  0.233669,  0.233762,  0.233856,  0.233949,
-	 0.234042,  0.234135,  0.234228,  0.234322,  0.234415,  0.234508,  0.234601,  0.234694,
-	 0.234788,  0.234881,  0.234974,  0.235067,  0.235160,  0.235254,  0.235347,  0.235440,
-	 0.235533,  0.235626,  0.235719,  0.235813,  0.235906,  0.235999,  0.236092,  0.236185,
-	 0.236278,  0.236372,  0.236465,  0.236558,  0.236651,  0.236744,  0.236837,  0.236930,
-	 0.237024,  0.237117,  0.237210,  0.237303,  0.237396,  0.237489,  0.237582,  0.237676,
-	 0.237769,  0.237862,  0.237955,  0.238048,  0.238141,  0.238234,  0.238327,  0.238420,
-	 0.238514,  0.238607,  0.238700,  0.238793,  0.238886,  0.238979,  0.239072,  0.239165,
-	 0.239258,  0.239351,  0.239445,  0.239538,  0.239631,  0.239724,  0.239817,  0.239910,
-	 0.240003,  0.240096,  0.240189,  0.240282,  0.240375,  0.240468,  0.240561,  0.240654,
-	 0.240748,  0.240841,  0.240934,  0.241027,  0.241120,  0.241213,  0.241306,  0.241399,
-	 0.241492,  0.241585,  0.241678,  0.241771,  0.241864,  0.241957,  0.242050,  0.242143,
-	 0.242236,  0.242329,  0.242422,  0.242515,  0.242608,  0.242701,  0.242794,  0.242887,
-	 0.242980,  0.243073,  0.243166,  0.243259,  0.243352,  0.243445,  0.243538,  0.243631,
-	 0.243724,  0.243817,  0.243910,  0.244003,  0.244096,  0.244189,  0.244282,  0.244375,
-	 0.244468,  0.244561,  0.244654,  0.244747,  0.244840,  0.244933,  0.245026,  0.245119,
-	 0.245212,  0.245304,  0.245397,  0.245490,  0.245583,  0.245676,  0.245769,  0.245862,
-	 0.245955,  0.246048,  0.246141,  0.246234,  0.246327,  0.246420,  0.246513,  0.246606,
-	 0.246698,  0.246791,  0.246884,  0.246977,  0.247070,  0.247163,  0.247256,  0.247349,
-	 0.247442,  0.247535,  0.247627,  0.247720,  0.247813,  0.247906,  0.247999,  0.248092,
-	 0.248185,  0.248278,  0.248370,  0.248463,  0.248556,  0.248649,  0.248742,  0.248835,
-	 0.248928,  0.249020,  0.249113,  0.249206,  0.249299,  0.249392,  0.249485,  0.249578,
-	 0.249670,  0.249763,  0.249856,  0.249949,  0.250042,  0.250135,  0.250227,  0.250320,
-	 0.250413,  0.250506,  0.250599,  0.250691,  0.250784,  0.250877,  0.250970,  0.251063,
-	 0.251155,  0.251248,  0.251341,  0.251434,  0.251527,  0.251619,  0.251712,  0.251805,
-	 0.251898,  0.251991,  0.252083,  0.252176,  0.252269,  0.252362,  0.252454,  0.252547,
-	 0.252640,  0.252733,  0.252826,  0.252918,  0.253011,  0.253104,  0.253197,  0.253289,
-	 0.253382,  0.253475,  0.253568,  0.253660,  0.253753,  0.253846,  0.253938,  0.254031,
-	 0.254124,  0.254217,  0.254309,  0.254402,  0.254495,  0.254588,  0.254680,  0.254773,
-	 0.254866,  0.254958,  0.255051,  0.255144,  0.255236,  0.255329,  0.255422,  0.255515,
-	 0.255607,  0.255700,  0.255793,  0.255885,  0.255978,  0.256071,  0.256163,  0.256256,
-	 0.256349,  0.256441,  0.256534,  0.256627,  0.256719,  0.256812,  0.256905,  0.256997,
-	 0.257090,  0.257183,  0.257275,  0.257368,  0.257461,  0.257553,  0.257646,  0.257738,
-	 0.257831,  0.257924,  0.258016,  0.258109,  0.258202,  0.258294,  0.258387,  0.258479,
-	 0.258572,  0.258665,  0.258757,  0.258850,  0.258943,  0.259035,  0.259128,  0.259220,
-	 0.259313,  0.259405,  0.259498,  0.259591,  0.259683,  0.259776,  0.259868,  0.259961,
-	 0.260054,  0.260146,  0.260239,  0.260331,  0.260424,  0.260516,  0.260609,  0.260702,
-	 0.260794,  0.260887,  0.260979,  0.261072,  0.261164,  0.261257,  0.261349,  0.261442,
-	 0.261534,  0.261627,  0.261720,  0.261812,  0.261905,  0.261997,  0.262090,  0.262182,
-	 0.262275,  0.262367,  0.262460,  0.262552,  0.262645,  0.262737,  0.262830,  0.262922,
-	 0.263015,  0.263107,  0.263200,  0.263292,  0.263385,  0.263477,  0.263570,  0.263662,
-	 0.263755,  0.263847,  0.263940,  0.264032,  0.264125,  0.264217,  0.264309,  0.264402,
-	 0.264494,  0.264587,  0.264679,  0.264772,  0.264864,  0.264957,  0.265049,  0.265142,
-	 0.265234,  0.265326,  0.265419,  0.265511,  0.265604,  0.265696,  0.265789,  0.265881,
-	 0.265973,  0.266066,  0.266158,  0.266251,  0.266343,  0.266436,  0.266528,  0.266620,
-	 0.266713,  0.266805,  0.266898,  0.266990,  0.267082,  0.267175,  0.267267,  0.267359,
-	 0.267452,  0.267544,  0.267637,  0.267729,  0.267821,  0.267914,  0.268006,  0.268099,
-	 0.268191,  0.268283,  0.268376,  0.268468,  0.268560,  0.268653,  0.268745,  0.268837,
-	 0.268930,  0.269022,  0.269114,  0.269207,  0.269299,  0.269391,  0.269484,  0.269576,
-	 0.269668,  0.269761,  0.269853,  0.269945,  0.270038,  0.270130,  0.270222,  0.270315,
-	 0.270407,  0.270499,  0.270591,  0.270684,  0.270776,  0.270868,  0.270961,  0.271053,
-	 0.271145,  0.271237,  0.271330,  0.271422,  0.271514,  0.271607,  0.271699,  0.271791,
-	 0.271883,  0.271976,  0.272068,  0.272160,  0.272252,  0.272345,  0.272437,  0.272529,
-	 0.272621,  0.272714,  0.272806,  0.272898,  0.272990,  0.273083,  0.273175,  0.273267,
-	 0.273359,  0.273451,  0.273544,  0.273636,  0.273728,  0.273820,  0.273912,  0.274005,
-	 0.274097,  0.274189,  0.274281,  0.274374,  0.274466,  0.274558,  0.274650,  0.274742,
-	 0.274834,  0.274927,  0.275019,  0.275111,  0.275203,  0.275295,  0.275387,  0.275480,
-	 0.275572,  0.275664,  0.275756,  0.275848,  0.275940,  0.276033,  0.276125,  0.276217,
-	 0.276309,  0.276401,  0.276493,  0.276585,  0.276678,  0.276770,  0.276862,  0.276954,
-	 0.277046,  0.277138,  0.277230,  0.277322,  0.277415,  0.277507,  0.277599,  0.277691,
-	 0.277783,  0.277875,  0.277967,  0.278059,  0.278151,  0.278243,  0.278336,  0.278428,
-	 0.278520,  0.278612,  0.278704,  0.278796,  0.278888,  0.278980,  0.279072,  0.279164,
-	 0.279256,  0.279348,  0.279440,  0.279532,  0.279624,  0.279717,  0.279809,  0.279901,
-	 0.279993,  0.280085,  0.280177,  0.280269,  0.280361,  0.280453,  0.280545,  0.280637,
-	 0.280729,  0.280821,  0.280913,  0.281005,  0.281097,  0.281189,  0.281281,  0.281373,
-	 0.281465,  0.281557,  0.281649,  0.281741,  0.281833,  0.281925,  0.282017,  0.282109,
-	 0.282201,  0.282293,  0.282385,  0.282477,  0.282569,  0.282661,  0.282753,  0.282845,
-	 0.282937,  0.283029,  0.283120,  0.283212,  0.283304,  0.283396,  0.283488,  0.283580,
-	 0.283672,  0.283764,  0.283856,  0.283948,  0.284040,  0.284132,  0.284224,  0.284316,
-	 0.284408,  0.284499,  0.284591,  0.284683,  0.284775,  0.284867,  0.284959,  0.285051,
-	 0.285143,  0.285235,  0.285327,  0.285418,  0.285510,  0.285602,  0.285694,  0.285786,
-	 0.285878,  0.285970,  0.286062,  0.286153,  0.286245,  0.286337,  0.286429,  0.286521,
-	 0.286613,  0.286705,  0.286796,  0.286888,  0.286980,  0.287072,  0.287164,  0.287256,
-	 0.287347,  0.287439,  0.287531,  0.287623,  0.287715,  0.287807,  0.287898,  0.287990,
-	 0.288082,  0.288174,  0.288266,  0.288357,  0.288449,  0.288541,  0.288633,  0.288725,
-	 0.288816,  0.288908,  0.289000,  0.289092,  0.289184,  0.289275,  0.289367,  0.289459,
-	 0.289551,  0.289642,  0.289734,  0.289826,  0.289918,  0.290009,  0.290101,  0.290193,
-	 0.290285,  0.290376,  0.290468,  0.290560,  0.290652,  0.290743,  0.290835,  0.290927,
-	 0.291019,  0.291110,  0.291202,  0.291294,  0.291385,  0.291477,  0.291569,  0.291661,
-	 0.291752,  0.291844,  0.291936,  0.292027,  0.292119,  0.292211,  0.292302,  0.292394,
-	 0.292486,  0.292577,  0.292669,  0.292761,  0.292852,  0.292944,  0.293036,  0.293128,
-	 0.293219,  0.293311,  0.293402,  0.293494,  0.293586,  0.293677,  0.293769,  0.293861,
-	 0.293952,  0.294044,  0.294136,  0.294227,  0.294319,  0.294410,  0.294502,  0.294594,
-	 0.294685,  0.294777,  0.294869,  0.294960,  0.295052,  0.295143,  0.295235,  0.295327,
-	 0.295418,  0.295510,  0.295601,  0.295693,  0.295785,  0.295876,  0.295968,  0.296059,
-	 0.296151,  0.296242,  0.296334,  0.296426,  0.296517,  0.296609,  0.296700,  0.296792,
-	 0.296883,  0.296975,  0.297066,  0.297158,  0.297250,  0.297341,  0.297433,  0.297524,
-	 0.297616,  0.297707,  0.297799,  0.297890,  0.297982,  0.298073,  0.298165,  0.298256,
-	 0.298348,  0.298439,  0.298531,  0.298622,  0.298714,  0.298805,  0.298897,  0.298988,
-	 0.299080,  0.299171,  0.299263,  0.299354,  0.299446,  0.299537,  0.299629,  0.299720,
-	 0.299812,  0.299903,  0.299995,  0.300086,  0.300177,  0.300269,  0.300360,  0.300452,
-	 0.300543,  0.300635,  0.300726,  0.300818,  0.300909,  0.301000,  0.301092,  0.301183,
-	 0.301275,  0.301366,  0.301458,  0.301549,  0.301640,  0.301732,  0.301823,  0.301915,
-	 0.302006,  0.302097,  0.302189,  0.302280,  0.302372,  0.302463,  0.302554,  0.302646,
-	 0.302737,  0.302828,  0.302920,  0.303011,  0.303103,  0.303194,  0.303285,  0.303377,
-	 0.303468,  0.303559,  0.303651,  0.303742,  0.303833,  0.303925,  0.304016,  0.304107,
-	 0.304199,  0.304290,  0.304381,  0.304473,  0.304564,  0.304655,  0.304747,  0.304838,
-	 0.304929,  0.305021,  0.305112,  0.305203,  0.305294,  0.305386,  0.305477,  0.305568,
-	 0.305660,  0.305751,  0.305842,  0.305933,  0.306025,  0.306116,  0.306207,  0.306299,
-	 0.306390,  0.306481,  0.306572,  0.306664,  0.306755,  0.306846,  0.306937,  0.307029,
-	 0.307120,  0.307211,  0.307302,  0.307394,  0.307485,  0.307576,  0.307667,  0.307758,
-	 0.307850,  0.307941,  0.308032,  0.308123,  0.308214,  0.308306,  0.308397,  0.308488,
-	 0.308579,  0.308670,  0.308762,  0.308853,  0.308944,  0.309035,  0.309126,  0.309218,
-	 0.309309,  0.309400,  0.309491,  0.309582,  0.309673,  0.309765,  0.309856,  0.309947,
-	 0.310038,  0.310129,  0.310220,  0.310311,  0.310403,  0.310494,  0.310585,  0.310676,
-	 0.310767,  0.310858,  0.310949,  0.311041,  0.311132,  0.311223,  0.311314,  0.311405,
-	 0.311496,  0.311587,  0.311678,  0.311769,  0.311860,  0.311952,  0.312043,  0.312134,
-	 0.312225,  0.312316,  0.312407,  0.312498,  0.312589,  0.312680,  0.312771,  0.312862,
-	 0.312953,  0.313044,  0.313135,  0.313227,  0.313318,  0.313409,  0.313500,  0.313591,
-	 0.313682,  0.313773,  0.313864,  0.313955,  0.314046,  0.314137,  0.314228,  0.314319,
-	 0.314410,  0.314501,  0.314592,  0.314683,  0.314774,  0.314865,  0.314956,  0.315047,
-	 0.315138,  0.315229,  0.315320,  0.315411,  0.315502,  0.315593,  0.315684,  0.315775,
-	 0.315866,  0.315957,  0.316048,  0.316139,  0.316230,  0.316321,  0.316411,  0.316502,
-	 0.316593,  0.316684,  0.316775,  0.316866,  0.316957,  0.317048,  0.317139,  0.317230,
-	 0.317321,  0.317412,  0.317503,  0.317594,  0.317684,  0.317775,  0.317866,  0.317957,
-	 0.318048,  0.318139,  0.318230,  0.318321,  0.318412,  0.318503,  0.318593,  0.318684,
-	 0.318775,  0.318866,  0.318957,  0.319048,  0.319139,  0.319229,  0.319320,  0.319411,
-	 0.319502,  0.319593,  0.319684,  0.319775,  0.319865,  0.319956,  0.320047,  0.320138,
-	 0.320229,  0.320320,  0.320410,  0.320501,  0.320592,  0.320683,  0.320774,  0.320864,
-	 0.320955,  0.321046,  0.321137,  0.321228,  0.321318,  0.321409,  0.321500,  0.321591,
-	 0.321682,  0.321772,  0.321863,  0.321954,  0.322045,  0.322135,  0.322226,  0.322317,
-	 0.322408,  0.322498,  0.322589,  0.322680,  0.322771,  0.322861,  0.322952,  0.323043,
-	 0.323134,  0.323224,  0.323315,  0.323406,  0.323497,  0.323587,  0.323678,  0.323769,
-	 0.323859,  0.323950,  0.324041,  0.324131,  0.324222,  0.324313,  0.324404,  0.324494,
-	 0.324585,  0.324676,  0.324766,  0.324857,  0.324948,  0.325038,  0.325129,  0.325220,
-	 0.325310,  0.325401,  0.325492,  0.325582,  0.325673,  0.325764,  0.325854,  0.325945,
-	 0.326035,  0.326126,  0.326217,  0.326307,  0.326398,  0.326489,  0.326579,  0.326670,
-	 0.326760,  0.326851,  0.326942,  0.327032,  0.327123,  0.327213,  0.327304,  0.327395,
-	 0.327485,  0.327576,  0.327666,  0.327757,  0.327848,  0.327938,  0.328029,  0.328119,
-	 0.328210,  0.328300,  0.328391,  0.328482,  0.328572,  0.328663,  0.328753,  0.328844,
-	 0.328934,  0.329025,  0.329115,  0.329206,  0.329296,  0.329387,  0.329477,  0.329568,
-	 0.329658,  0.329749,  0.329839,  0.329930,  0.330020,  0.330111,  0.330202,  0.330292,
-	 0.330382,  0.330473,  0.330563,  0.330654,  0.330744,  0.330835,  0.330925,  0.331016,
-	 0.331106,  0.331197,  0.331287,  0.331378,  0.331468,  0.331559,  0.331649,  0.331739,
-	 0.331830,  0.331920,  0.332011,  0.332101,  0.332192,  0.332282,  0.332373,  0.332463,
-	 0.332553,  0.332644,  0.332734,  0.332825,  0.332915,  0.333005,  0.333096,  0.333186,
-	 0.333277,  0.333367,  0.333457,  0.333548,  0.333638,  0.333729,  0.333819,  0.333909,
-	 0.334000,  0.334090,  0.334180,  0.334271,  0.334361,  0.334451,  0.334542,  0.334632,
-	 0.334722,  0.334813,  0.334903,  0.334994,  0.335084,  0.335174,  0.335265,  0.335355,
-	 0.335445,  0.335535,  0.335626,  0.335716,  0.335806,  0.335897,  0.335987,  0.336077,
-	 0.336168,  0.336258,  0.336348,  0.336438,  0.336529,  0.336619,  0.336709,  0.336800,
-	 0.336890,  0.336980,  0.337070,  0.337161,  0.337251,  0.337341,  0.337431,  0.337522,
-	 0.337612,  0.337702,  0.337792,  0.337883,  0.337973,  0.338063,  0.338153,  0.338244,
-	 0.338334,  0.338424,  0.338514,  0.338604,  0.338695,  0.338785,  0.338875,  0.338965,
-	 0.339055,  0.339146,  0.339236,  0.339326,  0.339416,  0.339506,  0.339597,  0.339687,
-	 0.339777,  0.339867,  0.339957,  0.340047,  0.340138,  0.340228,  0.340318,  0.340408,
-	 0.340498,  0.340588,  0.340678,  0.340769,  0.340859,  0.340949,  0.341039,  0.341129,
-	 0.341219,  0.341309,  0.341399,  0.341490,  0.341580,  0.341670,  0.341760,  0.341850,
-	 0.341940,  0.342030,  0.342120,  0.342210,  0.342300,  0.342391,  0.342481,  0.342571,
-	 0.342661,  0.342751,  0.342841,  0.342931,  0.343021,  0.343111,  0.343201,  0.343291,
-	 0.343381,  0.343471,  0.343561,  0.343651,  0.343741,  0.343831,  0.343921,  0.344011,
-	 0.344101,  0.344191,  0.344281,  0.344371,  0.344461,  0.344551,  0.344641,  0.344731,
-	 0.344821,  0.344911,  0.345001,  0.345091,  0.345181,  0.345271,  0.345361,  0.345451,
-	 0.345541,  0.345631,  0.345721,  0.345811,  0.345901,  0.345991,  0.346081,  0.346171,
-	 0.346261,  0.346351,  0.346441,  0.346531,  0.346621,  0.346711,  0.346801,  0.346890,
-	 0.346980,  0.347070,  0.347160,  0.347250,  0.347340,  0.347430,  0.347520,  0.347610,
-	 0.347700,  0.347790,  0.347879,  0.347969,  0.348059,  0.348149,  0.348239,  0.348329,
-	 0.348419,  0.348509,  0.348598,  0.348688,  0.348778,  0.348868,  0.348958,  0.349048,
-	 0.349138,  0.349227,  0.349317,  0.349407,  0.349497,  0.349587,  0.349676,  0.349766,
-	 0.349856,  0.349946,  0.350036,  0.350126,  0.350215,  0.350305,  0.350395,  0.350485,
-	 0.350575,  0.350664,  0.350754,  0.350844,  0.350934,  0.351023,  0.351113,  0.351203,
-	 0.351293,  0.351383,  0.351472,  0.351562,  0.351652,  0.351742,  0.351831,  0.351921,
-	 0.352011,  0.352100,  0.352190,  0.352280,  0.352370,  0.352459,  0.352549,  0.352639,
-	 0.352729,  0.352818,  0.352908,  0.352998,  0.353087,  0.353177,  0.353267,  0.353356,
-	 0.353446,  0.353536,  0.353626,  0.353715,  0.353805,  0.353895,  0.353984,  0.354074,
-	 0.354164,  0.354253,  0.354343,  0.354432,  0.354522,  0.354612,  0.354701,  0.354791,
-	 0.354881,  0.354970,  0.355060,  0.355150,  0.355239,  0.355329,  0.355418,  0.355508,
-	 0.355598,  0.355687,  0.355777,  0.355866,  0.355956,  0.356046,  0.356135,  0.356225,
-	 0.356314,  0.356404,  0.356494,  0.356583,  0.356673,  0.356762,  0.356852,  0.356941,
-	 0.357031,  0.357121,  0.357210,  0.357300,  0.357389,  0.357479,  0.357568,  0.357658,
-	 0.357747,  0.357837,  0.357926,  0.358016,  0.358105,  0.358195,  0.358284,  0.358374,
-	 0.358463,  0.358553,  0.358642,  0.358732,  0.358821,  0.358911,  0.359000,  0.359090,
-	 0.359179,  0.359269,  0.359358,  0.359448,  0.359537,  0.359627,  0.359716,  0.359806,
-	 0.359895,  0.359984,  0.360074,  0.360163,  0.360253,  0.360342,  0.360432,  0.360521,
-	 0.360611,  0.360700,  0.360789,  0.360879,  0.360968,  0.361058,  0.361147,  0.361236,
-	 0.361326,  0.361415,  0.361505,  0.361594,  0.361683,  0.361773,  0.361862,  0.361952,
-	 0.362041,  0.362130,  0.362220,  0.362309,  0.362398,  0.362488,  0.362577,  0.362666,
-	 0.362756,  0.362845,  0.362934,  0.363024,  0.363113,  0.363202,  0.363292,  0.363381,
-	 0.363470,  0.363560,  0.363649,  0.363738,  0.363828,  0.363917,  0.364006,  0.364096,
-	 0.364185,  0.364274,  0.364363,  0.364453,  0.364542,  0.364631,  0.364720,  0.364810,
-	 0.364899,  0.364988,  0.365078,  0.365167,  0.365256,  0.365345,  0.365435,  0.365524,
-	 0.365613,  0.365702,  0.365791,  0.365881,  0.365970,  0.366059,  0.366148,  0.366238,
-	 0.366327,  0.366416,  0.366505,  0.366594,  0.366684,  0.366773,  0.366862,  0.366951,
-	 0.367040,  0.367130,  0.367219,  0.367308,  0.367397,  0.367486,  0.367575,  0.367665,
-	 0.367754,  0.367843,  0.367932,  0.368021,  0.368110,  0.368199,  0.368289,  0.368378,
-	 0.368467,  0.368556,  0.368645,  0.368734,  0.368823,  0.368912,  0.369002,  0.369091,
-	 0.369180,  0.369269,  0.369358,  0.369447,  0.369536,  0.369625,  0.369714,  0.369803,
-	 0.369892,  0.369982,  0.370071,  0.370160,  0.370249,  0.370338,  0.370427,  0.370516,
-	 0.370605,  0.370694,  0.370783,  0.370872,  0.370961,  0.371050,  0.371139,  0.371228,
-	 0.371317,  0.371406,  0.371495,  0.371584,  0.371673,  0.371762,  0.371851,  0.371940,
-	 0.372029,  0.372118,  0.372207,  0.372296,  0.372385,  0.372474,  0.372563,  0.372652,
-	 0.372741,  0.372830,  0.372919,  0.373008,  0.373097,  0.373186,  0.373275,  0.373364,
-	 0.373453,  0.373542,  0.373631,  0.373719,  0.373808,  0.373897,  0.373986,  0.374075,
-	 0.374164,  0.374253,  0.374342,  0.374431,  0.374520,  0.374609,  0.374697,  0.374786,
-	 0.374875,  0.374964,  0.375053,  0.375142,  0.375231,  0.375320,  0.375408,  0.375497,
-	 0.375586,  0.375675,  0.375764,  0.375853,  0.375942,  0.376030,  0.376119,  0.376208,
-	 0.376297,  0.376386,  0.376475,  0.376563,  0.376652,  0.376741,  0.376830,  0.376919,
-	 0.377007,  0.377096,  0.377185,  0.377274,  0.377363,  0.377451,  0.377540,  0.377629,
-	 0.377718,  0.377806,  0.377895,  0.377984,  0.378073,  0.378162,  0.378250,  0.378339,
-	 0.378428,  0.378516,  0.378605,  0.378694,  0.378783,  0.378871,  0.378960,  0.379049,
-	 0.379138,  0.379226,  0.379315,  0.379404,  0.379492,  0.379581,  0.379670,  0.379759,
-	 0.379847,  0.379936,  0.380025,  0.380113,  0.380202,  0.380291,  0.380379,  0.380468,
-	 0.380557,  0.380645,  0.380734,  0.380823,  0.380911,  0.381000,  0.381088,  0.381177,
-	 0.381266,  0.381354,  0.381443,  0.381532,  0.381620,  0.381709,  0.381797,  0.381886,
-	 0.381975,  0.382063,  0.382152,  0.382241,  0.382329,  0.382418,  0.382506,  0.382595,
-	 0.382683,  0.382772,  0.382861,  0.382949,  0.383038,  0.383126,  0.383215,  0.383303,
-	 0.383392,  0.383480,  0.383569,  0.383658,  0.383746,  0.383835,  0.383923,  0.384012,
-	 0.384100,  0.384189,  0.384277,  0.384366,  0.384454,  0.384543,  0.384631,  0.384720,
-	 0.384808,  0.384897,  0.384985,  0.385074,  0.385162,  0.385251,  0.385339,  0.385428,
-	 0.385516,  0.385605,  0.385693,  0.385781,  0.385870,  0.385958,  0.386047,  0.386135,
-	 0.386224,  0.386312,  0.386400,  0.386489,  0.386577,  0.386666,  0.386754,  0.386843,
-	 0.386931,  0.387019,  0.387108,  0.387196,  0.387285,  0.387373,  0.387461,  0.387550,
-	 0.387638,  0.387727,  0.387815,  0.387903,  0.387992,  0.388080,  0.388168,  0.388257,
-	 0.388345,  0.388433,  0.388522,  0.388610,  0.388698,  0.388787,  0.388875,  0.388963,
-	 0.389052,  0.389140,  0.389228,  0.389317,  0.389405,  0.389493,  0.389582,  0.389670,
-	 0.389758,  0.389846,  0.389935,  0.390023,  0.390111,  0.390200,  0.390288,  0.390376,
-	 0.390464,  0.390553,  0.390641,  0.390729,  0.390817,  0.390906,  0.390994,  0.391082,
-	 0.391170,  0.391259,  0.391347,  0.391435,  0.391523,  0.391612,  0.391700,  0.391788,
-	 0.391876,  0.391964,  0.392053,  0.392141,  0.392229,  0.392317,  0.392405,  0.392493,
-	 0.392582,  0.392670,  0.392758,  0.392846,  0.392934,  0.393023,  0.393111,  0.393199,
-	 0.393287,  0.393375,  0.393463,  0.393551,  0.393640,  0.393728,  0.393816,  0.393904,
-	 0.393992,  0.394080,  0.394168,  0.394256,  0.394344,  0.394433,  0.394521,  0.394609,
-	 0.394697,  0.394785,  0.394873,  0.394961,  0.395049,  0.395137,  0.395225,  0.395313,
-	 0.395401,  0.395490,  0.395578,  0.395666,  0.395754,  0.395842,  0.395930,  0.396018,
-	 0.396106,  0.396194,  0.396282,  0.396370,  0.396458,  0.396546,  0.396634,  0.396722,
-	 0.396810,  0.396898,  0.396986,  0.397074,  0.397162,  0.397250,  0.397338,  0.397426,
-	 0.397514,  0.397602,  0.397690,  0.397778,  0.397866,  0.397954,  0.398042,  0.398130,
-	 0.398218,  0.398306,  0.398393,  0.398481,  0.398569,  0.398657,  0.398745,  0.398833,
-	 0.398921,  0.399009,  0.399097,  0.399185,  0.399273,  0.399361,  0.399448,  0.399536,
-	 0.399624,  0.399712,  0.399800,  0.399888,  0.399976,  0.400064,  0.400151,  0.400239,
-	 0.400327,  0.400415,  0.400503,  0.400591,  0.400679,  0.400766,  0.400854,  0.400942,
-	 0.401030,  0.401118,  0.401206,  0.401293,  0.401381,  0.401469,  0.401557,  0.401645,
-	 0.401732,  0.401820,  0.401908,  0.401996,  0.402084,  0.402171,  0.402259,  0.402347,
-	 0.402435,  0.402522,  0.402610,  0.402698,  0.402786,  0.402873,  0.402961,  0.403049,
-	 0.403137,  0.403224,  0.403312,  0.403400,  0.403488,  0.403575,  0.403663,  0.403751,
-	 0.403838,  0.403926,  0.404014,  0.404102,  0.404189,  0.404277,  0.404365,  0.404452,
-	 0.404540,  0.404628,  0.404715,  0.404803,  0.404891,  0.404978,  0.405066,  0.405154,
-	 0.405241,  0.405329,  0.405417,  0.405504,  0.405592,  0.405680,  0.405767,  0.405855,
-	 0.405942,  0.406030,  0.406118,  0.406205,  0.406293,  0.406380,  0.406468,  0.406556,
-	 0.406643,  0.406731,  0.406818,  0.406906,  0.406994,  0.407081,  0.407169,  0.407256,
-	 0.407344,  0.407431,  0.407519,  0.407606,  0.407694,  0.407782,  0.407869,  0.407957,
-	 0.408044,  0.408132,  0.408219,  0.408307,  0.408394,  0.408482,  0.408569,  0.408657,
-	 0.408744,  0.408832,  0.408919,  0.409007,  0.409094,  0.409182,  0.409269,  0.409357,
-	 0.409444,  0.409532,  0.409619,  0.409707,  0.409794,  0.409881,  0.409969,  0.410056,
-	 0.410144,  0.410231,  0.410319,  0.410406,  0.410493,  0.410581,  0.410668,  0.410756,
-	 0.410843,  0.410931,  0.411018,  0.411105,  0.411193,  0.411280,  0.411368,  0.411455,
-	 0.411542,  0.411630,  0.411717,  0.411804,  0.411892,  0.411979,  0.412067,  0.412154,
-	 0.412241,  0.412329,  0.412416,  0.412503,  0.412591,  0.412678,  0.412765,  0.412853,
-	 0.412940,  0.413027,  0.413115,  0.413202,  0.413289,  0.413376,  0.413464,  0.413551,
-	 0.413638,  0.413726,  0.413813,  0.413900,  0.413987,  0.414075,  0.414162,  0.414249,
-	 0.414337,  0.414424,  0.414511,  0.414598,  0.414685,  0.414773,  0.414860,  0.414947,
-	 0.415034,  0.415122,  0.415209,  0.415296,  0.415383,  0.415471,  0.415558,  0.415645,
-	 0.415732,  0.415819,  0.415906,  0.415994,  0.416081,  0.416168,  0.416255,  0.416342,
-	 0.416430,  0.416517,  0.416604,  0.416691,  0.416778,  0.416865,  0.416952,  0.417040,
-	 0.417127,  0.417214,  0.417301,  0.417388,  0.417475,  0.417562,  0.417650,  0.417737,
-	 0.417824,  0.417911,  0.417998,  0.418085,  0.418172,  0.418259,  0.418346,  0.418433,
-	 0.418520,  0.418608,  0.418695,  0.418782,  0.418869,  0.418956,  0.419043,  0.419130,
-	 0.419217,  0.419304,  0.419391,  0.419478,  0.419565,  0.419652,  0.419739,  0.419826,
-	 0.419913,  0.420000,  0.420087,  0.420174,  0.420261,  0.420348,  0.420435,  0.420522,
-	 0.420609,  0.420696,  0.420783,  0.420870,  0.420957,  0.421044,  0.421131,  0.421218,
-	 0.421305,  0.421392,  0.421479,  0.421566,  0.421653,  0.421739,  0.421826,  0.421913,
-	 0.422000,  0.422087,  0.422174,  0.422261,  0.422348,  0.422435,  0.422522,  0.422609,
-	 0.422695,  0.422782,  0.422869,  0.422956,  0.423043,  0.423130,  0.423217,  0.423304,
-	 0.423390,  0.423477,  0.423564,  0.423651,  0.423738,  0.423825,  0.423912,  0.423998,
-	 0.424085,  0.424172,  0.424259,  0.424346,  0.424432,  0.424519,  0.424606,  0.424693,
-	 0.424780,  0.424866,  0.424953,  0.425040,  0.425127,  0.425214,  0.425300,  0.425387,
-	 0.425474,  0.425561,  0.425647,  0.425734,  0.425821,  0.425908,  0.425994,  0.426081,
-	 0.426168,  0.426255,  0.426341,  0.426428,  0.426515,  0.426601,  0.426688,  0.426775,
-	 0.426862,  0.426948,  0.427035,  0.427122,  0.427208,  0.427295,  0.427382,  0.427468,
-	 0.427555,  0.427642,  0.427728,  0.427815,  0.427902,  0.427988,  0.428075,  0.428162,
-	 0.428248,  0.428335,  0.428422,  0.428508,  0.428595,  0.428681,  0.428768,  0.428855,
-	 0.428941,  0.429028,  0.429114,  0.429201,  0.429288,  0.429374,  0.429461,  0.429547,
-	 0.429634,  0.429721,  0.429807,  0.429894,  0.429980,  0.430067,  0.430153,  0.430240,
-	 0.430326,  0.430413,  0.430500,  0.430586,  0.430673,  0.430759,  0.430846,  0.430932,
-	 0.431019,  0.431105,  0.431192,  0.431278,  0.431365,  0.431451,  0.431538,  0.431624,
-	 0.431711,  0.431797,  0.431884,  0.431970,  0.432057,  0.432143,  0.432229,  0.432316,
-	 0.432402,  0.432489,  0.432575,  0.432662,  0.432748,  0.432835,  0.432921,  0.433007,
-	 0.433094,  0.433180,  0.433267,  0.433353,  0.433439,  0.433526,  0.433612,  0.433699,
-	 0.433785,  0.433871,  0.433958,  0.434044,  0.434131,  0.434217,  0.434303,  0.434390,
-	 0.434476,  0.434562,  0.434649,  0.434735,  0.434821,  0.434908,  0.434994,  0.435080,
-	 0.435167,  0.435253,  0.435339,  0.435426,  0.435512,  0.435598,  0.435685,  0.435771,
-	 0.435857,  0.435943,  0.436030,  0.436116,  0.436202,  0.436288,  0.436375,  0.436461,
-	 0.436547,  0.436633,  0.436720,  0.436806,  0.436892,  0.436978,  0.437065,  0.437151,
-	 0.437237,  0.437323,  0.437410,  0.437496,  0.437582,  0.437668,  0.437754,  0.437841,
-	 0.437927,  0.438013,  0.438099,  0.438185,  0.438272,  0.438358,  0.438444,  0.438530,
-	 0.438616,  0.438702,  0.438789,  0.438875,  0.438961,  0.439047,  0.439133,  0.439219,
-	 0.439305,  0.439392,  0.439478,  0.439564,  0.439650,  0.439736,  0.439822,  0.439908,
-	 0.439994,  0.440080,  0.440166,  0.440253,  0.440339,  0.440425,  0.440511,  0.440597,
-	 0.440683,  0.440769,  0.440855,  0.440941,  0.441027,  0.441113,  0.441199,  0.441285,
-	 0.441371,  0.441457,  0.441543,  0.441629,  0.441715,  0.441801,  0.441887,  0.441973,
-	 0.442059,  0.442145,  0.442231,  0.442317,  0.442403,  0.442489,  0.442575,  0.442661,
-	 0.442747,  0.442833,  0.442919,  0.443005,  0.443091,  0.443177,  0.443263,  0.443349,
-	 0.443435,  0.443521,  0.443607,  0.443693,  0.443779,  0.443864,  0.443950,  0.444036,
-	 0.444122,  0.444208,  0.444294,  0.444380,  0.444466,  0.444552,  0.444637,  0.444723,
-	 0.444809,  0.444895,  0.444981,  0.445067,  0.445153,  0.445239,  0.445324,  0.445410,
-	 0.445496,  0.445582,  0.445668,  0.445754,  0.445839,  0.445925,  0.446011,  0.446097,
-	 0.446183,  0.446268,  0.446354,  0.446440,  0.446526,  0.446612,  0.446697,  0.446783,
-	 0.446869,  0.446955,  0.447040,  0.447126,  0.447212,  0.447298,  0.447383,  0.447469,
-	 0.447555,  0.447641,  0.447726,  0.447812,  0.447898,  0.447983,  0.448069,  0.448155,
-	 0.448241,  0.448326,  0.448412,  0.448498,  0.448583,  0.448669,  0.448755,  0.448840,
-	 0.448926,  0.449012,  0.449097,  0.449183,  0.449269,  0.449354,  0.449440,  0.449526,
-	 0.449611,  0.449697,  0.449783,  0.449868,  0.449954,  0.450039,  0.450125,  0.450211,
-	 0.450296,  0.450382,  0.450467,  0.450553,  0.450639,  0.450724,  0.450810,  0.450895,
-	 0.450981,  0.451067,  0.451152,  0.451238,  0.451323,  0.451409,  0.451494,  0.451580,
-	 0.451665,  0.451751,  0.451836,  0.451922,  0.452008,  0.452093,  0.452179,  0.452264,
-	 0.452350,  0.452435,  0.452521,  0.452606,  0.452692,  0.452777,  0.452863,  0.452948,
-	 0.453033,  0.453119,  0.453204,  0.453290,  0.453375,  0.453461,  0.453546,  0.453632,
-	 0.453717,  0.453803,  0.453888,  0.453973,  0.454059,  0.454144,  0.454230,  0.454315,
-	 0.454400,  0.454486,  0.454571,  0.454657,  0.454742,  0.454827,  0.454913,  0.454998,
-	 0.455084,  0.455169,  0.455254,  0.455340,  0.455425,  0.455510,  0.455596,  0.455681,
-	 0.455766,  0.455852,  0.455937,  0.456022,  0.456108,  0.456193,  0.456278,  0.456364,
-	 0.456449,  0.456534,  0.456620,  0.456705,  0.456790,  0.456875,  0.456961,  0.457046,
-	 0.457131,  0.457217,  0.457302,  0.457387,  0.457472,  0.457558,  0.457643,  0.457728,
-	 0.457813,  0.457899,  0.457984,  0.458069,  0.458154,  0.458239,  0.458325,  0.458410,
-	 0.458495,  0.458580,  0.458665,  0.458751,  0.458836,  0.458921,  0.459006,  0.459091,
-	 0.459177,  0.459262,  0.459347,  0.459432,  0.459517,  0.459602,  0.459687,  0.459773,
-	 0.459858,  0.459943,  0.460028,  0.460113,  0.460198,  0.460283,  0.460369,  0.460454,
-	 0.460539,  0.460624,  0.460709,  0.460794,  0.460879,  0.460964,  0.461049,  0.461134,
-	 0.461219,  0.461304,  0.461390,  0.461475,  0.461560,  0.461645,  0.461730,  0.461815,
-	 0.461900,  0.461985,  0.462070,  0.462155,  0.462240,  0.462325,  0.462410,  0.462495,
-	 0.462580,  0.462665,  0.462750,  0.462835,  0.462920,  0.463005,  0.463090,  0.463175,
-	 0.463260,  0.463345,  0.463430,  0.463515,  0.463600,  0.463685,  0.463769,  0.463854,
-	 0.463939,  0.464024,  0.464109,  0.464194,  0.464279,  0.464364,  0.464449,  0.464534,
-	 0.464619,  0.464704,  0.464788,  0.464873,  0.464958,  0.465043,  0.465128,  0.465213,
-	 0.465298,  0.465383,  0.465467,  0.465552,  0.465637,  0.465722,  0.465807,  0.465892,
-	 0.465977,  0.466061,  0.466146,  0.466231,  0.466316,  0.466401,  0.466485,  0.466570,
-	 0.466655,  0.466740,  0.466825,  0.466909,  0.466994,  0.467079,  0.467164,  0.467248,
-	 0.467333,  0.467418,  0.467503,  0.467587,  0.467672,  0.467757,  0.467842,  0.467926,
-	 0.468011,  0.468096,  0.468181,  0.468265,  0.468350,  0.468435,  0.468519,  0.468604,
-	 0.468689,  0.468774,  0.468858,  0.468943,  0.469028,  0.469112,  0.469197,  0.469282,
-	 0.469366,  0.469451,  0.469536,  0.469620,  0.469705,  0.469789,  0.469874,  0.469959,
-	 0.470043,  0.470128,  0.470213,  0.470297,  0.470382,  0.470466,  0.470551,  0.470636,
-	 0.470720,  0.470805,  0.470889,  0.470974,  0.471058,  0.471143,  0.471228,  0.471312,
-	 0.471397,  0.471481,  0.471566,  0.471650,  0.471735,  0.471819,  0.471904,  0.471988,
-	 0.472073,  0.472158,  0.472242,  0.472327,  0.472411,  0.472496,  0.472580,  0.472665,
-	 0.472749,  0.472834,  0.472918,  0.473002,  0.473087,  0.473171,  0.473256,  0.473340,
-	 0.473425,  0.473509,  0.473594,  0.473678,  0.473763,  0.473847,  0.473931,  0.474016,
-	 0.474100,  0.474185,  0.474269,  0.474353,  0.474438,  0.474522,  0.474607,  0.474691,
-	 0.474775,  0.474860,  0.474944,  0.475029,  0.475113,  0.475197,  0.475282,  0.475366,
-	 0.475450,  0.475535,  0.475619,  0.475703,  0.475788,  0.475872,  0.475956,  0.476041,
-	 0.476125,  0.476209,  0.476294,  0.476378,  0.476462,  0.476546,  0.476631,  0.476715,
-	 0.476799,  0.476884,  0.476968,  0.477052,  0.477136,  0.477221,  0.477305,  0.477389,
-	 0.477473,  0.477558,  0.477642,  0.477726,  0.477810,  0.477894,  0.477979,  0.478063,
-	 0.478147,  0.478231,  0.478315,  0.478400,  0.478484,  0.478568,  0.478652,  0.478736,
-	 0.478821,  0.478905,  0.478989,  0.479073,  0.479157,  0.479241,  0.479325,  0.479410,
-	 0.479494,  0.479578,  0.479662,  0.479746,  0.479830,  0.479914,  0.479998,  0.480083,
-	 0.480167,  0.480251,  0.480335,  0.480419,  0.480503,  0.480587,  0.480671,  0.480755,
-	 0.480839,  0.480923,  0.481007,  0.481091,  0.481176,  0.481260,  0.481344,  0.481428,
-	 0.481512,  0.481596,  0.481680,  0.481764,  0.481848,  0.481932,  0.482016,  0.482100,
-	 0.482184,  0.482268,  0.482352,  0.482436,  0.482520,  0.482604,  0.482688,  0.482772,
-	 0.482856,  0.482940,  0.483023,  0.483107,  0.483191,  0.483275,  0.483359,  0.483443,
-	 0.483527,  0.483611,  0.483695,  0.483779,  0.483863,  0.483947,  0.484031,  0.484114,
-	 0.484198,  0.484282,  0.484366,  0.484450,  0.484534,  0.484618,  0.484702,  0.484785,
-	 0.484869,  0.484953,  0.485037,  0.485121,  0.485205,  0.485288,  0.485372,  0.485456,
-	 0.485540,  0.485624,  0.485708,  0.485791,  0.485875,  0.485959,  0.486043,  0.486126,
-	 0.486210,  0.486294,  0.486378,  0.486462,  0.486545,  0.486629,  0.486713,  0.486797,
-	 0.486880,  0.486964,  0.487048,  0.487132,  0.487215,  0.487299,  0.487383,  0.487466,
-	 0.487550,  0.487634,  0.487718,  0.487801,  0.487885,  0.487969,  0.488052,  0.488136,
-	 0.488220,  0.488303,  0.488387,  0.488471,  0.488554,  0.488638,  0.488722,  0.488805,
-	 0.488889,  0.488973,  0.489056,  0.489140,  0.489223,  0.489307,  0.489391,  0.489474,
-	 0.489558,  0.489641,  0.489725,  0.489809,  0.489892,  0.489976,  0.490059,  0.490143,
-	 0.490226,  0.490310,  0.490394,  0.490477,  0.490561,  0.490644,  0.490728,  0.490811,
-	 0.490895,  0.490978,  0.491062,  0.491145,  0.491229,  0.491312,  0.491396,  0.491479,
-	 0.491563,  0.491646,  0.491730,  0.491813,  0.491897,  0.491980,  0.492064,  0.492147,
-	 0.492231,  0.492314,  0.492398,  0.492481,  0.492564,  0.492648,  0.492731,  0.492815,
-	 0.492898,  0.492982,  0.493065,  0.493148,  0.493232,  0.493315,  0.493399,  0.493482,
-	 0.493565,  0.493649,  0.493732,  0.493816,  0.493899,  0.493982,  0.494066,  0.494149,
-	 0.494232,  0.494316,  0.494399,  0.494482,  0.494566,  0.494649,  0.494732,  0.494816,
-	 0.494899,  0.494982,  0.495066,  0.495149,  0.495232,  0.495315,  0.495399,  0.495482,
-	 0.495565,  0.495649,  0.495732,  0.495815,  0.495898,  0.495982,  0.496065,  0.496148,
-	 0.496231,  0.496315,  0.496398,  0.496481,  0.496564,  0.496647,  0.496731,  0.496814,
-	 0.496897,  0.496980,  0.497063,  0.497147,  0.497230,  0.497313,  0.497396,  0.497479,
-	 0.497562,  0.497646,  0.497729,  0.497812,  0.497895,  0.497978,  0.498061,  0.498145,
-	 0.498228,  0.498311,  0.498394,  0.498477,  0.498560,  0.498643,  0.498726,  0.498809,
-	 0.498893,  0.498976,  0.499059,  0.499142,  0.499225,  0.499308,  0.499391,  0.499474,
-	 0.499557,  0.499640,  0.499723,  0.499806,  0.499889,  0.499972,  0.500055,  0.500138,
-	 0.500221,  0.500304,  0.500387,  0.500470,  0.500553,  0.500636,  0.500719,  0.500802,
-	 0.500885,  0.500968,  0.501051,  0.501134,  0.501217,  0.501300,  0.501383,  0.501466,
-	 0.501549,  0.501632,  0.501715,  0.501798,  0.501881,  0.501964,  0.502047,  0.502130,
-	 0.502212,  0.502295,  0.502378,  0.502461,  0.502544,  0.502627,  0.502710,  0.502793,
-	 0.502876,  0.502958,  0.503041,  0.503124,  0.503207,  0.503290,  0.503373,  0.503456,
-	 0.503538,  0.503621,  0.503704,  0.503787,  0.503870,  0.503953,  0.504035,  0.504118,
-	 0.504201,  0.504284,  0.504366,  0.504449,  0.504532,  0.504615,  0.504698,  0.504780,
-	 0.504863,  0.504946,  0.505029,  0.505111,  0.505194,  0.505277,  0.505360,  0.505442,
-	 0.505525,  0.505608,  0.505690,  0.505773,  0.505856,  0.505939,  0.506021,  0.506104,
-	 0.506187,  0.506269,  0.506352,  0.506435,  0.506517,  0.506600,  0.506683,  0.506765,
-	 0.506848,  0.506931,  0.507013,  0.507096,  0.507179,  0.507261,  0.507344,  0.507426,
-	 0.507509,  0.507592,  0.507674,  0.507757,  0.507839,  0.507922,  0.508005,  0.508087,
-	 0.508170,  0.508252,  0.508335,  0.508417,  0.508500,  0.508583,  0.508665,  0.508748,
-	 0.508830,  0.508913,  0.508995,  0.509078,  0.509160,  0.509243,  0.509325,  0.509408,
-	 0.509490,  0.509573,  0.509655,  0.509738,  0.509820,  0.509903,  0.509985,  0.510068,
-	 0.510150,  0.510233,  0.510315,  0.510397,  0.510480,  0.510562,  0.510645,  0.510727,
-	 0.510810,  0.510892,  0.510974,  0.511057,  0.511139,  0.511222,  0.511304,  0.511386,
-	 0.511469,  0.511551,  0.511634,  0.511716,  0.511798,  0.511881,  0.511963,  0.512045,
-	 0.512128,  0.512210,  0.512292,  0.512375,  0.512457,  0.512539,  0.512622,  0.512704,
-	 0.512786,  0.512869,  0.512951,  0.513033,  0.513116,  0.513198,  0.513280,  0.513362,
-	 0.513445,  0.513527,  0.513609,  0.513692,  0.513774,  0.513856,  0.513938,  0.514021,
-	 0.514103,  0.514185,  0.514267,  0.514349,  0.514432,  0.514514,  0.514596,  0.514678,
-	 0.514760,  0.514843,  0.514925,  0.515007,  0.515089,  0.515171,  0.515254,  0.515336,
-	 0.515418,  0.515500,  0.515582,  0.515664,  0.515746,  0.515829,  0.515911,  0.515993,
-	 0.516075,  0.516157,  0.516239,  0.516321,  0.516403,  0.516486,  0.516568,  0.516650,
-	 0.516732,  0.516814,  0.516896,  0.516978,  0.517060,  0.517142,  0.517224,  0.517306,
-	 0.517388,  0.517470,  0.517552,  0.517634,  0.517716,  0.517798,  0.517880,  0.517963,
-	 0.518045,  0.518126,  0.518209,  0.518291,  0.518372,  0.518454,  0.518536,  0.518618,
-	 0.518700,  0.518782,  0.518864,  0.518946,  0.519028,  0.519110,  0.519192,  0.519274,
-	 0.519356,  0.519438,  0.519520,  0.519602,  0.519684,  0.519766,  0.519848,  0.519929,
-	 0.520011,  0.520093,  0.520175,  0.520257,  0.520339,  0.520421,  0.520503,  0.520584,
-	 0.520666,  0.520748,  0.520830,  0.520912,  0.520994,  0.521075,  0.521157,  0.521239,
-	 0.521321,  0.521403,  0.521485,  0.521566,  0.521648,  0.521730,  0.521812,  0.521894,
-	 0.521975,  0.522057,  0.522139,  0.522221,  0.522302,  0.522384,  0.522466,  0.522548,
-	 0.522629,  0.522711,  0.522793,  0.522875,  0.522956,  0.523038,  0.523120,  0.523201,
-	 0.523283,  0.523365,  0.523447,  0.523528,  0.523610,  0.523692,  0.523773,  0.523855,
-	 0.523937,  0.524018,  0.524100,  0.524181,  0.524263,  0.524345,  0.524426,  0.524508,
-	 0.524590,  0.524671,  0.524753,  0.524835,  0.524916,  0.524998,  0.525079,  0.525161,
-	 0.525243,  0.525324,  0.525406,  0.525487,  0.525569,  0.525650,  0.525732,  0.525813,
-	 0.525895,  0.525977,  0.526058,  0.526140,  0.526221,  0.526303,  0.526384,  0.526466,
-	 0.526547,  0.526629,  0.526710,  0.526792,  0.526873,  0.526955,  0.527036,  0.527118,
-	 0.527199,  0.527281,  0.527362,  0.527444,  0.527525,  0.527606,  0.527688,  0.527769,
-	 0.527851,  0.527932,  0.528014,  0.528095,  0.528176,  0.528258,  0.528339,  0.528421,
-	 0.528502,  0.528583,  0.528665,  0.528746,  0.528828,  0.528909,  0.528990,  0.529072,
-	 0.529153,  0.529234,  0.529316,  0.529397,  0.529478,  0.529560,  0.529641,  0.529722,
-	 0.529804,  0.529885,  0.529966,  0.530048,  0.530129,  0.530210,  0.530291,  0.530373,
-	 0.530454,  0.530535,  0.530617,  0.530698,  0.530779,  0.530860,  0.530942,  0.531023,
-	 0.531104,  0.531185,  0.531266,  0.531348,  0.531429,  0.531510,  0.531591,  0.531673,
-	 0.531754,  0.531835,  0.531916,  0.531997,  0.532078,  0.532160,  0.532241,  0.532322,
-	 0.532403,  0.532484,  0.532565,  0.532647,  0.532728,  0.532809,  0.532890,  0.532971,
-	 0.533052,  0.533133,  0.533214,  0.533296,  0.533377,  0.533458,  0.533539,  0.533620,
-	 0.533701,  0.533782,  0.533863,  0.533944,  0.534025,  0.534106,  0.534187,  0.534268,
-	 0.534349,  0.534431,  0.534512,  0.534593,  0.534674,  0.534755,  0.534836,  0.534917,
-	 0.534998,  0.535079,  0.535160,  0.535241,  0.535322,  0.535403,  0.535484,  0.535564,
-	 0.535645,  0.535726,  0.535807,  0.535888,  0.535969,  0.536050,  0.536131,  0.536212,
-	 0.536293,  0.536374,  0.536455,  0.536536,  0.536617,  0.536698,  0.536778,  0.536859,
-	 0.536940,  0.537021,  0.537102,  0.537183,  0.537264,  0.537345,  0.537425,  0.537506,
-	 0.537587,  0.537668,  0.537749,  0.537830,  0.537910,  0.537991,  0.538072,  0.538153,
-	 0.538234,  0.538314,  0.538395,  0.538476,  0.538557,  0.538638,  0.538718,  0.538799,
-	 0.538880,  0.538961,  0.539041,  0.539122,  0.539203,  0.539284,  0.539364,  0.539445,
-	 0.539526,  0.539607,  0.539687,  0.539768,  0.539849,  0.539929,  0.540010,  0.540091,
-	 0.540171,  0.540252,  0.540333,  0.540413,  0.540494,  0.540575,  0.540655,  0.540736,
-	 0.540817,  0.540897,  0.540978,  0.541059,  0.541139,  0.541220,  0.541301,  0.541381,
-	 0.541462,  0.541542,  0.541623,  0.541704,  0.541784,  0.541865,  0.541945,  0.542026,
-	 0.542106,  0.542187,  0.542268,  0.542348,  0.542429,  0.542509,  0.542590,  0.542670,
-	 0.542751,  0.542831,  0.542912,  0.542992,  0.543073,  0.543153,  0.543234,  0.543314,
-	 0.543395,  0.543475,  0.543556,  0.543636,  0.543717,  0.543797,  0.543878,  0.543958,
-	 0.544039,  0.544119,  0.544199,  0.544280,  0.544360,  0.544441,  0.544521,  0.544602,
-	 0.544682,  0.544762,  0.544843,  0.544923,  0.545003,  0.545084,  0.545164,  0.545245,
-	 0.545325,  0.545405,  0.545486,  0.545566,  0.545646,  0.545727,  0.545807,  0.545887,
-	 0.545968,  0.546048,  0.546128,  0.546209,  0.546289,  0.546369,  0.546450,  0.546530,
-	 0.546610,  0.546690,  0.546771,  0.546851,  0.546931,  0.547011,  0.547092,  0.547172,
-	 0.547252,  0.547333,  0.547413,  0.547493,  0.547573,  0.547653,  0.547734,  0.547814,
-	 0.547894,  0.547974,  0.548054,  0.548135,  0.548215,  0.548295,  0.548375,  0.548455,
-	 0.548536,  0.548616,  0.548696,  0.548776,  0.548856,  0.548936,  0.549016,  0.549097,
-	 0.549177,  0.549257,  0.549337,  0.549417,  0.549497,  0.549577,  0.549657,  0.549737,
-	 0.549818,  0.549898,  0.549978,  0.550058,  0.550138,  0.550218,  0.550298,  0.550378,
-	 0.550458,  0.550538,  0.550618,  0.550698,  0.550778,  0.550858,  0.550938,  0.551018,
-	 0.551098,  0.551178,  0.551258,  0.551338,  0.551418,  0.551498,  0.551578,  0.551658,
-	 0.551738,  0.551818,  0.551898,  0.551978,  0.552058,  0.552138,  0.552218,  0.552298,
-	 0.552378,  0.552457,  0.552537,  0.552617,  0.552697,  0.552777,  0.552857,  0.552937,
-	 0.553017,  0.553097,  0.553176,  0.553256,  0.553336,  0.553416,  0.553496,  0.553576,
-	 0.553656,  0.553735,  0.553815,  0.553895,  0.553975,  0.554055,  0.554134,  0.554214,
-	 0.554294,  0.554374,  0.554454,  0.554533,  0.554613,  0.554693,  0.554773,  0.554853,
-	 0.554932,  0.555012,  0.555092,  0.555172,  0.555251,  0.555331,  0.555411,  0.555490,
-	 0.555570,  0.555650,  0.555730,  0.555809,  0.555889,  0.555969,  0.556048,  0.556128,
-	 0.556208,  0.556287,  0.556367,  0.556447,  0.556526,  0.556606,  0.556686,  0.556765,
-	 0.556845,  0.556925,  0.557004,  0.557084,  0.557164,  0.557243,  0.557323,  0.557402,
-	 0.557482,  0.557562,  0.557641,  0.557721,  0.557800,  0.557880,  0.557959,  0.558039,
-	 0.558119,  0.558198,  0.558278,  0.558357,  0.558437,  0.558516,  0.558596,  0.558675,
-	 0.558755,  0.558834,  0.558914,  0.558993,  0.559073,  0.559152,  0.559232,  0.559311,
-	 0.559391,  0.559470,  0.559550,  0.559629,  0.559709,  0.559788,  0.559867,  0.559947,
-	 0.560026,  0.560106,  0.560185,  0.560265,  0.560344,  0.560423,  0.560503,  0.560582,
-	 0.560662,  0.560741,  0.560820,  0.560900,  0.560979,  0.561058,  0.561138,  0.561217,
-	 0.561297,  0.561376,  0.561455,  0.561535,  0.561614,  0.561693,  0.561773,  0.561852,
-	 0.561931,  0.562010,  0.562090,  0.562169,  0.562248,  0.562328,  0.562407,  0.562486,
-	 0.562565,  0.562645,  0.562724,  0.562803,  0.562882,  0.562962,  0.563041,  0.563120,
-	 0.563199,  0.563279,  0.563358,  0.563437,  0.563516,  0.563595,  0.563675,  0.563754,
-	 0.563833,  0.563912,  0.563991,  0.564070,  0.564150,  0.564229,  0.564308,  0.564387,
-	 0.564466,  0.564545,  0.564624,  0.564704,  0.564783,  0.564862,  0.564941,  0.565020,
-	 0.565099,  0.565178,  0.565257,  0.565336,  0.565416,  0.565495,  0.565574,  0.565653,
-	 0.565732,  0.565811,  0.565890,  0.565969,  0.566048,  0.566127,  0.566206,  0.566285,
-	 0.566364,  0.566443,  0.566522,  0.566601,  0.566680,  0.566759,  0.566838,  0.566917,
-	 0.566996,  0.567075,  0.567154,  0.567233,  0.567312,  0.567391,  0.567470,  0.567549,
-	 0.567628,  0.567707,  0.567786,  0.567864,  0.567943,  0.568022,  0.568101,  0.568180,
-	 0.568259,  0.568338,  0.568417,  0.568496,  0.568574,  0.568653,  0.568732,  0.568811,
-	 0.568890,  0.568969,  0.569048,  0.569126,  0.569205,  0.569284,  0.569363,  0.569442,
-	 0.569521,  0.569599,  0.569678,  0.569757,  0.569836,  0.569914,  0.569993,  0.570072,
-	 0.570151,  0.570230,  0.570308,  0.570387,  0.570466,  0.570545,  0.570623,  0.570702,
-	 0.570781,  0.570859,  0.570938,  0.571017,  0.571096,  0.571174,  0.571253,  0.571332,
-	 0.571410,  0.571489,  0.571568,  0.571646,  0.571725,  0.571804,  0.571882,  0.571961,
-	 0.572040,  0.572118,  0.572197,  0.572276,  0.572354,  0.572433,  0.572511,  0.572590,
-	 0.572669,  0.572747,  0.572826,  0.572904,  0.572983,  0.573061,  0.573140,  0.573219,
-	 0.573297,  0.573376,  0.573454,  0.573533,  0.573611,  0.573690,  0.573768,  0.573847,
-	 0.573925,  0.574004,  0.574082,  0.574161,  0.574239,  0.574318,  0.574396,  0.574475,
-	 0.574553,  0.574632,  0.574710,  0.574789,  0.574867,  0.574946,  0.575024,  0.575103,
-	 0.575181,  0.575259,  0.575338,  0.575416,  0.575495,  0.575573,  0.575651,  0.575730,
-	 0.575808,  0.575887,  0.575965,  0.576043,  0.576122,  0.576200,  0.576278,  0.576357,
-	 0.576435,  0.576513,  0.576592,  0.576670,  0.576748,  0.576827,  0.576905,  0.576983,
-	 0.577062,  0.577140,  0.577218,  0.577297,  0.577375,  0.577453,  0.577531,  0.577610,
-	 0.577688,  0.577766,  0.577844,  0.577923,  0.578001,  0.578079,  0.578157,  0.578236,
-	 0.578314,  0.578392,  0.578470,  0.578548,  0.578627,  0.578705,  0.578783,  0.578861,
-	 0.578939,  0.579018,  0.579096,  0.579174,  0.579252,  0.579330,  0.579408,  0.579486,
-	 0.579565,  0.579643,  0.579721,  0.579799,  0.579877,  0.579955,  0.580033,  0.580111,
-	 0.580189,  0.580267,  0.580346,  0.580424,  0.580502,  0.580580,  0.580658,  0.580736,
-	 0.580814,  0.580892,  0.580970,  0.581048,  0.581126,  0.581204,  0.581282,  0.581360,
-	 0.581438,  0.581516,  0.581594,  0.581672,  0.581750,  0.581828,  0.581906,  0.581984,
-	 0.582062,  0.582140,  0.582218,  0.582296,  0.582374,  0.582452,  0.582530,  0.582608,
-	 0.582685,  0.582763,  0.582841,  0.582919,  0.582997,  0.583075,  0.583153,  0.583231,
-	 0.583309,  0.583387,  0.583464,  0.583542,  0.583620,  0.583698,  0.583776,  0.583854,
-	 0.583931,  0.584009,  0.584087,  0.584165,  0.584243,  0.584321,  0.584398,  0.584476,
-	 0.584554,  0.584632,  0.584710,  0.584787,  0.584865,  0.584943,  0.585021,  0.585098,
-	 0.585176,  0.585254,  0.585332,  0.585409,  0.585487,  0.585565,  0.585642,  0.585720,
-	 0.585798,  0.585876,  0.585953,  0.586031,  0.586109,  0.586186,  0.586264,  0.586342,
-	 0.586419,  0.586497,  0.586575,  0.586652,  0.586730,  0.586808,  0.586885,  0.586963,
-	 0.587040,  0.587118,  0.587196,  0.587273,  0.587351,  0.587428,  0.587506,  0.587584,
-	 0.587661,  0.587739,  0.587816,  0.587894,  0.587971,  0.588049,  0.588126,  0.588204,
-	 0.588282,  0.588359,  0.588437,  0.588514,  0.588592,  0.588669,  0.588747,  0.588824,
-	 0.588902,  0.588979,  0.589057,  0.589134,  0.589212,  0.589289,  0.589366,  0.589444,
-	 0.589521,  0.589599,  0.589676,  0.589754,  0.589831,  0.589908,  0.589986,  0.590063,
-	 0.590141,  0.590218,  0.590295,  0.590373,  0.590450,  0.590528,  0.590605,  0.590682,
-	 0.590760,  0.590837,  0.590914,  0.590992,  0.591069,  0.591146,  0.591224,  0.591301,
-	 0.591378,  0.591456,  0.591533,  0.591610,  0.591688,  0.591765,  0.591842,  0.591919,
-	 0.591997,  0.592074,  0.592151,  0.592228,  0.592306,  0.592383,  0.592460,  0.592537,
-	 0.592615,  0.592692,  0.592769,  0.592846,  0.592924,  0.593001,  0.593078,  0.593155,
-	 0.593232,  0.593309,  0.593387,  0.593464,  0.593541,  0.593618,  0.593695,  0.593772,
-	 0.593850,  0.593927,  0.594004,  0.594081,  0.594158,  0.594235,  0.594312,  0.594389,
-	 0.594467,  0.594544,  0.594621,  0.594698,  0.594775,  0.594852,  0.594929,  0.595006,
-	 0.595083,  0.595160,  0.595237,  0.595314,  0.595391,  0.595468,  0.595545,  0.595622,
-	 0.595699,  0.595776,  0.595853,  0.595930,  0.596007,  0.596084,  0.596161,  0.596238,
-	 0.596315,  0.596392,  0.596469,  0.596546,  0.596623,  0.596700,  0.596777,  0.596854,
-	 0.596931,  0.597008,  0.597085,  0.597161,  0.597238,  0.597315,  0.597392,  0.597469,
-	 0.597546,  0.597623,  0.597700,  0.597776,  0.597853,  0.597930,  0.598007,  0.598084,
-	 0.598161,  0.598238,  0.598314,  0.598391,  0.598468,  0.598545,  0.598622,  0.598698,
-	 0.598775,  0.598852,  0.598929,  0.599006,  0.599082,  0.599159,  0.599236,  0.599313,
-	 0.599389,  0.599466,  0.599543,  0.599620,  0.599696,  0.599773,  0.599850,  0.599926,
-	 0.600003,  0.600080,  0.600156,  0.600233,  0.600310,  0.600387,  0.600463,  0.600540,
-	 0.600616,  0.600693,  0.600770,  0.600846,  0.600923,  0.601000,  0.601076,  0.601153,
-	 0.601230,  0.601306,  0.601383,  0.601459,  0.601536,  0.601613,  0.601689,  0.601766,
-	 0.601842,  0.601919,  0.601995,  0.602072,  0.602148,  0.602225,  0.602302,  0.602378,
-	 0.602455,  0.602531,  0.602608,  0.602684,  0.602761,  0.602837,  0.602914,  0.602990,
-	 0.603067,  0.603143,  0.603220,  0.603296,  0.603372,  0.603449,  0.603525,  0.603602,
-	 0.603678,  0.603755,  0.603831,  0.603908,  0.603984,  0.604060,  0.604137,  0.604213,
-	 0.604290,  0.604366,  0.604442,  0.604519,  0.604595,  0.604671,  0.604748,  0.604824,
-	 0.604900,  0.604977,  0.605053,  0.605129,  0.605206,  0.605282,  0.605358,  0.605435,
-	 0.605511,  0.605587,  0.605664,  0.605740,  0.605816,  0.605892,  0.605969,  0.606045,
-	 0.606121,  0.606198,  0.606274,  0.606350,  0.606426,  0.606502,  0.606579,  0.606655,
-	 0.606731,  0.606807,  0.606884,  0.606960,  0.607036,  0.607112,  0.607188,  0.607264,
-	 0.607341,  0.607417,  0.607493,  0.607569,  0.607645,  0.607721,  0.607798,  0.607874,
-	 0.607950,  0.608026,  0.608102,  0.608178,  0.608254,  0.608330,  0.608406,  0.608482,
-	 0.608559,  0.608635,  0.608711,  0.608787,  0.608863,  0.608939,  0.609015,  0.609091,
-	 0.609167,  0.609243,  0.609319,  0.609395,  0.609471,  0.609547,  0.609623,  0.609699,
-	 0.609775,  0.609851,  0.609927,  0.610003,  0.610079,  0.610155,  0.610231,  0.610307,
-	 0.610383,  0.610459,  0.610535,  0.610611,  0.610687,  0.610762,  0.610838,  0.610914,
-	 0.610990,  0.611066,  0.611142,  0.611218,  0.611294,  0.611370,  0.611445,  0.611521,
-	 0.611597,  0.611673,  0.611749,  0.611825,  0.611901,  0.611976,  0.612052,  0.612128,
-	 0.612204,  0.612280,  0.612355,  0.612431,  0.612507,  0.612583,  0.612659,  0.612734,
-	 0.612810,  0.612886,  0.612962,  0.613037,  0.613113,  0.613189,  0.613265,  0.613340,
-	 0.613416,  0.613492,  0.613567,  0.613643,  0.613719,  0.613795,  0.613870,  0.613946,
-	 0.614022,  0.614097,  0.614173,  0.614249,  0.614324,  0.614400,  0.614475,  0.614551,
-	 0.614627,  0.614702,  0.614778,  0.614854,  0.614929,  0.615005,  0.615080,  0.615156,
-	 0.615232,  0.615307,  0.615383,  0.615458,  0.615534,  0.615609,  0.615685,  0.615761,
-	 0.615836,  0.615912,  0.615987,  0.616063,  0.616138,  0.616214,  0.616289,  0.616365,
-	 0.616440,  0.616516,  0.616591,  0.616667,  0.616742,  0.616818,  0.616893,  0.616968,
-	 0.617044,  0.617119,  0.617195,  0.617270,  0.617346,  0.617421,  0.617496,  0.617572,
-	 0.617647,  0.617723,  0.617798,  0.617873,  0.617949,  0.618024,  0.618100,  0.618175,
-	 0.618250,  0.618326,  0.618401,  0.618476,  0.618552,  0.618627,  0.618702,  0.618778,
-	 0.618853,  0.618928,  0.619004,  0.619079,  0.619154,  0.619229,  0.619305,  0.619380,
-	 0.619455,  0.619531,  0.619606,  0.619681,  0.619756,  0.619832,  0.619907,  0.619982,
-	 0.620057,  0.620132,  0.620208,  0.620283,  0.620358,  0.620433,  0.620508,  0.620584,
-	 0.620659,  0.620734,  0.620809,  0.620884,  0.620959,  0.621035,  0.621110,  0.621185,
-	 0.621260,  0.621335,  0.621410,  0.621485,  0.621560,  0.621636,  0.621711,  0.621786,
-	 0.621861,  0.621936,  0.622011,  0.622086,  0.622161,  0.622236,  0.622311,  0.622386,
-	 0.622461,  0.622536,  0.622611,  0.622686,  0.622761,  0.622836,  0.622911,  0.622986,
-	 0.623061,  0.623136,  0.623211,  0.623286,  0.623361,  0.623436,  0.623511,  0.623586,
-	 0.623661,  0.623736,  0.623811,  0.623886,  0.623961,  0.624036,  0.624111,  0.624186,
-	 0.624260,  0.624335,  0.624410,  0.624485,  0.624560,  0.624635,  0.624710,  0.624785,
-	 0.624860,  0.624934,  0.625009,  0.625084,  0.625159,  0.625234,  0.625309,  0.625383,
-	 0.625458,  0.625533,  0.625608,  0.625683,  0.625757,  0.625832,  0.625907,  0.625982,
-	 0.626056,  0.626131,  0.626206,  0.626281,  0.626355,  0.626430,  0.626505,  0.626580,
-	 0.626654,  0.626729,  0.626804,  0.626878,  0.626953,  0.627028,  0.627102,  0.627177,
-	 0.627252,  0.627326,  0.627401,  0.627476,  0.627550,  0.627625,  0.627700,  0.627774,
-	 0.627849,  0.627924,  0.627998,  0.628073,  0.628147,  0.628222,  0.628297,  0.628371,
-	 0.628446,  0.628520,  0.628595,  0.628669,  0.628744,  0.628819,  0.628893,  0.628968,
-	 0.629042,  0.629117,  0.629191,  0.629266,  0.629340,  0.629415,  0.629489,  0.629564,
-	 0.629638,  0.629713,  0.629787,  0.629862,  0.629936,  0.630011,  0.630085,  0.630159,
-	 0.630234,  0.630308,  0.630383,  0.630457,  0.630532,  0.630606,  0.630680,  0.630755,
-	 0.630829,  0.630904,  0.630978,  0.631052,  0.631127,  0.631201,  0.631275,  0.631350,
-	 0.631424,  0.631499,  0.631573,  0.631647,  0.631721,  0.631796,  0.631870,  0.631944,
-	 0.632019,  0.632093,  0.632167,  0.632242,  0.632316,  0.632390,  0.632464,  0.632539,
-	 0.632613,  0.632687,  0.632761,  0.632836,  0.632910,  0.632984,  0.633058,  0.633133,
-	 0.633207,  0.633281,  0.633355,  0.633429,  0.633504,  0.633578,  0.633652,  0.633726,
-	 0.633800,  0.633874,  0.633949,  0.634023,  0.634097,  0.634171,  0.634245,  0.634319,
-	 0.634393,  0.634467,  0.634542,  0.634616,  0.634690,  0.634764,  0.634838,  0.634912,
-	 0.634986,  0.635060,  0.635134,  0.635208,  0.635282,  0.635356,  0.635430,  0.635504,
-	 0.635578,  0.635652,  0.635726,  0.635800,  0.635874,  0.635948,  0.636022,  0.636096,
-	 0.636170,  0.636244,  0.636318,  0.636392,  0.636466,  0.636540,  0.636614,  0.636688,
-	 0.636762,  0.636836,  0.636910,  0.636984,  0.637057,  0.637131,  0.637205,  0.637279,
-	 0.637353,  0.637427,  0.637501,  0.637575,  0.637649,  0.637722,  0.637796,  0.637870,
-	 0.637944,  0.638018,  0.638092,  0.638165,  0.638239,  0.638313,  0.638387,  0.638461,
-	 0.638534,  0.638608,  0.638682,  0.638756,  0.638829,  0.638903,  0.638977,  0.639051,
-	 0.639124,  0.639198,  0.639272,  0.639346,  0.639419,  0.639493,  0.639567,  0.639640,
-	 0.639714,  0.639788,  0.639862,  0.639935,  0.640009,  0.640083,  0.640156,  0.640230,
-	 0.640303,  0.640377,  0.640451,  0.640524,  0.640598,  0.640672,  0.640745,  0.640819,
-	 0.640892,  0.640966,  0.641040,  0.641113,  0.641187,  0.641260,  0.641334,  0.641407,
-	 0.641481,  0.641555,  0.641628,  0.641702,  0.641775,  0.641849,  0.641922,  0.641996,
-	 0.642069,  0.642143,  0.642216,  0.642290,  0.642363,  0.642437,  0.642510,  0.642584,
-	 0.642657,  0.642730,  0.642804,  0.642877,  0.642951,  0.643024,  0.643098,  0.643171,
-	 0.643245,  0.643318,  0.643391,  0.643465,  0.643538,  0.643611,  0.643685,  0.643758,
-	 0.643832,  0.643905,  0.643978,  0.644052,  0.644125,  0.644198,  0.644272,  0.644345,
-	 0.644418,  0.644492,  0.644565,  0.644638,  0.644711,  0.644785,  0.644858,  0.644931,
-	 0.645005,  0.645078,  0.645151,  0.645224,  0.645298,  0.645371,  0.645444,  0.645517,
-	 0.645590,  0.645664,  0.645737,  0.645810,  0.645883,  0.645956,  0.646030,  0.646103,
-	 0.646176,  0.646249,  0.646322,  0.646396,  0.646469,  0.646542,  0.646615,  0.646688,
-	 0.646761,  0.646834,  0.646907,  0.646981,  0.647054,  0.647127,  0.647200,  0.647273,
-	 0.647346,  0.647419,  0.647492,  0.647565,  0.647638,  0.647711,  0.647784,  0.647857,
-	 0.647930,  0.648003,  0.648076,  0.648149,  0.648222,  0.648295,  0.648368,  0.648441,
-	 0.648514,  0.648587,  0.648660,  0.648733,  0.648806,  0.648879,  0.648952,  0.649025,
-	 0.649098,  0.649171,  0.649244,  0.649317,  0.649390,  0.649463,  0.649536,  0.649608,
-	 0.649681,  0.649754,  0.649827,  0.649900,  0.649973,  0.650046,  0.650119,  0.650191,
-	 0.650264,  0.650337,  0.650410,  0.650483,  0.650555,  0.650628,  0.650701,  0.650774,
-	 0.650847,  0.650919,  0.650992,  0.651065,  0.651138,  0.651211,  0.651283,  0.651356,
-	 0.651429,  0.651502,  0.651574,  0.651647,  0.651720,  0.651792,  0.651865,  0.651938,
-	 0.652011,  0.652083,  0.652156,  0.652229,  0.652301,  0.652374,  0.652447,  0.652519,
-	 0.652592,  0.652665,  0.652737,  0.652810,  0.652882,  0.652955,  0.653028,  0.653100,
-	 0.653173,  0.653245,  0.653318,  0.653391,  0.653463,  0.653536,  0.653608,  0.653681,
-	 0.653753,  0.653826,  0.653899,  0.653971,  0.654044,  0.654116,  0.654189,  0.654261,
-	 0.654334,  0.654406,  0.654479,  0.654551,  0.654624,  0.654696,  0.654769,  0.654841,
-	 0.654913,  0.654986,  0.655058,  0.655131,  0.655203,  0.655276,  0.655348,  0.655420,
-	 0.655493,  0.655565,  0.655638,  0.655710,  0.655782,  0.655855,  0.655927,  0.656000,
-	 0.656072,  0.656144,  0.656217,  0.656289,  0.656361,  0.656434,  0.656506,  0.656578,
-	 0.656651,  0.656723,  0.656795,  0.656867,  0.656940,  0.657012,  0.657084,  0.657157,
-	 0.657229,  0.657301,  0.657373,  0.657446,  0.657518,  0.657590,  0.657662,  0.657734,
-	 0.657807,  0.657879,  0.657951,  0.658023,  0.658095,  0.658168,  0.658240,  0.658312,
-	 0.658384,  0.658456,  0.658529,  0.658601,  0.658673,  0.658745,  0.658817,  0.658889,
-	 0.658961,  0.659033,  0.659105,  0.659178,  0.659250,  0.659322,  0.659394,  0.659466,
-	 0.659538,  0.659610,  0.659682,  0.659754,  0.659826,  0.659898,  0.659970,  0.660042,
-	 0.660114,  0.660186,  0.660258,  0.660330,  0.660402,  0.660474,  0.660546,  0.660618,
-	 0.660690,  0.660762,  0.660834,  0.660906,  0.660978,  0.661050,  0.661122,  0.661194,
-	 0.661266,  0.661338,  0.661410,  0.661482,  0.661553,  0.661625,  0.661697,  0.661769,
-	 0.661841,  0.661913,  0.661985,  0.662057,  0.662128,  0.662200,  0.662272,  0.662344,
-	 0.662416,  0.662488,  0.662559,  0.662631,  0.662703,  0.662775,  0.662847,  0.662918,
-	 0.662990,  0.663062,  0.663134,  0.663205,  0.663277,  0.663349,  0.663421,  0.663492,
-	 0.663564,  0.663636,  0.663708,  0.663779,  0.663851,  0.663923,  0.663994,  0.664066,
-	 0.664138,  0.664209,  0.664281,  0.664353,  0.664424,  0.664496,  0.664568,  0.664639,
-	 0.664711,  0.664783,  0.664854,  0.664926,  0.664997,  0.665069,  0.665141,  0.665212,
-	 0.665284,  0.665355,  0.665427,  0.665498,  0.665570,  0.665642,  0.665713,  0.665785,
-	 0.665856,  0.665928,  0.665999,  0.666071,  0.666142,  0.666214,  0.666285,  0.666357,
-	 0.666428,  0.666500,  0.666571,  0.666643,  0.666714,  0.666786,  0.666857,  0.666928,
-	 0.667000,  0.667071,  0.667143,  0.667214,  0.667286,  0.667357,  0.667428,  0.667500,
-	 0.667571,  0.667643,  0.667714,  0.667785,  0.667857,  0.667928,  0.667999,  0.668071,
-	 0.668142,  0.668213,  0.668285,  0.668356,  0.668427,  0.668499,  0.668570,  0.668641,
-	 0.668712,  0.668784,  0.668855,  0.668926,  0.668998,  0.669069,  0.669140,  0.669211,
-	 0.669283,  0.669354,  0.669425,  0.669496,  0.669567,  0.669639,  0.669710,  0.669781,
-	 0.669852,  0.669923,  0.669995,  0.670066,  0.670137,  0.670208,  0.670279,  0.670350,
-	 0.670422,  0.670493,  0.670564,  0.670635,  0.670706,  0.670777,  0.670848,  0.670919,
-	 0.670990,  0.671062,  0.671133,  0.671204,  0.671275,  0.671346,  0.671417,  0.671488,
-	 0.671559,  0.671630,  0.671701,  0.671772,  0.671843,  0.671914,  0.671985,  0.672056,
-	 0.672127,  0.672198,  0.672269,  0.672340,  0.672411,  0.672482,  0.672553,  0.672624,
-	 0.672695,  0.672766,  0.672837,  0.672908,  0.672978,  0.673049,  0.673120,  0.673191,
-	 0.673262,  0.673333,  0.673404,  0.673475,  0.673546,  0.673616,  0.673687,  0.673758,
-	 0.673829,  0.673900,  0.673971,  0.674042,  0.674112,  0.674183,  0.674254,  0.674325,
-	 0.674396,  0.674466,  0.674537,  0.674608,  0.674679,  0.674749,  0.674820,  0.674891,
-	 0.674962,  0.675032,  0.675103,  0.675174,  0.675245,  0.675315,  0.675386,  0.675457,
-	 0.675527,  0.675598,  0.675669,  0.675739,  0.675810,  0.675881,  0.675951,  0.676022,
-	 0.676093,  0.676163,  0.676234,  0.676305,  0.676375,  0.676446,  0.676516,  0.676587,
-	 0.676658,  0.676728,  0.676799,  0.676869,  0.676940,  0.677011,  0.677081,  0.677152,
-	 0.677222,  0.677293,  0.677363,  0.677434,  0.677504,  0.677575,  0.677645,  0.677716,
-	 0.677786,  0.677857,  0.677927,  0.677998,  0.678068,  0.678139,  0.678209,  0.678280,
-	 0.678350,  0.678420,  0.678491,  0.678561,  0.678632,  0.678702,  0.678773,  0.678843,
-	 0.678913,  0.678984,  0.679054,  0.679125,  0.679195,  0.679265,  0.679336,  0.679406,
-	 0.679476,  0.679547,  0.679617,  0.679687,  0.679758,  0.679828,  0.679898,  0.679969,
-	 0.680039,  0.680109,  0.680179,  0.680250,  0.680320,  0.680390,  0.680461,  0.680531,
-	 0.680601,  0.680671,  0.680741,  0.680812,  0.680882,  0.680952,  0.681022,  0.681093,
-	 0.681163,  0.681233,  0.681303,  0.681373,  0.681443,  0.681514,  0.681584,  0.681654,
-	 0.681724,  0.681794,  0.681864,  0.681934,  0.682005,  0.682075,  0.682145,  0.682215,
-	 0.682285,  0.682355,  0.682425,  0.682495,  0.682565,  0.682635,  0.682705,  0.682775,
-	 0.682846,  0.682916,  0.682986,  0.683056,  0.683126,  0.683196,  0.683266,  0.683336,
-	 0.683406,  0.683476,  0.683546,  0.683616,  0.683686,  0.683756,  0.683825,  0.683895,
-	 0.683965,  0.684035,  0.684105,  0.684175,  0.684245,  0.684315,  0.684385,  0.684455,
-	 0.684525,  0.684595,  0.684664,  0.684734,  0.684804,  0.684874,  0.684944,  0.685014,
-	 0.685084,  0.685153,  0.685223,  0.685293,  0.685363,  0.685433,  0.685503,  0.685572,
-	 0.685642,  0.685712,  0.685782,  0.685852,  0.685921,  0.685991,  0.686061,  0.686131,
-	 0.686200,  0.686270,  0.686340,  0.686409,  0.686479,  0.686549,  0.686619,  0.686688,
-	 0.686758,  0.686828,  0.686897,  0.686967,  0.687037,  0.687106,  0.687176,  0.687246,
-	 0.687315,  0.687385,  0.687455,  0.687524,  0.687594,  0.687663,  0.687733,  0.687803,
-	 0.687872,  0.687942,  0.688011,  0.688081,  0.688151,  0.688220,  0.688290,  0.688359,
-	 0.688429,  0.688498,  0.688568,  0.688637,  0.688707,  0.688776,  0.688846,  0.688915,
-	 0.688985,  0.689054,  0.689124,  0.689193,  0.689263,  0.689332,  0.689402,  0.689471,
-	 0.689541,  0.689610,  0.689679,  0.689749,  0.689818,  0.689888,  0.689957,  0.690026,
-	 0.690096,  0.690165,  0.690235,  0.690304,  0.690373,  0.690443,  0.690512,  0.690581,
-	 0.690651,  0.690720,  0.690789,  0.690859,  0.690928,  0.690997,  0.691067,  0.691136,
-	 0.691205,  0.691274,  0.691344,  0.691413,  0.691482,  0.691552,  0.691621,  0.691690,
-	 0.691759,  0.691828,  0.691898,  0.691967,  0.692036,  0.692105,  0.692175,  0.692244,
-	 0.692313,  0.692382,  0.692451,  0.692520,  0.692590,  0.692659,  0.692728,  0.692797,
-	 0.692866,  0.692935,  0.693004,  0.693074,  0.693143,  0.693212,  0.693281,  0.693350,
-	 0.693419,  0.693488,  0.693557,  0.693626,  0.693695,  0.693764,  0.693833,  0.693902,
-	 0.693971,  0.694040,  0.694109,  0.694179,  0.694248,  0.694317,  0.694386,  0.694454,
-	 0.694524,  0.694592,  0.694661,  0.694730,  0.694799,  0.694868,  0.694937,  0.695006,
-	 0.695075,  0.695144,  0.695213,  0.695282,  0.695351,  0.695420,  0.695489,  0.695557,
-	 0.695626,  0.695695,  0.695764,  0.695833,  0.695902,  0.695971,  0.696039,  0.696108,
-	 0.696177,  0.696246,  0.696315,  0.696384,  0.696452,  0.696521,  0.696590,  0.696659,
-	 0.696728,  0.696796,  0.696865,  0.696934,  0.697003,  0.697071,  0.697140,  0.697209,
-	 0.697277,  0.697346,  0.697415,  0.697484,  0.697552,  0.697621,  0.697690,  0.697758,
-	 0.697827,  0.697896,  0.697964,  0.698033,  0.698102,  0.698170,  0.698239,  0.698308,
-	 0.698376,  0.698445,  0.698513,  0.698582,  0.698651,  0.698719,  0.698788,  0.698856,
-	 0.698925,  0.698994,  0.699062,  0.699131,  0.699199,  0.699268,  0.699336,  0.699405,
-	 0.699473,  0.699542,  0.699610,  0.699679,  0.699747,  0.699816,  0.699884,  0.699953,
-	 0.700021,  0.700090,  0.700158,  0.700227,  0.700295,  0.700364,  0.700432,  0.700500,
-	 0.700569,  0.700637,  0.700706,  0.700774,  0.700842,  0.700911,  0.700979,  0.701048,
-	 0.701116,  0.701184,  0.701253,  0.701321,  0.701389,  0.701458,  0.701526,  0.701594,
-	 0.701663,  0.701731,  0.701799,  0.701868,  0.701936,  0.702004,  0.702072,  0.702141,
-	 0.702209,  0.702277,  0.702345,  0.702414,  0.702482,  0.702550,  0.702618,  0.702687,
-	 0.702755,  0.702823,  0.702891,  0.702959,  0.703028,  0.703096,  0.703164,  0.703232,
-	 0.703300,  0.703368,  0.703436,  0.703505,  0.703573,  0.703641,  0.703709,  0.703777,
-	 0.703845,  0.703913,  0.703981,  0.704050,  0.704118,  0.704186,  0.704254,  0.704322,
-	 0.704390,  0.704458,  0.704526,  0.704594,  0.704662,  0.704730,  0.704798,  0.704866,
-	 0.704934,  0.705002,  0.705070,  0.705138,  0.705206,  0.705274,  0.705342,  0.705410,
-	 0.705478,  0.705546,  0.705614,  0.705682,  0.705750,  0.705818,  0.705885,  0.705953,
-	 0.706021,  0.706089,  0.706157,  0.706225,  0.706293,  0.706361,  0.706429,  0.706496,
-	 0.706564,  0.706632,  0.706700,  0.706768,  0.706836,  0.706903,  0.706971,  0.707039,
-	 0.707107,  0.707175,  0.707242,  0.707310,  0.707378,  0.707446,  0.707513,  0.707581,
-	 0.707649,  0.707717,  0.707784,  0.707852,  0.707920,  0.707988,  0.708055,  0.708123,
-	 0.708191,  0.708258,  0.708326,  0.708394,  0.708461,  0.708529,  0.708597,  0.708664,
-	 0.708732,  0.708800,  0.708867,  0.708935,  0.709002,  0.709070,  0.709138,  0.709205,
-	 0.709273,  0.709340,  0.709408,  0.709476,  0.709543,  0.709611,  0.709678,  0.709746,
-	 0.709813,  0.709881,  0.709948,  0.710016,  0.710083,  0.710151,  0.710218,  0.710286,
-	 0.710353,  0.710421,  0.710488,  0.710556,  0.710623,  0.710691,  0.710758,  0.710826,
-	 0.710893,  0.710960,  0.711028,  0.711095,  0.711163,  0.711230,  0.711297,  0.711365,
-	 0.711432,  0.711500,  0.711567,  0.711634,  0.711702,  0.711769,  0.711836,  0.711904,
-	 0.711971,  0.712038,  0.712106,  0.712173,  0.712240,  0.712308,  0.712375,  0.712442,
-	 0.712509,  0.712577,  0.712644,  0.712711,  0.712778,  0.712846,  0.712913,  0.712980,
-	 0.713047,  0.713115,  0.713182,  0.713249,  0.713316,  0.713383,  0.713451,  0.713518,
-	 0.713585,  0.713652,  0.713719,  0.713786,  0.713853,  0.713921,  0.713988,  0.714055,
-	 0.714122,  0.714189,  0.714256,  0.714323,  0.714390,  0.714457,  0.714525,  0.714592,
-	 0.714659,  0.714726,  0.714793,  0.714860,  0.714927,  0.714994,  0.715061,  0.715128,
-	 0.715195,  0.715262,  0.715329,  0.715396,  0.715463,  0.715530,  0.715597,  0.715664,
-	 0.715731,  0.715798,  0.715865,  0.715932,  0.715999,  0.716066,  0.716132,  0.716199,
-	 0.716266,  0.716333,  0.716400,  0.716467,  0.716534,  0.716601,  0.716668,  0.716734,
-	 0.716801,  0.716868,  0.716935,  0.717002,  0.717069,  0.717135,  0.717202,  0.717269,
-	 0.717336,  0.717403,  0.717469,  0.717536,  0.717603,  0.717670,  0.717737,  0.717803,
-	 0.717870,  0.717937,  0.718004,  0.718070,  0.718137,  0.718204,  0.718270,  0.718337,
-	 0.718404,  0.718471,  0.718537,  0.718604,  0.718670,  0.718737,  0.718804,  0.718870,
-	 0.718937,  0.719004,  0.719070,  0.719137,  0.719204,  0.719270,  0.719337,  0.719403,
-	 0.719470,  0.719537,  0.719603,  0.719670,  0.719736,  0.719803,  0.719869,  0.719936,
-	 0.720003,  0.720069,  0.720136,  0.720202,  0.720269,  0.720335,  0.720402,  0.720468,
-	 0.720535,  0.720601,  0.720668,  0.720734,  0.720800,  0.720867,  0.720933,  0.721000,
-	 0.721066,  0.721133,  0.721199,  0.721265,  0.721332,  0.721398,  0.721465,  0.721531,
-	 0.721597,  0.721664,  0.721730,  0.721797,  0.721863,  0.721929,  0.721996,  0.722062,
-	 0.722128,  0.722194,  0.722261,  0.722327,  0.722393,  0.722460,  0.722526,  0.722592,
-	 0.722659,  0.722725,  0.722791,  0.722857,  0.722924,  0.722990,  0.723056,  0.723122,
-	 0.723188,  0.723255,  0.723321,  0.723387,  0.723453,  0.723520,  0.723586,  0.723652,
-	 0.723718,  0.723784,  0.723850,  0.723916,  0.723983,  0.724049,  0.724115,  0.724181,
-	 0.724247,  0.724313,  0.724379,  0.724445,  0.724511,  0.724578,  0.724644,  0.724710,
-	 0.724776,  0.724842,  0.724908,  0.724974,  0.725040,  0.725106,  0.725172,  0.725238,
-	 0.725304,  0.725370,  0.725436,  0.725502,  0.725568,  0.725634,  0.725700,  0.725766,
-	 0.725832,  0.725898,  0.725964,  0.726030,  0.726095,  0.726161,  0.726227,  0.726293,
-	 0.726359,  0.726425,  0.726491,  0.726557,  0.726623,  0.726689,  0.726754,  0.726820,
-	 0.726886,  0.726952,  0.727018,  0.727084,  0.727149,  0.727215,  0.727281,  0.727347,
-	 0.727413,  0.727478,  0.727544,  0.727610,  0.727676,  0.727741,  0.727807,  0.727873,
-	 0.727939,  0.728004,  0.728070,  0.728136,  0.728202,  0.728267,  0.728333,  0.728399,
-	 0.728464,  0.728530,  0.728596,  0.728661,  0.728727,  0.728793,  0.728858,  0.728924,
-	 0.728990,  0.729055,  0.729121,  0.729186,  0.729252,  0.729318,  0.729383,  0.729449,
-	 0.729514,  0.729580,  0.729646,  0.729711,  0.729777,  0.729842,  0.729908,  0.729973,
-	 0.730039,  0.730104,  0.730170,  0.730235,  0.730301,  0.730366,  0.730432,  0.730497,
-	 0.730563,  0.730628,  0.730694,  0.730759,  0.730825,  0.730890,  0.730955,  0.731021,
-	 0.731086,  0.731152,  0.731217,  0.731282,  0.731348,  0.731413,  0.731479,  0.731544,
-	 0.731609,  0.731675,  0.731740,  0.731805,  0.731871,  0.731936,  0.732001,  0.732067,
-	 0.732132,  0.732197,  0.732263,  0.732328,  0.732393,  0.732458,  0.732524,  0.732589,
-	 0.732654,  0.732720,  0.732785,  0.732850,  0.732915,  0.732980,  0.733046,  0.733111,
-	 0.733176,  0.733241,  0.733306,  0.733372,  0.733437,  0.733502,  0.733567,  0.733632,
-	 0.733697,  0.733763,  0.733828,  0.733893,  0.733958,  0.734023,  0.734088,  0.734153,
-	 0.734218,  0.734283,  0.734349,  0.734414,  0.734479,  0.734544,  0.734609,  0.734674,
-	 0.734739,  0.734804,  0.734869,  0.734934,  0.734999,  0.735064,  0.735129,  0.735194,
-	 0.735259,  0.735324,  0.735389,  0.735454,  0.735519,  0.735584,  0.735649,  0.735714,
-	 0.735779,  0.735844,  0.735908,  0.735973,  0.736038,  0.736103,  0.736168,  0.736233,
-	 0.736298,  0.736363,  0.736428,  0.736492,  0.736557,  0.736622,  0.736687,  0.736752,
-	 0.736817,  0.736881,  0.736946,  0.737011,  0.737076,  0.737141,  0.737205,  0.737270,
-	 0.737335,  0.737400,  0.737464,  0.737529,  0.737594,  0.737659,  0.737723,  0.737788,
-	 0.737853,  0.737918,  0.737982,  0.738047,  0.738112,  0.738176,  0.738241,  0.738306,
-	 0.738370,  0.738435,  0.738500,  0.738564,  0.738629,  0.738693,  0.738758,  0.738823,
-	 0.738887,  0.738952,  0.739017,  0.739081,  0.739146,  0.739210,  0.739275,  0.739339,
-	 0.739404,  0.739468,  0.739533,  0.739598,  0.739662,  0.739727,  0.739791,  0.739856,
-	 0.739920,  0.739985,  0.740049,  0.740114,  0.740178,  0.740242,  0.740307,  0.740371,
-	 0.740436,  0.740500,  0.740565,  0.740629,  0.740694,  0.740758,  0.740822,  0.740887,
-	 0.740951,  0.741015,  0.741080,  0.741144,  0.741209,  0.741273,  0.741337,  0.741402,
-	 0.741466,  0.741530,  0.741595,  0.741659,  0.741723,  0.741788,  0.741852,  0.741916,
-	 0.741980,  0.742045,  0.742109,  0.742173,  0.742237,  0.742302,  0.742366,  0.742430,
-	 0.742494,  0.742559,  0.742623,  0.742687,  0.742751,  0.742815,  0.742880,  0.742944,
-	 0.743008,  0.743072,  0.743136,  0.743200,  0.743265,  0.743329,  0.743393,  0.743457,
-	 0.743521,  0.743585,  0.743649,  0.743713,  0.743777,  0.743842,  0.743906,  0.743970,
-	 0.744034,  0.744098,  0.744162,  0.744226,  0.744290,  0.744354,  0.744418,  0.744482,
-	 0.744546,  0.744610,  0.744674,  0.744738,  0.744802,  0.744866,  0.744930,  0.744994,
-	 0.745058,  0.745122,  0.745186,  0.745250,  0.745314,  0.745377,  0.745441,  0.745505,
-	 0.745569,  0.745633,  0.745697,  0.745761,  0.745825,  0.745889,  0.745952,  0.746016,
-	 0.746080,  0.746144,  0.746208,  0.746272,  0.746335,  0.746399,  0.746463,  0.746527,
-	 0.746591,  0.746654,  0.746718,  0.746782,  0.746846,  0.746909,  0.746973,  0.747037,
-	 0.747101,  0.747164,  0.747228,  0.747292,  0.747355,  0.747419,  0.747483,  0.747547,
-	 0.747610,  0.747674,  0.747738,  0.747801,  0.747865,  0.747929,  0.747992,  0.748056,
-	 0.748119,  0.748183,  0.748247,  0.748310,  0.748374,  0.748437,  0.748501,  0.748565,
-	 0.748628,  0.748692,  0.748755,  0.748819,  0.748882,  0.748946,  0.749009,  0.749073,
-	 0.749136,  0.749200,  0.749263,  0.749327,  0.749390,  0.749454,  0.749517,  0.749581,
-	 0.749644,  0.749708,  0.749771,  0.749835,  0.749898,  0.749961,  0.750025,  0.750088,
-	 0.750152,  0.750215,  0.750278,  0.750342,  0.750405,  0.750469,  0.750532,  0.750595,
-	 0.750659,  0.750722,  0.750785,  0.750849,  0.750912,  0.750975,  0.751039,  0.751102,
-	 0.751165,  0.751228,  0.751292,  0.751355,  0.751418,  0.751481,  0.751545,  0.751608,
-	 0.751671,  0.751734,  0.751798,  0.751861,  0.751924,  0.751987,  0.752050,  0.752114,
-	 0.752177,  0.752240,  0.752303,  0.752366,  0.752429,  0.752493,  0.752556,  0.752619,
-	 0.752682,  0.752745,  0.752808,  0.752871,  0.752934,  0.752998,  0.753061,  0.753124,
-	 0.753187,  0.753250,  0.753313,  0.753376,  0.753439,  0.753502,  0.753565,  0.753628,
-	 0.753691,  0.753754,  0.753817,  0.753880,  0.753943,  0.754006,  0.754069,  0.754132,
-	 0.754195,  0.754258,  0.754321,  0.754384,  0.754447,  0.754510,  0.754573,  0.754636,
-	 0.754698,  0.754761,  0.754824,  0.754887,  0.754950,  0.755013,  0.755076,  0.755139,
-	 0.755201,  0.755264,  0.755327,  0.755390,  0.755453,  0.755516,  0.755578,  0.755641,
-	 0.755704,  0.755767,  0.755829,  0.755892,  0.755955,  0.756018,  0.756081,  0.756143,
-	 0.756206,  0.756269,  0.756331,  0.756394,  0.756457,  0.756520,  0.756582,  0.756645,
-	 0.756708,  0.756770,  0.756833,  0.756896,  0.756958,  0.757021,  0.757084,  0.757146,
-	 0.757209,  0.757271,  0.757334,  0.757397,  0.757459,  0.757522,  0.757584,  0.757647,
-	 0.757710,  0.757772,  0.757835,  0.757897,  0.757960,  0.758022,  0.758085,  0.758147,
-	 0.758210,  0.758272,  0.758335,  0.758397,  0.758460,  0.758522,  0.758585,  0.758647,
-	 0.758710,  0.758772,  0.758835,  0.758897,  0.758960,  0.759022,  0.759084,  0.759147,
-	 0.759209,  0.759272,  0.759334,  0.759396,  0.759459,  0.759521,  0.759583,  0.759646,
-	 0.759708,  0.759771,  0.759833,  0.759895,  0.759957,  0.760020,  0.760082,  0.760144,
-	 0.760207,  0.760269,  0.760331,  0.760394,  0.760456,  0.760518,  0.760580,  0.760643,
-	 0.760705,  0.760767,  0.760829,  0.760891,  0.760954,  0.761016,  0.761078,  0.761140,
-	 0.761202,  0.761265,  0.761327,  0.761389,  0.761451,  0.761513,  0.761575,  0.761637,
-	 0.761700,  0.761762,  0.761824,  0.761886,  0.761948,  0.762010,  0.762072,  0.762134,
-	 0.762196,  0.762258,  0.762320,  0.762382,  0.762444,  0.762507,  0.762569,  0.762631,
-	 0.762693,  0.762755,  0.762817,  0.762879,  0.762941,  0.763003,  0.763065,  0.763126,
-	 0.763188,  0.763250,  0.763312,  0.763374,  0.763436,  0.763498,  0.763560,  0.763622,
-	 0.763684,  0.763746,  0.763808,  0.763869,  0.763931,  0.763993,  0.764055,  0.764117,
-	 0.764179,  0.764241,  0.764302,  0.764364,  0.764426,  0.764488,  0.764550,  0.764611,
-	 0.764673,  0.764735,  0.764797,  0.764859,  0.764920,  0.764982,  0.765044,  0.765106,
-	 0.765167,  0.765229,  0.765291,  0.765352,  0.765414,  0.765476,  0.765538,  0.765599,
-	 0.765661,  0.765723,  0.765784,  0.765846,  0.765907,  0.765969,  0.766031,  0.766092,
-	 0.766154,  0.766216,  0.766277,  0.766339,  0.766400,  0.766462,  0.766524,  0.766585,
-	 0.766647,  0.766708,  0.766770,  0.766831,  0.766893,  0.766954,  0.767016,  0.767077,
-	 0.767139,  0.767200,  0.767262,  0.767323,  0.767385,  0.767446,  0.767508,  0.767569,
-	 0.767631,  0.767692,  0.767754,  0.767815,  0.767876,  0.767938,  0.767999,  0.768061,
-	 0.768122,  0.768183,  0.768245,  0.768306,  0.768368,  0.768429,  0.768490,  0.768552,
-	 0.768613,  0.768674,  0.768736,  0.768797,  0.768858,  0.768919,  0.768981,  0.769042,
-	 0.769103,  0.769165,  0.769226,  0.769287,  0.769348,  0.769410,  0.769471,  0.769532,
-	 0.769593,  0.769655,  0.769716,  0.769777,  0.769838,  0.769899,  0.769961,  0.770022,
-	 0.770083,  0.770144,  0.770205,  0.770266,  0.770327,  0.770389,  0.770450,  0.770511,
-	 0.770572,  0.770633,  0.770694,  0.770755,  0.770816,  0.770877,  0.770938,  0.770999,
-	 0.771061,  0.771122,  0.771183,  0.771244,  0.771305,  0.771366,  0.771427,  0.771488,
-	 0.771549,  0.771610,  0.771671,  0.771732,  0.771793,  0.771854,  0.771915,  0.771975,
-	 0.772036,  0.772097,  0.772158,  0.772219,  0.772280,  0.772341,  0.772402,  0.772463,
-	 0.772524,  0.772584,  0.772645,  0.772706,  0.772767,  0.772828,  0.772889,  0.772950,
-	 0.773010,  0.773071,  0.773132,  0.773193,  0.773254,  0.773314,  0.773375,  0.773436,
-	 0.773497,  0.773558,  0.773618,  0.773679,  0.773740,  0.773801,  0.773861,  0.773922,
-	 0.773983,  0.774043,  0.774104,  0.774165,  0.774225,  0.774286,  0.774347,  0.774407,
-	 0.774468,  0.774529,  0.774589,  0.774650,  0.774711,  0.774771,  0.774832,  0.774893,
-	 0.774953,  0.775014,  0.775074,  0.775135,  0.775195,  0.775256,  0.775317,  0.775377,
-	 0.775438,  0.775498,  0.775559,  0.775619,  0.775680,  0.775740,  0.775801,  0.775861,
-	 0.775922,  0.775982,  0.776043,  0.776103,  0.776164,  0.776224,  0.776284,  0.776345,
-	 0.776405,  0.776466,  0.776526,  0.776587,  0.776647,  0.776707,  0.776768,  0.776828,
-	 0.776888,  0.776949,  0.777009,  0.777070,  0.777130,  0.777190,  0.777251,  0.777311,
-	 0.777371,  0.777431,  0.777492,  0.777552,  0.777612,  0.777673,  0.777733,  0.777793,
-	 0.777853,  0.777914,  0.777974,  0.778034,  0.778094,  0.778155,  0.778215,  0.778275,
-	 0.778335,  0.778395,  0.778456,  0.778516,  0.778576,  0.778636,  0.778696,  0.778756,
-	 0.778817,  0.778877,  0.778937,  0.778997,  0.779057,  0.779117,  0.779177,  0.779237,
-	 0.779297,  0.779357,  0.779418,  0.779478,  0.779538,  0.779598,  0.779658,  0.779718,
-	 0.779778,  0.779838,  0.779898,  0.779958,  0.780018,  0.780078,  0.780138,  0.780198,
-	 0.780258,  0.780318,  0.780378,  0.780438,  0.780498,  0.780557,  0.780617,  0.780677,
-	 0.780737,  0.780797,  0.780857,  0.780917,  0.780977,  0.781037,  0.781097,  0.781156,
-	 0.781216,  0.781276,  0.781336,  0.781396,  0.781456,  0.781515,  0.781575,  0.781635,
-	 0.781695,  0.781755,  0.781814,  0.781874,  0.781934,  0.781994,  0.782053,  0.782113,
-	 0.782173,  0.782233,  0.782292,  0.782352,  0.782412,  0.782472,  0.782531,  0.782591,
-	 0.782651,  0.782710,  0.782770,  0.782830,  0.782889,  0.782949,  0.783009,  0.783068,
-	 0.783128,  0.783187,  0.783247,  0.783307,  0.783366,  0.783426,  0.783485,  0.783545,
-	 0.783605,  0.783664,  0.783724,  0.783783,  0.783843,  0.783902,  0.783962,  0.784021,
-	 0.784081,  0.784140,  0.784200,  0.784259,  0.784319,  0.784378,  0.784438,  0.784497,
-	 0.784557,  0.784616,  0.784675,  0.784735,  0.784794,  0.784854,  0.784913,  0.784973,
-	 0.785032,  0.785091,  0.785151,  0.785210,  0.785269,  0.785329,  0.785388,  0.785447,
-	 0.785507,  0.785566,  0.785625,  0.785685,  0.785744,  0.785803,  0.785863,  0.785922,
-	 0.785981,  0.786041,  0.786100,  0.786159,  0.786218,  0.786278,  0.786337,  0.786396,
-	 0.786455,  0.786514,  0.786574,  0.786633,  0.786692,  0.786751,  0.786810,  0.786870,
-	 0.786929,  0.786988,  0.787047,  0.787106,  0.787165,  0.787224,  0.787284,  0.787343,
-	 0.787402,  0.787461,  0.787520,  0.787579,  0.787638,  0.787697,  0.787756,  0.787815,
-	 0.787874,  0.787933,  0.787992,  0.788051,  0.788110,  0.788169,  0.788228,  0.788287,
-	 0.788346,  0.788405,  0.788464,  0.788523,  0.788582,  0.788641,  0.788700,  0.788759,
-	 0.788818,  0.788877,  0.788936,  0.788995,  0.789054,  0.789113,  0.789172,  0.789230,
-	 0.789289,  0.789348,  0.789407,  0.789466,  0.789525,  0.789584,  0.789642,  0.789701,
-	 0.789760,  0.789819,  0.789878,  0.789936,  0.789995,  0.790054,  0.790113,  0.790171,
-	 0.790230,  0.790289,  0.790348,  0.790406,  0.790465,  0.790524,  0.790583,  0.790641,
-	 0.790700,  0.790759,  0.790817,  0.790876,  0.790935,  0.790993,  0.791052,  0.791111,
-	 0.791169,  0.791228,  0.791287,  0.791345,  0.791404,  0.791462,  0.791521,  0.791580,
-	 0.791638,  0.791697,  0.791755,  0.791814,  0.791872,  0.791931,  0.791990,  0.792048,
-	 0.792107,  0.792165,  0.792224,  0.792282,  0.792341,  0.792399,  0.792458,  0.792516,
-	 0.792575,  0.792633,  0.792691,  0.792750,  0.792808,  0.792867,  0.792925,  0.792984,
-	 0.793042,  0.793100,  0.793159,  0.793217,  0.793276,  0.793334,  0.793392,  0.793451,
-	 0.793509,  0.793567,  0.793626,  0.793684,  0.793742,  0.793801,  0.793859,  0.793917,
-	 0.793975,  0.794034,  0.794092,  0.794150,  0.794209,  0.794267,  0.794325,  0.794383,
-	 0.794442,  0.794500,  0.794558,  0.794616,  0.794674,  0.794733,  0.794791,  0.794849,
-	 0.794907,  0.794965,  0.795023,  0.795082,  0.795140,  0.795198,  0.795256,  0.795314,
-	 0.795372,  0.795430,  0.795488,  0.795547,  0.795605,  0.795663,  0.795721,  0.795779,
-	 0.795837,  0.795895,  0.795953,  0.796011,  0.796069,  0.796127,  0.796185,  0.796243,
-	 0.796301,  0.796359,  0.796417,  0.796475,  0.796533,  0.796591,  0.796649,  0.796707,
-	 0.796765,  0.796823,  0.796881,  0.796939,  0.796996,  0.797054,  0.797112,  0.797170,
-	 0.797228,  0.797286,  0.797344,  0.797402,  0.797459,  0.797517,  0.797575,  0.797633,
-	 0.797691,  0.797749,  0.797806,  0.797864,  0.797922,  0.797980,  0.798038,  0.798095,
-	 0.798153,  0.798211,  0.798269,  0.798326,  0.798384,  0.798442,  0.798500,  0.798557,
-	 0.798615,  0.798673,  0.798730,  0.798788,  0.798846,  0.798903,  0.798961,  0.799019,
-	 0.799076,  0.799134,  0.799192,  0.799249,  0.799307,  0.799365,  0.799422,  0.799480,
-	 0.799537,  0.799595,  0.799652,  0.799710,  0.799768,  0.799825,  0.799883,  0.799940,
-	 0.799998,  0.800055,  0.800113,  0.800170,  0.800228,  0.800285,  0.800343,  0.800400,
-	 0.800458,  0.800515,  0.800573,  0.800630,  0.800687,  0.800745,  0.800802,  0.800860,
-	 0.800917,  0.800975,  0.801032,  0.801089,  0.801147,  0.801204,  0.801261,  0.801319,
-	 0.801376,  0.801434,  0.801491,  0.801548,  0.801606,  0.801663,  0.801720,  0.801777,
-	 0.801835,  0.801892,  0.801949,  0.802007,  0.802064,  0.802121,  0.802178,  0.802236,
-	 0.802293,  0.802350,  0.802407,  0.802464,  0.802522,  0.802579,  0.802636,  0.802693,
-	 0.802750,  0.802808,  0.802865,  0.802922,  0.802979,  0.803036,  0.803093,  0.803150,
-	 0.803208,  0.803265,  0.803322,  0.803379,  0.803436,  0.803493,  0.803550,  0.803607,
-	 0.803664,  0.803721,  0.803778,  0.803835,  0.803892,  0.803949,  0.804006,  0.804063,
-	 0.804120,  0.804177,  0.804234,  0.804291,  0.804348,  0.804405,  0.804462,  0.804519,
-	 0.804576,  0.804633,  0.804690,  0.804747,  0.804804,  0.804861,  0.804918,  0.804974,
-	 0.805031,  0.805088,  0.805145,  0.805202,  0.805259,  0.805316,  0.805372,  0.805429,
-	 0.805486,  0.805543,  0.805600,  0.805656,  0.805713,  0.805770,  0.805827,  0.805884,
-	 0.805940,  0.805997,  0.806054,  0.806111,  0.806167,  0.806224,  0.806281,  0.806338,
-	 0.806394,  0.806451,  0.806508,  0.806564,  0.806621,  0.806678,  0.806734,  0.806791,
-	 0.806848,  0.806904,  0.806961,  0.807017,  0.807074,  0.807131,  0.807187,  0.807244,
-	 0.807300,  0.807357,  0.807414,  0.807470,  0.807527,  0.807583,  0.807640,  0.807696,
-	 0.807753,  0.807809,  0.807866,  0.807922,  0.807979,  0.808035,  0.808092,  0.808148,
-	 0.808205,  0.808261,  0.808318,  0.808374,  0.808430,  0.808487,  0.808543,  0.808600,
-	 0.808656,  0.808713,  0.808769,  0.808825,  0.808882,  0.808938,  0.808994,  0.809051,
-	 0.809107,  0.809164,  0.809220,  0.809276,  0.809332,  0.809389,  0.809445,  0.809501,
-	 0.809558,  0.809614,  0.809670,  0.809726,  0.809783,  0.809839,  0.809895,  0.809951,
-	 0.810008,  0.810064,  0.810120,  0.810176,  0.810232,  0.810289,  0.810345,  0.810401,
-	 0.810457,  0.810513,  0.810570,  0.810626,  0.810682,  0.810738,  0.810794,  0.810850,
-	 0.810906,  0.810962,  0.811018,  0.811075,  0.811131,  0.811187,  0.811243,  0.811299,
-	 0.811355,  0.811411,  0.811467,  0.811523,  0.811579,  0.811635,  0.811691,  0.811747,
-	 0.811803,  0.811859,  0.811915,  0.811971,  0.812027,  0.812083,  0.812139,  0.812195,
-	 0.812251,  0.812307,  0.812362,  0.812418,  0.812474,  0.812530,  0.812586,  0.812642,
-	 0.812698,  0.812754,  0.812809,  0.812865,  0.812921,  0.812977,  0.813033,  0.813089,
-	 0.813144,  0.813200,  0.813256,  0.813312,  0.813368,  0.813423,  0.813479,  0.813535,
-	 0.813591,  0.813646,  0.813702,  0.813758,  0.813814,  0.813869,  0.813925,  0.813981,
-	 0.814036,  0.814092,  0.814148,  0.814203,  0.814259,  0.814315,  0.814370,  0.814426,
-	 0.814482,  0.814537,  0.814593,  0.814648,  0.814704,  0.814760,  0.814815,  0.814871,
-	 0.814926,  0.814982,  0.815037,  0.815093,  0.815149,  0.815204,  0.815260,  0.815315,
-	 0.815371,  0.815426,  0.815482,  0.815537,  0.815593,  0.815648,  0.815704,  0.815759,
-	 0.815814,  0.815870,  0.815925,  0.815981,  0.816036,  0.816092,  0.816147,  0.816202,
-	 0.816258,  0.816313,  0.816368,  0.816424,  0.816479,  0.816535,  0.816590,  0.816645,
-	 0.816701,  0.816756,  0.816811,  0.816867,  0.816922,  0.816977,  0.817032,  0.817088,
-	 0.817143,  0.817198,  0.817253,  0.817309,  0.817364,  0.817419,  0.817474,  0.817530,
-	 0.817585,  0.817640,  0.817695,  0.817750,  0.817806,  0.817861,  0.817916,  0.817971,
-	 0.818026,  0.818081,  0.818137,  0.818192,  0.818247,  0.818302,  0.818357,  0.818412,
-	 0.818467,  0.818522,  0.818577,  0.818632,  0.818687,  0.818742,  0.818798,  0.818853,
-	 0.818908,  0.818963,  0.819018,  0.819073,  0.819128,  0.819183,  0.819238,  0.819293,
-	 0.819348,  0.819402,  0.819457,  0.819512,  0.819567,  0.819622,  0.819677,  0.819732,
-	 0.819787,  0.819842,  0.819897,  0.819952,  0.820007,  0.820061,  0.820116,  0.820171,
-	 0.820226,  0.820281,  0.820336,  0.820390,  0.820445,  0.820500,  0.820555,  0.820610,
-	 0.820664,  0.820719,  0.820774,  0.820829,  0.820884,  0.820938,  0.820993,  0.821048,
-	 0.821102,  0.821157,  0.821212,  0.821267,  0.821321,  0.821376,  0.821431,  0.821485,
-	 0.821540,  0.821595,  0.821649,  0.821704,  0.821759,  0.821813,  0.821868,  0.821922,
-	 0.821977,  0.822032,  0.822086,  0.822141,  0.822195,  0.822250,  0.822305,  0.822359,
-	 0.822414,  0.822468,  0.822523,  0.822577,  0.822632,  0.822686,  0.822741,  0.822795,
-	 0.822850,  0.822904,  0.822959,  0.823013,  0.823068,  0.823122,  0.823177,  0.823231,
-	 0.823285,  0.823340,  0.823394,  0.823449,  0.823503,  0.823557,  0.823612,  0.823666,
-	 0.823721,  0.823775,  0.823829,  0.823884,  0.823938,  0.823992,  0.824047,  0.824101,
-	 0.824155,  0.824209,  0.824264,  0.824318,  0.824372,  0.824427,  0.824481,  0.824535,
-	 0.824589,  0.824644,  0.824698,  0.824752,  0.824806,  0.824860,  0.824915,  0.824969,
-	 0.825023,  0.825077,  0.825131,  0.825185,  0.825240,  0.825294,  0.825348,  0.825402,
-	 0.825456,  0.825510,  0.825564,  0.825618,  0.825673,  0.825727,  0.825781,  0.825835,
-	 0.825889,  0.825943,  0.825997,  0.826051,  0.826105,  0.826159,  0.826213,  0.826267,
-	 0.826321,  0.826375,  0.826429,  0.826483,  0.826537,  0.826591,  0.826645,  0.826699,
-	 0.826753,  0.826807,  0.826861,  0.826915,  0.826968,  0.827022,  0.827076,  0.827130,
-	 0.827184,  0.827238,  0.827292,  0.827346,  0.827399,  0.827453,  0.827507,  0.827561,
-	 0.827615,  0.827669,  0.827722,  0.827776,  0.827830,  0.827884,  0.827938,  0.827991,
-	 0.828045,  0.828099,  0.828153,  0.828206,  0.828260,  0.828314,  0.828367,  0.828421,
-	 0.828475,  0.828529,  0.828582,  0.828636,  0.828690,  0.828743,  0.828797,  0.828851,
-	 0.828904,  0.828958,  0.829011,  0.829065,  0.829119,  0.829172,  0.829226,  0.829279,
-	 0.829333,  0.829386,  0.829440,  0.829494,  0.829547,  0.829601,  0.829654,  0.829708,
-	 0.829761,  0.829815,  0.829868,  0.829922,  0.829975,  0.830029,  0.830082,  0.830136,
-	 0.830189,  0.830243,  0.830296,  0.830349,  0.830403,  0.830456,  0.830510,  0.830563,
-	 0.830616,  0.830670,  0.830723,  0.830777,  0.830830,  0.830883,  0.830937,  0.830990,
-	 0.831043,  0.831097,  0.831150,  0.831203,  0.831257,  0.831310,  0.831363,  0.831416,
-	 0.831470,  0.831523,  0.831576,  0.831629,  0.831683,  0.831736,  0.831789,  0.831842,
-	 0.831895,  0.831949,  0.832002,  0.832055,  0.832108,  0.832161,  0.832215,  0.832268,
-	 0.832321,  0.832374,  0.832427,  0.832480,  0.832533,  0.832586,  0.832640,  0.832693,
-	 0.832746,  0.832799,  0.832852,  0.832905,  0.832958,  0.833011,  0.833064,  0.833117,
-	 0.833170,  0.833223,  0.833276,  0.833329,  0.833382,  0.833435,  0.833488,  0.833541,
-	 0.833594,  0.833647,  0.833700,  0.833753,  0.833806,  0.833859,  0.833912,  0.833965,
-	 0.834018,  0.834070,  0.834123,  0.834176,  0.834229,  0.834282,  0.834335,  0.834388,
-	 0.834440,  0.834493,  0.834546,  0.834599,  0.834652,  0.834705,  0.834757,  0.834810,
-	 0.834863,  0.834916,  0.834968,  0.835021,  0.835074,  0.835127,  0.835179,  0.835232,
-	 0.835285,  0.835338,  0.835390,  0.835443,  0.835496,  0.835548,  0.835601,  0.835654,
-	 0.835706,  0.835759,  0.835812,  0.835864,  0.835917,  0.835969,  0.836022,  0.836075,
-	 0.836127,  0.836180,  0.836232,  0.836285,  0.836338,  0.836390,  0.836443,  0.836495,
-	 0.836548,  0.836600,  0.836653,  0.836705,  0.836758,  0.836810,  0.836863,  0.836915,
-	 0.836968,  0.837020,  0.837073,  0.837125,  0.837178,  0.837230,  0.837282,  0.837335,
-	 0.837387,  0.837440,  0.837492,  0.837544,  0.837597,  0.837649,  0.837701,  0.837754,
-	 0.837806,  0.837859,  0.837911,  0.837963,  0.838015,  0.838068,  0.838120,  0.838172,
-	 0.838225,  0.838277,  0.838329,  0.838382,  0.838434,  0.838486,  0.838538,  0.838591,
-	 0.838643,  0.838695,  0.838747,  0.838799,  0.838852,  0.838904,  0.838956,  0.839008,
-	 0.839060,  0.839112,  0.839165,  0.839217,  0.839269,  0.839321,  0.839373,  0.839425,
-	 0.839477,  0.839529,  0.839581,  0.839634,  0.839686,  0.839738,  0.839790,  0.839842,
-	 0.839894,  0.839946,  0.839998,  0.840050,  0.840102,  0.840154,  0.840206,  0.840258,
-	 0.840310,  0.840362,  0.840414,  0.840466,  0.840518,  0.840570,  0.840622,  0.840673,
-	 0.840725,  0.840777,  0.840829,  0.840881,  0.840933,  0.840985,  0.841037,  0.841089,
-	 0.841140,  0.841192,  0.841244,  0.841296,  0.841348,  0.841400,  0.841451,  0.841503,
-	 0.841555,  0.841607,  0.841659,  0.841710,  0.841762,  0.841814,  0.841866,  0.841917,
-	 0.841969,  0.842021,  0.842072,  0.842124,  0.842176,  0.842228,  0.842279,  0.842331,
-	 0.842383,  0.842434,  0.842486,  0.842538,  0.842589,  0.842641,  0.842692,  0.842744,
-	 0.842796,  0.842847,  0.842899,  0.842950,  0.843002,  0.843054,  0.843105,  0.843157,
-	 0.843208,  0.843260,  0.843311,  0.843363,  0.843414,  0.843466,  0.843517,  0.843569,
-	 0.843620,  0.843672,  0.843723,  0.843775,  0.843826,  0.843878,  0.843929,  0.843980,
-	 0.844032,  0.844083,  0.844135,  0.844186,  0.844238,  0.844289,  0.844340,  0.844392,
-	 0.844443,  0.844494,  0.844546,  0.844597,  0.844648,  0.844700,  0.844751,  0.844802,
-	 0.844854,  0.844905,  0.844956,  0.845007,  0.845059,  0.845110,  0.845161,  0.845212,
-	 0.845264,  0.845315,  0.845366,  0.845417,  0.845469,  0.845520,  0.845571,  0.845622,
-	 0.845673,  0.845724,  0.845776,  0.845827,  0.845878,  0.845929,  0.845980,  0.846031,
-	 0.846082,  0.846133,  0.846185,  0.846236,  0.846287,  0.846338,  0.846389,  0.846440,
-	 0.846491,  0.846542,  0.846593,  0.846644,  0.846695,  0.846746,  0.846797,  0.846848,
-	 0.846899,  0.846950,  0.847001,  0.847052,  0.847103,  0.847154,  0.847205,  0.847256,
-	 0.847307,  0.847358,  0.847408,  0.847459,  0.847510,  0.847561,  0.847612,  0.847663,
-	 0.847714,  0.847765,  0.847815,  0.847866,  0.847917,  0.847968,  0.848019,  0.848070,
-	 0.848120,  0.848171,  0.848222,  0.848273,  0.848323,  0.848374,  0.848425,  0.848476,
-	 0.848526,  0.848577,  0.848628,  0.848679,  0.848729,  0.848780,  0.848831,  0.848881,
-	 0.848932,  0.848983,  0.849033,  0.849084,  0.849135,  0.849185,  0.849236,  0.849287,
-	 0.849337,  0.849388,  0.849438,  0.849489,  0.849540,  0.849590,  0.849641,  0.849691,
-	 0.849742,  0.849792,  0.849843,  0.849893,  0.849944,  0.849994,  0.850045,  0.850095,
-	 0.850146,  0.850196,  0.850247,  0.850297,  0.850348,  0.850398,  0.850449,  0.850499,
-	 0.850549,  0.850600,  0.850650,  0.850701,  0.850751,  0.850801,  0.850852,  0.850902,
-	 0.850953,  0.851003,  0.851053,  0.851104,  0.851154,  0.851204,  0.851255,  0.851305,
-	 0.851355,  0.851406,  0.851456,  0.851506,  0.851556,  0.851607,  0.851657,  0.851707,
-	 0.851757,  0.851808,  0.851858,  0.851908,  0.851958,  0.852008,  0.852059,  0.852109,
-	 0.852159,  0.852209,  0.852259,  0.852309,  0.852360,  0.852410,  0.852460,  0.852510,
-	 0.852560,  0.852610,  0.852660,  0.852710,  0.852760,  0.852810,  0.852861,  0.852911,
-	 0.852961,  0.853011,  0.853061,  0.853111,  0.853161,  0.853211,  0.853261,  0.853311,
-	 0.853361,  0.853411,  0.853461,  0.853511,  0.853561,  0.853611,  0.853660,  0.853710,
-	 0.853760,  0.853810,  0.853860,  0.853910,  0.853960,  0.854010,  0.854060,  0.854110,
-	 0.854159,  0.854209,  0.854259,  0.854309,  0.854359,  0.854409,  0.854458,  0.854508,
-	 0.854558,  0.854608,  0.854658,  0.854707,  0.854757,  0.854807,  0.854857,  0.854906,
-	 0.854956,  0.855006,  0.855056,  0.855105,  0.855155,  0.855205,  0.855254,  0.855304,
-	 0.855354,  0.855403,  0.855453,  0.855503,  0.855552,  0.855602,  0.855651,  0.855701,
-	 0.855751,  0.855800,  0.855850,  0.855900,  0.855949,  0.855999,  0.856048,  0.856098,
-	 0.856147,  0.856197,  0.856246,  0.856296,  0.856345,  0.856395,  0.856444,  0.856494,
-	 0.856543,  0.856593,  0.856642,  0.856692,  0.856741,  0.856791,  0.856840,  0.856890,
-	 0.856939,  0.856988,  0.857038,  0.857087,  0.857137,  0.857186,  0.857235,  0.857285,
-	 0.857334,  0.857383,  0.857433,  0.857482,  0.857531,  0.857581,  0.857630,  0.857679,
-	 0.857729,  0.857778,  0.857827,  0.857876,  0.857926,  0.857975,  0.858024,  0.858073,
-	 0.858123,  0.858172,  0.858221,  0.858270,  0.858320,  0.858369,  0.858418,  0.858467,
-	 0.858516,  0.858565,  0.858615,  0.858664,  0.858713,  0.858762,  0.858811,  0.858860,
-	 0.858909,  0.858958,  0.859007,  0.859057,  0.859106,  0.859155,  0.859204,  0.859253,
-	 0.859302,  0.859351,  0.859400,  0.859449,  0.859498,  0.859547,  0.859596,  0.859645,
-	 0.859694,  0.859743,  0.859792,  0.859841,  0.859890,  0.859939,  0.859988,  0.860036,
-	 0.860085,  0.860134,  0.860183,  0.860232,  0.860281,  0.860330,  0.860379,  0.860428,
-	 0.860476,  0.860525,  0.860574,  0.860623,  0.860672,  0.860721,  0.860769,  0.860818,
-	 0.860867,  0.860916,  0.860964,  0.861013,  0.861062,  0.861111,  0.861160,  0.861208,
-	 0.861257,  0.861306,  0.861354,  0.861403,  0.861452,  0.861500,  0.861549,  0.861598,
-	 0.861646,  0.861695,  0.861744,  0.861792,  0.861841,  0.861890,  0.861938,  0.861987,
-	 0.862035,  0.862084,  0.862133,  0.862181,  0.862230,  0.862278,  0.862327,  0.862375,
-	 0.862424,  0.862472,  0.862521,  0.862570,  0.862618,  0.862666,  0.862715,  0.862763,
-	 0.862812,  0.862860,  0.862909,  0.862957,  0.863006,  0.863054,  0.863103,  0.863151,
-	 0.863199,  0.863248,  0.863296,  0.863345,  0.863393,  0.863441,  0.863490,  0.863538,
-	 0.863586,  0.863635,  0.863683,  0.863731,  0.863780,  0.863828,  0.863876,  0.863925,
-	 0.863973,  0.864021,  0.864069,  0.864118,  0.864166,  0.864214,  0.864262,  0.864311,
-	 0.864359,  0.864407,  0.864455,  0.864503,  0.864552,  0.864600,  0.864648,  0.864696,
-	 0.864744,  0.864792,  0.864841,  0.864889,  0.864937,  0.864985,  0.865033,  0.865081,
-	 0.865129,  0.865177,  0.865225,  0.865273,  0.865321,  0.865369,  0.865418,  0.865466,
-	 0.865514,  0.865562,  0.865610,  0.865658,  0.865706,  0.865754,  0.865802,  0.865850,
-	 0.865898,  0.865946,  0.865993,  0.866041,  0.866089,  0.866137,  0.866185,  0.866233,
-	 0.866281,  0.866329,  0.866377,  0.866425,  0.866472,  0.866520,  0.866568,  0.866616,
-	 0.866664,  0.866712,  0.866759,  0.866807,  0.866855,  0.866903,  0.866951,  0.866998,
-	 0.867046,  0.867094,  0.867142,  0.867190,  0.867237,  0.867285,  0.867333,  0.867380,
-	 0.867428,  0.867476,  0.867523,  0.867571,  0.867619,  0.867667,  0.867714,  0.867762,
-	 0.867809,  0.867857,  0.867905,  0.867952,  0.868000,  0.868048,  0.868095,  0.868143,
-	 0.868190,  0.868238,  0.868285,  0.868333,  0.868381,  0.868428,  0.868476,  0.868523,
-	 0.868571,  0.868618,  0.868666,  0.868713,  0.868761,  0.868808,  0.868856,  0.868903,
-	 0.868951,  0.868998,  0.869045,  0.869093,  0.869140,  0.869188,  0.869235,  0.869282,
-	 0.869330,  0.869377,  0.869425,  0.869472,  0.869519,  0.869567,  0.869614,  0.869661,
-	 0.869709,  0.869756,  0.869803,  0.869851,  0.869898,  0.869945,  0.869992,  0.870040,
-	 0.870087,  0.870134,  0.870182,  0.870229,  0.870276,  0.870323,  0.870370,  0.870418,
-	 0.870465,  0.870512,  0.870559,  0.870606,  0.870654,  0.870701,  0.870748,  0.870795,
-	 0.870842,  0.870889,  0.870936,  0.870983,  0.871031,  0.871078,  0.871125,  0.871172,
-	 0.871219,  0.871266,  0.871313,  0.871360,  0.871407,  0.871454,  0.871501,  0.871548,
-	 0.871595,  0.871642,  0.871689,  0.871736,  0.871783,  0.871830,  0.871877,  0.871924,
-	 0.871971,  0.872018,  0.872065,  0.872112,  0.872159,  0.872205,  0.872252,  0.872299,
-	 0.872346,  0.872393,  0.872440,  0.872487,  0.872534,  0.872580,  0.872627,  0.872674,
-	 0.872721,  0.872768,  0.872814,  0.872861,  0.872908,  0.872955,  0.873001,  0.873048,
-	 0.873095,  0.873142,  0.873188,  0.873235,  0.873282,  0.873329,  0.873375,  0.873422,
-	 0.873469,  0.873515,  0.873562,  0.873609,  0.873655,  0.873702,  0.873749,  0.873795,
-	 0.873842,  0.873888,  0.873935,  0.873982,  0.874028,  0.874075,  0.874121,  0.874168,
-	 0.874215,  0.874261,  0.874308,  0.874354,  0.874401,  0.874447,  0.874494,  0.874540,
-	 0.874587,  0.874633,  0.874680,  0.874726,  0.874773,  0.874819,  0.874865,  0.874912,
-	 0.874958,  0.875005,  0.875051,  0.875098,  0.875144,  0.875190,  0.875237,  0.875283,
-	 0.875329,  0.875376,  0.875422,  0.875468,  0.875515,  0.875561,  0.875607,  0.875654,
-	 0.875700,  0.875746,  0.875793,  0.875839,  0.875885,  0.875931,  0.875978,  0.876024,
-	 0.876070,  0.876116,  0.876163,  0.876209,  0.876255,  0.876301,  0.876347,  0.876393,
-	 0.876440,  0.876486,  0.876532,  0.876578,  0.876624,  0.876670,  0.876716,  0.876763,
-	 0.876809,  0.876855,  0.876901,  0.876947,  0.876993,  0.877039,  0.877085,  0.877131,
-	 0.877177,  0.877223,  0.877269,  0.877315,  0.877361,  0.877407,  0.877453,  0.877499,
-	 0.877545,  0.877591,  0.877637,  0.877683,  0.877729,  0.877775,  0.877821,  0.877867,
-	 0.877913,  0.877959,  0.878005,  0.878051,  0.878096,  0.878142,  0.878188,  0.878234,
-	 0.878280,  0.878326,  0.878371,  0.878417,  0.878463,  0.878509,  0.878555,  0.878600,
-	 0.878646,  0.878692,  0.878738,  0.878784,  0.878829,  0.878875,  0.878921,  0.878967,
-	 0.879012,  0.879058,  0.879104,  0.879149,  0.879195,  0.879241,  0.879286,  0.879332,
-	 0.879378,  0.879423,  0.879469,  0.879515,  0.879560,  0.879606,  0.879651,  0.879697,
-	 0.879743,  0.879788,  0.879834,  0.879879,  0.879925,  0.879970,  0.880016,  0.880061,
-	 0.880107,  0.880153,  0.880198,  0.880244,  0.880289,  0.880334,  0.880380,  0.880425,
-	 0.880471,  0.880516,  0.880562,  0.880607,  0.880653,  0.880698,  0.880743,  0.880789,
-	 0.880834,  0.880880,  0.880925,  0.880970,  0.881016,  0.881061,  0.881106,  0.881152,
-	 0.881197,  0.881242,  0.881288,  0.881333,  0.881378,  0.881424,  0.881469,  0.881514,
-	 0.881559,  0.881605,  0.881650,  0.881695,  0.881740,  0.881786,  0.881831,  0.881876,
-	 0.881921,  0.881966,  0.882012,  0.882057,  0.882102,  0.882147,  0.882192,  0.882237,
-	 0.882283,  0.882328,  0.882373,  0.882418,  0.882463,  0.882508,  0.882553,  0.882598,
-	 0.882643,  0.882688,  0.882733,  0.882779,  0.882824,  0.882869,  0.882914,  0.882959,
-	 0.883004,  0.883049,  0.883094,  0.883139,  0.883184,  0.883228,  0.883273,  0.883318,
-	 0.883363,  0.883408,  0.883453,  0.883498,  0.883543,  0.883588,  0.883633,  0.883678,
-	 0.883723,  0.883767,  0.883812,  0.883857,  0.883902,  0.883947,  0.883992,  0.884036,
-	 0.884081,  0.884126,  0.884171,  0.884216,  0.884260,  0.884305,  0.884350,  0.884395,
-	 0.884439,  0.884484,  0.884529,  0.884574,  0.884618,  0.884663,  0.884708,  0.884752,
-	 0.884797,  0.884842,  0.884886,  0.884931,  0.884976,  0.885020,  0.885065,  0.885110,
-	 0.885154,  0.885199,  0.885243,  0.885288,  0.885333,  0.885377,  0.885422,  0.885466,
-	 0.885511,  0.885555,  0.885600,  0.885644,  0.885689,  0.885733,  0.885778,  0.885822,
-	 0.885867,  0.885911,  0.885956,  0.886000,  0.886045,  0.886089,  0.886134,  0.886178,
-	 0.886223,  0.886267,  0.886311,  0.886356,  0.886400,  0.886445,  0.886489,  0.886533,
-	 0.886578,  0.886622,  0.886666,  0.886711,  0.886755,  0.886799,  0.886844,  0.886888,
-	 0.886932,  0.886976,  0.887021,  0.887065,  0.887109,  0.887153,  0.887198,  0.887242,
-	 0.887286,  0.887330,  0.887375,  0.887419,  0.887463,  0.887507,  0.887551,  0.887595,
-	 0.887640,  0.887684,  0.887728,  0.887772,  0.887816,  0.887860,  0.887904,  0.887949,
-	 0.887993,  0.888037,  0.888081,  0.888125,  0.888169,  0.888213,  0.888257,  0.888301,
-	 0.888345,  0.888389,  0.888433,  0.888477,  0.888521,  0.888565,  0.888609,  0.888653,
-	 0.888697,  0.888741,  0.888785,  0.888829,  0.888873,  0.888917,  0.888961,  0.889004,
-	 0.889048,  0.889092,  0.889136,  0.889180,  0.889224,  0.889268,  0.889312,  0.889355,
-	 0.889399,  0.889443,  0.889487,  0.889531,  0.889574,  0.889618,  0.889662,  0.889706,
-	 0.889750,  0.889793,  0.889837,  0.889881,  0.889925,  0.889968,  0.890012,  0.890056,
-	 0.890099,  0.890143,  0.890187,  0.890230,  0.890274,  0.890318,  0.890361,  0.890405,
-	 0.890449,  0.890492,  0.890536,  0.890580,  0.890623,  0.890667,  0.890710,  0.890754,
-	 0.890797,  0.890841,  0.890885,  0.890928,  0.890972,  0.891015,  0.891059,  0.891102,
-	 0.891146,  0.891189,  0.891233,  0.891276,  0.891320,  0.891363,  0.891407,  0.891450,
-	 0.891493,  0.891537,  0.891580,  0.891624,  0.891667,  0.891711,  0.891754,  0.891797,
-	 0.891841,  0.891884,  0.891927,  0.891971,  0.892014,  0.892057,  0.892101,  0.892144,
-	 0.892187,  0.892231,  0.892274,  0.892317,  0.892361,  0.892404,  0.892447,  0.892490,
-	 0.892534,  0.892577,  0.892620,  0.892663,  0.892706,  0.892750,  0.892793,  0.892836,
-	 0.892879,  0.892922,  0.892965,  0.893009,  0.893052,  0.893095,  0.893138,  0.893181,
-	 0.893224,  0.893267,  0.893310,  0.893354,  0.893397,  0.893440,  0.893483,  0.893526,
-	 0.893569,  0.893612,  0.893655,  0.893698,  0.893741,  0.893784,  0.893827,  0.893870,
-	 0.893913,  0.893956,  0.893999,  0.894042,  0.894085,  0.894128,  0.894171,  0.894214,
-	 0.894256,  0.894299,  0.894342,  0.894385,  0.894428,  0.894471,  0.894514,  0.894557,
-	 0.894599,  0.894642,  0.894685,  0.894728,  0.894771,  0.894814,  0.894856,  0.894899,
-	 0.894942,  0.894985,  0.895028,  0.895070,  0.895113,  0.895156,  0.895198,  0.895241,
-	 0.895284,  0.895327,  0.895369,  0.895412,  0.895455,  0.895497,  0.895540,  0.895583,
-	 0.895625,  0.895668,  0.895711,  0.895753,  0.895796,  0.895838,  0.895881,  0.895924,
-	 0.895966,  0.896009,  0.896051,  0.896094,  0.896137,  0.896179,  0.896222,  0.896264,
-	 0.896307,  0.896349,  0.896392,  0.896434,  0.896477,  0.896519,  0.896562,  0.896604,
-	 0.896646,  0.896689,  0.896731,  0.896774,  0.896816,  0.896859,  0.896901,  0.896943,
-	 0.896986,  0.897028,  0.897071,  0.897113,  0.897155,  0.897198,  0.897240,  0.897282,
-	 0.897325,  0.897367,  0.897409,  0.897452,  0.897494,  0.897536,  0.897578,  0.897621,
-	 0.897663,  0.897705,  0.897747,  0.897790,  0.897832,  0.897874,  0.897916,  0.897958,
-	 0.898001,  0.898043,  0.898085,  0.898127,  0.898169,  0.898211,  0.898254,  0.898296,
-	 0.898338,  0.898380,  0.898422,  0.898464,  0.898506,  0.898548,  0.898590,  0.898632,
-	 0.898674,  0.898717,  0.898759,  0.898801,  0.898843,  0.898885,  0.898927,  0.898969,
-	 0.899011,  0.899053,  0.899095,  0.899137,  0.899179,  0.899220,  0.899262,  0.899304,
-	 0.899346,  0.899388,  0.899430,  0.899472,  0.899514,  0.899556,  0.899598,  0.899639,
-	 0.899681,  0.899723,  0.899765,  0.899807,  0.899849,  0.899890,  0.899932,  0.899974,
-	 0.900016,  0.900058,  0.900099,  0.900141,  0.900183,  0.900225,  0.900266,  0.900308,
-	 0.900350,  0.900392,  0.900433,  0.900475,  0.900517,  0.900558,  0.900600,  0.900642,
-	 0.900683,  0.900725,  0.900767,  0.900808,  0.900850,  0.900892,  0.900933,  0.900975,
-	 0.901016,  0.901058,  0.901100,  0.901141,  0.901183,  0.901224,  0.901266,  0.901307,
-	 0.901349,  0.901390,  0.901432,  0.901473,  0.901515,  0.901556,  0.901598,  0.901639,
-	 0.901681,  0.901722,  0.901764,  0.901805,  0.901847,  0.901888,  0.901929,  0.901971,
-	 0.902012,  0.902054,  0.902095,  0.902136,  0.902178,  0.902219,  0.902260,  0.902302,
-	 0.902343,  0.902384,  0.902426,  0.902467,  0.902508,  0.902550,  0.902591,  0.902632,
-	 0.902673,  0.902715,  0.902756,  0.902797,  0.902838,  0.902879,  0.902921,  0.902962,
-	 0.903003,  0.903044,  0.903085,  0.903127,  0.903168,  0.903209,  0.903250,  0.903291,
-	 0.903332,  0.903373,  0.903415,  0.903456,  0.903497,  0.903538,  0.903579,  0.903620,
-	 0.903661,  0.903702,  0.903743,  0.903784,  0.903825,  0.903866,  0.903907,  0.903948,
-	 0.903989,  0.904030,  0.904071,  0.904112,  0.904153,  0.904194,  0.904235,  0.904276,
-	 0.904317,  0.904358,  0.904399,  0.904440,  0.904481,  0.904521,  0.904562,  0.904603,
-	 0.904644,  0.904685,  0.904726,  0.904767,  0.904807,  0.904848,  0.904889,  0.904930,
-	 0.904971,  0.905011,  0.905052,  0.905093,  0.905134,  0.905175,  0.905215,  0.905256,
-	 0.905297,  0.905337,  0.905378,  0.905419,  0.905460,  0.905500,  0.905541,  0.905582,
-	 0.905622,  0.905663,  0.905704,  0.905744,  0.905785,  0.905825,  0.905866,  0.905907,
-	 0.905947,  0.905988,  0.906028,  0.906069,  0.906110,  0.906150,  0.906191,  0.906231,
-	 0.906272,  0.906312,  0.906353,  0.906393,  0.906434,  0.906474,  0.906515,  0.906555,
-	 0.906596,  0.906636,  0.906677,  0.906717,  0.906757,  0.906798,  0.906838,  0.906879,
-	 0.906919,  0.906959,  0.907000,  0.907040,  0.907081,  0.907121,  0.907161,  0.907202,
-	 0.907242,  0.907282,  0.907323,  0.907363,  0.907403,  0.907444,  0.907484,  0.907524,
-	 0.907564,  0.907605,  0.907645,  0.907685,  0.907725,  0.907766,  0.907806,  0.907846,
-	 0.907886,  0.907926,  0.907966,  0.908007,  0.908047,  0.908087,  0.908127,  0.908167,
-	 0.908207,  0.908248,  0.908288,  0.908328,  0.908368,  0.908408,  0.908448,  0.908488,
-	 0.908528,  0.908568,  0.908608,  0.908648,  0.908688,  0.908728,  0.908768,  0.908808,
-	 0.908848,  0.908888,  0.908928,  0.908968,  0.909008,  0.909048,  0.909088,  0.909128,
-	 0.909168,  0.909208,  0.909248,  0.909288,  0.909328,  0.909368,  0.909407,  0.909447,
-	 0.909487,  0.909527,  0.909567,  0.909607,  0.909646,  0.909686,  0.909726,  0.909766,
-	 0.909806,  0.909845,  0.909885,  0.909925,  0.909965,  0.910005,  0.910044,  0.910084,
-	 0.910124,  0.910163,  0.910203,  0.910243,  0.910283,  0.910322,  0.910362,  0.910402,
-	 0.910441,  0.910481,  0.910521,  0.910560,  0.910600,  0.910639,  0.910679,  0.910719,
-	 0.910758,  0.910798,  0.910837,  0.910877,  0.910917,  0.910956,  0.910996,  0.911035,
-	 0.911075,  0.911114,  0.911154,  0.911193,  0.911233,  0.911272,  0.911312,  0.911351,
-	 0.911391,  0.911430,  0.911470,  0.911509,  0.911548,  0.911588,  0.911627,  0.911667,
-	 0.911706,  0.911745,  0.911785,  0.911824,  0.911864,  0.911903,  0.911942,  0.911982,
-	 0.912021,  0.912060,  0.912099,  0.912139,  0.912178,  0.912217,  0.912257,  0.912296,
-	 0.912335,  0.912374,  0.912414,  0.912453,  0.912492,  0.912531,  0.912571,  0.912610,
-	 0.912649,  0.912688,  0.912727,  0.912766,  0.912806,  0.912845,  0.912884,  0.912923,
-	 0.912962,  0.913001,  0.913040,  0.913080,  0.913119,  0.913158,  0.913197,  0.913236,
-	 0.913275,  0.913314,  0.913353,  0.913392,  0.913431,  0.913470,  0.913509,  0.913548,
-	 0.913587,  0.913626,  0.913665,  0.913704,  0.913743,  0.913782,  0.913821,  0.913860,
-	 0.913899,  0.913938,  0.913976,  0.914015,  0.914054,  0.914093,  0.914132,  0.914171,
-	 0.914210,  0.914249,  0.914287,  0.914326,  0.914365,  0.914404,  0.914443,  0.914482,
-	 0.914520,  0.914559,  0.914598,  0.914637,  0.914675,  0.914714,  0.914753,  0.914792,
-	 0.914830,  0.914869,  0.914908,  0.914946,  0.914985,  0.915024,  0.915062,  0.915101,
-	 0.915140,  0.915178,  0.915217,  0.915256,  0.915294,  0.915333,  0.915372,  0.915410,
-	 0.915449,  0.915487,  0.915526,  0.915564,  0.915603,  0.915642,  0.915680,  0.915719,
-	 0.915757,  0.915796,  0.915834,  0.915873,  0.915911,  0.915950,  0.915988,  0.916027,
-	 0.916065,  0.916103,  0.916142,  0.916180,  0.916219,  0.916257,  0.916296,  0.916334,
-	 0.916372,  0.916411,  0.916449,  0.916487,  0.916526,  0.916564,  0.916602,  0.916641,
-	 0.916679,  0.916717,  0.916756,  0.916794,  0.916832,  0.916871,  0.916909,  0.916947,
-	 0.916985,  0.917024,  0.917062,  0.917100,  0.917138,  0.917176,  0.917215,  0.917253,
-	 0.917291,  0.917329,  0.917367,  0.917405,  0.917444,  0.917482,  0.917520,  0.917558,
-	 0.917596,  0.917634,  0.917672,  0.917710,  0.917749,  0.917787,  0.917825,  0.917863,
-	 0.917901,  0.917939,  0.917977,  0.918015,  0.918053,  0.918091,  0.918129,  0.918167,
-	 0.918205,  0.918243,  0.918281,  0.918319,  0.918357,  0.918395,  0.918433,  0.918471,
-	 0.918508,  0.918546,  0.918584,  0.918622,  0.918660,  0.918698,  0.918736,  0.918774,
-	 0.918811,  0.918849,  0.918887,  0.918925,  0.918963,  0.919001,  0.919038,  0.919076,
-	 0.919114,  0.919152,  0.919189,  0.919227,  0.919265,  0.919303,  0.919340,  0.919378,
-	 0.919416,  0.919453,  0.919491,  0.919529,  0.919567,  0.919604,  0.919642,  0.919680,
-	 0.919717,  0.919755,  0.919792,  0.919830,  0.919868,  0.919905,  0.919943,  0.919980,
-	 0.920018,  0.920056,  0.920093,  0.920131,  0.920168,  0.920206,  0.920243,  0.920281,
-	 0.920318,  0.920356,  0.920393,  0.920431,  0.920468,  0.920506,  0.920543,  0.920581,
-	 0.920618,  0.920655,  0.920693,  0.920730,  0.920768,  0.920805,  0.920842,  0.920880,
-	 0.920917,  0.920955,  0.920992,  0.921029,  0.921067,  0.921104,  0.921141,  0.921179,
-	 0.921216,  0.921253,  0.921291,  0.921328,  0.921365,  0.921402,  0.921440,  0.921477,
-	 0.921514,  0.921551,  0.921588,  0.921626,  0.921663,  0.921700,  0.921737,  0.921774,
-	 0.921812,  0.921849,  0.921886,  0.921923,  0.921960,  0.921997,  0.922034,  0.922072,
-	 0.922109,  0.922146,  0.922183,  0.922220,  0.922257,  0.922294,  0.922331,  0.922368,
-	 0.922405,  0.922442,  0.922479,  0.922516,  0.922553,  0.922590,  0.922627,  0.922664,
-	 0.922701,  0.922738,  0.922775,  0.922812,  0.922849,  0.922886,  0.922923,  0.922960,
-	 0.922997,  0.923033,  0.923070,  0.923107,  0.923144,  0.923181,  0.923218,  0.923255,
-	 0.923291,  0.923328,  0.923365,  0.923402,  0.923439,  0.923475,  0.923512,  0.923549,
-	 0.923586,  0.923622,  0.923659,  0.923696,  0.923733,  0.923769,  0.923806,  0.923843,
-	 0.923880,  0.923916,  0.923953,  0.923990,  0.924026,  0.924063,  0.924100,  0.924136,
-	 0.924173,  0.924209,  0.924246,  0.924283,  0.924319,  0.924356,  0.924392,  0.924429,
-	 0.924465,  0.924502,  0.924539,  0.924575,  0.924612,  0.924648,  0.924685,  0.924721,
-	 0.924758,  0.924794,  0.924831,  0.924867,  0.924904,  0.924940,  0.924976,  0.925013,
-	 0.925049,  0.925086,  0.925122,  0.925158,  0.925195,  0.925231,  0.925268,  0.925304,
-	 0.925340,  0.925377,  0.925413,  0.925449,  0.925486,  0.925522,  0.925558,  0.925595,
-	 0.925631,  0.925667,  0.925703,  0.925740,  0.925776,  0.925812,  0.925848,  0.925885,
-	 0.925921,  0.925957,  0.925993,  0.926029,  0.926066,  0.926102,  0.926138,  0.926174,
-	 0.926210,  0.926246,  0.926283,  0.926319,  0.926355,  0.926391,  0.926427,  0.926463,
-	 0.926499,  0.926535,  0.926571,  0.926607,  0.926643,  0.926679,  0.926715,  0.926751,
-	 0.926787,  0.926823,  0.926859,  0.926895,  0.926931,  0.926967,  0.927003,  0.927039,
-	 0.927075,  0.927111,  0.927147,  0.927183,  0.927219,  0.927255,  0.927291,  0.927327,
-	 0.927363,  0.927398,  0.927434,  0.927470,  0.927506,  0.927542,  0.927578,  0.927613,
-	 0.927649,  0.927685,  0.927721,  0.927757,  0.927792,  0.927828,  0.927864,  0.927900,
-	 0.927935,  0.927971,  0.928007,  0.928043,  0.928078,  0.928114,  0.928150,  0.928185,
-	 0.928221,  0.928257,  0.928292,  0.928328,  0.928364,  0.928399,  0.928435,  0.928470,
-	 0.928506,  0.928542,  0.928577,  0.928613,  0.928648,  0.928684,  0.928720,  0.928755,
-	 0.928791,  0.928826,  0.928862,  0.928897,  0.928933,  0.928968,  0.929004,  0.929039,
-	 0.929075,  0.929110,  0.929146,  0.929181,  0.929216,  0.929252,  0.929287,  0.929323,
-	 0.929358,  0.929393,  0.929429,  0.929464,  0.929500,  0.929535,  0.929570,  0.929606,
-	 0.929641,  0.929676,  0.929712,  0.929747,  0.929782,  0.929817,  0.929853,  0.929888,
-	 0.929923,  0.929958,  0.929994,  0.930029,  0.930064,  0.930099,  0.930135,  0.930170,
-	 0.930205,  0.930240,  0.930275,  0.930311,  0.930346,  0.930381,  0.930416,  0.930451,
-	 0.930486,  0.930521,  0.930556,  0.930592,  0.930627,  0.930662,  0.930697,  0.930732,
-	 0.930767,  0.930802,  0.930837,  0.930872,  0.930907,  0.930942,  0.930977,  0.931012,
-	 0.931047,  0.931082,  0.931117,  0.931152,  0.931187,  0.931222,  0.931257,  0.931292,
-	 0.931327,  0.931362,  0.931397,  0.931431,  0.931466,  0.931501,  0.931536,  0.931571,
-	 0.931606,  0.931641,  0.931675,  0.931710,  0.931745,  0.931780,  0.931815,  0.931849,
-	 0.931884,  0.931919,  0.931954,  0.931989,  0.932023,  0.932058,  0.932093,  0.932128,
-	 0.932162,  0.932197,  0.932232,  0.932266,  0.932301,  0.932336,  0.932370,  0.932405,
-	 0.932440,  0.932474,  0.932509,  0.932544,  0.932578,  0.932613,  0.932647,  0.932682,
-	 0.932716,  0.932751,  0.932786,  0.932820,  0.932855,  0.932889,  0.932924,  0.932958,
-	 0.932993,  0.933027,  0.933062,  0.933096,  0.933131,  0.933165,  0.933200,  0.933234,
-	 0.933269,  0.933303,  0.933337,  0.933372,  0.933406,  0.933441,  0.933475,  0.933509,
-	 0.933544,  0.933578,  0.933612,  0.933647,  0.933681,  0.933716,  0.933750,  0.933784,
-	 0.933818,  0.933853,  0.933887,  0.933921,  0.933956,  0.933990,  0.934024,  0.934058,
-	 0.934093,  0.934127,  0.934161,  0.934195,  0.934229,  0.934264,  0.934298,  0.934332,
-	 0.934366,  0.934400,  0.934434,  0.934469,  0.934503,  0.934537,  0.934571,  0.934605,
-	 0.934639,  0.934673,  0.934707,  0.934741,  0.934775,  0.934810,  0.934844,  0.934878,
-	 0.934912,  0.934946,  0.934980,  0.935014,  0.935048,  0.935082,  0.935116,  0.935150,
-	 0.935184,  0.935217,  0.935251,  0.935285,  0.935319,  0.935353,  0.935387,  0.935421,
-	 0.935455,  0.935489,  0.935523,  0.935556,  0.935590,  0.935624,  0.935658,  0.935692,
-	 0.935726,  0.935759,  0.935793,  0.935827,  0.935861,  0.935895,  0.935928,  0.935962,
-	 0.935996,  0.936030,  0.936063,  0.936097,  0.936131,  0.936165,  0.936198,  0.936232,
-	 0.936266,  0.936299,  0.936333,  0.936367,  0.936400,  0.936434,  0.936468,  0.936501,
-	 0.936535,  0.936568,  0.936602,  0.936636,  0.936669,  0.936703,  0.936736,  0.936770,
-	 0.936803,  0.936837,  0.936871,  0.936904,  0.936938,  0.936971,  0.937005,  0.937038,
-	 0.937072,  0.937105,  0.937138,  0.937172,  0.937205,  0.937239,  0.937272,  0.937306,
-	 0.937339,  0.937372,  0.937406,  0.937439,  0.937473,  0.937506,  0.937539,  0.937573,
-	 0.937606,  0.937639,  0.937673,  0.937706,  0.937739,  0.937773,  0.937806,  0.937839,
-	 0.937872,  0.937906,  0.937939,  0.937972,  0.938005,  0.938039,  0.938072,  0.938105,
-	 0.938138,  0.938171,  0.938205,  0.938238,  0.938271,  0.938304,  0.938337,  0.938370,
-	 0.938404,  0.938437,  0.938470,  0.938503,  0.938536,  0.938569,  0.938602,  0.938635,
-	 0.938668,  0.938701,  0.938734,  0.938767,  0.938800,  0.938833,  0.938866,  0.938900,
-	 0.938932,  0.938965,  0.938998,  0.939031,  0.939064,  0.939097,  0.939130,  0.939163,
-	 0.939196,  0.939229,  0.939262,  0.939295,  0.939328,  0.939361,  0.939394,  0.939426,
-	 0.939459,  0.939492,  0.939525,  0.939558,  0.939591,  0.939623,  0.939656,  0.939689,
-	 0.939722,  0.939755,  0.939787,  0.939820,  0.939853,  0.939886,  0.939918,  0.939951,
-	 0.939984,  0.940016,  0.940049,  0.940082,  0.940115,  0.940147,  0.940180,  0.940213,
-	 0.940245,  0.940278,  0.940310,  0.940343,  0.940376,  0.940408,  0.940441,  0.940473,
-	 0.940506,  0.940539,  0.940571,  0.940604,  0.940636,  0.940669,  0.940701,  0.940734,
-	 0.940766,  0.940799,  0.940831,  0.940864,  0.940896,  0.940929,  0.940961,  0.940994,
-	 0.941026,  0.941059,  0.941091,  0.941123,  0.941156,  0.941188,  0.941221,  0.941253,
-	 0.941285,  0.941318,  0.941350,  0.941382,  0.941415,  0.941447,  0.941479,  0.941512,
-	 0.941544,  0.941576,  0.941609,  0.941641,  0.941673,  0.941705,  0.941738,  0.941770,
-	 0.941802,  0.941834,  0.941867,  0.941899,  0.941931,  0.941963,  0.941995,  0.942028,
-	 0.942060,  0.942092,  0.942124,  0.942156,  0.942188,  0.942220,  0.942253,  0.942285,
-	 0.942317,  0.942349,  0.942381,  0.942413,  0.942445,  0.942477,  0.942509,  0.942541,
-	 0.942573,  0.942605,  0.942637,  0.942669,  0.942701,  0.942733,  0.942765,  0.942797,
-	 0.942829,  0.942861,  0.942893,  0.942925,  0.942957,  0.942989,  0.943021,  0.943053,
-	 0.943084,  0.943116,  0.943148,  0.943180,  0.943212,  0.943244,  0.943276,  0.943307,
-	 0.943339,  0.943371,  0.943403,  0.943435,  0.943466,  0.943498,  0.943530,  0.943562,
-	 0.943593,  0.943625,  0.943657,  0.943689,  0.943720,  0.943752,  0.943784,  0.943815,
-	 0.943847,  0.943879,  0.943910,  0.943942,  0.943974,  0.944005,  0.944037,  0.944069,
-	 0.944100,  0.944132,  0.944163,  0.944195,  0.944227,  0.944258,  0.944290,  0.944321,
-	 0.944353,  0.944384,  0.944416,  0.944447,  0.944479,  0.944510,  0.944542,  0.944573,
-	 0.944605,  0.944636,  0.944668,  0.944699,  0.944731,  0.944762,  0.944793,  0.944825,
-	 0.944856,  0.944888,  0.944919,  0.944950,  0.944982,  0.945013,  0.945045,  0.945076,
-	 0.945107,  0.945139,  0.945170,  0.945201,  0.945232,  0.945264,  0.945295,  0.945326,
-	 0.945358,  0.945389,  0.945420,  0.945451,  0.945482,  0.945514,  0.945545,  0.945576,
-	 0.945607,  0.945639,  0.945670,  0.945701,  0.945732,  0.945763,  0.945794,  0.945825,
-	 0.945857,  0.945888,  0.945919,  0.945950,  0.945981,  0.946012,  0.946043,  0.946074,
-	 0.946105,  0.946136,  0.946167,  0.946198,  0.946229,  0.946260,  0.946291,  0.946322,
-	 0.946353,  0.946384,  0.946415,  0.946446,  0.946477,  0.946508,  0.946539,  0.946570,
-	 0.946601,  0.946632,  0.946663,  0.946694,  0.946724,  0.946755,  0.946786,  0.946817,
-	 0.946848,  0.946879,  0.946910,  0.946940,  0.946971,  0.947002,  0.947033,  0.947064,
-	 0.947094,  0.947125,  0.947156,  0.947187,  0.947217,  0.947248,  0.947279,  0.947310,
-	 0.947340,  0.947371,  0.947402,  0.947432,  0.947463,  0.947494,  0.947524,  0.947555,
-	 0.947586,  0.947616,  0.947647,  0.947677,  0.947708,  0.947739,  0.947769,  0.947800,
-	 0.947830,  0.947861,  0.947891,  0.947922,  0.947953,  0.947983,  0.948014,  0.948044,
-	 0.948075,  0.948105,  0.948136,  0.948166,  0.948196,  0.948227,  0.948257,  0.948288,
-	 0.948318,  0.948349,  0.948379,  0.948409,  0.948440,  0.948470,  0.948501,  0.948531,
-	 0.948561,  0.948592,  0.948622,  0.948652,  0.948683,  0.948713,  0.948743,  0.948774,
-	 0.948804,  0.948834,  0.948864,  0.948895,  0.948925,  0.948955,  0.948985,  0.949016,
-	 0.949046,  0.949076,  0.949106,  0.949136,  0.949167,  0.949197,  0.949227,  0.949257,
-	 0.949287,  0.949317,  0.949348,  0.949378,  0.949408,  0.949438,  0.949468,  0.949498,
-	 0.949528,  0.949558,  0.949588,  0.949618,  0.949648,  0.949678,  0.949708,  0.949739,
-	 0.949768,  0.949798,  0.949829,  0.949858,  0.949888,  0.949918,  0.949948,  0.949978,
-	 0.950008,  0.950038,  0.950068,  0.950098,  0.950128,  0.950158,  0.950188,  0.950218,
-	 0.950247,  0.950277,  0.950307,  0.950337,  0.950367,  0.950397,  0.950426,  0.950456,
-	 0.950486,  0.950516,  0.950546,  0.950575,  0.950605,  0.950635,  0.950665,  0.950694,
-	 0.950724,  0.950754,  0.950784,  0.950813,  0.950843,  0.950873,  0.950902,  0.950932,
-	 0.950962,  0.950991,  0.951021,  0.951051,  0.951080,  0.951110,  0.951139,  0.951169,
-	 0.951199,  0.951228,  0.951258,  0.951287,  0.951317,  0.951346,  0.951376,  0.951406,
-	 0.951435,  0.951465,  0.951494,  0.951524,  0.951553,  0.951582,  0.951612,  0.951641,
-	 0.951671,  0.951700,  0.951730,  0.951759,  0.951789,  0.951818,  0.951847,  0.951877,
-	 0.951906,  0.951936,  0.951965,  0.951994,  0.952024,  0.952053,  0.952082,  0.952112,
-	 0.952141,  0.952170,  0.952199,  0.952229,  0.952258,  0.952287,  0.952317,  0.952346,
-	 0.952375,  0.952404,  0.952433,  0.952463,  0.952492,  0.952521,  0.952550,  0.952579,
-	 0.952609,  0.952638,  0.952667,  0.952696,  0.952725,  0.952754,  0.952783,  0.952813,
-	 0.952842,  0.952871,  0.952900,  0.952929,  0.952958,  0.952987,  0.953016,  0.953045,
-	 0.953074,  0.953103,  0.953132,  0.953161,  0.953190,  0.953219,  0.953248,  0.953277,
-	 0.953306,  0.953335,  0.953364,  0.953393,  0.953422,  0.953451,  0.953480,  0.953508,
-	 0.953537,  0.953566,  0.953595,  0.953624,  0.953653,  0.953682,  0.953711,  0.953739,
-	 0.953768,  0.953797,  0.953826,  0.953855,  0.953883,  0.953912,  0.953941,  0.953970,
-	 0.953998,  0.954027,  0.954056,  0.954085,  0.954113,  0.954142,  0.954171,  0.954199,
-	 0.954228,  0.954257,  0.954285,  0.954314,  0.954343,  0.954371,  0.954400,  0.954429,
-	 0.954457,  0.954486,  0.954514,  0.954543,  0.954572,  0.954600,  0.954629,  0.954657,
-	 0.954686,  0.954714,  0.954743,  0.954771,  0.954800,  0.954828,  0.954857,  0.954885,
-	 0.954914,  0.954942,  0.954971,  0.954999,  0.955028,  0.955056,  0.955084,  0.955113,
-	 0.955141,  0.955170,  0.955198,  0.955226,  0.955255,  0.955283,  0.955311,  0.955340,
-	 0.955368,  0.955396,  0.955425,  0.955453,  0.955481,  0.955510,  0.955538,  0.955566,
-	 0.955594,  0.955623,  0.955651,  0.955679,  0.955707,  0.955736,  0.955764,  0.955792,
-	 0.955820,  0.955848,  0.955876,  0.955905,  0.955933,  0.955961,  0.955989,  0.956017,
-	 0.956045,  0.956073,  0.956101,  0.956130,  0.956158,  0.956186,  0.956214,  0.956242,
-	 0.956270,  0.956298,  0.956326,  0.956354,  0.956382,  0.956410,  0.956438,  0.956466,
-	 0.956494,  0.956522,  0.956550,  0.956578,  0.956606,  0.956634,  0.956662,  0.956689,
-	 0.956717,  0.956745,  0.956773,  0.956801,  0.956829,  0.956857,  0.956885,  0.956913,
-	 0.956940,  0.956968,  0.956996,  0.957024,  0.957052,  0.957079,  0.957107,  0.957135,
-	 0.957163,  0.957190,  0.957218,  0.957246,  0.957274,  0.957301,  0.957329,  0.957357,
-	 0.957385,  0.957412,  0.957440,  0.957468,  0.957495,  0.957523,  0.957550,  0.957578,
-	 0.957606,  0.957633,  0.957661,  0.957689,  0.957716,  0.957744,  0.957771,  0.957799,
-	 0.957826,  0.957854,  0.957882,  0.957909,  0.957937,  0.957964,  0.957992,  0.958019,
-	 0.958046,  0.958074,  0.958101,  0.958129,  0.958156,  0.958184,  0.958211,  0.958239,
-	 0.958266,  0.958293,  0.958321,  0.958348,  0.958376,  0.958403,  0.958430,  0.958458,
-	 0.958485,  0.958512,  0.958540,  0.958567,  0.958594,  0.958622,  0.958649,  0.958676,
-	 0.958703,  0.958731,  0.958758,  0.958785,  0.958812,  0.958840,  0.958867,  0.958894,
-	 0.958921,  0.958949,  0.958976,  0.959003,  0.959030,  0.959057,  0.959084,  0.959112,
-	 0.959139,  0.959166,  0.959193,  0.959220,  0.959247,  0.959274,  0.959301,  0.959328,
-	 0.959355,  0.959382,  0.959409,  0.959436,  0.959463,  0.959491,  0.959518,  0.959545,
-	 0.959572,  0.959598,  0.959625,  0.959652,  0.959679,  0.959706,  0.959733,  0.959760,
-	 0.959787,  0.959814,  0.959841,  0.959868,  0.959895,  0.959922,  0.959948,  0.959975,
-	 0.960002,  0.960029,  0.960056,  0.960083,  0.960109,  0.960136,  0.960163,  0.960190,
-	 0.960217,  0.960243,  0.960270,  0.960297,  0.960324,  0.960350,  0.960377,  0.960404,
-	 0.960431,  0.960457,  0.960484,  0.960511,  0.960537,  0.960564,  0.960591,  0.960617,
-	 0.960644,  0.960670,  0.960697,  0.960724,  0.960750,  0.960777,  0.960804,  0.960830,
-	 0.960857,  0.960883,  0.960910,  0.960936,  0.960963,  0.960989,  0.961016,  0.961042,
-	 0.961069,  0.961095,  0.961122,  0.961148,  0.961175,  0.961201,  0.961228,  0.961254,
-	 0.961280,  0.961307,  0.961333,  0.961360,  0.961386,  0.961412,  0.961439,  0.961465,
-	 0.961492,  0.961518,  0.961544,  0.961571,  0.961597,  0.961623,  0.961649,  0.961676,
-	 0.961702,  0.961728,  0.961755,  0.961781,  0.961807,  0.961833,  0.961860,  0.961886,
-	 0.961912,  0.961938,  0.961964,  0.961991,  0.962017,  0.962043,  0.962069,  0.962095,
-	 0.962121,  0.962148,  0.962174,  0.962200,  0.962226,  0.962252,  0.962278,  0.962304,
-	 0.962330,  0.962356,  0.962382,  0.962408,  0.962434,  0.962460,  0.962486,  0.962512,
-	 0.962538,  0.962564,  0.962590,  0.962616,  0.962642,  0.962668,  0.962694,  0.962720,
-	 0.962746,  0.962772,  0.962798,  0.962824,  0.962850,  0.962876,  0.962902,  0.962927,
-	 0.962953,  0.962979,  0.963005,  0.963031,  0.963057,  0.963082,  0.963108,  0.963134,
-	 0.963160,  0.963186,  0.963211,  0.963237,  0.963263,  0.963289,  0.963314,  0.963340,
-	 0.963366,  0.963391,  0.963417,  0.963443,  0.963469,  0.963494,  0.963520,  0.963546,
-	 0.963571,  0.963597,  0.963623,  0.963648,  0.963674,  0.963699,  0.963725,  0.963750,
-	 0.963776,  0.963802,  0.963827,  0.963853,  0.963878,  0.963904,  0.963929,  0.963955,
-	 0.963980,  0.964006,  0.964031,  0.964057,  0.964082,  0.964108,  0.964133,  0.964159,
-	 0.964184,  0.964209,  0.964235,  0.964260,  0.964286,  0.964311,  0.964336,  0.964362,
-	 0.964387,  0.964413,  0.964438,  0.964463,  0.964489,  0.964514,  0.964539,  0.964565,
-	 0.964590,  0.964615,  0.964640,  0.964666,  0.964691,  0.964716,  0.964741,  0.964767,
-	 0.964792,  0.964817,  0.964842,  0.964867,  0.964893,  0.964918,  0.964943,  0.964968,
-	 0.964993,  0.965018,  0.965044,  0.965069,  0.965094,  0.965119,  0.965144,  0.965169,
-	 0.965194,  0.965219,  0.965244,  0.965269,  0.965294,  0.965319,  0.965344,  0.965369,
-	 0.965394,  0.965419,  0.965444,  0.965469,  0.965494,  0.965519,  0.965544,  0.965569,
-	 0.965594,  0.965619,  0.965644,  0.965669,  0.965694,  0.965719,  0.965744,  0.965769,
-	 0.965793,  0.965818,  0.965843,  0.965868,  0.965893,  0.965918,  0.965942,  0.965967,
-	 0.965992,  0.966017,  0.966042,  0.966066,  0.966091,  0.966116,  0.966141,  0.966165,
-	 0.966190,  0.966215,  0.966239,  0.966264,  0.966289,  0.966313,  0.966338,  0.966363,
-	 0.966387,  0.966412,  0.966437,  0.966461,  0.966486,  0.966511,  0.966535,  0.966560,
-	 0.966584,  0.966609,  0.966633,  0.966658,  0.966683,  0.966707,  0.966732,  0.966756,
-	 0.966781,  0.966805,  0.966830,  0.966854,  0.966879,  0.966903,  0.966928,  0.966952,
-	 0.966976,  0.967001,  0.967025,  0.967050,  0.967074,  0.967099,  0.967123,  0.967147,
-	 0.967172,  0.967196,  0.967220,  0.967245,  0.967269,  0.967293,  0.967318,  0.967342,
-	 0.967366,  0.967391,  0.967415,  0.967439,  0.967463,  0.967488,  0.967512,  0.967536,
-	 0.967560,  0.967585,  0.967609,  0.967633,  0.967657,  0.967681,  0.967706,  0.967730,
-	 0.967754,  0.967778,  0.967802,  0.967826,  0.967850,  0.967874,  0.967899,  0.967923,
-	 0.967947,  0.967971,  0.967995,  0.968019,  0.968043,  0.968067,  0.968091,  0.968115,
-	 0.968139,  0.968163,  0.968187,  0.968211,  0.968235,  0.968259,  0.968283,  0.968307,
-	 0.968331,  0.968355,  0.968379,  0.968403,  0.968427,  0.968450,  0.968474,  0.968498,
-	 0.968522,  0.968546,  0.968570,  0.968594,  0.968617,  0.968641,  0.968665,  0.968689,
-	 0.968713,  0.968737,  0.968760,  0.968784,  0.968808,  0.968832,  0.968855,  0.968879,
-	 0.968903,  0.968927,  0.968950,  0.968974,  0.968998,  0.969021,  0.969045,  0.969069,
-	 0.969092,  0.969116,  0.969140,  0.969163,  0.969187,  0.969210,  0.969234,  0.969258,
-	 0.969281,  0.969305,  0.969328,  0.969352,  0.969375,  0.969399,  0.969423,  0.969446,
-	 0.969470,  0.969493,  0.969517,  0.969540,  0.969564,  0.969587,  0.969611,  0.969634,
-	 0.969657,  0.969681,  0.969704,  0.969728,  0.969751,  0.969774,  0.969798,  0.969821,
-	 0.969845,  0.969868,  0.969891,  0.969915,  0.969938,  0.969961,  0.969985,  0.970008,
-	 0.970031,  0.970055,  0.970078,  0.970101,  0.970124,  0.970148,  0.970171,  0.970194,
-	 0.970217,  0.970241,  0.970264,  0.970287,  0.970310,  0.970333,  0.970357,  0.970380,
-	 0.970403,  0.970426,  0.970449,  0.970472,  0.970495,  0.970518,  0.970542,  0.970565,
-	 0.970588,  0.970611,  0.970634,  0.970657,  0.970680,  0.970703,  0.970726,  0.970749,
-	 0.970772,  0.970795,  0.970818,  0.970841,  0.970864,  0.970887,  0.970910,  0.970933,
-	 0.970956,  0.970979,  0.971002,  0.971025,  0.971048,  0.971071,  0.971093,  0.971116,
-	 0.971139,  0.971162,  0.971185,  0.971208,  0.971231,  0.971253,  0.971276,  0.971299,
-	 0.971322,  0.971345,  0.971367,  0.971390,  0.971413,  0.971436,  0.971458,  0.971481,
-	 0.971504,  0.971527,  0.971549,  0.971572,  0.971595,  0.971617,  0.971640,  0.971663,
-	 0.971685,  0.971708,  0.971731,  0.971753,  0.971776,  0.971799,  0.971821,  0.971844,
-	 0.971866,  0.971889,  0.971911,  0.971934,  0.971957,  0.971979,  0.972002,  0.972024,
-	 0.972047,  0.972069,  0.972092,  0.972114,  0.972137,  0.972159,  0.972182,  0.972204,
-	 0.972227,  0.972249,  0.972271,  0.972294,  0.972316,  0.972339,  0.972361,  0.972383,
-	 0.972406,  0.972428,  0.972450,  0.972473,  0.972495,  0.972517,  0.972540,  0.972562,
-	 0.972584,  0.972607,  0.972629,  0.972651,  0.972673,  0.972696,  0.972718,  0.972740,
-	 0.972762,  0.972785,  0.972807,  0.972829,  0.972851,  0.972873,  0.972896,  0.972918,
-	 0.972940,  0.972962,  0.972984,  0.973006,  0.973028,  0.973051,  0.973073,  0.973095,
-	 0.973117,  0.973139,  0.973161,  0.973183,  0.973205,  0.973227,  0.973249,  0.973271,
-	 0.973293,  0.973315,  0.973337,  0.973359,  0.973381,  0.973403,  0.973425,  0.973447,
-	 0.973469,  0.973491,  0.973513,  0.973535,  0.973557,  0.973579,  0.973601,  0.973622,
-	 0.973644,  0.973666,  0.973688,  0.973710,  0.973732,  0.973753,  0.973775,  0.973797,
-	 0.973819,  0.973841,  0.973862,  0.973884,  0.973906,  0.973928,  0.973949,  0.973971,
-	 0.973993,  0.974015,  0.974036,  0.974058,  0.974080,  0.974101,  0.974123,  0.974145,
-	 0.974166,  0.974188,  0.974210,  0.974231,  0.974253,  0.974275,  0.974296,  0.974318,
-	 0.974339,  0.974361,  0.974383,  0.974404,  0.974426,  0.974447,  0.974469,  0.974490,
-	 0.974512,  0.974533,  0.974555,  0.974576,  0.974598,  0.974619,  0.974641,  0.974662,
-	 0.974684,  0.974705,  0.974726,  0.974748,  0.974769,  0.974791,  0.974812,  0.974833,
-	 0.974855,  0.974876,  0.974897,  0.974919,  0.974940,  0.974961,  0.974983,  0.975004,
-	 0.975025,  0.975047,  0.975068,  0.975089,  0.975110,  0.975132,  0.975153,  0.975174,
-	 0.975195,  0.975217,  0.975238,  0.975259,  0.975280,  0.975301,  0.975323,  0.975344,
-	 0.975365,  0.975386,  0.975407,  0.975428,  0.975449,  0.975471,  0.975492,  0.975513,
-	 0.975534,  0.975555,  0.975576,  0.975597,  0.975618,  0.975639,  0.975660,  0.975681,
-	 0.975702,  0.975723,  0.975744,  0.975765,  0.975786,  0.975807,  0.975828,  0.975849,
-	 0.975870,  0.975891,  0.975912,  0.975933,  0.975954,  0.975974,  0.975995,  0.976016,
-	 0.976037,  0.976058,  0.976079,  0.976100,  0.976120,  0.976141,  0.976162,  0.976183,
-	 0.976204,  0.976224,  0.976245,  0.976266,  0.976287,  0.976308,  0.976328,  0.976349,
-	 0.976370,  0.976390,  0.976411,  0.976432,  0.976453,  0.976473,  0.976494,  0.976515,
-	 0.976535,  0.976556,  0.976576,  0.976597,  0.976618,  0.976638,  0.976659,  0.976680,
-	 0.976700,  0.976721,  0.976741,  0.976762,  0.976782,  0.976803,  0.976823,  0.976844,
-	 0.976864,  0.976885,  0.976905,  0.976926,  0.976946,  0.976967,  0.976987,  0.977008,
-	 0.977028,  0.977049,  0.977069,  0.977089,  0.977110,  0.977130,  0.977151,  0.977171,
-	 0.977191,  0.977212,  0.977232,  0.977252,  0.977273,  0.977293,  0.977313,  0.977334,
-	 0.977354,  0.977374,  0.977394,  0.977415,  0.977435,  0.977455,  0.977475,  0.977496,
-	 0.977516,  0.977536,  0.977556,  0.977577,  0.977597,  0.977617,  0.977637,  0.977657,
-	 0.977677,  0.977697,  0.977718,  0.977738,  0.977758,  0.977778,  0.977798,  0.977818,
-	 0.977838,  0.977858,  0.977878,  0.977898,  0.977918,  0.977938,  0.977959,  0.977979,
-	 0.977998,  0.978019,  0.978038,  0.978058,  0.978078,  0.978098,  0.978118,  0.978138,
-	 0.978158,  0.978178,  0.978198,  0.978218,  0.978238,  0.978258,  0.978278,  0.978298,
-	 0.978317,  0.978337,  0.978357,  0.978377,  0.978397,  0.978417,  0.978436,  0.978456,
-	 0.978476,  0.978496,  0.978516,  0.978535,  0.978555,  0.978575,  0.978594,  0.978614,
-	 0.978634,  0.978654,  0.978673,  0.978693,  0.978713,  0.978732,  0.978752,  0.978772,
-	 0.978791,  0.978811,  0.978831,  0.978850,  0.978870,  0.978889,  0.978909,  0.978929,
-	 0.978948,  0.978968,  0.978987,  0.979007,  0.979026,  0.979046,  0.979065,  0.979085,
-	 0.979104,  0.979124,  0.979143,  0.979163,  0.979182,  0.979202,  0.979221,  0.979241,
-	 0.979260,  0.979280,  0.979299,  0.979318,  0.979338,  0.979357,  0.979376,  0.979396,
-	 0.979415,  0.979435,  0.979454,  0.979473,  0.979493,  0.979512,  0.979531,  0.979550,
-	 0.979570,  0.979589,  0.979608,  0.979628,  0.979647,  0.979666,  0.979685,  0.979704,
-	 0.979724,  0.979743,  0.979762,  0.979781,  0.979800,  0.979820,  0.979839,  0.979858,
-	 0.979877,  0.979896,  0.979915,  0.979934,  0.979954,  0.979973,  0.979992,  0.980011,
-	 0.980030,  0.980049,  0.980068,  0.980087,  0.980106,  0.980125,  0.980144,  0.980163,
-	 0.980182,  0.980201,  0.980220,  0.980239,  0.980258,  0.980277,  0.980296,  0.980315,
-	 0.980334,  0.980353,  0.980372,  0.980390,  0.980409,  0.980428,  0.980447,  0.980466,
-	 0.980485,  0.980504,  0.980523,  0.980541,  0.980560,  0.980579,  0.980598,  0.980617,
-	 0.980635,  0.980654,  0.980673,  0.980692,  0.980710,  0.980729,  0.980748,  0.980767,
-	 0.980785,  0.980804,  0.980823,  0.980841,  0.980860,  0.980879,  0.980897,  0.980916,
-	 0.980935,  0.980953,  0.980972,  0.980990,  0.981009,  0.981028,  0.981046,  0.981065,
-	 0.981083,  0.981102,  0.981120,  0.981139,  0.981158,  0.981176,  0.981195,  0.981213,
-	 0.981232,  0.981250,  0.981269,  0.981287,  0.981305,  0.981324,  0.981342,  0.981361,
-	 0.981379,  0.981398,  0.981416,  0.981434,  0.981453,  0.981471,  0.981490,  0.981508,
-	 0.981526,  0.981545,  0.981563,  0.981581,  0.981600,  0.981618,  0.981636,  0.981654,
-	 0.981673,  0.981691,  0.981709,  0.981727,  0.981746,  0.981764,  0.981782,  0.981800,
-	 0.981819,  0.981837,  0.981855,  0.981873,  0.981891,  0.981909,  0.981928,  0.981946,
-	 0.981964,  0.981982,  0.982000,  0.982018,  0.982036,  0.982054,  0.982072,  0.982091,
-	 0.982109,  0.982127,  0.982145,  0.982163,  0.982181,  0.982199,  0.982217,  0.982235,
-	 0.982253,  0.982271,  0.982289,  0.982307,  0.982325,  0.982343,  0.982360,  0.982378,
-	 0.982396,  0.982414,  0.982432,  0.982450,  0.982468,  0.982486,  0.982504,  0.982521,
-	 0.982539,  0.982557,  0.982575,  0.982593,  0.982611,  0.982628,  0.982646,  0.982664,
-	 0.982682,  0.982699,  0.982717,  0.982735,  0.982753,  0.982770,  0.982788,  0.982806,
-	 0.982824,  0.982841,  0.982859,  0.982877,  0.982894,  0.982912,  0.982930,  0.982947,
-	 0.982965,  0.982982,  0.983000,  0.983018,  0.983035,  0.983053,  0.983070,  0.983088,
-	 0.983105,  0.983123,  0.983141,  0.983158,  0.983176,  0.983193,  0.983211,  0.983228,
-	 0.983246,  0.983263,  0.983281,  0.983298,  0.983315,  0.983333,  0.983350,  0.983368,
-	 0.983385,  0.983402,  0.983420,  0.983437,  0.983455,  0.983472,  0.983489,  0.983507,
-	 0.983524,  0.983541,  0.983559,  0.983576,  0.983593,  0.983611,  0.983628,  0.983645,
-	 0.983662,  0.983680,  0.983697,  0.983714,  0.983731,  0.983749,  0.983766,  0.983783,
-	 0.983800,  0.983817,  0.983835,  0.983852,  0.983869,  0.983886,  0.983903,  0.983920,
-	 0.983937,  0.983955,  0.983972,  0.983989,  0.984006,  0.984023,  0.984040,  0.984057,
-	 0.984074,  0.984091,  0.984108,  0.984125,  0.984142,  0.984159,  0.984176,  0.984193,
-	 0.984210,  0.984227,  0.984244,  0.984261,  0.984278,  0.984295,  0.984312,  0.984329,
-	 0.984346,  0.984362,  0.984379,  0.984396,  0.984413,  0.984430,  0.984447,  0.984464,
-	 0.984480,  0.984497,  0.984514,  0.984531,  0.984548,  0.984564,  0.984581,  0.984598,
-	 0.984615,  0.984632,  0.984648,  0.984665,  0.984682,  0.984698,  0.984715,  0.984732,
-	 0.984748,  0.984765,  0.984782,  0.984798,  0.984815,  0.984832,  0.984848,  0.984865,
-	 0.984882,  0.984898,  0.984915,  0.984931,  0.984948,  0.984965,  0.984981,  0.984998,
-	 0.985014,  0.985031,  0.985047,  0.985064,  0.985080,  0.985097,  0.985113,  0.985130,
-	 0.985146,  0.985163,  0.985179,  0.985196,  0.985212,  0.985228,  0.985245,  0.985261,
-	 0.985278,  0.985294,  0.985310,  0.985327,  0.985343,  0.985359,  0.985376,  0.985392,
-	 0.985408,  0.985425,  0.985441,  0.985457,  0.985474,  0.985490,  0.985506,  0.985523,
-	 0.985539,  0.985555,  0.985571,  0.985587,  0.985604,  0.985620,  0.985636,  0.985652,
-	 0.985668,  0.985685,  0.985701,  0.985717,  0.985733,  0.985749,  0.985765,  0.985781,
-	 0.985798,  0.985814,  0.985830,  0.985846,  0.985862,  0.985878,  0.985894,  0.985910,
-	 0.985926,  0.985942,  0.985958,  0.985974,  0.985990,  0.986006,  0.986022,  0.986038,
-	 0.986054,  0.986070,  0.986086,  0.986102,  0.986118,  0.986134,  0.986150,  0.986165,
-	 0.986181,  0.986197,  0.986213,  0.986229,  0.986245,  0.986261,  0.986276,  0.986292,
-	 0.986308,  0.986324,  0.986340,  0.986355,  0.986371,  0.986387,  0.986403,  0.986419,
-	 0.986434,  0.986450,  0.986466,  0.986481,  0.986497,  0.986513,  0.986529,  0.986544,
-	 0.986560,  0.986576,  0.986591,  0.986607,  0.986623,  0.986638,  0.986654,  0.986669,
-	 0.986685,  0.986701,  0.986716,  0.986732,  0.986747,  0.986763,  0.986778,  0.986794,
-	 0.986809,  0.986825,  0.986840,  0.986856,  0.986871,  0.986887,  0.986902,  0.986918,
-	 0.986933,  0.986949,  0.986964,  0.986980,  0.986995,  0.987010,  0.987026,  0.987041,
-	 0.987057,  0.987072,  0.987087,  0.987103,  0.987118,  0.987133,  0.987149,  0.987164,
-	 0.987179,  0.987195,  0.987210,  0.987225,  0.987240,  0.987256,  0.987271,  0.987286,
-	 0.987301,  0.987317,  0.987332,  0.987347,  0.987362,  0.987377,  0.987393,  0.987408,
-	 0.987423,  0.987438,  0.987453,  0.987468,  0.987484,  0.987499,  0.987514,  0.987529,
-	 0.987544,  0.987559,  0.987574,  0.987589,  0.987604,  0.987619,  0.987634,  0.987649,
-	 0.987664,  0.987679,  0.987694,  0.987709,  0.987724,  0.987739,  0.987754,  0.987769,
-	 0.987784,  0.987799,  0.987814,  0.987829,  0.987844,  0.987859,  0.987874,  0.987889,
-	 0.987903,  0.987918,  0.987933,  0.987948,  0.987963,  0.987978,  0.987992,  0.988007,
-	 0.988022,  0.988037,  0.988052,  0.988066,  0.988081,  0.988096,  0.988111,  0.988125,
-	 0.988140,  0.988155,  0.988169,  0.988184,  0.988199,  0.988214,  0.988228,  0.988243,
-	 0.988258,  0.988272,  0.988287,  0.988301,  0.988316,  0.988331,  0.988345,  0.988360,
-	 0.988374,  0.988389,  0.988404,  0.988418,  0.988433,  0.988447,  0.988462,  0.988476,
-	 0.988491,  0.988505,  0.988520,  0.988534,  0.988549,  0.988563,  0.988578,  0.988592,
-	 0.988607,  0.988621,  0.988635,  0.988650,  0.988664,  0.988679,  0.988693,  0.988707,
-	 0.988722,  0.988736,  0.988750,  0.988765,  0.988779,  0.988793,  0.988808,  0.988822,
-	 0.988836,  0.988851,  0.988865,  0.988879,  0.988893,  0.988908,  0.988922,  0.988936,
-	 0.988950,  0.988964,  0.988979,  0.988993,  0.989007,  0.989021,  0.989035,  0.989050,
-	 0.989064,  0.989078,  0.989092,  0.989106,  0.989120,  0.989134,  0.989148,  0.989162,
-	 0.989177,  0.989191,  0.989205,  0.989219,  0.989233,  0.989247,  0.989261,  0.989275,
-	 0.989289,  0.989303,  0.989317,  0.989331,  0.989345,  0.989359,  0.989373,  0.989386,
-	 0.989400,  0.989414,  0.989428,  0.989442,  0.989456,  0.989470,  0.989484,  0.989498,
-	 0.989511,  0.989525,  0.989539,  0.989553,  0.989567,  0.989581,  0.989594,  0.989608,
-	 0.989622,  0.989636,  0.989650,  0.989663,  0.989677,  0.989691,  0.989704,  0.989718,
-	 0.989732,  0.989746,  0.989759,  0.989773,  0.989787,  0.989800,  0.989814,  0.989828,
-	 0.989841,  0.989855,  0.989869,  0.989882,  0.989896,  0.989909,  0.989923,  0.989936,
-	 0.989950,  0.989964,  0.989977,  0.989991,  0.990004,  0.990018,  0.990031,  0.990045,
-	 0.990058,  0.990072,  0.990085,  0.990099,  0.990112,  0.990126,  0.990139,  0.990152,
-	 0.990166,  0.990179,  0.990193,  0.990206,  0.990219,  0.990233,  0.990246,  0.990259,
-	 0.990273,  0.990286,  0.990299,  0.990313,  0.990326,  0.990339,  0.990353,  0.990366,
-	 0.990379,  0.990393,  0.990406,  0.990419,  0.990432,  0.990445,  0.990459,  0.990472,
-	 0.990485,  0.990498,  0.990511,  0.990525,  0.990538,  0.990551,  0.990564,  0.990577,
-	 0.990590,  0.990603,  0.990617,  0.990630,  0.990643,  0.990656,  0.990669,  0.990682,
-	 0.990695,  0.990708,  0.990721,  0.990734,  0.990747,  0.990760,  0.990773,  0.990786,
-	 0.990799,  0.990812,  0.990825,  0.990838,  0.990851,  0.990864,  0.990877,  0.990890,
-	 0.990903,  0.990916,  0.990928,  0.990941,  0.990954,  0.990967,  0.990980,  0.990993,
-	 0.991006,  0.991018,  0.991031,  0.991044,  0.991057,  0.991070,  0.991082,  0.991095,
-	 0.991108,  0.991121,  0.991133,  0.991146,  0.991159,  0.991172,  0.991184,  0.991197,
-	 0.991210,  0.991222,  0.991235,  0.991248,  0.991260,  0.991273,  0.991286,  0.991298,
-	 0.991311,  0.991323,  0.991336,  0.991349,  0.991361,  0.991374,  0.991386,  0.991399,
-	 0.991411,  0.991424,  0.991437,  0.991449,  0.991462,  0.991474,  0.991487,  0.991499,
-	 0.991511,  0.991524,  0.991536,  0.991549,  0.991561,  0.991574,  0.991586,  0.991598,
-	 0.991611,  0.991623,  0.991636,  0.991648,  0.991660,  0.991673,  0.991685,  0.991697,
-	 0.991710,  0.991722,  0.991734,  0.991747,  0.991759,  0.991771,  0.991783,  0.991796,
-	 0.991808,  0.991820,  0.991832,  0.991845,  0.991857,  0.991869,  0.991881,  0.991894,
-	 0.991906,  0.991918,  0.991930,  0.991942,  0.991954,  0.991966,  0.991979,  0.991991,
-	 0.992003,  0.992015,  0.992027,  0.992039,  0.992051,  0.992063,  0.992075,  0.992087,
-	 0.992099,  0.992111,  0.992123,  0.992135,  0.992147,  0.992159,  0.992171,  0.992183,
-	 0.992195,  0.992207,  0.992219,  0.992231,  0.992243,  0.992255,  0.992267,  0.992279,
-	 0.992291,  0.992302,  0.992314,  0.992326,  0.992338,  0.992350,  0.992362,  0.992374,
-	 0.992385,  0.992397,  0.992409,  0.992421,  0.992433,  0.992444,  0.992456,  0.992468,
-	 0.992480,  0.992491,  0.992503,  0.992515,  0.992526,  0.992538,  0.992550,  0.992561,
-	 0.992573,  0.992585,  0.992596,  0.992608,  0.992620,  0.992631,  0.992643,  0.992655,
-	 0.992666,  0.992678,  0.992689,  0.992701,  0.992712,  0.992724,  0.992736,  0.992747,
-	 0.992759,  0.992770,  0.992782,  0.992793,  0.992805,  0.992816,  0.992828,  0.992839,
-	 0.992850,  0.992862,  0.992873,  0.992885,  0.992896,  0.992908,  0.992919,  0.992930,
-	 0.992942,  0.992953,  0.992964,  0.992976,  0.992987,  0.992998,  0.993010,  0.993021,
-	 0.993032,  0.993044,  0.993055,  0.993066,  0.993077,  0.993089,  0.993100,  0.993111,
-	 0.993122,  0.993134,  0.993145,  0.993156,  0.993167,  0.993178,  0.993190,  0.993201,
-	 0.993212,  0.993223,  0.993234,  0.993245,  0.993257,  0.993268,  0.993279,  0.993290,
-	 0.993301,  0.993312,  0.993323,  0.993334,  0.993345,  0.993356,  0.993367,  0.993378,
-	 0.993389,  0.993400,  0.993411,  0.993422,  0.993433,  0.993444,  0.993455,  0.993466,
-	 0.993477,  0.993488,  0.993499,  0.993510,  0.993521,  0.993532,  0.993542,  0.993553,
-	 0.993564,  0.993575,  0.993586,  0.993597,  0.993608,  0.993618,  0.993629,  0.993640,
-	 0.993651,  0.993662,  0.993672,  0.993683,  0.993694,  0.993705,  0.993715,  0.993726,
-	 0.993737,  0.993747,  0.993758,  0.993769,  0.993779,  0.993790,  0.993801,  0.993811,
-	 0.993822,  0.993833,  0.993843,  0.993854,  0.993865,  0.993875,  0.993886,  0.993896,
-	 0.993907,  0.993918,  0.993928,  0.993939,  0.993949,  0.993960,  0.993970,  0.993981,
-	 0.993991,  0.994002,  0.994012,  0.994023,  0.994033,  0.994044,  0.994054,  0.994064,
-	 0.994075,  0.994085,  0.994096,  0.994106,  0.994116,  0.994127,  0.994137,  0.994148,
-	 0.994158,  0.994168,  0.994179,  0.994189,  0.994199,  0.994210,  0.994220,  0.994230,
-	 0.994240,  0.994251,  0.994261,  0.994271,  0.994281,  0.994292,  0.994302,  0.994312,
-	 0.994322,  0.994333,  0.994343,  0.994353,  0.994363,  0.994373,  0.994383,  0.994394,
-	 0.994404,  0.994414,  0.994424,  0.994434,  0.994444,  0.994454,  0.994464,  0.994474,
-	 0.994484,  0.994494,  0.994505,  0.994515,  0.994525,  0.994535,  0.994545,  0.994555,
-	 0.994565,  0.994575,  0.994585,  0.994594,  0.994604,  0.994614,  0.994624,  0.994634,
-	 0.994644,  0.994654,  0.994664,  0.994674,  0.994684,  0.994694,  0.994703,  0.994713,
-	 0.994723,  0.994733,  0.994743,  0.994753,  0.994762,  0.994772,  0.994782,  0.994792,
-	 0.994802,  0.994811,  0.994821,  0.994831,  0.994841,  0.994850,  0.994860,  0.994870,
-	 0.994879,  0.994889,  0.994899,  0.994908,  0.994918,  0.994928,  0.994937,  0.994947,
-	 0.994957,  0.994966,  0.994976,  0.994985,  0.994995,  0.995005,  0.995014,  0.995024,
-	 0.995033,  0.995043,  0.995052,  0.995062,  0.995071,  0.995081,  0.995090,  0.995100,
-	 0.995109,  0.995119,  0.995128,  0.995138,  0.995147,  0.995156,  0.995166,  0.995175,
-	 0.995185,  0.995194,  0.995203,  0.995213,  0.995222,  0.995232,  0.995241,  0.995250,
-	 0.995260,  0.995269,  0.995278,  0.995288,  0.995297,  0.995306,  0.995315,  0.995325,
-	 0.995334,  0.995343,  0.995352,  0.995362,  0.995371,  0.995380,  0.995389,  0.995398,
-	 0.995408,  0.995417,  0.995426,  0.995435,  0.995444,  0.995453,  0.995463,  0.995472,
-	 0.995481,  0.995490,  0.995499,  0.995508,  0.995517,  0.995526,  0.995535,  0.995544,
-	 0.995553,  0.995562,  0.995571,  0.995580,  0.995589,  0.995598,  0.995607,  0.995616,
-	 0.995625,  0.995634,  0.995643,  0.995652,  0.995661,  0.995670,  0.995679,  0.995688,
-	 0.995697,  0.995705,  0.995714,  0.995723,  0.995732,  0.995741,  0.995750,  0.995759,
-	 0.995767,  0.995776,  0.995785,  0.995794,  0.995803,  0.995811,  0.995820,  0.995829,
-	 0.995838,  0.995846,  0.995855,  0.995864,  0.995872,  0.995881,  0.995890,  0.995899,
-	 0.995907,  0.995916,  0.995925,  0.995933,  0.995942,  0.995950,  0.995959,  0.995968,
-	 0.995976,  0.995985,  0.995993,  0.996002,  0.996011,  0.996019,  0.996028,  0.996036,
-	 0.996045,  0.996053,  0.996062,  0.996070,  0.996079,  0.996087,  0.996096,  0.996104,
-	 0.996113,  0.996121,  0.996129,  0.996138,  0.996146,  0.996155,  0.996163,  0.996171,
-	 0.996180,  0.996188,  0.996197,  0.996205,  0.996213,  0.996222,  0.996230,  0.996238,
-	 0.996247,  0.996255,  0.996263,  0.996271,  0.996280,  0.996288,  0.996296,  0.996304,
-	 0.996313,  0.996321,  0.996329,  0.996337,  0.996345,  0.996354,  0.996362,  0.996370,
-	 0.996378,  0.996386,  0.996394,  0.996403,  0.996411,  0.996419,  0.996427,  0.996435,
-	 0.996443,  0.996451,  0.996459,  0.996467,  0.996475,  0.996483,  0.996491,  0.996499,
-	 0.996507,  0.996515,  0.996523,  0.996531,  0.996539,  0.996547,  0.996555,  0.996563,
-	 0.996571,  0.996579,  0.996587,  0.996595,  0.996603,  0.996611,  0.996619,  0.996626,
-	 0.996634,  0.996642,  0.996650,  0.996658,  0.996666,  0.996674,  0.996681,  0.996689,
-	 0.996697,  0.996705,  0.996712,  0.996720,  0.996728,  0.996736,  0.996743,  0.996751,
-	 0.996759,  0.996767,  0.996774,  0.996782,  0.996790,  0.996797,  0.996805,  0.996813,
-	 0.996820,  0.996828,  0.996836,  0.996843,  0.996851,  0.996858,  0.996866,  0.996874,
-	 0.996881,  0.996889,  0.996896,  0.996904,  0.996911,  0.996919,  0.996926,  0.996934,
-	 0.996941,  0.996949,  0.996956,  0.996964,  0.996971,  0.996979,  0.996986,  0.996994,
-	 0.997001,  0.997008,  0.997016,  0.997023,  0.997031,  0.997038,  0.997045,  0.997053,
-	 0.997060,  0.997067,  0.997075,  0.997082,  0.997089,  0.997097,  0.997104,  0.997111,
-	 0.997119,  0.997126,  0.997133,  0.997140,  0.997148,  0.997155,  0.997162,  0.997169,
-	 0.997176,  0.997184,  0.997191,  0.997198,  0.997205,  0.997212,  0.997219,  0.997227,
-	 0.997234,  0.997241,  0.997248,  0.997255,  0.997262,  0.997269,  0.997276,  0.997283,
-	 0.997290,  0.997298,  0.997305,  0.997312,  0.997319,  0.997326,  0.997333,  0.997340,
-	 0.997347,  0.997354,  0.997361,  0.997368,  0.997374,  0.997381,  0.997388,  0.997395,
-	 0.997402,  0.997409,  0.997416,  0.997423,  0.997430,  0.997437,  0.997443,  0.997450,
-	 0.997457,  0.997464,  0.997471,  0.997478,  0.997484,  0.997491,  0.997498,  0.997505,
-	 0.997511,  0.997518,  0.997525,  0.997532,  0.997538,  0.997545,  0.997552,  0.997559,
-	 0.997565,  0.997572,  0.997579,  0.997585,  0.997592,  0.997599,  0.997605,  0.997612,
-	 0.997618,  0.997625,  0.997632,  0.997638,  0.997645,  0.997651,  0.997658,  0.997665,
-	 0.997671,  0.997678,  0.997684,  0.997691,  0.997697,  0.997704,  0.997710,  0.997717,
-	 0.997723,  0.997730,  0.997736,  0.997742,  0.997749,  0.997755,  0.997762,  0.997768,
-	 0.997774,  0.997781,  0.997787,  0.997794,  0.997800,  0.997806,  0.997813,  0.997819,
-	 0.997825,  0.997832,  0.997838,  0.997844,  0.997851,  0.997857,  0.997863,  0.997869,
-	 0.997876,  0.997882,  0.997888,  0.997894,  0.997901,  0.997907,  0.997913,  0.997919,
-	 0.997925,  0.997931,  0.997938,  0.997944,  0.997950,  0.997956,  0.997962,  0.997968,
-	 0.997974,  0.997980,  0.997987,  0.997993,  0.997999,  0.998005,  0.998011,  0.998017,
-	 0.998023,  0.998029,  0.998035,  0.998041,  0.998047,  0.998053,  0.998059,  0.998065,
-	 0.998071,  0.998077,  0.998083,  0.998089,  0.998094,  0.998100,  0.998106,  0.998112,
-	 0.998118,  0.998124,  0.998130,  0.998136,  0.998142,  0.998147,  0.998153,  0.998159,
-	 0.998165,  0.998171,  0.998176,  0.998182,  0.998188,  0.998194,  0.998200,  0.998205,
-	 0.998211,  0.998217,  0.998222,  0.998228,  0.998234,  0.998240,  0.998245,  0.998251,
-	 0.998257,  0.998262,  0.998268,  0.998273,  0.998279,  0.998285,  0.998290,  0.998296,
-	 0.998302,  0.998307,  0.998313,  0.998318,  0.998324,  0.998329,  0.998335,  0.998340,
-	 0.998346,  0.998351,  0.998357,  0.998362,  0.998368,  0.998373,  0.998379,  0.998384,
-	 0.998390,  0.998395,  0.998401,  0.998406,  0.998411,  0.998417,  0.998422,  0.998428,
-	 0.998433,  0.998438,  0.998444,  0.998449,  0.998454,  0.998460,  0.998465,  0.998470,
-	 0.998476,  0.998481,  0.998486,  0.998491,  0.998497,  0.998502,  0.998507,  0.998512,
-	 0.998518,  0.998523,  0.998528,  0.998533,  0.998538,  0.998544,  0.998549,  0.998554,
-	 0.998559,  0.998564,  0.998569,  0.998574,  0.998580,  0.998585,  0.998590,  0.998595,
-	 0.998600,  0.998605,  0.998610,  0.998615,  0.998620,  0.998625,  0.998630,  0.998635,
-	 0.998640,  0.998645,  0.998650,  0.998655,  0.998660,  0.998665,  0.998670,  0.998675,
-	 0.998680,  0.998685,  0.998690,  0.998695,  0.998700,  0.998704,  0.998709,  0.998714,
-	 0.998719,  0.998724,  0.998729,  0.998734,  0.998738,  0.998743,  0.998748,  0.998753,
-	 0.998758,  0.998762,  0.998767,  0.998772,  0.998777,  0.998781,  0.998786,  0.998791,
-	 0.998795,  0.998800,  0.998805,  0.998810,  0.998814,  0.998819,  0.998824,  0.998828,
-	 0.998833,  0.998837,  0.998842,  0.998847,  0.998851,  0.998856,  0.998860,  0.998865,
-	 0.998870,  0.998874,  0.998879,  0.998883,  0.998888,  0.998892,  0.998897,  0.998901,
-	 0.998906,  0.998910,  0.998915,  0.998919,  0.998924,  0.998928,  0.998932,  0.998937,
-	 0.998941,  0.998946,  0.998950,  0.998954,  0.998959,  0.998963,  0.998968,  0.998972,
-	 0.998976,  0.998981,  0.998985,  0.998989,  0.998994,  0.998998,  0.999002,  0.999006,
-	 0.999011,  0.999015,  0.999019,  0.999023,  0.999028,  0.999032,  0.999036,  0.999040,
-	 0.999044,  0.999049,  0.999053,  0.999057,  0.999061,  0.999065,  0.999069,  0.999074,
-	 0.999078,  0.999082,  0.999086,  0.999090,  0.999094,  0.999098,  0.999102,  0.999106,
-	 0.999110,  0.999114,  0.999118,  0.999122,  0.999126,  0.999130,  0.999134,  0.999138,
-	 0.999142,  0.999146,  0.999150,  0.999154,  0.999158,  0.999162,  0.999166,  0.999170,
-	 0.999174,  0.999178,  0.999182,  0.999186,  0.999189,  0.999193,  0.999197,  0.999201,
-	 0.999205,  0.999209,  0.999212,  0.999216,  0.999220,  0.999224,  0.999228,  0.999231,
-	 0.999235,  0.999239,  0.999243,  0.999246,  0.999250,  0.999254,  0.999257,  0.999261,
-	 0.999265,  0.999268,  0.999272,  0.999276,  0.999279,  0.999283,  0.999287,  0.999290,
-	 0.999294,  0.999297,  0.999301,  0.999305,  0.999308,  0.999312,  0.999315,  0.999319,
-	 0.999322,  0.999326,  0.999329,  0.999333,  0.999336,  0.999340,  0.999343,  0.999347,
-	 0.999350,  0.999354,  0.999357,  0.999361,  0.999364,  0.999367,  0.999371,  0.999374,
-	 0.999378,  0.999381,  0.999384,  0.999388,  0.999391,  0.999394,  0.999398,  0.999401,
-	 0.999404,  0.999408,  0.999411,  0.999414,  0.999418,  0.999421,  0.999424,  0.999427,
-	 0.999431,  0.999434,  0.999437,  0.999440,  0.999443,  0.999447,  0.999450,  0.999453,
-	 0.999456,  0.999459,  0.999462,  0.999466,  0.999469,  0.999472,  0.999475,  0.999478,
-	 0.999481,  0.999484,  0.999487,  0.999490,  0.999493,  0.999497,  0.999500,  0.999503,
-	 0.999506,  0.999509,  0.999512,  0.999515,  0.999518,  0.999521,  0.999524,  0.999527,
-	 0.999529,  0.999532,  0.999535,  0.999538,  0.999541,  0.999544,  0.999547,  0.999550,
-	 0.999553,  0.999556,  0.999558,  0.999561,  0.999564,  0.999567,  0.999570,  0.999573,
-	 0.999575,  0.999578,  0.999581,  0.999584,  0.999586,  0.999589,  0.999592,  0.999595,
-	 0.999597,  0.999600,  0.999603,  0.999605,  0.999608,  0.999611,  0.999614,  0.999616,
-	 0.999619,  0.999621,  0.999624,  0.999627,  0.999629,  0.999632,  0.999635,  0.999637,
-	 0.999640,  0.999642,  0.999645,  0.999647,  0.999650,  0.999652,  0.999655,  0.999658,
-	 0.999660,  0.999663,  0.999665,  0.999667,  0.999670,  0.999672,  0.999675,  0.999677,
-	 0.999680,  0.999682,  0.999685,  0.999687,  0.999689,  0.999692,  0.999694,  0.999696,
-	 0.999699,  0.999701,  0.999704,  0.999706,  0.999708,  0.999710,  0.999713,  0.999715,
-	 0.999717,  0.999720,  0.999722,  0.999724,  0.999726,  0.999729,  0.999731,  0.999733,
-	 0.999735,  0.999738,  0.999740,  0.999742,  0.999744,  0.999746,  0.999748,  0.999750,
-	 0.999753,  0.999755,  0.999757,  0.999759,  0.999761,  0.999763,  0.999765,  0.999767,
-	 0.999769,  0.999771,  0.999774,  0.999776,  0.999778,  0.999780,  0.999782,  0.999784,
-	 0.999786,  0.999788,  0.999790,  0.999792,  0.999793,  0.999795,  0.999797,  0.999799,
-	 0.999801,  0.999803,  0.999805,  0.999807,  0.999809,  0.999811,  0.999812,  0.999814,
-	 0.999816,  0.999818,  0.999820,  0.999822,  0.999823,  0.999825,  0.999827,  0.999829,
-	 0.999831,  0.999832,  0.999834,  0.999836,  0.999838,  0.999839,  0.999841,  0.999843,
-	 0.999844,  0.999846,  0.999848,  0.999849,  0.999851,  0.999853,  0.999854,  0.999856,
-	 0.999858,  0.999859,  0.999861,  0.999862,  0.999864,  0.999866,  0.999867,  0.999869,
-	 0.999870,  0.999872,  0.999873,  0.999875,  0.999876,  0.999878,  0.999879,  0.999881,
-	 0.999882,  0.999884,  0.999885,  0.999887,  0.999888,  0.999890,  0.999891,  0.999892,
-	 0.999894,  0.999895,  0.999897,  0.999898,  0.999899,  0.999901,  0.999902,  0.999903,
-	 0.999905,  0.999906,  0.999907,  0.999909,  0.999910,  0.999911,  0.999913,  0.999914,
-	 0.999915,  0.999916,  0.999917,  0.999919,  0.999920,  0.999921,  0.999922,  0.999924,
-	 0.999925,  0.999926,  0.999927,  0.999928,  0.999929,  0.999930,  0.999932,  0.999933,
-	 0.999934,  0.999935,  0.999936,  0.999937,  0.999938,  0.999939,  0.999940,  0.999941,
-	 0.999942,  0.999943,  0.999944,  0.999945,  0.999946,  0.999947,  0.999948,  0.999949,
-	 0.999950,  0.999951,  0.999952,  0.999953,  0.999954,  0.999955,  0.999956,  0.999957,
-	 0.999958,  0.999959,  0.999959,  0.999960,  0.999961,  0.999962,  0.999963,  0.999964,
-	 0.999964,  0.999965,  0.999966,  0.999967,  0.999968,  0.999968,  0.999969,  0.999970,
-	 0.999971,  0.999971,  0.999972,  0.999973,  0.999973,  0.999974,  0.999975,  0.999976,
-	 0.999976,  0.999977,  0.999977,  0.999978,  0.999979,  0.999979,  0.999980,  0.999981,
-	 0.999981,  0.999982,  0.999982,  0.999983,  0.999983,  0.999984,  0.999985,  0.999985,
-	 0.999986,  0.999986,  0.999987,  0.999987,  0.999988,  0.999988,  0.999988,  0.999989,
-	 0.999989,  0.999990,  0.999990,  0.999991,  0.999991,  0.999991,  0.999992,  0.999992,
-	 0.999993,  0.999993,  0.999993,  0.999994,  0.999994,  0.999994,  0.999995,  0.999995,
-	 0.999995,  0.999996,  0.999996,  0.999996,  0.999996,  0.999997,  0.999997,  0.999997,
-	 0.999997,  0.999998,  0.999998,  0.999998,  0.999998,  0.999998,  0.999999,  0.999999,
-	 0.999999,  0.999999,  0.999999,  0.999999,  0.999999,  0.999999,  1.000000,  1.000000,
-	 1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000,  1.000000
-};
+		// Make sure the zero is exact
+		table[n / 4] = 0.0f;
+
+		for (int i = 1; i < (n / 4); i++)
+			table[n / 2 - i] = table[i];
 
-static const float *cosTables[17] = {
-	0           , 0           , 0            , 0            ,
-	cosTable16  , cosTable32  , cosTable64   , cosTable128  ,
-	cosTable256 , cosTable512 , cosTable1024 , cosTable2048 ,
-	cosTable4096, cosTable8192, cosTable16384, cosTable32768,
-	cosTable65536
+		_tables[bits] = table;
+	}
 };
 
+static CosineTables cosineTables;
+
 const float *getCosineTable(int bits) {
 	assert((bits >= 4) && (bits <= 16));
 
-	return cosTables[bits];
+	return cosineTables.get(bits);
 }
 
 } // End of namespace Common
@@ -19,7 +19,7 @@
  */
 
 /** @file common/cosinetables.h
- *  Static cosine tables.
+ *  Cosine tables.
  */
 
 #ifndef COMMON_COSINETABLES_H
@@ -27,6 +27,11 @@
 
 namespace Common {
 
+/** Return the cosine table for transforms of size 2^bits.
+ *
+ *  The table is generated the first time it's requested, and stays
+ *  valid until the end of the program. Requesting it is thread-safe.
+ */
 const float *getCosineTable(int bits);
 
 } // End of namespace Common
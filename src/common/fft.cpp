@@ -30,6 +30,23 @@
 #include <cassert>
 #include <cstring>
 
+#include <SDL_version.h>
+#include <SDL_cpuinfo.h>
+
+#ifdef __SSE2__
+	#include <emmintrin.h>
+
+	/* AVX code is compiled for its own functions only, and used if the CPU supports it.
+	 * SDL can only tell us about AVX support since 2.0.2. */
+	#if (defined(__i386__) || defined(__x86_64__)) && SDL_VERSION_ATLEAST(2, 0, 2) && \
+	    ((defined(__clang__) && (__clang_major__ >= 4)) || \
+	     (!defined(__clang__) && defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+
+		#include <immintrin.h>
+		#define FFT_HAVE_AVX 1
+	#endif
+#endif
+
 #include "common/maths.h"
 #include "common/cosinetables.h"
 #include "common/util.h"
@@ -37,9 +54,38 @@
 
 namespace Common {
 
-FFT::FFT(int bits, bool inverse) : _bits(bits), _inverse(inverse) {
+static void pass(Complex *z, const float *wre, unsigned int n);
+static void pass_big(Complex *z, const float *wre, unsigned int n);
+
+#ifdef __SSE2__
+static void passSSE(Complex *z, const float *wre, unsigned int n);
+#endif
+
+#ifdef FFT_HAVE_AVX
+static void passAVX(Complex *z, const float *wre, unsigned int n);
+#endif
+
+FFT::FFT(int bits, bool inverse, InstructionSet instructionSet) : _bits(bits), _inverse(inverse) {
 	assert((_bits >= 2) && (_bits <= 16));
 
+	_instructionSet = findInstructionSet(instructionSet);
+
+	_pass    = pass;
+	_passBig = pass_big;
+
+#ifdef __SSE2__
+	if (_instructionSet == kInstructionSetSSE)
+		_pass = _passBig = passSSE;
+#endif
+
+#ifdef FFT_HAVE_AVX
+	if (_instructionSet == kInstructionSetAVX)
+		_pass = _passBig = passAVX;
+#endif
+
+	for (int i = 0; i < 17; i++)
+		_cosTables[i] = ((i >= 4) && (i <= _bits)) ? getCosineTable(i) : 0;
+
 	int n = 1 << bits;
 
 	_tmpBuf = new Complex[n];
@@ -62,6 +108,43 @@ const uint16 *FFT::getRevTab() const {
 	return _revTab;
 }
 
+FFT::InstructionSet FFT::getInstructionSet() const {
+	return _instructionSet;
+}
+
+const char *FFT::getInstructionSetName(InstructionSet instructionSet) {
+	switch (instructionSet) {
+		case kInstructionSetBest:
+			return "Best";
+		case kInstructionSetScalar:
+			return "Scalar";
+		case kInstructionSetSSE:
+			return "SSE";
+		case kInstructionSetAVX:
+			return "AVX";
+	}
+
+	return "Unknown";
+}
+
+FFT::InstructionSet FFT::findInstructionSet(InstructionSet instructionSet) {
+	if (instructionSet == kInstructionSetBest)
+		instructionSet = kInstructionSetAVX;
+
+#ifdef FFT_HAVE_AVX
+	if ((instructionSet >= kInstructionSetAVX) && SDL_HasAVX())
+		return kInstructionSetAVX;
+#endif
+
+#ifdef __SSE2__
+	// Always there when we're compiled for it
+	if (instructionSet >= kInstructionSetSSE)
+		return kInstructionSetSSE;
+#endif
+
+	return kInstructionSetScalar;
+}
+
 void FFT::permute(Complex *z) {
 	int np = 1 << _bits;
 
@@ -172,15 +255,6 @@ PASS(pass)
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
-#define DECL_FFT(t,n,n2,n4)\
-static void fft##n(Complex *z)\
-{\
-	fft##n2(z);\
-	fft##n4(z+n4*2);\
-	fft##n4(z+n4*3);\
-	pass(z,getCosineTable(t),n4/2);\
-}
-
 static void fft4(Complex *z)
 {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
@@ -215,7 +289,7 @@ static void fft8(Complex *z)
 	TRANSFORM(z[1],z[3],z[5],z[7],sqrthalf,sqrthalf);
 }
 
-static void fft16(Complex *z)
+static void fft16(Complex *z, const float *cosTable)
 {
 	float t1, t2, t3, t4, t5, t6;
 
@@ -223,35 +297,162 @@ static void fft16(Complex *z)
 	fft4(z+8);
 	fft4(z+12);
 
-	const float * const cosTable = getCosineTable(4);
-
 	TRANSFORM_ZERO(z[0],z[4],z[8],z[12]);
 	TRANSFORM(z[2],z[6],z[10],z[14],sqrthalf,sqrthalf);
 	TRANSFORM(z[1],z[5],z[9],z[13],cosTable[1],cosTable[3]);
 	TRANSFORM(z[3],z[7],z[11],z[15],cosTable[3],cosTable[1]);
 }
 
-DECL_FFT(5, 32,16,8)
-DECL_FFT(6, 64,32,16)
-DECL_FFT(7, 128,64,32)
-DECL_FFT(8, 256,128,64)
-DECL_FFT(9, 512,256,128)
-#define pass pass_big
-DECL_FFT(10, 1024,512,256)
-DECL_FFT(11, 2048,1024,512)
-DECL_FFT(12, 4096,2048,1024)
-DECL_FFT(13, 8192,4096,2048)
-DECL_FFT(14, 16384,8192,4096)
-DECL_FFT(15, 32768,16384,8192)
-DECL_FFT(16, 65536,32768,16384)
-
-static void (* const fft_dispatch[])(Complex*) = {
-	fft4, fft8, fft16, fft32, fft64, fft128, fft256, fft512, fft1024,
-	fft2048, fft4096, fft8192, fft16384, fft32768, fft65536,
-};
+#ifdef __SSE2__
+// Load four complex values, as their real and imaginary parts
+#define LOAD_SSE(re, im, z) {\
+	const __m128 lo = _mm_loadu_ps((const float *) (z));\
+	const __m128 hi = _mm_loadu_ps((const float *) ((z) + 2));\
+	re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));\
+	im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));\
+}
+
+#define STORE_SSE(z, re, im) {\
+	_mm_storeu_ps((float *) (z)     , _mm_unpacklo_ps(re, im));\
+	_mm_storeu_ps((float *) ((z) + 2), _mm_unpackhi_ps(re, im));\
+}
+
+/* The radix pass, four values at once. The operations are the same as
+ * in TRANSFORM() and BUTTERFLIES(), in the same order. */
+static void passSSE(Complex *z, const float *wre, unsigned int n) {
+	const unsigned int o1 = 2 * n;
+	const unsigned int o2 = 4 * n;
+	const unsigned int o3 = 6 * n;
+
+	const float *wim = wre + o1;
+
+	for (unsigned int i = 0; i < o1; i += 4) {
+		const __m128 wr = _mm_loadu_ps(wre + i);
+
+		__m128 wi = _mm_loadu_ps(wim - i - 3);
+		wi = _mm_shuffle_ps(wi, wi, _MM_SHUFFLE(0, 1, 2, 3));
+
+		__m128 r0, i0, r1, i1, r2, i2, r3, i3;
+		LOAD_SSE(r0, i0, z + i);
+		LOAD_SSE(r1, i1, z + o1 + i);
+		LOAD_SSE(r2, i2, z + o2 + i);
+		LOAD_SSE(r3, i3, z + o3 + i);
+
+		const __m128 t1 = _mm_add_ps(_mm_mul_ps(r2, wr), _mm_mul_ps(i2, wi));
+		const __m128 t2 = _mm_sub_ps(_mm_mul_ps(i2, wr), _mm_mul_ps(r2, wi));
+		const __m128 t5 = _mm_sub_ps(_mm_mul_ps(r3, wr), _mm_mul_ps(i3, wi));
+		const __m128 t6 = _mm_add_ps(_mm_mul_ps(i3, wr), _mm_mul_ps(r3, wi));
+
+		const __m128 t3  = _mm_sub_ps(t5, t1);
+		const __m128 t5b = _mm_add_ps(t5, t1);
+		const __m128 t4  = _mm_sub_ps(t2, t6);
+		const __m128 t6b = _mm_add_ps(t2, t6);
+
+		STORE_SSE(z + o2 + i, _mm_sub_ps(r0, t5b), _mm_sub_ps(i0, t6b));
+		STORE_SSE(z      + i, _mm_add_ps(r0, t5b), _mm_add_ps(i0, t6b));
+		STORE_SSE(z + o3 + i, _mm_sub_ps(r1, t4 ), _mm_sub_ps(i1, t3 ));
+		STORE_SSE(z + o1 + i, _mm_add_ps(r1, t4 ), _mm_add_ps(i1, t3 ));
+	}
+}
+#endif
+
+#ifdef FFT_HAVE_AVX
+// Load eight complex values, as their real and imaginary parts. Within each
+// 128-bit lane, the values are in the order 0, 1, 4, 5 | 2, 3, 6, 7.
+#define LOAD_AVX(re, im, z) {\
+	const __m256 lo = _mm256_loadu_ps((const float *) (z));\
+	const __m256 hi = _mm256_loadu_ps((const float *) ((z) + 4));\
+	re = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));\
+	im = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));\
+}
+
+#define STORE_AVX(z, re, im) {\
+	_mm256_storeu_ps((float *) (z)     , _mm256_unpacklo_ps(re, im));\
+	_mm256_storeu_ps((float *) ((z) + 4), _mm256_unpackhi_ps(re, im));\
+}
+
+/** Combine eight twiddle factors into the order LOAD_AVX() produces. */
+__attribute__((target("avx")))
+static inline __m256 orderAVX(__m128 w0, __m128 w1) {
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_movelh_ps(w0, w1)), _mm_movehl_ps(w1, w0), 1);
+}
+
+/** The radix pass, eight values at once. */
+__attribute__((target("avx")))
+static void passAVX(Complex *z, const float *wre, unsigned int n) {
+	const unsigned int o1 = 2 * n;
+	const unsigned int o2 = 4 * n;
+	const unsigned int o3 = 6 * n;
+
+	const float *wim = wre + o1;
+
+	for (unsigned int i = 0; i < o1; i += 8) {
+		const __m256 wr = orderAVX(_mm_loadu_ps(wre + i), _mm_loadu_ps(wre + i + 4));
+
+		__m128 wi0 = _mm_loadu_ps(wim - i - 3);
+		__m128 wi1 = _mm_loadu_ps(wim - i - 7);
+		wi0 = _mm_shuffle_ps(wi0, wi0, _MM_SHUFFLE(0, 1, 2, 3));
+		wi1 = _mm_shuffle_ps(wi1, wi1, _MM_SHUFFLE(0, 1, 2, 3));
+
+		const __m256 wi = orderAVX(wi0, wi1);
+
+		__m256 r0, i0, r1, i1, r2, i2, r3, i3;
+		LOAD_AVX(r0, i0, z + i);
+		LOAD_AVX(r1, i1, z + o1 + i);
+		LOAD_AVX(r2, i2, z + o2 + i);
+		LOAD_AVX(r3, i3, z + o3 + i);
+
+		const __m256 t1 = _mm256_add_ps(_mm256_mul_ps(r2, wr), _mm256_mul_ps(i2, wi));
+		const __m256 t2 = _mm256_sub_ps(_mm256_mul_ps(i2, wr), _mm256_mul_ps(r2, wi));
+		const __m256 t5 = _mm256_sub_ps(_mm256_mul_ps(r3, wr), _mm256_mul_ps(i3, wi));
+		const __m256 t6 = _mm256_add_ps(_mm256_mul_ps(i3, wr), _mm256_mul_ps(r3, wi));
+
+		const __m256 t3  = _mm256_sub_ps(t5, t1);
+		const __m256 t5b = _mm256_add_ps(t5, t1);
+		const __m256 t4  = _mm256_sub_ps(t2, t6);
+		const __m256 t6b = _mm256_add_ps(t2, t6);
+
+		STORE_AVX(z + o2 + i, _mm256_sub_ps(r0, t5b), _mm256_sub_ps(i0, t6b));
+		STORE_AVX(z      + i, _mm256_add_ps(r0, t5b), _mm256_add_ps(i0, t6b));
+		STORE_AVX(z + o3 + i, _mm256_sub_ps(r1, t4 ), _mm256_sub_ps(i1, t3 ));
+		STORE_AVX(z + o1 + i, _mm256_add_ps(r1, t4 ), _mm256_add_ps(i1, t3 ));
+	}
+}
+#endif
 
 void FFT::calc(Complex *z) {
-	fft_dispatch[_bits - 2](z);
+	calc(&z, 1, 0, _bits);
+}
+
+void FFT::calc(Complex * const *z, int count) {
+	calc(z, count, 0, _bits);
+}
+
+void FFT::calc(Complex * const *z, int count, int offset, int bits) const {
+	if (bits <= 4) {
+		for (int i = 0; i < count; i++) {
+			if      (bits == 2)
+				fft4 (z[i] + offset);
+			else if (bits == 3)
+				fft8 (z[i] + offset);
+			else
+				fft16(z[i] + offset, _cosTables[4]);
+		}
+
+		return;
+	}
+
+	// Split radix: one transform of half the size, two of a quarter
+	const int n4 = 1 << (bits - 2);
+
+	calc(z, count, offset         , bits - 1);
+	calc(z, count, offset + n4 * 2, bits - 2);
+	calc(z, count, offset + n4 * 3, bits - 2);
+
+	// Combine them, while the twiddle factors are in the cache
+	const PassFunc passFunc = (bits >= 10) ? _passBig : _pass;
+	for (int i = 0; i < count; i++)
+		passFunc(z[i] + offset, _cosTables[bits], n4 / 2);
 }
 
 } // End of namespace Common
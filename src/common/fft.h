@@ -39,11 +39,27 @@ struct Complex;
 /** (Inverse) Fast Fourier Transform. */
 class FFT {
 public:
-	FFT(int bits, bool inverse);
+	/** The instruction sets the transform can be computed with. */
+	enum InstructionSet {
+		kInstructionSetBest,   ///< The best one the CPU supports.
+		kInstructionSetScalar, ///< Plain C++.
+		kInstructionSetSSE,    ///< SSE, 4 floats at once.
+		kInstructionSetAVX     ///< AVX, 8 floats at once.
+	};
+
+	/** Create a (inverse) FFT of size 2^bits.
+	 *
+	 *  If the requested instruction set is not available, the best
+	 *  available one below it is used instead.
+	 */
+	FFT(int bits, bool inverse, InstructionSet instructionSet = kInstructionSetBest);
 	~FFT();
 
 	const uint16 *getRevTab() const;
 
+	/** Return the instruction set actually used. */
+	InstructionSet getInstructionSet() const;
+
 	/** Do the permutation needed BEFORE calling calc(). */
 	void permute(Complex *z);
 
@@ -54,7 +70,19 @@ public:
 	 */
 	void calc(Complex *z);
 
+	/** Do complex FFTs over several independent data sets, like the channels of a sound.
+	 *
+	 *  Each pass over the twiddle factors is done for all data sets at once.
+	 */
+	void calc(Complex * const *z, int count);
+
+	/** Return the name of an instruction set. */
+	static const char *getInstructionSetName(InstructionSet instructionSet);
+
 private:
+	/** A radix pass combining the sub-transforms, over z[0...8n-1]. */
+	typedef void (*PassFunc)(Complex *z, const float *wre, unsigned int n);
+
 	int  _bits;
 	bool _inverse;
 
@@ -65,7 +93,18 @@ private:
 
 	int _splitRadix;
 
+	InstructionSet _instructionSet;
+
+	PassFunc _pass;    ///< The radix pass for smaller transforms.
+	PassFunc _passBig; ///< The radix pass for transforms of 1024 and up.
+
+	const float *_cosTables[17]; ///< Twiddle factors, by transform size.
+
+	void calc(Complex * const *z, int count, int offset, int bits) const;
+
 	static int splitRadixPermutation(int i, int n, bool inverse);
+
+	static InstructionSet findInstructionSet(InstructionSet instructionSet);
 };
 
 } // End of namespace Common
@@ -0,0 +1,179 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file common/fftbench.cpp
+ *  Checking and measuring the FFT and MDCT.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+#include "common/maths.h"
+#include "common/fft.h"
+#include "common/mdct.h"
+#include "common/fftbench.h"
+
+namespace Common {
+
+/** Return the largest difference between a transform output and its reference. */
+static double getMaxError(const float *output, const double *reference, int n) {
+	double maxError = 0.0;
+
+	for (int i = 0; i < n; i++)
+		maxError = MAX(maxError, std::fabs(output[i] - reference[i]));
+
+	return maxError;
+}
+
+/** Compare an FFT and an inverse MDCT of this instruction set against the naive transforms. */
+static void checkFFT(FFT::InstructionSet instructionSet, int bits, const float *input,
+                     double &fftError, double &mdctError) {
+
+	const int n = 1 << bits;
+
+	std::vector<double> reference(4 * n);
+
+	// FFT of n complex numbers
+	for (int k = 0; k < n; k++) {
+		double re = 0.0, im = 0.0;
+
+		for (int j = 0; j < n; j++) {
+			const double angle = -2.0 * M_PI * j * k / n;
+
+			re += input[2 * j] * std::cos(angle) - input[2 * j + 1] * std::sin(angle);
+			im += input[2 * j] * std::sin(angle) + input[2 * j + 1] * std::cos(angle);
+		}
+
+		reference[2 * k    ] = re;
+		reference[2 * k + 1] = im;
+	}
+
+	std::vector<Complex> z(n);
+	std::memcpy(&z[0], input, n * sizeof(Complex));
+
+	FFT fft(bits, false, instructionSet);
+	fft.permute(&z[0]);
+	fft.calc(&z[0]);
+
+	fftError = getMaxError((const float *) &z[0], &reference[0], 2 * n);
+
+	// Inverse MDCT of 2n coefficients into 4n samples
+	const int mdctSize = 4 * n;
+
+	for (int i = 0; i < mdctSize; i++) {
+		double sample = 0.0;
+
+		for (int k = 0; k < mdctSize / 2; k++)
+			sample -= input[k] * std::cos(2.0 * M_PI / mdctSize * (i + 0.5 + mdctSize / 4.0) * (k + 0.5));
+
+		reference[i] = sample;
+	}
+
+	std::vector<float> output(mdctSize);
+
+	MDCT mdct(bits + 2, true, 1.0, instructionSet);
+	mdct.calcIMDCT(&output[0], input);
+
+	mdctError = getMaxError(&output[0], &reference[0], mdctSize);
+}
+
+static double getTime(uint64 start) {
+	return ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+}
+
+/** Measure FFTs for two channels, one channel at a time and both at once. */
+static void measureFFT(FFT &fft, int bits, uint32 runs, double &singleTime, double &batchTime) {
+	const int n = 1 << bits;
+
+	std::vector<Complex> z(2 * n);
+	for (int i = 0; i < 2 * n; i++) {
+		z[i].re = std::rand() / (float) RAND_MAX - 0.5f;
+		z[i].im = std::rand() / (float) RAND_MAX - 0.5f;
+	}
+
+	Complex *channels[2] = { &z[0], &z[n] };
+
+	uint64 start = SDL_GetPerformanceCounter();
+
+	for (uint32 i = 0; i < runs; i++) {
+		fft.calc(channels[0]);
+		fft.calc(channels[1]);
+	}
+
+	singleTime = getTime(start);
+
+	start = SDL_GetPerformanceCounter();
+
+	for (uint32 i = 0; i < runs; i++)
+		fft.calc(channels, 2);
+
+	batchTime = getTime(start);
+}
+
+void benchmarkFFT(int bits, std::vector<FFTBenchmarkResults> &results) {
+	const int n = 1 << bits;
+
+	// Transform about 2^24 numbers with each method
+	const uint32 runs = MAX<uint32>((1 << 23) / n, 1);
+
+	std::vector<float> input(2 * n);
+	for (int i = 0; i < 2 * n; i++)
+		input[i] = std::rand() / (float) RAND_MAX - 0.5f;
+
+	static const FFT::InstructionSet kInstructionSets[] = {
+		FFT::kInstructionSetScalar, FFT::kInstructionSetSSE, FFT::kInstructionSetAVX
+	};
+
+	results.resize(ARRAYSIZE(kInstructionSets));
+
+	for (uint32 i = 0; i < ARRAYSIZE(kInstructionSets); i++) {
+		FFTBenchmarkResults &result = results[i];
+
+		result.instructionSet = kInstructionSets[i];
+
+		result.checked    = false;
+		result.fftError   = 0.0;
+		result.mdctError  = 0.0;
+		result.transforms = 0;
+		result.singleTime = 0.0;
+		result.batchTime  = 0.0;
+
+		FFT fft(bits, false, kInstructionSets[i]);
+
+		result.supported = fft.getInstructionSet() == kInstructionSets[i];
+		if (!result.supported)
+			continue;
+
+		// The naive reference transforms are quadratic
+		if (bits <= 11) {
+			checkFFT(kInstructionSets[i], bits, &input[0], result.fftError, result.mdctError);
+			result.checked = true;
+		}
+
+		measureFFT(fft, bits, runs, result.singleTime, result.batchTime);
+		result.transforms = 2 * runs;
+	}
+}
+
+} // End of namespace Common
@@ -0,0 +1,58 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file common/fftbench.h
+ *  Checking and measuring the FFT and MDCT.
+ */
+
+#ifndef COMMON_FFTBENCH_H
+#define COMMON_FFTBENCH_H
+
+#include <vector>
+
+#include "common/types.h"
+#include "common/fft.h"
+
+namespace Common {
+
+/** Results of checking and measuring the FFT of one instruction set. All times are in seconds. */
+struct FFTBenchmarkResults {
+	FFT::InstructionSet instructionSet;
+
+	bool supported; ///< Does the CPU support the instruction set at all?
+	bool checked;   ///< Were the transforms compared against the naive ones?
+
+	double fftError;  ///< Largest difference of an FFT against the naive FFT.
+	double mdctError; ///< Largest difference of an inverse MDCT against the naive one.
+
+	uint32 transforms; ///< Number of FFTs measured with each method.
+
+	double singleTime; ///< Time transforming two channels, one at a time.
+	double batchTime;  ///< Time transforming two channels at once.
+};
+
+/** Compare FFTs and inverse MDCTs of that many bits of every instruction set against
+ *  the naive transforms, if that doesn't take forever, and measure their FFTs.
+ */
+void benchmarkFFT(int bits, std::vector<FFTBenchmarkResults> &results);
+
+} // End of namespace Common
+
+#endif // COMMON_FFTBENCH_H
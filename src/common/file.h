@@ -122,6 +122,9 @@ public:
 
 	uint32 write(const void *dataPtr, uint32 dataSize); // implement abstract WriteStream method
 
+	/** Move the write position to that offset from the start of the file. */
+	bool seek(uint32 offset);
+
 protected:
 	std::FILE *_handle; ///< The actual file handle.
 	int32 _size;        ///< The file's size.
@@ -89,6 +89,12 @@ UString FilePath::getExtension(const UString &p) {
 	return file.extension();
 }
 
+UString FilePath::getDirectory(const UString &p) {
+	path file(p.c_str());
+
+	return file.parent_path().string();
+}
+
 UString FilePath::changeExtension(const UString &p, const UString &ext) {
 	path file(p.c_str());
 
@@ -269,6 +275,36 @@ static UString findSubDirectory_internal(const UString &directory, const UString
 	return "";
 }
 
+bool FilePath::createDirectories(const UString &p) {
+	try {
+		boost::filesystem::create_directories(p.c_str());
+	} catch (...) {
+		return false;
+	}
+
+	return isDirectory(p);
+}
+
+bool FilePath::rename(const UString &oldPath, const UString &newPath) {
+	try {
+		boost::filesystem::rename(oldPath.c_str(), newPath.c_str());
+	} catch (...) {
+		return false;
+	}
+
+	return true;
+}
+
+bool FilePath::remove(const UString &p) {
+	try {
+		boost::filesystem::remove(p.c_str());
+	} catch (...) {
+		return false;
+	}
+
+	return !exists(p.c_str());
+}
+
 UString FilePath::findSubDirectory(const UString &directory, const UString &subDirectory,
 		bool caseInsensitive) {
 
@@ -85,6 +85,15 @@ public:
 	 */
 	static UString getExtension(const UString &p);
 
+	/** Return a path's directory.
+	 *
+	 *  Example: "/path/to/file.ext" -> "/path/to"
+	 *
+	 *  @param  p The path to manipulate.
+	 *  @return The path's directory.
+	 */
+	static UString getDirectory(const UString &p);
+
 	/** Change a file name's extension.
 	 *
 	 *  Example: "/path/to/file.ext", ".bar" -> "/path/to/file.bar"
@@ -151,6 +160,28 @@ public:
 	 */
 	static UString makeRelative(const UString &basePath, const UString &path);
 
+	/** Create a directory, including all its missing parent directories.
+	 *
+	 *  @param  p The directory to create.
+	 *  @return true if the directory exists now.
+	 */
+	static bool createDirectories(const UString &p);
+
+	/** Rename a file, replacing the file at the new path if it exists.
+	 *
+	 *  @param  oldPath The file to rename.
+	 *  @param  newPath The new path of the file.
+	 *  @return true if the file was renamed.
+	 */
+	static bool rename(const UString &oldPath, const UString &newPath);
+
+	/** Remove a file.
+	 *
+	 *  @param  p The file to remove.
+	 *  @return true if the file doesn't exist anymore.
+	 */
+	static bool remove(const UString &p);
+
 	/** Find a directory's subdirectory.
 	 *
 	 *  @param  directory The directory in which to look.
@@ -23,6 +23,7 @@
  */
 
 #include <cassert>
+#include <map>
 
 #include "common/huffman.h"
 #include "common/util.h"
@@ -31,7 +32,22 @@
 
 namespace Common {
 
-Huffman::Symbol::Symbol(uint32 c, uint32 s) : code(c), symbol(s) {
+/** Mask of the lowest n bits. */
+static inline uint32 lowBits(uint8 n) {
+	return (n >= 32) ? 0xFFFFFFFF : ((1U << n) - 1);
+}
+
+/** Reverse the order of the lowest n bits. */
+static inline uint32 reverseBits(uint32 x, uint8 n) {
+	uint32 r = 0;
+	for (uint8 i = 0; i < n; i++, x >>= 1)
+		r = (r << 1) | (x & 1);
+
+	return r;
+}
+
+
+Huffman::Entry::Entry() : value(0), length(0) {
 }
 
 
@@ -53,47 +69,101 @@ void Huffman::init(uint8 maxLength, uint32 codeCount, const uint32 *codes,
 	assert(codes);
 	assert(lengths);
 
-	if (maxLength == 0)
-		for (uint32 i = 0; i < codeCount; i++)
-			maxLength = MAX(maxLength, lengths[i]);
+	for (uint32 i = 0; i < codeCount; i++)
+		maxLength = MAX(maxLength, lengths[i]);
 
 	assert(maxLength <= 32);
 
-	_codes.resize(maxLength);
 	_symbols.resize(codeCount);
+	setSymbols(symbols);
+
+	_rootBits = (maxLength < kRootBits) ? maxLength : kRootBits;
 
-	for (uint32 i = 0; i < codeCount; i++) {
-		// The symbol. If none were specified, just assume it's identical to the code index
-		uint32 symbol = symbols ? symbols[i] : i;
+	for (int order = 0; order < 2; order++) {
+		const bool isMSB2LSB = order == 0;
 
-		// Put the code and symbol into the correct list
-		_codes[lengths[i] - 1].push_back(Symbol(codes[i], symbol));
+		CodeList codeList;
+		codeList.reserve(codeCount);
 
-		// And put the pointer to the symbol/code struct into the symbol list.
-		_symbols[i] = &_codes[lengths[i] - 1].back();
+		for (uint32 i = 0; i < codeCount; i++) {
+			if (lengths[i] == 0)
+				continue;
+
+			// A bit stream handing out its bits LSB first reads a code from its lowest bit up
+			Code code;
+			code.bits   = isMSB2LSB ? (codes[i] & lowBits(lengths[i])) : reverseBits(codes[i], lengths[i]);
+			code.length = lengths[i];
+			code.index  = i;
+
+			codeList.push_back(code);
+		}
+
+		_tables[order].resize(1 << _rootBits);
+		buildTable(_tables[order], 0, _rootBits, 0, codeList, isMSB2LSB);
 	}
 }
 
 Huffman::~Huffman() {
 }
 
-void Huffman::setSymbols(const uint32 *symbols) {
-	for (uint32 i = 0; i < _symbols.size(); i++)
-		_symbols[i]->symbol = symbols ? *symbols++ : i;
-}
+void Huffman::buildTable(Table &table, uint32 offset, uint8 tableBits, uint8 depth,
+                         CodeList &codes, bool isMSB2LSB) {
 
-uint32 Huffman::getSymbol(BitStream &bits) const {
-	uint32 code = 0;
+	/* The index into a table is the next tableBits bits of the stream,
+	 * as peekBits() returns them. For a bit stream handing out its bits
+	 * LSB first, the first bit read is the lowest bit of the index. */
 
-	for (uint32 i = 0; i < _codes.size(); i++) {
-		bits.addBit(code, i);
+	// Codes longer than this table go into subtables, by their next tableBits bits
+	std::map<uint32, CodeList> subCodes;
+	for (CodeList::const_iterator c = codes.begin(); c != codes.end(); ++c) {
+		const uint8 remaining = c->length - depth;
+		if (remaining > tableBits)
+			subCodes[(c->bits >> (remaining - tableBits)) & lowBits(tableBits)].push_back(*c);
+	}
+
+	for (std::map<uint32, CodeList>::iterator s = subCodes.begin(); s != subCodes.end(); ++s) {
+		uint8 maxRemaining = 0;
+		for (CodeList::const_iterator c = s->second.begin(); c != s->second.end(); ++c)
+			maxRemaining = MAX<uint8>(maxRemaining, c->length - depth - tableBits);
+
+		const uint8  subBits   = (maxRemaining < kRootBits) ? maxRemaining : kRootBits;
+		const uint32 subOffset = table.size();
+
+		table.resize(subOffset + (1 << subBits));
 
-		for (CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
-			if (code == cCode->code)
-				return cCode->symbol;
+		Entry &entry = table[offset + (isMSB2LSB ? s->first : reverseBits(s->first, tableBits))];
+		entry.value  = subOffset;
+		entry.length = -((int8) subBits);
+
+		buildTable(table, subOffset, subBits, depth + tableBits, s->second, isMSB2LSB);
 	}
 
-	throw Exception("Unknown Huffman code");
+	/* Now fill in the codes ending in this table. Like the old linear search did,
+	 * when codes collide, the shorter one wins, then the one given first. */
+	for (uint8 length = tableBits; length > 0; length--) {
+		for (CodeList::const_reverse_iterator c = codes.rbegin(); c != codes.rend(); ++c) {
+			if ((c->length - depth) != length)
+				continue;
+
+			// All indices starting with this code decode to it
+			const uint32 base = (c->bits & lowBits(length)) << (tableBits - length);
+			for (uint32 i = 0; i < (1U << (tableBits - length)); i++) {
+				Entry &entry = table[offset + (isMSB2LSB ? (base | i) : reverseBits(base | i, tableBits))];
+
+				entry.value  = c->index;
+				entry.length = length;
+			}
+		}
+	}
+}
+
+void Huffman::setSymbols(const uint32 *symbols) {
+	for (uint32 i = 0; i < _symbols.size(); i++)
+		_symbols[i] = symbols ? *symbols++ : i;
+}
+
+uint32 Huffman::getSymbol(BitStream &bits) const {
+	return getSymbol<BitStream>(bits);
 }
 
 } // End of namespace Common
@@ -26,9 +26,9 @@
 #define COMMON_HUFFMAN_H
 
 #include <vector>
-#include <list>
 
 #include "common/types.h"
+#include "common/error.h"
 
 namespace Common {
 
@@ -65,26 +65,81 @@ public:
 	/** Return the next symbol in the bitstream. */
 	uint32 getSymbol(BitStream &bits) const;
 
+	/** Return the next symbol in a bit stream of this type.
+	 *
+	 *  Any type with peekBits(), skip() and isMSBFirst() works. With a
+	 *  MemoryBitStreamImpl, the stream's methods can be inlined here.
+	 */
+	template<class BitStreamType>
+	uint32 getSymbol(BitStreamType &bits) const {
+		const Table &table = _tables[bits.isMSBFirst() ? 0 : 1];
+
+		uint32 offset    = 0;
+		uint8  tableBits = _rootBits;
+
+		while (true) {
+			const Entry &entry = table[offset + bits.peekBits(tableBits)];
+
+			if (entry.length > 0) {
+				bits.skip(entry.length);
+				return _symbols[entry.value];
+			}
+
+			if (entry.length == 0)
+				break;
+
+			bits.skip(tableBits);
+
+			offset    = entry.value;
+			tableBits = -entry.length;
+		}
+
+		throw Exception("Unknown Huffman code");
+	}
+
 private:
-	struct Symbol {
-		uint32 code;
-		uint32 symbol;
+	/** Number of bits looked up at once in the first level table. */
+	static const uint8 kRootBits = 9;
+
+	/** An entry in a lookup table.
+	 *
+	 *  If length is positive, the entry is a code of that many bits
+	 *  (within this table level), and value is the index of the code.
+	 *  If length is negative, the entry points to a subtable of -length
+	 *  bits, starting at value. If length is 0, it's not a valid code.
+	 */
+	struct Entry {
+		uint32 value;
+		int8   length;
+
+		Entry();
+	};
 
-		Symbol(uint32 c, uint32 s);
+	/** A code, as used while building the lookup tables. */
+	struct Code {
+		uint32 bits;   ///< The code's bits, in the order they're read, first bit as MSB.
+		uint8  length; ///< The length of the code.
+		uint32 index;  ///< The index of the code.
 	};
 
-	typedef std::list<Symbol>     CodeList;
-	typedef std::vector<CodeList> CodeLists;
-	typedef std::vector<Symbol *> SymbolList;
+	typedef std::vector<Entry>  Table;
+	typedef std::vector<Code>   CodeList;
+	typedef std::vector<uint32> SymbolList;
 
-	/** Lists of codes and their symbols, sorted by code length. */
-	CodeLists _codes;
+	/** Lookup tables, for bit streams handing out their bits MSB first and LSB first. */
+	Table _tables[2];
+	/** Number of bits looked up in the first level of the tables. */
+	uint8 _rootBits;
 
-	/** Sorted list of pointers to the symbols. */
+	/** The symbols of the codes, by code index. */
 	SymbolList _symbols;
 
 	void init(uint8 maxLength, uint32 codeCount, const uint32 *codes,
 	          const uint8 *lengths, const uint32 *symbols);
+
+	/** Build one level of a lookup table out of codes sharing the first depth bits. */
+	static void buildTable(Table &table, uint32 offset, uint8 tableBits, uint8 depth,
+	                       CodeList &codes, bool isMSB2LSB);
 };
 
 } // End of namespace Common
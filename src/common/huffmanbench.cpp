@@ -0,0 +1,152 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file common/huffmanbench.cpp
+ *  Checking and measuring the Huffman decoder.
+ */
+
+#include <cstdlib>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+#include "common/error.h"
+#include "common/stream.h"
+#include "common/bitstream.h"
+#include "common/huffman.h"
+#include "common/huffmanbench.h"
+
+namespace Common {
+
+/** Codes used by the Huffman benchmark, as count of codes per length.
+ *  Together, they cover every possible bit sequence. */
+static const uint32 kHuffmanBenchCodes[][2] = {
+	{  3,   4 }, {  6,  16 }, {  9,  64 }, { 11, 128 }, { 13, 256 }, { 14, 512 }
+};
+
+typedef std::vector< std::vector< std::pair<uint32, uint32> > > HuffmanCodeLists;
+
+/** Decode a Huffman code one bit at a time, the way Common::Huffman used to. */
+static uint32 getSymbolBitwise(BitStream &bits, const HuffmanCodeLists &codes) {
+	uint32 code = 0;
+
+	for (uint32 i = 0; i < codes.size(); i++) {
+		bits.addBit(code, i);
+
+		for (std::vector< std::pair<uint32, uint32> >::const_iterator c = codes[i].begin(); c != codes[i].end(); ++c)
+			if (code == c->first)
+				return c->second;
+	}
+
+	throw Exception("Unknown Huffman code");
+}
+
+static double getTime(uint64 start) {
+	return ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+}
+
+template<class BitStreamType, class MemoryBitStreamType>
+static void benchmarkBitStream(const byte *data, uint32 size, uint32 count, bool isMSBFirst,
+                               HuffmanBenchmarkResults &results) {
+
+	// Canonical codes, in the order they are read out of the bit stream
+	std::vector<uint32> codes;
+	std::vector<uint8>  lengths;
+
+	HuffmanCodeLists codeLists;
+
+	uint32 code = 0;
+	for (uint32 i = 0; i < ARRAYSIZE(kHuffmanBenchCodes); i++) {
+		const uint8 length = kHuffmanBenchCodes[i][0];
+
+		code <<= length - (lengths.empty() ? 0 : lengths.back());
+		codeLists.resize(length);
+
+		for (uint32 j = 0; j < kHuffmanBenchCodes[i][1]; j++, code++) {
+			// Streams handing out their bits LSB first read the codes from their lowest bit up
+			uint32 c = isMSBFirst ? code : 0;
+			if (!isMSBFirst)
+				for (uint8 k = 0; k < length; k++)
+					c |= ((code >> k) & 1) << (length - 1 - k);
+
+			codeLists[length - 1].push_back(std::make_pair(c, (uint32) codes.size()));
+
+			codes.push_back(c);
+			lengths.push_back(length);
+		}
+	}
+
+	Huffman huffman(0, codes.size(), &codes[0], &lengths[0]);
+
+	std::vector<uint32> symbols(count);
+
+	results.symbols    = count;
+	results.mismatches = 0;
+
+	MemoryReadStream tableStream(data, size);
+	BitStreamType tableBits(tableStream);
+
+	uint64 start = SDL_GetPerformanceCounter();
+
+	for (uint32 i = 0; i < count; i++)
+		symbols[i] = huffman.getSymbol(tableBits);
+
+	results.tableTime = getTime(start);
+
+	MemoryBitStreamType memoryBits(data, size);
+
+	start = SDL_GetPerformanceCounter();
+
+	for (uint32 i = 0; i < count; i++)
+		if (huffman.getSymbol(memoryBits) != symbols[i])
+			results.mismatches++;
+
+	results.memoryTime = getTime(start);
+
+	MemoryReadStream bitwiseStream(data, size);
+	BitStreamType bitwiseBits(bitwiseStream);
+
+	start = SDL_GetPerformanceCounter();
+
+	for (uint32 i = 0; i < count; i++)
+		if (getSymbolBitwise(bitwiseBits, codeLists) != symbols[i])
+			results.mismatches++;
+
+	results.bitwiseTime = getTime(start);
+}
+
+void benchmarkHuffman(uint32 count, std::vector<HuffmanBenchmarkResults> &results) {
+	// No code is longer than 16 bits, and any random data decodes
+	std::vector<byte> data((count + 16) * 2);
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = std::rand();
+
+	results.resize(2);
+
+	results[0].name = "8-bit MSB first (WMA)";
+	benchmarkBitStream<BitStream8MSB, MemoryBitStream8MSB>
+		(&data[0], data.size(), count, true , results[0]);
+
+	results[1].name = "32-bit LE, LSB first (Bink)";
+	benchmarkBitStream<BitStream32LELSB, MemoryBitStream32LELSB>
+		(&data[0], data.size(), count, false, results[1]);
+}
+
+} // End of namespace Common
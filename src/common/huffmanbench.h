@@ -0,0 +1,55 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file common/huffmanbench.h
+ *  Checking and measuring the Huffman decoder.
+ */
+
+#ifndef COMMON_HUFFMANBENCH_H
+#define COMMON_HUFFMANBENCH_H
+
+#include <vector>
+
+#include "common/types.h"
+
+namespace Common {
+
+/** Results of decoding Huffman codes out of one kind of bit stream. All times are in seconds. */
+struct HuffmanBenchmarkResults {
+	const char *name; ///< The kind of bit stream.
+
+	uint32 symbols; ///< Number of symbols decoded with each method.
+
+	double tableTime;   ///< Time decoding with the lookup tables.
+	double memoryTime;  ///< Time decoding with the lookup tables, out of a memory bit stream.
+	double bitwiseTime; ///< Time decoding one bit at a time, the way the decoder used to.
+
+	uint32 mismatches; ///< Number of symbols the other methods decoded differently.
+};
+
+/** Decode that many random symbols out of a bit stream reading 8 bits MSB first,
+ *  like WMA, and out of one reading 32 bits LE LSB first, like Bink, with the
+ *  lookup tables and bit by bit, and compare the results.
+ */
+void benchmarkHuffman(uint32 count, std::vector<HuffmanBenchmarkResults> &results);
+
+} // End of namespace Common
+
+#endif // COMMON_HUFFMANBENCH_H
@@ -32,10 +32,12 @@
 
 namespace Common {
 
-MDCT::MDCT(int bits, bool inverse, double scale) : _bits(bits), _fft(0) {
+MDCT::MDCT(int bits, bool inverse, double scale, FFT::InstructionSet instructionSet) :
+	_bits(bits), _fft(0) {
+
 	_size = 1 << bits;
 
-	_fft = new FFT(_bits - 2, inverse);
+	_fft = new FFT(_bits - 2, inverse, instructionSet);
 
 	const int size2 = _size >> 1;
 	const int size4 = _size >> 2;
@@ -106,27 +108,40 @@ void MDCT::calcMDCT(float *output, const float *input) {
 }
 
 void MDCT::calcIMDCT(float *output, const float *input) {
+	calcIMDCT(&output, &input, 1);
+}
+
+void MDCT::calcIMDCT(float * const *output, const float * const *input, int count) {
 	const int size2 = _size >> 1;
 	const int size4 = _size >> 2;
 
-	calcHalfIMDCT(output + size4, input);
+	_batch.resize(count);
 
-	for (int k = 0; k < size4; k++) {
-		output[        k    ] = -output[size2 - k - 1];
-		output[_size - k - 1] =  output[size2 + k    ];
+	for (int i = 0; i < count; i++) {
+		_batch[i] = (Complex *) (output[i] + size4);
+
+		preRotateIMDCT(_batch[i], input[i]);
 	}
-}
 
-void MDCT::calcHalfIMDCT(float *output, const float *input) {
-	Complex *z = (Complex *) output;
+	_fft->calc(&_batch[0], count);
+
+	for (int i = 0; i < count; i++) {
+		postRotateIMDCT(_batch[i]);
 
+		float *out = output[i];
+		for (int k = 0; k < size4; k++) {
+			out[        k    ] = -out[size2 - k - 1];
+			out[_size - k - 1] =  out[size2 + k    ];
+		}
+	}
+}
+
+void MDCT::preRotateIMDCT(Complex *z, const float *input) const {
 	const int size2 = _size >> 1;
 	const int size4 = _size >> 2;
-	const int size8 = _size >> 3;
 
 	const uint16 *revTab = _fft->getRevTab();
 
-	// Pre rotation
 	const float *in1 = input;
 	const float *in2 = input + size2 - 1;
 	for (int k = 0; k < size4; k++) {
@@ -137,8 +152,10 @@ void MDCT::calcHalfIMDCT(float *output, const float *input) {
 		in1 += 2;
 		in2 -= 2;
 	}
+}
 
-	_fft->calc(z);
+void MDCT::postRotateIMDCT(Complex *z) const {
+	const int size8 = _size >> 3;
 
 	// Post rotation + reordering
 	for (int k = 0; k < size8; k++) {
@@ -28,16 +28,18 @@
 #ifndef COMMON_MDCT_H
 #define COMMON_MDCT_H
 
+#include <vector>
+
 #include "common/types.h"
+#include "common/fft.h"
 
 namespace Common {
 
-class FFT;
-
 /** (Inverse) Modified Discrete Cosine Transforms. */
 class MDCT {
 public:
-	MDCT(int bits, bool inverse, double scale);
+	MDCT(int bits, bool inverse, double scale,
+	     FFT::InstructionSet instructionSet = FFT::kInstructionSetBest);
 	~MDCT();
 
 	/** Compute MDCT of size N = 2^nbits. */
@@ -46,6 +48,9 @@ public:
 	/** Compute inverse MDCT of size N = 2^nbits. */
 	void calcIMDCT(float *output, const float *input);
 
+	/** Compute several inverse MDCTs of size N = 2^nbits at once, like for the channels of a sound. */
+	void calcIMDCT(float * const *output, const float * const *input, int count);
+
 private:
 	int _bits;
 	int _size;
@@ -55,10 +60,14 @@ private:
 
 	FFT *_fft;
 
-	/** Compute the middle half of the inverse MDCT of size N = 2^nbits,
-	 *  thus excluding the parts that can be derived by symmetry.
-	 */
-	void calcHalfIMDCT(float *output, const float *input);
+	std::vector<Complex *> _batch; ///< The FFT data of the transforms computed at once.
+
+	/* The middle half of the inverse MDCT of size N = 2^nbits, excluding the parts
+	 * that can be derived by symmetry, is computed by rotating the input, doing
+	 * an FFT, and rotating and reordering the FFT output. */
+
+	void preRotateIMDCT(Complex *z, const float *input) const;
+	void postRotateIMDCT(Complex *z) const;
 };
 
 } // End of namespace Common
@@ -135,4 +135,8 @@ void Condition::signal() {
 	SDL_CondSignal(_condition);
 }
 
+void Condition::broadcast() {
+	SDL_CondBroadcast(_condition);
+}
+
 } // End of namespace Common
@@ -19,7 +19,7 @@
  */
 
 /** @file common/sinetables.h
- *  Static sine tables.
+ *  Sine tables.
  */
 
 #ifndef COMMON_SINETABLES_H
@@ -27,6 +27,11 @@
 
 namespace Common {
 
+/** Return the sine table for transforms of size 2^bits.
+ *
+ *  The table is generated the first time it's requested, and stays
+ *  valid until the end of the program. Requesting it is thread-safe.
+ */
 const float *getSineTable(int bits);
 
 } // End of namespace Common
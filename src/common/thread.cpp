@@ -44,9 +44,15 @@ bool Thread::createThread() {
 		// Already running, nothing to do
 		return true;
 
+	/* Already mark the thread as running, so that destroying it right
+	 * away waits for it, even if it didn't get to run yet. */
+	_threadRunning = true;
+
 	// Try to create the thread
-	if (!(_thread = SDL_CreateThread(threadHelper, 0, (void *) this)))
+	if (!(_thread = SDL_CreateThread(threadHelper, 0, (void *) this))) {
+		_threadRunning = false;
 		return false;
+	}
 
 	return true;
 }
@@ -22,13 +22,15 @@
  *  Threading system helpers.
  */
 
-#ifndef COMMON_THREADS_H
-#define COMMON_THREADS_H
+#include <vector>
 
 #include <SDL_thread.h>
+#include <SDL_cpuinfo.h>
 
 #include "common/types.h"
+#include "common/util.h"
 #include "common/error.h"
+#include "common/threads.h"
 
 static bool   threadsInited = false;
 static SDL_threadID threadsMainID;
@@ -57,6 +59,77 @@ void enforceMainThread() {
 		throw Exception("Unsafe function called in non-main thread");
 }
 
-} // End of namespace Common
+/** A part of a job running in parallel. */
+struct ParallelPart {
+	const ParallelJob *job;
+
+	uint32 part;
+	uint32 partCount;
+
+	bool failed;
+	Exception exception;
+
+	SDL_Thread *thread;
+};
+
+static void runParallelPart(ParallelPart &part) {
+	try {
+		(*part.job)(part.part, part.partCount);
+	} catch (Exception &e) {
+		part.failed    = true;
+		part.exception = e;
+	} catch (std::exception &e) {
+		part.failed    = true;
+		part.exception = Exception(e);
+	} catch (...) {
+		part.failed    = true;
+		part.exception = Exception("Unknown exception in parallel job");
+	}
+}
+
+static int runParallelThread(void *data) {
+	runParallelPart(*((ParallelPart *) data));
+
+	return 0;
+}
+
+uint32 getParallelPartCount() {
+	return MAX(SDL_GetCPUCount(), 1);
+}
+
+void runParallel(const ParallelJob &job, uint32 partCount) {
+	if (partCount <= 1) {
+		job(0, 1);
+		return;
+	}
+
+	std::vector<ParallelPart> parts(partCount);
+
+	for (uint32 i = 0; i < partCount; i++) {
+		parts[i].job       = &job;
+		parts[i].part      = i;
+		parts[i].partCount = partCount;
+		parts[i].failed    = false;
+		parts[i].thread    = 0;
+	}
+
+	// Start all parts except the first on their own threads
+	for (uint32 i = 1; i < partCount; i++)
+		parts[i].thread = SDL_CreateThread(runParallelThread, "parallel", (void *) &parts[i]);
 
-#endif // COMMON_THREADS_H
+	runParallelPart(parts[0]);
+
+	for (uint32 i = 1; i < partCount; i++) {
+		if (parts[i].thread)
+			SDL_WaitThread(parts[i].thread, 0);
+		else
+			// Couldn't create a thread for this part, so run it here instead
+			runParallelPart(parts[i]);
+	}
+
+	for (uint32 i = 0; i < partCount; i++)
+		if (parts[i].failed)
+			throw parts[i].exception;
+}
+
+} // End of namespace Common
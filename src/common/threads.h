@@ -25,6 +25,10 @@
 #ifndef COMMON_THREADS_H
 #define COMMON_THREADS_H
 
+#include <boost/function.hpp>
+
+#include "common/types.h"
+
 namespace Common {
 
 void initThreads();
@@ -33,6 +37,19 @@ bool initedThreads();
 bool isMainThread();
 void enforceMainThread();
 
+/** One part of a job split to run on several threads. */
+typedef boost::function<void (uint32 part, uint32 partCount)> ParallelJob;
+
+/** Return the number of parts a job should be split into to make use of all CPUs. */
+uint32 getParallelPartCount();
+
+/** Split a job into that many parts, run them in parallel and wait for all of them to finish.
+ *
+ *  The first part runs on the calling thread. If a part throws, one of the
+ *  exceptions is rethrown once all parts are finished.
+ */
+void runParallel(const ParallelJob &job, uint32 partCount);
+
 } // End of namespace Common
 
 #endif // COMMON_THREADS_H
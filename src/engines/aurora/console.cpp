@@ -24,19 +24,32 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
+
+#include <vector>
 
 #include <boost/bind.hpp>
 
 #include "common/util.h"
+#include "common/stream.h"
+#include "common/huffmanbench.h"
+#include "common/fft.h"
+#include "common/fftbench.h"
 #include "common/filepath.h"
 #include "common/readline.h"
 
 #include "aurora/resman.h"
 
 #include "graphics/graphics.h"
+#include "graphics/yuv_to_rgb.h"
+#include "graphics/yuvbench.h"
 #include "graphics/font.h"
 
+#include "graphics/images/s3tcbench.h"
+
 #include "sound/sound.h"
+#include "sound/soundbench.h"
 
 #include "events/events.h"
 
@@ -57,11 +70,14 @@ static const uint32 kCommandHistorySize = 100;
 static const uint32 kConsoleHistory     = 500;
 static const uint32 kConsoleLines       =  25;
 
+/** A console text showing no history line. */
+static const uint64 kNoLine = 0xFFFFFFFFFFFFFFFFULL;
+
 namespace Engines {
 
 ConsoleWindow::ConsoleWindow(const Common::UString &font, uint32 lines, uint32 history,
                              int fontHeight) : _font(FontMan.get(font, fontHeight)),
-	_historySizeMax(history), _historySizeCurrent(0), _historyStart(0),
+	_historySizeMax(history), _historySizeCurrent(0), _historyHead(0), _historyCount(0), _historyStart(0),
 	_cursorPosition(0), _overwrite(false),
 	_cursorBlinkState(false), _lastCursorBlink(0) {
 
@@ -85,9 +101,16 @@ ConsoleWindow::ConsoleWindow(const Common::UString &font, uint32 lines, uint32 h
 	_highlight->setColor(1.0, 1.0, 1.0, 0.0);
 	_highlight->setXOR(true);
 
+	_history.resize(_historySizeMax);
+
 	_lines.reserve(lines - 1);
-	for (uint32 i = 0; i < (lines - 1); i++)
+	for (uint32 i = 0; i < (lines - 1); i++) {
+		// Scrollback lines are rarely shown twice, keep them out of the font's layout cache
 		_lines.push_back(new Graphics::Aurora::Text(_font, ""));
+		_lines.back()->setCacheLayout(false);
+	}
+
+	_lineNumbers.resize(_lines.size(), kNoLine);
 
 	notifyResized(0, 0, GfxMan.getScreenWidth(), GfxMan.getScreenHeight());
 
@@ -242,26 +265,32 @@ void ConsoleWindow::setInput(const Common::UString &input, uint32 cursorPos,
 void ConsoleWindow::clear() {
 	GfxMan.lockFrame();
 
-	_history.clear();
 	_historySizeCurrent = 0;
+	_historyHead        = 0;
 
 	_historyStart = 0;
 
 	updateScrollbarLength();
 	updateScrollbarPosition();
 
-	for (std::vector<Graphics::Aurora::Text *>::iterator l = _lines.begin();
-	     l != _lines.end(); ++l)
-		(*l)->set("");
+	redrawLines();
+
 	GfxMan.unlockFrame();
 }
 
 void ConsoleWindow::print(const Common::UString &line) {
-	std::vector<Common::UString> lines;
+	Graphics::TextLayout layout;
 
-	_font.getFont().split(line, lines, _width - 15.0);
-	for (std::vector<Common::UString>::iterator l = lines.begin(); l != lines.end(); ++l)
+	_font.getFont().layout(line, layout, _width - 15.0, 0.0, false);
+	for (std::vector<Common::UString>::const_iterator l = layout.lines.begin(); l != layout.lines.end(); ++l)
 		printLine(*l);
+
+	if (_redirect.isOpen())
+		return;
+
+	updateScrollbarLength();
+	updateScrollbarPosition();
+	redrawLines();
 }
 
 void ConsoleWindow::printLine(const Common::UString &line) {
@@ -271,14 +300,20 @@ void ConsoleWindow::printLine(const Common::UString &line) {
 		return;
 	}
 
-	_history.push_back(line);
-	if (_historySizeCurrent >= _historySizeMax)
-		_history.pop_front();
-	else
+	if (_historySizeCurrent < _historySizeMax) {
+		_history[(_historyHead + _historySizeCurrent) % _historySizeMax] = line;
 		_historySizeCurrent++;
+	} else {
+		// Full, overwrite the oldest line
+		_history[_historyHead] = line;
+		_historyHead = (_historyHead + 1) % _historySizeMax;
+	}
 
-	updateScrollbarLength();
-	redrawLines();
+	_historyCount++;
+
+	// When scrolled back, keep showing the same lines
+	if (_historyStart > 0)
+		_historyStart = MIN<uint32>(_historyStart + 1, _historySizeCurrent - _lines.size());
 }
 
 bool ConsoleWindow::setRedirect(Common::UString redirect) {
@@ -563,9 +598,8 @@ void ConsoleWindow::notifyResized(int oldWidth, int oldHeight, int newWidth, int
 	_x = -(newWidth  / 2.0);
 	_y =  (newHeight / 2.0) - _height;
 
-	float textY = (newHeight / 2.0) - _lineHeight;
-	for (uint32 i = 0; i < _lines.size(); i++, textY -= _lineHeight)
-		_lines[i]->setPosition(_x, textY, -1001.0);
+	for (uint32 i = 0; i < _lines.size(); i++)
+		_lines[i]->setPosition(_x, getLineY(i), -1001.0);
 
 	_prompt->setPosition(_x                      , _y, -1001.0);
 	_input ->setPosition(_x + _prompt->getWidth(), _y, -1001.0);
@@ -609,14 +643,73 @@ void ConsoleWindow::recalcCursor() {
 	_cursor->setWidth(cursorWidth);
 }
 
+const Common::UString &ConsoleWindow::getHistoryLine(uint32 n) const {
+	assert(n < _historySizeCurrent);
+
+	// Counting from the newest line backwards
+	return _history[(_historyHead + _historySizeCurrent - 1 - n) % _historySizeMax];
+}
+
+float ConsoleWindow::getLineY(uint32 n) const {
+	return _y + _height - (n + 1) * _lineHeight;
+}
+
 void ConsoleWindow::redrawLines() {
 	GfxMan.lockFrame();
 
-	std::list<Common::UString>::reverse_iterator h = _history.rbegin();
-	for (uint32 i = 0; (i < _historyStart) && (h != _history.rend()); i++, ++h);
+	const uint32 count = _lines.size();
+
+	// The history line each text should show now, from top to bottom
+	std::vector<uint64> numbers(count, kNoLine);
+	for (uint32 i = 0; i < count; i++) {
+		const uint32 n = _historyStart + (count - 1 - i);
+
+		if (n < _historySizeCurrent)
+			numbers[i] = _historyCount - 1 - n;
+	}
+
+	/* Texts that already show a wanted line are only moved. Since the shown
+	 * lines are always consecutive, a text's new place is a fixed offset
+	 * from its old place. */
+
+	std::vector<Graphics::Aurora::Text *> lines(count, (Graphics::Aurora::Text *) 0);
+	std::vector<bool> reused(count, false);
+
+	const uint64 bottom = _lineNumbers[count - 1];
+	for (uint32 i = 0; i < count; i++) {
+		if ((numbers[i] == kNoLine) || (bottom == kNoLine) || (numbers[i] > bottom) || ((bottom - numbers[i]) >= count))
+			continue;
+
+		const uint32 j = count - 1 - (bottom - numbers[i]);
+		if (_lineNumbers[j] != numbers[i])
+			continue;
+
+		lines[i]  = _lines[j];
+		reused[j] = true;
+	}
+
+	// The remaining texts are refilled with the lines that scrolled into view
+	uint32 spare = 0;
+	for (uint32 i = 0; i < count; i++) {
+		if (lines[i])
+			continue;
+
+		while (reused[spare])
+			spare++;
+
+		reused[spare] = true;
+		lines[i]     = _lines[spare];
+
+		if ((numbers[i] != kNoLine) || (_lineNumbers[spare] != kNoLine))
+			lines[i]->set((numbers[i] != kNoLine) ? getHistoryLine(_historyStart + (count - 1 - i)) : "");
+	}
+
+	for (uint32 i = 0; i < count; i++)
+		if (lines[i] != _lines[i])
+			lines[i]->setPosition(_x, getLineY(i), -1001.0);
 
-	for (int i = _lines.size() - 1; (i >= 0) && (h != _history.rend()); i--, ++h)
-		_lines[i]->set(*h);
+	_lines.swap(lines);
+	_lineNumbers.swap(numbers);
 
 	GfxMan.unlockFrame();
 }
@@ -681,6 +774,41 @@ Console::Console(const Common::UString &font, int fontHeight) : _neverShown(true
 			"Usage: playsound <sound>\nPlay the specified sound");
 	registerCommand("silence"    , boost::bind(&Console::cmdSilence    , this, _1),
 			"Usage: silence\nStop all playing sounds and music");
+	registerCommand("renderstats", boost::bind(&Console::cmdRenderStats, this, _1),
+			"Usage: renderstats\nPrint statistics about the last rendered frame");
+	registerCommand("recordpath" , boost::bind(&Console::cmdRecordPath , this, _1),
+			"Usage: recordpath\nStart recording the camera path, for use in benchmarks");
+	registerCommand("savepath"   , boost::bind(&Console::cmdSavePath   , this, _1),
+			"Usage: savepath <file>\nStop recording the camera path and save it to file");
+	registerCommand("benchmark"  , boost::bind(&Console::cmdBenchmark  , this, _1),
+			"Usage: benchmark [<frames> <file>]\nRender frames along a recorded camera path, measuring them.\n"
+			"Without arguments, print the results of the last benchmark");
+	registerCommand("texturestats", boost::bind(&Console::cmdTextureStats, this, _1),
+			"Usage: texturestats\nPrint statistics about the textures decoded in the background, the shared PLTs\n"
+			"and the textures in GL memory");
+	registerCommand("consolebench", boost::bind(&Console::cmdConsoleBench, this, _1),
+			"Usage: consolebench [<lines>]\nPrint lines (by default 100000) into the console, measuring the time it takes");
+	registerCommand("soundstress", boost::bind(&Console::cmdSoundStress, this, _1),
+			"Usage: soundstress [<sounds>]\nPlay short positional sounds (by default 5000) all at once,\n"
+			"measuring the time it takes to start them");
+	registerCommand("soundstats" , boost::bind(&Console::cmdSoundStats , this, _1),
+			"Usage: soundstats\nPrint statistics about the sound channels, their buffers or the software mixer, and the sample cache");
+	registerCommand("sounddecode", boost::bind(&Console::cmdSoundDecode, this, _1),
+			"Usage: sounddecode <sound> [<runs>]\nDecode the specified sound (by default 10 times), measuring the time it takes.\n"
+			"Also print a checksum of the decoded samples, to compare decoder changes against");
+	registerCommand("huffmanbench", boost::bind(&Console::cmdHuffmanBench, this, _1),
+			"Usage: huffmanbench [<symbols>]\nDecode random Huffman codes (by default 1000000), measuring the symbols per second\n"
+			"of the lookup tables, on a regular and on a memory bit stream, against decoding bit by bit");
+	registerCommand("fftbench"   , boost::bind(&Console::cmdFFTBench    , this, _1),
+			"Usage: fftbench [<bits>]\nCompare the FFT and inverse MDCT kernels of each instruction set against\n"
+			"reference transforms, then measure their throughput, for transforms of 2^bits (by default 9)\n"
+			"complex numbers, one channel at a time and for two channels at once");
+	registerCommand("s3tcbench"  , boost::bind(&Console::cmdS3TCBench   , this, _1),
+			"Usage: s3tcbench [<size>]\nDecompress random DXT1, DXT3 and DXT5 images of size x size pixels (by default\n"
+			"1024), comparing them against a texel by texel reference decoder and measuring the pixels per second");
+	registerCommand("yuvbench"   , boost::bind(&Console::cmdYUVBench    , this, _1),
+			"Usage: yuvbench [<frames>]\nConvert random YUV420 frames of 640x480 and 1280x720 pixels with each instruction set,\n"
+			"comparing them against the lookup tables, then measure the frames per second (by default over 200 frames)");
 
 	_console->setPrompt(kPrompt);
 
@@ -1035,6 +1163,7 @@ void Console::updateSounds() {
 	}
 
 	setArguments("playsound", _sounds);
+	setArguments("sounddecode", _sounds);
 }
 
 void Console::cmdHelp(const CommandLine &cli) {
@@ -1152,6 +1281,333 @@ void Console::cmdSilence(const CommandLine &cl) {
 	SoundMan.stopAll();
 }
 
+void Console::cmdRenderStats(const CommandLine &cl) {
+	const Graphics::RenderStatistics &stats = GfxMan.getRenderStatistics();
+
+	printf("Draw calls: %u, triangles: %u", stats.drawCalls, stats.triangles);
+	printf("Texture changes: %u, vertex state changes: %u", stats.textureChanges, stats.stateChanges);
+	printf("Geometry bytes uploaded: %u", stats.uploadBytes);
+}
+
+void Console::cmdRecordPath(const CommandLine &cl) {
+	GfxMan.startCameraRecording();
+
+	printf("Recording the camera path");
+}
+
+void Console::cmdSavePath(const CommandLine &cl) {
+	if (cl.args.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	Graphics::CameraPath path;
+	GfxMan.stopCameraRecording(path);
+
+	if (path.save(cl.args))
+		printf("Saved camera path of %u frames to file \"%s\"", path.size(), cl.args.c_str());
+	else
+		printf("Failed saving camera path to file \"%s\"", cl.args.c_str());
+}
+
+void Console::cmdBenchmark(const CommandLine &cl) {
+	if (cl.args.empty()) {
+		if (GfxMan.isBenchmarkRunning()) {
+			printf("Benchmark still running");
+			return;
+		}
+
+		Graphics::BenchmarkResults results;
+		if (!GfxMan.getBenchmarkResults(results)) {
+			printf("No benchmark results");
+			return;
+		}
+
+		printf("Frames: %u", results.frames);
+		printf("Frame times: mean %.3fms, 50%% %.3fms, 90%% %.3fms, 99%% %.3fms, max %.3fms",
+		       results.frameTimeMean, results.frameTime50, results.frameTime90,
+		       results.frameTime99, results.frameTimeMax);
+		printf("Per frame: %.1f draw calls, %.1f triangles", results.drawCalls, results.triangles);
+		return;
+	}
+
+	unsigned int frames = 0;
+	const char *fileName = strchr(cl.args.c_str(), ' ');
+
+	if (!fileName || (std::sscanf(cl.args.c_str(), "%u", &frames) != 1) || (frames == 0)) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	Graphics::CameraPath path;
+	if (!path.load(fileName + 1)) {
+		printf("Failed loading camera path \"%s\"", fileName + 1);
+		return;
+	}
+
+	GfxMan.startBenchmark(path, frames);
+
+	printf("Benchmarking %u frames along a camera path of %u frames", frames, path.size());
+}
+
+void Console::cmdTextureStats(const CommandLine &cl) {
+	const Graphics::Aurora::TextureStreamStatistics stats = TextureMan.getStreamStatistics();
+
+	const uint32 finished = stats.decoded + stats.failed;
+
+	printf("Requested: %u, decoded: %u, decoded directly: %u, failed: %u",
+	       stats.requested, stats.decoded, stats.inlined, stats.failed);
+	printf("In flight: %u (%u bytes), peak: %u bytes",
+	       stats.inFlight, stats.inFlightBytes, stats.peakBytes);
+	printf("Latency: mean %ums, max %ums",
+	       (finished > 0) ? (stats.latencyTotal / finished) : 0, stats.latencyMax);
+
+	const Graphics::Aurora::PLTStatistics plts = TextureMan.getPLTStatistics();
+
+	printf("PLTs built: %u, composited: %u, shared: %u (%.1f%%)", plts.builds, plts.composited, plts.shared,
+	       (plts.builds > 0) ? ((plts.shared * 100.0) / plts.builds) : 0.0);
+
+	const Graphics::Aurora::TextureMemoryStatistics memory = TextureMan.getMemoryStatistics();
+
+	printf("Resident: %u textures (%.1fMB), budget: %.1fMB, evicted: %u, restored: %u",
+	       memory.residentCount, memory.residentBytes / (1024.0 * 1024.0),
+	       memory.budget / (1024.0 * 1024.0), memory.evicted, memory.restored);
+}
+
+void Console::cmdConsoleBench(const CommandLine &cl) {
+	unsigned int count = 100000;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%u", &count) != 1) || (count == 0))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	const uint32 start = EventMan.getTimestamp();
+
+	for (uint32 i = 0; i < count; i++)
+		printf("Console benchmark line %u of %u: The quick brown fox jumps over the lazy dog", i + 1, count);
+
+	const uint32 time = EventMan.getTimestamp() - start;
+
+	printf("Printed %u lines in %ums (%.1f lines per second)", count, time,
+	       (time > 0) ? ((count * 1000.0) / time) : 0.0);
+}
+
+void Console::cmdSoundStress(const CommandLine &cl) {
+	unsigned int count = 5000;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%u", &count) != 1) || (count == 0))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	const uint32 start = EventMan.getTimestamp();
+
+	uint32 started = 0;
+	try {
+		Sound::stressChannels(count, started);
+	} catch (Common::Exception &e) {
+		printException(e);
+	}
+
+	const uint32 time = EventMan.getTimestamp() - start;
+
+	printf("Started %u sounds in %ums, %u channels active", started, time, SoundMan.getActiveChannelCount());
+}
+
+void Console::cmdSoundStats(const CommandLine &cl) {
+	const Sound::SoundStatistics stats = SoundMan.getStatistics();
+
+	const Sound::SampleCacheStatistics cache = SoundMan.getSampleCacheStatistics();
+
+	printf("Active channels: %u", SoundMan.getActiveChannelCount());
+
+	const uint32 lookups = cache.hits + cache.misses;
+
+	printf("Sample cache: %u sounds, %uKB of %uKB", cache.sounds, cache.size / 1024, cache.maxSize / 1024);
+	printf("Sample cache: %u hits, %u misses (%.1f%% hit rate), %u evicted, %u too large",
+	       cache.hits, cache.misses, (lookups > 0) ? ((100.0 * cache.hits) / lookups) : 0.0,
+	       cache.evictions, cache.tooLarge);
+
+	const double sleep = (stats.wakeups > 0) ? (((double) stats.sleepTotal) / stats.wakeups) : 0.0;
+
+	const uint32 deadlines = stats.wakeups - stats.signalled;
+	const double late      = (deadlines > 0) ? (((double) stats.lateTotal) / deadlines) : 0.0;
+
+	printf("Sound thread: %u wakeups (%u triggered), %.1fms average sleep",
+	       stats.wakeups, stats.signalled, sleep);
+	printf("Sound thread: %.1fms average, %ums maximum oversleep", late, stats.lateMax);
+	printf("Sound thread: %.3fs updating, %.3fs decoding on %u extra threads",
+	       stats.updateTime, stats.decodeTime, stats.decodeThreads);
+
+	if (!stats.mixer) {
+		printf("Buffers: %u per channel, %ums each", stats.bufferCount, stats.bufferTime);
+		printf("Buffers filled: %u, underruns: %u", stats.refills, stats.underruns);
+		return;
+	}
+
+	const double mixed = ((double) stats.mixedFrames) / stats.mixRate;
+
+	printf("Software mixer at %uHz: %.3fs mixed in %.3fs (%.1fx real time)", stats.mixRate,
+	       mixed, stats.mixTime, (stats.mixTime > 0.0) ? (mixed / stats.mixTime) : 0.0);
+	printf("Software mixer: %u underruns", stats.underruns);
+}
+
+void Console::cmdSoundDecode(const CommandLine &cl) {
+	Common::UString sound = cl.args;
+	unsigned int runs = 10;
+
+	const char *runsArg = strchr(cl.args.c_str(), ' ');
+	if (runsArg) {
+		if ((std::sscanf(runsArg + 1, "%u", &runs) != 1) || (runs == 0)) {
+			printCommandHelp(cl.cmd);
+			return;
+		}
+
+		sound.truncate(sound.findFirst(' '));
+	}
+
+	if (sound.empty()) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	Common::SeekableReadStream *file = ResMan.getResource(Aurora::kResourceSound, sound);
+	if (!file)
+		file = ResMan.getResource(Aurora::kResourceMusic, sound);
+
+	if (!file) {
+		printf("No such sound \"%s\"", sound.c_str());
+		return;
+	}
+
+	Sound::DecodeBenchmarkResults results;
+
+	try {
+		Sound::benchmarkDecode(*file, runs, results);
+	} catch (Common::Exception &e) {
+		delete file;
+
+		printException(e);
+		return;
+	}
+
+	delete file;
+
+	const uint32 channels = results.channels;
+
+	const double length = ((results.rate > 0) && (channels > 0)) ?
+		(((double) results.samples) / (results.rate * channels)) : 0.0;
+	const double mean   = (results.time * 1000.0) / runs;
+
+	printf("Decoded %u samples (%.2fs, %uHz, %u channels) %u times",
+	       results.samples, length, results.rate, channels, runs);
+	printf("Decode time: mean %.2fms (%.1fx realtime), checksum: %08X",
+	       mean, (mean > 0.0) ? ((length * 1000.0) / mean) : 0.0, results.checksum);
+}
+
+void Console::cmdHuffmanBench(const CommandLine &cl) {
+	unsigned int count = 1000000;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%u", &count) != 1) || (count == 0))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	std::vector<Common::HuffmanBenchmarkResults> results;
+
+	try {
+		Common::benchmarkHuffman(count, results);
+	} catch (Common::Exception &e) {
+		printException(e);
+		return;
+	}
+
+	for (std::vector<Common::HuffmanBenchmarkResults>::const_iterator r = results.begin(); r != results.end(); ++r)
+		printf("%s: tables %.2fM symbols/s, tables on a memory bit stream %.2fM symbols/s, "
+		       "bit by bit %.2fM symbols/s, %u mismatches", r->name,
+		       (r->tableTime   > 0.0) ? (r->symbols / (r->tableTime   * 1000000.0)) : 0.0,
+		       (r->memoryTime  > 0.0) ? (r->symbols / (r->memoryTime  * 1000000.0)) : 0.0,
+		       (r->bitwiseTime > 0.0) ? (r->symbols / (r->bitwiseTime * 1000000.0)) : 0.0, r->mismatches);
+}
+
+void Console::cmdFFTBench(const CommandLine &cl) {
+	int bits = 9;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%d", &bits) != 1) || (bits < 2) || (bits > 14))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	std::vector<Common::FFTBenchmarkResults> results;
+	Common::benchmarkFFT(bits, results);
+
+	for (std::vector<Common::FFTBenchmarkResults>::const_iterator r = results.begin(); r != results.end(); ++r) {
+		const char *name = Common::FFT::getInstructionSetName(r->instructionSet);
+
+		if (!r->supported) {
+			printf("%s: Not supported", name);
+			continue;
+		}
+
+		if (r->checked)
+			printf("%s: max. error FFT %.2e, inverse MDCT %.2e", name, r->fftError, r->mdctError);
+
+		printf("%s: one channel at a time %.0f FFTs/s, two channels at once %.0f FFTs/s", name,
+		       (r->singleTime > 0.0) ? (r->transforms / r->singleTime) : 0.0,
+		       (r->batchTime  > 0.0) ? (r->transforms / r->batchTime ) : 0.0);
+	}
+}
+
+void Console::cmdS3TCBench(const CommandLine &cl) {
+	unsigned int imageSize = 1024;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%u", &imageSize) != 1) ||
+	    (imageSize == 0) || (imageSize > 4096))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	std::vector<Graphics::S3TCBenchmarkResults> results;
+
+	try {
+		Graphics::benchmarkS3TC(imageSize, results);
+	} catch (Common::Exception &e) {
+		printException(e);
+		return;
+	}
+
+	for (std::vector<Graphics::S3TCBenchmarkResults>::const_iterator r = results.begin(); r != results.end(); ++r)
+		printf("DXT%d: decoder %.2fM pixels/s, texel by texel %.2fM pixels/s, %u mismatches", r->dxt,
+		       (r->decoderTime   > 0.0) ? (r->pixels          / (r->decoderTime   * 1000000.0)) : 0.0,
+		       (r->referenceTime > 0.0) ? (r->referencePixels / (r->referenceTime * 1000000.0)) : 0.0,
+		       r->mismatches);
+}
+
+void Console::cmdYUVBench(const CommandLine &cl) {
+	unsigned int frames = 200;
+
+	if (!cl.args.empty() && ((std::sscanf(cl.args.c_str(), "%u", &frames) != 1) || (frames == 0))) {
+		printCommandHelp(cl.cmd);
+		return;
+	}
+
+	std::vector<Graphics::YUVBenchmarkResults> results;
+	Graphics::benchmarkYUV(frames, results);
+
+	for (std::vector<Graphics::YUVBenchmarkResults>::const_iterator r = results.begin(); r != results.end(); ++r) {
+		const char *name = Graphics::YUVToRGBManager::getInstructionSetName(r->instructionSet);
+
+		if (!r->supported) {
+			printf("%dx%d, %s: Not supported", r->width, r->height, name);
+			continue;
+		}
+
+		printf("%dx%d, %s: %.0f frames/s, %u mismatches", r->width, r->height, name,
+		       (r->time > 0.0) ? (r->frames / r->time) : 0.0, r->mismatches);
+	}
+}
+
 void Console::printCommandHelp(const Common::UString &cmd) {
 	CommandMap::const_iterator c = _commands.find(cmd);
 	if (c == _commands.end()) {
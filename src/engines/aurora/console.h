@@ -123,11 +123,14 @@ private:
 
 	uint32 _historySizeMax;
 	uint32 _historySizeCurrent;
-	std::list<Common::UString> _history;
+	std::vector<Common::UString> _history; ///< Ring buffer of the printed lines.
+	uint32 _historyHead;                   ///< The oldest line in the ring buffer.
+	uint64 _historyCount;                  ///< Number of lines ever printed.
 
 	uint32 _historyStart;
 
 	std::vector<Graphics::Aurora::Text *> _lines;
+	std::vector<uint64> _lineNumbers; ///< The number of the history line each text shows.
 	Graphics::Aurora::Text *_input;
 
 
@@ -159,6 +162,9 @@ private:
 	void recalcCursor();
 	void redrawLines();
 
+	const Common::UString &getHistoryLine(uint32 n) const;
+	float getLineY(uint32 n) const;
+
 	void printLine(const Common::UString &line);
 
 	void updateHighlight();
@@ -273,6 +279,19 @@ private:
 	void cmdListSounds (const CommandLine &cl);
 	void cmdPlaySound  (const CommandLine &cl);
 	void cmdSilence    (const CommandLine &cl);
+	void cmdRenderStats(const CommandLine &cl);
+	void cmdRecordPath (const CommandLine &cl);
+	void cmdSavePath   (const CommandLine &cl);
+	void cmdBenchmark  (const CommandLine &cl);
+	void cmdTextureStats(const CommandLine &cl);
+	void cmdConsoleBench(const CommandLine &cl);
+	void cmdSoundStress (const CommandLine &cl);
+	void cmdSoundStats  (const CommandLine &cl);
+	void cmdSoundDecode (const CommandLine &cl);
+	void cmdHuffmanBench(const CommandLine &cl);
+	void cmdFFTBench    (const CommandLine &cl);
+	void cmdS3TCBench   (const CommandLine &cl);
+	void cmdYUVBench    (const CommandLine &cl);
 
 	void updateHelpArguments();
 
@@ -27,6 +27,8 @@
 
 #include "events/events.h"
 
+#include "sound/sound.h"
+
 #include "engines/aurora/resources.h"
 
 namespace Engines {
@@ -40,6 +42,9 @@ void indexMandatoryArchive(Aurora::ArchiveType archive, const Common::UString &f
 	Aurora::ResourceManager::ChangeID c;
 	c = ResMan.addArchive(archive, file, priority);
 
+	// The new archive might override sounds we already decoded
+	SoundMan.clearSampleCache();
+
 	if (change)
 		*change = c;
 }
@@ -54,6 +59,8 @@ bool indexOptionalArchive(Aurora::ArchiveType archive, const Common::UString &fi
 		Aurora::ResourceManager::ChangeID c;
 		c = ResMan.addArchive(archive, file, priority);
 
+		SoundMan.clearSampleCache();
+
 		if (change)
 			*change = c;
 	} catch (Common::Exception &e) {
@@ -73,6 +80,9 @@ void indexMandatoryDirectory(const Common::UString &dir,
 	Aurora::ResourceManager::ChangeID c;
 	c = ResMan.addResourceDir(dir, glob, depth, priority);
 
+	// The new directory might override sounds we already decoded
+	SoundMan.clearSampleCache();
+
 	if (change)
 		*change = c;
 }
@@ -88,6 +98,8 @@ bool indexOptionalDirectory(const Common::UString &dir,
 		Aurora::ResourceManager::ChangeID c;
 		c = ResMan.addResourceDir(dir, glob, depth, priority);
 
+		SoundMan.clearSampleCache();
+
 		if (change)
 			*change = c;
 	} catch (Common::Exception &e) {
@@ -97,5 +109,11 @@ bool indexOptionalDirectory(const Common::UString &dir,
 	return true;
 }
 
+void deindexResources(Aurora::ResourceManager::ChangeID &change) {
+	ResMan.undo(change);
+
+	// The sounds we decoded might have come from the removed resources
+	SoundMan.clearSampleCache();
+}
 
 } // End of namespace Engines
@@ -51,6 +51,9 @@ bool indexOptionalDirectory(const Common::UString &dir,
 		const char *glob = 0, int depth = -1, uint32 priority = 10,
 		Aurora::ResourceManager::ChangeID *change = 0);
 
+/** Remove the resources added with this change from the resource manager. */
+void deindexResources(Aurora::ResourceManager::ChangeID &change);
+
 } // End of namespace Engines
 
 #endif // ENGINES_AURORA_RESOURCES_H
@@ -76,11 +76,18 @@ Sound::ChannelHandle playSound(const Common::UString &sound, Sound::SoundType so
 	Sound::ChannelHandle channel;
 
 	try {
-		Common::SeekableReadStream *soundStream = ResMan.getResource(resType, sound);
-		if (!soundStream)
-			return channel;
+		// Short sounds are kept decoded, so we don't even need to look at the resource again
+		Common::UString cacheName = Common::UString::sprintf("%d:", (int) resType) + sound;
+		cacheName.tolower();
 
-		channel = SoundMan.playSoundFile(soundStream, soundType, loop);
+		channel = SoundMan.playCachedSound(cacheName, soundType, loop);
+		if (!SoundMan.isValidChannel(channel)) {
+			Common::SeekableReadStream *soundStream = ResMan.getResource(resType, sound);
+			if (!soundStream)
+				return channel;
+
+			channel = SoundMan.playSoundFile(cacheName, soundStream, soundType, loop);
+		}
 
 		SoundMan.setChannelGain(channel, volume);
 
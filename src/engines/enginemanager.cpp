@@ -40,6 +40,8 @@
 #include "graphics/aurora/fontman.h"
 #include "graphics/aurora/textureman.h"
 
+#include "sound/sound.h"
+
 #include "events/events.h"
 #include "events/requests.h"
 
@@ -234,6 +236,8 @@ void EngineManager::cleanup(GameInstance &game) const {
 		TwoDAReg.clear();
 		ResMan.clear();
 
+		SoundMan.clearSampleCache();
+
 		ConfigMan.setGame();
 
 	} catch (...) {
@@ -208,7 +208,7 @@ void Module::unload() {
 void Module::unloadResources() {
 	std::list<Aurora::ResourceManager::ChangeID>::reverse_iterator r;
 	for (r = _resources.rbegin(); r != _resources.rend(); ++r)
-		ResMan.undo(*r);
+		deindexResources(*r);
 
 	_resources.clear();
 }
@@ -223,7 +223,7 @@ void Module::unloadArea() {
 }
 
 void Module::unloadTexturePack() {
-	ResMan.undo(_textures);
+	deindexResources(_textures);
 	_currentTexturePack = -1;
 }
 
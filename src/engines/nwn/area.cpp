@@ -24,6 +24,8 @@
 
 #include "common/util.h"
 #include "common/error.h"
+#include "common/debug.h"
+#include "common/configman.h"
 
 #include "aurora/locstring.h"
 #include "aurora/gfffile.h"
@@ -34,6 +36,7 @@
 
 #include "graphics/aurora/cursorman.h"
 #include "graphics/aurora/model.h"
+#include "graphics/aurora/staticbatch.h"
 
 #include "sound/sound.h"
 
@@ -52,6 +55,9 @@ namespace Engines {
 
 namespace NWN {
 
+/** Width and height, in tiles, of the chunks tile geometry is merged in. */
+static const uint32 kTileChunkSize = 4;
+
 Area::Area(Module &module, const Common::UString &resRef) : _module(&module), _loaded(false),
 	_resRef(resRef), _visible(false), _tileset(0),
 	_activeObject(0), _highlightAll(false) {
@@ -212,6 +218,10 @@ void Area::show() {
 	for (std::vector<Tile>::iterator t = _tiles.begin(); t != _tiles.end(); ++t)
 		t->model->show();
 
+	for (std::vector<Graphics::Aurora::StaticBatch *>::iterator b = _tileBatches.begin();
+	     b != _tileBatches.end(); ++b)
+		(*b)->show();
+
 	// Show objects
 	for (ObjectList::iterator o = _objects.begin(); o != _objects.end(); ++o)
 		(*o)->show();
@@ -240,6 +250,10 @@ void Area::hide() {
 		(*o)->hide();
 
 	// Hide tiles
+	for (std::vector<Graphics::Aurora::StaticBatch *>::iterator b = _tileBatches.begin();
+	     b != _tileBatches.end(); ++b)
+		(*b)->hide();
+
 	for (std::vector<Tile>::iterator t = _tiles.begin(); t != _tiles.end(); ++t)
 		t->model->hide();
 
@@ -452,9 +466,55 @@ void Area::loadTiles() {
 			t.model->setRotation(0.0, 0.0, -(((int) t.orientation) * 90.0));
 		}
 	}
+
+	if (ConfigMan.getBool("mergetiles", true))
+		mergeTiles();
+}
+
+void Area::mergeTiles() {
+	/* Most of a tile's geometry never moves. We merge that static geometry
+	 * of neighbouring tiles, so that it can be drawn in only a few calls.
+	 * Animated parts, like water and flames, are still drawn by the tiles. */
+
+	uint32 nodeCount = 0;
+
+	for (uint32 chunkY = 0; chunkY < _height; chunkY += kTileChunkSize) {
+		for (uint32 chunkX = 0; chunkX < _width; chunkX += kTileChunkSize) {
+			Graphics::Aurora::StaticBatch *batch = new Graphics::Aurora::StaticBatch;
+
+			uint32 merged = 0;
+			for (uint32 y = chunkY; y < MIN(chunkY + kTileChunkSize, _height); y++)
+				for (uint32 x = chunkX; x < MIN(chunkX + kTileChunkSize, _width); x++)
+					merged += batch->add(*_tiles[y * _width + x].model);
+
+			if (merged == 0) {
+				delete batch;
+				continue;
+			}
+
+			batch->build();
+
+			_tileBatches.push_back(batch);
+			nodeCount += merged;
+		}
+	}
+
+	uint32 batchCount = 0;
+	for (std::vector<Graphics::Aurora::StaticBatch *>::const_iterator b = _tileBatches.begin();
+	     b != _tileBatches.end(); ++b)
+		batchCount += (*b)->getBatchCount();
+
+	debugC(1, Common::kDebugGraphics, "Merged %u static tile nodes of area \"%s\" into %u batches",
+	       nodeCount, _resRef.c_str(), batchCount);
 }
 
 void Area::unloadTiles() {
+	for (std::vector<Graphics::Aurora::StaticBatch *>::iterator b = _tileBatches.begin();
+	     b != _tileBatches.end(); ++b)
+		delete *b;
+
+	_tileBatches.clear();
+
 	for (uint32 y = 0; y < _height; y++) {
 		for (uint32 x = 0; x < _width; x++) {
 			uint32 n = y * _width + x;
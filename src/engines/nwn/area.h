@@ -184,6 +184,9 @@ private:
 
 	std::vector<Tile> _tiles; ///< The area's tiles.
 
+	/** The static geometry of the tiles, merged in chunks. */
+	std::vector<Graphics::Aurora::StaticBatch *> _tileBatches;
+
 	ObjectList _objects;   ///< List of all objects in the area.
 	ObjectMap  _objectMap; ///< Map of all non-static objects in the area.
 
@@ -227,6 +230,8 @@ private:
 	void loadTiles();
 	void unloadTiles();
 
+	void mergeTiles();
+
 	// Highlight / active helpers
 
 	void checkActive(int x = -1, int y = -1);
@@ -113,6 +113,14 @@ void WidgetListItemCharacter::setTag(const Common::UString &tag) {
 	_button->setTag(tag);
 }
 
+void WidgetListItemCharacter::setCharacter(const Common::UString &name,
+		const Common::UString &classes, const Common::UString &portrait) {
+
+	_textName->set(name);
+	_textClass->set(classes);
+	_portrait->setPortrait(portrait);
+}
+
 bool WidgetListItemCharacter::activate() {
 	if (!WidgetListItem::activate())
 		return false;
@@ -215,9 +223,6 @@ void CharPremadeMenu::initCharacterList() {
 
 	WidgetListBox &charList = *getListBox("ButtonList", true);
 
-	charList.lock();
-
-	charList.clear();
 	charList.setMode(WidgetListBox::kModeSelectable);
 
 	// Get the character display info
@@ -251,18 +256,22 @@ void CharPremadeMenu::initCharacterList() {
 
 	std::sort(_characters.begin(), _characters.end());
 
-	// Create the listbox items
-	charList.reserve(characters.size());
-	for (std::vector<Character>::iterator c = _characters.begin();
-	     c != _characters.end(); ++c)
-		charList.add(new WidgetListItemCharacter(*this, "fnt_galahad14",
-		                                         c->displayName, c->classes, c->portrait, 2.0));
-
-	charList.unlock();
+	// Only create widgets for the visible characters
+	charList.setItems(*this, _characters.size());
 
 	charList.select(0);
 }
 
+WidgetListItem *CharPremadeMenu::createItem() {
+	return new WidgetListItemCharacter(*this, "fnt_galahad14", "", "", "", 2.0);
+}
+
+void CharPremadeMenu::fillItem(WidgetListItem &item, uint n) {
+	const Character &c = _characters[n];
+
+	static_cast<WidgetListItemCharacter &>(item).setCharacter(c.displayName, c.classes, c.portrait);
+}
+
 static const Common::UString kStringEmpty;
 const Common::UString &CharPremadeMenu::getSelectedCharacter() {
 	uint n = getListBox("ButtonList", true)->getSelected();
@@ -57,6 +57,9 @@ public:
 
 	void setTag(const Common::UString &tag);
 
+	void setCharacter(const Common::UString &name, const Common::UString &classes,
+	                  const Common::UString &portrait);
+
 protected:
 	bool activate();
 	bool deactivate();
@@ -72,7 +75,7 @@ private:
 };
 
 /** The NWN character creator. */
-class CharPremadeMenu : public GUI {
+class CharPremadeMenu : public GUI, public WidgetListItemSource {
 public:
 	CharPremadeMenu(Module &module);
 	~CharPremadeMenu();
@@ -84,6 +87,9 @@ protected:
 
 	void callbackActive(Widget &widget);
 
+	WidgetListItem *createItem();
+	void fillItem(WidgetListItem &item, uint n);
+
 private:
 	struct Character {
 		Common::UString file;
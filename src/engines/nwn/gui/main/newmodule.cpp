@@ -51,11 +51,12 @@ WidgetListItemModule::WidgetListItemModule(::Engines::GUI &gui,
 
 	_button->setClickable(true);
 
+	_font = FontMan.get(font);
+
 	Common::UString splitText;
-	Graphics::Aurora::FontHandle f = FontMan.get(font);
-	f.getFont().split(text, splitText, _button->getWidth() - 8.0);
+	_font.getFont().split(text, splitText, _button->getWidth() - 8.0);
 
-	_text = new Graphics::Aurora::Text(f, splitText, 1.0, 1.0, 1.0, 1.0, 0.5);
+	_text = new Graphics::Aurora::Text(_font, splitText, 1.0, 1.0, 1.0, 1.0, 0.5);
 }
 
 WidgetListItemModule::~WidgetListItemModule() {
@@ -99,6 +100,18 @@ void WidgetListItemModule::setTag(const Common::UString &tag) {
 	_button->setTag(tag);
 }
 
+void WidgetListItemModule::setText(const Common::UString &text) {
+	Common::UString splitText;
+	_font.getFont().split(text, splitText, _button->getWidth() - 8.0);
+
+	_text->set(splitText);
+
+	// Recenter the text
+	float x, y, z;
+	getPosition(x, y, z);
+	setPosition(x, y, z);
+}
+
 bool WidgetListItemModule::activate() {
 	if (!WidgetListItem::activate())
 		return false;
@@ -148,16 +161,9 @@ void NewModuleMenu::initModuleList() {
 
 	WidgetListBox &moduleList = *getListBox("ModuleListBox", true);
 
-	moduleList.lock();
-
-	moduleList.clear();
+	// Only create widgets for the visible modules
 	moduleList.setMode(WidgetListBox::kModeSelectable);
-
-	moduleList.reserve(_modules.size());
-	for (std::vector<Common::UString>::iterator m = _modules.begin(); m != _modules.end(); ++m)
-		moduleList.add(new WidgetListItemModule(*this, "fnt_galahad14", *m, 2.0));
-
-	moduleList.unlock();
+	moduleList.setItems(*this, _modules.size());
 
 	moduleList.select(0);
 	selectedModule();
@@ -184,6 +190,14 @@ void NewModuleMenu::callbackActive(Widget &widget) {
 	}
 }
 
+WidgetListItem *NewModuleMenu::createItem() {
+	return new WidgetListItemModule(*this, "fnt_galahad14", "", 2.0);
+}
+
+void NewModuleMenu::fillItem(WidgetListItem &item, uint n) {
+	static_cast<WidgetListItemModule &>(item).setText(_modules[n]);
+}
+
 Common::UString NewModuleMenu::getSelectedModule() {
 	uint n = getListBox("ModuleListBox", true)->getSelected();
 	if (n >= _modules.size())
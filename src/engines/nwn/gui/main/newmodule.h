@@ -28,6 +28,7 @@
 #include "common/ustring.h"
 
 #include "graphics/aurora/types.h"
+#include "graphics/aurora/fontman.h"
 
 #include "engines/nwn/gui/widgets/listbox.h"
 
@@ -55,11 +56,15 @@ public:
 
 	void setTag(const Common::UString &tag);
 
+	void setText(const Common::UString &text);
+
 protected:
 	bool activate();
 	bool deactivate();
 
 private:
+	Graphics::Aurora::FontHandle _font;
+
 	Graphics::Aurora::Model *_button;
 	Graphics::Aurora::Text  *_text;
 
@@ -67,7 +72,7 @@ private:
 };
 
 /** The NWN new module menu. */
-class NewModuleMenu : public GUI {
+class NewModuleMenu : public GUI, public WidgetListItemSource {
 public:
 	NewModuleMenu(Module &module, GUI &charType);
 	~NewModuleMenu();
@@ -79,6 +84,9 @@ protected:
 
 	void callbackActive(Widget &widget);
 
+	WidgetListItem *createItem();
+	void fillItem(WidgetListItem &item, uint n);
+
 private:
 	Module *_module;
 
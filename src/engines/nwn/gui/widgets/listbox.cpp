@@ -216,12 +216,16 @@ bool WidgetListItemTextLine::deactivate() {
 }
 
 
+WidgetListItemSource::~WidgetListItemSource() {
+}
+
+
 WidgetListBox::WidgetListBox(::Engines::GUI &gui, const Common::UString &tag,
                              const Common::UString &model) :
 	ModelWidget(gui, tag, model),
 	_mode(kModeStatic), _contentX(0.0), _contentY(0.0), _contentZ(0.0),
 	_hasScrollbar(false), _up(0), _down(0), _scrollbar(0), _dblClicked(false),
-	_startItem(0), _selectedItem(0xFFFFFFFF), _locked(false) {
+	_source(0), _itemCount(0), _startItem(0), _selectedItem(0xFFFFFFFF), _locked(false) {
 
 	_model->setClickable(true);
 
@@ -378,12 +382,21 @@ void WidgetListBox::clear() {
 
 	for (std::vector<WidgetListItem *>::iterator v = _visibleItems.begin(); v != _visibleItems.end(); ++v)
 		(*v)->hide();
+
+	// A virtual listbox owns only the item widgets of its visible rows
+	if (_source)
+		for (std::vector<WidgetListItem *>::iterator v = _visibleItems.begin(); v != _visibleItems.end(); ++v)
+			(*v)->remove();
+
 	_visibleItems.clear();
 
 	for (std::vector<WidgetListItem *>::iterator i = _items.begin(); i != _items.end(); ++i)
 		(*i)->remove();
 	_items.clear();
 
+	_source    = 0;
+	_itemCount = 0;
+
 	_startItem    = 0;
 	_selectedItem = 0xFFFFFFFF;
 
@@ -456,6 +469,58 @@ void WidgetListBox::unlock() {
 	GfxMan.unlockFrame();
 }
 
+void WidgetListBox::setItems(WidgetListItemSource &source, uint count) {
+	lock();
+	clear();
+
+	_source    = &source;
+	_itemCount = count;
+
+	if (count > 0) {
+		WidgetListItem *item = _source->createItem();
+
+		uint rows = MIN<uint>(_contentHeight / item->getHeight(), count);
+		if (rows == 0)
+			delete item;
+
+		// Create the item widgets for all rows that can be visible at the same time
+		_visibleItems.reserve(rows);
+		for (uint i = 0; i < rows; i++) {
+			if (i > 0)
+				item = _source->createItem();
+
+			item->setTag(Common::UString::sprintf("%s#Item%d", getTag().c_str(), i));
+
+			for (std::vector<WidgetListItem *>::iterator v = _visibleItems.begin(); v != _visibleItems.end(); ++v) {
+				(*v)->addGroupMember(*item);
+				item->addGroupMember(**v);
+			}
+
+			_visibleItems.push_back(item);
+
+			addSub(*item);
+		}
+	}
+
+	fillVisible();
+
+	if (isVisible())
+		for (std::vector<WidgetListItem *>::iterator v = _visibleItems.begin(); v != _visibleItems.end(); ++v)
+			(*v)->show();
+
+	updateScrollbarLength();
+	updateScrollbarPosition();
+
+	unlock();
+}
+
+uint WidgetListBox::getItemCount() const {
+	if (_source)
+		return _itemCount;
+
+	return _items.size();
+}
+
 void WidgetListBox::setText(const Common::UString &font,
                             const Common::UString &text, float spacing) {
 
@@ -479,14 +544,14 @@ void WidgetListBox::updateScrollbarLength() {
 	if (_visibleItems.empty())
 		_scrollbar->setLength(1.0);
 	else
-		_scrollbar->setLength(((float) _visibleItems.size()) / _items.size());
+		_scrollbar->setLength(((float) _visibleItems.size()) / getItemCount());
 }
 
 void WidgetListBox::updateScrollbarPosition() {
 	if (!_scrollbar)
 		return;
 
-	int max = _items.size() - _visibleItems.size();
+	int max = getItemCount() - _visibleItems.size();
 	if (max > 0)
 		_scrollbar->setState(((float) _startItem) / max);
 	else
@@ -497,6 +562,12 @@ void WidgetListBox::updateVisible() {
 	if (_visibleItems.empty())
 		return;
 
+	if (_source) {
+		// Refill the rows instead of switching widgets
+		fillVisible();
+		return;
+	}
+
 	GfxMan.lockFrame();
 
 	for (uint i = 0; i < _visibleItems.size(); i++)
@@ -519,6 +590,41 @@ void WidgetListBox::updateVisible() {
 	GfxMan.unlockFrame();
 }
 
+void WidgetListBox::fillVisible() {
+	if (!_source || _visibleItems.empty())
+		return;
+
+	GfxMan.lockFrame();
+
+	float itemHeight = _visibleItems.front()->getHeight();
+	float itemY      = _contentY;
+	for (uint i = 0; i < _visibleItems.size(); i++) {
+		WidgetListItem &item = *_visibleItems[i];
+
+		item._itemNumber = _startItem + i;
+		_source->fillItem(item, item._itemNumber);
+
+		itemY -= itemHeight;
+
+		// Items might lay out their contents depending on the position
+		item.setPosition(_contentX, itemY, _contentZ - 5.0);
+
+		setItemState(item, item._itemNumber == _selectedItem);
+	}
+
+	GfxMan.unlockFrame();
+}
+
+void WidgetListBox::setItemState(WidgetListItem &item, bool selected) {
+	if (selected) {
+		item.activate();
+
+		// Just show it as selected, this isn't a click
+		item.setActive(false);
+	} else
+		item.deactivate();
+}
+
 void WidgetListBox::itemDblClicked() {
 	_dblClicked = true;
 
@@ -542,19 +648,28 @@ void WidgetListBox::scrollDown(uint n) {
 	if (_visibleItems.empty())
 		return;
 
-	if (_startItem + _visibleItems.size() >= _items.size())
+	if (_startItem + _visibleItems.size() >= getItemCount())
 		return;
 
-	_startItem += MIN<uint>(n, _items.size() - _visibleItems.size() - _startItem);
+	_startItem += MIN<uint>(n, getItemCount() - _visibleItems.size() - _startItem);
 
 	updateVisible();
 	updateScrollbarPosition();
 }
 
 void WidgetListBox::select(uint item) {
-	if (item >= _items.size())
+	if (item >= getItemCount())
 		return;
 
+	if (_source) {
+		_selectedItem = item;
+
+		for (std::vector<WidgetListItem *>::iterator v = _visibleItems.begin(); v != _visibleItems.end(); ++v)
+			setItemState(**v, (*v)->_itemNumber == item);
+
+		return;
+	}
+
 	_items[item]->select();
 	_selectedItem = item;
 }
@@ -583,7 +698,7 @@ void WidgetListBox::subActive(Widget &widget) {
 	}
 
 	if (widget.getTag().endsWith("#Bar")) {
-		int max = _items.size() - _visibleItems.size();
+		int max = getItemCount() - _visibleItems.size();
 		if (max <= 0)
 			return;
 
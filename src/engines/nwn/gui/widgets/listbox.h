@@ -106,6 +106,22 @@ private:
 	float _spacing;
 };
 
+/** The items of a virtual NWN listbox.
+ *
+ *  A virtual listbox only creates item widgets for the rows that are
+ *  visible at the same time. When scrolling, these widgets are refilled
+ *  with the contents of the items that scrolled into view.
+ */
+class WidgetListItemSource {
+public:
+	virtual ~WidgetListItemSource();
+
+	/** Create a new, empty item widget. */
+	virtual WidgetListItem *createItem() = 0;
+	/** Fill an item widget with the contents of this item. */
+	virtual void fillItem(WidgetListItem &item, uint n) = 0;
+};
+
 /** A NWN listbox widget. */
 class WidgetListBox : public ModelWidget {
 public:
@@ -135,6 +151,12 @@ public:
 	void add(WidgetListItem *item);
 	void unlock();
 
+	/** Make this a virtual listbox, with count items out of this source. */
+	void setItems(WidgetListItemSource &source, uint count);
+
+	/** Return the number of items. */
+	uint getItemCount() const;
+
 	void setText(const Common::UString &font, const Common::UString &text,
 	             float spacing = 0.0);
 
@@ -168,6 +190,9 @@ private:
 	std::vector<WidgetListItem *> _items;
 	std::vector<WidgetListItem *> _visibleItems;
 
+	WidgetListItemSource *_source; ///< The source of a virtual listbox's items.
+	uint _itemCount;               ///< The number of a virtual listbox's items.
+
 	uint _startItem;
 	uint _selectedItem;
 
@@ -184,6 +209,9 @@ private:
 	void scrollDown(uint n);
 
 	void updateVisible();
+	void fillVisible();
+
+	void setItemState(WidgetListItem &item, bool selected);
 
 	void itemDblClicked();
 
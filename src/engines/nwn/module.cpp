@@ -535,7 +535,7 @@ void Module::unloadModule() {
 
 	_ifo.unload();
 
-	ResMan.undo(_resModule);
+	deindexResources(_resModule);
 
 	_newModule.clear();
 	_hasModule = false;
@@ -565,7 +565,7 @@ void Module::loadHAKs() {
 void Module::unloadHAKs() {
 	std::vector<Aurora::ResourceManager::ChangeID>::iterator hak;
 	for (hak = _resHAKs.begin(); hak != _resHAKs.end(); ++hak)
-		ResMan.undo(*hak);
+		deindexResources(*hak);
 
 	_resHAKs.clear();
 }
@@ -600,7 +600,7 @@ void Module::loadTexturePack() {
 
 void Module::unloadTexturePack() {
 	for (int i = 0; i < 4; i++)
-		ResMan.undo(_resTP[i]);
+		deindexResources(_resTP[i]);
 
 	_currentTexturePack = -1;
 }
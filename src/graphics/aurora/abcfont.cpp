@@ -54,21 +54,24 @@ float ABCFont::getWidth(uint32 c) const {
 	return cC.spaceL + cC.width + cC.spaceR;
 }
 
-void ABCFont::draw(uint32 c) const {
-	TextureMan.set(_texture);
-
+void ABCFont::getQuad(uint32 c, CharQuad &quad) const {
 	const Char &cC = findChar(c);
 
-	glTranslatef(cC.spaceL, 0.0, 0.0);
+	quad.page = 0;
 
-	glBegin(GL_QUADS);
 	for (int i = 0; i < 4; i++) {
-		glTexCoord2f(cC.tX[i], cC.tY[i]);
-		glVertex2f  (cC.vX[i], cC.vY[i]);
+		quad.vX[i] = cC.vX[i] + cC.spaceL; quad.vY[i] = cC.vY[i];
+		quad.tX[i] = cC.tX[i]            ; quad.tY[i] = cC.tY[i];
 	}
-	glEnd();
 
-	glTranslatef(cC.width + cC.spaceR, 0.0, 0.0);
+	quad.advance = cC.spaceL + cC.width + cC.spaceR;
+}
+
+void ABCFont::setPage(int32 page) const {
+	if (page < 0)
+		TextureMan.set();
+	else
+		TextureMan.set(_texture);
 }
 
 void ABCFont::load(const Common::UString &name) {
@@ -49,7 +49,8 @@ public:
 	float getWidth (uint32 c) const;
 	float getHeight()         const;
 
-	void draw(uint32 c) const;
+	void getQuad(uint32 c, CharQuad &quad) const;
+	void setPage(int32 page) const;
 
 private:
 	/** A font character. */
@@ -54,6 +54,14 @@ void Animation::setName(Common::UString &name) {
 	_name = name;
 }
 
+bool Animation::animatesNode(const Common::UString &node) const {
+	NodeMap::const_iterator n = nodeMap.find(node);
+	if ((n == nodeMap.end()) || !n->second->_nodedata)
+		return false;
+
+	return n->second->_nodedata->hasKeyFrames();
+}
+
 void Animation::setLength(float length) {
 	_length = length;
 }
@@ -58,6 +58,9 @@ public:
 	const Common::UString &getName() const;
 	void setName(Common::UString &name);
 
+	/** Does this animation move the named node? */
+	bool animatesNode(const Common::UString &node) const;
+
 protected:
 	typedef std::list<AnimNode *> NodeList;
 	typedef std::map<Common::UString, AnimNode *, Common::UString::iless> NodeMap;
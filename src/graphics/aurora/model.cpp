@@ -42,7 +42,8 @@ namespace Aurora {
 
 Model::Model(ModelType type) : Renderable((RenderableType) type),
 	_type(type), _supermodel(0), _currentState(0),
-	_currentAnimation(0), _nextAnimation(0), _drawBound(false) {
+	_currentAnimation(0), _nextAnimation(0),
+	_nodeTransformsDirty(false), _worldTransformsDirty(false), _drawBound(false) {
 
 	_position[0] = 0.0; _position[1] = 0.0; _position[2] = 0.0;
 	_rotation[0] = 0.0; _rotation[1] = 0.0; _rotation[2] = 0.0;
@@ -57,6 +58,8 @@ Model::Model(ModelType type) : Renderable((RenderableType) type),
 }
 
 Model::~Model() {
+	GLContainer::removeFromQueue(kQueueNewTexture);
+
 	hide();
 
 	for (StateList::iterator s = _stateList.begin(); s != _stateList.end(); ++s) {
@@ -155,6 +158,18 @@ Animation *Model::selectDefaultAnimation() const {
 	return 0;
 }
 
+bool Model::isNodeAnimated(const Common::UString &node) const {
+	for (AnimationMap::const_iterator a = _animationMap.begin(); a != _animationMap.end(); ++a)
+		if (a->second->animatesNode(node))
+			return true;
+
+	// Animations of the supermodel are played on our nodes too
+	if (_supermodel)
+		return _supermodel->isNodeAnimated(node);
+
+	return false;
+}
+
 void Model::getPosition(float &x, float &y, float &z) const {
 	x = _position[0] * _modelScale[0];
 	y = _position[1] * _modelScale[1];
@@ -240,6 +255,95 @@ void Model::createAbsolutePosition() {
 	_absoluteBoundBox = _boundBox;
 	_absoluteBoundBox.transform(_absolutePosition);
 	_absoluteBoundBox.absolutize();
+
+	_worldTransformsDirty = true;
+}
+
+void Model::createFlatNodes() {
+	std::vector<FlatNode> flatNodes;
+
+	if (_currentState) {
+		flatNodes.reserve(_currentState->nodeList.size());
+
+		// Roots first, then walk down the children in order
+		for (NodeList::iterator n = _currentState->rootNodes.begin();
+		     n != _currentState->rootNodes.end(); ++n) {
+
+			flatNodes.push_back(FlatNode());
+			flatNodes.back().node   = *n;
+			flatNodes.back().parent = -1;
+		}
+
+		for (uint32 i = 0; i < flatNodes.size(); i++) {
+			ModelNode &node = *flatNodes[i].node;
+
+			for (NodeList::iterator c = node._children.begin(); c != node._children.end(); ++c) {
+				flatNodes.push_back(FlatNode());
+				flatNodes.back().node   = *c;
+				flatNodes.back().parent = i;
+			}
+		}
+	}
+
+	// Calculate all transformations up front, the render thread might be reading the current ones
+	std::vector<Common::TransformationMatrix> nodeTransforms(flatNodes.size());
+	std::vector<Common::TransformationMatrix> nodeWorldTransforms(flatNodes.size());
+
+	for (uint32 i = 0; i < flatNodes.size(); i++) {
+		if (flatNodes[i].parent >= 0)
+			nodeTransforms[i] = nodeTransforms[flatNodes[i].parent];
+
+		flatNodes[i].node->applyTransform(nodeTransforms[i]);
+
+		nodeWorldTransforms[i] = _absolutePosition * nodeTransforms[i];
+	}
+
+	GfxMan.lockFrame();
+
+	_flatNodes.swap(flatNodes);
+	_nodeTransforms.swap(nodeTransforms);
+	_nodeWorldTransforms.swap(nodeWorldTransforms);
+
+	for (uint32 i = 0; i < _flatNodes.size(); i++) {
+		_flatNodes[i].node->_transformIndex = i;
+		_flatNodes[i].node->_transformDirty = false;
+	}
+
+	_nodeTransformsDirty  = false;
+	_worldTransformsDirty = false;
+
+	GfxMan.unlockFrame();
+}
+
+void Model::updateNodeTransforms() {
+	if (!_nodeTransformsDirty && !_worldTransformsDirty)
+		return;
+
+	for (uint32 i = 0; i < _flatNodes.size(); i++) {
+		const FlatNode &flat = _flatNodes[i];
+
+		// A node's transformation also changes when its parent's transformation changed
+		if ((flat.parent >= 0) && _flatNodes[flat.parent].node->_transformDirty)
+			flat.node->_transformDirty = true;
+
+		if (flat.node->_transformDirty) {
+			if (flat.parent >= 0)
+				_nodeTransforms[i] = _nodeTransforms[flat.parent];
+			else
+				_nodeTransforms[i].loadIdentity();
+
+			flat.node->applyTransform(_nodeTransforms[i]);
+		}
+
+		if (flat.node->_transformDirty || _worldTransformsDirty)
+			_nodeWorldTransforms[i] = _absolutePosition * _nodeTransforms[i];
+	}
+
+	for (uint32 i = 0; i < _flatNodes.size(); i++)
+		_flatNodes[i].node->_transformDirty = false;
+
+	_nodeTransformsDirty  = false;
+	_worldTransformsDirty = false;
 }
 
 const std::list<Common::UString> &Model::getStates() const {
@@ -274,6 +378,8 @@ void Model::setState(const Common::UString &name) {
 
 	_currentState = state;
 
+	createFlatNodes();
+
 	// TODO: Do we need to recreate the bounding box on a state change?
 
 	// createBound();
@@ -386,6 +492,9 @@ void Model::calculateDistance() {
 
 void Model::advanceTime(float dt) {
 	manageAnimations(dt);
+
+	// The animation moved the nodes around
+	updateNodeTransforms();
 }
 
 void Model::manageAnimations(float dt) {
@@ -436,6 +545,8 @@ void Model::render(RenderPass pass) {
 	if (!_currentState || (pass > kRenderPassAll))
 		return;
 
+	updateNodeTransforms();
+
 	if (pass == kRenderPassAll) {
 		Model::render(kRenderPassOpaque);
 		Model::render(kRenderPassTransparent);
@@ -459,14 +570,15 @@ void Model::render(RenderPass pass) {
 	// Draw the bounding box, if requested
 	doDrawBound();
 
-	// Draw the nodes
+	// Collect the nodes' geometry
+	_renderQueue.clear();
+
 	for (NodeList::iterator n = _currentState->rootNodes.begin();
-	     n != _currentState->rootNodes.end(); ++n) {
+	     n != _currentState->rootNodes.end(); ++n)
+		(*n)->queueRender(pass, _renderQueue);
 
-		glPushMatrix();
-		(*n)->render(pass);
-		glPopMatrix();
-	}
+	// Draw the nodes, grouped by their render state
+	ModelNode::renderQueue(_renderQueue, pass);
 
 	// Reset the first texture units
 	TextureMan.reset();
@@ -529,14 +641,24 @@ void Model::doDrawBound() {
 }
 
 void Model::doRebuild() {
-	// TODO: remove this and all references to it.
+	// Move the static node geometry into buffer objects
+	for (StateList::iterator s = _stateList.begin(); s != _stateList.end(); ++s)
+		for (NodeList::iterator n = (*s)->nodeList.begin(); n != (*s)->nodeList.end(); ++n)
+			(*n)->initGL();
 }
 
 void Model::doDestroy() {
-	// TODO: remove this and all references to it.
+	for (StateList::iterator s = _stateList.begin(); s != _stateList.end(); ++s)
+		for (NodeList::iterator n = (*s)->nodeList.begin(); n != (*s)->nodeList.end(); ++n)
+			(*n)->destroyGL();
 }
 
 void Model::finalize() {
+	// Now that all textures were requested, wait for them to find out what's transparent
+	for (StateList::iterator s = _stateList.begin(); s != _stateList.end(); ++s)
+		for (NodeList::iterator n = (*s)->nodeList.begin(); n != (*s)->nodeList.end(); ++n)
+			(*n)->resolveTransparency();
+
 	_currentState = 0;
 
 	createStateNamesList();
@@ -550,6 +672,9 @@ void Model::finalize() {
 			(*n)->orderChildren();
 
 	_currentAnimation = selectDefaultAnimation();
+
+	// Upload the geometry into buffer objects with the next frame
+	GLContainer::addToQueue(kQueueNewTexture);
 }
 
 void Model::createStateNamesList() {
@@ -565,12 +690,12 @@ void Model::createBound() {
 	if (!_currentState)
 		return;
 
+	updateNodeTransforms();
+
 	for (NodeList::iterator n = _currentState->rootNodes.begin();
 	     n != _currentState->rootNodes.end(); ++n) {
 
-		Common::BoundingBox position;
-
-		(*n)->createAbsoluteBound(position);
+		(*n)->createAbsoluteBound();
 
 		_boundBox.add((*n)->getAbsoluteBound());
 	}
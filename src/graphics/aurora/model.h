@@ -38,6 +38,7 @@
 #include "graphics/renderable.h"
 
 #include "graphics/aurora/types.h"
+#include "graphics/aurora/modelnode.h"
 
 namespace Common {
 	class SeekableReadStream;
@@ -47,7 +48,6 @@ namespace Graphics {
 
 namespace Aurora {
 
-class ModelNode;
 class Animation;
 
 class Model : public GLContainer, public Renderable {
@@ -135,6 +135,9 @@ public:
 	/** Play a default idle animation. */
 	void playDefaultAnimation();
 
+	/** Is the named node moved by any of the model's animations? */
+	bool isNodeAnimated(const Common::UString &node) const;
+
 
 	// Renderable
 	void calculateDistance();
@@ -205,6 +208,23 @@ protected:
 
 	Common::TransformationMatrix _absolutePosition;
 
+	/** A node within the flattened node hierarchy of the current state. */
+	struct FlatNode {
+		ModelNode *node; ///< The node.
+		int32 parent;    ///< Index of the node's parent, -1 for root nodes.
+	};
+
+	/** The current state's nodes, with parents always in front of their children. */
+	std::vector<FlatNode> _flatNodes;
+
+	/** The transformations of all nodes in _flatNodes, relative to the model. */
+	std::vector<Common::TransformationMatrix> _nodeTransforms;
+	/** The transformations of all nodes in _flatNodes, in world space. */
+	std::vector<Common::TransformationMatrix> _nodeWorldTransforms;
+
+	bool _nodeTransformsDirty;  ///< Has any node's transformation changed?
+	bool _worldTransformsDirty; ///< Has the model's transformation changed?
+
 	/** The model's bounding box. */
 	Common::BoundingBox _boundBox;
 	/** The model's box after translate/rotate. */
@@ -230,11 +250,23 @@ private:
 	bool _drawBound;
 	float _elapsedTime; ///< Track animation duration
 
+	ModelNode::RenderQueue _renderQueue; ///< The node geometry to render this pass.
+
 	void createStateNamesList(); ///< Create the list of all state names.
 	void createBound();          ///< Create the model's bounding box.
 
 	void createAbsolutePosition();
 
+	/** Flatten the current state's node hierarchy, and calculate all its transformations. */
+	void createFlatNodes();
+	/** Recalculate the transformations of all nodes that changed.
+	 *
+	 *  Changing a transformation only marks it as changed. The render thread
+	 *  calls this once per frame, after animating the model and before drawing
+	 *  it. Everybody else only calls it while the model isn't being drawn.
+	 */
+	void updateNodeTransforms();
+
 	void doDrawBound();
 	void manageAnimations(float dt);
 
@@ -255,6 +287,7 @@ public:
 	                      uint32 offset, uint32 count, std::vector<T> &values);
 
 	friend class ModelNode;
+	friend class StaticBatch;
 };
 
 } // End of namespace Aurora
@@ -22,6 +22,8 @@
  *  A node within a 3D model.
  */
 
+#include <algorithm>
+
 #include "common/util.h"
 #include "common/maths.h"
 
@@ -44,26 +46,43 @@ static bool nodeComp(ModelNode *a, ModelNode *b) {
 
 // OpenGL < 2 vertex attribute helper functions
 
-static void EnableVertexPos(const VertexAttrib &va) {
-	glEnableClientState(GL_VERTEX_ARRAY);
-	glVertexPointer(va.size, va.type, va.stride, va.pointer);
+static void PointerVertexPos(const VertexAttrib &va, const GLvoid *pointer) {
+	glVertexPointer(va.size, va.type, va.stride, pointer);
 }
 
-static void EnableVertexNorm(const VertexAttrib &va) {
+static void PointerVertexNorm(const VertexAttrib &va, const GLvoid *pointer) {
 	assert(va.size == 3);
+	glNormalPointer(va.type, va.stride, pointer);
+}
+
+static void PointerVertexCol(const VertexAttrib &va, const GLvoid *pointer) {
+	glColorPointer(va.size, va.type, va.stride, pointer);
+}
+
+static void PointerVertexTex(const VertexAttrib &va, const GLvoid *pointer) {
+	glClientActiveTextureARB(GL_TEXTURE0 + va.index - VTCOORD);
+	glTexCoordPointer(va.size, va.type, va.stride, pointer);
+}
+
+static void EnableVertexPos(const VertexAttrib &va, const GLvoid *pointer) {
+	glEnableClientState(GL_VERTEX_ARRAY);
+	PointerVertexPos(va, pointer);
+}
+
+static void EnableVertexNorm(const VertexAttrib &va, const GLvoid *pointer) {
 	glEnableClientState(GL_NORMAL_ARRAY);
-	glNormalPointer(va.type, va.stride, va.pointer);
+	PointerVertexNorm(va, pointer);
 }
 
-static void EnableVertexCol(const VertexAttrib &va) {
+static void EnableVertexCol(const VertexAttrib &va, const GLvoid *pointer) {
 	glEnableClientState(GL_COLOR_ARRAY);
-	glColorPointer(va.size, va.type, va.stride, va.pointer);
+	PointerVertexCol(va, pointer);
 }
 
-static void EnableVertexTex(const VertexAttrib &va) {
+static void EnableVertexTex(const VertexAttrib &va, const GLvoid *pointer) {
 	glClientActiveTextureARB(GL_TEXTURE0 + va.index - VTCOORD);
 	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-	glTexCoordPointer(va.size, va.type, va.stride, va.pointer);
+	glTexCoordPointer(va.size, va.type, va.stride, pointer);
 }
 
 static void DisableVertexPos(const VertexAttrib &va) {
@@ -83,15 +102,26 @@ static void DisableVertexTex(const VertexAttrib &va) {
 	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 }
 
-static void EnableVertexAttrib(const VertexAttrib &va) {
+static void PointerVertexAttrib(const VertexAttrib &va, const GLvoid *pointer) {
+	if (va.index == VPOSITION)
+		PointerVertexPos(va, pointer);
+	else if (va.index == VNORMAL)
+		PointerVertexNorm(va, pointer);
+	else if (va.index == VCOLOR)
+		PointerVertexCol(va, pointer);
+	else if (va.index >= VTCOORD)
+		PointerVertexTex(va, pointer);
+}
+
+static void EnableVertexAttrib(const VertexAttrib &va, const GLvoid *pointer) {
 	if (va.index == VPOSITION)
-		EnableVertexPos(va);
+		EnableVertexPos(va, pointer);
 	else if (va.index == VNORMAL)
-		EnableVertexNorm(va);
+		EnableVertexNorm(va, pointer);
 	else if (va.index == VCOLOR)
-		EnableVertexCol(va);
+		EnableVertexCol(va, pointer);
 	else if (va.index >= VTCOORD)
-		EnableVertexTex(va);
+		EnableVertexTex(va, pointer);
 }
 
 static void DisableVertexAttrib(const VertexAttrib &va) {
@@ -105,9 +135,56 @@ static void DisableVertexAttrib(const VertexAttrib &va) {
 		DisableVertexTex(va);
 }
 
+/** Compare two vertex attributes by their layout, ignoring where the data is. */
+static int compareVertexAttrib(const VertexAttrib &a, const VertexAttrib &b) {
+	if (a.index != b.index)
+		return (a.index < b.index) ? -1 : 1;
+	if (a.size != b.size)
+		return (a.size < b.size) ? -1 : 1;
+	if (a.type != b.type)
+		return (a.type < b.type) ? -1 : 1;
+
+	return 0;
+}
+
+static const Texture *getTexturePointer(const TextureHandle &handle) {
+	if (handle.empty())
+		return 0;
+
+	return &handle.getTexture();
+}
+
+/** Order the render queue by texture set, then by vertex layout. */
+static bool renderStateLess(const ModelNode *a, const ModelNode *b) {
+	const std::vector<TextureHandle> &texturesA = a->getTextures();
+	const std::vector<TextureHandle> &texturesB = b->getTextures();
+
+	for (uint32 t = 0; (t < texturesA.size()) && (t < texturesB.size()); t++) {
+		const Texture *textureA = getTexturePointer(texturesA[t]);
+		const Texture *textureB = getTexturePointer(texturesB[t]);
+
+		if (textureA != textureB)
+			return textureA < textureB;
+	}
+
+	if (texturesA.size() != texturesB.size())
+		return texturesA.size() < texturesB.size();
+
+	const VertexDecl &declA = a->getVertexDecl();
+	const VertexDecl &declB = b->getVertexDecl();
+
+	for (uint32 i = 0; (i < declA.size()) && (i < declB.size()); i++) {
+		int cmp = compareVertexAttrib(declA[i], declB[i]);
+		if (cmp != 0)
+			return cmp < 0;
+	}
+
+	return declA.size() < declB.size();
+}
+
 ModelNode::ModelNode(Model &model) :
-	_model(&model), _parent(0), _level(0),
-	_isTransparent(false), _render(false), _hasTransparencyHint(false) {
+	_model(&model), _parent(0), _level(0), _transformIndex(0), _transformDirty(true),
+	_isTransparent(false), _render(false), _hasTransparencyHint(false), _texturesPending(false) {
 
 	_position[0] = 0.0; _position[1] = 0.0; _position[2] = 0.0;
 	_rotation[0] = 0.0; _rotation[1] = 0.0; _rotation[2] = 0.0;
@@ -143,6 +220,14 @@ const Common::UString &ModelNode::getName() const {
 	return _name;
 }
 
+const std::vector<TextureHandle> &ModelNode::getTextures() const {
+	return _textures;
+}
+
+const VertexDecl &ModelNode::getVertexDecl() const {
+	return _vertexBuffer.getVertexDecl();
+}
+
 float ModelNode::getWidth() const {
 	return _boundBox.getWidth() * _model->_modelScale[0];
 }
@@ -189,6 +274,31 @@ void ModelNode::getAbsolutePosition(float &x, float &y, float &z) const {
 	z = _absolutePosition.getZ() * _model->_modelScale[2];
 }
 
+const Common::TransformationMatrix &ModelNode::getModelTransform() const {
+	assert(_transformIndex < _model->_nodeTransforms.size());
+	return _model->_nodeTransforms[_transformIndex];
+}
+
+const Common::TransformationMatrix &ModelNode::getWorldTransform() const {
+	assert(_transformIndex < _model->_nodeWorldTransforms.size());
+	return _model->_nodeWorldTransforms[_transformIndex];
+}
+
+void ModelNode::markTransformDirty() {
+	_transformDirty = true;
+
+	_model->_nodeTransformsDirty = true;
+}
+
+void ModelNode::applyTransform(Common::TransformationMatrix &transform) const {
+	transform.translate(_position[0], _position[1], _position[2]);
+	transform.rotate(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
+
+	transform.rotate(_rotation[0], 1.0, 0.0, 0.0);
+	transform.rotate(_rotation[1], 0.0, 1.0, 0.0);
+	transform.rotate(_rotation[2], 0.0, 0.0, 1.0);
+}
+
 void ModelNode::setPosition(float x, float y, float z) {
 	GfxMan.lockFrame();
 
@@ -199,6 +309,8 @@ void ModelNode::setPosition(float x, float y, float z) {
 	if (_parent)
 		_parent->orderChildren();
 
+	markTransformDirty();
+
 	GfxMan.unlockFrame();
 }
 
@@ -209,6 +321,8 @@ void ModelNode::setRotation(float x, float y, float z) {
 	_rotation[1] = y;
 	_rotation[2] = z;
 
+	markTransformDirty();
+
 	GfxMan.unlockFrame();
 }
 
@@ -220,6 +334,8 @@ void ModelNode::setOrientation(float x, float y, float z, float a) {
 	_orientation[2] = z;
 	_orientation[3] = a;
 
+	markTransformDirty();
+
 	GfxMan.unlockFrame();
 }
 
@@ -238,6 +354,8 @@ void ModelNode::inheritPosition(ModelNode &node) const {
 	node._position[0] = _position[0];
 	node._position[1] = _position[1];
 	node._position[2] = _position[2];
+
+	node.markTransformDirty();
 }
 
 void ModelNode::inheritOrientation(ModelNode &node) const {
@@ -245,12 +363,19 @@ void ModelNode::inheritOrientation(ModelNode &node) const {
 	node._orientation[1] = _orientation[1];
 	node._orientation[2] = _orientation[2];
 	node._orientation[3] = _orientation[3];
+
+	node.markTransformDirty();
 }
 
 void ModelNode::inheritGeometry(ModelNode &node) const {
 	node._textures      = _textures;
 	node._render        = _render;
 	node._isTransparent = _isTransparent;
+
+	node._hasTransparencyHint = _hasTransparencyHint;
+	node._transparencyHint    = _transparencyHint;
+	node._texturesPending     = _texturesPending;
+
 	node._vertexBuffer  = _vertexBuffer;
 	node._indexBuffer   = _indexBuffer;
 
@@ -332,9 +457,6 @@ void ModelNode::loadTextures(const std::vector<Common::UString> &textures) {
 
 	_textures.resize(textures.size());
 
-	bool hasAlpha = true;
-	bool isDecal  = true;
-
 	for (uint t = 0; t != textures.size(); t++) {
 
 		try {
@@ -342,14 +464,6 @@ void ModelNode::loadTextures(const std::vector<Common::UString> &textures) {
 			if (!textures[t].empty() && (textures[t] != "NULL")) {
 				_textures[t] = TextureMan.get(textures[t]);
 				hasTexture = true;
-
-				if (!_textures[t].getTexture().hasAlpha())
-					hasAlpha = false;
-				if (_textures[t].getTexture().getTXI().getFeatures().alphaMean == 1.0)
-					hasAlpha = false;
-
-				if (!_textures[t].getTexture().getTXI().getFeatures().decal)
-					isDecal = false;
 			}
 
 		} catch (...) {
@@ -358,6 +472,39 @@ void ModelNode::loadTextures(const std::vector<Common::UString> &textures) {
 
 	}
 
+	// The textures might still be decoding. Only look at them once the whole model is loaded
+	_texturesPending = true;
+
+	// If the node has no actual texture, we just assume
+	// that the geometry shouldn't be rendered.
+	if (!hasTexture)
+		_render = false;
+}
+
+void ModelNode::resolveTransparency() {
+	if (!_texturesPending)
+		return;
+
+	_texturesPending = false;
+
+	bool hasAlpha = true;
+	bool isDecal  = true;
+
+	for (std::vector<TextureHandle>::const_iterator t = _textures.begin(); t != _textures.end(); ++t) {
+		if (t->empty())
+			continue;
+
+		const Texture &texture = t->getTexture();
+
+		if (!texture.hasAlpha())
+			hasAlpha = false;
+		if (texture.getTXI().getFeatures().alphaMean == 1.0)
+			hasAlpha = false;
+
+		if (!texture.getTXI().getFeatures().decal)
+			isDecal = false;
+	}
+
 	if (_hasTransparencyHint) {
 		_isTransparent = _transparencyHint;
 		if (isDecal)
@@ -365,11 +512,6 @@ void ModelNode::loadTextures(const std::vector<Common::UString> &textures) {
 	} else {
 		_isTransparent = hasAlpha;
 	}
-
-	// If the node has no actual texture, we just assume
-	// that the geometry shouldn't be rendered.
-	if (!hasTexture)
-		_render = false;
 }
 
 void ModelNode::createBound() {
@@ -401,29 +543,25 @@ const Common::BoundingBox &ModelNode::getAbsoluteBound() const {
 	return _absoluteBoundBox;
 }
 
-void ModelNode::createAbsoluteBound(Common::BoundingBox parentPosition) {
-	// Transform by our position/orientation/rotation
-	parentPosition.translate(_position[0], _position[1], _position[2]);
-	parentPosition.rotate(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
-
-	parentPosition.rotate(_rotation[0], 1.0, 0.0, 0.0);
-	parentPosition.rotate(_rotation[1], 0.0, 1.0, 0.0);
-	parentPosition.rotate(_rotation[2], 0.0, 0.0, 1.0);
+void ModelNode::createAbsoluteBound() {
+	// Our transformation, as flattened by the model
+	Common::BoundingBox position;
+	position.transform(getModelTransform());
 
 
 	// That's our absolute position
-	_absolutePosition = parentPosition.getOrigin();
+	_absolutePosition = position.getOrigin();
 
 
 	// Add our bounding box, creating the absolute bounding box
-	_absoluteBoundBox = parentPosition;
+	_absoluteBoundBox = position;
 	_absoluteBoundBox.add(_boundBox);
 	_absoluteBoundBox.absolutize();
 
 
 	// Recurse into the children
 	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c) {
-		(*c)->createAbsoluteBound(parentPosition);
+		(*c)->createAbsoluteBound();
 
 		_absoluteBoundBox.add((*c)->getAbsoluteBound());
 	}
@@ -437,27 +575,99 @@ void ModelNode::orderChildren() {
 		(*c)->orderChildren();
 }
 
-void ModelNode::renderGeometry() {
-	// Enable all needed texture units
-	for (uint32 t = 0; t < _textures.size(); t++) {
-		TextureMan.activeTexture(t);
-		glEnable(GL_TEXTURE_2D);
+bool ModelNode::hasSameTextures(const ModelNode &node) const {
+	if (_textures.size() != node._textures.size())
+		return false;
 
-		TextureMan.set(_textures[t]);
+	for (uint32 t = 0; t < _textures.size(); t++)
+		if (getTexturePointer(_textures[t]) != getTexturePointer(node._textures[t]))
+			return false;
+
+	return true;
+}
+
+bool ModelNode::hasSameVertexLayout(const ModelNode &node) const {
+	const VertexDecl &decl     = _vertexBuffer.getVertexDecl();
+	const VertexDecl &nodeDecl = node._vertexBuffer.getVertexDecl();
+
+	if (decl.size() != nodeDecl.size())
+		return false;
+
+	for (uint32 i = 0; i < decl.size(); i++)
+		if (compareVertexAttrib(decl[i], nodeDecl[i]) != 0)
+			return false;
+
+	return true;
+}
+
+void ModelNode::renderGeometry(const ModelNode *previous) {
+	// Bind all needed textures not already bound by the previous node
+
+	if (!previous || !hasSameTextures(*previous)) {
+		const uint32 previousCount = previous ? previous->_textures.size() : 0;
+
+		for (uint32 t = 0; t < _textures.size(); t++) {
+			if ((t < previousCount) &&
+			    (getTexturePointer(_textures[t]) == getTexturePointer(previous->_textures[t])))
+				continue;
+
+			TextureMan.activeTexture(t);
+			if (t >= previousCount)
+				glEnable(GL_TEXTURE_2D);
+
+			TextureMan.set(_textures[t]);
+			GfxMan.countTextureChange();
+		}
+
+		// Disable the texture units only the previous node needed
+		for (uint32 t = _textures.size(); t < previousCount; t++) {
+			TextureMan.activeTexture(t);
+			glDisable(GL_TEXTURE_2D);
+		}
 	}
 
-	// Render the node's faces
+	// Set up the vertex attributes, only switching them on and off if the layout changed
 
 	const VertexDecl &vertexDecl = _vertexBuffer.getVertexDecl();
 
-	for (uint32 i = 0; i < vertexDecl.size(); i++)
-		EnableVertexAttrib(vertexDecl[i]);
+	_vertexBuffer.bind();
+
+	if (previous && hasSameVertexLayout(*previous)) {
+		for (uint32 i = 0; i < vertexDecl.size(); i++)
+			PointerVertexAttrib(vertexDecl[i], _vertexBuffer.getAttribPointer(vertexDecl[i]));
+	} else {
+		if (previous) {
+			const VertexDecl &previousDecl = previous->_vertexBuffer.getVertexDecl();
+
+			for (uint32 i = 0; i < previousDecl.size(); i++)
+				DisableVertexAttrib(previousDecl[i]);
+		}
 
-	glDrawElements(GL_TRIANGLES, _indexBuffer.getCount(), _indexBuffer.getType(), _indexBuffer.getData());
+		for (uint32 i = 0; i < vertexDecl.size(); i++)
+			EnableVertexAttrib(vertexDecl[i], _vertexBuffer.getAttribPointer(vertexDecl[i]));
+
+		GfxMan.countStateChange();
+	}
+
+	// Render the node's faces
+
+	_indexBuffer.bind();
+
+	glDrawElements(GL_TRIANGLES, _indexBuffer.getCount(), _indexBuffer.getType(),
+	               _indexBuffer.getIndexPointer());
+
+	GfxMan.countDrawCall(_indexBuffer.getCount() / 3);
+}
+
+void ModelNode::finishGeometry() const {
+	const VertexDecl &vertexDecl = _vertexBuffer.getVertexDecl();
 
 	for (uint32 i = 0; i < vertexDecl.size(); i++)
 		DisableVertexAttrib(vertexDecl[i]);
 
+	VertexBuffer::unbind();
+	IndexBuffer::unbind();
+
 	// Disable the texture units again
 	for (uint32 i = 0; i < _textures.size(); i++) {
 		TextureMan.activeTexture(i);
@@ -465,34 +675,52 @@ void ModelNode::renderGeometry() {
 	}
 }
 
-void ModelNode::render(RenderPass pass) {
-	// Apply the node's transformation
-
-	glTranslatef(_position[0], _position[1], _position[2]);
-	glRotatef(_orientation[3], _orientation[0], _orientation[1], _orientation[2]);
-
-	glRotatef(_rotation[0], 1.0, 0.0, 0.0);
-	glRotatef(_rotation[1], 0.0, 1.0, 0.0);
-	glRotatef(_rotation[2], 0.0, 0.0, 1.0);
-
+void ModelNode::initGL() {
+	_vertexBuffer.initGL();
+	_indexBuffer.initGL();
+}
 
-	// Render the node's geometry
+void ModelNode::destroyGL() {
+	_vertexBuffer.destroyGL();
+	_indexBuffer.destroyGL();
+}
 
+void ModelNode::queueRender(RenderPass pass, RenderQueue &queue) {
 	bool shouldRender = _render && (_indexBuffer.getCount() > 0);
 	if (((pass == kRenderPassOpaque)      &&  _isTransparent) ||
 	    ((pass == kRenderPassTransparent) && !_isTransparent))
 		shouldRender = false;
 
 	if (shouldRender)
-		renderGeometry();
+		queue.push_back(this);
 
+	// Queue the node's children
+	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c)
+		(*c)->queueRender(pass, queue);
+}
 
-	// Render the node's children
-	for (std::list<ModelNode *>::iterator c = _children.begin(); c != _children.end(); ++c) {
+void ModelNode::renderQueue(RenderQueue &queue, RenderPass pass) {
+	if (queue.empty())
+		return;
+
+	/* Opaque geometry can be drawn in any order, so we group it by state.
+	 * Transparent geometry has to stay in the order the nodes were sorted in. */
+	if (pass == kRenderPassOpaque)
+		std::stable_sort(queue.begin(), queue.end(), renderStateLess);
+
+	const ModelNode *previous = 0;
+	for (RenderQueue::iterator n = queue.begin(); n != queue.end(); ++n) {
 		glPushMatrix();
-		(*c)->render(pass);
+		glMultMatrixf((*n)->getModelTransform().get());
+
+		(*n)->renderGeometry(previous);
+
 		glPopMatrix();
+
+		previous = *n;
 	}
+
+	previous->finishGeometry();
 }
 
 void ModelNode::interpolatePosition(float time, float &x, float &y, float &z) const {
@@ -562,6 +790,10 @@ void ModelNode::interpolateOrientation(float time, float &x, float &y, float &z,
 	a = Common::rad2deg(acos(q) * 2.0);
 }
 
+bool ModelNode::hasKeyFrames() const {
+	return !_positionFrames.empty() || !_orientationFrames.empty();
+}
+
 } // End of namespace Aurora
 
 } // End of namespace Graphics
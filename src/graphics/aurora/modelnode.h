@@ -62,12 +62,20 @@ struct QuaternionKeyFrame {
 
 class ModelNode {
 public:
+	/** Nodes with geometry, queued for rendering. */
+	typedef std::vector<ModelNode *> RenderQueue;
+
 	ModelNode(Model &model);
 	virtual ~ModelNode();
 
 	/** Get the node's name. */
 	const Common::UString &getName() const;
 
+	/** Get the node's textures. */
+	const std::vector<TextureHandle> &getTextures() const;
+	/** Get the node's vertex layout. */
+	const VertexDecl &getVertexDecl() const;
+
 	float getWidth () const; ///< Get the width of the node's bounding box.
 	float getHeight() const; ///< Get the height of the node's bounding box.
 	float getDepth () const; ///< Get the depth of the node's bounding box.
@@ -90,6 +98,11 @@ public:
 	/** Get the position of the node after translate/rotate. */
 	void getAbsolutePosition(float &x, float &y, float &z) const;
 
+	/** Get the node's complete transformation, relative to the model. */
+	const Common::TransformationMatrix &getModelTransform() const;
+	/** Get the node's complete transformation, in world space. */
+	const Common::TransformationMatrix &getWorldTransform() const;
+
 	/** Set the position of the node. */
 	void setPosition(float x, float y, float z);
 	/** Set the rotation of the node. */
@@ -127,6 +140,9 @@ protected:
 	/** Position of the node after translate/rotate. */
 	Common::TransformationMatrix _absolutePosition;
 
+	uint32 _transformIndex; ///< Index into the model's flattened node transformations.
+	bool   _transformDirty; ///< Has the node's transformation changed since the last update?
+
 	float _wirecolor[3]; ///< Color of the wireframe.
 	float _ambient  [3]; ///< Ambient color.
 	float _diffuse  [3]; ///< Diffuse color.
@@ -165,25 +181,48 @@ protected:
 	bool _hasTransparencyHint;
 	bool _transparencyHint;
 
+	bool _texturesPending; ///< Do we still need to look at our textures' properties?
+
 	Common::BoundingBox _boundBox;
 	Common::BoundingBox _absoluteBoundBox;
 
 
 	// Loading helpers
 	void loadTextures(const std::vector<Common::UString> &textures);
+	/** Decide whether the node is transparent, once its textures are decoded. */
+	void resolveTransparency();
 	void createBound();
 	void createCenter();
 
-	void render(RenderPass pass);
+	/** Upload the node's geometry into GL buffer objects. */
+	void initGL();
+	/** Delete the GL buffer objects holding the node's geometry. */
+	void destroyGL();
+
+	/** Queue the geometry of this node and its children for rendering. */
+	void queueRender(RenderPass pass, RenderQueue &queue);
 
 
 private:
 	const Common::BoundingBox &getAbsoluteBound() const;
-	void createAbsoluteBound(Common::BoundingBox parentPosition);
+	void createAbsoluteBound();
+
+	/** Mark the node's transformation as changed, to be updated by the model with the next frame. */
+	void markTransformDirty();
+	/** Apply the node's own translation and rotations onto this transformation. */
+	void applyTransform(Common::TransformationMatrix &transform) const;
 
 	void orderChildren();
 
-	void renderGeometry();
+	/** Does this node use the same textures as that other node? */
+	bool hasSameTextures(const ModelNode &node) const;
+	/** Does this node use the same vertex layout as that other node? */
+	bool hasSameVertexLayout(const ModelNode &node) const;
+
+	/** Render the node's geometry, changing only the state that differs from the previous node. */
+	void renderGeometry(const ModelNode *previous);
+	/** Reset the state the node's geometry rendering left behind. */
+	void finishGeometry() const;
 
 
 public:
@@ -207,7 +246,16 @@ public:
 	void interpolatePosition(float time, float &x, float &y, float &z) const;
 	void interpolateOrientation(float time, float &x, float &y, float &z, float &a) const;
 
+	/** Does the node have any position or orientation keyframes? */
+	bool hasKeyFrames() const;
+
+	// Render helpers
+
+	/** Render all queued node geometry. */
+	static void renderQueue(RenderQueue &queue, RenderPass pass);
+
 	friend class Model;
+	friend class StaticBatch;
 };
 
 } // End of namespace Aurora
@@ -22,6 +22,10 @@
  *  BioWare's Packed Layered Texture.
  */
 
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
 #include "common/error.h"
 #include "common/stream.h"
 
@@ -154,9 +158,7 @@ void PLTFile::rebuild() {
 	if (_texture.empty())
 		return;
 
-	PLTImage *t = new PLTImage(*this);
-
-	_texture.getTexture().reload(t);
+	TextureMan.buildPLT(*this);
 }
 
 TextureHandle PLTFile::getTexture() const {
@@ -186,16 +188,35 @@ void PLTImage::create(const PLTFile &parent) {
 	_mipMaps[0]->size   = _mipMaps[0]->width * _mipMaps[0]->height * 4;
 	_mipMaps[0]->data   = new byte[_mipMaps[0]->size];
 
-	byte rows[4 * 256 * PLTFile::kLayerMAX];
-	getColorRows(parent, rows);
+	// One row of 256 colors per layer, indexed by (layer << 8) | color
+	uint32 rows[256 * PLTFile::kLayerMAX];
+	getColorRows(parent, (byte *) rows);
 
-	uint32 pixels = parent._width * parent._height;
+	const uint32 pixels = parent._width * parent._height;
 	const byte *image = parent._dataImage;
 	const byte *layer = parent._dataLayers;
-	      byte *dst   = _mipMaps[0]->data;
+	      uint32 *dst = (uint32 *) _mipMaps[0]->data;
+
+	uint32 i = 0;
+
+#ifdef __SSE2__
+	/* Interleaving the colors and layers gives us the indices of 16 pixels at once.
+	 * The table lookups themselves still happen one pixel after the other. */
+	for (; (i + 16) <= pixels; i += 16) {
+		const __m128i colors16 = _mm_loadu_si128((const __m128i *) (image + i));
+		const __m128i layers16 = _mm_loadu_si128((const __m128i *) (layer + i));
+
+		uint16 indices[16];
+		_mm_storeu_si128((__m128i *) (indices + 0), _mm_unpacklo_epi8(colors16, layers16));
+		_mm_storeu_si128((__m128i *) (indices + 8), _mm_unpackhi_epi8(colors16, layers16));
+
+		for (uint32 j = 0; j < 16; j++)
+			dst[i + j] = rows[indices[j]];
+	}
+#endif
 
-	for (uint32 i = 0; i < pixels; i++, image++, layer++, dst += 4)
-		memcpy(dst, rows + (*layer * 4 * 256) + (*image * 4), 4);
+	for (; i < pixels; i++)
+		dst[i] = rows[(layer[i] << 8) | image[i]];
 }
 
 void PLTImage::getColorRows(const PLTFile &parent, byte *rows) {
@@ -60,6 +60,11 @@ public:
 	bool reload();
 
 	void setLayerColor(Layer layer, uint8 color);
+
+	/** Show the PLT with the current layer colors.
+	 *
+	 *  PLTs of the same name with the same layer colors share one texture.
+	 */
 	void rebuild();
 
 private:
@@ -99,6 +104,7 @@ private:
 	void getColorRows(const PLTFile &parent, byte *rows);
 
 	friend class PLTFile;
+	friend class TextureManager;
 };
 
 } // End of namespace Aurora
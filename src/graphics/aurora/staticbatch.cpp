@@ -0,0 +1,315 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/aurora/staticbatch.cpp
+ *  Static geometry of several models, merged into few large buffers.
+ */
+
+#include <cmath>
+
+#include "common/util.h"
+
+#include "graphics/graphics.h"
+
+#include "graphics/aurora/staticbatch.h"
+#include "graphics/aurora/modelnode.h"
+
+namespace Graphics {
+
+namespace Aurora {
+
+/** Number of floats between two consecutive values of this vertex attribute. */
+static uint32 getAttribStride(const VertexAttrib &va) {
+	if (va.stride == 0)
+		return va.size;
+
+	return va.stride / sizeof(float);
+}
+
+static void transformPositions(const Common::TransformationMatrix &transform,
+                               float *dst, const float *src, uint32 stride, uint32 count) {
+
+	const float *m = transform.get();
+
+	for (uint32 i = 0; i < count; i++, src += stride, dst += 3) {
+		const float x = src[0], y = src[1], z = src[2];
+
+		dst[0] = m[0] * x + m[4] * y + m[ 8] * z + m[12];
+		dst[1] = m[1] * x + m[5] * y + m[ 9] * z + m[13];
+		dst[2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+	}
+}
+
+static void transformNormals(const Common::TransformationMatrix &transform,
+                             float *dst, const float *src, uint32 stride, uint32 count) {
+
+	const float *m = transform.get();
+
+	for (uint32 i = 0; i < count; i++, src += stride, dst += 3) {
+		const float x = src[0], y = src[1], z = src[2];
+
+		float nX = m[0] * x + m[4] * y + m[ 8] * z;
+		float nY = m[1] * x + m[5] * y + m[ 9] * z;
+		float nZ = m[2] * x + m[6] * y + m[10] * z;
+
+		const float length = sqrtf(nX * nX + nY * nY + nZ * nZ);
+		if (length > 0.0f) {
+			nX /= length;
+			nY /= length;
+			nZ /= length;
+		}
+
+		dst[0] = nX;
+		dst[1] = nY;
+		dst[2] = nZ;
+	}
+}
+
+static void copyAttrib(float *dst, const float *src, uint32 stride, uint32 size, uint32 count) {
+	for (uint32 i = 0; i < count; i++, src += stride)
+		for (uint32 j = 0; j < size; j++)
+			*dst++ = src[j];
+}
+
+template<typename T>
+static void copyIndices(T *dst, const IndexBuffer &indices, uint32 offset) {
+	const uint32 count = indices.getCount();
+
+	if (indices.getType() == GL_UNSIGNED_INT) {
+		const uint32 *src = (const uint32 *) indices.getData();
+		for (uint32 i = 0; i < count; i++)
+			*dst++ = (T) (src[i] + offset);
+	} else {
+		const uint16 *src = (const uint16 *) indices.getData();
+		for (uint32 i = 0; i < count; i++)
+			*dst++ = (T) (src[i] + offset);
+	}
+}
+
+
+StaticBatch::StaticBatch() : Model(kModelTypeObject) {
+	_name = "StaticBatch";
+}
+
+StaticBatch::~StaticBatch() {
+}
+
+uint32 StaticBatch::getBatchCount() const {
+	if (!_currentState)
+		return 0;
+
+	return _currentState->nodeList.size();
+}
+
+bool StaticBatch::canMerge(const ModelNode &node) {
+	if (!node._render || node._isTransparent)
+		return false;
+
+	if ((node._vertexBuffer.getCount() == 0) || (node._indexBuffer.getCount() == 0))
+		return false;
+
+	const GLenum indexType = node._indexBuffer.getType();
+	if ((indexType != GL_UNSIGNED_SHORT) && (indexType != GL_UNSIGNED_INT))
+		return false;
+
+	const VertexDecl &decl = node.getVertexDecl();
+	for (VertexDecl::const_iterator va = decl.begin(); va != decl.end(); ++va) {
+		if (va->type != GL_FLOAT)
+			return false;
+
+		if (((va->index == VPOSITION) || (va->index == VNORMAL)) && (va->size != 3))
+			return false;
+	}
+
+	return !decl.empty() && (decl[0].index == VPOSITION);
+}
+
+StaticBatch::Batch &StaticBatch::findBatch(const ModelNode &node) {
+	for (std::list<Batch>::iterator b = _batches.begin(); b != _batches.end(); ++b) {
+		const ModelNode &first = *b->sources.front().node;
+
+		if (first.hasSameTextures(node) && first.hasSameVertexLayout(node))
+			return *b;
+	}
+
+	_batches.push_back(Batch());
+
+	_batches.back().vertexCount = 0;
+	_batches.back().indexCount  = 0;
+
+	return _batches.back();
+}
+
+uint32 StaticBatch::add(Model &model) {
+	if (!model._currentState)
+		return 0;
+
+	// Pick up where the model and its nodes were last moved to
+	model.updateNodeTransforms();
+
+	// We render as a world object, which rotates the axis. Undo that for the merged geometry
+	Common::TransformationMatrix toBatch;
+	toBatch.rotate(90.0, 1.0, 0.0, 0.0);
+
+	// Nodes moved by an animation take their children with them
+	std::vector<bool> animated(model._flatNodes.size(), false);
+
+	uint32 count = 0;
+	for (uint32 i = 0; i < model._flatNodes.size(); i++) {
+		const FlatNode &flat = model._flatNodes[i];
+
+		animated[i] = ((flat.parent >= 0) && animated[flat.parent]) ||
+		              model.isNodeAnimated(flat.node->getName());
+
+		if (animated[i] || !canMerge(*flat.node))
+			continue;
+
+		Batch &batch = findBatch(*flat.node);
+
+		batch.sources.push_back(Source());
+		batch.sources.back().node      = flat.node;
+		batch.sources.back().transform = toBatch * flat.node->getWorldTransform();
+
+		batch.vertexCount += flat.node->_vertexBuffer.getCount();
+		batch.indexCount  += flat.node->_indexBuffer.getCount();
+
+		count++;
+	}
+
+	return count;
+}
+
+void StaticBatch::build() {
+	assert(_stateList.empty());
+
+	State *state = new State;
+
+	uint32 n = 0;
+	for (std::list<Batch>::iterator b = _batches.begin(); b != _batches.end(); ++b, ++n) {
+		ModelNode *node = createNode(*b);
+
+		node->_name = Common::UString::sprintf("batch%u", n);
+
+		state->nodeList.push_back(node);
+		state->nodeMap.insert(std::make_pair(node->_name, node));
+		state->rootNodes.push_back(node);
+	}
+
+	// The geometry is drawn by us now, so the sources don't need to keep their copy around
+	GfxMan.lockFrame();
+
+	for (std::list<Batch>::iterator b = _batches.begin(); b != _batches.end(); ++b) {
+		for (std::vector<Source>::iterator s = b->sources.begin(); s != b->sources.end(); ++s) {
+			ModelNode &source = *s->node;
+
+			source.setInvisible(true);
+
+			source._vertexBuffer.setSize(0, 0);
+			source._vertexBuffer.setVertexDecl(VertexDecl());
+			source._indexBuffer.setSize(0, 0, GL_UNSIGNED_SHORT);
+		}
+	}
+
+	GfxMan.unlockFrame();
+
+	_batches.clear();
+
+	_stateList.push_back(state);
+	_stateMap.insert(std::make_pair(state->name, state));
+
+	finalize();
+}
+
+ModelNode *StaticBatch::createNode(const Batch &batch) {
+	const ModelNode &first = *batch.sources.front().node;
+
+	ModelNode *node = new ModelNode(*this);
+
+	node->_textures      = first._textures;
+	node->_isTransparent = false;
+	node->_render        = true;
+
+	// Lay out the vertex attributes one after the other, like the model loaders do
+
+	VertexDecl decl = first.getVertexDecl();
+
+	uint32 vertexSize = 0;
+	for (VertexDecl::const_iterator va = decl.begin(); va != decl.end(); ++va)
+		vertexSize += va->size * sizeof(float);
+
+	node->_vertexBuffer.setSize(batch.vertexCount, vertexSize);
+
+	float *attribData = (float *) node->_vertexBuffer.getData();
+	for (VertexDecl::iterator va = decl.begin(); va != decl.end(); ++va) {
+		va->stride  = 0;
+		va->pointer = attribData;
+
+		attribData += va->size * batch.vertexCount;
+	}
+
+	// Only use 32-bit indices if we have to
+	const bool bigIndices = batch.vertexCount > 65536;
+
+	node->_indexBuffer.setSize(batch.indexCount,
+	                           bigIndices ? sizeof(uint32)  : sizeof(uint16),
+	                           bigIndices ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT);
+
+	uint32 vertexOffset = 0;
+	uint32 indexOffset  = 0;
+
+	for (std::vector<Source>::const_iterator s = batch.sources.begin(); s != batch.sources.end(); ++s) {
+		const ModelNode &source = *s->node;
+
+		const VertexDecl &sourceDecl = source.getVertexDecl();
+		const uint32 vertexCount = source._vertexBuffer.getCount();
+
+		for (uint32 i = 0; i < decl.size(); i++) {
+			const float  *src    = (const float *) sourceDecl[i].pointer;
+			const uint32  stride = getAttribStride(sourceDecl[i]);
+
+			float *dst = (float *) decl[i].pointer + vertexOffset * decl[i].size;
+
+			if      (decl[i].index == VPOSITION)
+				transformPositions(s->transform, dst, src, stride, vertexCount);
+			else if (decl[i].index == VNORMAL)
+				transformNormals(s->transform, dst, src, stride, vertexCount);
+			else
+				copyAttrib(dst, src, stride, decl[i].size, vertexCount);
+		}
+
+		if (bigIndices)
+			copyIndices((uint32 *) node->_indexBuffer.getData() + indexOffset, source._indexBuffer, vertexOffset);
+		else
+			copyIndices((uint16 *) node->_indexBuffer.getData() + indexOffset, source._indexBuffer, vertexOffset);
+
+		vertexOffset += vertexCount;
+		indexOffset  += source._indexBuffer.getCount();
+	}
+
+	node->_vertexBuffer.setVertexDecl(decl);
+
+	node->createBound();
+
+	return node;
+}
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
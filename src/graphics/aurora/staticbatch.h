@@ -0,0 +1,100 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/aurora/staticbatch.h
+ *  Static geometry of several models, merged into few large buffers.
+ */
+
+#ifndef GRAPHICS_AURORA_STATICBATCH_H
+#define GRAPHICS_AURORA_STATICBATCH_H
+
+#include <vector>
+#include <list>
+
+#include "common/transmatrix.h"
+
+#include "graphics/aurora/model.h"
+
+namespace Graphics {
+
+namespace Aurora {
+
+/** Static geometry of several models, merged into few large buffers.
+ *
+ *  All opaque geometry of the added models that is never moved by an
+ *  animation is pre-transformed into world space. Geometry sharing the
+ *  same textures and vertex layout is then combined into a single node,
+ *  drawn with a single call. The merged nodes are hidden in their source
+ *  models and lose their own geometry, buffer objects included. The source
+ *  models keep rendering everything animated or transparent.
+ *
+ *  The source models must not be moved after they were added.
+ */
+class StaticBatch : public Model {
+public:
+	StaticBatch();
+	~StaticBatch();
+
+	/** Add the static geometry of this model to the batch.
+	 *
+	 *  @return The number of the model's nodes that can be merged.
+	 */
+	uint32 add(Model &model);
+
+	/** Merge the geometry of all added models, and hide and empty their merged nodes. */
+	void build();
+
+	/** Return the number of merged nodes, each drawn with one call. */
+	uint32 getBatchCount() const;
+
+private:
+	/** A node whose geometry is to be merged. */
+	struct Source {
+		ModelNode *node; ///< The node.
+
+		/** The node's transformation into the batch's space. */
+		Common::TransformationMatrix transform;
+	};
+
+	/** All nodes sharing the same textures and vertex layout. */
+	struct Batch {
+		std::vector<Source> sources;
+
+		uint32 vertexCount; ///< Number of vertices in all sources.
+		uint32 indexCount;  ///< Number of indices in all sources.
+	};
+
+	std::list<Batch> _batches;
+
+	/** Can the geometry of this node be merged at all? */
+	static bool canMerge(const ModelNode &node);
+
+	/** Find the batch this node fits into, creating a new one if necessary. */
+	Batch &findBatch(const ModelNode &node);
+
+	/** Create a node holding the merged geometry of a batch. */
+	ModelNode *createNode(const Batch &batch);
+};
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_AURORA_STATICBATCH_H
@@ -33,9 +33,14 @@ namespace Graphics {
 
 namespace Aurora {
 
+Text::QuadBatch::QuadBatch(int32 p) : page(p) {
+}
+
+
 Text::Text(const FontHandle &font, const Common::UString &str,
 		float r, float g, float b, float a, float align) :
-	_r(r), _g(g), _b(b), _a(a), _font(font), _x(0.0), _y(0.0), _align(align) {
+	_r(r), _g(g), _b(b), _a(a), _font(font), _x(0.0), _y(0.0), _align(align),
+	_cacheLayout(true) {
 
 	set(str);
 
@@ -55,11 +60,15 @@ void Text::set(const Common::UString &str, float maxWidth, float maxHeight) {
 
 	font.buildChars(str);
 
-	_lineCount = font.getLineCount(_str, maxWidth, maxHeight);
+	font.layout(_str, _layout, maxWidth, maxHeight, _cacheLayout);
+
+	_lineCount = _layout.lines.size();
 
 	_height = font.getHeight(_str, maxWidth, maxHeight);
 	_width  = font.getWidth (_str, maxWidth);
 
+	buildQuads();
+
 	GfxMan.unlockFrame();
 }
 
@@ -78,6 +87,8 @@ void Text::setColor(float r, float g, float b, float a) {
 	_b = b;
 	_a = a;
 
+	buildQuads();
+
 	GfxMan.unlockFrame();
 }
 
@@ -86,7 +97,17 @@ void Text::unsetColor() {
 }
 
 void Text::setAlign(float align) {
+	GfxMan.lockFrame();
+
 	_align = align;
+
+	buildQuads();
+
+	GfxMan.unlockFrame();
+}
+
+void Text::setCacheLayout(bool cacheLayout) {
+	_cacheLayout = cacheLayout;
 }
 
 const Common::UString &Text::get() const {
@@ -137,7 +158,35 @@ void Text::render(RenderPass pass) {
 
 	glTranslatef(_x, _y, 0.0);
 
-	_font.getFont().draw(_str, _colors, _r, _g, _b, _a, _align, _width, _height);
+	if (_batches.empty())
+		return;
+
+	const Font &font = _font.getFont();
+
+	glClientActiveTextureARB(GL_TEXTURE0);
+
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	for (std::vector<QuadBatch>::const_iterator b = _batches.begin(); b != _batches.end(); ++b) {
+		font.setPage(b->page);
+
+		glVertexPointer  (2, GL_FLOAT, 0, &b->vertices[0]);
+		glTexCoordPointer(2, GL_FLOAT, 0, &b->texCoords[0]);
+		glColorPointer   (4, GL_FLOAT, 0, &b->colors[0]);
+
+		const uint32 vertexCount = b->vertices.size() / 2;
+
+		glDrawArrays(GL_QUADS, 0, vertexCount);
+		GfxMan.countDrawCall(vertexCount / 2);
+	}
+
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+
+	glColor4f(1.0, 1.0, 1.0, 1.0);
 }
 
 bool Text::isIn(float x, float y) const {
@@ -150,6 +199,70 @@ bool Text::isIn(float x, float y) const {
 	return true;
 }
 
+void Text::buildQuads() {
+	_batches.clear();
+
+	const Font &font = _font.getFont();
+
+	const float lineHeight = font.getHeight() + font.getLineSpacing();
+
+	float r = _r, g = _g, b = _b, a = _a;
+
+	ColorPositions::const_iterator color = _colors.begin();
+
+	// Counting characters like the color positions do, with one '\n' after each line
+	uint32 position = 0;
+
+	// The top line first
+	float y = (((float) _layout.lines.size()) - 1.0) * lineHeight;
+
+	for (uint32 i = 0; i < _layout.lines.size(); i++, y -= lineHeight, position++) {
+		const Common::UString &line = _layout.lines[i];
+
+		float x = roundf((_width - _layout.lineWidths[i]) * _align);
+
+		for (Common::UString::iterator c = line.begin(); c != line.end(); ++c, position++) {
+			while ((color != _colors.end()) && (color->position <= position)) {
+				if (color->defaultColor) {
+					r = _r; g = _g; b = _b; a = _a;
+				} else {
+					r = color->r; g = color->g; b = color->b; a = color->a;
+				}
+
+				++color;
+			}
+
+			CharQuad quad;
+			font.getQuad(*c, quad);
+
+			// Find the batch for this page. Fonts only have a handful of pages
+			std::vector<QuadBatch>::iterator batch = _batches.begin();
+			while ((batch != _batches.end()) && (batch->page != quad.page))
+				++batch;
+
+			if (batch == _batches.end()) {
+				_batches.push_back(QuadBatch(quad.page));
+				batch = _batches.end() - 1;
+			}
+
+			for (int j = 0; j < 4; j++) {
+				batch->vertices.push_back(x + quad.vX[j]);
+				batch->vertices.push_back(y + quad.vY[j]);
+
+				batch->texCoords.push_back(quad.tX[j]);
+				batch->texCoords.push_back(quad.tY[j]);
+
+				batch->colors.push_back(r);
+				batch->colors.push_back(g);
+				batch->colors.push_back(b);
+				batch->colors.push_back(a);
+			}
+
+			x += quad.advance;
+		}
+	}
+}
+
 void Text::parseColors(const Common::UString &str, Common::UString &parsed,
                        ColorPositions &colors) {
 
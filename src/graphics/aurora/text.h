@@ -25,10 +25,13 @@
 #ifndef GRAPHICS_AURORA_TEXT_H
 #define GRAPHICS_AURORA_TEXT_H
 
+#include <vector>
+
 #include "common/ustring.h"
 #include "common/maths.h"
 
 #include "graphics/types.h"
+#include "graphics/font.h"
 #include "graphics/guifrontelement.h"
 
 #include "graphics/aurora/fontman.h"
@@ -54,6 +57,9 @@ public:
 	void unsetColor();
 	void setAlign(float align);
 
+	/** Should the layout of this text be remembered by the font? */
+	void setCacheLayout(bool cacheLayout);
+
 	bool isEmpty();
 
 	uint getLineCount() const;
@@ -67,6 +73,17 @@ public:
 	bool isIn(float x, float y) const;
 
 private:
+	/** All quads of the text on one of the font's pages, ready to be drawn in one go. */
+	struct QuadBatch {
+		int32 page;
+
+		std::vector<float> vertices;  ///< 2 coordinates per vertex.
+		std::vector<float> texCoords; ///< 2 coordinates per vertex.
+		std::vector<float> colors;    ///< RGBA per vertex.
+
+		QuadBatch(int32 p = -1);
+	};
+
 	float _r, _g, _b, _a;
 	FontHandle _font;
 
@@ -80,12 +97,21 @@ private:
 
 	float _align;
 
+	bool _cacheLayout; ///< Use the font's layout cache?
+
 	Common::UString _str;
 	ColorPositions  _colors;
 
+	TextLayout _layout;
+
+	std::vector<QuadBatch> _batches;
+
 
 	void parseColors(const Common::UString &str, Common::UString &parsed,
 	                 ColorPositions &colors);
+
+	/** Build the quads of all characters out of the current layout. */
+	void buildQuads();
 };
 
 } // End of namespace Aurora
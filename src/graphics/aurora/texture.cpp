@@ -26,8 +26,11 @@
 #include "common/util.h"
 #include "common/error.h"
 #include "common/stream.h"
+#include "common/configman.h"
 
 #include "graphics/aurora/texture.h"
+#include "graphics/aurora/textureman.h"
+#include "graphics/aurora/texturecache.h"
 
 #include "graphics/types.h"
 #include "graphics/graphics.h"
@@ -49,19 +52,31 @@ namespace Graphics {
 
 namespace Aurora {
 
-Texture::Texture(const Common::UString &name) : _textureID(0),
-	_type(::Aurora::kFileTypeNone), _image(0), _txi(0), _width(0), _height(0) {
+Texture::Texture(const Common::UString &name, bool deferred) : _textureID(0),
+	_type(::Aurora::kFileTypeNone), _image(0), _txi(0), _width(0), _height(0), _hasAlpha(false),
+	_imageStream(0), _deferred(deferred), _loaded(false), _loadCondition(_loadMutex),
+	_memorySize(0), _lastUsed(0), _evicted(false) {
 
 	_txi = new TXI();
 
-	load(name);
+	if (deferred) {
+		open(name);
+	} else {
+		load(name);
+		_loaded = true;
+	}
 
 	addToQueue(kQueueTexture);
-	addToQueue(kQueueNewTexture);
+
+	// A deferred texture is uploaded once its image is decoded
+	if (!deferred)
+		addToQueue(kQueueNewTexture);
 }
 
 Texture::Texture(ImageDecoder *image, const TXI *txi) : _textureID(0),
-	_type(::Aurora::kFileTypeNone), _image(0), _txi(0), _width(0), _height(0) {
+	_type(::Aurora::kFileTypeNone), _image(0), _txi(0), _width(0), _height(0), _hasAlpha(false),
+	_imageStream(0), _deferred(false), _loaded(true), _loadCondition(_loadMutex),
+	_memorySize(0), _lastUsed(0), _evicted(false) {
 
 	if (txi)
 		_txi = new TXI(*txi);
@@ -75,12 +90,20 @@ Texture::Texture(ImageDecoder *image, const TXI *txi) : _textureID(0),
 }
 
 Texture::~Texture() {
+	// Make sure nobody is still decoding our image
+	if (_deferred && !isLoaded())
+		TextureMan.cancelDeferred(*this);
+
 	removeFromQueue(kQueueNewTexture);
 	removeFromQueue(kQueueTexture);
 
+	TextureMan.cancelRestore(*this);
+	TextureMan.setResidentSize(*this, 0);
+
 	if (_textureID != 0)
 		GfxMan.abandon(&_textureID, 1);
 
+	delete _imageStream;
 	delete _txi;
 	delete _image;
 }
@@ -90,47 +113,163 @@ TextureID Texture::getID() const {
 }
 
 uint32 Texture::getWidth() const {
+	waitLoaded();
+
 	return _width;
 }
 
 uint32 Texture::getHeight() const {
+	waitLoaded();
+
 	return _height;
 }
 
 bool Texture::hasAlpha() const {
-	if (!_image)
-		return false;
+	waitLoaded();
 
-	return _image->hasAlpha();
+	return _hasAlpha;
 }
 
 void Texture::load(const Common::UString &name) {
-	Common::SeekableReadStream *img = ResMan.getResource(::Aurora::kResourceImage, name, &_type);
-	if (!img)
+	open(name);
+	decode();
+}
+
+void Texture::open(const Common::UString &name) {
+	_imageStream = ResMan.getResource(::Aurora::kResourceImage, name, &_type);
+	if (!_imageStream)
 		throw Common::Exception("No such image resource \"%s\"", name.c_str());
 
 	_name = name;
 
-	// Loading the different image formats
-	if      (_type == ::Aurora::kFileTypeTGA)
-		_image = new TGA(*img);
-	else if (_type == ::Aurora::kFileTypeDDS)
-		_image = new DDS(*img);
-	else if (_type == ::Aurora::kFileTypeTPC)
-		_image = new TPC(*img);
-	else if (_type == ::Aurora::kFileTypeTXB)
-		_image = new TXB(*img);
-	else if (_type == ::Aurora::kFileTypeSBM)
-		_image = new SBM(*img);
-	else {
-		delete img;
+	if ((_type != ::Aurora::kFileTypeTGA) && (_type != ::Aurora::kFileTypeDDS) &&
+	    (_type != ::Aurora::kFileTypeTPC) && (_type != ::Aurora::kFileTypeTXB) &&
+	    (_type != ::Aurora::kFileTypeSBM)) {
+
+		delete _imageStream;
+		_imageStream = 0;
+
 		throw Common::Exception("Unsupported image resource type %d", (int) _type);
 	}
 
+	loadTXI(ResMan.getResource(name, ::Aurora::kFileTypeTXI));
+}
+
+void Texture::decode() {
+	Common::SeekableReadStream *img = _imageStream;
+	_imageStream = 0;
+
+	const bool useCache = TextureCache::isEnabled();
+
+	uint64 hash = 0;
+	if (useCache) {
+		hash = TextureCache::hashResource(*img);
+
+		uint32 options;
+		if ((_image = TextureCache::load(_name, hash, options))) {
+			loadImage();
+
+			// The TXI, possibly the one within the image, and the config decide the mip maps
+			if (options == getMipMapOptions()) {
+				delete img;
+				return;
+			}
+
+			delete _image;
+			_image = 0;
+		}
+	}
+
+	try {
+		// Loading the different image formats
+		if      (_type == ::Aurora::kFileTypeTGA)
+			_image = new TGA(*img);
+		else if (_type == ::Aurora::kFileTypeDDS)
+			_image = new DDS(*img);
+		else if (_type == ::Aurora::kFileTypeTPC)
+			_image = new TPC(*img);
+		else if (_type == ::Aurora::kFileTypeTXB)
+			_image = new TXB(*img);
+		else if (_type == ::Aurora::kFileTypeSBM)
+			_image = new SBM(*img);
+	} catch (...) {
+		delete img;
+		throw;
+	}
+
 	delete img;
 
-	loadTXI(ResMan.getResource(name, ::Aurora::kFileTypeTXI));
 	loadImage();
+
+	// Only for image resources: Images we're given, like font pages, can still change
+	generateMipMaps();
+
+	// Cache the image with all its mip maps, exactly as it's going to be uploaded
+	if (useCache)
+		TextureCache::save(_name, hash, getMipMapOptions(), *_image);
+}
+
+bool Texture::loadDeferred() {
+	if (isLoaded())
+		return _image != 0;
+
+	bool failed = false;
+
+	try {
+		decode();
+	} catch (Common::Exception &e) {
+		e.add("Failed loading texture \"%s\"", _name.c_str());
+		Common::printException(e, "WARNING: ");
+
+		failed = true;
+	} catch (...) {
+		warning("Failed loading texture \"%s\"", _name.c_str());
+
+		failed = true;
+	}
+
+	if (failed) {
+		delete _image;
+		_image = 0;
+
+		_width  = 0;
+		_height = 0;
+	}
+
+	// Upload the image with the next frame
+	addToQueue(kQueueNewTexture);
+
+	// We might get deleted as soon as we're marked as loaded
+	setLoaded();
+
+	return !failed;
+}
+
+uint32 Texture::getDeferredSize() const {
+	if (!_imageStream)
+		return 0;
+
+	return _imageStream->size();
+}
+
+bool Texture::isLoaded() const {
+	Common::StackLock lock(_loadMutex);
+
+	return _loaded;
+}
+
+void Texture::waitLoaded() const {
+	Common::StackLock lock(_loadMutex);
+
+	while (!_loaded)
+		_loadCondition.wait();
+}
+
+void Texture::setLoaded() {
+	Common::StackLock lock(_loadMutex);
+
+	_loaded = true;
+	_loadCondition.broadcast();
 }
 
 void Texture::load(ImageDecoder *image) {
@@ -161,6 +300,8 @@ void Texture::loadImage() {
 	if (!_image) {
 		_width  = 0;
 		_height = 0;
+
+		_hasAlpha = false;
 		return;
 	}
 
@@ -175,10 +316,45 @@ void Texture::loadImage() {
 	_width  = _image->getMipMap(0).width;
 	_height = _image->getMipMap(0).height;
 
+	_hasAlpha = _image->hasAlpha();
+
+	// An evicted texture already has its TXI, and others might be holding on to it
+	if (_evicted)
+		return;
+
 	// If we've still got no TXI, look if the image provides TXI data
 	loadTXI(_image->getTXI());
 }
 
+uint32 Texture::getMipMapOptions() const {
+	// Without filtering, the mip maps are never used
+	const TXI::Features &features = _txi->getFeatures();
+	if (!features.mipMap || !features.filter)
+		return 0;
+
+	uint32 options = TextureCache::kOptionMipMaps;
+
+	if (ConfigMan.getString("mipmapfilter", "kaiser") == "box")
+		options |= TextureCache::kOptionBoxFilter;
+
+	// Bump maps don't hold colors
+	if (!features.isBumpMap && ConfigMan.getBool("mipmapgamma", true))
+		options |= TextureCache::kOptionGammaCorrect;
+
+	return options;
+}
+
+void Texture::generateMipMaps() {
+	const uint32 options = getMipMapOptions();
+	if (!(options & TextureCache::kOptionMipMaps))
+		return;
+
+	const MipMapFilter filter = (options & TextureCache::kOptionBoxFilter) ?
+		kMipMapFilterBox : kMipMapFilterKaiser;
+
+	_image->generateMipMaps(filter, (options & TextureCache::kOptionGammaCorrect) != 0);
+}
+
 void Texture::doDestroy() {
 	if (_textureID == 0)
 		return;
@@ -186,10 +362,12 @@ void Texture::doDestroy() {
 	glDeleteTextures(1, &_textureID);
 
 	_textureID = 0;
+
+	TextureMan.setResidentSize(*this, 0);
 }
 
 void Texture::doRebuild() {
-	if (!_image)
+	if (!isLoaded() || !_image)
 		// No image
 		return;
 
@@ -253,13 +431,87 @@ void Texture::doRebuild() {
 
 	}
 
+	uint32 memorySize = 0;
+	for (uint32 i = 0; i < _image->getMipMapCount(); i++)
+		memorySize += _image->getMipMap(i).size;
+
+	// The generated mip maps add about another third
+	if (_image->getMipMapCount() == 1)
+		memorySize += memorySize / 3;
+
+	// Don't evict what was just uploaded
+	_lastUsed = GfxMan.getFrameNumber();
+	_evicted  = false;
+
+	TextureMan.setResidentSize(*this, memorySize);
+}
+
+void Texture::evict() {
+	if ((_textureID == 0) || _evicted || !isLoaded())
+		return;
+
+	GfxMan.abandon(&_textureID, 1);
+	_textureID = 0;
+
+	_evicted = true;
+
+	// An image resource can be read and decoded again, so we can drop the image as well
+	if (canReload()) {
+		delete _image;
+		_image = 0;
+	}
+
+	TextureMan.setResidentSize(*this, 0);
+}
+
+bool Texture::restore() {
+	if (!_evicted || !isLoaded() || isInQueue(kQueueNewTexture))
+		return false;
+
+	if (_image) {
+		addToQueue(kQueueNewTexture);
+		return true;
+	}
+
+	// Read the image resource again, and decode it like a deferred texture
+	_imageStream = ResMan.getResource(::Aurora::kResourceImage, _name, &_type);
+	if (!_imageStream) {
+		warning("Failed restoring texture \"%s\": No such image resource", _name.c_str());
+
+		_evicted = false;
+		return false;
+	}
+
+	{
+		Common::StackLock lock(_loadMutex);
+
+		_loaded   = false;
+		_deferred = true;
+	}
+
+	if (!TextureMan.queueDeferred(*this))
+		loadDeferred();
+
+	return true;
+}
+
+bool Texture::canReload() const {
+	return (_type != ::Aurora::kFileTypeNone) && !_name.empty();
+}
+
+uint32 Texture::getMemorySize() const {
+	return _memorySize;
 }
 
 const TXI &Texture::getTXI() const {
+	waitLoaded();
+
 	return *_txi;
 }
 
 bool Texture::reload(ImageDecoder *image, const TXI *txi) {
+	waitLoaded();
+
 	removeFromQueue(kQueueNewTexture);
 	removeFromQueue(kQueueTexture);
 
@@ -270,6 +522,9 @@ bool Texture::reload(ImageDecoder *image, const TXI *txi) {
 
 	delete _image;
 
+	// We were given this image, we can't read it again on our own
+	_type = ::Aurora::kFileTypeNone;
+
 	load(image);
 
 	addToQueue(kQueueTexture);
@@ -279,6 +534,8 @@ bool Texture::reload(ImageDecoder *image, const TXI *txi) {
 }
 
 bool Texture::reload(const Common::UString &name) {
+	waitLoaded();
+
 	if (!name.empty())
 		_name = name;
 
@@ -303,6 +560,8 @@ bool Texture::reload(const Common::UString &name) {
 }
 
 bool Texture::dumpTGA(const Common::UString &fileName) const {
+	waitLoaded();
+
 	if (!_image)
 		return false;
 
@@ -26,6 +26,7 @@
 #define GRAPHICS_AURORA_TEXTURE_H
 
 #include "common/ustring.h"
+#include "common/mutex.h"
 
 #include "graphics/types.h"
 #include "graphics/texture.h"
@@ -46,8 +47,12 @@ namespace Aurora {
 /** A texture. */
 class Texture : public Graphics::Texture {
 public:
-	/** Create a texture from this image resource. */
-	Texture(const Common::UString &name);
+	/** Create a texture from this image resource.
+	 *
+	 *  If deferred, the image resource is only opened, and loadDeferred()
+	 *  has to be called, possibly from another thread, to decode it.
+	 */
+	Texture(const Common::UString &name, bool deferred = false);
 	/** Take over the image and create a texture from it. */
 	Texture(ImageDecoder *image, const TXI *txi = 0);
 	~Texture();
@@ -68,6 +73,20 @@ public:
 	/** Dump the texture into a TGA. */
 	bool dumpTGA(const Common::UString &fileName) const;
 
+	/** Has the texture's image been decoded yet? */
+	bool isLoaded() const;
+	/** Wait until the texture's image has been decoded. */
+	void waitLoaded() const;
+
+	/** Decode the image of a deferred texture. Returns false if that failed. */
+	bool loadDeferred();
+
+	/** Return the size of the image resource a deferred texture still has to decode. */
+	uint32 getDeferredSize() const;
+
+	/** Return the size of the texture in GL memory, all mip maps included. */
+	uint32 getMemorySize() const;
+
 protected:
 	// GLContainer
 	void doRebuild();
@@ -86,12 +105,54 @@ private:
 	uint32 _width;
 	uint32 _height;
 
+	bool _hasAlpha; ///< Does the image have an alpha channel?
+
+	/** The image resource a deferred texture still has to decode. */
+	Common::SeekableReadStream *_imageStream;
+
+	bool _deferred; ///< Was the texture created deferred?
+	bool _loaded;   ///< Has the image been decoded?
+
+	mutable Common::Mutex     _loadMutex;     ///< Mutex protecting _loaded.
+	mutable Common::Condition _loadCondition; ///< Signaled when the image has been decoded.
+
+	uint32 _memorySize; ///< Size of the texture in GL memory.
+	uint32 _lastUsed;   ///< Number of the frame the texture was last used in.
+	bool   _evicted;    ///< Was the texture dropped from memory, to be restored on use?
+
 	void load(const Common::UString &name);
 	void load(ImageDecoder *image);
 
+	void open(const Common::UString &name);
+	void decode();
+
+	void setLoaded();
+
+	/** Drop the texture from GL memory.
+	 *
+	 *  If the image was read from an image resource, it's dropped as well.
+	 */
+	void evict();
+	/** Queue an evicted texture to be uploaded again with the next frame.
+	 *
+	 *  If the image was dropped, the image resource is read again and
+	 *  decoded like a deferred texture first.
+	 *
+	 *  Returns false if it was already queued.
+	 */
+	bool restore();
+
+	/** Can the image be read again from the image resource? */
+	bool canReload() const;
+
 	void loadTXI(Common::SeekableReadStream *stream);
 	void loadImage();
 
+	/** Return how generateMipMaps() would treat the image, as TextureCache::Options. */
+	uint32 getMipMapOptions() const;
+	/** Create the missing mip maps of the image on the CPU. */
+	void generateMipMaps();
+
 	TextureID getID() const;
 
 	friend class TextureManager;
@@ -0,0 +1,333 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/aurora/texturecache.cpp
+ *  A cache of decoded texture images on disk.
+ */
+
+#include <vector>
+
+#include "common/util.h"
+#include "common/error.h"
+#include "common/stream.h"
+#include "common/file.h"
+#include "common/filepath.h"
+#include "common/configman.h"
+
+#include "graphics/graphics.h"
+
+#include "graphics/images/decoder.h"
+
+#include "graphics/aurora/texturecache.h"
+
+static const uint32 kXTCID      = MKTAG('X', 'T', 'C', ' ');
+static const uint32 kXTCVersion = 2;
+
+/** Option flag of images whose S3TC compression was undone for the GL. */
+static const uint32 kOptionDeS3TC = 0x80000000;
+
+/** Size of the fixed part of the header. */
+static const uint32 kHeaderSize = 48;
+/** Size of each mip map's entry in the header. */
+static const uint32 kMipMapEntrySize = 16;
+
+/** All mip maps start at a multiple of this. */
+static const uint32 kDataAlignment = 16;
+
+namespace Graphics {
+
+namespace Aurora {
+
+/** An image read from the texture cache. */
+class CachedImage : public ImageDecoder {
+public:
+	CachedImage(Common::SeekableReadStream &cache);
+	~CachedImage();
+
+	Common::SeekableReadStream *getTXI() const;
+
+private:
+	std::vector<byte> _txi;
+};
+
+CachedImage::CachedImage(Common::SeekableReadStream &cache) {
+	cache.seek(24);
+
+	_compressed = cache.readByte() != 0;
+	_hasAlpha   = cache.readByte() != 0;
+
+	cache.skip(2);
+
+	_format    = (PixelFormat)    cache.readUint32LE();
+	_formatRaw = (PixelFormatRaw) cache.readUint32LE();
+	_dataType  = (PixelDataType)  cache.readUint32LE();
+
+	const uint32 mipMapCount = cache.readUint32LE();
+	const uint32 txiSize     = cache.readUint32LE();
+
+	if ((mipMapCount == 0) || (mipMapCount > 32))
+		throw Common::Exception("Invalid number of mip maps (%u)", mipMapCount);
+
+	std::vector<uint32> offsets;
+
+	offsets.resize(mipMapCount);
+	_mipMaps.resize(mipMapCount, 0);
+
+	for (uint32 i = 0; i < mipMapCount; i++) {
+		_mipMaps[i] = new MipMap;
+
+		_mipMaps[i]->width  = cache.readUint32LE();
+		_mipMaps[i]->height = cache.readUint32LE();
+		_mipMaps[i]->size   = cache.readUint32LE();
+
+		offsets[i] = cache.readUint32LE();
+
+		if ((offsets[i] > (uint32) cache.size()) || (_mipMaps[i]->size > ((uint32) cache.size() - offsets[i])))
+			throw Common::Exception("Mip map %u out of bounds", i);
+	}
+
+	if (txiSize > 0) {
+		_txi.resize(txiSize);
+
+		if (cache.read(&_txi[0], txiSize) != txiSize)
+			throw Common::Exception(Common::kReadError);
+	}
+
+	// Read the mip maps straight into place
+	for (uint32 i = 0; i < mipMapCount; i++) {
+		_mipMaps[i]->data = new byte[_mipMaps[i]->size];
+
+		if (!cache.seek(offsets[i]) || (cache.read(_mipMaps[i]->data, _mipMaps[i]->size) != _mipMaps[i]->size))
+			throw Common::Exception(Common::kReadError);
+	}
+}
+
+CachedImage::~CachedImage() {
+}
+
+Common::SeekableReadStream *CachedImage::getTXI() const {
+	if (_txi.empty())
+		return 0;
+
+	return new Common::MemoryReadStream(&_txi[0], _txi.size());
+}
+
+
+bool TextureCache::isEnabled() {
+	return ConfigMan.getBool("texturecache", false);
+}
+
+uint64 TextureCache::hashResource(Common::SeekableReadStream &stream) {
+	const uint32 pos = stream.pos();
+
+	stream.seek(0);
+
+	// 64bit Fowler–Noll–Vo hash over the whole resource
+	uint64 hash = 0xCBF29CE484222325LL;
+
+	byte buffer[4096];
+
+	uint32 n;
+	while ((n = stream.read(buffer, sizeof(buffer))) > 0)
+		for (uint32 i = 0; i < n; i++)
+			hash = (hash ^ buffer[i]) * 1099511628211LL;
+
+	hash ^= stream.size();
+
+	stream.seek(pos);
+
+	return hash;
+}
+
+Common::UString TextureCache::getDirectory() {
+	Common::UString dir = ConfigMan.getString("texturecachedir");
+	if (dir.empty()) {
+		dir = Common::FilePath::getDirectory(ConfigMan.getConfigFile());
+		dir = dir.empty() ? "texturecache" : (dir + "/texturecache");
+	}
+
+	// Different games have different textures of the same name
+	const Common::UString game = ConfigMan.getGameID();
+	if (!game.empty())
+		dir += "/" + sanitize(game);
+
+	return dir;
+}
+
+Common::UString TextureCache::sanitize(const Common::UString &name) {
+	Common::UString safe;
+	for (Common::UString::iterator c = name.begin(); c != name.end(); ++c) {
+		if (Common::UString::isAlNum(*c) || (*c == '_') || (*c == '-'))
+			safe += Common::UString::tolower(*c);
+		else
+			safe += '_';
+	}
+
+	return safe;
+}
+
+Common::UString TextureCache::getFileName(const Common::UString &name) {
+	return getDirectory() + "/" + sanitize(name) + ".xtc";
+}
+
+ImageDecoder *TextureCache::load(const Common::UString &name, uint64 hash, uint32 &options) {
+	const Common::UString fileName = getFileName(name);
+
+	Common::File cache;
+	if (!Common::FilePath::isRegularFile(fileName) || !cache.open(fileName))
+		return 0;
+
+	if ((uint32) cache.size() < kHeaderSize)
+		return 0;
+
+	// Outdated or foreign cache files are silently replaced
+
+	if ((cache.readUint32BE() != kXTCID) || (cache.readUint32LE() != kXTCVersion))
+		return 0;
+	if (cache.readUint64LE() != hash)
+		return 0;
+
+	// A truncated cache file
+	if (cache.readUint32LE() != (uint32) cache.size())
+		return 0;
+
+	options = cache.readUint32LE();
+
+	// The cache file was written for a GL with a different S3TC support
+	if (((options & kOptionDeS3TC) != 0) != GfxMan.needManualDeS3TC())
+		return 0;
+
+	options &= ~kOptionDeS3TC;
+
+	ImageDecoder *image = 0;
+	try {
+		image = new CachedImage(cache);
+	} catch (Common::Exception &e) {
+		delete image;
+
+		e.add("Failed reading cached texture \"%s\"", fileName.c_str());
+		Common::printException(e, "WARNING: ");
+
+		return 0;
+	}
+
+	return image;
+}
+
+bool TextureCache::save(const Common::UString &name, uint64 hash, uint32 options, const ImageDecoder &image) {
+	const uint32 mipMapCount = image.getMipMapCount();
+	if (mipMapCount == 0)
+		return false;
+
+	const Common::UString dir = getDirectory();
+	if (!Common::FilePath::isDirectory(dir) && !Common::FilePath::createDirectories(dir)) {
+		warning("Can't create the texture cache directory \"%s\"", dir.c_str());
+		return false;
+	}
+
+	Common::SeekableReadStream *txi = image.getTXI();
+	const uint32 txiSize = txi ? txi->size() : 0;
+
+	// Lay out the mip maps after the header and the TXI
+	std::vector<uint32> offsets;
+	offsets.resize(mipMapCount);
+
+	uint32 offset = kHeaderSize + mipMapCount * kMipMapEntrySize + txiSize;
+	for (uint32 i = 0; i < mipMapCount; i++) {
+		offset = (offset + kDataAlignment - 1) & ~(kDataAlignment - 1);
+
+		offsets[i] = offset;
+		offset    += image.getMipMap(i).size;
+	}
+
+	if (GfxMan.needManualDeS3TC())
+		options |= kOptionDeS3TC;
+
+	/* Write into a temporary file first, and only move it into place when
+	 * it's complete. That way, a crash or another instance of the game never
+	 * sees a half-written cache file. */
+	const Common::UString fileName = getFileName(name);
+	const Common::UString tempName = fileName + ".tmp";
+
+	Common::DumpFile cache;
+	if (!cache.open(tempName)) {
+		delete txi;
+		return false;
+	}
+
+	cache.writeUint32BE(kXTCID);
+	cache.writeUint32LE(kXTCVersion);
+	cache.writeUint64LE(hash);
+	cache.writeUint32LE(offset);
+	cache.writeUint32LE(options);
+
+	cache.writeByte(image.isCompressed() ? 1 : 0);
+	cache.writeByte(image.hasAlpha()     ? 1 : 0);
+	cache.writeUint16LE(0);
+
+	cache.writeUint32LE((uint32) image.getFormat());
+	cache.writeUint32LE((uint32) image.getFormatRaw());
+	cache.writeUint32LE((uint32) image.getDataType());
+
+	cache.writeUint32LE(mipMapCount);
+	cache.writeUint32LE(txiSize);
+
+	for (uint32 i = 0; i < mipMapCount; i++) {
+		const ImageDecoder::MipMap &mipMap = image.getMipMap(i);
+
+		cache.writeUint32LE(mipMap.width);
+		cache.writeUint32LE(mipMap.height);
+		cache.writeUint32LE(mipMap.size);
+		cache.writeUint32LE(offsets[i]);
+	}
+
+	if (txi) {
+		cache.writeStream(*txi);
+		delete txi;
+	}
+
+	uint32 pos = kHeaderSize + mipMapCount * kMipMapEntrySize + txiSize;
+	for (uint32 i = 0; i < mipMapCount; i++) {
+		for (; pos < offsets[i]; pos++)
+			cache.writeByte(0);
+
+		const ImageDecoder::MipMap &mipMap = image.getMipMap(i);
+
+		cache.write(mipMap.data, mipMap.size);
+		pos += mipMap.size;
+	}
+
+	const bool written = cache.flush() && !cache.err();
+
+	cache.close();
+
+	if (!written || !Common::FilePath::rename(tempName, fileName)) {
+		warning("Failed writing cached texture \"%s\"", fileName.c_str());
+
+		Common::FilePath::remove(tempName);
+		return false;
+	}
+
+	return true;
+}
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
@@ -0,0 +1,106 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/aurora/texturecache.h
+ *  A cache of decoded texture images on disk.
+ */
+
+#ifndef GRAPHICS_AURORA_TEXTURECACHE_H
+#define GRAPHICS_AURORA_TEXTURECACHE_H
+
+#include "common/types.h"
+#include "common/ustring.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Graphics {
+
+class ImageDecoder;
+
+namespace Aurora {
+
+/** A cache of decoded texture images on disk.
+ *
+ *  Each texture image is stored exactly as it is uploaded: decoded, with
+ *  a complete mip map chain and, if the GL can't handle S3TC, already
+ *  decompressed. Every mip map starts at an aligned offset, so loading
+ *  an image from the cache is a plain read without any further parsing.
+ *
+ *  A cached image is tagged with a hash of the image resource it was
+ *  decoded from and with the options it was decoded with, and is ignored
+ *  once either changes.
+ *
+ *  The cache is enabled with the config option "texturecache". It lives
+ *  in the directory "texturecachedir", by default a "texturecache"
+ *  directory next to the config file, with a subdirectory for each game.
+ */
+class TextureCache {
+public:
+	/** How an image was decoded, on top of what its resource holds. */
+	enum Option {
+		kOptionMipMaps      = 1 << 0, ///< The mip maps were generated.
+		kOptionBoxFilter    = 1 << 1, ///< The mip maps were filtered with a box instead of a Kaiser filter.
+		kOptionGammaCorrect = 1 << 2  ///< The mip maps were filtered in linear space.
+	};
+
+	/** Is the texture cache enabled? */
+	static bool isEnabled();
+
+	/** Hash the image resource a texture is decoded from. */
+	static uint64 hashResource(Common::SeekableReadStream &stream);
+
+	/** Load the cached image of a texture.
+	 *
+	 *  The caller has to check that the options the image was decoded
+	 *  with are still the ones it would be decoded with now.
+	 *
+	 *  @param  name The name of the texture.
+	 *  @param  hash The hash of the texture's image resource.
+	 *  @param  options The Options the cached image was decoded with.
+	 *  @return The cached image, or 0 if there's none or it's outdated.
+	 */
+	static ImageDecoder *load(const Common::UString &name, uint64 hash, uint32 &options);
+
+	/** Save the image of a texture into the cache.
+	 *
+	 *  @param  name The name of the texture.
+	 *  @param  hash The hash of the texture's image resource.
+	 *  @param  options The Options the image was decoded with.
+	 *  @param  image The texture's image, as it is uploaded.
+	 *  @return true if the image was cached.
+	 */
+	static bool save(const Common::UString &name, uint64 hash, uint32 options, const ImageDecoder &image);
+
+private:
+	/** Return the directory the cache of the current game lives in. */
+	static Common::UString getDirectory();
+	/** Turn a name into something safe to use in a path. */
+	static Common::UString sanitize(const Common::UString &name);
+	/** Return the file caching this texture. */
+	static Common::UString getFileName(const Common::UString &name);
+};
+
+} // End of namespace Aurora
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_AURORA_TEXTURECACHE_H
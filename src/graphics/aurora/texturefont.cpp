@@ -63,39 +63,42 @@ float TextureFont::getLineSpacing() const {
 	return _spaceB;
 }
 
-void TextureFont::drawMissing() const {
-	TextureMan.set();
+void TextureFont::getQuad(uint32 c, CharQuad &quad) const {
+	if (c >= _chars.size()) {
+		// Missing character, an untextured box
+		float width = getWidth('m') - _spaceR;
 
-	float width = getWidth('m') - _spaceR;
+		quad.page = -1;
 
-	glBegin(GL_QUADS);
-		glVertex2f(0.0  ,     0.0);
-		glVertex2f(width,     0.0);
-		glVertex2f(width, _height);
-		glVertex2f(0.0  , _height);
-	glEnd();
+		quad.vX[0] = 0.0  ; quad.vY[0] = 0.0;
+		quad.vX[1] = width; quad.vY[1] = 0.0;
+		quad.vX[2] = width; quad.vY[2] = _height;
+		quad.vX[3] = 0.0  ; quad.vY[3] = _height;
 
-	glTranslatef(width + _spaceR, 0.0, 0.0);
-}
+		for (int i = 0; i < 4; i++)
+			quad.tX[i] = quad.tY[i] = 0.0;
 
-void TextureFont::draw(uint32 c) const {
-	if (c >= _chars.size()) {
-		drawMissing();
+		quad.advance = width + _spaceR;
 		return;
 	}
 
-	TextureMan.set(_texture);
-
 	const Char &cC = _chars[c];
 
-	glBegin(GL_QUADS);
+	quad.page = 0;
+
 	for (int i = 0; i < 4; i++) {
-		glTexCoord2f(cC.tX[i], cC.tY[i]);
-		glVertex2f  (cC.vX[i], cC.vY[i]);
+		quad.vX[i] = cC.vX[i]; quad.vY[i] = cC.vY[i];
+		quad.tX[i] = cC.tX[i]; quad.tY[i] = cC.tY[i];
 	}
-	glEnd();
 
-	glTranslatef(cC.width + _spaceR, 0.0, 0.0);
+	quad.advance = cC.width + _spaceR;
+}
+
+void TextureFont::setPage(int32 page) const {
+	if (page < 0)
+		TextureMan.set();
+	else
+		TextureMan.set(_texture);
 }
 
 void TextureFont::load() {
@@ -54,7 +54,8 @@ public:
 
 	float getLineSpacing() const;
 
-	void draw(uint32 c) const;
+	void getQuad(uint32 c, CharQuad &quad) const;
+	void setPage(int32 page) const;
 
 private:
 	/** A font character. */
@@ -73,8 +74,6 @@ private:
 	float _spaceB;
 
 	void load();
-
-	void drawMissing() const;
 };
 
 } // End of namespace Aurora
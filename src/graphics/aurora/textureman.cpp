@@ -22,9 +22,15 @@
  *  The Aurora texture manager.
  */
 
+#include <vector>
+#include <algorithm>
+
 #include "common/util.h"
 #include "common/error.h"
 #include "common/uuid.h"
+#include "common/thread.h"
+#include "common/threads.h"
+#include "common/configman.h"
 
 #include "aurora/resman.h"
 
@@ -33,8 +39,10 @@
 #include "graphics/aurora/pltfile.h"
 
 #include "graphics/graphics.h"
+#include "graphics/glcontainer.h"
 
 #include "events/requests.h"
+#include "events/events.h"
 
 DECLARE_SINGLETON(Graphics::Aurora::TextureManager)
 
@@ -42,9 +50,9 @@ namespace Graphics {
 
 namespace Aurora {
 
-ManagedTexture::ManagedTexture(const Common::UString &name) : reloadable(false) {
+ManagedTexture::ManagedTexture(const Common::UString &name, bool deferred) : reloadable(false) {
 	referenceCount = 0;
-	texture = new Texture(name);
+	texture = new Texture(name, deferred);
 }
 
 ManagedTexture::ManagedTexture(const Common::UString &name, Texture *t) : reloadable(false) {
@@ -56,6 +64,15 @@ ManagedTexture::~ManagedTexture() {
 	delete texture;
 }
 
+Texture &ManagedTexture::getTexture() const {
+	if (!shared.empty())
+		return shared.getTexture();
+
+	assert(texture);
+
+	return *texture;
+}
+
 
 ManagedPLT::ManagedPLT(const Common::UString &name) {
 	referenceCount = 0;
@@ -104,7 +121,7 @@ void TextureHandle::clear() {
 Texture &TextureHandle::getTexture() const {
 	assert(!_empty);
 
-	return *_it->second->texture;
+	return _it->second->getTexture();
 }
 
 
@@ -149,22 +166,126 @@ PLTFile &PLTHandle::getPLT() const {
 }
 
 
-TextureManager::TextureManager() {
+TextureMemoryStatistics::TextureMemoryStatistics() : residentCount(0), residentBytes(0), budget(0),
+	evicted(0), restored(0) {
+
+}
+
+
+PLTStatistics::PLTStatistics() : builds(0), composited(0), shared(0) {
+}
+
+
+TextureStreamStatistics::TextureStreamStatistics() : requested(0), decoded(0), inlined(0), failed(0),
+	inFlight(0), inFlightBytes(0), peakBytes(0), latencyTotal(0), latencyMax(0) {
+
+}
+
+
+/** A thread decoding deferred textures. */
+class TextureManager::StreamWorker : public Common::Thread {
+public:
+	StreamWorker(TextureManager &manager) : _manager(&manager) {
+	}
+
+	~StreamWorker() {
+		destroyThread();
+	}
+
+private:
+	TextureManager *_manager;
+
+	void threadMethod() {
+		while (!_killThread) {
+			StreamJob job;
+			if (_manager->takeDeferred(job))
+				_manager->decodeDeferred(job);
+		}
+	}
+};
+
+
+/** Shows the shared textures of rebuilt PLTs, in the main thread. */
+class TextureManager::PLTSwapper : public GLContainer {
+public:
+	PLTSwapper(TextureManager &manager) : _manager(&manager) {
+	}
+
+protected:
+	void doRebuild() {
+		_manager->swapPLTs();
+	}
+
+	void doDestroy() {
+	}
+
+private:
+	TextureManager *_manager;
+};
+
+
+/** Restores evicted textures and keeps to the texture memory budget, in the main thread. */
+class TextureManager::MemoryKeeper : public GLContainer {
+public:
+	MemoryKeeper(TextureManager &manager) : _manager(&manager) {
+	}
+
+protected:
+	void doRebuild() {
+		_manager->manageMemory();
+	}
+
+	void doDestroy() {
+	}
+
+private:
+	TextureManager *_manager;
+};
+
+
+/** Number of frames between checks of the texture memory budget. */
+static const uint32 kEvictionInterval = 60;
+
+TextureManager::TextureManager() : _pltSwapper(0), _loadDone(_mutex), _streaming(false),
+	_streamMemory(0), _streamJobCount(0), _memoryKeeper(0), _memoryQueued(false), _lastEvictionCheck(0) {
+
+	_pltSwapper   = new PLTSwapper(*this);
+	_memoryKeeper = new MemoryKeeper(*this);
+
+	_streaming = ConfigMan.getBool("texturestreaming", false);
+
+	// In MB
+	_memoryBudget = ((uint64) MAX(ConfigMan.getInt("texturememory", 0), 0)) * 1024 * 1024;
+
+	_unusedFrames = MAX(ConfigMan.getInt("textureunusedframes", 600), 1);
+
+	_memoryStats.budget = _memoryBudget;
 }
 
 TextureManager::~TextureManager() {
 	clear();
+
+	stopStreaming();
+
+	delete _memoryKeeper;
+	delete _pltSwapper;
 }
 
 void TextureManager::clear() {
 	Common::StackLock lock(_mutex);
 
 	_newPLTs.clear();
+	_pltSwaps.clear();
 
 	for (PLTList::iterator p = _plts.begin(); p != _plts.end(); ++p)
 		delete *p;
 	_plts.clear();
 
+	/* Release the shared textures first. This only ever removes the textures
+	 * shared, never the ones sharing them, so the iteration stays valid. */
+	for (TextureMap::iterator t = _textures.begin(); t != _textures.end(); ++t)
+		t->second->shared.clear();
+
 	for (TextureMap::iterator t = _textures.begin(); t != _textures.end(); ++t)
 		delete t->second;
 	_textures.clear();
@@ -198,30 +319,169 @@ TextureHandle TextureManager::add(Texture *texture, Common::UString name) {
 }
 
 TextureHandle TextureManager::get(const Common::UString &name) {
+	{
+		Common::StackLock lock(_mutex);
+
+		if (ResMan.hasResource(name, ::Aurora::kFileTypePLT)) {
+			_plts.push_back(new ManagedPLT(name));
+
+			_newPLTs.push_back(PLTHandle(--_plts.end()));
+
+			return _newPLTs.back().getPLT().getTexture();
+		}
+
+		while (true) {
+			TextureMap::iterator texture = _textures.find(name);
+			if (texture != _textures.end())
+				return TextureHandle(texture);
+
+			if (_pendingLoads.find(name) == _pendingLoads.end())
+				break;
+
+			// Somebody else is already creating this texture, wait for them
+			_loadDone.wait();
+		}
+
+		_pendingLoads.insert(name);
+	}
+
+	// Reading and decoding the image can take a while. Don't block everybody else meanwhile
+	ManagedTexture *t = 0;
+	try {
+		t = createTexture(name);
+	} catch (...) {
+		Common::StackLock lock(_mutex);
+
+		// Let anybody waiting for this texture try for themselves
+		_pendingLoads.erase(name);
+		_loadDone.broadcast();
+
+		throw;
+	}
+
 	Common::StackLock lock(_mutex);
 
-	if (ResMan.hasResource(name, ::Aurora::kFileTypePLT)) {
-		_plts.push_back(new ManagedPLT(name));
+	_pendingLoads.erase(name);
+	_loadDone.broadcast();
 
-		_newPLTs.push_back(PLTHandle(--_plts.end()));
+	std::pair<TextureMap::iterator, bool> result;
 
-		return _newPLTs.back().getPLT().getTexture();
+	result = _textures.insert(std::make_pair(name, t));
+	if (!result.second) {
+		// Somebody add()ed a texture of that name meanwhile
+		delete t;
+		return TextureHandle(result.first);
 	}
 
-	TextureMap::iterator texture = _textures.find(name);
-	if (texture == _textures.end()) {
+	result.first->second->reloadable = true;
+
+	return TextureHandle(result.first);
+}
+
+ManagedTexture *TextureManager::createTexture(const Common::UString &name) {
+	if (!_streaming)
+		return new ManagedTexture(name);
+
+	startStreaming();
+
+	// Only read the image resource here, the ResourceManager isn't thread-safe
+	ManagedTexture *t = new ManagedTexture(name, true);
+
+	if (!queueDeferred(*t->texture))
+		t->texture->loadDeferred();
+
+	return t;
+}
+
+void TextureManager::buildPLT(PLTFile &plt) {
+	assert(!plt._texture.empty());
+
+	// The PLT is identified by its name and the colors of all layers
+	Common::UString name = plt._name + "#";
+	for (uint i = 0; i < PLTFile::kLayerMAX; i++)
+		name += Common::UString::sprintf("%02X", plt._colors[i]);
+
+	TextureHandle composite;
+	bool queued = false;
+
+	{
+		Common::StackLock lock(_mutex);
+
+		_pltStats.builds++;
+
+		TextureMap::iterator texture = _textures.find(name);
+		if (texture != _textures.end()) {
+			_pltStats.shared++;
+
+			composite = TextureHandle(texture);
+		}
+	}
+
+	if (composite.empty()) {
+		// Compositing the image takes a while. Don't block everybody else meanwhile
+		Texture *texture = new Texture(new PLTImage(plt));
+
+		Common::StackLock lock(_mutex);
+
 		std::pair<TextureMap::iterator, bool> result;
 
-		ManagedTexture *t = new ManagedTexture(name);
+		result = _textures.insert(std::make_pair(name, (ManagedTexture *) 0));
+		if (result.second) {
+			result.first->second = new ManagedTexture(name, texture);
+
+			_pltStats.composited++;
+		} else {
+			// Somebody else was faster
+			delete texture;
+
+			_pltStats.shared++;
+		}
+
+		composite = TextureHandle(result.first);
+	}
+
+	{
+		Common::StackLock lock(_mutex);
+
+		queued = !_pltSwaps.empty();
+
+		_pltSwaps.push_back(PLTSwap());
+		_pltSwaps.back().texture = plt._texture;
+		_pltSwaps.back().shared  = composite;
+	}
+
+	/* The render thread might be drawing with the PLT's current texture right now.
+	 * Only swap it in the main thread, between frames. */
+	if (Common::isMainThread())
+		swapPLTs();
+	else if (!queued)
+		RequestMan.dispatchAndForget(RequestMan.rebuild(*_pltSwapper));
+}
+
+void TextureManager::swapPLTs() {
+	std::list<PLTSwap> swaps;
+
+	{
+		Common::StackLock lock(_mutex);
+
+		swaps.swap(_pltSwaps);
+	}
 
-		result = _textures.insert(std::make_pair(name, t));
+	for (std::list<PLTSwap>::iterator s = swaps.begin(); s != swaps.end(); ++s) {
+		ManagedTexture &managed = *s->texture._it->second;
 
-		texture = result.first;
+		// Our own texture is only a placeholder. The previously shared one is released by the handle
+		managed.shared = s->shared;
 
-		texture->second->reloadable = true;
+		delete managed.texture;
+		managed.texture = 0;
 	}
+}
+
+PLTStatistics TextureManager::getPLTStatistics() const {
+	Common::StackLock lock(_mutex);
 
-	return TextureHandle(texture);
+	return _pltStats;
 }
 
 void TextureManager::assign(TextureHandle &texture, const TextureHandle &from) {
@@ -282,7 +542,7 @@ void TextureManager::reloadAll() {
 
 		for (texture = _textures.begin(); texture != _textures.end(); ++texture)
 			if (texture->second->reloadable)
-				texture->second->texture->reload(texture->first);
+				texture->second->getTexture().reload(texture->first);
 
 	} catch (Common::Exception &e) {
 		e.add("Failed reloading texture \"%s\"", texture->first.c_str());
@@ -319,13 +579,265 @@ void TextureManager::set(const TextureHandle &handle) {
 		return;
 	}
 
-	TextureID id = handle._it->second->texture->getID();
-	if (id == 0)
+	Texture &texture = handle._it->second->getTexture();
+
+	texture._lastUsed = GfxMan.getFrameNumber();
+
+	// Restore it once we're done with this frame if we evicted it
+	if (texture._evicted)
+		requestRestore(texture);
+
+	/* A deferred texture stays untextured until its image is decoded and uploaded,
+	 * an evicted one until it's uploaded again. */
+	TextureID id = texture.getID();
+	if ((id == 0) && !texture._deferred && !texture._evicted)
 		warning("Empty texture ID for texture \"%s\"", handle._it->first.c_str());
 
 	glBindTexture(GL_TEXTURE_2D, id);
 }
 
+void TextureManager::setResidentSize(Texture &texture, uint32 size) {
+	Common::StackLock lock(_residentMutex);
+
+	_memoryStats.residentBytes -= texture._memorySize;
+	_memoryStats.residentBytes += size;
+
+	texture._memorySize = size;
+
+	if (size > 0)
+		_resident.insert(&texture);
+	else
+		_resident.erase(&texture);
+
+	_memoryStats.residentCount = _resident.size();
+
+	if ((size > 0) && (_memoryBudget > 0) && (_memoryStats.residentBytes > _memoryBudget) &&
+	    ((GfxMan.getFrameNumber() - _lastEvictionCheck) >= kEvictionInterval))
+		queueMemoryPass();
+}
+
+void TextureManager::requestRestore(Texture &texture) {
+	Common::StackLock lock(_residentMutex);
+
+	if (std::find(_restores.begin(), _restores.end(), &texture) != _restores.end())
+		return;
+
+	_restores.push_back(&texture);
+
+	queueMemoryPass();
+}
+
+void TextureManager::cancelRestore(Texture &texture) {
+	Common::StackLock lock(_residentMutex);
+
+	std::vector<Texture *>::iterator t = std::find(_restores.begin(), _restores.end(), &texture);
+	if (t != _restores.end())
+		_restores.erase(t);
+}
+
+void TextureManager::queueMemoryPass() {
+	Common::StackLock lock(_residentMutex);
+
+	if (_memoryQueued)
+		return;
+
+	_memoryQueued = true;
+
+	RequestMan.dispatchAndForget(RequestMan.rebuild(*_memoryKeeper));
+}
+
+void TextureManager::manageMemory() {
+	// Holding the lock keeps the textures to restore from being deleted meanwhile
+	Common::StackLock lock(_residentMutex);
+
+	_memoryQueued = false;
+
+	for (std::vector<Texture *>::iterator t = _restores.begin(); t != _restores.end(); ++t)
+		if ((*t)->restore())
+			_memoryStats.restored++;
+
+	_restores.clear();
+
+	const uint32 frame = GfxMan.getFrameNumber();
+	if ((frame - _lastEvictionCheck) >= kEvictionInterval)
+		evictUnused(frame);
+}
+
+bool TextureManager::compareLastUsed(const Texture *a, const Texture *b) {
+	return a->_lastUsed < b->_lastUsed;
+}
+
+void TextureManager::evictUnused(uint32 frame) {
+	_lastEvictionCheck = frame;
+
+	Common::StackLock lock(_residentMutex);
+
+	if ((_memoryBudget == 0) || (_memoryStats.residentBytes <= _memoryBudget))
+		return;
+
+	std::vector<Texture *> unused;
+	for (std::set<Texture *>::const_iterator t = _resident.begin(); t != _resident.end(); ++t)
+		if ((frame - (*t)->_lastUsed) >= _unusedFrames)
+			unused.push_back(*t);
+
+	// Evict the longest unused textures first
+	std::sort(unused.begin(), unused.end(), compareLastUsed);
+
+	for (std::vector<Texture *>::iterator t = unused.begin(); t != unused.end(); ++t) {
+		if (_memoryStats.residentBytes <= _memoryBudget)
+			break;
+
+		(*t)->evict();
+
+		_memoryStats.evicted++;
+	}
+}
+
+TextureMemoryStatistics TextureManager::getMemoryStatistics() const {
+	Common::StackLock lock(_residentMutex);
+
+	return _memoryStats;
+}
+
+TextureStreamStatistics TextureManager::getStreamStatistics() const {
+	Common::StackLock lock(_streamMutex);
+
+	return _streamStats;
+}
+
+void TextureManager::startStreaming() {
+	Common::StackLock lock(_streamMutex);
+
+	if (!_streamWorkers.empty())
+		return;
+
+	const int threadCount = ConfigMan.getInt("texturestreamthreads", 2);
+
+	// In MB
+	_streamMemory = MAX(ConfigMan.getInt("texturestreammemory", 64), 1) * 1024 * 1024;
+
+	for (int i = 0; i < threadCount; i++) {
+		StreamWorker *worker = new StreamWorker(*this);
+		if (!worker->createThread()) {
+			warning("Failed to create a texture streaming thread");
+
+			delete worker;
+			break;
+		}
+
+		_streamWorkers.push_back(worker);
+	}
+}
+
+void TextureManager::stopStreaming() {
+	Common::StackLock lock(_streamMutex);
+
+	for (std::list<StreamWorker *>::iterator w = _streamWorkers.begin(); w != _streamWorkers.end(); ++w)
+		delete *w;
+
+	_streamWorkers.clear();
+}
+
+bool TextureManager::queueDeferred(Texture &texture) {
+	Common::StackLock lock(_streamMutex);
+
+	_streamStats.requested++;
+
+	const uint32 size = texture.getDeferredSize();
+
+	// Nobody to decode it, or too much already in flight. Decode it directly
+	if (_streamWorkers.empty() ||
+	    ((_streamStats.inFlightBytes > 0) && ((_streamStats.inFlightBytes + size) > _streamMemory))) {
+
+		_streamStats.inlined++;
+		return false;
+	}
+
+	_streamJobs.push_back(StreamJob());
+
+	_streamJobs.back().texture     = &texture;
+	_streamJobs.back().size        = size;
+	_streamJobs.back().requestTime = EventMan.getTimestamp();
+
+	_streamStats.inFlight      += 1;
+	_streamStats.inFlightBytes += size;
+	_streamStats.peakBytes      = MAX(_streamStats.peakBytes, _streamStats.inFlightBytes);
+
+	_streamJobCount.unlock();
+
+	return true;
+}
+
+bool TextureManager::takeDeferred(StreamJob &job) {
+	if (!_streamJobCount.lock(100))
+		return false;
+
+	Common::StackLock lock(_streamMutex);
+
+	// The texture might have been cancelled in the meantime
+	if (_streamJobs.empty())
+		return false;
+
+	_streamDecoding.splice(_streamDecoding.end(), _streamJobs, _streamJobs.begin());
+
+	job = _streamDecoding.back();
+	return true;
+}
+
+void TextureManager::decodeDeferred(const StreamJob &job) {
+	// The texture must not be touched after it's been marked as decoded
+	const bool success = job.texture->loadDeferred();
+
+	const uint32 latency = EventMan.getTimestamp() - job.requestTime;
+
+	Common::StackLock lock(_streamMutex);
+
+	for (StreamJobs::iterator j = _streamDecoding.begin(); j != _streamDecoding.end(); ++j) {
+		if (j->texture == job.texture) {
+			_streamDecoding.erase(j);
+			break;
+		}
+	}
+
+	_streamStats.inFlight      -= 1;
+	_streamStats.inFlightBytes -= job.size;
+
+	if (success)
+		_streamStats.decoded++;
+	else
+		_streamStats.failed++;
+
+	_streamStats.latencyTotal += latency;
+	_streamStats.latencyMax    = MAX(_streamStats.latencyMax, latency);
+}
+
+void TextureManager::cancelDeferred(Texture &texture) {
+	_streamMutex.lock();
+
+	for (StreamJobs::iterator j = _streamJobs.begin(); j != _streamJobs.end(); ++j) {
+		if (j->texture == &texture) {
+			_streamStats.inFlight      -= 1;
+			_streamStats.inFlightBytes -= j->size;
+
+			_streamJobs.erase(j);
+
+			_streamMutex.unlock();
+			return;
+		}
+	}
+
+	bool decoding = false;
+	for (StreamJobs::const_iterator j = _streamDecoding.begin(); j != _streamDecoding.end(); ++j)
+		if (j->texture == &texture)
+			decoding = true;
+
+	_streamMutex.unlock();
+
+	// Already being decoded, wait for the thread to finish with it
+	if (decoding)
+		texture.waitLoaded();
+}
+
 static GLenum texture[32] = {
 	GL_TEXTURE0_ARB,
 	GL_TEXTURE1_ARB,
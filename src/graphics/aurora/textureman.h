@@ -26,7 +26,9 @@
 #define GRAPHICS_AURORA_TEXTUREMAN_H
 
 #include <map>
+#include <set>
 #include <list>
+#include <vector>
 
 #include "graphics/types.h"
 
@@ -42,17 +44,7 @@ namespace Aurora {
 class Texture;
 class PLTFile;
 
-/** A managed texture, storing how often it's referenced. */
-struct ManagedTexture {
-	Texture *texture;
-	uint32 referenceCount;
-
-	bool reloadable;
-
-	ManagedTexture(const Common::UString &name);
-	ManagedTexture(const Common::UString &name, Texture *t);
-	~ManagedTexture();
-};
+struct ManagedTexture;
 
 /** A managed PLT, storing how often it's referenced. */
 struct ManagedPLT {
@@ -66,6 +58,50 @@ struct ManagedPLT {
 typedef std::map<Common::UString, ManagedTexture *> TextureMap;
 typedef std::list<ManagedPLT *> PLTList;;
 
+/** Statistics about the textures decoded in the background. */
+struct TextureStreamStatistics {
+	uint32 requested; ///< Number of textures requested to be streamed.
+	uint32 decoded;   ///< Number of textures decoded by the streaming threads.
+	uint32 inlined;   ///< Number of textures decoded directly, because too much was in flight.
+	uint32 failed;    ///< Number of textures that failed to decode.
+
+	uint32 inFlight;      ///< Number of textures currently waiting or decoding.
+	uint32 inFlightBytes; ///< Size of the images currently waiting or decoding.
+	uint32 peakBytes;     ///< Largest size of the images in flight at any time.
+
+	uint32 latencyTotal; ///< Sum of the times from request to decoded, in milliseconds.
+	uint32 latencyMax;   ///< Longest time from request to decoded, in milliseconds.
+
+	TextureStreamStatistics();
+};
+
+/** Statistics about the sharing of PLT textures. */
+struct PLTStatistics {
+	uint32 builds;     ///< Number of times a PLT texture was built with new layer colors.
+	uint32 composited; ///< Number of PLT textures actually composited.
+	uint32 shared;     ///< Number of PLT textures shared with an identical one instead.
+
+	PLTStatistics();
+};
+
+/** Statistics about the textures in GL memory.
+ *
+ *  The GL copies of the textures count against the budget. An evicted texture
+ *  read from an image resource drops its decoded image from system memory as
+ *  well, and reads and decodes the resource again on its next use. Textures
+ *  created out of images, like PLTs and fonts, keep their images.
+ */
+struct TextureMemoryStatistics {
+	uint32 residentCount; ///< Number of textures currently in GL memory.
+	uint64 residentBytes; ///< Size of the textures currently in GL memory.
+	uint64 budget;        ///< Size the textures in GL memory should stay under, 0 for unlimited.
+
+	uint32 evicted;  ///< Number of times a texture was evicted from GL memory.
+	uint32 restored; ///< Number of times an evicted texture was uploaded again.
+
+	TextureMemoryStatistics();
+};
+
 /** A handle to a texture. */
 class TextureHandle {
 public:
@@ -90,6 +126,24 @@ private:
 	friend class TextureManager;
 };
 
+/** A managed texture, storing how often it's referenced. */
+struct ManagedTexture {
+	Texture *texture; ///< Our own texture, 0 if we show a shared one instead.
+	uint32 referenceCount;
+
+	bool reloadable;
+
+	/** The texture shown instead of our own, shared with other managed textures. */
+	TextureHandle shared;
+
+	ManagedTexture(const Common::UString &name, bool deferred = false);
+	ManagedTexture(const Common::UString &name, Texture *t);
+	~ManagedTexture();
+
+	/** Return the texture shown, our own or the shared one. */
+	Texture &getTexture() const;
+};
+
 class PLTHandle {
 public:
 	PLTHandle();
@@ -141,22 +195,139 @@ public:
 	void activeTexture(uint32 n);
 
 
+	/** Return statistics about the textures decoded in the background. */
+	TextureStreamStatistics getStreamStatistics() const;
+
+	/** Return statistics about the textures in GL memory. */
+	TextureMemoryStatistics getMemoryStatistics() const;
+
+	/** Return statistics about the sharing of PLT textures. */
+	PLTStatistics getPLTStatistics() const;
+
+	/** Make sure this deferred texture is not going to be decoded anymore. */
+	void cancelDeferred(Texture &texture);
+
+
 private:
+	class StreamWorker;
+	class PLTSwapper;
+	class MemoryKeeper;
+
+	/** A rebuilt PLT, waiting to show its new shared texture. */
+	struct PLTSwap {
+		TextureHandle texture; ///< The PLT's own texture.
+		TextureHandle shared;  ///< The shared texture to show instead.
+	};
+
+	/** A texture waiting to be decoded in the background. */
+	struct StreamJob {
+		Texture *texture;
+		uint32 size;        ///< Size of the texture's image resource.
+		uint32 requestTime; ///< Timestamp of the texture's request.
+	};
+
+	typedef std::list<StreamJob> StreamJobs;
+
 	TextureMap _textures;
 	PLTList    _plts;
 
 	std::list<PLTHandle> _newPLTs;
 
-	Common::Mutex _mutex;
+	std::list<PLTSwap> _pltSwaps; ///< Rebuilt PLTs, waiting for the main thread.
+	PLTSwapper *_pltSwapper;      ///< Swaps the rebuilt PLTs, in the main thread.
+
+	mutable Common::Mutex _mutex;
+
+	std::set<Common::UString> _pendingLoads; ///< Textures get() is currently creating.
+	Common::Condition _loadDone;             ///< Signals that a pending load is done. Waited on with _mutex held.
+
+	bool _streaming; ///< Decode image resources in the background?
+
+	uint32 _streamMemory; ///< Maximum size of the images in flight.
+
+	std::list<StreamWorker *> _streamWorkers;
+
+	StreamJobs _streamJobs;     ///< Textures waiting to be decoded.
+	StreamJobs _streamDecoding; ///< Textures currently being decoded.
+
+	Common::Semaphore _streamJobCount; ///< Number of textures waiting to be decoded.
+
+	TextureStreamStatistics _streamStats;
+
+	PLTStatistics _pltStats;
+
+	std::set<Texture *> _resident; ///< All textures currently in GL memory.
+
+	uint64 _memoryBudget; ///< Size the textures in GL memory should stay under, 0 for unlimited.
+	uint32 _unusedFrames; ///< Number of frames a texture has to be unused before it can be evicted.
+
+	std::vector<Texture *> _restores; ///< Evicted textures used again, to be restored.
+
+	MemoryKeeper *_memoryKeeper; ///< Restores and evicts textures, in the main thread.
+	bool _memoryQueued;          ///< Has the memory keeper been asked to run?
+
+	uint32 _lastEvictionCheck; ///< Number of the frame we last checked the texture memory budget.
+
+	TextureMemoryStatistics _memoryStats;
+
+	mutable Common::Mutex _residentMutex;
+
+	mutable Common::Mutex _streamMutex;
+
+	/** Create a texture from this image resource, decoding it in the background if possible. */
+	ManagedTexture *createTexture(const Common::UString &name);
+
+	void startStreaming();
+	void stopStreaming();
+
+	/** Queue the decoding of a deferred texture. Returns false if it should be decoded directly. */
+	bool queueDeferred(Texture &texture);
+	/** Take the next texture to decode. Returns false if there is none. */
+	bool takeDeferred(StreamJob &job);
+	/** Decode a deferred texture taken from the queue. */
+	void decodeDeferred(const StreamJob &job);
+
+	friend class StreamWorker;
+	friend class PLTSwapper;
+	friend class MemoryKeeper;
 
 	void release(TextureMap::iterator &i);
 	void release(PLTList::iterator &i);
 
+	/** Set the size of a texture in GL memory, 0 if it's not in GL memory. */
+	void setResidentSize(Texture &texture, uint32 size);
+
+	/** Restore this evicted texture once the current frame is done. */
+	void requestRestore(Texture &texture);
+	/** Make sure this texture isn't going to be restored anymore. */
+	void cancelRestore(Texture &texture);
+
+	/** Ask the main thread to restore and evict textures, between two frames. */
+	void queueMemoryPass();
+	/** Restore the requested textures, and keep to the memory budget. Called in the main thread. */
+	void manageMemory();
+
+	/** Evict textures unused for a while, if the texture memory is over budget. */
+	void evictUnused(uint32 frame);
+
+	/** Was texture a used less recently than texture b? */
+	static bool compareLastUsed(const Texture *a, const Texture *b);
+
+	/** Show the PLT with its current layer colors, sharing the texture of identical PLTs.
+	 *
+	 *  The new texture is only shown once the main thread got around to swapping it in.
+	 */
+	void buildPLT(PLTFile &plt);
+	/** Show the new textures of all rebuilt PLTs. Must be called in the main thread, outside of rendering. */
+	void swapPLTs();
+
 	void assign(TextureHandle &texture, const TextureHandle &from);
 	void assign(PLTHandle &plt, const PLTHandle &from);
 	void release(TextureHandle &texture);
 	void release(PLTHandle &plt);
 
+	friend class Texture;
+	friend class PLTFile;
 	friend class PLTHandle;
 	friend class TextureHandle;
 };
@@ -39,12 +39,14 @@
 static const uint32 kPageWidth  = 256;
 static const uint32 kPageHeight = 256;
 
+/** Empty pixels between characters, so that filtering doesn't bleed into neighbors. */
+static const uint32 kCharPadding = 1;
+
 namespace Graphics {
 
 namespace Aurora {
 
-TTFFont::Page::Page() : needRebuild(false),
-		curX(0), curY(0), heightLeft(kPageHeight), widthLeft(kPageWidth) {
+TTFFont::Page::Page() : needRebuild(false), curX(0), curY(0) {
 
 	surface = new Surface(kPageWidth, kPageHeight);
 	surface->fill(0x00, 0x00, 0x00, 0x00);
@@ -60,6 +62,24 @@ void TTFFont::Page::rebuild() {
 	needRebuild = false;
 }
 
+bool TTFFont::Page::findSpace(uint32 width, uint32 height, uint32 &x, uint32 &y) {
+	if ((curX + width) > kPageWidth) {
+		// Doesn't fit onto the current shelf, start a new one
+		curX  = 0;
+		curY += height + kCharPadding;
+	}
+
+	if ((curY + height) > kPageHeight)
+		return false;
+
+	x = curX;
+	y = curY;
+
+	curX += width + kCharPadding;
+
+	return true;
+}
+
 
 TTFFont::TTFFont(Common::SeekableReadStream *ttf, int height) : _ttf(0) {
 	load(ttf, height);
@@ -131,45 +151,50 @@ float TTFFont::getHeight() const {
 	return _height;
 }
 
-void TTFFont::drawMissing() const {
-	TextureMan.set();
+void TTFFont::getQuad(uint32 c, CharQuad &quad) const {
+	std::map<uint32, Char>::const_iterator cC = _chars.find(c);
+	if (cC == _chars.end())
+		cC = _missingChar;
 
-	const float width = _missingWidth - 1.0;
+	if (cC == _chars.end()) {
+		// No replacement character either, draw an untextured box
+		const float width = _missingWidth - 1.0;
 
-	glBegin(GL_QUADS);
-		glVertex2f(0.0  ,     0.0);
-		glVertex2f(width,     0.0);
-		glVertex2f(width, _height);
-		glVertex2f(0.0  , _height);
-	glEnd();
+		quad.page = -1;
 
-	glTranslatef(width + 1.0, 0.0, 0.0);
-}
+		quad.vX[0] = 0.0  ; quad.vY[0] = 0.0;
+		quad.vX[1] = width; quad.vY[1] = 0.0;
+		quad.vX[2] = width; quad.vY[2] = _height;
+		quad.vX[3] = 0.0  ; quad.vY[3] = _height;
 
-void TTFFont::draw(uint32 c) const {
-	std::map<uint32, Char>::const_iterator cC = _chars.find(c);
-	if (cC == _chars.end()) {
-		cC = _missingChar;
+		for (int i = 0; i < 4; i++)
+			quad.tX[i] = quad.tY[i] = 0.0;
 
-		if (cC == _chars.end()) {
-			drawMissing();
-			return;
-		}
+		quad.advance = _missingWidth;
+		return;
 	}
 
-	uint page = cC->second.page;
-	assert(page < _pages.size());
+	const Char &ch = cC->second;
 
-	TextureMan.set(_pages[page]->texture);
+	assert(ch.page < _pages.size());
+
+	quad.page = ch.page;
 
-	glBegin(GL_QUADS);
 	for (int i = 0; i < 4; i++) {
-		glTexCoord2f(cC->second.tX[i], cC->second.tY[i]);
-		glVertex2f  (cC->second.vX[i], cC->second.vY[i]);
+		quad.vX[i] = ch.vX[i]; quad.vY[i] = ch.vY[i];
+		quad.tX[i] = ch.tX[i]; quad.tY[i] = ch.tY[i];
 	}
-	glEnd();
 
-	glTranslatef(cC->second.width, 0.0, 0.0);
+	quad.advance = ch.width;
+}
+
+void TTFFont::setPage(int32 page) const {
+	if ((page < 0) || ((uint32) page >= _pages.size())) {
+		TextureMan.set();
+		return;
+	}
+
+	TextureMan.set(_pages[page]->texture);
 }
 
 void TTFFont::buildChars(const Common::UString &str) {
@@ -198,31 +223,16 @@ void TTFFont::addChar(uint32 c) {
 		if (cWidth > kPageWidth)
 			return;
 
-		if (_pages.empty())
+		uint32 x = 0, y = 0;
+		if (_pages.empty() || !_pages.back()->findSpace(cWidth, _height, x, y)) {
+			// The current page is full, start a new one
 			_pages.push_back(new Page);
 
-		if (_pages.back()->widthLeft < cWidth) {
-			// The current character doesn't fit into the current line
-
-			if (_pages.back()->heightLeft >= _height) {
-				// Create a new line
-
-				_pages.back()->curX  = 0;
-				_pages.back()->curY += _height;
-
-				_pages.back()->heightLeft -= _height;
-				_pages.back()->widthLeft   = kPageWidth;
-
-			} else {
-				// Create a new page
-
-				_pages.push_back(new Page);
-				_pages.back()->heightLeft -= _height;
-			}
-
+			if (!_pages.back()->findSpace(cWidth, _height, x, y))
+				return;
 		}
 
-		_ttf->drawCharacter(c, *_pages.back()->surface, _pages.back()->curX, _pages.back()->curY);
+		_ttf->drawCharacter(c, *_pages.back()->surface, x, y);
 
 		std::pair<std::map<uint32, Char>::iterator, bool> result;
 
@@ -241,8 +251,8 @@ void TTFFont::addChar(uint32 c) {
 		ch.vX[2] = cWidth; ch.vY[2] = _height;
 		ch.vX[3] = 0.00;   ch.vY[3] = _height;
 
-		const float tX = (float) page.curX / (float) kPageWidth;
-		const float tY = (float) page.curY / (float) kPageHeight;
+		const float tX = (float) x / (float) kPageWidth;
+		const float tY = (float) y / (float) kPageHeight;
 		const float tW = (float) cWidth    / (float) kPageWidth;
 		const float tH = (float) _height   / (float) kPageHeight;
 
@@ -251,9 +261,10 @@ void TTFFont::addChar(uint32 c) {
 		ch.tX[2] = tX + tW; ch.tY[2] = tY;
 		ch.tX[3] = tX;      ch.tY[3] = tY;
 
-		_pages.back()->widthLeft  -= cWidth;
-		_pages.back()->curX       += cWidth;
-		_pages.back()->needRebuild = true;
+		page.needRebuild = true;
+
+		// The widths of already laid out texts might have changed
+		clearLayoutCache();
 
 	} catch (Common::Exception &e) {
 		if (cC != _chars.end())
@@ -56,27 +56,32 @@ public:
 	float getWidth (uint32 c) const;
 	float getHeight()         const;
 
-	void draw(uint32 c) const;
+	void getQuad(uint32 c, CharQuad &quad) const;
+	void setPage(int32 page) const;
 
 	void buildChars(const Common::UString &str);
 
 private:
-	/** A texture page filled with characters. */
+	/** A texture page filled with characters.
+	 *
+	 *  All characters are as high as the font, so the page is packed
+	 *  in shelves of that height, each filled from left to right.
+	 */
 	struct Page {
 		Surface *surface;
 		TextureHandle texture;
 
 		bool needRebuild;
 
-		uint32 curX;
-		uint32 curY;
-
-		uint32 heightLeft;
-		uint32 widthLeft;
+		uint32 curX; ///< Where the next character goes on the current shelf.
+		uint32 curY; ///< The top of the current shelf.
 
 		Page();
 
 		void rebuild();
+
+		/** Find room for a character on this page. */
+		bool findSpace(uint32 width, uint32 height, uint32 &x, uint32 &y);
 	};
 
 	/** A font character. */
@@ -104,7 +109,6 @@ private:
 
 	void rebuildPages();
 	void addChar(uint32 c);
-	void drawMissing() const;
 };
 
 } // End of namespace Aurora
@@ -39,6 +39,7 @@ enum ModelType {
 
 class Model;
 class ModelNode;
+class StaticBatch;
 class Text;
 class GUIQuad;
 
@@ -0,0 +1,223 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/benchmark.cpp
+ *  Measuring the rendering along a recorded camera path.
+ */
+
+#include <cstdio>
+#include <algorithm>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+#include "common/ustring.h"
+#include "common/file.h"
+
+#include "graphics/benchmark.h"
+#include "graphics/graphics.h"
+#include "graphics/camera.h"
+
+namespace Graphics {
+
+CameraPath::CameraPath() {
+}
+
+CameraPath::~CameraPath() {
+}
+
+void CameraPath::clear() {
+	_frames.clear();
+}
+
+bool CameraPath::empty() const {
+	return _frames.empty();
+}
+
+uint32 CameraPath::size() const {
+	return _frames.size();
+}
+
+void CameraPath::addCurrent() {
+	_frames.push_back(Frame());
+
+	CameraMan.lock();
+	memcpy(_frames.back().position   , CameraMan.getPosition   (), 3 * sizeof(float));
+	memcpy(_frames.back().orientation, CameraMan.getOrientation(), 3 * sizeof(float));
+	CameraMan.unlock();
+}
+
+void CameraPath::apply(uint32 frame) const {
+	if (_frames.empty())
+		return;
+
+	const Frame &f = _frames[frame % _frames.size()];
+
+	CameraMan.setPosition   (f.position   [0], f.position   [1], f.position   [2]);
+	CameraMan.setOrientation(f.orientation[0], f.orientation[1], f.orientation[2]);
+}
+
+bool CameraPath::load(const Common::UString &fileName) {
+	Common::File file;
+	if (!file.open(fileName))
+		return false;
+
+	_frames.clear();
+
+	while (!file.eos()) {
+		Common::UString line;
+		line.readLineASCII(file);
+
+		Frame f;
+		if (std::sscanf(line.c_str(), "%f %f %f %f %f %f",
+		                &f.position   [0], &f.position   [1], &f.position   [2],
+		                &f.orientation[0], &f.orientation[1], &f.orientation[2]) == 6)
+			_frames.push_back(f);
+	}
+
+	return !_frames.empty();
+}
+
+bool CameraPath::save(const Common::UString &fileName) const {
+	Common::DumpFile file;
+	if (!file.open(fileName))
+		return false;
+
+	for (std::vector<Frame>::const_iterator f = _frames.begin(); f != _frames.end(); ++f)
+		file.writeString(Common::UString::sprintf("%f %f %f %f %f %f\n",
+		                 f->position   [0], f->position   [1], f->position   [2],
+		                 f->orientation[0], f->orientation[1], f->orientation[2]));
+
+	file.flush();
+
+	return !file.err();
+}
+
+
+BenchmarkResults::BenchmarkResults() : frames(0),
+	frameTimeMean(0.0), frameTime50(0.0), frameTime90(0.0), frameTime99(0.0), frameTimeMax(0.0),
+	drawCalls(0.0), triangles(0.0) {
+
+}
+
+
+/** Return the nearest-rank percentile of a sorted list of values. */
+static double getPercentile(const std::vector<double> &values, uint32 percentile) {
+	if (values.empty())
+		return 0.0;
+
+	uint32 rank = (percentile * values.size() + 99) / 100;
+
+	return values[CLIP<uint32>(rank, 1, values.size()) - 1];
+}
+
+
+RenderBenchmark::RenderBenchmark() : _frames(0), _frame(0), _frameStart(0),
+	_drawCalls(0), _triangles(0), _hasResults(false) {
+
+}
+
+RenderBenchmark::~RenderBenchmark() {
+}
+
+void RenderBenchmark::start(const CameraPath &path, uint32 frames) {
+	_path   = path;
+	_frames = frames;
+	_frame  = 0;
+
+	_frameTimes.clear();
+	_frameTimes.reserve(frames);
+
+	_drawCalls = 0;
+	_triangles = 0;
+
+	_hasResults = false;
+}
+
+void RenderBenchmark::abort() {
+	_frames = 0;
+	_frame  = 0;
+
+	_frameTimes.clear();
+}
+
+bool RenderBenchmark::isRunning() const {
+	return _frame < _frames;
+}
+
+bool RenderBenchmark::hasResults() const {
+	return _hasResults;
+}
+
+const BenchmarkResults &RenderBenchmark::getResults() const {
+	return _results;
+}
+
+void RenderBenchmark::beginFrame() {
+	if (!isRunning())
+		return;
+
+	_path.apply(_frame);
+
+	_frameStart = SDL_GetPerformanceCounter();
+}
+
+bool RenderBenchmark::endFrame(const RenderStatistics &stats) {
+	if (!isRunning())
+		return false;
+
+	const uint64 frameEnd = SDL_GetPerformanceCounter();
+
+	_frameTimes.push_back(((frameEnd - _frameStart) * 1000.0) / SDL_GetPerformanceFrequency());
+
+	_drawCalls += stats.drawCalls;
+	_triangles += stats.triangles;
+
+	if (++_frame < _frames)
+		return false;
+
+	finish();
+	return true;
+}
+
+void RenderBenchmark::finish() {
+	std::sort(_frameTimes.begin(), _frameTimes.end());
+
+	double sum = 0.0;
+	for (std::vector<double>::const_iterator t = _frameTimes.begin(); t != _frameTimes.end(); ++t)
+		sum += *t;
+
+	_results.frames = _frameTimes.size();
+
+	_results.frameTimeMean = _frameTimes.empty() ? 0.0 : (sum / _frameTimes.size());
+	_results.frameTime50   = getPercentile(_frameTimes, 50);
+	_results.frameTime90   = getPercentile(_frameTimes, 90);
+	_results.frameTime99   = getPercentile(_frameTimes, 99);
+	_results.frameTimeMax  = _frameTimes.empty() ? 0.0 : _frameTimes.back();
+
+	_results.drawCalls = _frameTimes.empty() ? 0.0 : ((double) _drawCalls / _frameTimes.size());
+	_results.triangles = _frameTimes.empty() ? 0.0 : ((double) _triangles / _frameTimes.size());
+
+	_hasResults = true;
+
+	_frameTimes.clear();
+}
+
+} // End of namespace Graphics
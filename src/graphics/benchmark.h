@@ -0,0 +1,136 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/benchmark.h
+ *  Measuring the rendering along a recorded camera path.
+ */
+
+#ifndef GRAPHICS_BENCHMARK_H
+#define GRAPHICS_BENCHMARK_H
+
+#include <vector>
+
+#include "common/types.h"
+
+namespace Common {
+	class UString;
+}
+
+namespace Graphics {
+
+struct RenderStatistics;
+
+/** A recorded path of camera positions and orientations, one per frame. */
+class CameraPath {
+public:
+	CameraPath();
+	~CameraPath();
+
+	/** Remove all frames from the path. */
+	void clear();
+
+	/** Is the path empty? */
+	bool empty() const;
+	/** Return the number of frames in the path. */
+	uint32 size() const;
+
+	/** Append the camera's current position and orientation. */
+	void addCurrent();
+
+	/** Move the camera to this frame of the path, wrapping around at the end. */
+	void apply(uint32 frame) const;
+
+	/** Load the path from a file, one frame per line. */
+	bool load(const Common::UString &fileName);
+	/** Save the path to a file, one frame per line. */
+	bool save(const Common::UString &fileName) const;
+
+private:
+	/** The camera within one frame of the path. */
+	struct Frame {
+		float position[3];
+		float orientation[3];
+	};
+
+	std::vector<Frame> _frames;
+};
+
+/** Results of a benchmark run. All frame times are in milliseconds. */
+struct BenchmarkResults {
+	uint32 frames; ///< Number of frames rendered.
+
+	double frameTimeMean; ///< Mean frame time.
+	double frameTime50;   ///< Median frame time.
+	double frameTime90;   ///< 90th percentile frame time.
+	double frameTime99;   ///< 99th percentile frame time.
+	double frameTimeMax;  ///< Longest frame time.
+
+	double drawCalls; ///< Mean number of draw calls per frame.
+	double triangles; ///< Mean number of triangles per frame.
+
+	BenchmarkResults();
+};
+
+/** Renders a number of frames along a camera path, measuring each. */
+class RenderBenchmark {
+public:
+	RenderBenchmark();
+	~RenderBenchmark();
+
+	/** Start rendering that many frames along the camera path. */
+	void start(const CameraPath &path, uint32 frames);
+	/** Abort the benchmark, discarding everything measured. */
+	void abort();
+
+	/** Are we currently in the middle of a benchmark? */
+	bool isRunning() const;
+	/** Did a benchmark finish since it was last started? */
+	bool hasResults() const;
+
+	/** Return the results of the last finished benchmark. */
+	const BenchmarkResults &getResults() const;
+
+	/** Set up the camera for the next frame and start measuring it. */
+	void beginFrame();
+	/** Stop measuring the frame. Returns true if that was the last frame. */
+	bool endFrame(const RenderStatistics &stats);
+
+private:
+	CameraPath _path;
+
+	uint32 _frames; ///< Number of frames to render.
+	uint32 _frame;  ///< The current frame.
+
+	uint64 _frameStart; ///< Performance counter value at the start of the current frame.
+
+	std::vector<double> _frameTimes; ///< Times of all frames measured so far.
+
+	uint64 _drawCalls; ///< Sum of all draw calls so far.
+	uint64 _triangles; ///< Sum of all triangles so far.
+
+	bool _hasResults;
+	BenchmarkResults _results;
+
+	void finish();
+};
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_BENCHMARK_H
@@ -28,8 +28,25 @@
 #include "graphics/types.h"
 #include "graphics/font.h"
 
+/** Number of layouts each font remembers. */
+static const uint32 kLayoutCacheSize = 256;
+
 namespace Graphics {
 
+TextLayout::TextLayout() : width(0.0) {
+}
+
+
+bool Font::LayoutKey::operator<(const LayoutKey &right) const {
+	if (maxWidth != right.maxWidth)
+		return maxWidth < right.maxWidth;
+	if (maxHeight != right.maxHeight)
+		return maxHeight < right.maxHeight;
+
+	return text < right.text;
+}
+
+
 Font::Font() {
 }
 
@@ -41,17 +58,17 @@ float Font::getLineSpacing() const {
 }
 
 uint32 Font::getLineCount(const Common::UString &text, float maxWidth, float maxHeight) const {
-	std::vector<Common::UString> lines;
-
-	split(text, lines, maxWidth, maxHeight);
+	TextLayout lines;
+	layout(text, lines, maxWidth, maxHeight);
 
-	return lines.size();
+	return lines.lines.size();
 }
 
 float Font::getWidth(const Common::UString &text, float maxWidth) const {
-	std::vector<Common::UString> lines;
+	TextLayout lines;
+	layout(text, lines, maxWidth);
 
-	return split(text, lines, maxWidth);
+	return lines.width;
 }
 
 float Font::getHeight(const Common::UString &text, float maxWidth, float maxHeight) const {
@@ -66,55 +83,68 @@ float Font::getHeight(const Common::UString &text, float maxWidth, float maxHeig
 void Font::buildChars(const Common::UString &str) {
 }
 
-void Font::draw(Common::UString text, const ColorPositions &colors,
-                float r, float g, float b, float a, float align, float maxWidth, float maxHeight) const {
+void Font::layout(const Common::UString &text, TextLayout &layout,
+                  float maxWidth, float maxHeight, bool cache) const {
 
-	glColor4f(r, g, b, a);
+	if (!cache) {
+		splitLayout(text, layout, maxWidth, maxHeight);
+		return;
+	}
 
-	std::vector<Common::UString> lines;
-	float maxLength = split(text, lines, maxWidth, maxHeight);
+	LayoutKey key;
 
-	// Move position to the top
-	glTranslatef(0.0, (lines.size() - 1) * (getHeight() + getLineSpacing()), 0.0);
+	key.text      = text;
+	key.maxWidth  = maxWidth;
+	key.maxHeight = maxHeight;
 
-	uint32 position = 0;
+	{
+		Common::StackLock lock(_layoutMutex);
 
-	ColorPositions::const_iterator color = colors.begin();
+		LayoutMap::iterator l = _layoutMap.find(key);
+		if (l != _layoutMap.end()) {
+			// Move it to the front of the list
+			_layouts.splice(_layouts.begin(), _layouts, l->second);
 
-	// Draw lines
-	for (std::vector<Common::UString>::iterator l = lines.begin(); l != lines.end(); ++l) {
-		// Save the current position
-		glPushMatrix();
+			layout = l->second->second;
+			return;
+		}
+	}
 
-		// Align
-		glTranslatef(roundf((maxLength - getLineWidth(*l)) * align), 0.0, 0.0);
+	splitLayout(text, layout, maxWidth, maxHeight);
 
-		// Draw line
-		for (Common::UString::iterator s = l->begin(); s != l->end(); ++s, position++) {
-			// If we have color changes, apply them
-			while ((color != colors.end()) && (color->position <= position)) {
-				if (color->defaultColor)
-					glColor4f(r, g, b, a);
-				else
-					glColor4f(color->r, color->g, color->b, color->a);
+	Common::StackLock lock(_layoutMutex);
 
-				++color;
-			}
+	if (_layoutMap.find(key) != _layoutMap.end())
+		return;
 
-			draw(*s);
-		}
+	_layouts.push_front(std::make_pair(key, layout));
+	_layoutMap.insert(std::make_pair(key, _layouts.begin()));
+
+	// Forget the least recently used layouts
+	while (_layoutMap.size() > kLayoutCacheSize) {
+		_layoutMap.erase(_layouts.back().first);
+		_layouts.pop_back();
+	}
+}
 
-		// Restore position to the start of the line
-		glPopMatrix();
+void Font::splitLayout(const Common::UString &text, TextLayout &layout,
+                       float maxWidth, float maxHeight) const {
 
-		// Move to the next line
-		glTranslatef(0.0, -(getHeight() + getLineSpacing()), 0.0);
+	layout.lines.clear();
+	layout.lineWidths.clear();
 
-		// \n character
-		position++;
-	}
+	layout.width = split(text, layout.lines, maxWidth, maxHeight);
+
+	layout.lineWidths.reserve(layout.lines.size());
+	for (std::vector<Common::UString>::const_iterator l = layout.lines.begin(); l != layout.lines.end(); ++l)
+		layout.lineWidths.push_back(getLineWidth(*l));
+}
+
+void Font::clearLayoutCache() {
+	Common::StackLock lock(_layoutMutex);
 
-	glColor4f(1.0, 1.0, 1.0, 1.0);
+	_layoutMap.clear();
+	_layouts.clear();
 }
 
 float Font::split(const Common::UString &line, std::vector<Common::UString> &lines,
@@ -26,13 +26,36 @@
 #define GRAPHICS_FONT_H
 
 #include <vector>
+#include <list>
+#include <map>
 
 #include "common/ustring.h"
+#include "common/mutex.h"
 
 #include "graphics/types.h"
 
 namespace Graphics {
 
+/** A text split into lines. */
+struct TextLayout {
+	std::vector<Common::UString> lines;      ///< The lines.
+	std::vector<float>           lineWidths; ///< The width of each line.
+
+	float width; ///< The width of the widest line.
+
+	TextLayout();
+};
+
+/** A character, drawn as a quad textured with one of the font's pages. */
+struct CharQuad {
+	int32 page; ///< The page holding the character, -1 for an untextured quad.
+
+	float vX[4], vY[4]; ///< The vertex coordinates, relative to the pen position.
+	float tX[4], tY[4]; ///< The texture coordinates.
+
+	float advance; ///< How far to move the pen after the character.
+};
+
 /** An abstract font. */
 class Font {
 public:
@@ -58,18 +81,54 @@ public:
 	/** Build all necessary characters to display this string. */
 	virtual void buildChars(const Common::UString &str);
 
-	/** Draw this character. */
-	virtual void draw(uint32 c) const = 0;
-
-	void draw(Common::UString text, const ColorPositions &colors,
-		  float r, float g, float b, float a, float align = 0.0, float maxWidth = 0.0, float maxHeight = 0.0) const;
+	/** Return the quad of this character. */
+	virtual void getQuad(uint32 c, CharQuad &quad) const = 0;
+	/** Bind the texture of this page, or no texture for -1. */
+	virtual void setPage(int32 page) const = 0;
+
+	/** Split this text into lines.
+	 *
+	 *  If cache is true, a recent result for the same text and sizes is reused,
+	 *  and the result is remembered. Text that is unlikely to be laid out again,
+	 *  like console output, should not be cached, so it doesn't push out the
+	 *  layouts of other texts.
+	 */
+	void layout(const Common::UString &text, TextLayout &layout,
+	            float maxWidth = 0.0, float maxHeight = 0.0, bool cache = true) const;
 
 	float split(const Common::UString &line, std::vector<Common::UString> &lines,
 		    float maxWidth = 0.0, float maxHeight = 0.0) const;
 	float split(Common::UString &line, float maxWidth, float maxHeight = 0.0) const;
 	float split(const Common::UString &line, Common::UString &lines, float maxWidth, float maxHeight = 0.0) const;
 
+protected:
+	/** Forget all cached layouts, because the width of characters changed. */
+	void clearLayoutCache();
+
 private:
+	/** The text and sizes a layout was made for. */
+	struct LayoutKey {
+		Common::UString text;
+
+		float maxWidth;
+		float maxHeight;
+
+		bool operator<(const LayoutKey &right) const;
+	};
+
+	typedef std::list<std::pair<LayoutKey, TextLayout> > LayoutList;
+	typedef std::map<LayoutKey, LayoutList::iterator> LayoutMap;
+
+	/** The recently made layouts, the most recently used first. */
+	mutable LayoutList _layouts;
+	mutable LayoutMap  _layoutMap;
+
+	mutable Common::Mutex _layoutMutex;
+
+	/** Split this text into lines, without looking at the layout cache. */
+	void splitLayout(const Common::UString &text, TextLayout &layout,
+	                 float maxWidth, float maxHeight) const;
+
 	float getLineWidth(const Common::UString &text) const;
 	bool addLine(std::vector<Common::UString> &lines, const Common::UString &newLine, float maxHeight) const;
 };
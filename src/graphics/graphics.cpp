@@ -57,13 +57,28 @@ namespace Graphics {
 
 PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
 
+RenderStatistics::RenderStatistics() {
+	clear();
+}
+
+void RenderStatistics::clear() {
+	drawCalls      = 0;
+	triangles      = 0;
+	textureChanges = 0;
+	stateChanges   = 0;
+	uploadBytes    = 0;
+}
+
+
 GraphicsManager::GraphicsManager() {
 	_ready = false;
 
 	_needManualDeS3TC        = false;
 	_supportMultipleTextures = false;
+	_supportBufferObjects    = false;
 
 	_fullScreen = false;
+	_headless   = false;
 
 	// Default to GL3 true; GL3.x will be available on most modern systems.
 	_gl3 = true;
@@ -80,6 +95,8 @@ GraphicsManager::GraphicsManager() {
 
 	_fpsCounter = new FPSCounter(3);
 
+	_frameNumber = 0;
+
 	_frameLock = 0;
 
 	_cursor = 0;
@@ -93,6 +110,11 @@ GraphicsManager::GraphicsManager() {
 
 	_lastSampled = 0;
 
+	_benchmarkFrames = 0;
+	_benchmarkQuit   = false;
+
+	_recordCamera = false;
+
 	glCompressedTexImage2D = 0;
 }
 
@@ -119,9 +141,11 @@ void GraphicsManager::init() {
 	if (SDL_Init(sdlInitFlags) < 0)
 		throw Common::Exception("Failed to initialize SDL: %s", SDL_GetError());
 
+	_headless = ConfigMan.getBool("headless", false);
+
 	int  width  = ConfigMan.getInt ("width"     , _width);
 	int  height = ConfigMan.getInt ("height"    , _height);
-	bool fs     = ConfigMan.getBool("fullscreen", false);
+	bool fs     = ConfigMan.getBool("fullscreen", false) && !_headless;
 
 	initSize(width, height, fs);
 	setupScene();
@@ -136,6 +160,17 @@ void GraphicsManager::init() {
 	if (ConfigMan.hasKey("gamma"))
 		setGamma(ConfigMan.getDouble("gamma", 1.0));
 
+	// Benchmark along a recorded camera path, once there's a world to render
+	if (ConfigMan.hasKey("benchmark")) {
+		const Common::UString pathFile = ConfigMan.getString("benchmark");
+
+		if (_benchmarkPath.load(pathFile)) {
+			_benchmarkFrames = ConfigMan.getInt ("benchmarkframes", _benchmarkPath.size());
+			_benchmarkQuit   = ConfigMan.getBool("benchmarkquit"  , _headless);
+		} else
+			warning("Failed loading the benchmark camera path \"%s\"", pathFile.c_str());
+	}
+
 	_ready = true;
 }
 
@@ -153,12 +188,17 @@ void GraphicsManager::deinit() {
 
 	_needManualDeS3TC        = false;
 	_supportMultipleTextures = false;
+	_supportBufferObjects    = false;
 }
 
 bool GraphicsManager::ready() const {
 	return _ready;
 }
 
+bool GraphicsManager::isHeadless() const {
+	return _headless;
+}
+
 bool GraphicsManager::needManualDeS3TC() const {
 	return _needManualDeS3TC;
 }
@@ -167,6 +207,10 @@ bool GraphicsManager::supportMultipleTextures() const {
 	return _supportMultipleTextures;
 }
 
+bool GraphicsManager::supportBufferObjects() const {
+	return _supportBufferObjects;
+}
+
 int GraphicsManager::getMaxFSAA() const {
 	return _fsaaMax;
 }
@@ -179,6 +223,73 @@ uint32 GraphicsManager::getFPS() const {
 	return _fpsCounter->getFPS();
 }
 
+uint32 GraphicsManager::getFrameNumber() const {
+	return _frameNumber;
+}
+
+const RenderStatistics &GraphicsManager::getRenderStatistics() const {
+	return _renderStatistics;
+}
+
+void GraphicsManager::countDrawCall(uint32 triangles) {
+	_frameStatistics.drawCalls++;
+	_frameStatistics.triangles += triangles;
+}
+
+void GraphicsManager::countTextureChange() {
+	_frameStatistics.textureChanges++;
+}
+
+void GraphicsManager::countStateChange() {
+	_frameStatistics.stateChanges++;
+}
+
+void GraphicsManager::countUpload(uint32 bytes) {
+	_frameStatistics.uploadBytes += bytes;
+}
+
+void GraphicsManager::startCameraRecording() {
+	Common::StackLock lock(_benchmarkMutex);
+
+	_cameraRecording.clear();
+	_recordCamera = true;
+}
+
+void GraphicsManager::stopCameraRecording(CameraPath &path) {
+	Common::StackLock lock(_benchmarkMutex);
+
+	path = _cameraRecording;
+
+	_cameraRecording.clear();
+	_recordCamera = false;
+}
+
+void GraphicsManager::startBenchmark(const CameraPath &path, uint32 frames) {
+	Common::StackLock lock(_benchmarkMutex);
+
+	// This replaces any configured benchmark still waiting to start
+	_benchmarkPath.clear();
+	_benchmarkQuit = false;
+
+	_benchmark.start(path, frames);
+}
+
+bool GraphicsManager::isBenchmarkRunning() const {
+	Common::StackLock lock(_benchmarkMutex);
+
+	return _benchmark.isRunning();
+}
+
+bool GraphicsManager::getBenchmarkResults(BenchmarkResults &results) const {
+	Common::StackLock lock(_benchmarkMutex);
+
+	if (!_benchmark.hasResults())
+		return false;
+
+	results = _benchmark.getResults();
+	return true;
+}
+
 void GraphicsManager::initSize(int width, int height, bool fullscreen) {
 	uint32 flags = SDL_WINDOW_OPENGL;
 
@@ -186,9 +297,18 @@ void GraphicsManager::initSize(int width, int height, bool fullscreen) {
 	if (_fullScreen)
 		flags |= SDL_WINDOW_FULLSCREEN | SDL_WINDOW_RESIZABLE ;
 
+	// Headless, we render into a window that's never shown. Together with an
+	// offscreen video driver and Mesa's software rasterizer, this needs no GPU.
+	if (_headless)
+		flags |= SDL_WINDOW_HIDDEN;
+
 	if (!setupSDLGL(width, height, flags))
 		throw Common::Exception("Failed setting the video mode: %s", SDL_GetError());
 
+	// Don't wait for a vertical retrace nobody sees
+	if (_headless)
+		SDL_GL_SetSwapInterval(0);
+
 	// Initialize glew, for the extension entry points
 	GLenum glewErr = glewInit();
 	if (glewErr != GLEW_OK)
@@ -261,6 +381,10 @@ bool GraphicsManager::setFSAA(int level) {
 		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
 	}
 	_glContext = SDL_GL_CreateContext(_screen);
+
+	if (_headless)
+		SDL_GL_SetSwapInterval(0);
+
 	rebuildContext();
 
 	return _fsaa == level;
@@ -368,6 +492,15 @@ void GraphicsManager::checkGLExtensions() {
 		_supportMultipleTextures = false;
 	} else
 		_supportMultipleTextures = true;
+
+	if (!GLEW_ARB_vertex_buffer_object) {
+		warning("Your graphics card does not support vertex buffer objects");
+		warning("Model geometry will be sent to the graphics card every frame. "
+		        "This will be slower");
+
+		_supportBufferObjects = false;
+	} else
+		_supportBufferObjects = true;
 }
 
 void GraphicsManager::setWindowTitle(const Common::UString &title) {
@@ -674,6 +807,19 @@ void GraphicsManager::abandon(ListID ids, uint32 count) {
 	_hasAbandoned = true;
 }
 
+void GraphicsManager::abandonBuffers(BufferID *ids, uint32 count) {
+	if (count == 0)
+		return;
+
+	Common::StackLock lock(_abandonMutex);
+
+	_abandonBuffers.reserve(_abandonBuffers.size() + count);
+	while (count-- > 0)
+		_abandonBuffers.push_back(*ids++);
+
+	_hasAbandoned = true;
+}
+
 void GraphicsManager::setCursor(Cursor *cursor) {
 	lockFrame();
 
@@ -787,7 +933,48 @@ void GraphicsManager::buildNewTextures() {
 	QueueMan.unlockQueue(kQueueNewTexture);
 }
 
+void GraphicsManager::beginBenchmarkFrame() {
+	Common::StackLock lock(_benchmarkMutex);
+
+	// Start the configured benchmark as soon as there's a world to render
+	if (!_benchmarkPath.empty() && !QueueMan.isQueueEmpty(kQueueVisibleWorldObject)) {
+		status("Benchmarking %u frames along a camera path of %u frames",
+		       _benchmarkFrames, _benchmarkPath.size());
+
+		_benchmark.start(_benchmarkPath, _benchmarkFrames);
+		_benchmarkPath.clear();
+	}
+
+	_benchmark.beginFrame();
+}
+
+void GraphicsManager::endBenchmarkFrame() {
+	Common::StackLock lock(_benchmarkMutex);
+
+	if (_recordCamera)
+		_cameraRecording.addCurrent();
+
+	if (!_benchmark.endFrame(_renderStatistics))
+		return;
+
+	const BenchmarkResults &results = _benchmark.getResults();
+
+	status("Benchmark: %u frames, frame times: mean %.3fms, 50%% %.3fms, 90%% %.3fms, 99%% %.3fms, max %.3fms",
+	       results.frames, results.frameTimeMean, results.frameTime50,
+	       results.frameTime90, results.frameTime99, results.frameTimeMax);
+	status("Benchmark: %.1f draw calls and %.1f triangles per frame",
+	       results.drawCalls, results.triangles);
+
+	if (_benchmarkQuit) {
+		_benchmarkQuit = false;
+
+		EventMan.requestQuit();
+	}
+}
+
 void GraphicsManager::beginScene() {
+	beginBenchmarkFrame();
+
 	// Switch cursor on/off
 	if (_cursorState != kCursorStateStay)
 		handleCursorSwitch();
@@ -959,6 +1146,13 @@ void GraphicsManager::endScene() {
 
 	_fpsCounter->finishedFrame();
 
+	_frameNumber++;
+
+	_renderStatistics = _frameStatistics;
+	_frameStatistics.clear();
+
+	endBenchmarkFrame();
+
 	if (_fsaa > 0)
 		glDisable(GL_MULTISAMPLE_ARB);
 }
@@ -1090,8 +1284,12 @@ void GraphicsManager::cleanupAbandoned() {
 	for (std::list<ListID>::iterator l = _abandonLists.begin(); l != _abandonLists.end(); ++l)
 		glDeleteLists(*l, 1);
 
+	if (!_abandonBuffers.empty())
+		glDeleteBuffersARB(_abandonBuffers.size(), &_abandonBuffers[0]);
+
 	_abandonTextures.clear();
 	_abandonLists.clear();
+	_abandonBuffers.clear();
 
 	_hasAbandoned = false;
 }
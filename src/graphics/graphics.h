@@ -29,6 +29,7 @@
 #include <list>
 
 #include "graphics/types.h"
+#include "graphics/benchmark.h"
 
 #include "common/types.h"
 #include "common/singleton.h"
@@ -46,6 +47,19 @@ class FPSCounter;
 class Cursor;
 class Renderable;
 
+/** Statistics about the rendering of one frame. */
+struct RenderStatistics {
+	uint32 drawCalls;      ///< Number of draw calls issued.
+	uint32 triangles;      ///< Number of triangles drawn.
+	uint32 textureChanges; ///< Number of texture binds.
+	uint32 stateChanges;   ///< Number of vertex attribute layout changes.
+	uint32 uploadBytes;    ///< Number of geometry bytes handed to the GL.
+
+	RenderStatistics();
+
+	void clear();
+};
+
 /** The graphics manager. */
 class GraphicsManager : public Common::Singleton<GraphicsManager> {
 public:
@@ -60,10 +74,15 @@ public:
 	/** Was the graphics subsystem successfully initialized? */
 	bool ready() const;
 
+	/** Are we rendering into a hidden window, for benchmarks and tests? */
+	bool isHeadless() const;
+
 	/** Do we need to do manual S3TC DXTn decompression? */
 	bool needManualDeS3TC() const;
 	/** Do we have support for multiple textures? */
 	bool supportMultipleTextures() const;
+	/** Do we have support for buffer objects holding geometry? */
+	bool supportBufferObjects() const;
 
 	/** Set the screen size. */
 	void setScreenSize(int width, int height);
@@ -103,6 +122,33 @@ public:
 	/** How many frames per second to we render at the moments? */
 	uint32 getFPS() const;
 
+	/** Return the number of the frame currently rendered. */
+	uint32 getFrameNumber() const;
+
+	/** Return the rendering statistics of the last complete frame. */
+	const RenderStatistics &getRenderStatistics() const;
+
+	/** Count a draw call issued for the current frame. */
+	void countDrawCall(uint32 triangles);
+	/** Count a texture bind issued for the current frame. */
+	void countTextureChange();
+	/** Count a vertex attribute layout change issued for the current frame. */
+	void countStateChange();
+	/** Count geometry data handed to the GL in the current frame. */
+	void countUpload(uint32 bytes);
+
+	/** Start recording the camera position and orientation, once per frame. */
+	void startCameraRecording();
+	/** Stop recording the camera, returning the recorded path. */
+	void stopCameraRecording(CameraPath &path);
+
+	/** Render that many frames along the camera path, measuring each frame. */
+	void startBenchmark(const CameraPath &path, uint32 frames);
+	/** Is a benchmark currently running? */
+	bool isBenchmarkRunning() const;
+	/** Get the results of the last finished benchmark. Returns false if there are none. */
+	bool getBenchmarkResults(BenchmarkResults &results) const;
+
 	/** That the window's title. */
 	void setWindowTitle(const Common::UString &title);
 
@@ -147,6 +193,8 @@ public:
 	void abandon(TextureID *ids, uint32 count);
 	/** Abandon these lists. */
 	void abandon(ListID ids, uint32 count);
+	/** Abandon these buffer objects. */
+	void abandonBuffers(BufferID *ids, uint32 count);
 
 
 	/** Render one complete frame of the scene. */
@@ -165,8 +213,10 @@ private:
 	// Extensions
 	bool _needManualDeS3TC;        ///< Do we need to do manual S3TC DXTn decompression?
 	bool _supportMultipleTextures; ///< Do we have support for multiple textures?
+	bool _supportBufferObjects;    ///< Do we have support for buffer objects?
 
 	bool _fullScreen; ///< Are we currently in fullscreen mode?
+	bool _headless;   ///< Are we rendering into a hidden window?
 
 	bool _gl3;
 
@@ -182,6 +232,23 @@ private:
 	SDL_GLContext _glContext;
 
 	FPSCounter *_fpsCounter; ///< Counts the current frames per seconds value.
+
+	uint32 _frameNumber; ///< Number of frames rendered so far.
+
+	RenderStatistics _frameStatistics;  ///< Statistics of the frame currently rendered.
+	RenderStatistics _renderStatistics; ///< Statistics of the last complete frame.
+
+	RenderBenchmark _benchmark;     ///< The benchmark currently running.
+	CameraPath      _benchmarkPath; ///< The configured benchmark path, waiting for a world to render.
+
+	uint32 _benchmarkFrames; ///< Number of frames to render for the configured benchmark.
+	bool   _benchmarkQuit;   ///< Quit once the configured benchmark finished?
+
+	bool       _recordCamera;    ///< Are we recording the camera?
+	CameraPath _cameraRecording; ///< The camera path recorded so far.
+
+	mutable Common::Mutex _benchmarkMutex; ///< A mutex protecting the benchmark and camera recording.
+
 	uint32 _lastSampled; ///< Timestamp used to advance animations.
 	Common::TransformationMatrix _projection;    ///< Our projection matrix.
 	Common::TransformationMatrix _projectionInv; ///< The inverse of our projection matrix.
@@ -203,6 +270,7 @@ private:
 
 	std::vector<TextureID> _abandonTextures; ///< Abandoned textures.
 	std::list<ListID>      _abandonLists;    ///< Abandoned lists.
+	std::vector<BufferID>  _abandonBuffers;  ///< Abandoned buffer objects.
 
 	Common::Mutex _abandonMutex; ///< A mutex protecting abandoned structures.
 
@@ -232,6 +300,9 @@ private:
 
 	void buildNewTextures();
 
+	void beginBenchmarkFrame();
+	void endBenchmarkFrame();
+
 	void beginScene();
 	bool playVideo();
 	bool renderWorld();
@@ -30,6 +30,7 @@
 
 #include "graphics/images/decoder.h"
 #include "graphics/images/s3tc.h"
+#include "graphics/images/mipmaps.h"
 #include "graphics/images/dumptga.h"
 
 namespace Graphics {
@@ -104,16 +105,12 @@ void ImageDecoder::decompress(MipMap &out, const MipMap &in, PixelFormatRaw form
 	out.size   = out.width * out.height * 4;
 	out.data   = new byte[out.size];
 
-	Common::MemoryReadStream *stream = new Common::MemoryReadStream(in.data, in.size);
-
 	if      (format == kPixelFormatDXT1)
-		decompressDXT1(out.data, *stream, out.width, out.height, out.width * 4);
+		decompressDXT1(out.data, in.data, in.size, out.width, out.height, out.width * 4);
 	else if (format == kPixelFormatDXT3)
-		decompressDXT3(out.data, *stream, out.width, out.height, out.width * 4);
+		decompressDXT3(out.data, in.data, in.size, out.width, out.height, out.width * 4);
 	else if (format == kPixelFormatDXT5)
-		decompressDXT5(out.data, *stream, out.width, out.height, out.width * 4);
-
-	delete stream;
+		decompressDXT5(out.data, in.data, in.size, out.width, out.height, out.width * 4);
 }
 
 void ImageDecoder::decompress() {
@@ -134,6 +131,21 @@ void ImageDecoder::decompress() {
 	_compressed = false;
 }
 
+void ImageDecoder::generateMipMaps(MipMapFilter filter, bool gammaCorrect) {
+	if (_compressed || (_dataType != kPixelDataType8) || _mipMaps.empty())
+		return;
+
+	uint32 bpp;
+	if      ((_format == kPixelFormatRGBA) || (_format == kPixelFormatBGRA))
+		bpp = 4;
+	else if ((_format == kPixelFormatRGB ) || (_format == kPixelFormatBGR ))
+		bpp = 3;
+	else
+		return;
+
+	createMipMaps(_mipMaps, bpp, filter, gammaCorrect);
+}
+
 bool ImageDecoder::dumpTGA(const Common::UString &fileName) const {
 	if (_mipMaps.size() < 1)
 		return false;
@@ -79,6 +79,13 @@ public:
 	/** Manually decompress the texture image data. */
 	void decompress();
 
+	/** Create the missing mip maps of an uncompressed image, down to 1x1.
+	 *
+	 *  @param filter The filter to scale down the image with.
+	 *  @param gammaCorrect Filter the colors in linear space, instead of in sRGB?
+	 */
+	void generateMipMaps(MipMapFilter filter = kMipMapFilterKaiser, bool gammaCorrect = true);
+
 	/** Return TXI data, if embedded in the image. */
 	virtual Common::SeekableReadStream *getTXI() const;
 
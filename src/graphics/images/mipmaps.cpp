@@ -0,0 +1,446 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/images/mipmaps.cpp
+ *  Generating mip maps on the CPU.
+ */
+
+#include <cmath>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+
+#include "common/util.h"
+#include "common/maths.h"
+#include "common/threads.h"
+
+#include "graphics/images/mipmaps.h"
+
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
+/** Mip maps at least this large are filtered on several threads. */
+static const uint32 kParallelPixels = 128 * 128;
+
+/** Number of source pixels the Kaiser filter weights into each pixel, per axis. */
+static const uint32 kKaiserTaps = 6;
+/** Shape of the Kaiser window. Larger values give a smoother, less sharp result. */
+static const float kKaiserAlpha = 4.0f;
+/** Half-width of the Kaiser window, in destination pixels. */
+static const float kKaiserWidth = 1.5f;
+
+/** The alpha value an alpha-tested texture is tested against. */
+static const float kAlphaReference = 0.5f;
+/** Fraction of pixels that need to be fully opaque or transparent for the alpha to count as binary. */
+static const float kBinaryAlphaFraction = 0.9f;
+
+/** Number of entries in the linear to sRGB table. */
+static const uint32 kLinearSteps = 4096;
+
+namespace Graphics {
+
+/** Lookup tables converting between sRGB and linear values. */
+struct GammaTables {
+	float toLinear[256];
+	byte  toSRGB[kLinearSteps];
+
+	GammaTables();
+};
+
+GammaTables::GammaTables() {
+	for (uint32 i = 0; i < 256; i++) {
+		const float c = i / 255.0f;
+
+		toLinear[i] = (c <= 0.04045f) ? (c / 12.92f) : powf((c + 0.055f) / 1.055f, 2.4f);
+	}
+
+	for (uint32 i = 0; i < kLinearSteps; i++) {
+		const float l = i / (float) (kLinearSteps - 1);
+		const float c = (l <= 0.0031308f) ? (l * 12.92f) : (1.055f * powf(l, 1.0f / 2.4f) - 0.055f);
+
+		toSRGB[i] = CLIP<int>((int) (c * 255.0f + 0.5f), 0, 255);
+	}
+}
+
+static const GammaTables kGammaTables;
+
+
+/** An image with 4 floats per pixel, used while filtering. */
+struct FloatImage {
+	uint32 width;
+	uint32 height;
+
+	std::vector<float> pixels;
+
+	FloatImage() : width(0), height(0) {
+	}
+
+	void resize(uint32 w, uint32 h) {
+		width  = w;
+		height = h;
+
+		pixels.resize(width * height * 4);
+	}
+
+	void swap(FloatImage &right) {
+		SWAP(width , right.width );
+		SWAP(height, right.height);
+
+		pixels.swap(right.pixels);
+	}
+
+	float *getRow(uint32 y) {
+		return &pixels[y * width * 4];
+	}
+
+	const float *getRow(uint32 y) const {
+		return &pixels[y * width * 4];
+	}
+};
+
+
+/** A job working on the rows [rowStart, rowEnd) of an image. */
+typedef boost::function<void (uint32 rowStart, uint32 rowEnd)> RowJob;
+
+static void runRowPart(const RowJob &job, uint32 rows, uint32 part, uint32 partCount) {
+	job((rows * part) / partCount, (rows * (part + 1)) / partCount);
+}
+
+/** Run a job over all rows of an image, in parallel if the image is large enough. */
+static void runRows(const RowJob &job, uint32 width, uint32 height) {
+	uint32 partCount = 1;
+	if ((width * height) >= kParallelPixels)
+		partCount = MIN(Common::getParallelPartCount(), height);
+
+	if (partCount <= 1) {
+		job(0, height);
+		return;
+	}
+
+	Common::runParallel(boost::bind(&runRowPart, boost::cref(job), height, _1, _2), partCount);
+}
+
+
+static void convertToFloat(FloatImage *out, const ImageDecoder::MipMap *in, uint32 bpp, bool gammaCorrect,
+                           uint32 rowStart, uint32 rowEnd) {
+
+	for (uint32 y = rowStart; y < rowEnd; y++) {
+		const byte *src = in->data + y * in->width * bpp;
+		float      *dst = out->getRow(y);
+
+		for (uint32 x = 0; x < out->width; x++, src += bpp, dst += 4) {
+			for (uint32 c = 0; c < 3; c++)
+				dst[c] = gammaCorrect ? kGammaTables.toLinear[src[c]] : (src[c] / 255.0f);
+
+			dst[3] = (bpp == 4) ? (src[3] / 255.0f) : 1.0f;
+		}
+	}
+}
+
+static void convertToBytes(ImageDecoder::MipMap *out, const FloatImage *in, uint32 bpp, bool gammaCorrect,
+                           float alphaScale, uint32 rowStart, uint32 rowEnd) {
+
+	const float colorSteps = gammaCorrect ? (kLinearSteps - 1) : 255.0f;
+
+#ifdef __SSE2__
+	const __m128 scale = _mm_setr_ps(colorSteps, colorSteps, colorSteps, alphaScale * 255.0f);
+	const __m128 max   = _mm_setr_ps(colorSteps, colorSteps, colorSteps, 255.0f);
+	const __m128 zero  = _mm_setzero_ps();
+#endif
+
+	int32 steps[4];
+
+	for (uint32 y = rowStart; y < rowEnd; y++) {
+		const float *src = in->getRow(y);
+		byte        *dst = out->data + y * out->width * bpp;
+
+		for (uint32 x = 0; x < in->width; x++, src += 4, dst += bpp) {
+
+#ifdef __SSE2__
+			__m128 v = _mm_mul_ps(_mm_loadu_ps(src), scale);
+
+			v = _mm_min_ps(_mm_max_ps(v, zero), max);
+
+			_mm_storeu_si128((__m128i *) steps, _mm_cvtps_epi32(v));
+#else
+			for (uint32 c = 0; c < 3; c++)
+				steps[c] = (int32) (CLIP(src[c], 0.0f, 1.0f) * colorSteps + 0.5f);
+
+			steps[3] = (int32) (CLIP(src[3] * alphaScale, 0.0f, 1.0f) * 255.0f + 0.5f);
+#endif
+
+			for (uint32 c = 0; c < 3; c++)
+				dst[c] = gammaCorrect ? kGammaTables.toSRGB[steps[c]] : steps[c];
+
+			if (bpp == 4)
+				dst[3] = steps[3];
+		}
+	}
+}
+
+
+/** Set dst to the average of 4 pixels. */
+static inline void average4(float *dst, const float *a, const float *b, const float *c, const float *d) {
+#ifdef __SSE2__
+	const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)),
+	                              _mm_add_ps(_mm_loadu_ps(c), _mm_loadu_ps(d)));
+
+	_mm_storeu_ps(dst, _mm_mul_ps(sum, _mm_set1_ps(0.25f)));
+#else
+	for (uint32 i = 0; i < 4; i++)
+		dst[i] = (a[i] + b[i] + c[i] + d[i]) * 0.25f;
+#endif
+}
+
+static void downsampleBox(FloatImage *out, const FloatImage *in, uint32 rowStart, uint32 rowEnd) {
+	for (uint32 y = rowStart; y < rowEnd; y++) {
+		const float *row0 = in->getRow(MIN(2 * y    , in->height - 1));
+		const float *row1 = in->getRow(MIN(2 * y + 1, in->height - 1));
+
+		float *dst = out->getRow(y);
+
+		for (uint32 x = 0; x < out->width; x++, dst += 4) {
+			const uint32 x0 = MIN(2 * x    , in->width - 1) * 4;
+			const uint32 x1 = MIN(2 * x + 1, in->width - 1) * 4;
+
+			average4(dst, row0 + x0, row0 + x1, row1 + x0, row1 + x1);
+		}
+	}
+}
+
+
+/** Modified Bessel function of the first kind, order 0. */
+static float bessel0(float x) {
+	float sum  = 1.0f;
+	float term = 1.0f;
+
+	for (int k = 1; k < 20; k++) {
+		const float f = x / (2.0f * k);
+
+		term *= f * f;
+		sum  += term;
+	}
+
+	return sum;
+}
+
+/** Calculate the weights of the Kaiser filter's taps, for a downscale by 2. */
+static void getKaiserWeights(float *weights) {
+	float sum = 0.0f;
+
+	for (uint32 i = 0; i < kKaiserTaps; i++) {
+		// Distance of the source pixel to the destination pixel's center, in destination pixels
+		const float t = (i - (kKaiserTaps - 1) / 2.0f) / 2.0f;
+
+		const float sinc = (t == 0.0f) ? 1.0f : (sinf(M_PI * t) / (M_PI * t));
+
+		const float r = t / kKaiserWidth;
+		const float window = bessel0(kKaiserAlpha * sqrtf(MAX(1.0f - r * r, 0.0f))) / bessel0(kKaiserAlpha);
+
+		weights[i] = sinc * window;
+		sum += weights[i];
+	}
+
+	for (uint32 i = 0; i < kKaiserTaps; i++)
+		weights[i] /= sum;
+}
+
+/** Filter the rows horizontally, halving the width. */
+static void filterKaiserX(FloatImage *out, const FloatImage *in, const float *weights,
+                          uint32 rowStart, uint32 rowEnd) {
+
+	const int lastX = in->width - 1;
+
+	for (uint32 y = rowStart; y < rowEnd; y++) {
+		const float *src = in->getRow(y);
+		float       *dst = out->getRow(y);
+
+		for (uint32 x = 0; x < out->width; x++, dst += 4) {
+			const int first = (int) (2 * x) - (int) (kKaiserTaps / 2 - 1);
+
+#ifdef __SSE2__
+			__m128 sum = _mm_setzero_ps();
+
+			for (uint32 i = 0; i < kKaiserTaps; i++) {
+				const float *p = src + CLIP<int>(first + i, 0, lastX) * 4;
+
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(p), _mm_set1_ps(weights[i])));
+			}
+
+			_mm_storeu_ps(dst, sum);
+#else
+			dst[0] = dst[1] = dst[2] = dst[3] = 0.0f;
+
+			for (uint32 i = 0; i < kKaiserTaps; i++) {
+				const float *p = src + CLIP<int>(first + i, 0, lastX) * 4;
+
+				for (uint32 c = 0; c < 4; c++)
+					dst[c] += p[c] * weights[i];
+			}
+#endif
+		}
+	}
+}
+
+/** Filter the columns vertically, halving the height. */
+static void filterKaiserY(FloatImage *out, const FloatImage *in, const float *weights,
+                          uint32 rowStart, uint32 rowEnd) {
+
+	const int    lastY  = in->height - 1;
+	const uint32 floats = out->width * 4;
+
+	const float *rows[kKaiserTaps];
+
+	for (uint32 y = rowStart; y < rowEnd; y++) {
+		const int first = (int) (2 * y) - (int) (kKaiserTaps / 2 - 1);
+
+		for (uint32 i = 0; i < kKaiserTaps; i++)
+			rows[i] = in->getRow(CLIP<int>(first + i, 0, lastY));
+
+		float *dst = out->getRow(y);
+
+		// The negative lobes can overshoot, so clamp the result
+
+#ifdef __SSE2__
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+
+		for (uint32 n = 0; n < floats; n += 4) {
+			__m128 sum = _mm_setzero_ps();
+
+			for (uint32 i = 0; i < kKaiserTaps; i++)
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[i] + n), _mm_set1_ps(weights[i])));
+
+			_mm_storeu_ps(dst + n, _mm_min_ps(_mm_max_ps(sum, zero), one));
+		}
+#else
+		for (uint32 n = 0; n < floats; n++) {
+			float sum = 0.0f;
+
+			for (uint32 i = 0; i < kKaiserTaps; i++)
+				sum += rows[i][n] * weights[i];
+
+			dst[n] = CLIP(sum, 0.0f, 1.0f);
+		}
+#endif
+	}
+}
+
+
+/** Is the alpha of this RGBA mip map mostly either fully opaque or fully transparent? */
+static bool hasBinaryAlpha(const ImageDecoder::MipMap &mipMap) {
+	const uint32 pixels = mipMap.width * mipMap.height;
+
+	uint32 binary = 0;
+	for (uint32 i = 0; i < pixels; i++)
+		if ((mipMap.data[i * 4 + 3] == 0) || (mipMap.data[i * 4 + 3] == 255))
+			binary++;
+
+	return binary >= (pixels * kBinaryAlphaFraction);
+}
+
+/** Return the fraction of pixels that pass the alpha test, with the alpha scaled. */
+static float getAlphaCoverage(const FloatImage &image, float alphaScale) {
+	const uint32 pixels = image.width * image.height;
+
+	uint32 covered = 0;
+	for (uint32 i = 0; i < pixels; i++)
+		if ((image.pixels[i * 4 + 3] * alphaScale) > kAlphaReference)
+			covered++;
+
+	return covered / (float) pixels;
+}
+
+/** Find the alpha scale that gives the image this alpha test coverage. */
+static float findAlphaScale(const FloatImage &image, float coverage) {
+	float minScale = 0.0f;
+	float maxScale = 4.0f;
+
+	for (int i = 0; i < 16; i++) {
+		const float scale = (minScale + maxScale) / 2.0f;
+
+		if (getAlphaCoverage(image, scale) < coverage)
+			minScale = scale;
+		else
+			maxScale = scale;
+	}
+
+	return (minScale + maxScale) / 2.0f;
+}
+
+
+void createMipMaps(std::vector<ImageDecoder::MipMap *> &mipMaps, uint32 bpp,
+                   MipMapFilter filter, bool gammaCorrect) {
+
+	assert(!mipMaps.empty() && ((bpp == 3) || (bpp == 4)));
+
+	const ImageDecoder::MipMap &first = *mipMaps.back();
+	if ((first.width <= 1) && (first.height <= 1))
+		return;
+
+	// Each mip map is filtered from the unrounded floats of the previous one
+
+	FloatImage current, next, temp;
+
+	current.resize(first.width, first.height);
+	runRows(boost::bind(&convertToFloat, &current, &first, bpp, gammaCorrect, _1, _2),
+	        current.width, current.height);
+
+	float coverage = 0.0f;
+	if ((bpp == 4) && hasBinaryAlpha(first))
+		coverage = getAlphaCoverage(current, 1.0f);
+
+	// Nothing to preserve in fully opaque or fully transparent images
+	const bool keepCoverage = (coverage > 0.0f) && (coverage < 1.0f);
+
+	float weights[kKaiserTaps];
+	getKaiserWeights(weights);
+
+	while ((current.width > 1) || (current.height > 1)) {
+		next.resize(MAX<uint32>(current.width / 2, 1), MAX<uint32>(current.height / 2, 1));
+
+		if (filter == kMipMapFilterKaiser) {
+			temp.resize(next.width, current.height);
+
+			runRows(boost::bind(&filterKaiserX, &temp, &current, weights, _1, _2), temp.width, temp.height);
+			runRows(boost::bind(&filterKaiserY, &next, &temp, weights, _1, _2), next.width, next.height);
+		} else
+			runRows(boost::bind(&downsampleBox, &next, &current, _1, _2), next.width, next.height);
+
+		// Only ever scale up, filtering makes the alpha-tested parts shrink
+		const float alphaScale = keepCoverage ? MAX(findAlphaScale(next, coverage), 1.0f) : 1.0f;
+
+		ImageDecoder::MipMap *mipMap = new ImageDecoder::MipMap;
+		mipMaps.push_back(mipMap);
+
+		mipMap->width  = next.width;
+		mipMap->height = next.height;
+		mipMap->size   = next.width * next.height * bpp;
+		mipMap->data   = new byte[mipMap->size];
+
+		runRows(boost::bind(&convertToBytes, mipMap, &next, bpp, gammaCorrect, alphaScale, _1, _2),
+		        next.width, next.height);
+
+		current.swap(next);
+	}
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,55 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/images/mipmaps.h
+ *  Generating mip maps on the CPU.
+ */
+
+#ifndef GRAPHICS_IMAGES_MIPMAPS_H
+#define GRAPHICS_IMAGES_MIPMAPS_H
+
+#include <vector>
+
+#include "common/types.h"
+
+#include "graphics/types.h"
+#include "graphics/images/decoder.h"
+
+namespace Graphics {
+
+/** Create all missing mip maps of an 8-bit RGB(A) image, down to 1x1.
+ *
+ *  Each mip map is filtered from the previous one, at floating point
+ *  precision. With gammaCorrect, the colors are filtered in linear
+ *  space instead of in sRGB. If the alpha channel of the largest mip
+ *  map is (nearly) binary, like in an alpha-tested texture, the alpha
+ *  of each mip map is scaled to keep the same alpha-tested coverage.
+ *
+ *  @param mipMaps The image's mip maps. The missing ones are appended.
+ *  @param bpp The number of bytes per pixel, 3 or 4.
+ *  @param filter The filter to use.
+ *  @param gammaCorrect Filter the colors in linear space?
+ */
+void createMipMaps(std::vector<ImageDecoder::MipMap *> &mipMaps, uint32 bpp,
+                   MipMapFilter filter, bool gammaCorrect);
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_IMAGES_MIPMAPS_H
@@ -22,177 +22,336 @@
  *  Manual S3TC DXTn decompression methods.
  */
 
+#include <cstring>
+
+#include <boost/bind.hpp>
+
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
 #include "common/util.h"
-#include "common/stream.h"
+#include "common/error.h"
+#include "common/threads.h"
 
 #include "graphics/images/s3tc.h"
 
 namespace Graphics {
 
-static uint32 convert565To8888(uint16 color) {
-	return ((color & 0x1F) << 11) | ((color & 0x7E0) << 13) | ((color & 0xF800) << 16) | 0xFF;
-}
-
-static uint32 interpolate32(double weight, uint32 color_0, uint32 color_1) {
-	byte r[3], g[3], b[3], a[3];
-	r[0] = color_0 >> 24;
-	r[1] = color_1 >> 24;
-	r[2] = (byte)((1.0f - weight) * (double)r[0] + weight * (double)r[1]);
-	g[0] = (color_0 >> 16) & 0xFF;
-	g[1] = (color_1 >> 16) & 0xFF;
-	g[2] = (byte)((1.0f - weight) * (double)g[0] + weight * (double)g[1]);
-	b[0] = (color_0 >> 8) & 0xFF;
-	b[1] = (color_1 >> 8) & 0xFF;
-	b[2] = (byte)((1.0f - weight) * (double)b[0] + weight * (double)b[1]);
-	a[0] = color_0 & 0xFF;
-	a[1] = color_1 & 0xFF;
-	a[2] = (byte)((1.0f - weight) * (double)a[0] + weight * (double)a[1]);
-	return r[2] << 24 | g[2] << 16 | b[2] << 8 | a[2];
-}
-
-struct DXT1Texel {
-	uint16 color_0;
-	uint16 color_1;
-	uint32 pixels;
+/** The different S3TC block formats. */
+enum DXTFormat {
+	kDXT1,
+	kDXT3,
+	kDXT5
 };
 
-#define READ_DXT1_TEXEL(x) \
-	x.color_0 = src.readUint16LE(); \
-	x.color_1 = src.readUint16LE(); \
-	x.pixels = src.readUint32BE()
-
-void decompressDXT1(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch) {
-	for (int32 ty = height; ty > 0; ty -= 4) {
-		for (uint32 tx = 0; tx < width; tx += 4) {
-			DXT1Texel tex;
-			READ_DXT1_TEXEL(tex);
-			uint32 blended[4];
-
-			blended[0] = convert565To8888(tex.color_0);
-			blended[1] = convert565To8888(tex.color_1);
-
-			if (tex.color_0 > tex.color_1) {
-				blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-				blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
-			} else {
-				blended[2] = interpolate32(0.5f, blended[0], blended[1]);
-				blended[3] = 0;
-			}
-
-			uint32 cpx = tex.pixels;
-			uint32 blockWidth = MIN<uint32>(width, 4);
-			uint32 blockHeight = MIN<uint32>(height, 4);
-
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					WRITE_BE_UINT32(dest + (height - 1 - (ty - blockHeight + y)) * pitch + (tx + x) * 4, blended[cpx & 3]);
-					cpx >>= 2;
-				}
-			}
+/** Mip maps with at least that many pixels are decompressed by several threads. */
+static const uint32 kParallelPixels = 256 * 256;
+
+/** The 4 colors a block's texels can choose from, in RGBA byte order. */
+typedef byte BlockColors[4][4];
+
+static uint32 getBlockSize(DXTFormat format) {
+	return (format == kDXT1) ? 8 : 16;
+}
+
+static void convert565To888(byte *color, uint16 c) {
+	color[0] = ((c >> 11) & 0x1F) << 3;
+	color[1] = ((c >>  5) & 0x3F) << 2;
+	color[2] = ( c        & 0x1F) << 3;
+}
+
+/** Interpolate a third of the way from a to b, truncated with the bias of a 0.333333 weight. */
+static inline byte interpolateOneThird(byte a, byte b) {
+	return ((2 * a + b - (b > a ? 1 : 0)) * 0xAAAB) >> 17;
+}
+
+/** Interpolate two thirds of the way from a to b, truncated with the bias of a 0.666666 weight. */
+static inline byte interpolateTwoThirds(byte a, byte b) {
+	return ((a + 2 * b - (b > a ? 1 : 0)) * 0xAAAB) >> 17;
+}
+
+/** Read the colors of a block.
+ *
+ *  DXT1 blocks with color_0 <= color_1 have only 3 colors and a fully
+ *  transparent black. DXT3 and DXT5 blocks always have 4 colors, leaving
+ *  the alpha to their alpha block.
+ */
+static void readColors(BlockColors colors, const byte *block, DXTFormat format) {
+	const uint16 color0 = READ_LE_UINT16(block + 0);
+	const uint16 color1 = READ_LE_UINT16(block + 2);
+
+	const byte alpha = (format == kDXT1) ? 0xFF : 0x00;
+
+	convert565To888(colors[0], color0);
+	convert565To888(colors[1], color1);
+
+	colors[0][3] = alpha;
+	colors[1][3] = alpha;
+
+	if ((format != kDXT1) || (color0 > color1)) {
+		for (int i = 0; i < 4; i++) {
+			colors[2][i] = interpolateOneThird (colors[0][i], colors[1][i]);
+			colors[3][i] = interpolateTwoThirds(colors[0][i], colors[1][i]);
+		}
+	} else {
+		for (int i = 0; i < 4; i++) {
+			colors[2][i] = (colors[0][i] + colors[1][i]) >> 1;
+			colors[3][i] = 0;
 		}
 	}
 }
 
-struct DXT23Texel : public DXT1Texel {
-	uint16 alpha[4];
-};
+/** Read the explicit 4-bit alpha values of a DXT3 block. */
+static void readAlphaDXT3(byte *alphas, const byte *block) {
+	for (int y = 0; y < 4; y++) {
+		const uint16 row = READ_LE_UINT16(block + y * 2);
+
+		for (int x = 0; x < 4; x++)
+			*alphas++ = ((row >> (x * 4)) & 0xF) << 4;
+	}
+}
+
+/** Read the interpolated alpha values of a DXT5 block. */
+static void readAlphaDXT5(byte *alphas, const byte *block) {
+	byte table[8];
+
+	table[0] = block[0];
+	table[1] = block[1];
 
-#define READ_DXT3_TEXEL(x) \
-	x.alpha[0] = src.readUint16LE(); \
-	x.alpha[1] = src.readUint16LE(); \
-	x.alpha[2] = src.readUint16LE(); \
-	x.alpha[3] = src.readUint16LE(); \
-	READ_DXT1_TEXEL(x)
-
-void decompressDXT3(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch) {
-	for (int32 ty = height; ty > 0; ty -= 4) {
-		for (uint32 tx = 0; tx < width; tx += 4) {
-			DXT23Texel tex;
-			uint32 blended[4];
-			READ_DXT3_TEXEL(tex);
-
-			blended[0] = convert565To8888(tex.color_0) & 0xFFFFFF00;
-			blended[1] = convert565To8888(tex.color_1) & 0xFFFFFF00;
-			blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-			blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
-
-			uint32 cpx = tex.pixels;
-			uint32 blockWidth = MIN<uint32>(width, 4);
-			uint32 blockHeight = MIN<uint32>(height, 4);
-
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					uint32 alpha = (tex.alpha[y] >> (x * 4)) & 0xF;
-					WRITE_BE_UINT32(dest + (height - 1 - (ty - blockHeight + y)) * pitch + (tx + x) * 4, blended[cpx & 3] | alpha << 4);
-					cpx >>= 2;
-				}
-			}
+	if (table[0] > table[1]) {
+		for (int i = 2; i < 8; i++)
+			table[i] = ((8 - i) * table[0] + (i - 1) * table[1] + 3) / 7;
+	} else {
+		for (int i = 2; i < 6; i++)
+			table[i] = ((6 - i) * table[0] + (i - 1) * table[1] + 2) / 5;
+
+		table[6] = 0;
+		table[7] = 255;
+	}
+
+	// 3-bit indices, 8 of them in each 24 bits
+	for (int i = 0; i < 2; i++) {
+		const byte *indexData = block + 2 + i * 3;
+
+		uint32 indices = indexData[0] | (indexData[1] << 8) | (indexData[2] << 16);
+
+		for (int j = 0; j < 8; j++, indices >>= 3)
+			*alphas++ = table[indices & 7];
+	}
+}
+
+/** Read the alpha values of a DXT3 or DXT5 block. */
+static void readAlpha(byte *alphas, const byte *block, DXTFormat format) {
+	if      (format == kDXT3)
+		readAlphaDXT3(alphas, block);
+	else if (format == kDXT5)
+		readAlphaDXT5(alphas, block);
+}
+
+/** Decompress a block, texel by texel, cutting it off at the image border. */
+template<DXTFormat format>
+static void decompressBlockPartial(byte *dest, uint32 pitch, const byte *block,
+                                   uint32 blockWidth, uint32 blockHeight) {
+
+	// DXT3 and DXT5 blocks start with the alpha, followed by a DXT1-like color block
+	const byte *colorBlock = (format == kDXT1) ? block : (block + 8);
+
+	byte alphas[16];
+	if (format != kDXT1)
+		readAlpha(alphas, block, format);
+
+	BlockColors colors;
+	readColors(colors, colorBlock, format);
+
+	const uint32 indices = READ_LE_UINT32(colorBlock + 4);
+
+	for (uint32 y = 0; y < blockHeight; y++, dest += pitch) {
+		for (uint32 x = 0; x < blockWidth; x++) {
+			const uint32 i = y * 4 + x;
+
+			byte *pixel = dest + x * 4;
+
+			memcpy(pixel, colors[(indices >> (i * 2)) & 3], 4);
+			if (format != kDXT1)
+				pixel[3] = alphas[i];
 		}
 	}
 }
 
-struct DXT45Texel : public DXT1Texel {
-	byte alpha_0;
-	byte alpha_1;
-	uint64 alphabl;
-};
+#ifdef __SSE2__
+
+/** Read the colors of a block, as 4 RGBA values in one register. */
+template<DXTFormat format>
+static inline __m128i readColorsSSE2(const byte *block) {
+	const uint16 color0 = READ_LE_UINT16(block + 0);
+	const uint16 color1 = READ_LE_UINT16(block + 2);
+
+	if ((format == kDXT1) && (color0 <= color1)) {
+		BlockColors colors;
+		readColors(colors, block, format);
+
+		return _mm_loadu_si128((const __m128i *) colors);
+	}
+
+	const short alpha = (format == kDXT1) ? 0xFF : 0x00;
+
+	// The first two colors, one channel per 16-bit value
+	const __m128i colors01 = _mm_set_epi16(alpha, (color1 & 0x1F) << 3, ((color1 >> 5) & 0x3F) << 2, ((color1 >> 11) & 0x1F) << 3,
+	                                       alpha, (color0 & 0x1F) << 3, ((color0 >> 5) & 0x3F) << 2, ((color0 >> 11) & 0x1F) << 3);
+
+	const __m128i colors10 = _mm_shuffle_epi32(colors01, _MM_SHUFFLE(1, 0, 3, 2));
+
+	// Bias exact thirds down where color_1 is the larger one, see interpolateOneThird()
+	const __m128i bias = _mm_cmpgt_epi16(_mm_unpackhi_epi64(colors01, colors01),
+	                                     _mm_unpacklo_epi64(colors01, colors01));
 
-static uint64 readUint48LE(Common::SeekableReadStream &src) {
-	uint64 output = src.readUint32LE();
-	return output | ((uint64)src.readUint16LE() << 32);
-}
-
-#define READ_DXT5_TEXEL(x) \
-	x.alpha_0 = src.readByte(); \
-	x.alpha_1 = src.readByte(); \
-	x.alphabl = readUint48LE(src); \
-	READ_DXT1_TEXEL(x)
-
-void decompressDXT5(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch) {
-	for (int32 ty = height; ty > 0; ty -= 4) {
-		for (uint32 tx = 0; tx < width; tx += 4) {
-			uint32 blended[4];
-			byte alphab[8];
-			DXT45Texel tex;
-			READ_DXT5_TEXEL(tex);
-
-			alphab[0] = tex.alpha_0;
-			alphab[1] = tex.alpha_1;
-
-			if (tex.alpha_0 > tex.alpha_1) {
-				alphab[2] = (byte)((6.0f * (double)alphab[0] + 1.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[3] = (byte)((5.0f * (double)alphab[0] + 2.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[4] = (byte)((4.0f * (double)alphab[0] + 3.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[5] = (byte)((3.0f * (double)alphab[0] + 4.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[6] = (byte)((2.0f * (double)alphab[0] + 5.0f * (double)alphab[1] + 3.0f) / 7.0f);
-				alphab[7] = (byte)((1.0f * (double)alphab[0] + 6.0f * (double)alphab[1] + 3.0f) / 7.0f);
-			} else {
-				alphab[2] = (byte)((4.0f * (double)alphab[0] + 1.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[3] = (byte)((3.0f * (double)alphab[0] + 2.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[4] = (byte)((2.0f * (double)alphab[0] + 3.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[5] = (byte)((1.0f * (double)alphab[0] + 4.0f * (double)alphab[1] + 2.0f) / 5.0f);
-				alphab[6] = 0;
-				alphab[7] = 255;
-			}
-
-			blended[0] = convert565To8888(tex.color_0) & 0xFFFFFF00;
-			blended[1] = convert565To8888(tex.color_1) & 0xFFFFFF00;
-			blended[2] = interpolate32(0.333333f, blended[0], blended[1]);
-			blended[3] = interpolate32(0.666666f, blended[0], blended[1]);
-
-			uint32 cpx = tex.pixels;
-			uint32 blockWidth = MIN<uint32>(width, 4);
-			uint32 blockHeight = MIN<uint32>(height, 4);
-
-			for (byte y = 0; y < blockHeight; ++y) {
-				for (byte x = 0; x < blockWidth; ++x) {
-					uint32 alpha = alphab[(tex.alphabl >> (3 * (4 * (3 - y) + x))) & 7];
-					WRITE_BE_UINT32(dest + (height - 1 - (ty - blockHeight + y)) * pitch + (tx + x) * 4, blended[cpx & 3] | alpha);
-					cpx >>= 2;
-				}
-			}
+	// (2 * color_0 + color_1) / 3 and (2 * color_1 + color_0) / 3
+	__m128i colors23 = _mm_add_epi16(_mm_add_epi16(colors01, colors01), _mm_add_epi16(colors10, bias));
+	colors23 = _mm_srli_epi16(_mm_mulhi_epu16(colors23, _mm_set1_epi16((short) 0xAAAB)), 1);
+
+	return _mm_packus_epi16(colors01, colors23);
+}
+
+/** Move the first 4 bytes into the alpha channel of 4 RGBA pixels. */
+static inline __m128i expandAlpha(__m128i alpha) {
+	return _mm_unpacklo_epi16(_mm_setzero_si128(), _mm_unpacklo_epi8(_mm_setzero_si128(), alpha));
+}
+
+/** Decompress a whole block, a row of 4 texels at once. */
+template<DXTFormat format>
+static void decompressBlock(byte *dest, uint32 pitch, const byte *block) {
+	const byte *colorBlock = (format == kDXT1) ? block : (block + 8);
+
+	const __m128i colors = readColorsSSE2<format>(colorBlock);
+
+	const __m128i color0 = _mm_shuffle_epi32(colors, _MM_SHUFFLE(0, 0, 0, 0));
+	const __m128i color1 = _mm_shuffle_epi32(colors, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128i color2 = _mm_shuffle_epi32(colors, _MM_SHUFFLE(2, 2, 2, 2));
+	const __m128i color3 = _mm_shuffle_epi32(colors, _MM_SHUFFLE(3, 3, 3, 3));
+
+	// The 2-bit index of each texel in a row, still at its position within the row's byte
+	const __m128i indexMask = _mm_set_epi32(0xC0, 0x30, 0x0C, 0x03);
+	const __m128i index1    = _mm_set_epi32(0x40, 0x10, 0x04, 0x01);
+	const __m128i index2    = _mm_set_epi32(0x80, 0x20, 0x08, 0x02);
+
+	uint32 indices = READ_LE_UINT32(colorBlock + 4);
+
+	__m128i alpha = _mm_setzero_si128();
+	if (format != kDXT1) {
+		byte alphas[16];
+		readAlpha(alphas, block, format);
+
+		alpha = _mm_loadu_si128((const __m128i *) alphas);
+	}
+
+	for (uint32 y = 0; y < 4; y++, dest += pitch, indices >>= 8) {
+		const __m128i index = _mm_and_si128(_mm_set1_epi32(indices & 0xFF), indexMask);
+
+		__m128i pixels;
+
+		pixels =                      _mm_and_si128(_mm_cmpeq_epi32(index, _mm_setzero_si128()), color0);
+		pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_cmpeq_epi32(index, index1)             , color1));
+		pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_cmpeq_epi32(index, index2)             , color2));
+		pixels = _mm_or_si128(pixels, _mm_and_si128(_mm_cmpeq_epi32(index, indexMask)          , color3));
+
+		if (format != kDXT1) {
+			pixels = _mm_or_si128(pixels, expandAlpha(alpha));
+			alpha  = _mm_srli_si128(alpha, 4);
+		}
+
+		_mm_storeu_si128((__m128i *) dest, pixels);
+	}
+}
+
+#else
+
+template<DXTFormat format>
+static void decompressBlock(byte *dest, uint32 pitch, const byte *block) {
+	decompressBlockPartial<format>(dest, pitch, block, 4, 4);
+}
+
+#endif
+
+/** Decompress the block rows [rowStart, rowEnd) of an image. */
+template<DXTFormat format>
+static void decompressBlockRows(byte *dest, const byte *src, uint32 width, uint32 height, uint32 pitch,
+                                uint32 rowStart, uint32 rowEnd) {
+
+	const uint32 blockSize = getBlockSize(format);
+	const uint32 blocksX   = (width + 3) / 4;
+
+	const byte *block = src + rowStart * blocksX * blockSize;
+
+	for (uint32 by = rowStart; by < rowEnd; by++) {
+		const uint32 blockHeight = MIN<uint32>(height - by * 4, 4);
+
+		byte *row = dest + by * 4 * pitch;
+
+		for (uint32 bx = 0; bx < blocksX; bx++, block += blockSize) {
+			const uint32 blockWidth = MIN<uint32>(width - bx * 4, 4);
+
+			if ((blockWidth == 4) && (blockHeight == 4))
+				decompressBlock<format>(row + bx * 16, pitch, block);
+			else
+				decompressBlockPartial<format>(row + bx * 16, pitch, block, blockWidth, blockHeight);
 		}
 	}
 }
 
+static void decompressBlockRows(DXTFormat format, byte *dest, const byte *src,
+                                uint32 width, uint32 height, uint32 pitch, uint32 rowStart, uint32 rowEnd) {
+
+	if      (format == kDXT1)
+		decompressBlockRows<kDXT1>(dest, src, width, height, pitch, rowStart, rowEnd);
+	else if (format == kDXT3)
+		decompressBlockRows<kDXT3>(dest, src, width, height, pitch, rowStart, rowEnd);
+	else if (format == kDXT5)
+		decompressBlockRows<kDXT5>(dest, src, width, height, pitch, rowStart, rowEnd);
+}
+
+/** Decompress one part of an image decompressed by several threads. */
+static void decompressPart(DXTFormat format, byte *dest, const byte *src,
+                           uint32 width, uint32 height, uint32 pitch, uint32 part, uint32 partCount) {
+
+	const uint32 blocksY = (height + 3) / 4;
+
+	decompressBlockRows(format, dest, src, width, height, pitch,
+	                    (blocksY *  part     ) / partCount,
+	                    (blocksY * (part + 1)) / partCount);
+}
+
+static void decompress(DXTFormat format, byte *dest, const byte *src, uint32 size,
+                       uint32 width, uint32 height, uint32 pitch) {
+
+	const uint32 blocksX = (width  + 3) / 4;
+	const uint32 blocksY = (height + 3) / 4;
+
+	if (size < (blocksX * blocksY * getBlockSize(format)))
+		throw Common::Exception("Not enough DXT data for a %ux%u image (%u bytes)", width, height, size);
+
+	uint32 partCount = 1;
+	if ((width * height) >= kParallelPixels)
+		partCount = MIN(Common::getParallelPartCount(), blocksY);
+
+	if (partCount <= 1) {
+		decompressBlockRows(format, dest, src, width, height, pitch, 0, blocksY);
+		return;
+	}
+
+	Common::runParallel(boost::bind(&decompressPart, format, dest, src, width, height, pitch, _1, _2), partCount);
+}
+
+void decompressDXT1(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch) {
+	decompress(kDXT1, dest, src, size, width, height, pitch);
+}
+
+void decompressDXT3(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch) {
+	decompress(kDXT3, dest, src, size, width, height, pitch);
+}
+
+void decompressDXT5(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch) {
+	decompress(kDXT5, dest, src, size, width, height, pitch);
+}
+
 } // End of namespace Graphics
@@ -27,15 +27,14 @@
 
 #include "common/types.h"
 
-namespace Common {
-	class SeekableReadStream;
-}
-
 namespace Graphics {
 
-void decompressDXT1(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch);
-void decompressDXT3(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch);
-void decompressDXT5(byte *dest, Common::SeekableReadStream &src, uint32 width, uint32 height, uint32 pitch);
+/** Decompress DXT1 data of that size into RGBA8 pixels, with rows pitch bytes apart. */
+void decompressDXT1(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch);
+/** Decompress DXT3 data of that size into RGBA8 pixels, with rows pitch bytes apart. */
+void decompressDXT3(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch);
+/** Decompress DXT5 data of that size into RGBA8 pixels, with rows pitch bytes apart. */
+void decompressDXT5(byte *dest, const byte *src, uint32 size, uint32 width, uint32 height, uint32 pitch);
 
 } // End of namespace Graphics
 
@@ -0,0 +1,205 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/images/s3tcbench.cpp
+ *  Checking and measuring the S3TC DXTn decompression.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+
+#include "graphics/images/s3tc.h"
+#include "graphics/images/s3tcbench.h"
+
+namespace Graphics {
+
+/** Interpolate two RGBA colors with doubles, the way the S3TC decoder used to. */
+static uint32 interpolateReference(double weight, uint32 color0, uint32 color1) {
+	uint32 color = 0;
+
+	for (int i = 0; i < 32; i += 8) {
+		const byte c0 = (color0 >> i) & 0xFF;
+		const byte c1 = (color1 >> i) & 0xFF;
+
+		color |= ((byte)((1.0f - weight) * (double)c0 + weight * (double)c1)) << i;
+	}
+
+	return color;
+}
+
+/** Convert a 565 color into a big-endian RGBA value. */
+static uint32 convert565Reference(uint16 color, byte alpha) {
+	return ((color & 0x1F) << 11) | ((color & 0x7E0) << 13) | ((color & 0xF800) << 16) | alpha;
+}
+
+/** Decompress a DXTn image texel by texel, with the old S3TC decoder's arithmetic. */
+static void decompressReference(int dxt, byte *dest, const byte *src, uint32 width, uint32 height) {
+	const uint32 blockSize = (dxt == 1) ? 8 : 16;
+	const uint32 blocksX   = (width + 3) / 4;
+
+	for (uint32 y = 0; y < height; y++) {
+		for (uint32 x = 0; x < width; x++, dest += 4) {
+			const byte  *block      = src + ((y / 4) * blocksX + (x / 4)) * blockSize;
+			const byte  *colorBlock = (dxt == 1) ? block : (block + 8);
+			const uint32 texel      = (y % 4) * 4 + (x % 4);
+
+			const uint16 c0 = READ_LE_UINT16(colorBlock + 0);
+			const uint16 c1 = READ_LE_UINT16(colorBlock + 2);
+
+			uint32 colors[4];
+			colors[0] = convert565Reference(c0, (dxt == 1) ? 0xFF : 0x00);
+			colors[1] = convert565Reference(c1, (dxt == 1) ? 0xFF : 0x00);
+
+			if ((dxt != 1) || (c0 > c1)) {
+				colors[2] = interpolateReference(0.333333f, colors[0], colors[1]);
+				colors[3] = interpolateReference(0.666666f, colors[0], colors[1]);
+			} else {
+				colors[2] = interpolateReference(0.5f, colors[0], colors[1]);
+				colors[3] = 0;
+			}
+
+			uint32 pixel = colors[(READ_LE_UINT32(colorBlock + 4) >> (texel * 2)) & 3];
+
+			if (dxt == 3) {
+				pixel |= ((READ_LE_UINT16(block + (y % 4) * 2) >> ((x % 4) * 4)) & 0xF) << 4;
+			} else if (dxt == 5) {
+				const double a0 = block[0];
+				const double a1 = block[1];
+
+				const uint64 indices = READ_LE_UINT32(block + 2) | ((uint64) READ_LE_UINT16(block + 6) << 32);
+				const uint32 index   = (indices >> (texel * 3)) & 7;
+
+				if      (index < 2)
+					pixel |= block[index];
+				else if (block[0] > block[1])
+					pixel |= (byte)(((8 - index) * a0 + (index - 1) * a1 + 3.0f) / 7.0f);
+				else if (index < 6)
+					pixel |= (byte)(((6 - index) * a0 + (index - 1) * a1 + 2.0f) / 5.0f);
+				else
+					pixel |= (index == 6) ? 0 : 255;
+			}
+
+			WRITE_BE_UINT32(dest, pixel);
+		}
+	}
+}
+
+/** Decompress a DXTn image with the regular decoder. */
+static void decompress(int dxt, byte *dest, const byte *src, uint32 size, uint32 width, uint32 height) {
+	if      (dxt == 1)
+		decompressDXT1(dest, src, size, width, height, width * 4);
+	else if (dxt == 3)
+		decompressDXT3(dest, src, size, width, height, width * 4);
+	else if (dxt == 5)
+		decompressDXT5(dest, src, size, width, height, width * 4);
+}
+
+static uint32 getSize(int dxt, uint32 width, uint32 height) {
+	return ((width + 3) / 4) * ((height + 3) / 4) * ((dxt == 1) ? 8 : 16);
+}
+
+/** Count the pixels the decoder gets wrong in a random DXTn image. */
+static uint32 check(int dxt, const byte *data, uint32 width, uint32 height,
+                    byte *output, double &referenceTime) {
+
+	std::vector<byte> reference(width * height * 4);
+
+	const uint64 start = SDL_GetPerformanceCounter();
+
+	decompressReference(dxt, &reference[0], data, width, height);
+
+	referenceTime = ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+
+	uint32 mismatches = 0;
+	for (uint32 i = 0; i < width * height; i++)
+		if (std::memcmp(output + i * 4, &reference[i * 4], 4))
+			mismatches++;
+
+	return mismatches;
+}
+
+/** Count the pixels of random DXTn images of all sizes up to 9x9 the decoder gets wrong. */
+static uint32 checkSmall(int dxt) {
+	uint32 mismatches = 0;
+
+	for (uint32 width = 1; width <= 9; width++) {
+		for (uint32 height = 1; height <= 9; height++) {
+			const uint32 size = getSize(dxt, width, height);
+
+			std::vector<byte> data(size);
+			for (uint32 i = 0; i < size; i++)
+				data[i] = std::rand();
+
+			std::vector<byte> output(width * height * 4);
+
+			decompress(dxt, &output[0], &data[0], size, width, height);
+
+			double referenceTime;
+			mismatches += check(dxt, &data[0], width, height, &output[0], referenceTime);
+		}
+	}
+
+	return mismatches;
+}
+
+void benchmarkS3TC(uint32 imageSize, std::vector<S3TCBenchmarkResults> &results) {
+	const uint32 pixels = imageSize * imageSize;
+
+	// Decompress about 2^26 pixels with the decoder
+	const uint32 runs = MAX<uint32>((1 << 26) / pixels, 1);
+
+	std::vector<byte> output(pixels * 4);
+
+	static const int kFormats[] = { 1, 3, 5 };
+
+	results.resize(ARRAYSIZE(kFormats));
+
+	for (uint32 i = 0; i < ARRAYSIZE(kFormats); i++) {
+		S3TCBenchmarkResults &result = results[i];
+
+		const int dxt = kFormats[i];
+
+		const uint32 size = getSize(dxt, imageSize, imageSize);
+
+		std::vector<byte> data(size);
+		for (uint32 j = 0; j < size; j++)
+			data[j] = std::rand();
+
+		result.dxt             = dxt;
+		result.pixels          = pixels * runs;
+		result.referencePixels = pixels;
+		result.mismatches      = checkSmall(dxt);
+
+		const uint64 start = SDL_GetPerformanceCounter();
+
+		for (uint32 j = 0; j < runs; j++)
+			decompress(dxt, &output[0], &data[0], size, imageSize, imageSize);
+
+		result.decoderTime = ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+
+		result.mismatches += check(dxt, &data[0], imageSize, imageSize, &output[0], result.referenceTime);
+	}
+}
+
+} // End of namespace Graphics
@@ -0,0 +1,55 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/images/s3tcbench.h
+ *  Checking and measuring the S3TC DXTn decompression.
+ */
+
+#ifndef GRAPHICS_IMAGES_S3TCBENCH_H
+#define GRAPHICS_IMAGES_S3TCBENCH_H
+
+#include <vector>
+
+#include "common/types.h"
+
+namespace Graphics {
+
+/** Results of checking and measuring the decompression of one DXTn format. All times are in seconds. */
+struct S3TCBenchmarkResults {
+	int dxt; ///< The DXTn format.
+
+	uint32 pixels;          ///< Number of pixels decompressed by the decoder.
+	uint32 referencePixels; ///< Number of pixels decompressed texel by texel.
+
+	double decoderTime;   ///< Time the decoder took.
+	double referenceTime; ///< Time decompressing texel by texel took.
+
+	uint32 mismatches; ///< Number of pixels the decoder got wrong.
+};
+
+/** Decompress random DXT1, DXT3 and DXT5 images of that size with the decoder and
+ *  texel by texel, with the old decoder's arithmetic, and compare the results.
+ *  Random images of all sizes up to 9x9 are compared as well.
+ */
+void benchmarkS3TC(uint32 imageSize, std::vector<S3TCBenchmarkResults> &results);
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_IMAGES_S3TCBENCH_H
@@ -26,18 +26,21 @@
 #include <cstring>
 
 #include "graphics/indexbuffer.h"
+#include "graphics/graphics.h"
 
 namespace Graphics {
 
-IndexBuffer::IndexBuffer() : _count(0), _size(0), _type(GL_UNSIGNED_INT), _data(0) {
+IndexBuffer::IndexBuffer() : _count(0), _size(0), _type(GL_UNSIGNED_INT), _data(0), _ibo(0) {
 	//ctor
 }
 
-IndexBuffer::IndexBuffer(const IndexBuffer &other) : _data(0) {
+IndexBuffer::IndexBuffer(const IndexBuffer &other) : _data(0), _ibo(0) {
 	*this = other;
 }
 
 IndexBuffer::~IndexBuffer() {
+	abandonGL();
+
 	if (_data)
 		std::free(_data);
 }
@@ -51,6 +54,9 @@ IndexBuffer &IndexBuffer::operator=(const IndexBuffer &other) {
 }
 
 void IndexBuffer::setSize(uint32 indexCount, uint32 indexSize, GLenum indexType) {
+	// The buffer object won't match the new data anymore
+	abandonGL();
+
 	_count = indexCount;
 	_size = indexSize;
 	_type = indexType;
@@ -80,4 +86,57 @@ GLenum IndexBuffer::getType() const {
 	return _type;
 }
 
+void IndexBuffer::initGL(GLenum usage) {
+	if (_ibo || !_data || !GfxMan.supportBufferObjects())
+		return;
+
+	glGenBuffersARB(1, &_ibo);
+	glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, _ibo);
+	glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, _count * _size, _data, usage);
+	glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+
+	GfxMan.countUpload(_count * _size);
+}
+
+void IndexBuffer::destroyGL() {
+	if (!_ibo)
+		return;
+
+	glDeleteBuffersARB(1, &_ibo);
+	_ibo = 0;
+}
+
+void IndexBuffer::abandonGL() {
+	if (!_ibo)
+		return;
+
+	GfxMan.abandonBuffers(&_ibo, 1);
+	_ibo = 0;
+}
+
+bool IndexBuffer::hasBufferObject() const {
+	return _ibo != 0;
+}
+
+void IndexBuffer::bind() const {
+	if (GfxMan.supportBufferObjects())
+		glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, _ibo);
+
+	if (!_ibo)
+		GfxMan.countUpload(_count * _size);
+}
+
+void IndexBuffer::unbind() {
+	if (GfxMan.supportBufferObjects())
+		glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+}
+
+const GLvoid *IndexBuffer::getIndexPointer() const {
+	// Buffer object indices start at offset 0 into the buffer
+	if (_ibo)
+		return 0;
+
+	return _data;
+}
+
 }
@@ -55,11 +55,34 @@ public:
 	/** Get element type */
 	GLenum getType() const;
 
+	/** Upload the buffer data into a GL buffer object. Must be called from the main thread */
+	void initGL(GLenum usage = GL_STATIC_DRAW_ARB);
+
+	/** Delete the GL buffer object, going back to client-side data. Must be called from the main thread */
+	void destroyGL();
+
+	/** Is the buffer data held by a GL buffer object? */
+	bool hasBufferObject() const;
+
+	/** Bind the GL buffer object, or unbind any if the data is client-side */
+	void bind() const;
+
+	/** Unbind any GL index buffer object */
+	static void unbind();
+
+	/** Get the pointer the GL expects for the indices of the buffer */
+	const GLvoid *getIndexPointer() const;
+
 private:
 	uint32 _count; ///< Number of elements in buffer
 	uint32 _size;  ///< Size of a buffer element in bytes
 	GLenum _type;  ///< Element type (GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, ...)
 	GLvoid *_data; ///< Buffer data
+
+	BufferID _ibo; ///< GL buffer object holding a copy of the data, 0 if none
+
+	/** Hand the GL buffer object over to the graphics manager for deletion */
+	void abandonGL();
 };
 
 }
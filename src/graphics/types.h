@@ -37,6 +37,7 @@ namespace Graphics {
 
 typedef GLuint TextureID;
 typedef GLuint ListID;
+typedef GLuint BufferID;
 
 enum PixelFormat {
 	kPixelFormatRGB  = GL_RGB ,
@@ -61,6 +62,12 @@ enum PixelDataType {
 	kPixelDataType565  = GL_UNSIGNED_SHORT_5_6_5
 };
 
+/** The filter used to scale down an image into its mip maps. */
+enum MipMapFilter {
+	kMipMapFilterBox    = 0, ///< Average of each 2x2 block of pixels.
+	kMipMapFilterKaiser    , ///< Kaiser-windowed sinc, sharper than a box filter.
+};
+
 enum QueueType {
 	kQueueTexture               = 0, ///< A texture.
 	kQueueNewTexture               , ///< A newly created texture.
@@ -26,18 +26,21 @@
 #include <cstring>
 
 #include "graphics/vertexbuffer.h"
+#include "graphics/graphics.h"
 
 namespace Graphics {
 
-VertexBuffer::VertexBuffer() : _count(0), _size(0), _data(0) {
+VertexBuffer::VertexBuffer() : _count(0), _size(0), _data(0), _vbo(0) {
 	//ctor
 }
 
-VertexBuffer::VertexBuffer(const VertexBuffer &other) : _data(0) {
+VertexBuffer::VertexBuffer(const VertexBuffer &other) : _data(0), _vbo(0) {
 	*this = other;
 }
 
 VertexBuffer::~VertexBuffer() {
+	abandonGL();
+
 	if (_data)
 		std::free(_data);
 }
@@ -47,11 +50,23 @@ VertexBuffer &VertexBuffer::operator=(const VertexBuffer &other) {
 		setVertexDecl(other._decl);
 		setSize(other._count, other._size);
 		memcpy(_data, other._data, other._count * other._size);
+
+		// Point the attributes at our own copy of the data
+		const byte *otherStart = (const byte *) other._data;
+		const byte *otherEnd   = otherStart + other._count * other._size;
+		for (VertexDecl::iterator va = _decl.begin(); va != _decl.end(); ++va) {
+			const byte *pointer = (const byte *) va->pointer;
+			if (otherStart && (pointer >= otherStart) && (pointer < otherEnd))
+				va->pointer = (byte *) _data + (pointer - otherStart);
+		}
 	}
 	return *this;
 }
 
 void VertexBuffer::setSize(uint32 vertCount, uint32 vertSize) {
+	// The buffer object won't match the new data anymore
+	abandonGL();
+
 	_count = vertCount;
 	_size = vertSize;
 
@@ -88,4 +103,57 @@ uint32 VertexBuffer::getSize() const {
 	return _size;
 }
 
+void VertexBuffer::initGL(GLenum usage) {
+	if (_vbo || !_data || !GfxMan.supportBufferObjects())
+		return;
+
+	glGenBuffersARB(1, &_vbo);
+	glBindBufferARB(GL_ARRAY_BUFFER_ARB, _vbo);
+	glBufferDataARB(GL_ARRAY_BUFFER_ARB, _count * _size, _data, usage);
+	glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+
+	GfxMan.countUpload(_count * _size);
+}
+
+void VertexBuffer::destroyGL() {
+	if (!_vbo)
+		return;
+
+	glDeleteBuffersARB(1, &_vbo);
+	_vbo = 0;
+}
+
+void VertexBuffer::abandonGL() {
+	if (!_vbo)
+		return;
+
+	GfxMan.abandonBuffers(&_vbo, 1);
+	_vbo = 0;
+}
+
+bool VertexBuffer::hasBufferObject() const {
+	return _vbo != 0;
+}
+
+void VertexBuffer::bind() const {
+	if (GfxMan.supportBufferObjects())
+		glBindBufferARB(GL_ARRAY_BUFFER_ARB, _vbo);
+
+	if (!_vbo)
+		GfxMan.countUpload(_count * _size);
+}
+
+void VertexBuffer::unbind() {
+	if (GfxMan.supportBufferObjects())
+		glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+}
+
+const GLvoid *VertexBuffer::getAttribPointer(const VertexAttrib &va) const {
+	if (!_vbo)
+		return va.pointer;
+
+	// Buffer object attribute pointers are offsets into the buffer
+	return (const GLvoid *) ((const byte *) va.pointer - (const byte *) _data);
+}
+
 }
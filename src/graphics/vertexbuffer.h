@@ -83,11 +83,34 @@ public:
 	/** Get vertex element size in bytes */
 	uint32 getSize() const;
 
+	/** Upload the buffer data into a GL buffer object. Must be called from the main thread */
+	void initGL(GLenum usage = GL_STATIC_DRAW_ARB);
+
+	/** Delete the GL buffer object, going back to client-side data. Must be called from the main thread */
+	void destroyGL();
+
+	/** Is the buffer data held by a GL buffer object? */
+	bool hasBufferObject() const;
+
+	/** Bind the GL buffer object, or unbind any if the data is client-side */
+	void bind() const;
+
+	/** Unbind any GL vertex buffer object */
+	static void unbind();
+
+	/** Get the pointer the GL expects for this vertex attribute of the buffer */
+	const GLvoid *getAttribPointer(const VertexAttrib &va) const;
+
 private:
 	VertexDecl _decl; ///< Vertex declaration
 	uint32 _count;    ///< Number of elements in buffer
 	uint32 _size;     ///< Size of a buffer element in bytes (vertex attributes size sum)
 	GLvoid *_data;    ///< Buffer data
+
+	BufferID _vbo;    ///< GL buffer object holding a copy of the data, 0 if none
+
+	/** Hand the GL buffer object over to the graphics manager for deletion */
+	void abandonGL();
 };
 
 }
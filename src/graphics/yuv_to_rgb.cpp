@@ -86,12 +86,29 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include <SDL_version.h>
+#include <SDL_cpuinfo.h>
+
 #include "common/error.h"
 #include "common/singleton.h"
 #include "common/util.h"
 
 #include "graphics/yuv_to_rgb.h"
 
+#ifdef __SSE2__
+	#include <emmintrin.h>
+
+	/* AVX2 code is compiled for its own functions only, and used if the CPU supports it.
+	 * SDL can only tell us about AVX2 support since 2.0.4. */
+	#if (defined(__i386__) || defined(__x86_64__)) && SDL_VERSION_ATLEAST(2, 0, 4) && \
+	    ((defined(__clang__) && (__clang_major__ >= 4)) || \
+	     (!defined(__clang__) && defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))))
+
+		#include <immintrin.h>
+		#define YUV_HAVE_AVX2 1
+	#endif
+#endif
+
 DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 
 namespace Graphics {
@@ -161,6 +178,8 @@ YUVToRGBLookup::YUVToRGBLookup(YUVToRGBManager::LuminanceScale scale) {
 YUVToRGBManager::YUVToRGBManager() {
 	_lookup = 0;
 
+	setInstructionSet(kInstructionSetBest);
+
 	int16 *Cr_r_tab = &_colorTab[0 * 256];
 	int16 *Cr_g_tab = &_colorTab[1 * 256];
 	int16 *Cb_g_tab = &_colorTab[2 * 256];
@@ -184,6 +203,45 @@ YUVToRGBManager::~YUVToRGBManager() {
 	delete _lookup;
 }
 
+YUVToRGBManager::InstructionSet YUVToRGBManager::getInstructionSet() const {
+	return _instructionSet;
+}
+
+YUVToRGBManager::InstructionSet YUVToRGBManager::setInstructionSet(InstructionSet instructionSet) {
+	if (instructionSet == kInstructionSetBest)
+		instructionSet = kInstructionSetAVX2;
+
+	_instructionSet = kInstructionSetScalar;
+
+#ifdef __SSE2__
+	// Always there when we're compiled for it
+	if (instructionSet >= kInstructionSetSSE2)
+		_instructionSet = kInstructionSetSSE2;
+#endif
+
+#ifdef YUV_HAVE_AVX2
+	if ((instructionSet >= kInstructionSetAVX2) && SDL_HasAVX2())
+		_instructionSet = kInstructionSetAVX2;
+#endif
+
+	return _instructionSet;
+}
+
+const char *YUVToRGBManager::getInstructionSetName(InstructionSet instructionSet) {
+	switch (instructionSet) {
+		case kInstructionSetBest:
+			return "Best";
+		case kInstructionSetScalar:
+			return "Scalar";
+		case kInstructionSetSSE2:
+			return "SSE2";
+		case kInstructionSetAVX2:
+			return "AVX2";
+	}
+
+	return "Unknown";
+}
+
 const YUVToRGBLookup *YUVToRGBManager::getLookup(LuminanceScale scale) {
 	if (_lookup && _lookup->getScale() == scale)
 		return _lookup;
@@ -193,6 +251,219 @@ const YUVToRGBLookup *YUVToRGBManager::getLookup(LuminanceScale scale) {
 	return _lookup;
 }
 
+#ifdef __SSE2__
+/** The multipliers turning the chroma values into offsets on the luminance,
+ *  as used for _colorTab. In single precision, truncating the products gives
+ *  exactly the same offsets for all 256 chroma values. */
+static const float kCrR = (float)  (0.419 / 0.299);
+static const float kCrG = (float) -(0.299 / 0.419);
+static const float kCbG = (float) -(0.114 / 0.331);
+static const float kCbB = (float)  (0.587 / 0.331);
+
+/** Multiply 8 signed 16-bit chroma values, truncating the products to 16 bits. */
+static inline __m128i mulChroma(__m128i c, float factor) {
+	const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(c, c), 16));
+	const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(c, c), 16));
+
+	const __m128 f = _mm_set1_ps(factor);
+
+	return _mm_packs_epi32(_mm_cvttps_epi32(_mm_mul_ps(lo, f)), _mm_cvttps_epi32(_mm_mul_ps(hi, f)));
+}
+
+/** Map 8 luminance values plus chroma offsets to the final color, like the rgbToPix tables do. */
+template<YUVToRGBManager::LuminanceScale scale>
+static inline __m128i mapColor(__m128i c) {
+	if (scale == YUVToRGBManager::kScaleFull)
+		return c; // Clamped to [0, 255] when packing
+
+	// (CLIP(c, 16, 235) - 16) * 255 / 219, with the division as an exact fixed point multiplication
+	c = _mm_sub_epi16(_mm_min_epi16(_mm_max_epi16(c, _mm_set1_epi16(16)), _mm_set1_epi16(235)), _mm_set1_epi16(16));
+
+	return _mm_add_epi16(c, _mm_mulhi_epu16(c, _mm_set1_epi16(10774)));
+}
+
+/** Convert 16 pixels of a row, given the chroma offsets of each pixel pair. */
+template<YUVToRGBManager::LuminanceScale scale>
+static inline void convertPixels16(byte *dst, const byte *ySrc, const byte *aSrc,
+                                   __m128i rOff, __m128i gOff, __m128i bOff) {
+
+	const __m128i zero = _mm_setzero_si128();
+
+	const __m128i y   = _mm_loadu_si128((const __m128i *) ySrc);
+	const __m128i yLo = _mm_unpacklo_epi8(y, zero);
+	const __m128i yHi = _mm_unpackhi_epi8(y, zero);
+
+	// Each chroma value is shared by two neighbouring pixels
+	const __m128i rLo = _mm_unpacklo_epi16(rOff, rOff), rHi = _mm_unpackhi_epi16(rOff, rOff);
+	const __m128i gLo = _mm_unpacklo_epi16(gOff, gOff), gHi = _mm_unpackhi_epi16(gOff, gOff);
+	const __m128i bLo = _mm_unpacklo_epi16(bOff, bOff), bHi = _mm_unpackhi_epi16(bOff, bOff);
+
+	const __m128i r = _mm_packus_epi16(mapColor<scale>(_mm_add_epi16(yLo, rLo)), mapColor<scale>(_mm_add_epi16(yHi, rHi)));
+	const __m128i g = _mm_packus_epi16(mapColor<scale>(_mm_add_epi16(yLo, gLo)), mapColor<scale>(_mm_add_epi16(yHi, gHi)));
+	const __m128i b = _mm_packus_epi16(mapColor<scale>(_mm_add_epi16(yLo, bLo)), mapColor<scale>(_mm_add_epi16(yHi, bHi)));
+
+	const __m128i a = aSrc ? _mm_loadu_si128((const __m128i *) aSrc) : _mm_set1_epi8((char) 0xFF);
+
+	// Interleave into BGRA
+	const __m128i bgLo = _mm_unpacklo_epi8(b, g), bgHi = _mm_unpackhi_epi8(b, g);
+	const __m128i raLo = _mm_unpacklo_epi8(r, a), raHi = _mm_unpackhi_epi8(r, a);
+
+	_mm_storeu_si128((__m128i *) (dst +  0), _mm_unpacklo_epi16(bgLo, raLo));
+	_mm_storeu_si128((__m128i *) (dst + 16), _mm_unpackhi_epi16(bgLo, raLo));
+	_mm_storeu_si128((__m128i *) (dst + 32), _mm_unpacklo_epi16(bgHi, raHi));
+	_mm_storeu_si128((__m128i *) (dst + 48), _mm_unpackhi_epi16(bgHi, raHi));
+}
+
+/** Convert the first (width & ~15) pixels of two rows sharing the same chroma row.
+ *
+ *  @return The number of pixels converted.
+ */
+template<YUVToRGBManager::LuminanceScale scale>
+static int convertRows420SSE2(byte *dst0, byte *dst1, const byte *y0, const byte *y1,
+                              const byte *a0, const byte *a1, const byte *uSrc, const byte *vSrc, int width) {
+
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i bias = _mm_set1_epi16(128);
+
+	int x = 0;
+	for (; (x + 16) <= width; x += 16) {
+		const __m128i u = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (uSrc + x / 2)), zero), bias);
+		const __m128i v = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (vSrc + x / 2)), zero), bias);
+
+		const __m128i rOff = mulChroma(v, kCrR);
+		const __m128i gOff = _mm_add_epi16(mulChroma(v, kCrG), mulChroma(u, kCbG));
+		const __m128i bOff = mulChroma(u, kCbB);
+
+		convertPixels16<scale>(dst0 + x * 4, y0 + x, a0 ? (a0 + x) : 0, rOff, gOff, bOff);
+		convertPixels16<scale>(dst1 + x * 4, y1 + x, a1 ? (a1 + x) : 0, rOff, gOff, bOff);
+	}
+
+	return x;
+}
+
+static int convertRows420SSE2(YUVToRGBManager::LuminanceScale scale, byte *dst0, byte *dst1,
+                              const byte *y0, const byte *y1, const byte *a0, const byte *a1,
+                              const byte *uSrc, const byte *vSrc, int width) {
+
+	if (scale == YUVToRGBManager::kScaleFull)
+		return convertRows420SSE2<YUVToRGBManager::kScaleFull>(dst0, dst1, y0, y1, a0, a1, uSrc, vSrc, width);
+
+	return convertRows420SSE2<YUVToRGBManager::kScaleITU>(dst0, dst1, y0, y1, a0, a1, uSrc, vSrc, width);
+}
+#endif
+
+#ifdef YUV_HAVE_AVX2
+/** Multiply 16 signed 16-bit chroma values, truncating the products to 16 bits. */
+__attribute__((target("avx2")))
+static inline __m256i mulChromaAVX2(__m256i c, float factor) {
+	const __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(c)));
+	const __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(c, 1)));
+
+	const __m256 f = _mm256_set1_ps(factor);
+
+	// Packing works within each 128-bit lane, so put the 64-bit quarters back in order
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(lo, f)),
+	                                                   _mm256_cvttps_epi32(_mm256_mul_ps(hi, f))),
+	                                _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/** Map 16 luminance values plus chroma offsets to the final color, see mapColor(). */
+template<YUVToRGBManager::LuminanceScale scale>
+__attribute__((target("avx2")))
+static inline __m256i mapColorAVX2(__m256i c) {
+	if (scale == YUVToRGBManager::kScaleFull)
+		return c;
+
+	c = _mm256_sub_epi16(_mm256_min_epi16(_mm256_max_epi16(c, _mm256_set1_epi16(16)), _mm256_set1_epi16(235)), _mm256_set1_epi16(16));
+
+	return _mm256_add_epi16(c, _mm256_mulhi_epu16(c, _mm256_set1_epi16(10774)));
+}
+
+/** Combine the colors of 32 pixels, as two halves of 16 16-bit values, into 32 bytes in order. */
+template<YUVToRGBManager::LuminanceScale scale>
+__attribute__((target("avx2")))
+static inline __m256i packColorAVX2(__m256i lo, __m256i hi) {
+	return _mm256_permute4x64_epi64(_mm256_packus_epi16(mapColorAVX2<scale>(lo), mapColorAVX2<scale>(hi)),
+	                                _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/** Convert 32 pixels of a row, given the chroma offsets of the first and the last 16 pixels. */
+template<YUVToRGBManager::LuminanceScale scale>
+__attribute__((target("avx2")))
+static inline void convertPixels32(byte *dst, const byte *ySrc, const byte *aSrc,
+                                   __m256i rLo, __m256i rHi, __m256i gLo, __m256i gHi,
+                                   __m256i bLo, __m256i bHi) {
+
+	const __m256i y   = _mm256_loadu_si256((const __m256i *) ySrc);
+	const __m256i yLo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(y));
+	const __m256i yHi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(y, 1));
+
+	const __m256i r = packColorAVX2<scale>(_mm256_add_epi16(yLo, rLo), _mm256_add_epi16(yHi, rHi));
+	const __m256i g = packColorAVX2<scale>(_mm256_add_epi16(yLo, gLo), _mm256_add_epi16(yHi, gHi));
+	const __m256i b = packColorAVX2<scale>(_mm256_add_epi16(yLo, bLo), _mm256_add_epi16(yHi, bHi));
+
+	const __m256i a = aSrc ? _mm256_loadu_si256((const __m256i *) aSrc) : _mm256_set1_epi8((char) 0xFF);
+
+	// Interleave into BGRA. This works within each 128-bit lane, giving pixels 0-15 in the low lanes
+	const __m256i bgLo = _mm256_unpacklo_epi8(b, g), bgHi = _mm256_unpackhi_epi8(b, g);
+	const __m256i raLo = _mm256_unpacklo_epi8(r, a), raHi = _mm256_unpackhi_epi8(r, a);
+
+	const __m256i p0 = _mm256_unpacklo_epi16(bgLo, raLo), p1 = _mm256_unpackhi_epi16(bgLo, raLo);
+	const __m256i p2 = _mm256_unpacklo_epi16(bgHi, raHi), p3 = _mm256_unpackhi_epi16(bgHi, raHi);
+
+	_mm256_storeu_si256((__m256i *) (dst +  0), _mm256_permute2x128_si256(p0, p1, 0x20));
+	_mm256_storeu_si256((__m256i *) (dst + 32), _mm256_permute2x128_si256(p2, p3, 0x20));
+	_mm256_storeu_si256((__m256i *) (dst + 64), _mm256_permute2x128_si256(p0, p1, 0x31));
+	_mm256_storeu_si256((__m256i *) (dst + 96), _mm256_permute2x128_si256(p2, p3, 0x31));
+}
+
+/** Convert the first (width & ~31) pixels of two rows sharing the same chroma row.
+ *
+ *  @return The number of pixels converted.
+ */
+template<YUVToRGBManager::LuminanceScale scale>
+__attribute__((target("avx2")))
+static int convertRows420AVX2(byte *dst0, byte *dst1, const byte *y0, const byte *y1,
+                              const byte *a0, const byte *a1, const byte *uSrc, const byte *vSrc, int width) {
+
+	const __m256i bias = _mm256_set1_epi16(128);
+
+	int x = 0;
+	for (; (x + 32) <= width; x += 32) {
+		const __m256i u = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (uSrc + x / 2))), bias);
+		const __m256i v = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (vSrc + x / 2))), bias);
+
+		const __m256i rOff = mulChromaAVX2(v, kCrR);
+		const __m256i gOff = _mm256_add_epi16(mulChromaAVX2(v, kCrG), mulChromaAVX2(u, kCbG));
+		const __m256i bOff = mulChromaAVX2(u, kCbB);
+
+		// Each chroma value is shared by two neighbouring pixels
+		const __m256i rDupLo = _mm256_unpacklo_epi16(rOff, rOff), rDupHi = _mm256_unpackhi_epi16(rOff, rOff);
+		const __m256i gDupLo = _mm256_unpacklo_epi16(gOff, gOff), gDupHi = _mm256_unpackhi_epi16(gOff, gOff);
+		const __m256i bDupLo = _mm256_unpacklo_epi16(bOff, bOff), bDupHi = _mm256_unpackhi_epi16(bOff, bOff);
+
+		const __m256i rLo = _mm256_permute2x128_si256(rDupLo, rDupHi, 0x20), rHi = _mm256_permute2x128_si256(rDupLo, rDupHi, 0x31);
+		const __m256i gLo = _mm256_permute2x128_si256(gDupLo, gDupHi, 0x20), gHi = _mm256_permute2x128_si256(gDupLo, gDupHi, 0x31);
+		const __m256i bLo = _mm256_permute2x128_si256(bDupLo, bDupHi, 0x20), bHi = _mm256_permute2x128_si256(bDupLo, bDupHi, 0x31);
+
+		convertPixels32<scale>(dst0 + x * 4, y0 + x, a0 ? (a0 + x) : 0, rLo, rHi, gLo, gHi, bLo, bHi);
+		convertPixels32<scale>(dst1 + x * 4, y1 + x, a1 ? (a1 + x) : 0, rLo, rHi, gLo, gHi, bLo, bHi);
+	}
+
+	return x;
+}
+
+static int convertRows420AVX2(YUVToRGBManager::LuminanceScale scale, byte *dst0, byte *dst1,
+                              const byte *y0, const byte *y1, const byte *a0, const byte *a1,
+                              const byte *uSrc, const byte *vSrc, int width) {
+
+	if (scale == YUVToRGBManager::kScaleFull)
+		return convertRows420AVX2<YUVToRGBManager::kScaleFull>(dst0, dst1, y0, y1, a0, a1, uSrc, vSrc, width);
+
+	return convertRows420AVX2<YUVToRGBManager::kScaleITU>(dst0, dst1, y0, y1, a0, a1, uSrc, vSrc, width);
+}
+#endif
+
 #define PUT_PIXEL(s, a, d) \
 	L = &rgbToPix[(s)]; \
 	*((d)) = L[cb_b]; \
@@ -200,79 +471,73 @@ const YUVToRGBLookup *YUVToRGBManager::getLookup(LuminanceScale scale) {
 	*((d) + 2) = L[cr_r]; \
 	*((d) + 3) = (a)
 
-void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
-	const YUVToRGBLookup *lookup = YUVToRGBMan.getLookup(scale);
-	const byte *rgbToPix = lookup->getRGBToPix();
-
-	int halfHeight = yHeight >> 1;
-	int halfWidth = yWidth >> 1;
-
-	dst += dstPitch * (yHeight - 2);
-
-	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
-			register const byte *L;
-
-			int16 cr_r  = _colorTab[*vSrc + 0 * 256];
-			int16 crb_g = _colorTab[*vSrc + 1 * 256] + _colorTab[*uSrc + 2 * 256];
-			int16 cb_b  = _colorTab[*uSrc + 3 * 256];
-			uSrc++;
-			vSrc++;
-
-			PUT_PIXEL(*ySrc, *aSrc, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), *(aSrc + yPitch), dst);
-			ySrc++;
-			aSrc++;
-			dst += 4;
-			PUT_PIXEL(*ySrc, *aSrc, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), *(aSrc + yPitch), dst);
-			ySrc++;
-			aSrc++;
-			dst += 4;
+void YUVToRGBManager::convertRows420(const byte *rgbToPix, LuminanceScale scale, byte *dst0, byte *dst1,
+                                     const byte *y0, const byte *y1, const byte *a0, const byte *a1,
+                                     const byte *uSrc, const byte *vSrc, int width) {
+
+	int x = 0;
+
+#ifdef YUV_HAVE_AVX2
+	if (_instructionSet == kInstructionSetAVX2)
+		x = convertRows420AVX2(scale, dst0, dst1, y0, y1, a0, a1, uSrc, vSrc, width);
+#endif
+
+#ifdef __SSE2__
+	// Whatever is left for a whole SSE2 row
+	if (_instructionSet >= kInstructionSetSSE2)
+		x += convertRows420SSE2(scale, dst0 + x * 4, dst1 + x * 4, y0 + x, y1 + x,
+		                        a0 ? (a0 + x) : 0, a1 ? (a1 + x) : 0, uSrc + x / 2, vSrc + x / 2, width - x);
+#endif
+
+	// Convert the rest through the lookup tables
+	for (; x < width; x += 2) {
+		register const byte *L;
+
+		const int c = x >> 1;
+
+		int16 cr_r  = _colorTab[vSrc[c] + 0 * 256];
+		int16 crb_g = _colorTab[vSrc[c] + 1 * 256] + _colorTab[uSrc[c] + 2 * 256];
+		int16 cb_b  = _colorTab[uSrc[c] + 3 * 256];
+
+		if (a0 && a1) {
+			PUT_PIXEL(y0[x    ], a0[x    ], dst0 + x * 4    );
+			PUT_PIXEL(y1[x    ], a1[x    ], dst1 + x * 4    );
+			PUT_PIXEL(y0[x + 1], a0[x + 1], dst0 + x * 4 + 4);
+			PUT_PIXEL(y1[x + 1], a1[x + 1], dst1 + x * 4 + 4);
+		} else {
+			PUT_PIXEL(y0[x    ], 0xFF, dst0 + x * 4    );
+			PUT_PIXEL(y1[x    ], 0xFF, dst1 + x * 4    );
+			PUT_PIXEL(y0[x + 1], 0xFF, dst0 + x * 4 + 4);
+			PUT_PIXEL(y1[x + 1], 0xFF, dst1 + x * 4 + 4);
 		}
-
-		dst -= yWidth * 4 + dstPitch * 2;
-		ySrc += (yPitch << 1) - yWidth;
-		aSrc += (yPitch << 1) - yWidth;
-		uSrc += uvPitch - halfWidth;
-		vSrc += uvPitch - halfWidth;
 	}
 }
 
-void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, const byte *aSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
 	const YUVToRGBLookup *lookup = YUVToRGBMan.getLookup(scale);
 	const byte *rgbToPix = lookup->getRGBToPix();
 
 	int halfHeight = yHeight >> 1;
-	int halfWidth = yWidth >> 1;
 
+	// The image is stored upside down
 	dst += dstPitch * (yHeight - 2);
 
 	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
-			register const byte *L;
-
-			int16 cr_r  = _colorTab[*vSrc + 0 * 256];
-			int16 crb_g = _colorTab[*vSrc + 1 * 256] + _colorTab[*uSrc + 2 * 256];
-			int16 cb_b  = _colorTab[*uSrc + 3 * 256];
-			uSrc++;
-			vSrc++;
-
-			PUT_PIXEL(*ySrc, 0xFF, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), 0xFF, dst);
-			ySrc++;
-			dst += 4;
-			PUT_PIXEL(*ySrc, 0xFF, dst + dstPitch);
-			PUT_PIXEL(*(ySrc + yPitch), 0xFF, dst);
-			ySrc++;
-			dst += 4;
-		}
+		convertRows420(rgbToPix, scale, dst + dstPitch, dst, ySrc, ySrc + yPitch,
+		               aSrc, aSrc ? (aSrc + yPitch) : 0, uSrc, vSrc, yWidth);
+
+		dst  -= dstPitch * 2;
+		ySrc += yPitch << 1;
+		uSrc += uvPitch;
+		vSrc += uvPitch;
 
-		dst -= yWidth * 4 + dstPitch * 2;
-		ySrc += (yPitch << 1) - yWidth;
-		uSrc += uvPitch - halfWidth;
-		vSrc += uvPitch - halfWidth;
+		if (aSrc)
+			aSrc += yPitch << 1;
 	}
 }
 
+void YUVToRGBManager::convert420(LuminanceScale scale, byte *dst, int dstPitch, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch) {
+	convert420(scale, dst, dstPitch, ySrc, uSrc, vSrc, 0, yWidth, yHeight, yPitch, uvPitch);
+}
+
 } // End of namespace Graphics
@@ -40,6 +40,29 @@ public:
 		kScaleITU   /** Luminance values range from [16, 235], the range from ITU-R BT.601 */
 	};
 
+	/** The instruction sets the conversion can be done with. */
+	enum InstructionSet {
+		kInstructionSetBest,   ///< The best one the CPU supports.
+		kInstructionSetScalar, ///< Plain C++, through lookup tables.
+		kInstructionSetSSE2,   ///< SSE2, 16 pixels at once.
+		kInstructionSetAVX2    ///< AVX2, 32 pixels at once.
+	};
+
+	/** Return the instruction set used for the conversion. */
+	InstructionSet getInstructionSet() const;
+
+	/** Set the instruction set used for the conversion.
+	 *
+	 *  If the requested instruction set is not available, the best
+	 *  available one below it is used instead.
+	 *
+	 *  @return The instruction set actually used.
+	 */
+	InstructionSet setInstructionSet(InstructionSet instructionSet);
+
+	/** Return the name of an instruction set. */
+	static const char *getInstructionSetName(InstructionSet instructionSet);
+
 	/**
 	 * Convert a YUV420 image to an RGBA surface
 	 *
@@ -65,7 +88,7 @@ public:
 	 * @param ySrc     the source of the y component
 	 * @param uSrc     the source of the u component
 	 * @param vSrc     the source of the v component
-	 * @param aSrc     the source of the a component
+	 * @param aSrc     the source of the a component, or 0 for fully opaque pixels
 	 * @param yWidth   the width of the y surface (must be divisible by 2)
 	 * @param yHeight  the height of the y surface (must be divisible by 2)
 	 * @param yPitch   the pitch of the y and a surfaces
@@ -80,8 +103,18 @@ private:
 
 	const YUVToRGBLookup *getLookup(LuminanceScale scale);
 
+	/** Convert two rows of YUV420 pixels that share the same row of chroma values.
+	 *
+	 *  a0 and a1 may be 0, for fully opaque pixels.
+	 */
+	void convertRows420(const byte *rgbToPix, LuminanceScale scale, byte *dst0, byte *dst1,
+	                    const byte *y0, const byte *y1, const byte *a0, const byte *a1,
+	                    const byte *uSrc, const byte *vSrc, int width);
+
 	YUVToRGBLookup *_lookup;
 	int16 _colorTab[4 * 256]; // 2048 bytes
+
+	InstructionSet _instructionSet;
 };
 
 } // End of namespace Graphics
@@ -0,0 +1,127 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/yuvbench.cpp
+ *  Checking and measuring the YUV to RGB conversion.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+
+#include "graphics/yuvbench.h"
+
+namespace Graphics {
+
+/** Count the pixels of a random YUV420 frame the current instruction set converts differently than the lookup tables. */
+static uint32 checkYUV(const byte *y, const byte *u, const byte *v, const byte *a, int width, int height) {
+	static const YUVToRGBManager::LuminanceScale kScales[] = {
+		YUVToRGBManager::kScaleFull, YUVToRGBManager::kScaleITU
+	};
+
+	const YUVToRGBManager::InstructionSet instructionSet = YUVToRGBMan.getInstructionSet();
+
+	std::vector<byte> output(width * height * 4), reference(width * height * 4);
+
+	uint32 mismatches = 0;
+
+	for (uint32 i = 0; i < ARRAYSIZE(kScales); i++) {
+		for (int j = 0; j < 2; j++) {
+			const byte *alpha = (j == 0) ? 0 : a;
+
+			YUVToRGBMan.setInstructionSet(YUVToRGBManager::kInstructionSetScalar);
+			YUVToRGBMan.convert420(kScales[i], &reference[0], width * 4, y, u, v, alpha, width, height, width, width / 2);
+
+			YUVToRGBMan.setInstructionSet(instructionSet);
+			YUVToRGBMan.convert420(kScales[i], &output[0], width * 4, y, u, v, alpha, width, height, width, width / 2);
+
+			for (int k = 0; k < (width * height); k++)
+				if (std::memcmp(&output[k * 4], &reference[k * 4], 4))
+					mismatches++;
+		}
+	}
+
+	return mismatches;
+}
+
+void benchmarkYUV(uint32 frames, std::vector<YUVBenchmarkResults> &results) {
+	static const int kSizes[][2] = { { 640, 480 }, { 1280, 720 } };
+
+	static const YUVToRGBManager::InstructionSet kInstructionSets[] = {
+		YUVToRGBManager::kInstructionSetScalar,
+		YUVToRGBManager::kInstructionSetSSE2,
+		YUVToRGBManager::kInstructionSetAVX2
+	};
+
+	results.clear();
+
+	for (uint32 i = 0; i < ARRAYSIZE(kSizes); i++) {
+		const int width  = kSizes[i][0];
+		const int height = kSizes[i][1];
+
+		std::vector<byte> y(width * height), a(width * height), u(width * height / 4), v(width * height / 4);
+		for (size_t j = 0; j < y.size(); j++) {
+			y[j] = std::rand();
+			a[j] = std::rand();
+		}
+		for (size_t j = 0; j < u.size(); j++) {
+			u[j] = std::rand();
+			v[j] = std::rand();
+		}
+
+		std::vector<byte> output(width * height * 4);
+
+		for (uint32 j = 0; j < ARRAYSIZE(kInstructionSets); j++) {
+			results.push_back(YUVBenchmarkResults());
+
+			YUVBenchmarkResults &result = results.back();
+
+			result.width          = width;
+			result.height         = height;
+			result.instructionSet = kInstructionSets[j];
+			result.frames         = 0;
+			result.time           = 0.0;
+			result.mismatches     = 0;
+
+			result.supported = YUVToRGBMan.setInstructionSet(kInstructionSets[j]) == kInstructionSets[j];
+			if (!result.supported)
+				continue;
+
+			result.mismatches = checkYUV(&y[0], &u[0], &v[0], &a[0], width, height);
+
+			// Videos mostly use the ITU luminance range
+			const uint64 start = SDL_GetPerformanceCounter();
+
+			for (uint32 k = 0; k < frames; k++)
+				YUVToRGBMan.convert420(YUVToRGBManager::kScaleITU, &output[0], width * 4,
+				                       &y[0], &u[0], &v[0], width, height, width, width / 2);
+
+			result.time   = ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+			result.frames = frames;
+		}
+	}
+
+	YUVToRGBMan.setInstructionSet(YUVToRGBManager::kInstructionSetBest);
+}
+
+} // End of namespace Graphics
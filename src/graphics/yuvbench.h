@@ -0,0 +1,59 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file graphics/yuvbench.h
+ *  Checking and measuring the YUV to RGB conversion.
+ */
+
+#ifndef GRAPHICS_YUVBENCH_H
+#define GRAPHICS_YUVBENCH_H
+
+#include <vector>
+
+#include "common/types.h"
+
+#include "graphics/yuv_to_rgb.h"
+
+namespace Graphics {
+
+/** Results of checking and measuring the YUV420 conversion of one instruction set at one frame size. */
+struct YUVBenchmarkResults {
+	int width;
+	int height;
+
+	YUVToRGBManager::InstructionSet instructionSet;
+
+	bool supported; ///< Does the CPU support the instruction set at all?
+
+	uint32 frames; ///< Number of frames converted.
+	double time;   ///< Time the conversion took, in seconds.
+
+	uint32 mismatches; ///< Number of pixels converted differently than with the lookup tables.
+};
+
+/** Convert that many random YUV420 frames of common video sizes with every instruction
+ *  set, and compare the results against the lookup tables. Afterwards, the best
+ *  instruction set is used again.
+ */
+void benchmarkYUV(uint32 frames, std::vector<YUVBenchmarkResults> &results);
+
+} // End of namespace Graphics
+
+#endif // GRAPHICS_YUVBENCH_H
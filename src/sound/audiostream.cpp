@@ -25,9 +25,12 @@
  */
 
 #include <queue>
+#include <vector>
+#include <cstring>
 
 #include "common/error.h"
 #include "common/mutex.h"
+#include "common/thread.h"
 
 #include "sound/audiostream.h"
 
@@ -78,6 +81,154 @@ AudioStream *makeLoopingAudioStream(RewindableAudioStream *stream, uint loops) {
 		return stream;
 }
 
+/** Number of samples the read-ahead thread decodes at once. */
+static const uint32 kReadAheadChunkSize = 4096;
+/** Time, in milliseconds, the read-ahead thread waits before asking a stream without data again. */
+static const uint32 kReadAheadSleep = 10;
+
+class ReadAheadAudioStream : public AudioStream, public Common::Thread {
+public:
+	ReadAheadAudioStream(AudioStream *stream, uint32 samples);
+	~ReadAheadAudioStream();
+
+	int readBuffer(int16 *buffer, const int numSamples);
+	bool endOfData() const;
+	bool endOfStream() const;
+
+	int getChannels() const { return _channels; }
+	int getRate() const { return _rate; }
+
+private:
+	AudioStream *_parent;
+
+	const int _rate;
+	const int _channels;
+
+	std::vector<int16> _ring;  ///< The decoded samples.
+	std::vector<int16> _chunk; ///< The samples the thread is currently decoding.
+
+	uint32 _readPos;  ///< Position of the first decoded sample in the ring.
+	uint32 _buffered; ///< Number of decoded samples in the ring.
+
+	bool _parentEnd; ///< Has the parent stream been decoded completely?
+	bool _stop;      ///< Should the thread stop decoding?
+
+	mutable Common::Mutex _mutex;
+	Common::Condition _needData; ///< Signalled when samples have been read out of the ring, or when stopping.
+
+	void threadMethod();
+
+	friend AudioStream *makeReadAheadAudioStream(AudioStream *stream, uint32 samples);
+};
+
+ReadAheadAudioStream::ReadAheadAudioStream(AudioStream *stream, uint32 samples) :
+	_parent(stream), _rate(stream->getRate()), _channels(MAX(stream->getChannels(), 1)),
+	_readPos(0), _buffered(0), _parentEnd(false), _stop(false), _needData(_mutex) {
+
+	// Only ever decode whole sample frames
+	_chunk.resize(MAX<uint32>(kReadAheadChunkSize / _channels, 1) * _channels);
+	_ring.resize(MAX<uint32>(samples, 2 * _chunk.size()));
+}
+
+ReadAheadAudioStream::~ReadAheadAudioStream() {
+	// Wake the thread up, instead of waiting for its sleep to run out
+	{
+		Common::StackLock lock(_mutex);
+
+		_stop = true;
+		_needData.signal();
+	}
+
+	destroyThread();
+
+	delete _parent;
+}
+
+int ReadAheadAudioStream::readBuffer(int16 *buffer, const int numSamples) {
+	Common::StackLock lock(_mutex);
+
+	const uint32 count = MIN<uint32>(MAX(numSamples, 0), _buffered);
+
+	// Copy out of the ring, which might wrap around
+	const uint32 first = MIN<uint32>(count, _ring.size() - _readPos);
+
+	std::memcpy(buffer        , &_ring[_readPos], first           * sizeof(int16));
+	std::memcpy(buffer + first, &_ring[0]       , (count - first) * sizeof(int16));
+
+	_readPos   = (_readPos + count) % _ring.size();
+	_buffered -= count;
+
+	if (count > 0)
+		_needData.signal();
+
+	return count;
+}
+
+bool ReadAheadAudioStream::endOfData() const {
+	Common::StackLock lock(_mutex);
+
+	return _buffered == 0;
+}
+
+bool ReadAheadAudioStream::endOfStream() const {
+	Common::StackLock lock(_mutex);
+
+	return (_buffered == 0) && _parentEnd;
+}
+
+void ReadAheadAudioStream::threadMethod() {
+	while (!_killThread) {
+		{
+			Common::StackLock lock(_mutex);
+
+			if (_stop)
+				break;
+
+			// Wait until there's room for another chunk. The reader signals whenever it
+			// took samples out of the ring, and so does the destructor when stopping
+			if (_parentEnd || ((_ring.size() - _buffered) < _chunk.size())) {
+				_needData.wait();
+				continue;
+			}
+		}
+
+		// The reader only ever locks the ring, so we can decode without holding it up
+		const int  decoded   = MAX(_parent->readBuffer(&_chunk[0], _chunk.size()), 0);
+		const bool parentEnd = _parent->endOfStream();
+
+		Common::StackLock lock(_mutex);
+
+		// Copy into the ring, which might wrap around
+		const uint32 writePos = (_readPos + _buffered) % _ring.size();
+		const uint32 first    = MIN<uint32>(decoded, _ring.size() - writePos);
+
+		std::memcpy(&_ring[writePos], &_chunk[0]        , first             * sizeof(int16));
+		std::memcpy(&_ring[0]       , &_chunk[0] + first, (decoded - first) * sizeof(int16));
+
+		_buffered += decoded;
+		_parentEnd = parentEnd;
+
+		// No data at the moment, but there might be more later
+		if ((decoded == 0) && !parentEnd && !_stop)
+			_needData.wait(kReadAheadSleep);
+	}
+}
+
+AudioStream *makeReadAheadAudioStream(AudioStream *stream, uint32 samples) {
+	ReadAheadAudioStream *readAhead = new ReadAheadAudioStream(stream, samples);
+
+	if (readAhead->createThread())
+		return readAhead;
+
+	warning("Failed to create a read-ahead audio thread");
+
+	// Give the stream back, to be decoded the usual way
+	readAhead->_parent = 0;
+	delete readAhead;
+
+	return stream;
+}
+
 class QueuingAudioStreamImpl : public QueuingAudioStream {
 private:
 	/**
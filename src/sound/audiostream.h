@@ -99,6 +99,29 @@ public:
 	virtual bool rewind() = 0;
 };
 
+/**
+ * A seekable audio stream. This allows for jumping to any sample of
+ * the stream, for example to loop or to resume music where it was left.
+ */
+class SeekableAudioStream : public RewindableAudioStream {
+public:
+	/**
+	 * Seeks to a specific sample.
+	 *
+	 * The position is counted in samples per channel from the start of
+	 * the stream, and the next readBuffer() starts exactly there.
+	 *
+	 * @param sample The sample to seek to.
+	 * @return true on success, false otherwise.
+	 */
+	virtual bool seek(uint64 sample) = 0;
+
+	/** Return the length of the stream, in samples per channel. */
+	virtual uint64 getLength() const = 0;
+
+	bool rewind() { return seek(0); }
+};
+
 /**
  * A looping audio stream. This object does nothing besides using
  * a RewindableAudioStream to play a stream in a loop.
@@ -147,6 +170,20 @@ private:
  */
 AudioStream *makeLoopingAudioStream(RewindableAudioStream *stream, uint loops);
 
+/**
+ * Wrapper to decode a stream ahead on its own thread.
+ *
+ * The stream is decoded into a ring buffer, which is read from without
+ * waiting for the decoder. Should the ring buffer run empty, endOfData()
+ * is true until the decoder caught up again.
+ *
+ * @param stream Stream to decode ahead (will be automatically destroyed).
+ *               From now on, only the decoding thread may touch it.
+ * @param samples Size of the ring buffer, in samples.
+ * @return A new AudioStream, or the stream itself if the thread couldn't be created.
+ */
+AudioStream *makeReadAheadAudioStream(AudioStream *stream, uint32 samples);
+
 class QueuingAudioStream : public AudioStream {
 public:
 
@@ -24,6 +24,9 @@
  *  Decoding MP3 (MPEG-1 Audio Layer 3).
  */
 
+#include <vector>
+#include <algorithm>
+
 #include "sound/decoders/mp3.h"
 
 #include "common/stream.h"
@@ -36,7 +39,77 @@
 
 namespace Sound {
 
-class MP3Stream : public RewindableAudioStream {
+/** Number of MP3 frames to decode before the frame we're seeking to.
+ *
+ *  Layer III frames can take data out of the frames before them, and
+ *  the synthesis filter bank needs a frame to settle as well.
+ */
+static const uint32 kSeekPreroll = 4;
+
+/** Maximum number of MP3 seek indices to keep around. */
+static const size_t kSeekIndexCacheSize = 64;
+
+/** Where an MP3 frame starts. */
+struct MP3Frame {
+	uint32 offset; ///< Offset of the frame within the MP3 data.
+	uint32 sample; ///< First sample (per channel) of the frame.
+};
+
+/** The starts of all frames of an MP3. */
+struct MP3SeekIndex {
+	std::vector<MP3Frame> frames;
+
+	uint32 length; ///< Length of the MP3, in samples per channel.
+
+	MP3SeekIndex() : length(0) {
+	}
+};
+
+static bool compareFrameOffset(const MP3Frame &frame, uint32 offset) {
+	return frame.offset < offset;
+}
+
+static bool compareFrameSample(uint32 sample, const MP3Frame &frame) {
+	return sample < frame.sample;
+}
+
+MP3SeekIndexPtr MP3SeekIndexCache::get(const Common::UString &name) {
+	Common::StackLock lock(_mutex);
+
+	IndexMap::iterator index = _indexMap.find(name);
+	if (index == _indexMap.end())
+		return MP3SeekIndexPtr();
+
+	// Move the index to the front of the list
+	_indices.splice(_indices.begin(), _indices, index->second);
+
+	return index->second->second;
+}
+
+void MP3SeekIndexCache::add(const Common::UString &name, const MP3SeekIndexPtr &index) {
+	Common::StackLock lock(_mutex);
+
+	if (_indexMap.find(name) != _indexMap.end())
+		return;
+
+	_indices.push_front(std::make_pair(name, index));
+	_indexMap.insert(std::make_pair(name, _indices.begin()));
+
+	// Throw out the least recently used index
+	if (_indices.size() > kSeekIndexCacheSize) {
+		_indexMap.erase(_indices.back().first);
+		_indices.pop_back();
+	}
+}
+
+void MP3SeekIndexCache::clear() {
+	Common::StackLock lock(_mutex);
+
+	_indexMap.clear();
+	_indices.clear();
+}
+
+class MP3Stream : public SeekableAudioStream {
 protected:
 	enum State {
 		MP3_STATE_INIT,	// Need to init the decoder
@@ -50,7 +123,10 @@ protected:
 	uint _posInFrame;
 	State _state;
 
-	mad_timer_t _totalTime;
+	MP3SeekIndexPtr _seekIndex;
+
+	uint32 _bufferOffset; ///< Offset of the buffer start within the MP3 data.
+	uint32 _frameSample;  ///< First sample (per channel) of the current frame.
 
 	mad_stream _stream;
 	mad_frame _frame;
@@ -65,7 +141,7 @@ protected:
 
 public:
 	MP3Stream(Common::SeekableReadStream *inStream,
-	               bool dispose);
+	               bool dispose, const MP3SeekIndexPtr &seekIndex);
 	~MP3Stream();
 
 	int readBuffer(int16 *buffer, const int numSamples);
@@ -73,39 +149,41 @@ public:
 	bool endOfData() const		{ return _state == MP3_STATE_EOS; }
 	int getChannels() const		{ return MAD_NCHANNELS(&_frame.header); }
 	int getRate() const			{ return _frame.header.samplerate; }
-	bool rewind();
+
+	bool seek(uint64 sample);
+	uint64 getLength() const	{ return _seekIndex->length; }
+
+	const MP3SeekIndexPtr &getSeekIndex() const { return _seekIndex; }
 
 protected:
 	void decodeMP3Data();
 	void readMP3Data();
 
-	void initStream();
-	void readHeader();
+	void initStream(uint32 offset = 0);
+	bool readHeader();
 	void deinitStream();
+
+	void buildSeekIndex();
+	void findFrameSample();
 };
 
-MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, bool dispose) :
+MP3Stream::MP3Stream(Common::SeekableReadStream *inStream, bool dispose, const MP3SeekIndexPtr &seekIndex) :
 	_inStream(inStream),
 	_disposeAfterUse(dispose),
 	_posInFrame(0),
 	_state(MP3_STATE_INIT),
-	_totalTime(mad_timer_zero) {
+	_seekIndex(seekIndex),
+	_bufferOffset(0),
+	_frameSample(0) {
 
 	// The MAD_BUFFER_GUARD must always contain zeros (the reason
 	// for this is that the Layer III Huffman decoder of libMAD
 	// may read a few bytes beyond the end of the input buffer).
 	memset(_buf + BUFFER_SIZE, 0, MAD_BUFFER_GUARD);
 
-	// Calculate the length of the stream
-	initStream();
-
-	while (_state != MP3_STATE_EOS)
-		readHeader();
-
-	deinitStream();
-
-	// Reinit stream
-	_state = MP3_STATE_INIT;
+	// Find all frames, unless we already know where they are
+	if (!_seekIndex)
+		buildSeekIndex();
 
 	// Decode the first chunk of data. This is necessary so that _frame
 	// is setup and getChannels() and getRate() return correct results.
@@ -119,6 +197,44 @@ MP3Stream::~MP3Stream() {
 		delete _inStream;
 }
 
+void MP3Stream::buildSeekIndex() {
+	MP3SeekIndex *seekIndex = new MP3SeekIndex;
+	_seekIndex.reset(seekIndex);
+
+	initStream();
+
+	// Only read the frame headers, which is much faster than decoding the frames
+	while (readHeader()) {
+		MP3Frame frame;
+
+		frame.offset = _bufferOffset + (_stream.this_frame - _buf);
+		frame.sample = seekIndex->length;
+
+		seekIndex->frames.push_back(frame);
+		seekIndex->length += 32 * MAD_NSBSAMPLES(&_frame.header);
+	}
+
+	deinitStream();
+
+	// Reinit stream
+	_state = MP3_STATE_INIT;
+}
+
+void MP3Stream::findFrameSample() {
+	const std::vector<MP3Frame> &frames = _seekIndex->frames;
+
+	const uint32 offset = _bufferOffset + (_stream.this_frame - _buf);
+
+	std::vector<MP3Frame>::const_iterator frame =
+		std::lower_bound(frames.begin(), frames.end(), offset, compareFrameOffset);
+
+	if ((frame != frames.end()) && (frame->offset == offset))
+		_frameSample = frame->sample;
+	else
+		// Not a frame we found before, so it just follows the last one
+		_frameSample += _synth.pcm.length;
+}
+
 void MP3Stream::decodeMP3Data() {
 	do {
 		if (_state == MP3_STATE_INIT)
@@ -150,6 +266,9 @@ void MP3Stream::decodeMP3Data() {
 				}
 			}
 
+			// Where in the whole MP3 are we?
+			findFrameSample();
+
 			// Synthesize PCM data
 			mad_synth_frame(&_synth, &_frame);
 			_posInFrame = 0;
@@ -179,6 +298,9 @@ void MP3Stream::readMP3Data() {
 		memmove(_buf, _stream.next_frame, remaining);
 	}
 
+	// The preserved data directly precedes what we read next
+	_bufferOffset = _inStream->pos() - remaining;
+
 	// Try to read the next block
 	uint32 size = _inStream->read(_buf + remaining, BUFFER_SIZE - remaining);
 	if (size <= 0) {
@@ -191,20 +313,37 @@ void MP3Stream::readMP3Data() {
 	mad_stream_buffer(&_stream, _buf, size + remaining);
 }
 
-bool MP3Stream::rewind() {
-	mad_timer_t destination;
-	mad_timer_set(&destination, 0, 0, 1000);
+bool MP3Stream::seek(uint64 sample) {
+	const std::vector<MP3Frame> &frames = _seekIndex->frames;
 
-	if (_state != MP3_STATE_READY || mad_timer_compare(destination, _totalTime) < 0)
-		initStream();
+	if (sample >= _seekIndex->length) {
+		// Seeking to the very end just ends the stream
+		deinitStream();
+
+		return sample == _seekIndex->length;
+	}
 
-	while (mad_timer_compare(destination, _totalTime) > 0 && _state != MP3_STATE_EOS)
-		readHeader();
+	// Find the frame holding the sample, and start decoding a few frames earlier
+	const size_t frame = (std::upper_bound(frames.begin(), frames.end(), sample, compareFrameSample) - frames.begin()) - 1;
+	const size_t first = frame - MIN<size_t>(frame, kSeekPreroll);
 
-	return (_state != MP3_STATE_EOS);
+	// Starting at the first frame, we decode exactly like playing from the start does
+	initStream((first == 0) ? 0 : frames[first].offset);
+	_frameSample = frames[first].sample;
+
+	do {
+		decodeMP3Data();
+	} while ((_state != MP3_STATE_EOS) && ((_frameSample + _synth.pcm.length) <= sample));
+
+	if (_state == MP3_STATE_EOS)
+		return false;
+
+	// Should the frame itself have been broken, we start with the next one
+	_posInFrame = (sample > _frameSample) ? (sample - _frameSample) : 0;
+	return true;
 }
 
-void MP3Stream::initStream() {
+void MP3Stream::initStream(uint32 offset) {
 	if (_state != MP3_STATE_INIT)
 		deinitStream();
 
@@ -214,8 +353,9 @@ void MP3Stream::initStream() {
 	mad_synth_init(&_synth);
 
 	// Reset the stream data
-	_inStream->seek(0, SEEK_SET);
-	_totalTime = mad_timer_zero;
+	_inStream->seek(offset, SEEK_SET);
+	_bufferOffset = offset;
+	_frameSample = 0;
 	_posInFrame = 0;
 
 	// Update state
@@ -225,9 +365,9 @@ void MP3Stream::initStream() {
 	readMP3Data();
 }
 
-void MP3Stream::readHeader() {
+bool MP3Stream::readHeader() {
 	if (_state != MP3_STATE_READY)
-		return;
+		return false;
 
 	// If necessary, load more data into the stream decoder
 	if (_stream.error == MAD_ERROR_BUFLEN)
@@ -252,13 +392,13 @@ void MP3Stream::readHeader() {
 			}
 		}
 
-		// Sum up the total playback time so far
-		mad_timer_add(&_totalTime, _frame.header.duration);
 		break;
 	}
 
 	if (_stream.error != MAD_ERROR_NONE)
 		_state = MP3_STATE_EOS;
+
+	return _state != MP3_STATE_EOS;
 }
 
 void MP3Stream::deinitStream() {
@@ -309,16 +449,28 @@ int MP3Stream::readBuffer(int16 *buffer, const int numSamples) {
 	return samples;
 }
 
-RewindableAudioStream *makeMP3Stream(
+SeekableAudioStream *makeMP3Stream(
 	Common::SeekableReadStream *stream,
-	bool disposeAfterUse) {
-	RewindableAudioStream *s = new MP3Stream(stream, disposeAfterUse);
+	bool disposeAfterUse,
+	MP3SeekIndexCache *seekIndices,
+	const Common::UString &name) {
+
+	const bool cached = seekIndices && !name.empty();
+
+	MP3SeekIndexPtr seekIndex;
+	if (cached)
+		seekIndex = seekIndices->get(name);
+
+	MP3Stream *s = new MP3Stream(stream, disposeAfterUse, seekIndex);
 	if (s && s->endOfData()) {
 		delete s;
 		return 0;
-	} else {
-		return s;
 	}
+
+	if (cached && !seekIndex)
+		seekIndices->add(name, s->getSeekIndex());
+
+	return s;
 }
 
 } // End of namespace Sound
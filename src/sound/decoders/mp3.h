@@ -27,7 +27,14 @@
 #ifndef SOUND_DECODERS_MP3_H
 #define SOUND_DECODERS_MP3_H
 
+#include <list>
+#include <map>
+
+#include <boost/shared_ptr.hpp>
+
 #include "common/types.h"
+#include "common/ustring.h"
+#include "common/mutex.h"
 
 namespace Common {
 	class SeekableReadStream;
@@ -36,20 +43,55 @@ namespace Common {
 namespace Sound {
 
 class AudioStream;
-class RewindableAudioStream;
+class SeekableAudioStream;
+
+struct MP3SeekIndex;
+
+typedef boost::shared_ptr<const MP3SeekIndex> MP3SeekIndexPtr;
+
+/** The seek indices of the MP3s played last. Thread-safe. */
+class MP3SeekIndexCache {
+public:
+	/** Return the seek index cached under that name, or an empty pointer. */
+	MP3SeekIndexPtr get(const Common::UString &name);
+	/** Cache a seek index under that name, throwing out the least recently used one if full. */
+	void add(const Common::UString &name, const MP3SeekIndexPtr &index);
+
+	/** Remove all seek indices. */
+	void clear();
+
+private:
+	typedef std::list< std::pair<Common::UString, MP3SeekIndexPtr> > IndexList;
+	typedef std::map<Common::UString, IndexList::iterator> IndexMap;
+
+	IndexList _indices; ///< All cached indices, most recently used first.
+	IndexMap  _indexMap;
+
+	Common::Mutex _mutex;
+};
 
 /**
  * Create a new SeekableAudioStream from the MP3 data in the given stream.
  * Allows for seeking (which is why we require a SeekableReadStream).
  *
+ * To seek, the positions of all MP3 frames are collected in a first pass
+ * over the stream. This seek index can be kept around, so that playing
+ * the same MP3 again doesn't need another pass.
+ *
  * @param stream          The SeekableReadStream from which to read the MP3 data.
  * @param disposeAfterUse Whether to delete the stream after use.
+ * @param seekIndices     The cache to take the seek index from and put it into.
+ *                        If 0, the seek index is not cached.
+ * @param name            A unique name for the MP3, to cache its seek index under.
+ *                        If empty, the seek index is not cached.
  *
  * @return A new SeekableAudioStream, or 0, if an error occured.
  */
-RewindableAudioStream *makeMP3Stream(
+SeekableAudioStream *makeMP3Stream(
 	Common::SeekableReadStream *stream,
-	bool disposeAfterUse);
+	bool disposeAfterUse,
+	MP3SeekIndexCache *seekIndices = 0,
+	const Common::UString &name = "");
 
 } // End of namespace Sound
 
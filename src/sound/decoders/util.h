@@ -25,6 +25,10 @@
 #ifndef SOUND_DECODERS_UTIL_H
 #define SOUND_DECODERS_UTIL_H
 
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
 #include "common/types.h"
 #include "common/util.h"
 
@@ -35,11 +39,52 @@ static inline int16 floatToInt16(float src) {
 	return (int16) CLIP<int>((int) floor(src + 0.5), -32768, 32767);
 }
 
+#ifdef __SSE2__
+// Round four float samples the same way floatToInt16() does, without clipping
+static inline __m128i floatToInt32x4(__m128 src) {
+	// cvtps rounds halfway cases to even, while floatToInt16() always rounds them up
+	const __m128i r = _mm_cvtps_epi32(src);
+	const __m128  d = _mm_sub_ps(src, _mm_cvtepi32_ps(r));
+
+	const __m128i up = _mm_castps_si128(_mm_cmpeq_ps(d, _mm_set1_ps(0.5f)));
+
+	return _mm_sub_epi32(r, up);
+}
+
+// Convert eight float samples into int16 samples, clipping them
+static inline __m128i floatToInt16x8(const float *src) {
+	return _mm_packs_epi32(floatToInt32x4(_mm_loadu_ps(src)), floatToInt32x4(_mm_loadu_ps(src + 4)));
+}
+#endif
+
 // Convert planar float samples into interleaved int16 samples
 static inline void floatToInt16Interleave(int16 *dst, const float **src,
                                           uint32 length, uint8 channels) {
-	if (channels == 2) {
-		for (uint32 i = 0; i < length; i++) {
+	if (channels == 1) {
+		uint32 i = 0;
+
+#ifdef __SSE2__
+		for (; (i + 8) <= length; i += 8)
+			_mm_storeu_si128((__m128i *) (dst + i), floatToInt16x8(src[0] + i));
+#endif
+
+		for (; i < length; i++)
+			dst[i] = floatToInt16(src[0][i]);
+
+	} else if (channels == 2) {
+		uint32 i = 0;
+
+#ifdef __SSE2__
+		for (; (i + 8) <= length; i += 8) {
+			const __m128i l = floatToInt16x8(src[0] + i);
+			const __m128i r = floatToInt16x8(src[1] + i);
+
+			_mm_storeu_si128((__m128i *) (dst + 2 * i    ), _mm_unpacklo_epi16(l, r));
+			_mm_storeu_si128((__m128i *) (dst + 2 * i + 8), _mm_unpackhi_epi16(l, r));
+		}
+#endif
+
+		for (; i < length; i++) {
 			dst[2 * i    ] = floatToInt16(src[0][i]);
 			dst[2 * i + 1] = floatToInt16(src[1][i]);
 		}
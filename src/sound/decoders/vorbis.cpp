@@ -66,7 +66,7 @@ static ov_callbacks g_stream_wrap = {
 	read_stream_wrap, seek_stream_wrap, close_stream_wrap, tell_stream_wrap
 };
 
-class VorbisStream : public RewindableAudioStream {
+class VorbisStream : public SeekableAudioStream {
 protected:
 	Common::SeekableReadStream *_inStream;
 	bool _disposeAfterUse;
@@ -74,6 +74,8 @@ protected:
 	bool _isStereo;
 	int _rate;
 
+	uint64 _length; ///< Length of the stream, in samples per channel.
+
 	OggVorbis_File _ovFile;
 
 	int16 _buffer[4096];
@@ -90,7 +92,9 @@ public:
 	bool endOfData() const		{ return _pos >= _bufferEnd; }
 	int getChannels() const		{ return _isStereo ? 2 : 1; }
 	int getRate() const			{ return _rate; }
-	bool rewind();
+
+	bool seek(uint64 sample);
+	uint64 getLength() const	{ return _length; }
 
 protected:
 	bool refill();
@@ -99,6 +103,7 @@ protected:
 VorbisStream::VorbisStream(Common::SeekableReadStream *inStream, bool dispose) :
 	_inStream(inStream),
 	_disposeAfterUse(dispose),
+	_length(0),
 	_bufferEnd(_buffer + ARRAYSIZE(_buffer)) {
 
 	int res = ov_open_callbacks(inStream, &_ovFile, 0, 0, g_stream_wrap);
@@ -115,6 +120,9 @@ VorbisStream::VorbisStream(Common::SeekableReadStream *inStream, bool dispose) :
 	// Setup some header information
 	_isStereo = ov_info(&_ovFile, -1)->channels >= 2;
 	_rate = ov_info(&_ovFile, -1)->rate;
+
+	// vorbisfile already found all the Ogg pages it needs for seeking
+	_length = MAX<ogg_int64_t>(ov_pcm_total(&_ovFile, -1), 0);
 }
 
 VorbisStream::~VorbisStream() {
@@ -139,9 +147,16 @@ int VorbisStream::readBuffer(int16 *buffer, const int numSamples) {
 	return samples;
 }
 
-bool VorbisStream::rewind() {
-	ov_pcm_seek(&_ovFile, 0);
-	return true;
+bool VorbisStream::seek(uint64 sample) {
+	int res = ov_pcm_seek(&_ovFile, sample);
+	if (res < 0) {
+		warning("Error seeking in Vorbis stream (%d)", res);
+		_pos = _bufferEnd;
+		return false;
+	}
+
+	// Throw away what we decoded before the seek
+	return refill();
 }
 
 bool VorbisStream::refill() {
@@ -199,10 +214,10 @@ bool VorbisStream::refill() {
 	return true;
 }
 
-RewindableAudioStream *makeVorbisStream(
+SeekableAudioStream *makeVorbisStream(
 	Common::SeekableReadStream *stream,
 	bool disposeAfterUse) {
-	RewindableAudioStream *s = new VorbisStream(stream, disposeAfterUse);
+	SeekableAudioStream *s = new VorbisStream(stream, disposeAfterUse);
 
 	if (s && s->endOfData()) {
 		delete s;
@@ -35,17 +35,17 @@ namespace Common {
 
 namespace Sound {
 
-class RewindableAudioStream;
+class SeekableAudioStream;
 
 /**
- * Create a new RewindableAudioStream from the Ogg Vorbis data in the given stream.
+ * Create a new SeekableAudioStream from the Ogg Vorbis data in the given stream.
  *
- * @param stream          The RewindableAudioStream from which to read the Ogg Vorbis data.
+ * @param stream          The SeekableReadStream from which to read the Ogg Vorbis data.
  * @param disposeAfterUse Whether to delete the stream after use.
  *
- * @return A new RewindableAudioStream, or 0, if an error occured.
+ * @return A new SeekableAudioStream, or 0, if an error occured.
  */
-RewindableAudioStream *makeVorbisStream(
+SeekableAudioStream *makeVorbisStream(
 	Common::SeekableReadStream *stream,
 	bool disposeAfterUse);
 
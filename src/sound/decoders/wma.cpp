@@ -26,6 +26,10 @@
 
 #include <vector>
 
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
 #include "common/util.h"
 #include "common/maths.h"
 #include "common/sinewindows.h"
@@ -44,7 +48,20 @@
 
 namespace Sound {
 
+/* The vector helpers below do the same floating point operations in the
+ * same order with SSE2 as without, so their results are bit-identical. */
+
 static inline void butterflyFloats(float *v1, float *v2, int len) {
+#ifdef __SSE2__
+	for (; len >= 4; len -= 4, v1 += 4, v2 += 4) {
+		const __m128 a = _mm_loadu_ps(v1);
+		const __m128 b = _mm_loadu_ps(v2);
+
+		_mm_storeu_ps(v1, _mm_add_ps(a, b));
+		_mm_storeu_ps(v2, _mm_sub_ps(a, b));
+	}
+#endif
+
 	while (len-- > 0) {
 		float t = *v1 - *v2;
 
@@ -55,6 +72,14 @@ static inline void butterflyFloats(float *v1, float *v2, int len) {
 
 static inline void vectorFMulAdd(float *dst, const float *src0,
                           const float *src1, const float *src2, int len) {
+#ifdef __SSE2__
+	for (; len >= 4; len -= 4, dst += 4, src0 += 4, src1 += 4, src2 += 4) {
+		const __m128 m = _mm_mul_ps(_mm_loadu_ps(src0), _mm_loadu_ps(src1));
+
+		_mm_storeu_ps(dst, _mm_add_ps(m, _mm_loadu_ps(src2)));
+	}
+#endif
+
 	while (len-- > 0)
 		*dst++ = *src0++ * *src1++ + *src2++;
 }
@@ -63,10 +88,61 @@ static inline void vectorFMulReverse(float *dst, const float *src0,
                                      const float *src1, int len) {
 	src1 += len - 1;
 
+#ifdef __SSE2__
+	for (; len >= 4; len -= 4, dst += 4, src0 += 4, src1 -= 4) {
+		__m128 w = _mm_loadu_ps(src1 - 3);
+		w = _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 1, 2, 3));
+
+		_mm_storeu_ps(dst, _mm_mul_ps(_mm_loadu_ps(src0), w));
+	}
+#endif
+
 	while (len-- > 0)
 		*dst++ = *src0++ * *src1--;
 }
 
+/** dst[i] = src0[i] * src1[i] * mult. */
+static inline void vectorFMulScalar(float *dst, const float *src0,
+                                    const float *src1, float mult, int len) {
+#ifdef __SSE2__
+	const __m128 m = _mm_set1_ps(mult);
+
+	for (; len >= 4; len -= 4, dst += 4, src0 += 4, src1 += 4)
+		_mm_storeu_ps(dst, _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src0), _mm_loadu_ps(src1)), m));
+#endif
+
+	while (len-- > 0)
+		*dst++ = *src0++ * *src1++ * mult;
+}
+
+#ifdef __SSE2__
+/** WMACodec::pow_m1_4() on four values at once. */
+static inline void powM14x4(float *out, __m128 x, const float *eTable,
+                           const float *mTable1, const float *mTable2, int powBits) {
+	const __m128i v = _mm_castps_si128(x);
+
+	const __m128i e = _mm_srli_epi32(v, 23);
+	const __m128i m = _mm_and_si128(_mm_srli_epi32(v, 23 - powBits), _mm_set1_epi32((1 << powBits) - 1));
+
+	// Build interpolation scale: 1 <= t < 2
+	const __m128i t = _mm_or_si128(_mm_and_si128(_mm_slli_epi32(v, powBits), _mm_set1_epi32((1 << 23) - 1)),
+	                               _mm_set1_epi32(127 << 23));
+
+	int32 eIndex[4], mIndex[4];
+	_mm_storeu_si128((__m128i *) eIndex, e);
+	_mm_storeu_si128((__m128i *) mIndex, m);
+
+	const __m128 a  = _mm_set_ps(mTable1[mIndex[3]], mTable1[mIndex[2]],
+	                             mTable1[mIndex[1]], mTable1[mIndex[0]]);
+	const __m128 b  = _mm_set_ps(mTable2[mIndex[3]], mTable2[mIndex[2]],
+	                             mTable2[mIndex[1]], mTable2[mIndex[0]]);
+	const __m128 pe = _mm_set_ps(eTable[eIndex[3]], eTable[eIndex[2]],
+	                             eTable[eIndex[1]], eTable[eIndex[0]]);
+
+	_mm_storeu_ps(out, _mm_mul_ps(pe, _mm_add_ps(a, _mm_mul_ps(b, _mm_castsi128_ps(t)))));
+}
+#endif
+
 
 WMACodec::WMACodec(int version, uint32 sampleRate, uint8 channels,
 		uint32 bitRate, uint32 blockAlign, Common::SeekableReadStream *extraData) :
@@ -559,7 +635,14 @@ Common::SeekableReadStream *WMACodec::decodeSuperFrame(Common::SeekableReadStrea
 	if (_blockAlign)
 		size = _blockAlign;
 
-	Common::BitStream8MSB bits(data);
+	// Read the superframe into memory, so that we can decode it without virtual calls
+	_superframe.resize(data.size() - data.pos());
+	if (!_superframe.empty() && (data.read(&_superframe[0], _superframe.size()) != _superframe.size())) {
+		warning("WMACodec::decodeSuperFrame(): Read error");
+		return 0;
+	}
+
+	Common::MemoryBitStream8MSB bits(_superframe.empty() ? 0 : &_superframe[0], _superframe.size());
 
 	int    outputDataSize = 0;
 	int16 *outputData     = 0;
@@ -618,8 +701,7 @@ Common::SeekableReadStream *WMACodec::decodeSuperFrame(Common::SeekableReadStrea
 				_lastSuperframeLen += 1;
 			}
 
-			Common::MemoryReadStream lastSuperframe(_lastSuperframe, _lastSuperframeLen);
-			Common::BitStream8MSB lastBits(lastSuperframe);
+			Common::MemoryBitStream8MSB lastBits(_lastSuperframe, _lastSuperframeLen);
 
 			lastBits.skip(_lastBitoffset);
 
@@ -683,7 +765,7 @@ Common::SeekableReadStream *WMACodec::decodeSuperFrame(Common::SeekableReadStrea
 	return new Common::MemoryReadStream((byte *) outputData, outputDataSize * 2, true);
 }
 
-bool WMACodec::decodeFrame(Common::BitStream &bits, int16 *outputData) {
+bool WMACodec::decodeFrame(Common::MemoryBitStream8MSB &bits, int16 *outputData) {
 	_framePos = 0;
 	_curBlock = 0;
 
@@ -713,7 +795,7 @@ bool WMACodec::decodeFrame(Common::BitStream &bits, int16 *outputData) {
 	return true;
 }
 
-int WMACodec::decodeBlock(Common::BitStream &bits) {
+int WMACodec::decodeBlock(Common::MemoryBitStream8MSB &bits) {
 	// Computer new block length
 	if (!evalBlockLength(bits))
 		return -1;
@@ -766,7 +848,7 @@ int WMACodec::decodeBlock(Common::BitStream &bits) {
 	return 0;
 }
 
-bool WMACodec::decodeChannels(Common::BitStream &bits, int bSize,
+bool WMACodec::decodeChannels(Common::MemoryBitStream8MSB &bits, int bSize,
                               bool msStereo, bool *hasChannel) {
 
 	int totalGain    = readTotalGain(bits);
@@ -806,23 +888,45 @@ bool WMACodec::decodeChannels(Common::BitStream &bits, int bSize,
 bool WMACodec::calculateIMDCT(int bSize, bool msStereo, bool *hasChannel) {
 	Common::MDCT &mdct = *_mdct[bSize];
 
+	// Transform all channels with coefficients at once
+	float       *output[kChannelsMax];
+	const float *coefs [kChannelsMax];
+
+	int count = 0;
+	for (int i = 0; i < _channels; i++) {
+		if (!hasChannel[i])
+			continue;
+
+		output[count] = _output[i];
+		coefs [count] = _coefs [i];
+		count++;
+	}
+
+	if (count > 0)
+		mdct.calcIMDCT(output, coefs, count);
+
 	for (int i = 0; i < _channels; i++) {
 		int n4 = _blockLen / 2;
 
-		if (hasChannel[i])
-			mdct.calcIMDCT(_output, _coefs[i]);
-		else if (!(msStereo && (i == 1)))
-			memset(_output, 0, sizeof(_output));
+		const float *in = _output[i];
+
+		// Without coefficients of its own, the second M/S channel reuses the first one's output
+		if (!hasChannel[i]) {
+			if (msStereo && (i == 1))
+				in = _output[0];
+			else
+				memset(_output[i], 0, sizeof(_output[i]));
+		}
 
 		// Multiply by the window and add in the frame
 		int index = (_frameLen / 2) + _framePos - n4;
-		window(&_frameOut[i][index]);
+		window(in, &_frameOut[i][index]);
 	}
 
 	return true;
 }
 
-bool WMACodec::evalBlockLength(Common::BitStream &bits) {
+bool WMACodec::evalBlockLength(Common::MemoryBitStream8MSB &bits) {
 	if (_useVariableBlockLen) {
 		// Variable block lengths
 
@@ -898,7 +1002,7 @@ void WMACodec::calculateCoefCount(int *coefCount, int bSize) const {
 		coefCount[i] = coefN;
 }
 
-bool WMACodec::decodeNoise(Common::BitStream &bits, int bSize,
+bool WMACodec::decodeNoise(Common::MemoryBitStream8MSB &bits, int bSize,
                            bool *hasChannel, int *coefCount) {
 	if (!_useNoiseCoding)
 		return true;
@@ -949,7 +1053,7 @@ bool WMACodec::decodeNoise(Common::BitStream &bits, int bSize,
 	return true;
 }
 
-bool WMACodec::decodeExponents(Common::BitStream &bits, int bSize, bool *hasChannel) {
+bool WMACodec::decodeExponents(Common::MemoryBitStream8MSB &bits, int bSize, bool *hasChannel) {
 	// Exponents can be reused in short blocks
 	if (!((_blockLenBits == _frameLenBits) || bits.getBit()))
 		return true;
@@ -972,7 +1076,7 @@ bool WMACodec::decodeExponents(Common::BitStream &bits, int bSize, bool *hasChan
 	return true;
 }
 
-bool WMACodec::decodeSpectralCoef(Common::BitStream &bits, bool msStereo, bool *hasChannel,
+bool WMACodec::decodeSpectralCoef(Common::MemoryBitStream8MSB &bits, bool msStereo, bool *hasChannel,
                                   int *coefCount, int coefBitCount) {
 	// Simple RLE encoding
 
@@ -1116,9 +1220,15 @@ void WMACodec::calculateMDCTCoefficients(int bSize, bool *hasChannel,
 			for (int j = 0; j < _coefsStart; j++)
 				*coefs++ = 0.0;
 
-			for (int j = 0;j < coefCount[i]; j++) {
-				*coefs = coefs1[j] * exponents[(j << bSize) >> eSize] * mult;
-				coefs++;
+			if (bSize == eSize) {
+				// The exponents were decoded for this very block size
+				vectorFMulScalar(coefs, coefs1, exponents, mult, coefCount[i]);
+				coefs += coefCount[i];
+			} else {
+				for (int j = 0;j < coefCount[i]; j++) {
+					*coefs = coefs1[j] * exponents[(j << bSize) >> eSize] * mult;
+					coefs++;
+				}
 			}
 
 			int n = _blockLen - _coefsEnd[bSize];
@@ -1212,7 +1322,7 @@ static const float powTab[] = {
     7.4989420933246e+05, 8.6596432336007e+05,
 };
 
-bool WMACodec::decodeExpHuffman(Common::BitStream &bits, int ch) {
+bool WMACodec::decodeExpHuffman(Common::MemoryBitStream8MSB &bits, int ch) {
 	const float  *ptab  = powTab + 60;
 	const uint32 *iptab = (const uint32 *) ptab;
 
@@ -1284,7 +1394,36 @@ bool WMACodec::decodeExpHuffman(Common::BitStream &bits, int ch) {
 void WMACodec::lspToCurve(float *out, float *val_max_ptr, int n, float *lsp) {
 	float val_max = 0;
 
-	for (int i = 0; i < n; i++) {
+	int i = 0;
+
+#ifdef __SSE2__
+	// Four points of the curve at once
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128 two  = _mm_set1_ps(2.0f);
+
+	for (; (i + 4) <= n; i += 4) {
+		__m128 p = half;
+		__m128 q = half;
+
+		const __m128 w = _mm_loadu_ps(_lspCosTable + i);
+
+		for (int j = 1; j < kLSPCoefCount; j += 2) {
+			q = _mm_mul_ps(q, _mm_sub_ps(w, _mm_set1_ps(lsp[j - 1])));
+			p = _mm_mul_ps(p, _mm_sub_ps(w, _mm_set1_ps(lsp[j])));
+		}
+
+		p = _mm_mul_ps(p, _mm_mul_ps(p, _mm_sub_ps(two, w)));
+		q = _mm_mul_ps(q, _mm_mul_ps(q, _mm_add_ps(two, w)));
+
+		powM14x4(out + i, _mm_add_ps(p, q), _lspPowETable, _lspPowMTable1, _lspPowMTable2, kLSPPowBits);
+
+		for (int j = 0; j < 4; j++)
+			if (out[i + j] > val_max)
+				val_max = out[i + j];
+	}
+#endif
+
+	for (; i < n; i++) {
 		float p = 0.5f;
 		float q = 0.5f;
 		float w = _lspCosTable[i];
@@ -1310,7 +1449,7 @@ void WMACodec::lspToCurve(float *out, float *val_max_ptr, int n, float *lsp) {
 }
 
 // Decode exponents coded with LSP coefficients (same idea as Vorbis)
-bool WMACodec::decodeExpLSP(Common::BitStream &bits, int ch) {
+bool WMACodec::decodeExpLSP(Common::MemoryBitStream8MSB &bits, int ch) {
 	float lspCoefs[kLSPCoefCount];
 
 	for (int i = 0; i < kLSPCoefCount; i++) {
@@ -1328,7 +1467,7 @@ bool WMACodec::decodeExpLSP(Common::BitStream &bits, int ch) {
 	return true;
 }
 
-bool WMACodec::decodeRunLevel(Common::BitStream &bits, const Common::Huffman &huffman,
+bool WMACodec::decodeRunLevel(Common::MemoryBitStream8MSB &bits, const Common::Huffman &huffman,
 	const float *levelTable, const uint16 *runTable, int version, float *ptr,
 	int offset, int numCoefs, int blockLen, int frameLenBits, int coefNbBits) {
 
@@ -1403,9 +1542,7 @@ bool WMACodec::decodeRunLevel(Common::BitStream &bits, const Common::Huffman &hu
  *  We ensure that when the windows overlap their squared sum
  *  is always 1 (MDCT reconstruction rule).
  */
-void WMACodec::window(float *out) const {
-	const float *in = _output;
-
+void WMACodec::window(const float *in, float *out) const {
 	// Left part
 	if (_blockLenBits <= _prevBlockLenBits) {
 
@@ -1470,7 +1607,7 @@ float WMACodec::pow_m1_4(float x) const {
 	return _lspPowETable[e] * (a + b * t.f);
 }
 
-int WMACodec::readTotalGain(Common::BitStream &bits) {
+int WMACodec::readTotalGain(Common::MemoryBitStream8MSB &bits) {
 	int totalGain = 1;
 
 	int v = 127;
@@ -1491,7 +1628,7 @@ int WMACodec::totalGainToBits(int totalGain) {
 	else                     return  9;
 }
 
-uint32 WMACodec::getLargeVal(Common::BitStream &bits) {
+uint32 WMACodec::getLargeVal(Common::MemoryBitStream8MSB &bits) {
 	// Consumes up to 34 bits
 
 	int count = 8;
@@ -29,10 +29,11 @@
 
 #include <vector>
 
+#include "common/bitstream.h"
+
 #include "sound/decoders/codec.h"
 
 namespace Common {
-	class BitStream;
 	class Huffman;
 	class MDCT;
 }
@@ -154,8 +155,11 @@ private:
 	int  _lastSuperframeLen; ///< Size of the overhang data. */
 	int  _lastBitoffset;     ///< Bit position within the overhang. */
 
+	/** The data of the superframe currently being decoded. */
+	std::vector<byte> _superframe;
+
 	// Output
-	float _output[kBlockSizeMax * 2];
+	float _output[kChannelsMax][kBlockSizeMax * 2];
 	float _frameOut[kChannelsMax][kBlockSizeMax * 2];
 
 
@@ -182,39 +186,39 @@ private:
 	// Decoding
 
 	Common::SeekableReadStream *decodeSuperFrame(Common::SeekableReadStream &data);
-	bool decodeFrame(Common::BitStream &bits, int16 *outputData);
-	int decodeBlock(Common::BitStream &bits);
+	bool decodeFrame(Common::MemoryBitStream8MSB &bits, int16 *outputData);
+	int decodeBlock(Common::MemoryBitStream8MSB &bits);
 
 	// Decoding helpers
 
-	bool evalBlockLength(Common::BitStream &bits);
-	bool decodeChannels(Common::BitStream &bits, int bSize, bool msStereo, bool *hasChannel);
+	bool evalBlockLength(Common::MemoryBitStream8MSB &bits);
+	bool decodeChannels(Common::MemoryBitStream8MSB &bits, int bSize, bool msStereo, bool *hasChannel);
 	bool calculateIMDCT(int bSize, bool msStereo, bool *hasChannel);
 
 	void calculateCoefCount(int *coefCount, int bSize) const;
-	bool decodeNoise(Common::BitStream &bits, int bSize, bool *hasChannel, int *coefCount);
-	bool decodeExponents(Common::BitStream &bits, int bSize, bool *hasChannel);
-	bool decodeSpectralCoef(Common::BitStream &bits, bool msStereo, bool *hasChannel,
+	bool decodeNoise(Common::MemoryBitStream8MSB &bits, int bSize, bool *hasChannel, int *coefCount);
+	bool decodeExponents(Common::MemoryBitStream8MSB &bits, int bSize, bool *hasChannel);
+	bool decodeSpectralCoef(Common::MemoryBitStream8MSB &bits, bool msStereo, bool *hasChannel,
 	                        int *coefCount, int coefBitCount);
 	float getNormalizedMDCTLength() const;
 	void calculateMDCTCoefficients(int bSize, bool *hasChannel,
 	                               int *coefCount, int totalGain, float mdctNorm);
 
-	bool decodeExpHuffman(Common::BitStream &bits, int ch);
-	bool decodeExpLSP(Common::BitStream &bits, int ch);
-	bool decodeRunLevel(Common::BitStream &bits, const Common::Huffman &huffman,
+	bool decodeExpHuffman(Common::MemoryBitStream8MSB &bits, int ch);
+	bool decodeExpLSP(Common::MemoryBitStream8MSB &bits, int ch);
+	bool decodeRunLevel(Common::MemoryBitStream8MSB &bits, const Common::Huffman &huffman,
 		const float *levelTable, const uint16 *runTable, int version, float *ptr,
 		int offset, int numCoefs, int blockLen, int frameLenBits, int coefNbBits);
 
 	void lspToCurve(float *out, float *val_max_ptr, int n, float *lsp);
 
-	void window(float *out) const;
+	void window(const float *in, float *out) const;
 
 	float pow_m1_4(float x) const;
 
-	static int readTotalGain(Common::BitStream &bits);
+	static int readTotalGain(Common::MemoryBitStream8MSB &bits);
 	static int totalGainToBits(int totalGain);
-	static uint32 getLargeVal(Common::BitStream &bits);
+	static uint32 getLargeVal(Common::MemoryBitStream8MSB &bits);
 };
 
 } // End of namespace Sound
@@ -0,0 +1,600 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/mixer.cpp
+ *  A software mixer.
+ */
+
+#include <cassert>
+#include <cstring>
+#include <cmath>
+
+#include <SDL_timer.h>
+
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
+#include "common/util.h"
+#include "common/maths.h"
+
+#include "sound/mixer.h"
+#include "sound/audiostream.h"
+
+/** Number of frames mixed in one go, with one gain ramp. */
+static const uint32 kBlockFrames  = 256;
+/** Number of frames decoded out of a stream in one go. */
+static const uint32 kDecodeFrames = 1024;
+/** Number of decoded frames each voice holds ready for mixing. */
+static const uint32 kRingFrames   = 8192;
+
+namespace Sound {
+
+/** A stream played by the mixer. */
+struct Mixer::Voice {
+	AudioStream *stream;
+
+	uint32 rate;
+	uint32 channels;
+
+	bool paused;
+	bool ended;    ///< The stream ended, only the decoded frames are left.
+	bool padded;   ///< The silent frame after the stream's last frame was added.
+	bool started;  ///< Were any frames taken out of the ring yet?
+	bool finished; ///< The stream ended and was played completely.
+
+	float gain;
+	float pitch;
+
+	bool  positional;
+	float x, y, z;
+
+	float gainL, gainR;     ///< The current gain of both output channels.
+	float targetL, targetR; ///< The gain of both output channels at the end of the next block.
+
+	std::vector<float> frames; ///< Stereo frames taken out of the ring, to be mixed.
+	uint32 frameCount;         ///< Number of stereo frames to be mixed.
+	double position;           ///< Position of the next output frame within the frames to be mixed.
+
+	std::vector<float> ring; ///< Decoded stereo frames, written by decode().
+	uint32 ringRead;         ///< Index of the first decoded frame in the ring.
+	uint32 ringWrite;        ///< Index of the next frame to decode into. Only touched by decode().
+	uint32 ringFill;         ///< Number of decoded frames in the ring.
+
+	std::vector<int16> decode; ///< The stream is read into here. Only touched by decode().
+
+	uint32 index; ///< Index into the mixer's voices.
+};
+
+
+/** Mix count frames, resampled with linear interpolation, with a gain ramp. */
+static void mixLinear(float *dst, const float *src, double &position, double step, uint32 count,
+                      float &gainL, float &gainR, float deltaL, float deltaR) {
+
+	uint32 n = 0;
+
+#ifdef __SSE2__
+	// Two stereo frames at once. The loads gather the two frames each one is interpolated from
+	for (; (n + 2) <= count; n += 2, dst += 4) {
+		const double p0 = position + n * step;
+		const double p1 = p0 + step;
+
+		const uint32 i0 = (uint32) p0;
+		const uint32 i1 = (uint32) p1;
+
+		const float f0 = p0 - i0;
+		const float f1 = p1 - i1;
+
+		__m128 a = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (src + 2 * i0));
+		__m128 b = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (src + 2 * i0 + 2));
+
+		a = _mm_loadh_pi(a, (const __m64 *) (src + 2 * i1));
+		b = _mm_loadh_pi(b, (const __m64 *) (src + 2 * i1 + 2));
+
+		const float gL = gainL + n * deltaL;
+		const float gR = gainR + n * deltaR;
+
+		const __m128 frac = _mm_set_ps(f1, f1, f0, f0);
+		const __m128 gain = _mm_set_ps(gR + deltaR, gL + deltaL, gR, gL);
+
+		const __m128 s = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), frac));
+
+		_mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(s, gain)));
+	}
+#endif
+
+	for (; n < count; n++, dst += 2) {
+		const double p = position + n * step;
+
+		const uint32 i = (uint32) p;
+		const float  f = p - i;
+
+		const float *s = src + 2 * i;
+
+		dst[0] += (s[0] + (s[2] - s[0]) * f) * (gainL + n * deltaL);
+		dst[1] += (s[1] + (s[3] - s[1]) * f) * (gainR + n * deltaR);
+	}
+
+	position += count * step;
+
+	gainL += count * deltaL;
+	gainR += count * deltaR;
+}
+
+/** Mix count frames, at the same rate and aligned to the decoded frames, with a gain ramp. */
+static void mixCopy(float *dst, const float *src, double &position, uint32 count,
+                    float &gainL, float &gainR, float deltaL, float deltaR) {
+
+	src += 2 * (uint32) position;
+
+	uint32 n = 0;
+
+#ifdef __SSE2__
+	__m128       gain  = _mm_set_ps(gainR + deltaR, gainL + deltaL, gainR, gainL);
+	const __m128 delta = _mm_set_ps(2 * deltaR, 2 * deltaL, 2 * deltaR, 2 * deltaL);
+
+	for (; (n + 2) <= count; n += 2, dst += 4, src += 4) {
+		_mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_mul_ps(_mm_loadu_ps(src), gain)));
+
+		gain = _mm_add_ps(gain, delta);
+	}
+#endif
+
+	for (; n < count; n++, dst += 2, src += 2) {
+		dst[0] += src[0] * (gainL + n * deltaL);
+		dst[1] += src[1] * (gainR + n * deltaR);
+	}
+
+	position += count;
+
+	gainL += count * deltaL;
+	gainR += count * deltaR;
+}
+
+/** Convert mixed samples into clipped 16-bit samples. */
+static void convertMix(int16 *dst, const float *src, uint32 count) {
+	uint32 n = 0;
+
+#ifdef __SSE2__
+	const __m128 scale = _mm_set1_ps(32767.0f);
+
+	// The packing saturates
+	for (; (n + 8) <= count; n += 8) {
+		const __m128i a = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + n    ), scale));
+		const __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(src + n + 4), scale));
+
+		_mm_storeu_si128((__m128i *) (dst + n), _mm_packs_epi32(a, b));
+	}
+#endif
+
+	for (; n < count; n++)
+		dst[n] = (int16) CLIP<float>(floorf(src[n] * 32767.0f + 0.5f), -32768.0f, 32767.0f);
+}
+
+/** Convert decoded 16-bit frames of any channel count into float stereo frames. */
+static void convertFrames(float *dst, const int16 *src, uint32 count, uint32 channels) {
+	const float scale = 1.0f / 32768.0f;
+
+	if        (channels == 1) {
+		for (uint32 i = 0; i < count; i++, dst += 2, src++)
+			dst[0] = dst[1] = src[0] * scale;
+
+	} else if (channels == 6) {
+		// 5.1 downmix: front left, front right, center, LFE, rear left, rear right
+		const float side = 0.7071f * scale;
+
+		for (uint32 i = 0; i < count; i++, dst += 2, src += 6) {
+			dst[0] = src[0] * scale + (src[2] + src[4]) * side;
+			dst[1] = src[1] * scale + (src[2] + src[5]) * side;
+		}
+
+	} else {
+		for (uint32 i = 0; i < count; i++, dst += 2, src += channels) {
+			dst[0] = src[0] * scale;
+			dst[1] = src[1] * scale;
+		}
+	}
+}
+
+
+Mixer::Mixer(uint32 rate) : _rate(rate), _listenerGain(1.0),
+	_mixedFrames(0), _mixTicks(0), _underruns(0) {
+
+	_mixBuffer.resize(kBlockFrames * 2);
+}
+
+Mixer::~Mixer() {
+	for (std::vector<Voice *>::iterator v = _voices.begin(); v != _voices.end(); ++v)
+		delete *v;
+}
+
+uint32 Mixer::getRate() const {
+	return _rate;
+}
+
+void Mixer::getStatistics(uint64 &frames, double &time, uint32 &underruns) const {
+	Common::StackLock lock(_mutex);
+
+	frames    = _mixedFrames;
+	time      = ((double) _mixTicks) / SDL_GetPerformanceFrequency();
+	underruns = _underruns;
+}
+
+void Mixer::setListenerGain(float gain) {
+	Common::StackLock lock(_mutex);
+
+	_listenerGain = gain;
+
+	for (std::vector<Voice *>::iterator v = _voices.begin(); v != _voices.end(); ++v)
+		updateGain(**v);
+}
+
+Mixer::Voice *Mixer::addVoice(AudioStream *stream) {
+	assert(stream);
+
+	Voice *voice = new Voice;
+
+	voice->stream   = stream;
+	voice->rate     = stream->getRate();
+	voice->channels = MAX(stream->getChannels(), 1);
+
+	voice->paused   = true;
+	voice->ended    = false;
+	voice->padded   = false;
+	voice->started  = false;
+	voice->finished = false;
+
+	voice->gain  = 1.0;
+	voice->pitch = 1.0;
+
+	voice->positional = false;
+	voice->x = voice->y = voice->z = 0.0;
+
+	voice->gainL = voice->gainR = voice->targetL = voice->targetR = 0.0;
+
+	voice->frames.resize((kDecodeFrames + 2) * 2);
+	voice->ring.resize(kRingFrames * 2);
+	voice->decode.resize(kDecodeFrames * voice->channels);
+
+	voice->frameCount = 0;
+	voice->position   = 0.0;
+
+	voice->ringRead  = 0;
+	voice->ringWrite = 0;
+	voice->ringFill  = 0;
+
+	Common::StackLock lock(_mutex);
+
+	updateGain(*voice);
+
+	voice->index = _voices.size();
+	_voices.push_back(voice);
+
+	return voice;
+}
+
+void Mixer::removeVoice(Voice *voice) {
+	if (!voice)
+		return;
+
+	Common::StackLock decodeLock(_decodeMutex);
+	Common::StackLock lock(_mutex);
+
+	assert((voice->index < _voices.size()) && (_voices[voice->index] == voice));
+
+	// Move the last voice into its place
+	_voices[voice->index] = _voices.back();
+	_voices[voice->index]->index = voice->index;
+
+	_voices.pop_back();
+
+	delete voice;
+}
+
+bool Mixer::isFinished(const Voice *voice) const {
+	Common::StackLock lock(_mutex);
+
+	return voice->finished;
+}
+
+void Mixer::setPaused(Voice *voice, bool paused) {
+	Common::StackLock lock(_mutex);
+
+	voice->paused = paused;
+}
+
+void Mixer::setGain(Voice *voice, float gain) {
+	Common::StackLock lock(_mutex);
+
+	voice->gain = gain;
+	updateGain(*voice);
+}
+
+void Mixer::setPitch(Voice *voice, float pitch) {
+	Common::StackLock lock(_mutex);
+
+	voice->pitch = MAX(pitch, 0.01f);
+}
+
+void Mixer::setPosition(Voice *voice, float x, float y, float z) {
+	Common::StackLock lock(_mutex);
+
+	voice->positional = true;
+
+	voice->x = x;
+	voice->y = y;
+	voice->z = z;
+
+	updateGain(*voice);
+}
+
+void Mixer::getPosition(const Voice *voice, float &x, float &y, float &z) const {
+	Common::StackLock lock(_mutex);
+
+	x = voice->x;
+	y = voice->y;
+	z = voice->z;
+}
+
+void Mixer::updateGain(Voice &voice) {
+	float gainL = voice.gain * _listenerGain;
+	float gainR = voice.gain * _listenerGain;
+
+	if (voice.positional) {
+		const float distance = sqrtf(voice.x * voice.x + voice.y * voice.y + voice.z * voice.z);
+
+		// Inverse distance, clamped to the reference distance of 1
+		if (distance > 1.0f) {
+			gainL /= distance;
+			gainR /= distance;
+		}
+
+		// Constant power panning, the listener looks down the negative z axis
+		if (distance > 0.0f) {
+			const float pan = CLIP(voice.x / distance, -1.0f, 1.0f);
+
+			gainL *= sqrtf(1.0f - pan);
+			gainR *= sqrtf(1.0f + pan);
+		}
+	}
+
+	voice.targetL = gainL;
+	voice.targetR = gainR;
+
+	// Nothing is playing yet, so there's nothing to ramp from
+	if (voice.paused && (voice.frameCount == 0)) {
+		voice.gainL = gainL;
+		voice.gainR = gainR;
+	}
+}
+
+void Mixer::decodeVoice(Voice &voice) {
+	uint32 free;
+	{
+		Common::StackLock lock(_mutex);
+
+		if (voice.ended)
+			return;
+
+		free = kRingFrames - voice.ringFill;
+	}
+
+	uint32 write   = voice.ringWrite;
+	uint32 decoded = 0;
+	bool   ended   = false;
+
+	// Read the stream without holding the lock, so that mixing can go on meanwhile
+	while (free > 0) {
+		// Only decode into the contiguous free part of the ring
+		const uint32 count = MIN(MIN(free, kDecodeFrames), kRingFrames - write);
+
+		const int samples = voice.stream->readBuffer(&voice.decode[0], count * voice.channels);
+		const uint32 frames = (samples > 0) ? (samples / voice.channels) : 0;
+
+		if (frames == 0) {
+			// No data at the moment, but there might be more later
+			ended = voice.stream->endOfStream();
+			break;
+		}
+
+		convertFrames(&voice.ring[write * 2], &voice.decode[0], frames, voice.channels);
+
+		write    = (write + frames) % kRingFrames;
+		free    -= frames;
+		decoded += frames;
+	}
+
+	voice.ringWrite = write;
+
+	Common::StackLock lock(_mutex);
+
+	voice.ringFill += decoded;
+	voice.ended     = ended;
+}
+
+uint32 Mixer::decode() {
+	Common::StackLock decodeLock(_decodeMutex);
+
+	{
+		Common::StackLock lock(_mutex);
+
+		_decodeVoices = _voices;
+	}
+
+	for (std::vector<Voice *>::iterator v = _decodeVoices.begin(); v != _decodeVoices.end(); ++v)
+		decodeVoice(**v);
+
+	Common::StackLock lock(_mutex);
+
+	uint32 sleep = 0xFFFFFFFF;
+	for (std::vector<Voice *>::const_iterator v = _voices.begin(); v != _voices.end(); ++v) {
+		const Voice &voice = **v;
+		if (voice.paused || voice.ended)
+			continue;
+
+		const double rate = voice.rate * (double) voice.pitch;
+
+		sleep = MIN<uint32>(sleep, (uint32) ((voice.ringFill * 500.0) / rate));
+	}
+
+	return sleep;
+}
+
+uint32 Mixer::getReadyFrames() const {
+	Common::StackLock lock(_mutex);
+
+	bool   playing = false;
+	uint32 frames  = 0xFFFFFFFF;
+
+	for (std::vector<Voice *>::const_iterator v = _voices.begin(); v != _voices.end(); ++v) {
+		const Voice &voice = **v;
+		if (voice.paused || voice.finished)
+			continue;
+
+		playing = true;
+
+		// An ended voice has all its remaining frames decoded
+		if (voice.ended)
+			continue;
+
+		const double step = (voice.rate * (double) voice.pitch) / _rate;
+
+		frames = MIN<uint32>(frames, (uint32) (voice.ringFill / step));
+	}
+
+	return playing ? frames : 0;
+}
+
+bool Mixer::fillVoice(Voice &voice) {
+	while (true) {
+		const uint32 i = (uint32) voice.position;
+		if ((i + 1) < voice.frameCount)
+			return true;
+
+		if (voice.ringFill == 0) {
+			if (!voice.ended) {
+				// The decoder didn't keep up
+				if (voice.started)
+					_underruns++;
+
+				return false;
+			}
+
+			if (voice.padded) {
+				voice.finished = true;
+				return false;
+			}
+		}
+
+		// Throw away the frames we're already past
+		const uint32 drop = MIN(i, voice.frameCount);
+		const uint32 keep = voice.frameCount - drop;
+
+		if (keep > 0)
+			std::memmove(&voice.frames[0], &voice.frames[drop * 2], keep * 2 * sizeof(float));
+
+		voice.frameCount = keep;
+		voice.position  -= drop;
+
+		if (voice.ringFill == 0) {
+			// Pad with a silent frame, to interpolate the last frame against
+			voice.frames[voice.frameCount * 2 + 0] = 0.0f;
+			voice.frames[voice.frameCount * 2 + 1] = 0.0f;
+			voice.frameCount++;
+
+			voice.padded = true;
+			continue;
+		}
+
+		// Take decoded frames out of the ring, in up to two contiguous parts
+		uint32 count = MIN(voice.ringFill, kDecodeFrames);
+		while (count > 0) {
+			const uint32 part = MIN(count, kRingFrames - voice.ringRead);
+
+			std::memcpy(&voice.frames[voice.frameCount * 2], &voice.ring[voice.ringRead * 2],
+			            part * 2 * sizeof(float));
+
+			voice.frameCount += part;
+			voice.ringRead    = (voice.ringRead + part) % kRingFrames;
+			voice.ringFill   -= part;
+
+			count -= part;
+		}
+
+		voice.started = true;
+	}
+}
+
+void Mixer::mixVoice(Voice &voice, uint32 frames) {
+	const double step = (voice.rate * (double) voice.pitch) / _rate;
+
+	const float deltaL = (voice.targetL - voice.gainL) / frames;
+	const float deltaR = (voice.targetR - voice.gainR) / frames;
+
+	float *dst = &_mixBuffer[0];
+
+	uint32 done = 0;
+	while ((done < frames) && fillVoice(voice)) {
+		// Number of output frames we can interpolate out of the decoded frames
+		const double room = (voice.frameCount - 1) - voice.position;
+
+		const uint32 count = MIN<uint32>((uint32) ceil(room / step), frames - done);
+
+		if ((step == 1.0) && (voice.position == floor(voice.position)))
+			mixCopy(dst, &voice.frames[0], voice.position, count,
+			        voice.gainL, voice.gainR, deltaL, deltaR);
+		else
+			mixLinear(dst, &voice.frames[0], voice.position, step, count,
+			          voice.gainL, voice.gainR, deltaL, deltaR);
+
+		dst  += count * 2;
+		done += count;
+	}
+
+	voice.gainL = voice.targetL;
+	voice.gainR = voice.targetR;
+}
+
+void Mixer::mix(int16 *data, uint32 frames) {
+	Common::StackLock lock(_mutex);
+
+	const uint64 start = SDL_GetPerformanceCounter();
+
+	_mixedFrames += frames;
+
+	while (frames > 0) {
+		const uint32 count = MIN(frames, kBlockFrames);
+
+		std::memset(&_mixBuffer[0], 0, count * 2 * sizeof(float));
+
+		for (std::vector<Voice *>::iterator v = _voices.begin(); v != _voices.end(); ++v)
+			if (!(*v)->paused && !(*v)->finished)
+				mixVoice(**v, count);
+
+		convertMix(data, &_mixBuffer[0], count * 2);
+
+		data   += count * 2;
+		frames -= count;
+	}
+
+	_mixTicks += SDL_GetPerformanceCounter() - start;
+}
+
+} // End of namespace Sound
@@ -0,0 +1,132 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/mixer.h
+ *  A software mixer.
+ */
+
+#ifndef SOUND_MIXER_H
+#define SOUND_MIXER_H
+
+#include <vector>
+
+#include "common/types.h"
+#include "common/mutex.h"
+
+namespace Sound {
+
+class AudioStream;
+
+/** A software mixer, mixing audio streams into one 16-bit stereo stream.
+ *
+ *  Each stream is played by a voice. A voice resamples its stream to the
+ *  mixer's rate, with linear interpolation, and ramps its gain over each
+ *  mixed block, so that gain and position changes don't click.
+ *
+ *  Positional voices are attenuated by the inverse of their distance to
+ *  the listener at the origin, and panned by their direction, like an
+ *  OpenAL source with the default distance model.
+ *
+ *  Streams are only read by decode(), into a ring of decoded frames per
+ *  voice, which the sound thread calls regularily. mix(), called from
+ *  whatever drives the output, only takes frames out of those rings, so
+ *  it never waits on a decoder. All methods are thread-safe.
+ */
+class Mixer {
+public:
+	struct Voice;
+
+	Mixer(uint32 rate);
+	~Mixer();
+
+	/** Return the output sample rate. */
+	uint32 getRate() const;
+
+	/** Return the number of frames mixed so far, the time it took, in seconds, and
+	 *  the number of times a playing voice ran out of decoded frames. */
+	void getStatistics(uint64 &frames, double &time, uint32 &underruns) const;
+
+	/** Set the gain of the listener (= the global master volume). */
+	void setListenerGain(float gain);
+
+	/** Add a paused voice playing this stream. The stream is not taken over. */
+	Voice *addVoice(AudioStream *stream);
+	/** Remove a voice. Afterwards, its stream is not touched anymore. */
+	void removeVoice(Voice *voice);
+
+	/** Has the voice played its whole stream? */
+	bool isFinished(const Voice *voice) const;
+
+	void setPaused(Voice *voice, bool paused);
+
+	void setGain (Voice *voice, float gain);
+	void setPitch(Voice *voice, float pitch);
+
+	void setPosition(Voice *voice, float x, float y, float z);
+	void getPosition(const Voice *voice, float &x, float &y, float &z) const;
+
+	/** Fill the rings of all voices with decoded frames.
+	 *
+	 *  @return The time, in milliseconds, until a playing voice has used
+	 *          up half of its decoded frames.
+	 */
+	uint32 decode();
+
+	/** Return the number of frames that can be mixed before a playing voice runs
+	 *  out of decoded frames, or 0 if no voice is playing. */
+	uint32 getReadyFrames() const;
+
+	/** Mix that many frames of all playing voices into this interleaved stereo buffer. */
+	void mix(int16 *data, uint32 frames);
+
+private:
+	uint32 _rate;
+
+	float _listenerGain;
+
+	std::vector<Voice *> _voices;
+
+	std::vector<float> _mixBuffer; ///< One block of mixed stereo frames.
+
+	std::vector<Voice *> _decodeVoices; ///< The voices decode() is working on.
+
+	uint64 _mixedFrames;
+	uint64 _mixTicks;
+	uint32 _underruns;
+
+	mutable Common::Mutex _mutex;
+
+	/** Held while decoding, so that a voice isn't removed while its stream is read. */
+	Common::Mutex _decodeMutex;
+
+	void updateGain(Voice &voice);
+
+	/** Decode as much of the voice's stream as fits into its ring. */
+	void decodeVoice(Voice &voice);
+
+	/** Make sure the voice has at least two frames around its position. */
+	bool fillVoice(Voice &voice);
+	/** Mix a block of a voice into the mix buffer. */
+	void mixVoice(Voice &voice, uint32 frames);
+};
+
+} // End of namespace Sound
+
+#endif // SOUND_MIXER_H
@@ -0,0 +1,243 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/samplecache.cpp
+ *  A cache of completely decoded short sounds.
+ */
+
+#include <cstring>
+
+#include "common/util.h"
+
+#include "sound/samplecache.h"
+#include "sound/audiostream.h"
+
+/** Number of samples decoded at once while filling the cache. */
+static const int kDecodeSamples = 4096;
+
+namespace Sound {
+
+SampleCacheStatistics::SampleCacheStatistics() : hits(0), misses(0), evictions(0), tooLarge(0),
+	sounds(0), size(0), maxSize(0) {
+}
+
+
+/** A stream playing a cached sound. */
+class SampleCache::BufferStream : public RewindableAudioStream {
+public:
+	BufferStream(const BufferPtr &buffer) : _buffer(buffer), _pos(0) {
+	}
+
+	~BufferStream() {
+	}
+
+	int readBuffer(int16 *buffer, const int numSamples) {
+		const int count = MIN<int>(numSamples, _buffer->samples.size() - _pos);
+		if (count <= 0)
+			return 0;
+
+		std::memcpy(buffer, &_buffer->samples[_pos], count * sizeof(int16));
+		_pos += count;
+
+		return count;
+	}
+
+	int getChannels() const {
+		return _buffer->channels;
+	}
+
+	int getRate() const {
+		return _buffer->rate;
+	}
+
+	bool endOfData() const {
+		return _pos >= _buffer->samples.size();
+	}
+
+	bool rewind() {
+		_pos = 0;
+		return true;
+	}
+
+private:
+	BufferPtr _buffer;
+	uint32 _pos;
+};
+
+
+SampleCache::SampleCache() : _maxSoundSize(0) {
+}
+
+SampleCache::~SampleCache() {
+}
+
+void SampleCache::setMaxSize(uint32 maxSize, uint32 maxSoundSize) {
+	Common::StackLock lock(_mutex);
+
+	_statistics.maxSize = maxSize;
+	_maxSoundSize       = MIN(maxSize, maxSoundSize);
+
+	_tooLarge.clear();
+
+	while (!_entries.empty() && (_statistics.size > _statistics.maxSize)) {
+		remove(--_entries.end());
+		_statistics.evictions++;
+	}
+}
+
+bool SampleCache::isEnabled() const {
+	Common::StackLock lock(_mutex);
+
+	return _maxSoundSize > 0;
+}
+
+void SampleCache::clear() {
+	Common::StackLock lock(_mutex);
+
+	while (!_entries.empty())
+		remove(_entries.begin());
+
+	_tooLarge.clear();
+}
+
+RewindableAudioStream *SampleCache::get(const Common::UString &name) {
+	Common::StackLock lock(_mutex);
+
+	EntryMap::iterator entry = _entryMap.find(name);
+	if (entry == _entryMap.end()) {
+		_statistics.misses++;
+		return 0;
+	}
+
+	// Move the sound to the front of the LRU list
+	_entries.splice(_entries.begin(), _entries, entry->second);
+
+	_statistics.hits++;
+
+	return new BufferStream(entry->second->buffer);
+}
+
+RewindableAudioStream *SampleCache::add(const Common::UString &name, RewindableAudioStream &stream) {
+	uint32 maxSamples;
+	{
+		Common::StackLock lock(_mutex);
+
+		// Don't bother decoding a sound we already know is too large
+		if (_tooLarge.find(name) != _tooLarge.end())
+			return 0;
+
+		maxSamples = _maxSoundSize / sizeof(int16);
+
+		// Or one whose length already tells us that it's too large
+		const SeekableAudioStream *seekable = dynamic_cast<const SeekableAudioStream *>(&stream);
+		if (seekable && ((seekable->getLength() * MAX(stream.getChannels(), 1)) > maxSamples)) {
+			_statistics.tooLarge++;
+			_tooLarge.insert(name);
+
+			return 0;
+		}
+	}
+
+	Buffer *buffer = new Buffer;
+
+	buffer->rate     = stream.getRate();
+	buffer->channels = stream.getChannels();
+
+	// Decode the whole sound, without holding the lock
+	bool tooLarge = false;
+	while (!stream.endOfStream()) {
+		const uint32 pos = buffer->samples.size();
+		if (pos >= maxSamples) {
+			tooLarge = true;
+			break;
+		}
+
+		buffer->samples.resize(pos + kDecodeSamples);
+
+		const int count = stream.readBuffer(&buffer->samples[pos], kDecodeSamples);
+
+		buffer->samples.resize(pos + MAX(count, 0));
+		if (count < kDecodeSamples)
+			break;
+	}
+
+	if (buffer->samples.size() > maxSamples)
+		tooLarge = true;
+
+	if (tooLarge || buffer->samples.empty()) {
+		delete buffer;
+
+		Common::StackLock lock(_mutex);
+
+		if (tooLarge) {
+			_statistics.tooLarge++;
+			_tooLarge.insert(name);
+		}
+
+		stream.rewind();
+		return 0;
+	}
+
+	// Give back the memory we reserved while decoding
+	std::vector<int16>(buffer->samples).swap(buffer->samples);
+
+	const BufferPtr bufferPtr(buffer);
+	const uint32 size = buffer->samples.size() * sizeof(int16);
+
+	Common::StackLock lock(_mutex);
+
+	// Another thread might have cached the same sound in the meantime
+	EntryMap::iterator old = _entryMap.find(name);
+	if (old != _entryMap.end())
+		remove(old->second);
+
+	// Make room for the new sound
+	while (!_entries.empty() && ((_statistics.size + size) > _statistics.maxSize)) {
+		remove(--_entries.end());
+		_statistics.evictions++;
+	}
+
+	_entries.push_front(Entry());
+	_entries.front().name   = name;
+	_entries.front().buffer = bufferPtr;
+
+	_entryMap.insert(std::make_pair(name, _entries.begin()));
+
+	_statistics.sounds++;
+	_statistics.size += size;
+
+	return new BufferStream(bufferPtr);
+}
+
+SampleCacheStatistics SampleCache::getStatistics() const {
+	Common::StackLock lock(_mutex);
+
+	return _statistics;
+}
+
+void SampleCache::remove(EntryList::iterator entry) {
+	_statistics.sounds--;
+	_statistics.size -= entry->buffer->samples.size() * sizeof(int16);
+
+	_entryMap.erase(entry->name);
+	_entries.erase(entry);
+}
+
+} // End of namespace Sound
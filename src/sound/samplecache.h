@@ -0,0 +1,135 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/samplecache.h
+ *  A cache of completely decoded short sounds.
+ */
+
+#ifndef SOUND_SAMPLECACHE_H
+#define SOUND_SAMPLECACHE_H
+
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+
+#include <boost/shared_ptr.hpp>
+
+#include "common/types.h"
+#include "common/ustring.h"
+#include "common/mutex.h"
+
+namespace Sound {
+
+class RewindableAudioStream;
+
+/** Statistics about the decoded sample cache. */
+struct SampleCacheStatistics {
+	uint32 hits;      ///< Number of sounds played out of the cache.
+	uint32 misses;    ///< Number of sounds looked for, but not found in the cache.
+	uint32 evictions; ///< Number of sounds thrown out of the cache to make room.
+	uint32 tooLarge;  ///< Number of sounds too large to be cached.
+
+	uint32 sounds;  ///< Number of sounds currently in the cache.
+	uint32 size;    ///< Size of all sounds currently in the cache, in bytes.
+	uint32 maxSize; ///< Maximum size of all sounds in the cache, in bytes.
+
+	SampleCacheStatistics();
+};
+
+/** A cache of completely decoded short sounds.
+ *
+ *  Each sound is decoded only once into an immutable buffer of 16-bit
+ *  samples, which any number of channels can play at the same time.
+ *  When the cache is full, the least recently played sounds are evicted.
+ *  A sound still being played keeps its buffer alive until it's done.
+ */
+class SampleCache {
+public:
+	SampleCache();
+	~SampleCache();
+
+	/** Set the maximum size of the whole cache and of a single sound, in bytes.
+	 *
+	 *  A maximum size of 0 disables the cache.
+	 */
+	void setMaxSize(uint32 maxSize, uint32 maxSoundSize);
+
+	/** Is the cache enabled? */
+	bool isEnabled() const;
+
+	/** Remove all sounds from the cache. */
+	void clear();
+
+	/** Return a new stream playing this sound out of the cache, or 0 if it isn't cached. */
+	RewindableAudioStream *get(const Common::UString &name);
+
+	/** Decode a sound into the cache.
+	 *
+	 *  The stream is not taken over. If the sound is too large for the
+	 *  cache, the stream is rewound and 0 is returned.
+	 *
+	 *  @param  name The name to cache the sound under.
+	 *  @param  stream The sound to decode.
+	 *  @return A new stream playing the sound out of the cache, or 0.
+	 */
+	RewindableAudioStream *add(const Common::UString &name, RewindableAudioStream &stream);
+
+	SampleCacheStatistics getStatistics() const;
+
+private:
+	/** A completely decoded sound. */
+	struct Buffer {
+		int rate;
+		int channels;
+
+		std::vector<int16> samples;
+	};
+
+	typedef boost::shared_ptr<const Buffer> BufferPtr;
+
+	class BufferStream;
+
+	/** A sound in the cache. */
+	struct Entry {
+		Common::UString name;
+		BufferPtr buffer;
+	};
+
+	typedef std::list<Entry> EntryList;
+	typedef std::map<Common::UString, EntryList::iterator> EntryMap;
+
+	uint32 _maxSoundSize;
+
+	EntryList _entries;  ///< All cached sounds, most recently played first.
+	EntryMap  _entryMap;
+
+	std::set<Common::UString> _tooLarge; ///< Sounds we found to be too large to cache.
+
+	SampleCacheStatistics _statistics;
+
+	mutable Common::Mutex _mutex;
+
+	void remove(EntryList::iterator entry);
+};
+
+} // End of namespace Sound
+
+#endif // SOUND_SAMPLECACHE_H
@@ -22,7 +22,13 @@
  *  The global sound manager, handling all sound output.
  */
 
+#include <cstring>
+
+#include <SDL_audio.h>
+#include <SDL_timer.h>
+
 #include "sound/sound.h"
+#include "sound/mixer.h"
 #include "sound/audiostream.h"
 #include "sound/decoders/asf.h"
 #include "sound/decoders/mp3.h"
@@ -32,28 +38,116 @@
 #include "common/stream.h"
 #include "common/util.h"
 #include "common/error.h"
+#include "common/ustring.h"
+#include "common/file.h"
 #include "common/configman.h"
 
 #include "events/events.h"
 
 DECLARE_SINGLETON(Sound::SoundManager)
 
-/** Control how many buffers per sound OpenAL will create.
+/** Default length of audio, in milliseconds, per OpenAL buffer.
  *
- *  @note clone2727 says: 5 is just a safe number. Mine only reached a max of 2.
+ *  @note Needs to be high enough to prevent stuttering, but low enough to
+ *        prevent a noticable lag. Each buffer is sized for this length at
+ *        the stream's own sample rate and channel count.
  */
-static const int kOpenALBufferCount = 5;
+static const int kOpenALBufferTime = 150;
 
-/** Number of bytes per OpenAL buffer.
+/** Default number of OpenAL buffers per sound.
  *
- *  @note Needs to be high enough to prevent stuttering, but low enough to
- *        prevent a noticable lag. 32768 seems to work just fine.
+ *  The sound thread wakes up once the oldest buffer of a channel has been
+ *  played, so the remaining buffers need to last longer than it takes to
+ *  wake up and refill it.
  */
-static const int kOpenALBufferSize = 32768;
+static const int kOpenALBufferCount = 4;
+
+/** Default number of threads decoding sound channels in parallel. */
+static const int kDecodeThreads = 2;
+
+/** Shortest time, in milliseconds, the sound thread sleeps between updates. */
+static const uint32 kMinSleep = 5;
+/** Longest time, in milliseconds, the sound thread sleeps between updates.
+ *
+ *  Playing channels wake the thread up as their buffers run out, and new
+ *  data or channels trigger an update. This is just a safety net.
+ */
+static const uint32 kMaxSleep = 500;
+/** Longest time, in milliseconds, between mixing in real time for outputs without an audio device. */
+static const uint32 kPumpSleep = 100;
+
+/** Default maximum size of the decoded sample cache, in KB. */
+static const int kSampleCacheSize = 8192;
+/** Default maximum size of a single sound in the decoded sample cache, in KB. */
+static const int kSampleCacheSoundSize = 512;
+
+/** Default length of music, in milliseconds, to decode ahead on its own thread. */
+static const int kReadAheadTime = 2000;
+
+/** Output rate of the software mixer. */
+static const uint32 kMixerRate = 44100;
+
+/** Number of frames the SDL audio device asks the software mixer for at once. */
+static const uint32 kMixerDeviceFrames = 1024;
+
+/** Number of frames the software mixer mixes at once for the null and WAVE file outputs. */
+static const uint32 kMixerPumpFrames = 4096;
 
 namespace Sound {
 
-SoundManager::SoundManager() : _ready(false), _hasSound(false), _hasMultiChannel(false), _format51(0) {
+SoundStatistics::SoundStatistics() : bufferTime(0), bufferCount(0), refills(0), underruns(0),
+	decodeThreads(0), wakeups(0), signalled(0), sleepTotal(0), lateTotal(0), lateMax(0),
+	updateTime(0.0), decodeTime(0.0), mixer(false), mixRate(0), mixedFrames(0), mixTime(0.0) {
+}
+
+
+/** A thread decoding sound channels. */
+class SoundManager::DecodeWorker : public Common::Thread {
+public:
+	DecodeWorker(SoundManager &manager) : _manager(&manager) {
+	}
+
+	~DecodeWorker() {
+		destroyThread();
+	}
+
+private:
+	SoundManager *_manager;
+
+	void threadMethod() {
+		while (!_killThread) {
+			Channel *channel;
+			if (_manager->takeDecodeJob(channel, true))
+				_manager->finishDecodeJob(*channel);
+		}
+	}
+};
+
+
+/** Write the header of a 16-bit stereo PCM WAVE file. */
+static void writeWAVHeader(Common::DumpFile &file, uint32 rate, uint32 dataSize) {
+	file.writeUint32BE(MKTAG('R', 'I', 'F', 'F'));
+	file.writeUint32LE(36 + dataSize);
+	file.writeUint32BE(MKTAG('W', 'A', 'V', 'E'));
+
+	file.writeUint32BE(MKTAG('f', 'm', 't', ' '));
+	file.writeUint32LE(16);
+	file.writeUint16LE(1);
+	file.writeUint16LE(2);
+	file.writeUint32LE(rate);
+	file.writeUint32LE(rate * 4);
+	file.writeUint16LE(4);
+	file.writeUint16LE(16);
+
+	file.writeUint32BE(MKTAG('d', 'a', 't', 'a'));
+	file.writeUint32LE(dataSize);
+}
+
+
+SoundManager::SoundManager() : _ready(false), _hasSound(false), _hasMultiChannel(false), _format51(0),
+	_readAheadTime(0), _decodeJobCount(0), _decodeDone(0), _updatePending(false), _needUpdate(_mutex),
+	_mixer(0), _audioDevice(0), _wavFile(0), _wavSize(0),
+	_pumpRealtime(true), _pumpStart(0), _pumpFrames(0) {
 }
 
 void SoundManager::init() {
@@ -63,13 +157,42 @@ void SoundManager::init() {
 	for (int i = 0; i < kSoundTypeMAX; i++)
 		_types[i].gain = 1.0;
 
-	_curChannel = 1;
-	_curID      = 1;
+	_activeChannels.clear();
+	_activeChannels.reserve(256);
+
+	// Channel 0 is reserved for "invalid channel". Lower channels are handed out first
+	_freeChannels.clear();
+	_freeChannels.reserve(kChannelCount - 1);
+	for (int i = kChannelCount - 1; i > 0; i--)
+		_freeChannels.push_back(i);
 
-	_dev = alcOpenDevice(0);
+	_curID = 1;
+
+	// Trading latency for CPU time
+	_statistics = SoundStatistics();
+
+	_statistics.bufferTime  = CLIP(ConfigMan.getInt("soundbuffertime" , kOpenALBufferTime) , 20, 1000);
+	_statistics.bufferCount = CLIP(ConfigMan.getInt("soundbuffercount", kOpenALBufferCount),  2,   16);
+
+	// Trading memory for decoding the same short sounds over and over
+	const int cacheSize      = MAX(ConfigMan.getInt("soundcachesize"     , kSampleCacheSize)     , 0);
+	const int cacheSoundSize = MAX(ConfigMan.getInt("soundcachesoundsize", kSampleCacheSoundSize), 0);
+
+	_sampleCache.clear();
+	_sampleCache.setMaxSize(cacheSize * 1024, cacheSoundSize * 1024);
+
+	// Trading memory for music not stalling on a slow decoder. 0 decodes music like all other sounds
+	_readAheadTime = CLIP(ConfigMan.getInt("soundreadahead", kReadAheadTime), 0, 60000);
+
+	// Optionally, mix in software and play on SDL audio, or play into nothing or a WAVE file
+	const Common::UString output = ConfigMan.getString("soundoutput", "openal");
+	if ((output != "openal") && !initMixer(output))
+		warning("Failed to open the \"%s\" sound output. Falling back to OpenAL", output.c_str());
+
+	_dev = _mixer ? 0 : alcOpenDevice(0);
 
 	_hasSound = _dev != 0;
-	if (!_hasSound)
+	if (!_hasSound && !_mixer)
 		warning("Failed to open OpenAL device. Disabling sound output");
 
 	_ctx = 0;
@@ -87,12 +210,28 @@ void SoundManager::init() {
 		_format51        = alGetEnumValue("AL_FORMAT_51CHN16");
 	}
 
+	// Decoding several channels at once
+	const int threadCount = CLIP(ConfigMan.getInt("sounddecodethreads", kDecodeThreads), 0, 16);
+	for (int i = 0; (i < threadCount) && _hasSound; i++) {
+		DecodeWorker *worker = new DecodeWorker(*this);
+		if (!worker->createThread()) {
+			warning("Failed to create a sound decoding thread");
+
+			delete worker;
+			break;
+		}
+
+		_decodeWorkers.push_back(worker);
+	}
+
+	_statistics.decodeThreads = _decodeWorkers.size();
+
 	if (!createThread())
 		throw Common::Exception("Failed to create sound thread: %s", SDL_GetError());
 
 	_ready = true;
 
-	if (!_hasSound)
+	if (!_hasSound && !_mixer)
 		return;
 
 	setListenerGain(ConfigMan.getDouble("volume", 1.0));
@@ -110,8 +249,20 @@ void SoundManager::deinit() {
 	if (!destroyThread())
 		warning("SoundManager::deinit(): Sound thread had to be killed");
 
-	for (uint16 i = 1; i < kChannelCount; i++)
-		freeChannel(i);
+	for (std::list<DecodeWorker *>::iterator w = _decodeWorkers.begin(); w != _decodeWorkers.end(); ++w)
+		delete *w;
+
+	_decodeWorkers.clear();
+
+	while (!_activeChannels.empty())
+		freeChannel(_activeChannels.back());
+
+	deleteFinishedStreams();
+
+	deinitMixer();
+
+	_sampleCache.clear();
+	_mp3SeekIndices.clear();
 
 	if (_hasSound) {
 		alcMakeContextCurrent(0);
@@ -129,6 +280,9 @@ bool SoundManager::ready() const {
 void SoundManager::triggerUpdate() {
 	checkReady();
 
+	Common::StackLock lock(_mutex);
+
+	_updatePending = true;
 	_needUpdate.signal();
 }
 
@@ -154,10 +308,179 @@ bool SoundManager::isPlaying(const ChannelHandle &handle) {
 	return isPlaying(handle.channel);
 }
 
+uint32 SoundManager::getActiveChannelCount() {
+	Common::StackLock lock(_mutex);
+
+	return _activeChannels.size();
+}
+
+SoundStatistics SoundManager::getStatistics() {
+	Common::StackLock lock(_mutex);
+
+	SoundStatistics statistics = _statistics;
+
+	if (_mixer) {
+		statistics.mixer   = true;
+		statistics.mixRate = _mixer->getRate();
+
+		_mixer->getStatistics(statistics.mixedFrames, statistics.mixTime, statistics.underruns);
+	}
+
+	return statistics;
+}
+
+SampleCacheStatistics SoundManager::getSampleCacheStatistics() const {
+	return _sampleCache.getStatistics();
+}
+
+void SoundManager::clearSampleCache() {
+	_sampleCache.clear();
+	_mp3SeekIndices.clear();
+}
+
+bool SoundManager::initMixer(const Common::UString &output) {
+	if ((output != "mixer") && (output != "null") && (output != "wav")) {
+		warning("Unknown sound output \"%s\"", output.c_str());
+		return false;
+	}
+
+	_mixer = new Mixer(kMixerRate);
+
+	if (output == "mixer") {
+		if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+			warning("Failed to initialize SDL audio: %s", SDL_GetError());
+			deinitMixer();
+			return false;
+		}
+
+		SDL_AudioSpec spec;
+		std::memset(&spec, 0, sizeof(spec));
+
+		spec.freq     = kMixerRate;
+		spec.format   = AUDIO_S16SYS;
+		spec.channels = 2;
+		spec.samples  = kMixerDeviceFrames;
+		spec.callback = &mixerCallback;
+		spec.userdata = this;
+
+		// SDL converts our output to whatever the device wants
+		_audioDevice = SDL_OpenAudioDevice(0, 0, &spec, 0, 0);
+		if (_audioDevice == 0) {
+			warning("Failed to open SDL audio device: %s", SDL_GetError());
+			SDL_QuitSubSystem(SDL_INIT_AUDIO);
+			deinitMixer();
+			return false;
+		}
+
+		SDL_PauseAudioDevice(_audioDevice, 0);
+		return true;
+	}
+
+	if (output == "wav") {
+		const Common::UString fileName = ConfigMan.getString("soundwavfile", "xoreos.wav");
+
+		_wavFile = new Common::DumpFile;
+		if (!_wavFile->open(fileName)) {
+			warning("Failed to open \"%s\" for writing", fileName.c_str());
+			deinitMixer();
+			return false;
+		}
+
+		// The sizes are filled in once we're done
+		writeWAVHeader(*_wavFile, kMixerRate, 0);
+		_wavSize = 0;
+	}
+
+	/* Without an audio device, the sound thread mixes, in real time by default.
+	 * Otherwise, it mixes as fast as the voices are decoded, which measures the
+	 * throughput of decoding and mixing. */
+	_pumpRealtime = ConfigMan.getBool("soundrealtime", true);
+
+	_pumpStart  = SDL_GetTicks();
+	_pumpFrames = 0;
+
+	_pumpBuffer.resize(kMixerPumpFrames * 2);
+
+	return true;
+}
+
+void SoundManager::deinitMixer() {
+	if (_audioDevice) {
+		SDL_CloseAudioDevice(_audioDevice);
+		SDL_QuitSubSystem(SDL_INIT_AUDIO);
+
+		_audioDevice = 0;
+	}
+
+	if (_wavFile) {
+		if (_wavFile->isOpen()) {
+			if (!_wavFile->seek(0))
+				warning("Failed to finalize the sound output WAVE file");
+			else
+				writeWAVHeader(*_wavFile, kMixerRate, _wavSize);
+		}
+
+		delete _wavFile;
+		_wavFile = 0;
+	}
+
+	delete _mixer;
+	_mixer = 0;
+
+	_pumpBuffer.clear();
+}
+
+uint32 SoundManager::pumpMixer() {
+	if (!_mixer || _audioDevice)
+		return kMaxSleep;
+
+	if (!_pumpRealtime) {
+		const uint32 count = MIN(_mixer->getReadyFrames(), kMixerPumpFrames);
+		if (count == 0)
+			// Nothing playing, or waiting for a voice to be decoded
+			return kMaxSleep;
+
+		pumpMixer(count);
+		return 0;
+	}
+
+	const uint64 frames = (((uint64) (SDL_GetTicks() - _pumpStart)) * _mixer->getRate()) / 1000;
+
+	while (_pumpFrames < frames) {
+		const uint32 count = MIN<uint64>(frames - _pumpFrames, kMixerPumpFrames);
+
+		pumpMixer(count);
+	}
+
+	return kPumpSleep;
+}
+
+void SoundManager::pumpMixer(uint32 count) {
+	_mixer->mix(&_pumpBuffer[0], count);
+
+	if (_wavFile) {
+		for (uint32 i = 0; i < (count * 2); i++)
+			_wavFile->writeUint16LE((uint16) _pumpBuffer[i]);
+
+		_wavSize += count * 4;
+	}
+
+	_pumpFrames += count;
+}
+
+void SoundManager::mixerCallback(void *userdata, uint8 *stream, int len) {
+	SoundManager *sound = (SoundManager *) userdata;
+
+	sound->_mixer->mix((int16 *) stream, len / 4);
+}
+
 bool SoundManager::isPlaying(uint16 channel) const {
 	if ((channel == 0) || !_channels[channel])
 		return false;
 
+	if (_mixer)
+		return _channels[channel]->voice && !_mixer->isFinished(_channels[channel]->voice);
+
 	// TODO: This might pose a problem should we ever need to wait
 	//       for sounds to finish (for syncing, ...). We need to
 	//       add a way for audio streams to tell us how long they are
@@ -187,7 +510,8 @@ bool SoundManager::isPlaying(uint16 channel) const {
 	return true;
 }
 
-AudioStream *SoundManager::makeAudioStream(Common::SeekableReadStream *stream) {
+RewindableAudioStream *SoundManager::makeAudioStream(Common::SeekableReadStream *stream,
+                                                     const Common::UString &name) {
 	bool isMP3 = false;
 	uint32 tag = stream->readUint32BE();
 
@@ -260,12 +584,17 @@ AudioStream *SoundManager::makeAudioStream(Common::SeekableReadStream *stream) {
 		throw Common::Exception("Unknown sound format");
 
 	if (isMP3)
-		return makeMP3Stream(stream, true);
+		return makeMP3Stream(stream, true, &_mp3SeekIndices, name);
 
 	return makeWAVStream(stream, true);
 }
 
 ChannelHandle SoundManager::playAudioStream(AudioStream *audStream, SoundType type, bool disposeAfterUse) {
+	return playStream(audStream, type, disposeAfterUse, false);
+}
+
+ChannelHandle SoundManager::playStream(AudioStream *audStream, SoundType type,
+                                       bool disposeAfterUse, bool disposeOnThread) {
 	assert((type >= 0) && (type < kSoundTypeMAX));
 
 	checkReady();
@@ -277,17 +606,17 @@ ChannelHandle SoundManager::playAudioStream(AudioStream *audStream, SoundType ty
 
 	ChannelHandle handle = newChannel();
 
-	_channels[handle.channel] = new Channel;
 	Channel &channel = *_channels[handle.channel];
 
-	channel.id              = handle.id;
 	channel.state           = AL_PAUSED;
 	channel.stream          = audStream;
 	channel.source          = 0;
 	channel.disposeAfterUse = disposeAfterUse;
+	channel.disposeOnThread = disposeOnThread;
 	channel.type            = type;
 	channel.typeIt          = _types[channel.type].list.end();
 	channel.gain            = 1.0;
+	channel.voice           = 0;
 
 	try {
 
@@ -297,35 +626,51 @@ ChannelHandle SoundManager::playAudioStream(AudioStream *audStream, SoundType ty
 		ALenum error = AL_NO_ERROR;
 
 		if (_hasSound) {
+			const uint32 channels = MAX(channel.stream->getChannels(), 1);
+
+			channel.format       = getFormat(channel.stream->getChannels());
+			channel.rate         = channel.stream->getRate();
+			channel.channelCount = channels;
+
+			// Size the staging buffers for the stream's sample rate
+			const uint32 frames = MAX<uint32>((channel.rate * _statistics.bufferTime) / 1000, 256);
+
+			channel.bufferSamples  = frames * channels;
+			channel.decodedBuffers = 0;
+			channel.decodeTicks    = 0;
+
+			channel.staging.resize(channel.bufferSamples * _statistics.bufferCount);
+			channel.decodedSamples.resize(_statistics.bufferCount);
+
 			// Create the source
 			alGenSources(1, &channel.source);
 			if ((error = alGetError()) != AL_NO_ERROR)
 				throw Common::Exception("OpenAL error while generating sources: %X", error);
 
 			// Create all needed buffers
-			for (int i = 0; i < kOpenALBufferCount; i++) {
+			for (uint32 i = 0; i < _statistics.bufferCount; i++) {
 				ALuint buffer;
 
 				alGenBuffers(1, &buffer);
 				if ((error = alGetError()) != AL_NO_ERROR)
 					throw Common::Exception("OpenAL error while generating buffers: %X", error);
 
-				if (fillBuffer(channel.source, buffer, channel.stream)) {
-					// If we could fill the buffer with data, queue it
-
-					alSourceQueueBuffers(channel.source, 1, &buffer);
-					if ((error = alGetError()) != AL_NO_ERROR)
-						throw Common::Exception("OpenAL error while queueing buffers: %X", error);
-
-				} else
-					// If not, put it into our free list
-					channel.freeBuffers.push_back(buffer);
-
 				channel.buffers.push_back(buffer);
+				channel.freeBuffers.push_back(buffer);
 			}
 
+			// And fill as many as we can
+			decodeBuffers(channel);
+			queueBuffers(channel);
+
 			// Set the gain to the current sound type gain
 			alSourcef(channel.source, AL_GAIN, _types[channel.type].gain);
+
+		} else if (_mixer) {
+			// From now on, only the mixer touches the stream
+			channel.voice = _mixer->addVoice(channel.stream);
+
+			_mixer->setGain(channel.voice, _types[channel.type].gain);
 		}
 
 		// Add the channel to the correct type list
@@ -346,17 +691,78 @@ ChannelHandle SoundManager::playSoundFile(Common::SeekableReadStream *wavStream,
 	if (!wavStream)
 		throw Common::Exception("No stream");
 
-	AudioStream *audioStream = makeAudioStream(wavStream);
+	return playSound(makeAudioStream(wavStream), type, loop, true);
+}
+
+ChannelHandle SoundManager::playSoundFile(const Common::UString &name, Common::SeekableReadStream *wavStream,
+                                          SoundType type, bool loop) {
+	checkReady();
+
+	if (!wavStream)
+		throw Common::Exception("No stream");
+
+	RewindableAudioStream *audioStream = makeAudioStream(wavStream, name);
+	bool readAhead = true;
+
+	// Music is long, there's no point in trying to decode it completely
+	if (_sampleCache.isEnabled() && (type != kSoundTypeMusic)) {
+		RewindableAudioStream *cachedStream = 0;
+
+		try {
+			cachedStream = _sampleCache.add(name, *audioStream);
+		} catch (...) {
+			delete audioStream;
+			throw;
+		}
 
-	if (loop) {
-		RewindableAudioStream *reAudStream = dynamic_cast<RewindableAudioStream *>(audioStream);
-		if (!reAudStream)
-			warning("SoundManager::playSoundFile(): The input stream cannot be rewound, this will not loop.");
-		else
-			audioStream = makeLoopingAudioStream(reAudStream, 0);
+		// Play the decoded sound; the original stream was only needed for decoding
+		if (cachedStream) {
+			delete audioStream;
+			audioStream = cachedStream;
+			readAhead   = false;
+		}
 	}
 
-	return playAudioStream(audioStream, type);
+	return playSound(audioStream, type, loop, readAhead);
+}
+
+ChannelHandle SoundManager::playCachedSound(const Common::UString &name, SoundType type, bool loop) {
+	checkReady();
+
+	// Music is never cached
+	if (!_sampleCache.isEnabled() || (type == kSoundTypeMusic))
+		return ChannelHandle();
+
+	RewindableAudioStream *audioStream = _sampleCache.get(name);
+	if (!audioStream)
+		return ChannelHandle();
+
+	return playSound(audioStream, type, loop, false);
+}
+
+ChannelHandle SoundManager::playSound(RewindableAudioStream *stream, SoundType type, bool loop, bool readAhead) {
+	AudioStream *audioStream = stream;
+
+	if (loop)
+		audioStream = makeLoopingAudioStream(stream, 0);
+
+	/* Music plays for long, and is started during area transitions and crossfades.
+	 * Decoding it ahead, loop points included, means that neither starting it nor
+	 * the sound thread ever waits for its decoder. */
+	bool readingAhead = false;
+	if (audioStream && readAhead && (type == kSoundTypeMusic) && (_readAheadTime > 0)) {
+		const uint64 frames  = ((uint64) audioStream->getRate() * _readAheadTime) / 1000;
+		const uint32 samples = frames * MAX(audioStream->getChannels(), 1);
+
+		AudioStream *readAheadStream = makeReadAheadAudioStream(audioStream, samples);
+
+		readingAhead = readAheadStream != audioStream;
+		audioStream  = readAheadStream;
+	}
+
+	/* Deleting a read-ahead stream waits for its thread to stop, which
+	 * we don't want to do while holding the lock. */
+	return playStream(audioStream, type, true, readingAhead);
 }
 
 SoundManager::Channel *SoundManager::getChannel(const ChannelHandle &handle) {
@@ -381,6 +787,9 @@ void SoundManager::startChannel(ChannelHandle &handle) {
 
 	channel->state = AL_PLAYING;
 
+	if (_mixer)
+		_mixer->setPaused(channel->voice, false);
+
 	triggerUpdate();
 }
 
@@ -403,15 +812,15 @@ void SoundManager::stopChannel(ChannelHandle &handle) {
 void SoundManager::pauseAll(bool pause) {
 	Common::StackLock lock(_mutex);
 
-	for (uint16 i = 1; i < kChannelCount; i++)
-		pauseChannel(_channels[i], pause);
+	for (std::vector<uint16>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c)
+		pauseChannel(_channels[*c], pause);
 }
 
 void SoundManager::stopAll() {
 	Common::StackLock lock(_mutex);
 
-	for (uint16 i = 1; i < kChannelCount; i++)
-		freeChannel(i);
+	while (!_activeChannels.empty())
+		freeChannel(_activeChannels.back());
 }
 
 void SoundManager::setListenerGain(float gain) {
@@ -421,6 +830,8 @@ void SoundManager::setListenerGain(float gain) {
 
 	if (_hasSound)
 		alListenerf(AL_GAIN, gain);
+	else if (_mixer)
+		_mixer->setListenerGain(gain);
 }
 
 void SoundManager::setChannelPosition(const ChannelHandle &handle, float x, float y, float z) {
@@ -435,6 +846,8 @@ void SoundManager::setChannelPosition(const ChannelHandle &handle, float x, floa
 
 	if (_hasSound)
 		alSource3f(channel->source, AL_POSITION, x, y, z);
+	else if (_mixer)
+		_mixer->setPosition(channel->voice, x, y, z);
 }
 
 void SoundManager::getChannelPosition(const ChannelHandle &handle, float &x, float &y, float &z) {
@@ -449,6 +862,8 @@ void SoundManager::getChannelPosition(const ChannelHandle &handle, float &x, flo
 
 	if (_hasSound)
 		alGetSource3f(channel->source, AL_POSITION, &x, &y, &z);
+	else if (_mixer)
+		_mixer->getPosition(channel->voice, x, y, z);
 }
 
 void SoundManager::setChannelGain(const ChannelHandle &handle, float gain) {
@@ -462,6 +877,8 @@ void SoundManager::setChannelGain(const ChannelHandle &handle, float gain) {
 
 	if (_hasSound)
 		alSourcef(channel->source, AL_GAIN, _types[channel->type].gain * gain);
+	else if (_mixer)
+		_mixer->setGain(channel->voice, _types[channel->type].gain * gain);
 }
 
 void SoundManager::setChannelPitch(const ChannelHandle &handle, float pitch) {
@@ -473,6 +890,8 @@ void SoundManager::setChannelPitch(const ChannelHandle &handle, float pitch) {
 
 	if (_hasSound)
 		alSourcef(channel->source, AL_PITCH, pitch);
+	else if (_mixer)
+		_mixer->setPitch(channel->voice, pitch);
 }
 
 void SoundManager::setTypeGain(SoundType type, float gain) {
@@ -489,146 +908,255 @@ void SoundManager::setTypeGain(SoundType type, float gain) {
 
 		if (_hasSound)
 			alSourcef((*t)->source, AL_GAIN, (*t)->gain * gain);
+		else if (_mixer)
+			_mixer->setGain((*t)->voice, (*t)->gain * gain);
 	}
 }
 
-bool SoundManager::fillBuffer(ALuint source, ALuint alBuffer, AudioStream *stream) const {
-	if (!stream)
-		throw Common::Exception("No stream");
-
-	if (!_hasSound)
-		return true;
-
-	if (stream->endOfData())
-		return false;
+ALenum SoundManager::getFormat(int channelCount) const {
+	if (channelCount == 1)
+		return AL_FORMAT_MONO16;
+	if (channelCount == 2)
+		return AL_FORMAT_STEREO16;
 
-	ALenum format;
-
-	const int channelCount = stream->getChannels();
-	if        (channelCount == 1) {
-		format = AL_FORMAT_MONO16;
-	} else if (channelCount == 2) {
-		format = AL_FORMAT_STEREO16;
-	} else if (channelCount == 6) {
+	if (channelCount == 6) {
 		if (!_hasMultiChannel) {
-			warning("SoundManager::fillBuffer(): TODO: !_hasMultiChannel");
-			return false;
+			warning("SoundManager::getFormat(): TODO: !_hasMultiChannel");
+			return AL_NONE;
 		}
 
-		format = _format51;
+		return _format51;
+	}
+
+	warning("SoundManager::getFormat(): Unsupported channel count %d", channelCount);
+	return AL_NONE;
+}
 
-	} else {
-		warning("SoundManager::fillBuffer(): Unsupported channel count %d", channelCount);
+bool SoundManager::unqueueBuffers(Channel &channel) {
+	if (!_hasSound || !channel.stream)
 		return false;
-	}
 
-	// Read in the required amount of samples
-	uint32 numSamples = kOpenALBufferSize / 2;
+	// Get the number of buffers that have been processed
+	ALint buffersQueued, buffersProcessed;
+	alGetSourcei(channel.source, AL_BUFFERS_QUEUED   , &buffersQueued);
+	alGetSourcei(channel.source, AL_BUFFERS_PROCESSED, &buffersProcessed);
 
-	byte *buffer = new byte[kOpenALBufferSize];
-	memset(buffer, 0, kOpenALBufferSize);
-	numSamples = stream->readBuffer((int16 *)buffer, numSamples);
+	const bool endOfData = channel.stream->endOfData();
 
-	uint32 bufferSize = numSamples * 2;
+	// A playing channel played everything we gave it, before we could give it more
+	if (!endOfData && (channel.state == AL_PLAYING) && (buffersQueued > 0) && (buffersProcessed == buffersQueued))
+		_statistics.underruns++;
 
-	alBufferData(alBuffer, format, buffer, bufferSize, stream->getRate());
+	// Pull all processed buffers from the queue and put them into our free list
+	while (buffersProcessed--) {
+		ALuint alBuffer;
 
-	delete[] buffer;
+		alSourceUnqueueBuffers(channel.source, 1, &alBuffer);
 
-	ALenum error = alGetError();
-	if (error != AL_NO_ERROR) {
-		warning("OpenAL error while filling buffer: 0x%X", error);
-		return false;
+		channel.freeBuffers.push_back(alBuffer);
+		if (!channel.queuedSamples.empty())
+			channel.queuedSamples.pop_front();
 	}
 
-	return true;
+	return !endOfData && !channel.freeBuffers.empty();
 }
 
-void SoundManager::bufferData(uint16 channel) {
-	if ((channel == 0) || !_channels[channel])
-		return;
-
-	bufferData(*_channels[channel]);
-}
+void SoundManager::decodeBuffers(Channel &channel) {
+	channel.decodedBuffers = 0;
 
-void SoundManager::bufferData(Channel &channel) {
-	if (!channel.stream || channel.stream->endOfData())
+	if ((channel.format == AL_NONE) || channel.staging.empty())
 		return;
 
-	if (!_hasSound)
-		return;
+	const uint64 start = SDL_GetPerformanceCounter();
 
-	// Get the number of buffers that have been processed
-	ALint buffersProcessed;
-	alGetSourcei(channel.source, AL_BUFFERS_PROCESSED, &buffersProcessed);
+	const uint32 count = MIN<uint32>(channel.freeBuffers.size(), channel.decodedSamples.size());
 
-	// Pull all processed buffers from the queue and put them into our free list
-	while (buffersProcessed--) {
-		ALuint alBuffer;
+	// Decode straight into the channel's staging buffers
+	while ((channel.decodedBuffers < count) && !channel.stream->endOfData()) {
+		int16 *data = &channel.staging[channel.decodedBuffers * channel.bufferSamples];
 
-		alSourceUnqueueBuffers(channel.source, 1, &alBuffer);
+		const int numSamples = channel.stream->readBuffer(data, channel.bufferSamples);
 
-		channel.freeBuffers.push_back(alBuffer);
+		channel.decodedSamples[channel.decodedBuffers++] = MAX(numSamples, 0);
 	}
 
-	// Buffer as long as we still have data and free buffers
+	channel.decodeTicks += SDL_GetPerformanceCounter() - start;
+}
+
+void SoundManager::queueBuffers(Channel &channel) {
 	std::list<ALuint>::iterator buffer = channel.freeBuffers.begin();
-	while (buffer != channel.freeBuffers.end()) {
-		if (!fillBuffer(channel.source, *buffer, channel.stream))
+
+	for (uint32 i = 0; (i < channel.decodedBuffers) && (buffer != channel.freeBuffers.end()); i++) {
+		const uint32 numSamples = channel.decodedSamples[i];
+		if (numSamples == 0)
+			continue;
+
+		alBufferData(*buffer, channel.format, &channel.staging[i * channel.bufferSamples],
+		             numSamples * 2, channel.rate);
+
+		ALenum error = alGetError();
+		if (error != AL_NO_ERROR) {
+			warning("OpenAL error while filling buffer: 0x%X", error);
 			break;
+		}
 
 		alSourceQueueBuffers(channel.source, 1, &*buffer);
 
+		if ((error = alGetError()) != AL_NO_ERROR) {
+			warning("OpenAL error while queueing buffer: 0x%X", error);
+			break;
+		}
+
+		_statistics.refills++;
+
+		channel.queuedSamples.push_back(numSamples);
+
 		buffer = channel.freeBuffers.erase(buffer);
 	}
+
+	channel.decodedBuffers = 0;
+
+	_statistics.decodeTime += ((double) channel.decodeTicks) / SDL_GetPerformanceFrequency();
+	channel.decodeTicks     = 0;
+}
+
+void SoundManager::decodeChannels() {
+	const uint32 count = _decodeQueue.size();
+
+	// Not worth handing out
+	if (_decodeWorkers.empty() || (count < 2)) {
+		for (std::vector<Channel *>::iterator c = _decodeQueue.begin(); c != _decodeQueue.end(); ++c)
+			decodeBuffers(**c);
+
+		return;
+	}
+
+	{
+		Common::StackLock lock(_decodeMutex);
+
+		_decodeJobs.assign(_decodeQueue.begin(), _decodeQueue.end());
+	}
+
+	for (uint32 i = 0; i < count; i++)
+		_decodeJobCount.unlock();
+
+	// Help out the workers, then wait for them to finish
+	Channel *channel;
+	while (takeDecodeJob(channel, false))
+		finishDecodeJob(*channel);
+
+	for (uint32 i = 0; i < count; i++)
+		_decodeDone.lock();
 }
 
+bool SoundManager::takeDecodeJob(Channel *&channel, bool wait) {
+	if (wait ? !_decodeJobCount.lock(100) : !_decodeJobCount.lockTry())
+		return false;
+
+	Common::StackLock lock(_decodeMutex);
+
+	if (_decodeJobs.empty())
+		return false;
+
+	channel = _decodeJobs.back();
+	_decodeJobs.pop_back();
+
+	return true;
+}
+
+void SoundManager::finishDecodeJob(Channel &channel) {
+	decodeBuffers(channel);
+
+	_decodeDone.unlock();
+}
+
+uint32 SoundManager::getDeadline(Channel &channel) const {
+	if (!_hasSound || (channel.state != AL_PLAYING) || (channel.rate == 0))
+		return kMaxSleep;
+
+	// A stream decoded ahead might not have had anything for us yet, so look again soon
+	if (channel.queuedSamples.empty())
+		return (channel.stream && !channel.stream->endOfStream()) ? kMinSleep : kMaxSleep;
+
+	ALint offset;
+	alGetSourcei(channel.source, AL_SAMPLE_OFFSET, &offset);
+
+	// Frames left until the first queued buffer is played, and can be refilled
+	const uint32 frames = channel.queuedSamples.front() / channel.channelCount;
+	const uint32 left   = (frames > (uint32) MAX<ALint>(offset, 0)) ? (frames - offset) : 0;
+
+	return (left * 1000) / channel.rate;
+}
 void SoundManager::checkReady() {
 	if (!_ready)
 		throw Common::Exception("SoundManager not ready");
 }
 
-void SoundManager::update() {
+uint32 SoundManager::update() {
 	Common::StackLock lock(_mutex);
 
-	for (int i = 1; i < kChannelCount; i++) {
-		if (!_channels[i])
-			continue;
+	const uint64 start = SDL_GetPerformanceCounter();
+
+	_decodeQueue.clear();
+
+	/* Walk backwards, so that freeing a channel, which moves the last
+	 * active channel into its place, doesn't skip any channel. */
+	for (uint32 i = _activeChannels.size(); i-- > 0; ) {
+		const uint16 channel = _activeChannels[i];
 
 		// Free the channel if it is no longer playing
-		if (!isPlaying(i)) {
-			freeChannel(i);
+		if (!isPlaying(channel)) {
+			freeChannel(channel);
 			continue;
 		}
 
-		// Try to buffer some more data
-		bufferData(i);
+		// Look for channels with buffers to refill
+		if (unqueueBuffers(*_channels[channel]))
+			_decodeQueue.push_back(_channels[channel]);
 	}
-}
 
-ChannelHandle SoundManager::newChannel() {
-	uint16 foundChannel = 0;
+	decodeChannels();
 
-	for (int i = 0; (i < kChannelCount) && !foundChannel; i++) {
-		if (!_channels[i])
-			foundChannel = i;
+	for (std::vector<Channel *>::iterator c = _decodeQueue.begin(); c != _decodeQueue.end(); ++c)
+		queueBuffers(**c);
 
-		// Channel 0 is reserved for "invalid channel"
-		_curChannel = (_curChannel >= kChannelCount) ? 1 : (_curChannel + 1);
-	}
+	// Sleep until the first channel has a buffer to refill
+	uint32 sleep = kMaxSleep;
+	for (std::vector<uint16>::const_iterator c = _activeChannels.begin(); c != _activeChannels.end(); ++c)
+		sleep = MIN(sleep, getDeadline(*_channels[*c]));
+
+	// Or until the first mixer voice needs more decoded frames
+	if (_mixer)
+		sleep = MIN(sleep, _mixer->decode());
 
-	if (!foundChannel)
+	_statistics.updateTime += ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+
+	return sleep;
+}
+
+ChannelHandle SoundManager::newChannel() {
+	if (_freeChannels.empty())
 		throw Common::Exception("All sound channels occupied");
 
 	ChannelHandle handle;
 
-	handle.channel = foundChannel;
+	handle.channel = _freeChannels.back();
 	handle.id      = _curID++;
 
 	// ID 0 is reserved for "invalid ID"
 	if (_curID == 0)
 		_curID++;
 
+	_freeChannels.pop_back();
+
+	Channel *channel = new Channel;
+
+	channel->id          = handle.id;
+	channel->activeIndex = _activeChannels.size();
+
+	_channels[handle.channel] = channel;
+	_activeChannels.push_back(handle.channel);
+
 	return handle;
 }
 
@@ -648,6 +1176,9 @@ void SoundManager::pauseChannel(Channel *channel, bool pause) {
 	} else
 		channel->state = AL_PLAYING;
 
+	if (_mixer && channel->voice)
+		_mixer->setPaused(channel->voice, pause);
+
 	triggerUpdate();
 }
 
@@ -671,9 +1202,20 @@ void SoundManager::freeChannel(uint16 channel) {
 		// Nothing to do
 		return;
 
+	// Take the stream away from the mixer
+	if (_mixer && c->voice)
+		_mixer->removeVoice(c->voice);
+
 	// Discard the stream, if requested
-	if (c->disposeAfterUse)
-		delete c->stream;
+	if (c->disposeAfterUse) {
+		if (c->disposeOnThread) {
+			_finishedStreams.push_back(c->stream);
+
+			_updatePending = true;
+			_needUpdate.signal();
+		} else
+			delete c->stream;
+	}
 
 	if (_hasSound) {
 		// Delete the channel's OpenAL source
@@ -689,15 +1231,69 @@ void SoundManager::freeChannel(uint16 channel) {
 	if (c->typeIt != _types[c->type].list.end())
 		_types[c->type].list.erase(c->typeIt);
 
+	// Remove the channel from the active list, by moving the last active channel into its place
+	const uint16 last = _activeChannels.back();
+
+	_activeChannels[c->activeIndex] = last;
+	_channels[last]->activeIndex    = c->activeIndex;
+
+	_activeChannels.pop_back();
+
+	_freeChannels.push_back(channel);
+
 	// And finally delete the channel itself
 	delete c;
 	_channels[channel] = 0;
 }
 
+void SoundManager::deleteFinishedStreams() {
+	std::vector<AudioStream *> streams;
+
+	{
+		Common::StackLock lock(_mutex);
+
+		streams.swap(_finishedStreams);
+	}
+
+	for (std::vector<AudioStream *>::iterator s = streams.begin(); s != streams.end(); ++s)
+		delete *s;
+}
+
 void SoundManager::threadMethod() {
+	bool   signalled = true;
+	uint32 deadline  = 0;
+
 	while (!_killThread) {
-		update();
-		_needUpdate.wait(100);
+		const uint32 wakeup = SDL_GetTicks();
+
+		uint32 sleep = update();
+
+		deleteFinishedStreams();
+
+		// Mixing as fast as we can doesn't sleep at all
+		const uint32 pumpSleep = pumpMixer();
+
+		sleep = (pumpSleep == 0) ? 0 : MAX(MIN(sleep, pumpSleep), kMinSleep);
+
+		Common::StackLock lock(_mutex);
+
+		_statistics.wakeups++;
+		_statistics.sleepTotal += sleep;
+
+		// How much later than planned did we wake up?
+		if (signalled) {
+			_statistics.signalled++;
+		} else if (wakeup > deadline) {
+			_statistics.lateTotal += wakeup - deadline;
+			_statistics.lateMax    = MAX(_statistics.lateMax, wakeup - deadline);
+		}
+
+		deadline = SDL_GetTicks() + sleep;
+
+		// Only wait if nobody asked for an update while we were busy
+		signalled = _updatePending || ((sleep > 0) && _needUpdate.wait(sleep));
+
+		_updatePending = false;
 	}
 }
 
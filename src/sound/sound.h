@@ -44,14 +44,47 @@
 #include "common/mutex.h"
 
 #include "sound/types.h"
+#include "sound/mixer.h"
+#include "sound/samplecache.h"
+#include "sound/decoders/mp3.h"
 
 namespace Common {
+	class UString;
 	class SeekableReadStream;
+	class DumpFile;
 }
 
 namespace Sound {
 
 class AudioStream;
+class RewindableAudioStream;
+
+/** Statistics about refilling the OpenAL buffers of the sound channels, or about the software mixer. */
+struct SoundStatistics {
+	uint32 bufferTime;  ///< Length of audio per OpenAL buffer, in milliseconds.
+	uint32 bufferCount; ///< Number of OpenAL buffers per channel.
+
+	uint32 refills;   ///< Number of OpenAL buffers filled.
+	uint32 underruns; ///< Number of times a playing channel ran out of queued data.
+
+	uint32 decodeThreads; ///< Number of threads decoding channels in parallel.
+
+	uint32 wakeups;    ///< Number of times the sound thread woke up.
+	uint32 signalled;  ///< Number of times the sound thread was woken up by a triggered update.
+	uint64 sleepTotal; ///< Time the sound thread planned to sleep, in milliseconds.
+	uint64 lateTotal;  ///< Time the sound thread overslept its deadlines, in milliseconds.
+	uint32 lateMax;    ///< Longest time the sound thread overslept a deadline, in milliseconds.
+
+	double updateTime; ///< Time the sound thread spent updating channels, in seconds.
+	double decodeTime; ///< Time spent decoding channels, over all threads, in seconds.
+
+	bool   mixer;       ///< Is the software mixer used instead of OpenAL?
+	uint32 mixRate;     ///< The software mixer's output rate.
+	uint64 mixedFrames; ///< Number of frames the software mixer has mixed.
+	double mixTime;     ///< Time the software mixer took for mixing them, in seconds.
+
+	SoundStatistics();
+};
 
 /** The sound manager. */
 class SoundManager : public Common::Singleton<SoundManager>, public Common::Thread {
@@ -77,6 +110,21 @@ public:
 	/** Is that channel currently playing a sound? */
 	bool isPlaying(const ChannelHandle &handle);
 
+	/** Return the number of channels currently in use. */
+	uint32 getActiveChannelCount();
+
+	/** Return statistics about the buffer refills. */
+	SoundStatistics getStatistics();
+
+	/** Return statistics about the decoded sample cache. */
+	SampleCacheStatistics getSampleCacheStatistics() const;
+
+	/** Remove all sounds from the decoded sample cache, and all cached MP3 seek indices.
+	 *
+	 *  Both are cached by name, so they need to be cleared whenever the resources change.
+	 */
+	void clearSampleCache();
+
 
 	// Playing sounds
 
@@ -93,6 +141,44 @@ public:
 	ChannelHandle playSoundFile(Common::SeekableReadStream *wavStream,
 	                            SoundType type, bool loop = false);
 
+	/** Play a sound file, decoding it into the sample cache if it's short enough and not music.
+	 *
+	 *  This only allocate a channel for the sound, to actually start playing it,
+	 *  call startChannel().
+	 *
+	 *  @param  name A unique name for the sound, to cache it under.
+	 *  @param  wavStream The stream to play. Will be taken over.
+	 *  @param  type The type of the sound.
+	 *  @param  loop Should the sound loop?
+	 *  @return The channel the sound has been assigned to, or -1 on error.
+	 */
+	ChannelHandle playSoundFile(const Common::UString &name, Common::SeekableReadStream *wavStream,
+	                            SoundType type, bool loop = false);
+
+	/** Play a sound out of the decoded sample cache.
+	 *
+	 *  This only allocate a channel for the sound, to actually start playing it,
+	 *  call startChannel().
+	 *
+	 *  @param  name The name the sound was cached under.
+	 *  @param  type The type of the sound.
+	 *  @param  loop Should the sound loop?
+	 *  @return The channel the sound has been assigned to, or an invalid
+	 *          channel if the sound isn't in the cache.
+	 */
+	ChannelHandle playCachedSound(const Common::UString &name, SoundType type, bool loop = false);
+
+	/** Create a decoding audio stream out of a sound file.
+	 *
+	 *  @param  stream The sound file. Will be taken over.
+	 *  @param  name A unique name for the sound, to cache information for seeking
+	 *               in it under, until clearSampleCache() is called. If empty,
+	 *               nothing is cached.
+	 *  @return The audio stream. Throws a Common::Exception if the file format isn't supported.
+	 */
+	RewindableAudioStream *makeAudioStream(Common::SeekableReadStream *stream,
+	                                       const Common::UString &name = "");
+
 	/** Play an audio stream.
 	 *
 	 *  This only allocate a channel for the sound, to actually start playing it,
@@ -174,21 +260,39 @@ private:
 
 		AudioStream *stream;  ///< The actual audio stream.
 		bool disposeAfterUse; ///< Delete the audio stream when done playing?
+		bool disposeOnThread; ///< Leave deleting the audio stream to the sound thread?
 
 		ALuint source; ///< OpenAL source for this channel.
 
 		std::list<ALuint> buffers;     ///< List of buffers for that channel.
 		std::list<ALuint> freeBuffers; ///< List of free buffers not filled with data.
 
+		ALenum format;        ///< The OpenAL format of the stream's data.
+		uint32 rate;          ///< The stream's sample rate.
+		uint32 channelCount;  ///< The stream's number of channels.
+		uint32 bufferSamples; ///< Number of samples per OpenAL buffer.
+
+		std::vector<int16> staging; ///< The stream is decoded into here, one buffer after the other.
+
+		std::vector<uint32> decodedSamples; ///< Number of samples decoded into each staging buffer.
+		uint32 decodedBuffers;              ///< Number of staging buffers decoded.
+		uint64 decodeTicks;                 ///< Time spent decoding, not yet counted in the statistics.
+
+		std::list<uint32> queuedSamples; ///< Number of samples in each OpenAL buffer queued.
+
 		SoundType type;            ///< The channel's sound type.
 		TypeList::iterator typeIt; ///< Iterator into the type list.
 
 		float gain; ///< The channel's gain.
+
+		Mixer::Voice *voice; ///< The software mixer voice playing this channel.
+
+		uint32 activeIndex; ///< Index into the list of active channels.
 	};
 
 	bool _ready; ///< Was the sound subsystem successfully initialized?
 
-	bool _hasSound; //< Do we have working sound output?
+	bool _hasSound; //< Do we have working OpenAL sound output?
 
 	bool _hasMultiChannel; ///< Do we have the multi-channel extension?
 	ALenum _format51; ///< The value for the 5.1 multi-channel format.
@@ -196,30 +300,102 @@ private:
 	Channel *_channels[kChannelCount]; ///< The sound channels.
 	Type     _types   [kSoundTypeMAX]; ///< The sound types.
 
-	uint16 _curChannel; ///< Position to start looking for a free channel.
-	uint32 _curID;      ///< The ID the next sound will get.
+	std::vector<uint16> _activeChannels; ///< The channels currently in use, in no particular order.
+	std::vector<uint16> _freeChannels;   ///< The channels not in use.
+
+	uint32 _curID; ///< The ID the next sound will get.
+
+	SoundStatistics _statistics;
+
+	SampleCache _sampleCache; ///< Completely decoded short sounds.
+
+	MP3SeekIndexCache _mp3SeekIndices; ///< Frame positions of the MP3s played last.
+
+	uint32 _readAheadTime; ///< Length of music, in milliseconds, to decode ahead on its own thread.
 
 	Common::Mutex _mutex;
 
-	/** Condition to signal that an update is needed. */
+	class DecodeWorker;
+
+	std::list<DecodeWorker *> _decodeWorkers;
+
+	/** Streams of freed channels, to be deleted by the sound thread outside of the lock. */
+	std::vector<AudioStream *> _finishedStreams;
+
+	std::vector<Channel *> _decodeQueue; ///< Channels with buffers to refill.
+	std::vector<Channel *> _decodeJobs;  ///< Channels waiting to be picked up by a decoding thread.
+
+	Common::Semaphore _decodeJobCount; ///< Number of channels waiting to be decoded.
+	Common::Semaphore _decodeDone;     ///< Number of channels decoded.
+
+	Common::Mutex _decodeMutex;
+
+	bool _updatePending; ///< Has an update been asked for since the thread last woke up?
+
+	/** Condition to signal that an update is needed. Waited on with _mutex held. */
 	Common::Condition _needUpdate;
 
 	ALCdevice *_dev;
 	ALCcontext *_ctx;
 
+	Mixer *_mixer; ///< The software mixer, if used instead of OpenAL.
+
+	uint32 _audioDevice; ///< The SDL audio device the mixer plays on.
+
+	Common::DumpFile *_wavFile; ///< The WAVE file the mixer writes into.
+	uint32 _wavSize;            ///< Number of bytes of audio written into the WAVE file.
+
+	bool   _pumpRealtime;           ///< Mix in real time without an audio device?
+	uint32 _pumpStart;              ///< When the mixer was started without an audio device.
+	uint64 _pumpFrames;             ///< Frames mixed since then.
+	std::vector<int16> _pumpBuffer; ///< The mixer output for the null and WAVE file outputs.
+
 	/** Check that the SoundManager was properly initialized. */
 	void checkReady();
 
-	/** Update the sound information. Called regularily from within the thread method. */
-	void update();
+	/** Create the software mixer and its output. */
+	bool initMixer(const Common::UString &output);
+	/** Close the software mixer and its output. */
+	void deinitMixer();
 
-	/** Look for a free place in the channel vector. */
+	/** Mix for an output without an audio device.
+	 *
+	 *  @return The time, in milliseconds, until more needs to be mixed.
+	 */
+	uint32 pumpMixer();
+	/** Mix that many frames into the output without an audio device. */
+	void pumpMixer(uint32 count);
+
+	/** Feed the SDL audio device with mixed audio. */
+	static void mixerCallback(void *userdata, uint8 *stream, int len);
+
+	/** Update the sound information. Called regularily from within the thread method.
+	 *
+	 *  @return The time, in milliseconds, until a channel needs to be updated again.
+	 */
+	uint32 update();
+
+	/** Take a free channel and make it active. */
 	ChannelHandle newChannel();
 
-	/** Buffer more sound from the channel to the OpenAL buffers. */
-	void bufferData(Channel &channel);
-	/** Buffer more sound from the channel to the OpenAL buffers. */
-	void bufferData(uint16 channel);
+	/** Return the OpenAL format for a stream with that many channels, or AL_NONE. */
+	ALenum getFormat(int channelCount) const;
+
+	/** Take the processed buffers from the channel's queue. Does the channel have buffers to refill? */
+	bool unqueueBuffers(Channel &channel);
+	/** Decode the stream into the channel's staging buffers, one for each free buffer. Thread-safe per channel. */
+	void decodeBuffers(Channel &channel);
+	/** Give the decoded staging buffers to OpenAL and queue them. */
+	void queueBuffers(Channel &channel);
+
+	/** Decode all channels with buffers to refill, in parallel. */
+	void decodeChannels();
+
+	bool takeDecodeJob(Channel *&channel, bool wait);
+	void finishDecodeJob(Channel &channel);
+
+	/** Return the time, in milliseconds, until the channel has a buffer to refill. */
+	uint32 getDeadline(Channel &channel) const;
 
 	/** Is that channel currently playing a sound? */
 	bool isPlaying(uint16 channel) const;
@@ -235,12 +411,19 @@ private:
 	/** Return the channel the handle refers to. */
 	Channel *getChannel(const ChannelHandle &handle);
 
+	/** Delete the streams of freed channels that were left to the sound thread. */
+	void deleteFinishedStreams();
+
 	void threadMethod();
 
-	static AudioStream *makeAudioStream(Common::SeekableReadStream *stream);
+	/** Play a sound, optionally looping it, and optionally decoding it ahead if it's music. */
+	ChannelHandle playSound(RewindableAudioStream *stream, SoundType type, bool loop, bool readAhead);
+
+	/** Play an audio stream, optionally leaving deleting it to the sound thread. */
+	ChannelHandle playStream(AudioStream *audStream, SoundType type,
+	                         bool disposeAfterUse, bool disposeOnThread);
 
-	/** Fill the buffer with data from the audio stream. */
-	bool fillBuffer(ALuint source, ALuint alBuffer, AudioStream *stream) const;
+	friend class DecodeWorker;
 };
 
 } // End of namespace Sound
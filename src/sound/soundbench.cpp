@@ -0,0 +1,126 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/soundbench.cpp
+ *  Checking and measuring the sound decoders and channels.
+ */
+
+#include <cmath>
+
+#include <vector>
+
+#include <SDL_timer.h>
+
+#include "common/util.h"
+#include "common/maths.h"
+#include "common/error.h"
+#include "common/stream.h"
+
+#include "sound/sound.h"
+#include "sound/audiostream.h"
+#include "sound/soundbench.h"
+#include "sound/decoders/pcm.h"
+
+namespace Sound {
+
+/** Decode a whole stream, hashing its samples. */
+static uint32 decodeStream(AudioStream &stream, uint32 &checksum) {
+	static const int kDecodeSamples = 4096;
+	int16 buffer[kDecodeSamples];
+
+	// FNV-1a over the decoded samples
+	uint32 samples = 0;
+	checksum = 2166136261U;
+
+	int count;
+	while ((count = stream.readBuffer(buffer, kDecodeSamples)) > 0) {
+		for (int j = 0; j < count; j++) {
+			checksum = (checksum ^ ((uint16) buffer[j] & 0xFF)) * 16777619U;
+			checksum = (checksum ^ ((uint16) buffer[j] >> 8  )) * 16777619U;
+		}
+
+		samples += count;
+	}
+
+	return samples;
+}
+
+void benchmarkDecode(Common::SeekableReadStream &file, uint32 runs, DecodeBenchmarkResults &results) {
+	results.runs     = runs;
+	results.samples  = 0;
+	results.rate     = 0;
+	results.channels = 0;
+	results.checksum = 0;
+	results.time     = 0.0;
+
+	// Only measure the decoding, not the reading
+	std::vector<byte> data(file.size());
+
+	file.seek(0);
+	if (data.empty() || (file.read(&data[0], data.size()) != data.size()))
+		throw Common::Exception(Common::kReadError);
+
+	for (uint32 i = 0; i < runs; i++) {
+		const uint64 start = SDL_GetPerformanceCounter();
+
+		AudioStream *stream = SoundMan.makeAudioStream(new Common::MemoryReadStream(&data[0], data.size()));
+
+		try {
+			results.samples = decodeStream(*stream, results.checksum);
+		} catch (...) {
+			delete stream;
+			throw;
+		}
+
+		results.time += ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+
+		results.rate     = stream->getRate();
+		results.channels = stream->getChannels();
+
+		delete stream;
+	}
+}
+
+void stressChannels(uint32 count, uint32 &started) {
+	// A quiet 50ms beep, 16-bit mono at 22050Hz
+	static const int    kRate    = 22050;
+	static const uint32 kSamples = kRate / 20;
+
+	started = 0;
+
+	for (uint32 i = 0; i < count; i++) {
+		byte *data = new byte[kSamples * 2];
+		for (uint32 j = 0; j < kSamples; j++)
+			WRITE_LE_UINT16(data + j * 2, (int16) (1000.0 * sin(j * (2.0 * M_PI * (400 + (i % 400))) / kRate)));
+
+		AudioStream *stream =
+			makePCMStream(new Common::MemoryReadStream(data, kSamples * 2, true), kRate,
+			              FLAG_16BITS | FLAG_LITTLE_ENDIAN, 1);
+
+		ChannelHandle channel = SoundMan.playAudioStream(stream, kSoundTypeSFX);
+
+		SoundMan.setChannelPosition(channel, (float) ((i % 64) - 32), (float) (((i / 64) % 64) - 32), 0.0);
+		SoundMan.startChannel(channel);
+
+		started++;
+	}
+}
+
+} // End of namespace Sound
@@ -0,0 +1,61 @@
+/* xoreos - A reimplementation of BioWare's Aurora engine
+ *
+ * xoreos is the legal property of its developers, whose names
+ * can be found in the AUTHORS file distributed with this source
+ * distribution.
+ *
+ * xoreos is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or (at your option) any later version.
+ *
+ * xoreos is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with xoreos. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file sound/soundbench.h
+ *  Checking and measuring the sound decoders and channels.
+ */
+
+#ifndef SOUND_SOUNDBENCH_H
+#define SOUND_SOUNDBENCH_H
+
+#include "common/types.h"
+
+namespace Common {
+	class SeekableReadStream;
+}
+
+namespace Sound {
+
+/** Results of decoding one sound resource repeatedly. */
+struct DecodeBenchmarkResults {
+	uint32 runs; ///< Number of times the sound was decoded.
+
+	uint32 samples;  ///< Number of samples in the sound.
+	uint32 rate;     ///< The sound's sample rate.
+	uint32 channels; ///< The sound's number of channels.
+
+	uint32 checksum; ///< FNV-1a hash over the decoded samples.
+
+	double time; ///< Time all runs took, in seconds.
+};
+
+/** Decode a sound file that many times, out of memory. */
+void benchmarkDecode(Common::SeekableReadStream &file, uint32 runs, DecodeBenchmarkResults &results);
+
+/** Start that many short positional beeps at once, to stress the sound channels.
+ *
+ *  @param count The number of beeps to start.
+ *  @param started Counts the beeps started. Still valid if starting a beep throws.
+ */
+void stressChannels(uint32 count, uint32 &started);
+
+} // End of namespace Sound
+
+#endif // SOUND_SOUNDBENCH_H